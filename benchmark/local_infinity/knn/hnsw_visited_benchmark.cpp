@@ -0,0 +1,138 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Cost of the visited set in HNSW layer-0 search: the former per query Vector<bool> against the thread local epoch table,
+// followed by end to end QPS of KnnHnsw which now uses the epoch table.
+// usage: hnsw_visited_benchmark [vec_num=1000000] [dim=128] [query_num=10000] [ef=100]
+
+#include "base_profiler.h"
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+import stl;
+import hnsw_alg;
+import hnsw_common;
+import vec_store_type;
+import visited_table;
+
+using namespace infinity;
+
+namespace {
+
+// Touch roughly as many vertices as a layer-0 search with ef=100, M=16 does
+constexpr size_t kTouchPerQuery = 4096;
+
+void BenchVisitedSet(size_t vec_num, size_t query_num) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<VertexType> distrib(0, vec_num - 1);
+    std::vector<VertexType> touched(kTouchPerQuery);
+    for (auto &v : touched) {
+        v = distrib(rng);
+    }
+
+    size_t sink = 0;
+    {
+        BaseProfiler profiler;
+        profiler.Begin();
+        for (size_t q = 0; q < query_num; ++q) {
+            std::vector<bool> visited(vec_num, false);
+            for (VertexType v : touched) {
+                sink += visited[v];
+                visited[v] = true;
+            }
+        }
+        profiler.End();
+        std::cout << "Vector<bool> per query: " << query_num * 1e9 / profiler.Elapsed() << " queries/s" << std::endl;
+    }
+    {
+        BaseProfiler profiler;
+        profiler.Begin();
+        for (size_t q = 0; q < query_num; ++q) {
+            auto visited = VisitedTablePool::ThreadLocal().Acquire(vec_num);
+            for (VertexType v : touched) {
+                sink += visited->TestAndSet(v);
+            }
+        }
+        profiler.End();
+        std::cout << "epoch visited table:    " << query_num * 1e9 / profiler.Elapsed() << " queries/s" << std::endl;
+    }
+    std::cout << "(" << sink << ")" << std::endl;
+}
+
+void BenchHnswSearch(size_t vec_num, size_t dim, size_t query_num, size_t ef) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, u64>;
+    constexpr size_t M = 16;
+    constexpr size_t ef_construction = 200;
+    constexpr size_t chunk_size = 8192;
+    size_t max_chunk_n = (vec_num + chunk_size - 1) / chunk_size;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> distrib_real;
+    auto data = std::make_unique<float[]>(vec_num * dim);
+    for (size_t i = 0; i < vec_num * dim; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    Hnsw hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    {
+        BaseProfiler profiler;
+        profiler.Begin();
+        hnsw_index.InsertVecsRaw(data.get(), vec_num);
+        profiler.End();
+        std::cout << "build " << vec_num << " x " << dim << ": " << profiler.ElapsedToString() << std::endl;
+    }
+
+    hnsw_index.SetEf(ef);
+    std::uniform_int_distribution<size_t> distrib_id(0, vec_num - 1);
+    BaseProfiler profiler;
+    profiler.Begin();
+    size_t correct = 0;
+    for (size_t q = 0; q < query_num; ++q) {
+        size_t id = distrib_id(rng);
+        auto [result_n, d_ptr, l_ptr] = hnsw_index.KnnSearch(data.get() + id * dim, 10);
+        for (size_t i = 0; i < result_n; ++i) {
+            correct += l_ptr[i] == id;
+        }
+    }
+    profiler.End();
+    std::cout << "hnsw search, ef = " << ef << ": " << query_num * 1e9 / profiler.Elapsed() << " QPS, self recall "
+              << double(correct) / query_num << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    size_t vec_num = 1000000;
+    size_t dim = 128;
+    size_t query_num = 10000;
+    size_t ef = 100;
+    if (argc >= 2) {
+        vec_num = std::stoull(argv[1]);
+    }
+    if (argc >= 3) {
+        dim = std::stoull(argv[2]);
+    }
+    if (argc >= 4) {
+        query_num = std::stoull(argv[3]);
+    }
+    if (argc >= 5) {
+        ef = std::stoull(argv[4]);
+    }
+    BenchVisitedSet(vec_num, query_num);
+    BenchHnswSearch(vec_num, dim, query_num, ef);
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Throughput of the distance kernels of every SIMD level supported by this cpu, the level chosen at runtime is marked.
+// usage: simd_dispatch_benchmark [dim=128] [vec_num=100000] [round=20]
+
+#include "base_profiler.h"
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+import stl;
+import simd_dispatch;
+
+using namespace infinity;
+
+namespace {
+
+template <typename T, typename Func>
+void BenchKernel(const char *kernel_name, SIMDLevel level, Func func, const std::vector<T> &query, const std::vector<T> &base, size_t dim, size_t round) {
+    const size_t vec_num = base.size() / dim;
+    double sink = 0;
+    BaseProfiler profiler;
+    profiler.Begin();
+    for (size_t r = 0; r < round; ++r) {
+        for (size_t i = 0; i < vec_num; ++i) {
+            sink += func(query.data(), base.data() + i * dim, dim);
+        }
+    }
+    profiler.End();
+    const double distances_per_second = round * vec_num * 1e9 / profiler.Elapsed();
+    const double gigabytes_per_second = distances_per_second * dim * sizeof(T) / 1e9;
+    std::cout << kernel_name << "\t" << SIMDLevelToString(level) << (level == GetSupportedSIMDLevel() ? " (chosen)" : "") << "\t"
+              << distances_per_second / 1e6 << " M distances/s\t" << gigabytes_per_second << " GB/s\t(" << sink << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    const size_t dim = argc > 1 ? std::stoul(argv[1]) : 128;
+    const size_t vec_num = argc > 2 ? std::stoul(argv[2]) : 100000;
+    const size_t round = argc > 3 ? std::stoul(argv[3]) : 20;
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> rdist(-1, 1);
+    std::uniform_int_distribution<int> idist(-128, 127);
+    std::vector<float> f32_query(dim), f32_base(dim * vec_num);
+    std::vector<int8_t> i8_query(dim), i8_base(dim * vec_num);
+    std::vector<uint8_t> u8_query(dim), u8_base(dim * vec_num);
+    for (auto &v : f32_query) {
+        v = rdist(rng);
+    }
+    for (auto &v : f32_base) {
+        v = rdist(rng);
+    }
+    for (auto &v : i8_query) {
+        v = idist(rng);
+    }
+    for (auto &v : i8_base) {
+        v = idist(rng);
+    }
+    for (auto &v : u8_query) {
+        v = idist(rng) + 128;
+    }
+    for (auto &v : u8_base) {
+        v = idist(rng) + 128;
+    }
+
+    std::cout << "dim: " << dim << ", vec_num: " << vec_num << ", round: " << round << std::endl;
+    for (u8 level = 0; level <= static_cast<u8>(GetSupportedSIMDLevel()); ++level) {
+        const SIMDFunctions &functions = GetSIMDFunctions(static_cast<SIMDLevel>(level));
+        BenchKernel("f32 l2", functions.level_, functions.F32L2(dim), f32_query, f32_base, dim, round);
+        BenchKernel("f32 ip", functions.level_, functions.F32IP(dim), f32_query, f32_base, dim, round);
+        BenchKernel("i8 ip", functions.level_, functions.I8IP(dim), i8_query, i8_base, dim, round);
+        // dim bytes of packed bits
+        BenchKernel("hamming", functions.level_, functions.hamming_, u8_query, u8_base, dim, round);
+    }
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <thread>
+
+import stl;
+import third_party;
+import profiler;
+import infinity;
+
+import internal_types;
+import logical_type;
+import column_def;
+import data_type;
+import query_options;
+import extra_ddl_info;
+import statement_common;
+import parsed_expr;
+import constant_expr;
+
+using namespace infinity;
+
+// Generates a large wal with the appends of many tables, and then measures the startup time, most of which is the wal
+// replay, with different numbers of replay threads.
+
+void WriteConfig(const String &path, SizeT replay_thread_num) {
+    std::ofstream ofs(path + "/infinity_conf.toml", std::ios::trunc);
+    ofs << "[general]\n"
+        << "version = \"0.2.0\"\n"
+        << "time_zone = \"utc-8\"\n"
+        << "[network]\n"
+        << "[log]\n"
+        << "log_dir = \"" << path << "/log\"\n"
+        << "log_to_stdout = false\n"
+        << "[storage]\n"
+        << "data_dir = \"" << path << "/data\"\n"
+        << "[buffer]\n"
+        << "temp_dir = \"" << path << "/tmp\"\n"
+        << "[wal]\n"
+        << "wal_dir = \"" << path << "/wal\"\n"
+        << "# no checkpoint, so that the whole wal is replayed\n"
+        << "full_checkpoint_interval = \"0s\"\n"
+        << "delta_checkpoint_interval = \"0s\"\n"
+        << "replay_wal_thread_num = " << replay_thread_num << "\n"
+        << "[resource]\n";
+}
+
+void GenerateWal(const String &path, SizeT table_count, SizeT entry_count, SizeT rows_per_entry, SizeT client_count) {
+    WriteConfig(path, 1);
+    Infinity::LocalInit(path);
+    {
+        SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+        for (SizeT table_id = 0; table_id < table_count; ++table_id) {
+            Vector<ColumnDef *> column_defs;
+            column_defs.push_back(new ColumnDef(0, MakeShared<DataType>(LogicalType::kBigInt), "c1", std::set<ConstraintType>()));
+            column_defs.push_back(new ColumnDef(1, MakeShared<DataType>(LogicalType::kBigInt), "c2", std::set<ConstraintType>()));
+            CreateTableOptions create_tb_options;
+            create_tb_options.conflict_type_ = ConflictType::kIgnore;
+            infinity->CreateTable("default_db",
+                                  fmt::format("wal_replay_{}", table_id),
+                                  std::move(column_defs),
+                                  Vector<TableConstraint *>{},
+                                  std::move(create_tb_options));
+        }
+        infinity->LocalDisconnect();
+    }
+
+    BaseProfiler profiler;
+    profiler.Begin();
+    // The clients insert into all the tables in turn, so the entries of the tables interleave in the wal.
+    Vector<std::thread> clients;
+    for (SizeT client_id = 0; client_id < client_count; ++client_id) {
+        clients.emplace_back([=]() {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            for (SizeT entry_id = client_id; entry_id < entry_count; entry_id += client_count) {
+                auto *columns = new Vector<String>{"c1", "c2"};
+                auto *values = new Vector<Vector<ParsedExpr *> *>();
+                for (SizeT row_id = 0; row_id < rows_per_entry; ++row_id) {
+                    auto *value_list = new Vector<ParsedExpr *>();
+                    for (SizeT column_id = 0; column_id < columns->size(); ++column_id) {
+                        auto *const_expr = new ConstantExpr(LiteralType::kInteger);
+                        const_expr->integer_value_ = entry_id * rows_per_entry + row_id;
+                        value_list->push_back(const_expr);
+                    }
+                    values->push_back(value_list);
+                }
+                infinity->Insert("default_db", fmt::format("wal_replay_{}", entry_id % table_count), columns, values);
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    for (auto &client : clients) {
+        client.join();
+    }
+    profiler.End();
+    std::cout << fmt::format("Generate wal: {} entries of {} rows on {} tables, cost: {}",
+                             entry_count,
+                             rows_per_entry,
+                             table_count,
+                             profiler.ElapsedToString())
+              << std::endl;
+    Infinity::LocalUnInit();
+}
+
+int main(int argc, char *argv[]) {
+    CLI::App app{"wal_replay_benchmark"};
+    String path = "/var/infinity/wal_replay_benchmark";
+    SizeT table_count = 16;
+    SizeT entry_count = 100000;
+    SizeT rows_per_entry = 8;
+    SizeT client_count = 8;
+    Vector<SizeT> replay_thread_nums{1, 2, 4, 8, 16};
+    app.add_option("--path", path, "directory of the generated database, removed at start");
+    app.add_option("--tables", table_count, "number of tables, default value 16");
+    app.add_option("--entries", entry_count, "number of wal entries, each is an insert, default value 100000");
+    app.add_option("--rows", rows_per_entry, "rows of each insert, default value 8");
+    app.add_option("--clients", client_count, "number of insert threads, default value 8");
+    app.add_option("--replay-threads", replay_thread_nums, "replay thread numbers to measure, default value 1 2 4 8 16");
+    try {
+        app.parse(argc, argv);
+    } catch (const CLI::ParseError &e) {
+        return app.exit(e);
+    }
+
+    String generated_path = path + "/generated";
+    String run_path = path + "/run";
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(generated_path);
+    GenerateWal(generated_path, table_count, entry_count, rows_per_entry, client_count);
+
+    for (SizeT replay_thread_num : replay_thread_nums) {
+        // Replay on a copy, since a replay may checkpoint and truncate the wal.
+        std::filesystem::remove_all(run_path);
+        std::filesystem::copy(generated_path, run_path, std::filesystem::copy_options::recursive);
+        WriteConfig(run_path, replay_thread_num);
+
+        BaseProfiler profiler;
+        profiler.Begin();
+        Infinity::LocalInit(run_path);
+        profiler.End();
+        std::cout << fmt::format("Replay threads: {}, startup cost: {}", replay_thread_num, profiler.ElapsedToString()) << std::endl;
+        Infinity::LocalUnInit();
+    }
+    std::filesystem::remove_all(path);
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Run a skewed query workload through the TaskScheduler with work stealing off and on: a few full scans of a big table
+// (like PhysicalKnnScan on big segments) among many queries on a small table, issued by concurrent clients.
+
+#include "base_profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+import stl;
+import infinity;
+import infinity_context;
+import task_scheduler;
+import local_file_system;
+import query_result;
+
+using namespace infinity;
+
+namespace {
+
+void CheckQuery(const SharedPtr<Infinity> &infinity, const String &sql) {
+    QueryResult result = infinity->Query(sql);
+    if (!result.IsOk()) {
+        std::cerr << sql << ": " << result.ErrorMsg() << std::endl;
+        std::exit(1);
+    }
+}
+
+void CreateTable(const SharedPtr<Infinity> &infinity, const String &table_name, u64 row_count, const String &csv_path) {
+    {
+        std::ofstream csv(csv_path);
+        for (u64 i = 0; i < row_count; ++i) {
+            csv << i % 1000 << ',' << i << '\n';
+        }
+    }
+    CheckQuery(infinity, "CREATE TABLE " + table_name + " (c1 INTEGER, c2 BIGINT)");
+    CheckQuery(infinity, "COPY " + table_name + " FROM '" + csv_path + "' WITH (DELIMITER ',')");
+}
+
+u64 TotalSteal(TaskScheduler *task_scheduler) {
+    u64 total_steal = 0;
+    for (const auto &statistics : task_scheduler->GetWorkerStatistics()) {
+        total_steal += statistics.steal_count_;
+    }
+    return total_steal;
+}
+
+void RunQueries(bool work_stealing, u64 client_count, u64 query_count, u64 long_query_ratio) {
+    TaskScheduler *task_scheduler = InfinityContext::instance().task_scheduler();
+    task_scheduler->SetWorkStealing(work_stealing);
+    const u64 steal_begin = TotalSteal(task_scheduler);
+
+    std::atomic<u64> next_query{0};
+    std::vector<std::vector<u64>> latencies_us(client_count);
+    std::vector<std::thread> clients;
+    BaseProfiler profiler;
+    profiler.Begin();
+    for (u64 client_id = 0; client_id < client_count; ++client_id) {
+        clients.emplace_back([&, client_id] {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            for (u64 query_id = next_query++; query_id < query_count; query_id = next_query++) {
+                const char *sql = query_id % long_query_ratio == 0 ? "SELECT c1, SUM(c2) FROM big GROUP BY c1" : "SELECT SUM(c2) FROM small";
+                auto begin = std::chrono::steady_clock::now();
+                CheckQuery(infinity, sql);
+                auto elapsed = std::chrono::steady_clock::now() - begin;
+                latencies_us[client_id].push_back(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    for (auto &client : clients) {
+        client.join();
+    }
+    profiler.End();
+
+    std::vector<u64> all_latencies_us;
+    for (const auto &client_latencies_us : latencies_us) {
+        all_latencies_us.insert(all_latencies_us.end(), client_latencies_us.begin(), client_latencies_us.end());
+    }
+    std::sort(all_latencies_us.begin(), all_latencies_us.end());
+    std::cout << "work stealing " << (work_stealing ? "on" : "off") << ": " << profiler.ElapsedToString()
+              << ", p50: " << all_latencies_us[all_latencies_us.size() / 2] << "us"
+              << ", p99: " << all_latencies_us[all_latencies_us.size() * 99 / 100] << "us"
+              << ", steal: " << TotalSteal(task_scheduler) - steal_begin << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    u64 client_count = 16;
+    u64 query_count = 4096;
+    u64 long_query_ratio = 64;
+    u64 big_row_count = 8 * 1024 * 1024;
+    u64 small_row_count = 8 * 1024;
+    if (argc >= 2) {
+        client_count = std::stoull(argv[1]);
+    }
+    if (argc >= 3) {
+        query_count = std::stoull(argv[2]);
+    }
+
+    String path = "/var/infinity";
+    LocalFileSystem fs;
+    fs.CleanupDirectory(path);
+    Infinity::LocalInit(path);
+
+    {
+        SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+        String csv_dir = path + "/benchmark_data";
+        fs.CreateDirectory(csv_dir);
+        CreateTable(infinity, "big", big_row_count, csv_dir + "/big.csv");
+        CreateTable(infinity, "small", small_row_count, csv_dir + "/small.csv");
+        infinity->LocalDisconnect();
+    }
+
+    std::cout << "clients: " << client_count << ", queries: " << query_count << ", 1/" << long_query_ratio << " queries scan "
+              << big_row_count << " rows, the others " << small_row_count << " rows" << std::endl;
+    RunQueries(false, client_count, query_count, long_query_ratio);
+    RunQueries(true, client_count, query_count, long_query_ratio);
+
+    Infinity::LocalUnInit();
+    return 0;
+}
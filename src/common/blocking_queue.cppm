@@ -151,6 +151,33 @@ public:
         return true;
     }
 
+    // Wait at most `timeout` for the queue to become non-empty
+    bool DequeueBulkFor(Vector<T> &output_array, MicroSeconds timeout) {
+        {
+            std::unique_lock <std::mutex> lock(queue_mutex_);
+            if (!empty_cv_.wait_for(lock, timeout, [this] { return !queue_.empty(); })) {
+                return false;
+            }
+            output_array.insert(output_array.end(), queue_.begin(), queue_.end());
+            queue_.clear();
+        }
+        full_cv_.notify_one();
+        return true;
+    }
+
+    bool DequeueBulkFor(Deque<T> &output_array, MicroSeconds timeout) {
+        {
+            std::unique_lock <std::mutex> lock(queue_mutex_);
+            if (!empty_cv_.wait_for(lock, timeout, [this] { return !queue_.empty(); })) {
+                return false;
+            }
+            output_array.insert(output_array.end(), queue_.begin(), queue_.end());
+            queue_.clear();
+        }
+        full_cv_.notify_one();
+        return true;
+    }
+
     [[nodiscard]] SizeT Size() const {
         std::lock_guard<std::mutex> lock(queue_mutex_);
         return queue_.size();
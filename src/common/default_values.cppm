@@ -35,6 +35,7 @@ export {
     constexpr std::string_view COLUMN_NAME_DELETE = "__delete";
     constexpr std::string_view COLUMN_NAME_SCORE = "__score";
     constexpr std::string_view COLUMN_NAME_DISTANCE = "__distance";
+    constexpr std::string_view COLUMN_NAME_QUERY_INDEX = "__query_index";
 
     // type related constants
     constexpr i64 MAX_VARCHAR_SIZE = 65536;
@@ -49,6 +50,11 @@ export {
     constexpr i64 MIN_BLOCK_CAPACITY = 8192;
     constexpr i16 INVALID_BLOCK_ID = std::numeric_limits<i16>::max();
     constexpr i64 MAX_BLOCK_COUNT_IN_SEGMENT = 65536L;
+    // blocks ahead of the current one whose files a scan asks the buffer manager to read ahead
+    constexpr SizeT DEFAULT_READAHEAD_BLOCK_COUNT = 2;
+    constexpr u32 DEFAULT_ASYNC_IO_QUEUE_DEPTH = 64;
+    // a group-by over at least this many blocks is pre-aggregated per task and merged by partition in parallel
+    constexpr SizeT PARALLEL_AGGREGATE_MIN_BLOCK_COUNT = 16;
 
     // column vector related constants
     constexpr i64 DEFAULT_VECTOR_SIZE = DEFAULT_BLOCK_CAPACITY;
@@ -72,6 +78,12 @@ export {
     constexpr SizeT EXECUTOR_TASK_QUEUE_SIZE = 1024;
     constexpr SizeT DEFAULT_BLOCKING_QUEUE_SIZE = 1024;
 
+    // scheduler related constants
+    constexpr i64 DEFAULT_WORK_STEALING_DEQUE_SIZE = 1024;   // must be power of 2
+    constexpr i64 MIN_SCHEDULER_IDLE_WAIT_US = 50;           // first sleep of an idle worker before it retries stealing
+    constexpr i64 MAX_SCHEDULER_IDLE_WAIT_US = 10 * 1000;    // idle sleep backs off exponentially up to 10ms
+    constexpr u64 BACKGROUND_TASK_WORKER_PERCENT = 25;       // background class (compact, create index) runs on at most 1/4 workers
+
     // transaction related constants
     constexpr u64 MAX_TXN_ID = std::numeric_limits<u64>::max();
     constexpr u64 MAX_TIMESTAMP = std::numeric_limits<u64>::max();
@@ -81,6 +93,14 @@ export {
     constexpr SizeT MB = 1024 * KB;
     constexpr SizeT GB = 1024 * MB;
 
+    // rows the tasks of a sort buffer before one of them sorts its rows into a run and spills the run, in bytes of their values and sort keys
+    constexpr SizeT SORT_RUN_MEMORY_BUDGET = 64 * MB;
+    // merged blocks a sort emits per execution
+    constexpr SizeT SORT_MERGE_BLOCK_COUNT = 4;
+
+    // parsed select statements kept by the statement cache
+    constexpr SizeT STATEMENT_CACHE_CAPACITY = 1024;
+
     constexpr SizeT DEFAULT_RANDOM_NAME_LEN = 10;
 
     constexpr SizeT DEFAULT_BASE_NUM = 2;
@@ -102,10 +122,33 @@ export {
     constexpr std::string_view DEFAULT_OPTIMIZE_INTERVAL_SEC_STR = "10s"; // 10 seconds
     constexpr SizeT MAX_OPTIMIZE_INTERVAL_SEC = 60 * 60 * 24 * 30; // 1 month
 
+    constexpr SizeT MIN_SCRUB_INTERVAL_SEC = 0; // 0 means disable the function
+    constexpr SizeT DEFAULT_SCRUB_INTERVAL_SEC = 10;
+    constexpr std::string_view DEFAULT_SCRUB_INTERVAL_SEC_STR = "10s"; // 10 seconds
+    constexpr SizeT MAX_SCRUB_INTERVAL_SEC = 60 * 60 * 24 * 30; // 1 month
+
+    constexpr i64 MIN_SCRUB_IO_RATE_LIMIT = 64 * 1024;                // 64KB per second
+    constexpr i64 DEFAULT_SCRUB_IO_RATE_LIMIT = 4 * 1024l * 1024l;    // 4MB per second
+    constexpr std::string_view DEFAULT_SCRUB_IO_RATE_LIMIT_STR = "4MB"; // 4MB per second
+    constexpr i64 MAX_SCRUB_IO_RATE_LIMIT = 16 * 1024l * 1024l * 1024l; // 16GB per second
+
     constexpr SizeT MIN_MEMINDEX_CAPACITY = DEFAULT_BLOCK_CAPACITY;           // 1 Block
     constexpr SizeT DEFAULT_MEMINDEX_CAPACITY = 128 * DEFAULT_BLOCK_CAPACITY; // 128 * 8192 = 1M rows
     constexpr SizeT MAX_MEMINDEX_CAPACITY = DEFAULT_SEGMENT_CAPACITY;         // 1 Segment
 
+    constexpr SizeT MIN_HNSW_BUILD_THREAD_NUM = 0; // 0 means cpu_count
+    constexpr SizeT DEFAULT_HNSW_BUILD_THREAD_NUM = 0;
+    constexpr SizeT MAX_HNSW_BUILD_THREAD_NUM = 16384;
+
+    constexpr i64 MIN_WAL_GROUP_COMMIT_MAX_WAIT_US = 0;              // no wait
+    constexpr i64 DEFAULT_WAL_GROUP_COMMIT_MAX_WAIT_US = 0;          // no wait
+    constexpr i64 MAX_WAL_GROUP_COMMIT_MAX_WAIT_US = 1000l * 1000l; // 1s
+    constexpr i64 WAL_PREALLOCATE_SIZE = 64 * 1024l * 1024l;         // 64MB
+
+    constexpr SizeT MIN_REPLAY_WAL_THREAD_NUM = 0; // 0 means cpu_count
+    constexpr SizeT DEFAULT_REPLAY_WAL_THREAD_NUM = 0;
+    constexpr SizeT MAX_REPLAY_WAL_THREAD_NUM = 16384;
+
     constexpr i64 MIN_WAL_FILE_SIZE_THRESHOLD = 1024;                                    // 1KB
     constexpr i64 DEFAULT_WAL_FILE_SIZE_THRESHOLD = 1 * 1024l * 1024l * 1024l;           // 1GB
     constexpr std::string_view DEFAULT_WAL_FILE_SIZE_THRESHOLD_STR = "1GB";           // 1GB
@@ -141,6 +184,9 @@ export {
     constexpr SizeT HNSW_EF_CONSTRUCTION = 200;
     constexpr SizeT HNSW_EF = 200;
 
+    // candidates of a hamming knn search per result, when they are reranked by a float column
+    constexpr i64 DEFAULT_FLOAT_RERANK_FACTOR = 4;
+
     // default distance compute blas parameter
     constexpr SizeT DISTANCE_COMPUTE_BLAS_QUERY_BS = 4096;
     constexpr SizeT DISTANCE_COMPUTE_BLAS_DATABASE_BS = 1024;
@@ -183,6 +229,9 @@ export {
     constexpr std::string_view COMPACT_INTERVAL_OPTION_NAME = "compact_interval";
     constexpr std::string_view OPTIMIZE_INTERVAL_OPTION_NAME = "optimize_interval";
     constexpr std::string_view MEM_INDEX_CAPACITY_OPTION_NAME = "mem_index_capacity";
+    constexpr std::string_view HNSW_BUILD_THREAD_NUM_OPTION_NAME = "hnsw_build_thread_num";
+    constexpr std::string_view SCRUB_INTERVAL_OPTION_NAME = "scrub_interval";
+    constexpr std::string_view SCRUB_IO_RATE_LIMIT_OPTION_NAME = "scrub_io_rate_limit";
 
     constexpr std::string_view BUFFER_MANAGER_SIZE_OPTION_NAME = "buffer_manager_size";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
@@ -193,6 +242,8 @@ export {
     constexpr std::string_view DELTA_CHECKPOINT_INTERVAL_OPTION_NAME = "delta_checkpoint_interval";
     constexpr std::string_view DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME = "delta_checkpoint_threshold";
     constexpr std::string_view WAL_FLUSH_OPTION_NAME = "wal_flush";
+    constexpr std::string_view REPLAY_WAL_THREAD_NUM_OPTION_NAME = "replay_wal_thread_num";
+    constexpr std::string_view WAL_GROUP_COMMIT_MAX_WAIT_OPTION_NAME = "wal_group_commit_max_wait";
     constexpr std::string_view RESOURCE_DIR_OPTION_NAME = "resource_dir";
 
     // Variable name
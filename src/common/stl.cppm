@@ -127,6 +127,7 @@ export namespace std {
     using std::make_heap;
     using std::nearbyint;
     using std::pop_heap;
+    using std::push_heap;
     using std::pow;
     using std::remove_if;
     using std::reverse;
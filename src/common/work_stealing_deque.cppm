@@ -0,0 +1,130 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <atomic>
+
+export module work_stealing_deque;
+
+import stl;
+
+namespace infinity {
+
+// Chase-Lev work-stealing deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP'13).
+// Only the owner thread may call Push() and Pop(). Any thread, the owner included, may call Steal().
+// Elements must be trivially copyable, typically raw pointers.
+export template <typename T>
+class WorkStealingDeque {
+    struct RingBuffer {
+        explicit RingBuffer(i64 capacity) : capacity_(capacity), mask_(capacity - 1), data_(MakeUnique<Atomic<T>[]>(capacity)) {}
+
+        inline T Get(i64 idx) const { return data_[idx & mask_].load(std::memory_order_relaxed); }
+
+        inline void Put(i64 idx, T item) { data_[idx & mask_].store(item, std::memory_order_relaxed); }
+
+        RingBuffer *Grow(i64 bottom, i64 top) const {
+            auto *new_buffer = new RingBuffer(capacity_ * 2);
+            for (i64 i = top; i < bottom; ++i) {
+                new_buffer->Put(i, Get(i));
+            }
+            return new_buffer;
+        }
+
+        const i64 capacity_;
+        const i64 mask_;
+        UniquePtr<Atomic<T>[]> data_;
+    };
+
+public:
+    // capacity must be a power of two
+    explicit WorkStealingDeque(i64 capacity = 1024) {
+        auto *buffer = new RingBuffer(capacity);
+        buffer_.store(buffer, std::memory_order_relaxed);
+        retired_buffers_.emplace_back(buffer);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    // Owner only
+    void Push(T item) {
+        i64 bottom = bottom_.load(std::memory_order_relaxed);
+        i64 top = top_.load(std::memory_order_acquire);
+        RingBuffer *buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity_ - 1) {
+            // Old buffers are kept alive until the deque is destroyed, a concurrent thief may still read from them.
+            buffer = buffer->Grow(bottom, top);
+            retired_buffers_.emplace_back(buffer);
+            buffer_.store(buffer, std::memory_order_release);
+        }
+        buffer->Put(bottom, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only, LIFO end
+    bool Pop(T &item) {
+        i64 bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        RingBuffer *buffer = buffer_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Empty
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = buffer->Get(bottom);
+        if (top == bottom) {
+            // Last element, race with thieves
+            bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread, FIFO end
+    bool Steal(T &item) {
+        i64 top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        i64 bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+        RingBuffer *buffer = buffer_.load(std::memory_order_consume);
+        item = buffer->Get(top);
+        return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    // Approximate, only for statistics and victim selection
+    [[nodiscard]] SizeT Size() const {
+        i64 bottom = bottom_.load(std::memory_order_relaxed);
+        i64 top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? bottom - top : 0;
+    }
+
+    [[nodiscard]] bool Empty() const { return Size() == 0; }
+
+private:
+    // top_ and bottom_ are written by different threads, keep them on separate cache lines
+    alignas(64) Atomic<i64> top_{0};
+    alignas(64) Atomic<i64> bottom_{0};
+    alignas(64) Atomic<RingBuffer *> buffer_{nullptr};
+    Vector<UniquePtr<RingBuffer>> retired_buffers_{};
+};
+
+} // namespace infinity
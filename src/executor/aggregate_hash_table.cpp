@@ -0,0 +1,438 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+module aggregate_hash_table;
+
+import stl;
+import column_vector;
+import data_block;
+import data_type;
+import aggregate_function;
+import default_values;
+import logical_type;
+import internal_types;
+import vector_buffer;
+import fix_heap;
+import third_party;
+import status;
+import infinity_exception;
+import base_expression;
+import aggregate_expression;
+import expression_state;
+import expression_evaluator;
+import expression_type;
+
+namespace infinity {
+
+namespace {
+
+// Finalizer of MurmurHash3.
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+constexpr u64 NULL_HASH = 0x9e3779b97f4a7c15ULL;
+
+inline SizeT SourceRow(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+// Width of a group-by value in the key, the null flag excluded.
+SizeT KeyValueWidth(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return 1;
+        }
+        case LogicalType::kVarchar: {
+            return 0;
+        }
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDecimal:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            return data_type.Size();
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", data_type.ToString()));
+            RecoverableError(status);
+        }
+    }
+    return 0;
+}
+
+// Pack a float group-by value so that -0.0 and 0.0 are one group, and so are all the NaNs. Returns the hash of the value.
+template <typename T>
+u64 PackFloatKey(char *dst, const_ptr_t src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    if (std::isnan(value)) {
+        value = std::numeric_limits<T>::quiet_NaN();
+    } else if (value == 0) {
+        value = 0;
+    }
+    std::memcpy(dst, &value, sizeof(T));
+    u64 value_hash = 0;
+    std::memcpy(&value_hash, dst, sizeof(T));
+    return value_hash;
+}
+
+SharedPtr<ColumnVector> EvaluateColumn(ExpressionEvaluator &evaluator, const SharedPtr<BaseExpression> &expr) {
+    SharedPtr<ExpressionState> expr_state = ExpressionState::CreateState(expr);
+    SharedPtr<ColumnVector> column;
+    if (expr->type() != ExpressionType::kReference) {
+        column = MakeShared<ColumnVector>(MakeShared<DataType>(expr->Type()));
+        column->Initialize();
+    }
+    evaluator.Execute(expr, expr_state, column);
+    return column;
+}
+
+} // namespace
+
+AggregateHashTable::AggregateHashTable(Vector<SharedPtr<DataType>> group_types, Vector<const AggregateFunction *> aggregates)
+    : group_types_(std::move(group_types)), aggregates_(std::move(aggregates)) {
+    bool has_varchar = false;
+    for (const auto &group_type : group_types_) {
+        if (group_type->type() == LogicalType::kVarchar) {
+            has_varchar = true;
+        }
+        key_width_ += 1 + KeyValueWidth(*group_type);
+    }
+    if (has_varchar) {
+        key_width_ = 0;
+        group_offsets_.push_back(0);
+    }
+
+    // Keep each state 8-byte aligned.
+    for (const AggregateFunction *aggregate : aggregates_) {
+        state_offsets_.push_back(states_size_);
+        states_size_ += (aggregate->state_size_ + 7) & ~SizeT(7);
+    }
+}
+
+AggregateHashTable::~AggregateHashTable() {
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates_.size(); ++aggregate_idx) {
+        const auto &destroy_func = aggregates_[aggregate_idx]->destroy_func_;
+        if (!destroy_func) {
+            continue;
+        }
+        for (SizeT group_idx = 0; group_idx < group_count(); ++group_idx) {
+            destroy_func(GroupStates(group_idx) + state_offsets_[aggregate_idx]);
+        }
+    }
+}
+
+UniquePtr<AggregateHashTable> AggregateHashTable::Make(const Vector<SharedPtr<BaseExpression>> &groups,
+                                                       const Vector<SharedPtr<BaseExpression>> &aggregates) {
+    Vector<SharedPtr<DataType>> group_types;
+    group_types.reserve(groups.size());
+    for (const auto &group_expr : groups) {
+        group_types.emplace_back(MakeShared<DataType>(group_expr->Type()));
+    }
+    Vector<const AggregateFunction *> aggregate_functions;
+    aggregate_functions.reserve(aggregates.size());
+    for (const auto &aggregate : aggregates) {
+        aggregate_functions.emplace_back(&static_cast<const AggregateExpression *>(aggregate.get())->aggregate_function_);
+    }
+    return MakeUnique<AggregateHashTable>(std::move(group_types), std::move(aggregate_functions));
+}
+
+void AggregateHashTable::Aggregate(const Vector<SharedPtr<BaseExpression>> &groups,
+                                   const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                   const DataBlock *input_block) {
+    SizeT row_count = input_block->row_count();
+    if (row_count == 0) {
+        return;
+    }
+    ExpressionEvaluator evaluator;
+    evaluator.Init(input_block);
+
+    Vector<SharedPtr<ColumnVector>> group_columns;
+    group_columns.reserve(groups.size());
+    for (const auto &group_expr : groups) {
+        group_columns.emplace_back(EvaluateColumn(evaluator, group_expr));
+    }
+    Vector<ptr_t> row_states;
+    FindOrCreateGroups(group_columns, row_count, row_states);
+
+    // Update the states one aggregate at a time, each with its whole argument column.
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates.size(); ++aggregate_idx) {
+        auto *aggregate_expr = static_cast<AggregateExpression *>(aggregates[aggregate_idx].get());
+        SharedPtr<ColumnVector> argument = EvaluateColumn(evaluator, aggregate_expr->arguments()[0]);
+        Update(aggregate_idx, row_states, row_count, argument);
+    }
+}
+
+void AggregateHashTable::PackKeys(const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row_count) {
+    Vector<SizeT> cursors(row_count);
+    if (key_width_ != 0) {
+        batch_keys_.resize(row_count * key_width_);
+        for (SizeT row = 0; row < row_count; ++row) {
+            cursors[row] = row * key_width_;
+        }
+    } else {
+        batch_offsets_.resize(row_count + 1);
+        batch_offsets_[0] = 0;
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT row_width = 0;
+            for (SizeT column_idx = 0; column_idx < group_columns.size(); ++column_idx) {
+                const ColumnVector &column = *group_columns[column_idx];
+                row_width += 1;
+                if (group_types_[column_idx]->type() != LogicalType::kVarchar) {
+                    row_width += KeyValueWidth(*group_types_[column_idx]);
+                    continue;
+                }
+                row_width += sizeof(u32);
+                SizeT source_row = SourceRow(column, row);
+                if (column.nulls_ptr_->IsTrue(source_row)) {
+                    row_width += reinterpret_cast<const VarcharT *>(column.data())[source_row].length_;
+                }
+            }
+            batch_offsets_[row + 1] = batch_offsets_[row] + row_width;
+        }
+        batch_keys_.resize(batch_offsets_[row_count]);
+        for (SizeT row = 0; row < row_count; ++row) {
+            cursors[row] = batch_offsets_[row];
+        }
+    }
+
+    // Pack a column at a time, and hash each value while it's in cache.
+    batch_hashes_.assign(row_count, 0);
+    for (SizeT column_idx = 0; column_idx < group_columns.size(); ++column_idx) {
+        const ColumnVector &column = *group_columns[column_idx];
+        LogicalType type = group_types_[column_idx]->type();
+        SizeT width = KeyValueWidth(*group_types_[column_idx]);
+        bool all_valid = column.nulls_ptr_->IsAllTrue();
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT source_row = SourceRow(column, row);
+            char *dst = batch_keys_.data() + cursors[row];
+            bool valid = all_valid || column.nulls_ptr_->IsTrue(source_row);
+            dst[0] = valid ? 0 : 1;
+            ++dst;
+            u64 value_hash = NULL_HASH;
+            SizeT value_width = width;
+            switch (type) {
+                case LogicalType::kBoolean: {
+                    dst[0] = valid && column.buffer_->GetCompactBit(source_row) ? 1 : 0;
+                    value_hash = valid ? u64(dst[0]) : NULL_HASH;
+                    break;
+                }
+                case LogicalType::kVarchar: {
+                    u32 length = 0;
+                    if (valid) {
+                        const VarcharT &varchar = reinterpret_cast<const VarcharT *>(column.data())[source_row];
+                        length = varchar.length_;
+                        if (varchar.IsInlined()) {
+                            std::memcpy(dst + sizeof(u32), varchar.short_.data_, length);
+                        } else {
+                            column.buffer_->fix_heap_mgr_->ReadFromHeap(dst + sizeof(u32),
+                                                                        varchar.vector_.chunk_id_,
+                                                                        varchar.vector_.chunk_offset_,
+                                                                        length);
+                        }
+                        value_hash = std::hash<std::string_view>()(std::string_view(dst + sizeof(u32), length));
+                    }
+                    std::memcpy(dst, &length, sizeof(u32));
+                    value_width = sizeof(u32) + length;
+                    break;
+                }
+                case LogicalType::kFloat:
+                case LogicalType::kDouble: {
+                    if (!valid) {
+                        std::memset(dst, 0, width);
+                        break;
+                    }
+                    const_ptr_t src = column.data() + source_row * width;
+                    value_hash = type == LogicalType::kFloat ? PackFloatKey<FloatT>(dst, src) : PackFloatKey<DoubleT>(dst, src);
+                    break;
+                }
+                default: {
+                    if (!valid) {
+                        std::memset(dst, 0, width);
+                        break;
+                    }
+                    std::memcpy(dst, column.data() + source_row * width, width);
+                    if (width <= sizeof(u64)) {
+                        value_hash = 0;
+                        std::memcpy(&value_hash, dst, width);
+                    } else {
+                        value_hash = std::hash<std::string_view>()(std::string_view(dst, width));
+                    }
+                    break;
+                }
+            }
+            batch_hashes_[row] = MixHash(batch_hashes_[row] * 31 + value_hash);
+            cursors[row] += 1 + value_width;
+        }
+    }
+}
+
+void AggregateHashTable::FindOrCreateGroups(const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row_count, Vector<ptr_t> &row_states) {
+    PackKeys(group_columns, row_count);
+    row_states.resize(row_count);
+    for (SizeT row = 0; row < row_count; ++row) {
+        SizeT group_idx = FindOrCreateGroup(batch_hashes_[row], BatchKey(row), group_columns, row);
+        row_states[row] = GroupStates(group_idx);
+    }
+}
+
+SizeT AggregateHashTable::FindOrCreateGroup(u64 hash, std::string_view key, const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row) {
+    // At most half of the slots are taken.
+    if ((group_count() + 1) * 2 > slots_.size()) {
+        Grow();
+    }
+    u64 slot = hash & mask_;
+    for (;; slot = (slot + 1) & mask_) {
+        u32 group_id = slots_[slot];
+        if (group_id == 0) {
+            break;
+        }
+        if (group_hashes_[group_id - 1] == hash && GroupKey(group_id - 1) == key) {
+            return group_id - 1;
+        }
+    }
+
+    SizeT group_idx = group_count();
+    slots_[slot] = group_idx + 1;
+    group_hashes_.push_back(hash);
+    group_keys_.insert(group_keys_.end(), key.begin(), key.end());
+    if (key_width_ == 0) {
+        group_offsets_.push_back(group_keys_.size());
+    }
+
+    SizeT chunk_row = group_idx % DEFAULT_VECTOR_SIZE;
+    if (chunk_row == 0) {
+        state_chunks_.emplace_back(MakeUnique<char[]>(DEFAULT_VECTOR_SIZE * states_size_));
+        Vector<SharedPtr<ColumnVector>> group_chunk;
+        for (const auto &group_type : group_types_) {
+            auto column = MakeShared<ColumnVector>(group_type);
+            column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+            group_chunk.emplace_back(std::move(column));
+        }
+        group_chunks_.emplace_back(std::move(group_chunk));
+    }
+    for (SizeT column_idx = 0; column_idx < group_columns.size(); ++column_idx) {
+        const ColumnVector &src = *group_columns[column_idx];
+        ColumnVector &dst = *group_chunks_.back()[column_idx];
+        dst.Finalize(chunk_row + 1);
+        dst.CopyRow(src, chunk_row, row);
+        if (!src.nulls_ptr_->IsTrue(SourceRow(src, row))) {
+            dst.nulls_ptr_->SetFalse(chunk_row);
+        }
+    }
+    ptr_t states = GroupStates(group_idx);
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates_.size(); ++aggregate_idx) {
+        aggregates_[aggregate_idx]->init_func_(states + state_offsets_[aggregate_idx]);
+    }
+    return group_idx;
+}
+
+void AggregateHashTable::Grow() {
+    SizeT capacity = slots_.empty() ? 1024 : slots_.size() * 2;
+    slots_.assign(capacity, 0);
+    mask_ = capacity - 1;
+    for (SizeT group_idx = 0; group_idx < group_count(); ++group_idx) {
+        u64 slot = group_hashes_[group_idx] & mask_;
+        while (slots_[slot] != 0) {
+            slot = (slot + 1) & mask_;
+        }
+        slots_[slot] = group_idx + 1;
+    }
+}
+
+void AggregateHashTable::Update(SizeT aggregate_idx, const Vector<ptr_t> &row_states, SizeT row_count, const SharedPtr<ColumnVector> &argument) const {
+    aggregates_[aggregate_idx]->scatter_update_func_(row_states.data(), state_offsets_[aggregate_idx], row_count, argument);
+}
+
+void AggregateHashTable::Combine(const AggregateHashTable &other) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (SizeT other_idx = 0; other_idx < other.group_count(); ++other_idx) {
+        CombineGroup(other, other_idx);
+    }
+}
+
+void AggregateHashTable::BuildPartitionIndex() {
+    partition_offsets_.fill(0);
+    for (u64 hash : group_hashes_) {
+        ++partition_offsets_[PartitionOf(hash) + 1];
+    }
+    for (SizeT partition_id = 0; partition_id < PARTITION_COUNT; ++partition_id) {
+        partition_offsets_[partition_id + 1] += partition_offsets_[partition_id];
+    }
+    Array<u32, PARTITION_COUNT> cursors;
+    Copy(partition_offsets_.begin(), partition_offsets_.end() - 1, cursors.begin());
+    partition_groups_.resize(group_count());
+    for (SizeT group_idx = 0; group_idx < group_count(); ++group_idx) {
+        partition_groups_[cursors[PartitionOf(group_hashes_[group_idx])]++] = group_idx;
+    }
+}
+
+void AggregateHashTable::CombinePartitions(const AggregateHashTable &other, SizeT partition_begin, SizeT partition_end) {
+    for (u32 i = other.partition_offsets_[partition_begin]; i < other.partition_offsets_[partition_end]; ++i) {
+        CombineGroup(other, other.partition_groups_[i]);
+    }
+}
+
+void AggregateHashTable::CombineGroup(const AggregateHashTable &other, SizeT other_idx) {
+    SizeT group_idx = FindOrCreateGroup(other.group_hashes_[other_idx],
+                                        other.GroupKey(other_idx),
+                                        other.group_chunks_[other_idx / DEFAULT_VECTOR_SIZE],
+                                        other_idx % DEFAULT_VECTOR_SIZE);
+    ptr_t states = GroupStates(group_idx);
+    const_ptr_t other_states = other.GroupStates(other_idx);
+    for (SizeT aggregate_idx = 0; aggregate_idx < aggregates_.size(); ++aggregate_idx) {
+        SizeT offset = state_offsets_[aggregate_idx];
+        aggregates_[aggregate_idx]->combine_func_(states + offset, other_states + offset);
+    }
+}
+
+void AggregateHashTable::Finalize(Vector<UniquePtr<DataBlock>> &output_blocks) const {
+    for (SizeT chunk_idx = 0; chunk_idx < group_chunks_.size(); ++chunk_idx) {
+        SizeT chunk_begin = chunk_idx * DEFAULT_VECTOR_SIZE;
+        SizeT chunk_size = std::min(group_count() - chunk_begin, SizeT(DEFAULT_VECTOR_SIZE));
+        Vector<SharedPtr<ColumnVector>> columns = group_chunks_[chunk_idx];
+        for (const AggregateFunction *aggregate : aggregates_) {
+            auto column = MakeShared<ColumnVector>(MakeShared<DataType>(aggregate->return_type_));
+            column->Initialize();
+            columns.emplace_back(std::move(column));
+        }
+        for (SizeT aggregate_idx = 0; aggregate_idx < aggregates_.size(); ++aggregate_idx) {
+            ColumnVector &column = *columns[group_types_.size() + aggregate_idx];
+            for (SizeT i = 0; i < chunk_size; ++i) {
+                ptr_t state = GroupStates(chunk_begin + i) + state_offsets_[aggregate_idx];
+                column.AppendByPtr(aggregates_[aggregate_idx]->finalize_func_(state));
+            }
+        }
+        auto output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(columns);
+        output_blocks.emplace_back(std::move(output_block));
+    }
+}
+
+} // namespace infinity
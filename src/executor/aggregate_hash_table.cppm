@@ -0,0 +1,148 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module aggregate_hash_table;
+
+import stl;
+import column_vector;
+import data_block;
+import data_type;
+import aggregate_function;
+import base_expression;
+import default_values;
+
+namespace infinity {
+
+// Hash table of a group-by aggregate. The key of a group is its group-by values packed into a row of fixed width (variable width only if
+// a group-by column is a varchar), and the aggregate states of a group are stored in place, next to each other. A batch of rows is
+// aggregated as:
+//   1. `FindOrCreateGroups` packs and hashes the group-by columns, one column at a time, then looks up the group of each row by linear
+//      probing, creating the missing groups. It returns the states of the group of each row.
+//   2. `Update` updates these states with the argument column of each aggregate, one column at a time.
+// The groups are also partitioned by the high bits of their hash, so that the tables of a parallel aggregate are merged one range of
+// partitions per task.
+export class AggregateHashTable {
+public:
+    static constexpr SizeT PARTITION_BITS = 6;
+    static constexpr SizeT PARTITION_COUNT = 1 << PARTITION_BITS;
+
+    static inline SizeT PartitionOf(u64 hash) { return hash >> (64 - PARTITION_BITS); }
+
+    AggregateHashTable(Vector<SharedPtr<DataType>> group_types, Vector<const AggregateFunction *> aggregates);
+
+    // Destroy the aggregate states that own memory.
+    ~AggregateHashTable();
+
+    static UniquePtr<AggregateHashTable> Make(const Vector<SharedPtr<BaseExpression>> &groups, const Vector<SharedPtr<BaseExpression>> &aggregates);
+
+    // Evaluate the group-by and the argument expressions on the block and aggregate it.
+    void Aggregate(const Vector<SharedPtr<BaseExpression>> &groups, const Vector<SharedPtr<BaseExpression>> &aggregates, const DataBlock *input_block);
+
+    void FindOrCreateGroups(const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row_count, Vector<ptr_t> &row_states);
+
+    void Update(SizeT aggregate_idx, const Vector<ptr_t> &row_states, SizeT row_count, const SharedPtr<ColumnVector> &argument) const;
+
+    // Combine the states of the groups of another table into this one, it can be called by several tasks at the same time.
+    void Combine(const AggregateHashTable &other);
+
+    // Index the groups by partition, once no group will be added.
+    void BuildPartitionIndex();
+
+    // Combine the groups of another table in the partitions [partition_begin, partition_end) into this one, `other` must have been
+    // indexed by `BuildPartitionIndex`.
+    void CombinePartitions(const AggregateHashTable &other, SizeT partition_begin, SizeT partition_end);
+
+    // Output the groups as blocks of the group-by columns followed by the aggregate results.
+    void Finalize(Vector<UniquePtr<DataBlock>> &output_blocks) const;
+
+    inline SizeT group_count() const { return group_hashes_.size(); }
+
+private:
+    void PackKeys(const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row_count);
+
+    inline std::string_view BatchKey(SizeT row) const {
+        if (key_width_ != 0) {
+            return {batch_keys_.data() + row * key_width_, key_width_};
+        }
+        return {batch_keys_.data() + batch_offsets_[row], batch_offsets_[row + 1] - batch_offsets_[row]};
+    }
+
+    inline std::string_view GroupKey(SizeT group_idx) const {
+        if (key_width_ != 0) {
+            return {group_keys_.data() + group_idx * key_width_, key_width_};
+        }
+        return {group_keys_.data() + group_offsets_[group_idx], group_offsets_[group_idx + 1] - group_offsets_[group_idx]};
+    }
+
+    inline ptr_t GroupStates(SizeT group_idx) const {
+        return state_chunks_[group_idx / DEFAULT_VECTOR_SIZE].get() + (group_idx % DEFAULT_VECTOR_SIZE) * states_size_;
+    }
+
+    // Find the group of the key, or create it from row `row` of the group-by columns.
+    SizeT FindOrCreateGroup(u64 hash, std::string_view key, const Vector<SharedPtr<ColumnVector>> &group_columns, SizeT row);
+
+    void CombineGroup(const AggregateHashTable &other, SizeT other_idx);
+
+    void Grow();
+
+    Vector<SharedPtr<DataType>> group_types_{};
+    Vector<const AggregateFunction *> aggregates_{};
+    // Offset of the state of each aggregate in the states of a group.
+    Vector<SizeT> state_offsets_{};
+    SizeT states_size_{};
+    // Width of a key if there is no varchar group-by column, otherwise 0 and the keys are located by the offsets.
+    SizeT key_width_{};
+
+    // The keys of the current batch.
+    Vector<char> batch_keys_{};
+    Vector<SizeT> batch_offsets_{};
+    Vector<u64> batch_hashes_{};
+
+    // Index + 1 of the group in each slot, 0 for an empty slot.
+    Vector<u32> slots_{};
+    u64 mask_{};
+
+    Vector<u64> group_hashes_{};
+    Vector<char> group_keys_{};
+    Vector<SizeT> group_offsets_{};
+    // The states and the group-by values of DEFAULT_VECTOR_SIZE groups each.
+    Vector<UniquePtr<char[]>> state_chunks_{};
+    Vector<Vector<SharedPtr<ColumnVector>>> group_chunks_{};
+
+    // The groups sorted by partition, those of partition i are in [partition_offsets_[i], partition_offsets_[i + 1]).
+    Vector<u32> partition_groups_{};
+    Array<u32, PARTITION_COUNT + 1> partition_offsets_{};
+
+    std::mutex mutex_{};
+};
+
+// The tables of the tasks of a parallel aggregate, handed over to the merge tasks.
+export class PartialAggregateTables {
+public:
+    inline void Add(UniquePtr<AggregateHashTable> table) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tables_.emplace_back(std::move(table));
+    }
+
+    // Only read once all tables have been added.
+    inline const Vector<UniquePtr<AggregateHashTable>> &tables() const { return tables_; }
+
+private:
+    std::mutex mutex_{};
+    Vector<UniquePtr<AggregateHashTable>> tables_{};
+};
+
+} // namespace infinity
@@ -67,12 +67,14 @@ import physical_merge_top;
 import physical_merge_sort;
 import physical_merge_knn;
 import physical_merge_match_tensor;
+import physical_merge_match;
 import physical_match;
 import physical_match_tensor_scan;
 import physical_fusion;
 import physical_merge_aggregate;
 import status;
 import physical_operator_type;
+import join_reference;
 
 import explain_logical_plan;
 import logical_show;
@@ -243,9 +245,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         case PhysicalOperatorType::kParallelAggregate: {
+            Explain((PhysicalParallelAggregate *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeParallelAggregate: {
+            Explain((PhysicalMergeParallelAggregate *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kIntersect: {
@@ -255,9 +259,11 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         case PhysicalOperatorType::kHash: {
+            Explain((PhysicalHash *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeHash: {
+            Explain((PhysicalMergeHash *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeLimit: {
@@ -268,6 +274,7 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             break;
         }
         case PhysicalOperatorType::kMergeSort: {
+            Explain((PhysicalMergeSort *)op, result, intent_size);
             break;
         }
         case PhysicalOperatorType::kMergeKnn: {
@@ -282,6 +289,10 @@ void ExplainPhysicalPlan::Explain(const PhysicalOperator *op, SharedPtr<Vector<S
             Explain((PhysicalMatch *)op, result, intent_size);
             break;
         }
+        case PhysicalOperatorType::kMergeMatch: {
+            Explain((PhysicalMergeMatch *)op, result, intent_size);
+            break;
+        }
         case PhysicalOperatorType::kMatchTensorScan: {
             Explain((PhysicalMatchTensorScan *)op, result, intent_size);
             break;
@@ -819,7 +830,9 @@ void ExplainPhysicalPlan::Explain(const PhysicalKnnScan *knn_scan_node, SharedPt
     // Query embedding
     String query_embedding =
         String(intent_size + 2, ' ') + " - query embedding: " +
-        EmbeddingT::Embedding2String(knn_expr_raw->query_embedding_, knn_expr_raw->embedding_data_type_, knn_expr_raw->dimension_);
+        EmbeddingT::Embedding2String(knn_expr_raw->query_embedding_,
+                                     knn_expr_raw->embedding_data_type_,
+                                     knn_expr_raw->dimension_ * knn_expr_raw->query_count_);
     result->emplace_back(MakeShared<String>(query_embedding));
 
     // filter expression
@@ -1475,6 +1488,24 @@ void ExplainPhysicalPlan::Explain(const PhysicalShow *show_node, SharedPtr<Vecto
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowBuffer: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW BUFFER ";
+            } else {
+                show_str = "SHOW BUFFER ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [type, hit, miss, eviction]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid show type");
         }
@@ -1493,10 +1524,62 @@ void ExplainPhysicalPlan::Explain(const PhysicalDummyScan *, SharedPtr<Vector<Sh
     RecoverableError(status);
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    Status status = Status::NotSupport("Not implemented");
-    LOG_ERROR(status.message());
-    RecoverableError(status);
+void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String join_header;
+    if (intent_size != 0) {
+        join_header = String(intent_size - 2, ' ') + "-> HASH JOIN ";
+    } else {
+        join_header = "HASH JOIN ";
+    }
+
+    join_header += "(" + std::to_string(join_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(join_header));
+
+    // Join type
+    {
+        String join_type_str = String(intent_size, ' ') + " - type: " + JoinReference::ToString(join_node->join_type());
+        result->emplace_back(MakeShared<String>(join_type_str));
+    }
+
+    // Keys
+    {
+        String keys_str = String(intent_size, ' ') + " - keys: [";
+        SizeT key_count = join_node->probe_keys().size();
+        for (SizeT idx = 0; idx < key_count; ++idx) {
+            if (idx != 0) {
+                keys_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(join_node->probe_keys()[idx].get(), keys_str);
+            keys_str += " = ";
+            ExplainLogicalPlan::Explain(join_node->build_keys()[idx].get(), keys_str);
+        }
+        keys_str += "]";
+        result->emplace_back(MakeShared<String>(keys_str));
+    }
+
+    // Conditions
+    SizeT conditions_count = join_node->conditions().size();
+    if (conditions_count != 0) {
+        String condition_str = String(intent_size, ' ') + " - filters: [";
+        for (SizeT idx = 0; idx < conditions_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(join_node->conditions()[idx].get(), condition_str);
+            condition_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(join_node->conditions().back().get(), condition_str);
+        result->emplace_back(MakeShared<String>(condition_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = join_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalSortMergeJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
@@ -1818,6 +1901,45 @@ void ExplainPhysicalPlan::Explain(const PhysicalParallelAggregate *parallel_aggr
     }
     explain_header_str += "(" + std::to_string(parallel_aggregate_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Aggregate Table index
+    {
+        String aggregate_table_index =
+            String(intent_size, ' ') + " - aggregate table index: #" + std::to_string(parallel_aggregate_node->AggregateTableIndex());
+        result->emplace_back(MakeShared<String>(aggregate_table_index));
+    }
+
+    // Aggregate expressions
+    {
+        SizeT aggregates_count = parallel_aggregate_node->aggregates_.size();
+        String aggregate_expression_str = String(intent_size, ' ') + " - aggregate: [";
+        if (aggregates_count != 0) {
+            for (SizeT idx = 0; idx < aggregates_count - 1; ++idx) {
+                ExplainLogicalPlan::Explain(parallel_aggregate_node->aggregates_[idx].get(), aggregate_expression_str);
+                aggregate_expression_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->aggregates_.back().get(), aggregate_expression_str);
+        }
+        aggregate_expression_str += "]";
+        result->emplace_back(MakeShared<String>(aggregate_expression_str));
+    }
+
+    // Group by expressions, a parallel aggregate always has some
+    {
+        SizeT groups_count = parallel_aggregate_node->groups_.size();
+        String group_table_index =
+            String(intent_size, ' ') + " - group by table index: #" + std::to_string(parallel_aggregate_node->GroupTableIndex());
+        result->emplace_back(MakeShared<String>(group_table_index));
+
+        String group_by_expression_str = String(intent_size, ' ') + " - group by: [";
+        for (SizeT idx = 0; idx < groups_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->groups_[idx].get(), group_by_expression_str);
+            group_by_expression_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(parallel_aggregate_node->groups_.back().get(), group_by_expression_str);
+        group_by_expression_str += "]";
+        result->emplace_back(MakeShared<String>(group_by_expression_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeParallelAggregate *merge_parallel_aggregate_node,
@@ -1871,6 +1993,20 @@ void ExplainPhysicalPlan::Explain(const PhysicalHash *hash_node, SharedPtr<Vecto
     }
     explain_header_str += "(" + std::to_string(hash_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Keys
+    {
+        String keys_str = String(intent_size, ' ') + " - keys: [";
+        SizeT key_count = hash_node->hash_keys().size();
+        for (SizeT idx = 0; idx < key_count; ++idx) {
+            if (idx != 0) {
+                keys_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(hash_node->hash_keys()[idx].get(), keys_str);
+        }
+        keys_str += "]";
+        result->emplace_back(MakeShared<String>(keys_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeHash *merge_hash_node,
@@ -1970,6 +2106,18 @@ void ExplainPhysicalPlan::Explain(const PhysicalMergeSort *merge_sort_node,
     }
     explain_header_str += "(" + std::to_string(merge_sort_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = merge_sort_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeKnn *merge_knn_node,
@@ -2067,6 +2215,51 @@ void ExplainPhysicalPlan::Explain(const PhysicalMatch *match_node, SharedPtr<Vec
     }
 }
 
+void ExplainPhysicalPlan::Explain(const PhysicalMergeMatch *merge_match_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String explain_header_str;
+    if (intent_size != 0) {
+        explain_header_str = String(intent_size - 2, ' ') + "-> MERGE MATCH ";
+    } else {
+        explain_header_str = "MERGE MATCH ";
+    }
+    explain_header_str += "(" + std::to_string(merge_match_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Table alias and name
+    String table_name = String(intent_size, ' ') + " - table name: " + merge_match_node->TableAlias() + "(";
+
+    table_name += *merge_match_node->table_collection_ptr()->GetDBName() + ".";
+    table_name += *merge_match_node->table_collection_ptr()->GetTableName() + ")";
+    result->emplace_back(MakeShared<String>(table_name));
+
+    // Table index
+    String table_index = String(intent_size, ' ') + " - table index: #" + std::to_string(merge_match_node->table_index());
+    result->emplace_back(MakeShared<String>(table_index));
+
+    String match_expression = String(intent_size, ' ') + " - match expression: " + merge_match_node->match_expr()->ToString();
+    result->emplace_back(MakeShared<String>(std::move(match_expression)));
+
+    String top_n_expression = String(intent_size, ' ') + " - Top N: " + std::to_string(merge_match_node->GetTopN());
+    result->emplace_back(MakeShared<String>(std::move(top_n_expression)));
+
+    // Output columns
+    String output_columns = String(intent_size, ' ') + " - output columns: [";
+    SizeT column_count = merge_match_node->GetOutputNames()->size();
+    if (column_count == 0) {
+        UnrecoverableError("No column in PhysicalMergeMatch node.");
+    }
+    for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+        output_columns += merge_match_node->GetOutputNames()->at(idx) + ", ";
+    }
+    output_columns += merge_match_node->GetOutputNames()->back();
+    output_columns += "]";
+    result->emplace_back(MakeShared<String>(output_columns));
+
+    if (merge_match_node->left() == nullptr) {
+        UnrecoverableError("PhysicalMergeMatch should have child node!");
+    }
+}
+
 void ExplainPhysicalPlan::Explain(const PhysicalMatchTensorScan *match_tensor_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
     String explain_header_str;
     if (intent_size != 0) {
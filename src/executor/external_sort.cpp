@@ -0,0 +1,553 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module external_sort;
+
+import stl;
+import column_vector;
+import data_block;
+import data_type;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import expression_type;
+import logical_type;
+import internal_types;
+import select_statement;
+import vector_buffer;
+import fix_heap;
+import buffer_manager;
+import buffer_obj;
+import buffer_handle;
+import raw_file_worker;
+import random;
+import serialize;
+import default_values;
+import infinity_exception;
+import status;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+inline SizeT SourceRow(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+// Width of a normalized value of a fixed width type.
+SizeT ValueWidth(LogicalType type) {
+    switch (type) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt: {
+            return 1;
+        }
+        case LogicalType::kSmallInt: {
+            return 2;
+        }
+        case LogicalType::kInteger:
+        case LogicalType::kFloat:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            return 4;
+        }
+        case LogicalType::kBigInt:
+        case LogicalType::kDouble:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kRowID: {
+            return 8;
+        }
+        case LogicalType::kHugeInt: {
+            return 16;
+        }
+        default: {
+            UnrecoverableError("Invalid sort key type.");
+            return 0;
+        }
+    }
+}
+
+template <typename U>
+inline void PutBigEndian(char *dst, U value) {
+    for (SizeT i = 0; i < sizeof(U); ++i) {
+        dst[i] = static_cast<char>(value >> ((sizeof(U) - 1 - i) * 8));
+    }
+}
+
+template <typename T, typename U>
+inline void PutSigned(char *dst, const char *src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    PutBigEndian<U>(dst, static_cast<U>(value) ^ (U(1) << (sizeof(U) * 8 - 1)));
+}
+
+template <typename T, typename U>
+inline void PutFloat(char *dst, const char *src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    if (value == 0) {
+        // -0 equals 0
+        value = 0;
+    }
+    U bits = std::bit_cast<U>(value);
+    constexpr U sign_bit = U(1) << (sizeof(U) * 8 - 1);
+    PutBigEndian<U>(dst, (bits & sign_bit) ? ~bits : bits | sign_bit);
+}
+
+// Normalize the value at `src_row` of a fixed width column.
+void PutValue(ColumnVector &column, SizeT src_row, char *dst) {
+    const char *src = reinterpret_cast<const char *>(column.data()) + src_row * column.data_type_size_;
+    switch (column.data_type()->type()) {
+        case LogicalType::kBoolean: {
+            dst[0] = column.buffer_->GetCompactBit(src_row) ? 1 : 0;
+            break;
+        }
+        case LogicalType::kTinyInt: {
+            PutSigned<i8, u8>(dst, src);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            PutSigned<i16, u16>(dst, src);
+            break;
+        }
+        case LogicalType::kInteger:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            PutSigned<i32, u32>(dst, src);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            PutSigned<i64, u64>(dst, src);
+            break;
+        }
+        case LogicalType::kHugeInt: {
+            // upper then lower
+            PutSigned<i64, u64>(dst, src);
+            PutSigned<i64, u64>(dst + sizeof(i64), src + sizeof(i64));
+            break;
+        }
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp: {
+            // date then time
+            PutSigned<i32, u32>(dst, src);
+            PutSigned<i32, u32>(dst + sizeof(i32), src + sizeof(i32));
+            break;
+        }
+        case LogicalType::kFloat: {
+            PutFloat<f32, u32>(dst, src);
+            break;
+        }
+        case LogicalType::kDouble: {
+            PutFloat<f64, u64>(dst, src);
+            break;
+        }
+        case LogicalType::kRowID: {
+            u64 value;
+            std::memcpy(&value, src, sizeof(u64));
+            PutBigEndian<u64>(dst, value);
+            break;
+        }
+        default: {
+            UnrecoverableError(fmt::format("Invalid sort key type: {}", column.data_type()->ToString()));
+        }
+    }
+}
+
+// Read the varchars of a column into one buffer, a null is read as empty.
+void ReadVarchars(ColumnVector &column, SizeT row_count, Vector<char> &bytes, Vector<u32> &offsets) {
+    const auto *varchars = reinterpret_cast<const VarcharT *>(column.data());
+    offsets.resize(row_count + 1);
+    offsets[0] = 0;
+    for (SizeT row = 0; row < row_count; ++row) {
+        SizeT src_row = SourceRow(column, row);
+        u32 length = column.nulls_ptr_->IsTrue(src_row) ? varchars[src_row].length_ : 0;
+        offsets[row + 1] = offsets[row] + length;
+    }
+    bytes.resize(offsets[row_count]);
+    for (SizeT row = 0; row < row_count; ++row) {
+        u32 length = offsets[row + 1] - offsets[row];
+        if (length == 0) {
+            continue;
+        }
+        const VarcharT &varchar = varchars[SourceRow(column, row)];
+        if (varchar.IsInlined()) {
+            std::memcpy(bytes.data() + offsets[row], varchar.short_.data_, length);
+        } else {
+            column.buffer_->fix_heap_mgr_->ReadFromHeap(bytes.data() + offsets[row], varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, length);
+        }
+    }
+}
+
+// Memory taken by the values of a block, without the heap of its varchars.
+SizeT BlockValueSize(const DataBlock *block) {
+    SizeT row_width = 0;
+    for (const auto &column : block->column_vectors) {
+        row_width += column->data_type_size_;
+    }
+    return row_width * block->row_count();
+}
+
+// The row of a buffered block, in the order of input.
+struct BufferedRow {
+    u32 block_idx_{};
+    u32 row_idx_{};
+};
+
+} // namespace
+
+bool IsSortKeyType(LogicalType type) {
+    switch (type) {
+        case LogicalType::kBoolean:
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kRowID:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void SortKeys::Build(const Vector<SharedPtr<BaseExpression>> &exprs,
+                     Vector<SharedPtr<ExpressionState>> &expr_states,
+                     const Vector<OrderType> &order_types,
+                     const DataBlock *block) {
+    ExpressionEvaluator evaluator;
+    evaluator.Init(block);
+    Vector<SharedPtr<ColumnVector>> key_columns;
+    key_columns.reserve(exprs.size());
+    for (SizeT i = 0; i < exprs.size(); ++i) {
+        const SharedPtr<BaseExpression> &expr = exprs[i];
+        SharedPtr<ColumnVector> key_column;
+        if (expr->type() != ExpressionType::kReference) {
+            key_column = MakeShared<ColumnVector>(MakeShared<DataType>(expr->Type()));
+            key_column->Initialize();
+        }
+        evaluator.Execute(expr, expr_states[i], key_column);
+        key_columns.emplace_back(std::move(key_column));
+    }
+    Build(key_columns, order_types, block->row_count());
+}
+
+void SortKeys::Build(const Vector<SharedPtr<ColumnVector>> &key_columns, const Vector<OrderType> &order_types, SizeT row_count) {
+    SizeT column_count = key_columns.size();
+    // Lay out the rows first, the varchars are read once here.
+    Vector<Vector<char>> varchar_bytes(column_count);
+    Vector<Vector<u32>> varchar_offsets(column_count);
+    offsets_.assign(row_count + 1, 0);
+    for (SizeT i = 0; i < column_count; ++i) {
+        ColumnVector &column = *key_columns[i];
+        if (column.data_type()->type() != LogicalType::kVarchar) {
+            // A null takes the width of a value too, with zeros.
+            SizeT width = 1 + ValueWidth(column.data_type()->type());
+            for (SizeT row = 0; row < row_count; ++row) {
+                offsets_[row + 1] += width;
+            }
+            continue;
+        }
+        ReadVarchars(column, row_count, varchar_bytes[i], varchar_offsets[i]);
+        const Vector<char> &bytes = varchar_bytes[i];
+        const Vector<u32> &offsets = varchar_offsets[i];
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT width = 1;
+            if (column.nulls_ptr_->IsTrue(SourceRow(column, row))) {
+                width += offsets[row + 1] - offsets[row] + 2;
+                for (u32 j = offsets[row]; j < offsets[row + 1]; ++j) {
+                    width += bytes[j] == 0;
+                }
+            }
+            offsets_[row + 1] += width;
+        }
+    }
+    for (SizeT row = 0; row < row_count; ++row) {
+        offsets_[row + 1] += offsets_[row];
+    }
+    data_.assign(offsets_[row_count], 0);
+
+    Vector<u32> cursors(offsets_.begin(), offsets_.end() - 1);
+    for (SizeT i = 0; i < column_count; ++i) {
+        ColumnVector &column = *key_columns[i];
+        bool is_varchar = column.data_type()->type() == LogicalType::kVarchar;
+        SizeT value_width = is_varchar ? 0 : ValueWidth(column.data_type()->type());
+        bool desc = order_types[i] == OrderType::kDesc;
+        for (SizeT row = 0; row < row_count; ++row) {
+            SizeT src_row = SourceRow(column, row);
+            char *begin = data_.data() + cursors[row];
+            char *dst = begin;
+            bool not_null = column.nulls_ptr_->IsTrue(src_row);
+            *dst++ = not_null ? 1 : 0;
+            if (!is_varchar) {
+                if (not_null) {
+                    PutValue(column, src_row, dst);
+                }
+                dst += value_width;
+            } else if (not_null) {
+                const Vector<char> &bytes = varchar_bytes[i];
+                for (u32 j = varchar_offsets[i][row]; j < varchar_offsets[i][row + 1]; ++j) {
+                    *dst++ = bytes[j];
+                    if (bytes[j] == 0) {
+                        *dst++ = 1;
+                    }
+                }
+                *dst++ = 0;
+                *dst++ = 0;
+            }
+            if (desc) {
+                for (char *p = begin; p < dst; ++p) {
+                    *p = ~*p;
+                }
+            }
+            cursors[row] += dst - begin;
+        }
+    }
+}
+
+SizeT SortKeys::GetSizeInBytes() const { return sizeof(u32) + offsets_.size() * sizeof(u32) + data_.size(); }
+
+void SortKeys::WriteAdv(char *&ptr) const {
+    WriteBufAdv<u32>(ptr, row_count());
+    std::memcpy(ptr, offsets_.data(), offsets_.size() * sizeof(u32));
+    ptr += offsets_.size() * sizeof(u32);
+    std::memcpy(ptr, data_.data(), data_.size());
+    ptr += data_.size();
+}
+
+SharedPtr<SortKeys> SortKeys::ReadAdv(char *&ptr) {
+    auto keys = MakeShared<SortKeys>();
+    u32 row_count = ReadBufAdv<u32>(ptr);
+    keys->offsets_.resize(row_count + 1);
+    std::memcpy(keys->offsets_.data(), ptr, keys->offsets_.size() * sizeof(u32));
+    ptr += keys->offsets_.size() * sizeof(u32);
+    keys->data_.resize(keys->offsets_[row_count]);
+    std::memcpy(keys->data_.data(), ptr, keys->data_.size());
+    ptr += keys->data_.size();
+    return keys;
+}
+
+SortRun::SortRun(BufferManager *buffer_mgr) : buffer_mgr_(buffer_mgr) {
+    if (buffer_mgr_ != nullptr) {
+        file_dir_ = MakeShared<String>(fmt::format("{}/sort", *buffer_mgr_->GetDataDir()));
+        file_prefix_ = RandomString(DEFAULT_RANDOM_NAME_LEN);
+    }
+}
+
+SortRun::~SortRun() {
+    for (auto *buffer_obj : buffer_objs_) {
+        buffer_obj->PickForCleanup();
+    }
+    if (memory_budget_.get() != nullptr) {
+        memory_budget_->Release(budget_size_);
+    }
+}
+
+void SortRun::Append(UniquePtr<DataBlock> block, SharedPtr<SortKeys> keys) {
+    ++block_count_;
+    if (buffer_mgr_ == nullptr) {
+        blocks_.push_back(SortRunBlock{std::move(block), std::move(keys)});
+        return;
+    }
+    i32 block_size = block->GetSizeInBytes();
+    SizeT buffer_size = keys->GetSizeInBytes() + sizeof(i32) + block_size;
+    auto file_worker = MakeUnique<RawFileWorker>(file_dir_,
+                                                 MakeShared<String>(fmt::format("{}_{}", file_prefix_, buffer_objs_.size())),
+                                                 static_cast<u32>(buffer_size));
+    BufferObj *buffer_obj = buffer_mgr_->AllocateBufferObject(std::move(file_worker));
+    {
+        BufferHandle handle = buffer_obj->Load();
+        char *ptr = static_cast<char *>(handle.GetDataMut());
+        keys->WriteAdv(ptr);
+        WriteBufAdv<i32>(ptr, block_size);
+        block->WriteAdv(ptr);
+    }
+    // Unloaded, it's written to the temp dir once the buffer manager needs the memory.
+    buffer_objs_.push_back(buffer_obj);
+}
+
+SortRunBlock SortRun::Load(SizeT block_idx) const {
+    if (buffer_mgr_ == nullptr) {
+        return blocks_[block_idx];
+    }
+    BufferHandle handle = buffer_objs_[block_idx]->Load();
+    char *ptr = static_cast<char *>(const_cast<void *>(handle.GetData()));
+    SortRunBlock run_block;
+    run_block.keys_ = SortKeys::ReadAdv(ptr);
+    i32 block_size = ReadBufAdv<i32>(ptr);
+    run_block.block_ = DataBlock::ReadAdv(ptr, block_size);
+    return run_block;
+}
+
+SortRunBuilder::SortRunBuilder(Vector<SharedPtr<BaseExpression>> exprs,
+                               Vector<OrderType> order_types,
+                               BufferManager *buffer_mgr,
+                               SharedPtr<SortMemoryBudget> memory_budget)
+    : exprs_(std::move(exprs)), order_types_(std::move(order_types)), buffer_mgr_(buffer_mgr), memory_budget_(std::move(memory_budget)) {}
+
+SortRunBuilder::~SortRunBuilder() { memory_budget_->Release(buffered_size_); }
+
+void SortRunBuilder::Add(UniquePtr<DataBlock> block, Vector<SharedPtr<ExpressionState>> &expr_states) {
+    if (block->row_count() == 0) {
+        return;
+    }
+    SortKeys keys;
+    keys.Build(exprs_, expr_states, order_types_, block.get());
+    SizeT size = keys.size() + BlockValueSize(block.get());
+    buffered_size_ += size;
+    blocks_.emplace_back(std::move(block));
+    keys_.emplace_back(std::move(keys));
+    if (memory_budget_->Reserve(size)) {
+        SortBuffered(buffer_mgr_);
+    }
+}
+
+Vector<SharedPtr<SortRun>> SortRunBuilder::Finish() {
+    if (!blocks_.empty()) {
+        SortBuffered(nullptr);
+    }
+    return std::move(runs_);
+}
+
+void SortRunBuilder::SortBuffered(BufferManager *buffer_mgr) {
+    Vector<BufferedRow> rows;
+    for (SizeT block_idx = 0; block_idx < blocks_.size(); ++block_idx) {
+        for (SizeT row_idx = 0; row_idx < blocks_[block_idx]->row_count(); ++row_idx) {
+            rows.push_back(BufferedRow{static_cast<u32>(block_idx), static_cast<u32>(row_idx)});
+        }
+    }
+    // Rows with equal keys keep their order of input.
+    std::sort(rows.begin(), rows.end(), [&](const BufferedRow &a, const BufferedRow &b) {
+        int cmp = keys_[a.block_idx_].Key(a.row_idx_).compare(keys_[b.block_idx_].Key(b.row_idx_));
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+        return a.block_idx_ != b.block_idx_ ? a.block_idx_ < b.block_idx_ : a.row_idx_ < b.row_idx_;
+    });
+
+    auto run = MakeShared<SortRun>(buffer_mgr);
+    Vector<SharedPtr<DataType>> types = blocks_[0]->types();
+    for (SizeT begin = 0; begin < rows.size(); begin += DEFAULT_BLOCK_CAPACITY) {
+        SizeT end = std::min(rows.size(), begin + static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY));
+        auto output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(types, DEFAULT_BLOCK_CAPACITY);
+        auto output_keys = MakeShared<SortKeys>();
+        for (SizeT i = begin; i < end; ++i) {
+            const BufferedRow &row = rows[i];
+            output_block->AppendWith(blocks_[row.block_idx_].get(), row.row_idx_, 1);
+            output_keys->Append(keys_[row.block_idx_].Key(row.row_idx_));
+        }
+        output_block->Finalize();
+        run->Append(std::move(output_block), std::move(output_keys));
+    }
+    if (buffer_mgr == nullptr) {
+        run->HoldBudget(memory_budget_, buffered_size_);
+    } else {
+        memory_budget_->Release(buffered_size_);
+    }
+    runs_.emplace_back(std::move(run));
+
+    blocks_.clear();
+    keys_.clear();
+    buffered_size_ = 0;
+}
+
+SortRunMerger::SortRunMerger(Vector<SharedPtr<SortRun>> runs) {
+    for (auto &run : runs) {
+        if (run->block_count() == 0) {
+            continue;
+        }
+        Cursor cursor;
+        cursor.current_ = run->Load(0);
+        cursor.run_ = std::move(run);
+        if (types_.empty()) {
+            types_ = cursor.current_.block_->types();
+        }
+        heap_.push_back(cursors_.size());
+        cursors_.emplace_back(std::move(cursor));
+    }
+    std::make_heap(heap_.begin(), heap_.end(), [this](u32 a, u32 b) { return HeapLess(a, b); });
+}
+
+bool SortRunMerger::HeapLess(u32 a, u32 b) const {
+    const Cursor &cursor_a = cursors_[a];
+    const Cursor &cursor_b = cursors_[b];
+    int cmp = cursor_a.current_.keys_->Key(cursor_a.row_idx_).compare(cursor_b.current_.keys_->Key(cursor_b.row_idx_));
+    return cmp != 0 ? cmp > 0 : a > b;
+}
+
+bool SortRunMerger::Advance(Cursor &cursor, SizeT row_count) {
+    cursor.row_idx_ += row_count;
+    if (cursor.row_idx_ < cursor.current_.block_->row_count()) {
+        return true;
+    }
+    // Release the block before the next one is loaded.
+    cursor.current_ = SortRunBlock();
+    cursor.row_idx_ = 0;
+    if (++cursor.block_idx_ == cursor.run_->block_count()) {
+        cursor.run_.reset();
+        return false;
+    }
+    cursor.current_ = cursor.run_->Load(cursor.block_idx_);
+    return true;
+}
+
+UniquePtr<DataBlock> SortRunMerger::Next() {
+    if (heap_.empty()) {
+        return nullptr;
+    }
+    auto heap_less = [this](u32 a, u32 b) { return HeapLess(a, b); };
+    auto output_block = DataBlock::MakeUniquePtr();
+    output_block->Init(types_, DEFAULT_BLOCK_CAPACITY);
+    while (!heap_.empty() && output_block->available_capacity() > 0) {
+        if (heap_.size() == 1) {
+            // The last run is copied as is.
+            Cursor &cursor = cursors_[heap_[0]];
+            SizeT row_count = std::min(output_block->available_capacity(), cursor.current_.block_->row_count() - cursor.row_idx_);
+            output_block->AppendWith(cursor.current_.block_.get(), cursor.row_idx_, row_count);
+            if (!Advance(cursor, row_count)) {
+                heap_.clear();
+            }
+            continue;
+        }
+        std::pop_heap(heap_.begin(), heap_.end(), heap_less);
+        Cursor &cursor = cursors_[heap_.back()];
+        output_block->AppendWith(cursor.current_.block_.get(), cursor.row_idx_, 1);
+        if (Advance(cursor, 1)) {
+            std::push_heap(heap_.begin(), heap_.end(), heap_less);
+        } else {
+            heap_.pop_back();
+        }
+    }
+    output_block->Finalize();
+    return output_block;
+}
+
+bool MergeSortRuns(SortRunMerger &merger, Vector<UniquePtr<DataBlock>> &output_blocks, SizeT max_block_count) {
+    for (SizeT i = 0; i < max_block_count && !merger.Done(); ++i) {
+        output_blocks.emplace_back(merger.Next());
+    }
+    return merger.Done();
+}
+
+} // namespace infinity
@@ -0,0 +1,218 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module external_sort;
+
+import stl;
+import column_vector;
+import data_block;
+import data_type;
+import base_expression;
+import expression_state;
+import logical_type;
+import select_statement;
+import buffer_manager;
+import buffer_obj;
+
+namespace infinity {
+
+// Whether the values of the type can be normalized into a sort key.
+export bool IsSortKeyType(LogicalType type);
+
+// The sort keys of a batch of rows. The order-by columns of a row are normalized into one binary key, so that the order of the rows is
+// the order of their keys by memcmp:
+//   - each column starts with a flag byte, 0 for null and 1 otherwise, a null is smaller than any value,
+//   - a number is stored big-endian with its sign bit flipped, a negative float with all its bits flipped,
+//   - a varchar is stored with each 0x00 byte escaped as 0x00 0x01, and terminated by 0x00 0x00,
+//   - all bytes of a descending column are flipped.
+export class SortKeys {
+public:
+    // Evaluate the order-by expressions on the block and normalize the results.
+    void Build(const Vector<SharedPtr<BaseExpression>> &exprs,
+               Vector<SharedPtr<ExpressionState>> &expr_states,
+               const Vector<OrderType> &order_types,
+               const DataBlock *block);
+
+    void Build(const Vector<SharedPtr<ColumnVector>> &key_columns, const Vector<OrderType> &order_types, SizeT row_count);
+
+    inline void Append(std::string_view key) {
+        data_.insert(data_.end(), key.begin(), key.end());
+        offsets_.push_back(data_.size());
+    }
+
+    inline std::string_view Key(SizeT row) const { return {data_.data() + offsets_[row], offsets_[row + 1] - offsets_[row]}; }
+
+    inline SizeT row_count() const { return offsets_.size() - 1; }
+
+    // Bytes of the keys.
+    inline SizeT size() const { return data_.size(); }
+
+    SizeT GetSizeInBytes() const;
+
+    void WriteAdv(char *&ptr) const;
+
+    static SharedPtr<SortKeys> ReadAdv(char *&ptr);
+
+private:
+    Vector<char> data_{};
+    Vector<u32> offsets_ = Vector<u32>(1, 0);
+};
+
+// A block of a sorted run with the keys of its rows.
+export struct SortRunBlock {
+    SharedPtr<DataBlock> block_{};
+    SharedPtr<SortKeys> keys_{};
+};
+
+// The memory budget of the rows buffered by a sort, shared by all tasks of the sort, so that the budget holds for the query however many
+// tasks sort in parallel.
+export class SortMemoryBudget {
+public:
+    explicit SortMemoryBudget(SizeT budget) : budget_(budget) {}
+
+    // Add the size to the buffered rows, return whether they are over the budget now.
+    inline bool Reserve(SizeT size) { return used_.fetch_add(size) + size > budget_; }
+
+    inline void Release(SizeT size) { used_.fetch_sub(size); }
+
+private:
+    const SizeT budget_{};
+    Atomic<SizeT> used_{0};
+};
+
+// A sorted run. The blocks of a run that is kept in memory are held as is. The blocks of a spilled run are written into buffer objects,
+// which the buffer manager writes to the temp dir once the memory is short, and reads back when they are loaded.
+export class SortRun {
+public:
+    // `buffer_mgr` is nullptr for a run kept in memory.
+    explicit SortRun(BufferManager *buffer_mgr);
+
+    ~SortRun();
+
+    // The rows of the block must follow the rows of the previous blocks.
+    void Append(UniquePtr<DataBlock> block, SharedPtr<SortKeys> keys);
+
+    SortRunBlock Load(SizeT block_idx) const;
+
+    inline SizeT block_count() const { return block_count_; }
+
+    // A run kept in memory holds its part of the budget until it is merged.
+    inline void HoldBudget(SharedPtr<SortMemoryBudget> memory_budget, SizeT size) {
+        memory_budget_ = std::move(memory_budget);
+        budget_size_ = size;
+    }
+
+private:
+    BufferManager *buffer_mgr_{};
+    SharedPtr<SortMemoryBudget> memory_budget_{};
+    SizeT budget_size_{};
+    SharedPtr<String> file_dir_{};
+    String file_prefix_{};
+    SizeT block_count_{};
+
+    Vector<SortRunBlock> blocks_{};
+    Vector<BufferObj *> buffer_objs_{};
+};
+
+// Cuts the input of a sort task into sorted runs. The input blocks are buffered with their keys, and sorted into a run once the rows
+// buffered by all tasks of the sort take more than the memory budget, this run is spilled. What is buffered at the end is sorted into a
+// last run kept in memory.
+export class SortRunBuilder {
+public:
+    SortRunBuilder(Vector<SharedPtr<BaseExpression>> exprs,
+                   Vector<OrderType> order_types,
+                   BufferManager *buffer_mgr,
+                   SharedPtr<SortMemoryBudget> memory_budget);
+
+    ~SortRunBuilder();
+
+    void Add(UniquePtr<DataBlock> block, Vector<SharedPtr<ExpressionState>> &expr_states);
+
+    Vector<SharedPtr<SortRun>> Finish();
+
+private:
+    void SortBuffered(BufferManager *buffer_mgr);
+
+    Vector<SharedPtr<BaseExpression>> exprs_{};
+    Vector<OrderType> order_types_{};
+    BufferManager *buffer_mgr_{};
+    SharedPtr<SortMemoryBudget> memory_budget_{};
+
+    Vector<UniquePtr<DataBlock>> blocks_{};
+    Vector<SortKeys> keys_{};
+    SizeT buffered_size_{};
+
+    Vector<SharedPtr<SortRun>> runs_{};
+};
+
+// Streaming k-way merge of sorted runs, only the current block of each run is loaded. Rows with equal keys come in the order of their
+// runs, then in their order in the run.
+export class SortRunMerger {
+public:
+    explicit SortRunMerger(Vector<SharedPtr<SortRun>> runs);
+
+    // The next block of at most DEFAULT_BLOCK_CAPACITY rows, nullptr once all runs are merged.
+    UniquePtr<DataBlock> Next();
+
+    inline bool Done() const { return heap_.empty(); }
+
+private:
+    struct Cursor {
+        SharedPtr<SortRun> run_{};
+        SizeT block_idx_{};
+        SortRunBlock current_{};
+        SizeT row_idx_{};
+    };
+
+    // Move the cursor forward, return false once its run is exhausted.
+    bool Advance(Cursor &cursor, SizeT row_count);
+
+    // Whether the row of cursor `a` comes after the row of cursor `b`.
+    bool HeapLess(u32 a, u32 b) const;
+
+    Vector<Cursor> cursors_{};
+    // Heap of the cursors by `HeapLess`, the top is the cursor of the smallest row.
+    Vector<u32> heap_{};
+    Vector<SharedPtr<DataType>> types_{};
+};
+
+// Add at most `max_block_count` merged blocks to the output, return true once all runs are merged.
+export bool MergeSortRuns(SortRunMerger &merger, Vector<UniquePtr<DataBlock>> &output_blocks, SizeT max_block_count);
+
+// The runs of the tasks of a parallel sort, handed over to the merge sort.
+export class SortRuns {
+public:
+    inline void Add(Vector<SharedPtr<SortRun>> runs) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &run : runs) {
+            runs_.emplace_back(std::move(run));
+        }
+    }
+
+    // Taken once all runs have been added.
+    inline Vector<SharedPtr<SortRun>> Take() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Vector<SharedPtr<SortRun>> runs;
+        runs.swap(runs_);
+        return runs;
+    }
+
+private:
+    std::mutex mutex_{};
+    Vector<SharedPtr<SortRun>> runs_{};
+};
+
+} // namespace infinity
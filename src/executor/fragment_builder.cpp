@@ -26,6 +26,7 @@ import physical_sink;
 import physical_source;
 import physical_explain;
 import physical_knn_scan;
+import physical_sort;
 import status;
 import infinity_exception;
 
@@ -126,8 +127,7 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
         case PhysicalOperatorType::kOptimize:
         case PhysicalOperatorType::kInsert:
         case PhysicalOperatorType::kImport:
-        case PhysicalOperatorType::kExport:
-        case PhysicalOperatorType::kMatch: {
+        case PhysicalOperatorType::kExport: {
             current_fragment_ptr->AddOperator(phys_op);
             if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
                 UnrecoverableError(fmt::format("{} shouldn't have child.", phys_op->GetName()));
@@ -146,9 +146,7 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             }
             return;
         }
-        case PhysicalOperatorType::kParallelAggregate:
         case PhysicalOperatorType::kFilter:
-        case PhysicalOperatorType::kHash:
         case PhysicalOperatorType::kLimit: {
             if (phys_op->left() == nullptr) {
                 UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
@@ -158,6 +156,19 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             BuildFragments(phys_op->left(), current_fragment_ptr);
             break;
         }
+        case PhysicalOperatorType::kParallelAggregate:
+        case PhysicalOperatorType::kHash: {
+            if (phys_op->left() == nullptr) {
+                UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            BuildFragments(phys_op->left(), current_fragment_ptr);
+            // A stream fragment starts its parent early, the merge fragment mustn't start before all tasks of this one are done.
+            if (current_fragment_ptr->GetFragmentType() == FragmentType::kParallelStream) {
+                current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            }
+            break;
+        }
         case PhysicalOperatorType::kTop: {
             if (phys_op->left() == nullptr) {
                 UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
@@ -167,9 +178,23 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
             break;
         }
-        case PhysicalOperatorType::kUpdate:
-        case PhysicalOperatorType::kDelete:
         case PhysicalOperatorType::kSort: {
+            if (phys_op->left() == nullptr) {
+                UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            BuildFragments(phys_op->left(), current_fragment_ptr);
+            if (static_cast<PhysicalSort *>(phys_op)->sort_runs().get() == nullptr) {
+                // A single task sorts all rows.
+                current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+            } else if (current_fragment_ptr->GetFragmentType() == FragmentType::kParallelStream) {
+                // Each task sorts its rows into runs, the merge sort mustn't start before all tasks of this one are done.
+                current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            }
+            break;
+        }
+        case PhysicalOperatorType::kUpdate:
+        case PhysicalOperatorType::kDelete: {
             if (phys_op->left() == nullptr) {
                 UnrecoverableError(fmt::format("No input node of {}", phys_op->GetName()));
             }
@@ -180,11 +205,10 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
         }
         case PhysicalOperatorType::kFusion:
         case PhysicalOperatorType::kMergeAggregate:
-        case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
         case PhysicalOperatorType::kMergeTop:
-        case PhysicalOperatorType::kMergeSort:
         case PhysicalOperatorType::kMergeMatchTensor:
+        case PhysicalOperatorType::kMergeMatch:
         case PhysicalOperatorType::kMergeKnn: {
             current_fragment_ptr->AddOperator(phys_op);
             current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
@@ -211,17 +235,70 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             }
             return;
         }
+        case PhysicalOperatorType::kMergeSort:
+        case PhysicalOperatorType::kMergeParallelAggregate:
+        case PhysicalOperatorType::kMergeHash: {
+            if (phys_op->left() == nullptr || phys_op->right() != nullptr) {
+                UnrecoverableError(fmt::format("Invalid input node of {}", phys_op->GetName()));
+            }
+            // The tasks of the child fragment hand their hash tables or sorted runs over through the operators, so the fragment reads
+            // nothing from it. The sorted runs are merged into one order by a single task.
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetFragmentType(phys_op->operator_type() == PhysicalOperatorType::kMergeSort ? FragmentType::kSerialMaterialize
+                                                                                                                : FragmentType::kParallelMaterialize);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kEmpty, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+
+            auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            next_plan_fragment->SetSinkNode(query_context_ptr_,
+                                            SinkType::kLocalQueue,
+                                            phys_op->left()->GetOutputNames(),
+                                            phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), next_plan_fragment.get());
+
+            current_fragment_ptr->AddChild(std::move(next_plan_fragment));
+            return;
+        }
+        case PhysicalOperatorType::kJoinHash: {
+            if (phys_op->left() == nullptr || phys_op->right() == nullptr) {
+                UnrecoverableError(fmt::format("Invalid input node of {}", phys_op->GetName()));
+            }
+            // The build side runs in its own fragments before this one starts, the probe side streams through it.
+            current_fragment_ptr->AddOperator(phys_op);
+
+            auto build_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            build_plan_fragment->SetSinkNode(query_context_ptr_,
+                                             SinkType::kLocalQueue,
+                                             phys_op->right()->GetOutputNames(),
+                                             phys_op->right()->GetOutputTypes());
+            BuildFragments(phys_op->right(), build_plan_fragment.get());
+            current_fragment_ptr->AddChild(std::move(build_plan_fragment));
+
+            BuildFragments(phys_op->left(), current_fragment_ptr);
+            return;
+        }
         case PhysicalOperatorType::kUnionAll:
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
         case PhysicalOperatorType::kCrossProduct: {
             UnrecoverableError(fmt::format("Not support {}.", phys_op->GetName()));
         }
+        case PhysicalOperatorType::kMatch: {
+            if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
+                UnrecoverableError(fmt::format("{} shouldn't have child.", phys_op->GetName()));
+            }
+            if (phys_op->TaskletCount() <= 1) {
+                current_fragment_ptr->SetFragmentType(FragmentType::kSerialMaterialize);
+            } else {
+                current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            }
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kEmpty, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            return;
+        }
         case PhysicalOperatorType::kMatchTensorScan:
         case PhysicalOperatorType::kKnnScan: {
             if (phys_op->left() != nullptr or phys_op->right() != nullptr) {
@@ -0,0 +1,320 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module join_hash_table;
+
+import stl;
+import column_vector;
+import data_block;
+import selection;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import expression_type;
+import logical_type;
+import data_type;
+import internal_types;
+import vector_buffer;
+import fix_heap;
+import default_values;
+
+namespace infinity {
+
+namespace {
+
+// Finalizer of MurmurHash3, the partition is taken from the high bits so they have to depend on all bits of the key.
+inline u64 MixHash(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline SizeT SourceRow(const ColumnVector &column, SizeT row) { return column.vector_type() == ColumnVectorType::kConstant ? 0 : row; }
+
+} // namespace
+
+bool IsJoinKeyType(LogicalType type) {
+    switch (type) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kVarchar: {
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+void JoinKeys::Build(const Vector<SharedPtr<BaseExpression>> &key_exprs, Vector<SharedPtr<ExpressionState>> &key_states, const DataBlock *block) {
+    ExpressionEvaluator evaluator;
+    evaluator.Init(block);
+    Vector<SharedPtr<ColumnVector>> key_columns;
+    key_columns.reserve(key_exprs.size());
+    for (SizeT i = 0; i < key_exprs.size(); ++i) {
+        const SharedPtr<BaseExpression> &key_expr = key_exprs[i];
+        SharedPtr<ColumnVector> key_column;
+        if (key_expr->type() != ExpressionType::kReference) {
+            key_column = MakeShared<ColumnVector>(MakeShared<DataType>(key_expr->Type()));
+            key_column->Initialize();
+        }
+        evaluator.Execute(key_expr, key_states[i], key_column);
+        key_columns.emplace_back(std::move(key_column));
+    }
+    Build(key_columns, block->row_count());
+}
+
+void JoinKeys::Build(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count) {
+    Serialize(key_columns, row_count);
+    ComputeHashes();
+}
+
+void JoinKeys::Serialize(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count) {
+    nulls_.assign(row_count, 0);
+    SizeT fixed_width = 0;
+    bool has_varchar = false;
+    for (const auto &column : key_columns) {
+        if (column->data_type()->type() == LogicalType::kVarchar) {
+            has_varchar = true;
+        } else {
+            fixed_width += column->data_type_size_;
+        }
+        if (column->nulls_ptr_->IsAllTrue()) {
+            continue;
+        }
+        for (SizeT row = 0; row < row_count; ++row) {
+            if (!column->nulls_ptr_->IsTrue(SourceRow(*column, row))) {
+                nulls_[row] = 1;
+            }
+        }
+    }
+
+    if (!has_varchar) {
+        fixed_width_ = fixed_width;
+        offsets_.clear();
+        data_.resize(row_count * fixed_width_);
+        SizeT column_offset = 0;
+        for (const auto &column : key_columns) {
+            SizeT width = column->data_type_size_;
+            const char *src = reinterpret_cast<const char *>(column->data());
+            char *dst = data_.data() + column_offset;
+            if (column->vector_type() == ColumnVectorType::kConstant) {
+                for (SizeT row = 0; row < row_count; ++row, dst += fixed_width_) {
+                    std::memcpy(dst, src, width);
+                }
+            } else {
+                for (SizeT row = 0; row < row_count; ++row, src += width, dst += fixed_width_) {
+                    std::memcpy(dst, src, width);
+                }
+            }
+            column_offset += width;
+        }
+        return;
+    }
+
+    // Lay out the rows first, a null key is never compared so its varchars are left empty.
+    fixed_width_ = 0;
+    offsets_.resize(row_count + 1);
+    offsets_[0] = 0;
+    for (SizeT row = 0; row < row_count; ++row) {
+        SizeT row_width = fixed_width;
+        for (const auto &column : key_columns) {
+            if (column->data_type()->type() != LogicalType::kVarchar) {
+                continue;
+            }
+            row_width += sizeof(u32);
+            if (nulls_[row] == 0) {
+                row_width += reinterpret_cast<const VarcharT *>(column->data())[SourceRow(*column, row)].length_;
+            }
+        }
+        offsets_[row + 1] = offsets_[row] + row_width;
+    }
+    data_.resize(offsets_[row_count]);
+
+    Vector<u32> cursors(offsets_.begin(), offsets_.end() - 1);
+    for (const auto &column : key_columns) {
+        if (column->data_type()->type() != LogicalType::kVarchar) {
+            SizeT width = column->data_type_size_;
+            const char *src = reinterpret_cast<const char *>(column->data());
+            for (SizeT row = 0; row < row_count; ++row) {
+                std::memcpy(data_.data() + cursors[row], src + SourceRow(*column, row) * width, width);
+                cursors[row] += width;
+            }
+            continue;
+        }
+        const auto *varchars = reinterpret_cast<const VarcharT *>(column->data());
+        for (SizeT row = 0; row < row_count; ++row) {
+            char *dst = data_.data() + cursors[row];
+            u32 length = 0;
+            if (nulls_[row] == 0) {
+                const VarcharT &varchar = varchars[SourceRow(*column, row)];
+                length = varchar.length_;
+                if (varchar.IsInlined()) {
+                    std::memcpy(dst + sizeof(u32), varchar.short_.data_, length);
+                } else {
+                    column->buffer_->fix_heap_mgr_->ReadFromHeap(dst + sizeof(u32), varchar.vector_.chunk_id_, varchar.vector_.chunk_offset_, length);
+                }
+            }
+            std::memcpy(dst, &length, sizeof(u32));
+            cursors[row] += sizeof(u32) + length;
+        }
+    }
+}
+
+void JoinKeys::ComputeHashes() {
+    SizeT row_count = nulls_.size();
+    hashes_.resize(row_count);
+    if (fixed_width_ != 0 && fixed_width_ <= sizeof(u64)) {
+        const char *key = data_.data();
+        for (SizeT row = 0; row < row_count; ++row, key += fixed_width_) {
+            u64 value = 0;
+            std::memcpy(&value, key, fixed_width_);
+            hashes_[row] = MixHash(value);
+        }
+        return;
+    }
+    std::hash<std::string_view> hasher;
+    for (SizeT row = 0; row < row_count; ++row) {
+        hashes_[row] = MixHash(hasher(Key(row)));
+    }
+}
+
+void JoinHashTable::Append(JoinHashBuildLocal &local, UniquePtr<DataBlock> block, JoinKeys keys) {
+    u32 block_idx = local.blocks_.size();
+    SizeT row_count = keys.row_count();
+    for (SizeT row = 0; row < row_count; ++row) {
+        if (keys.IsNull(row)) {
+            continue;
+        }
+        u64 hash = keys.Hash(row);
+        local.partitions_[PartitionOf(hash)].push_back(JoinHashEntry{hash, block_idx, static_cast<u32>(row), 0});
+    }
+    local.blocks_.emplace_back(std::move(block));
+    local.keys_.emplace_back(std::move(keys));
+}
+
+void JoinHashTable::Merge(JoinHashBuildLocal &local) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    u32 block_offset = blocks_.size();
+    for (SizeT partition_id = 0; partition_id < PARTITION_COUNT; ++partition_id) {
+        Vector<JoinHashEntry> &entries = partitions_[partition_id].entries_;
+        for (JoinHashEntry &entry : local.partitions_[partition_id]) {
+            entry.block_idx_ += block_offset;
+            entries.push_back(entry);
+        }
+        row_count_ += local.partitions_[partition_id].size();
+        local.partitions_[partition_id].clear();
+    }
+    for (auto &block : local.blocks_) {
+        blocks_.emplace_back(std::move(block));
+    }
+    for (auto &keys : local.keys_) {
+        keys_.emplace_back(std::move(keys));
+    }
+    local.blocks_.clear();
+    local.keys_.clear();
+}
+
+void JoinHashTable::BuildPartitions(SizeT partition_begin, SizeT partition_end) {
+    for (SizeT partition_id = partition_begin; partition_id < partition_end; ++partition_id) {
+        Partition &partition = partitions_[partition_id];
+        Vector<JoinHashEntry> &entries = partition.entries_;
+        SizeT entry_count = entries.size();
+        if (entry_count == 0) {
+            continue;
+        }
+        // At most half of the slots are taken, so a probe of a missing key ends soon.
+        SizeT capacity = 16;
+        while (capacity < entry_count * 2) {
+            capacity <<= 1;
+        }
+        partition.slots_.assign(capacity, 0);
+        partition.mask_ = capacity - 1;
+        // An entry is pushed to the front of the chain of its key, walk backwards to keep the build order within a key.
+        for (SizeT i = entry_count; i-- > 0;) {
+            JoinHashEntry &entry = entries[i];
+            std::string_view key = keys_[entry.block_idx_].Key(entry.row_idx_);
+            for (u64 slot = entry.hash_ & partition.mask_;; slot = (slot + 1) & partition.mask_) {
+                u32 &head = partition.slots_[slot];
+                if (head == 0) {
+                    head = i + 1;
+                    break;
+                }
+                const JoinHashEntry &head_entry = entries[head - 1];
+                if (head_entry.hash_ == entry.hash_ && keys_[head_entry.block_idx_].Key(head_entry.row_idx_) == key) {
+                    entry.next_ = head;
+                    head = i + 1;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void GatherColumns(const DataBlock *input, const Selection &select, Vector<SharedPtr<ColumnVector>> &output_columns) {
+    SizeT row_count = select.Size();
+    for (const auto &input_column : input->column_vectors) {
+        auto column = MakeShared<ColumnVector>(input_column->data_type());
+        if (input_column->vector_type() == ColumnVectorType::kConstant) {
+            // Expand a constant column, a block of constant columns only would have no rows.
+            column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+            column->Finalize(row_count);
+            for (SizeT i = 0; i < row_count; ++i) {
+                CopyJoinRow(*column, i, *input_column, 0);
+            }
+            output_columns.emplace_back(std::move(column));
+            continue;
+        }
+        column->Initialize(*input_column, select);
+        if (!input_column->nulls_ptr_->IsAllTrue()) {
+            for (SizeT i = 0; i < row_count; ++i) {
+                if (!input_column->nulls_ptr_->IsTrue(select.Get(i))) {
+                    column->nulls_ptr_->SetFalse(i);
+                }
+            }
+        }
+        output_columns.emplace_back(std::move(column));
+    }
+}
+
+void CopyJoinRow(ColumnVector &dst, SizeT dst_idx, const ColumnVector &src, SizeT src_idx) {
+    dst.CopyRow(src, dst_idx, src_idx);
+    if (!src.nulls_ptr_->IsTrue(SourceRow(src, src_idx))) {
+        dst.nulls_ptr_->SetFalse(dst_idx);
+    }
+}
+
+void SetJoinNullRow(ColumnVector &dst, SizeT dst_idx) {
+    // Zero the value too, a varchar or an embedding must not point to anything.
+    if (dst.data_type()->type() == LogicalType::kBoolean) {
+        dst.buffer_->SetCompactBit(dst_idx, false);
+    } else {
+        std::memset(dst.data() + dst_idx * dst.data_type_size_, 0, dst.data_type_size_);
+    }
+    dst.nulls_ptr_->SetFalse(dst_idx);
+}
+
+} // namespace infinity
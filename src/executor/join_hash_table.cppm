@@ -0,0 +1,159 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module join_hash_table;
+
+import stl;
+import column_vector;
+import data_block;
+import selection;
+import base_expression;
+import expression_state;
+import logical_type;
+
+namespace infinity {
+
+// Whether the values of the type are equal iff their bytes are, so that they can be a key of the join hash table.
+export bool IsJoinKeyType(LogicalType type);
+
+// The join keys of a batch of rows. The key columns of a row are serialized into one contiguous buffer, a varchar column as its
+// length followed by its bytes, and the keys are hashed in a batch.
+export class JoinKeys {
+public:
+    // Evaluate the key expressions on the block and serialize the results.
+    void Build(const Vector<SharedPtr<BaseExpression>> &key_exprs, Vector<SharedPtr<ExpressionState>> &key_states, const DataBlock *block);
+
+    void Build(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count);
+
+    // A row with a null key column matches no row.
+    inline bool IsNull(SizeT row) const { return nulls_[row] != 0; }
+
+    inline u64 Hash(SizeT row) const { return hashes_[row]; }
+
+    inline std::string_view Key(SizeT row) const {
+        if (fixed_width_ != 0) {
+            return {data_.data() + row * fixed_width_, fixed_width_};
+        }
+        return {data_.data() + offsets_[row], offsets_[row + 1] - offsets_[row]};
+    }
+
+    inline SizeT row_count() const { return nulls_.size(); }
+
+private:
+    void Serialize(const Vector<SharedPtr<ColumnVector>> &key_columns, SizeT row_count);
+
+    void ComputeHashes();
+
+    // The width of all keys if there is no varchar key column, otherwise 0 and the keys are located by `offsets_`.
+    SizeT fixed_width_{};
+    Vector<char> data_{};
+    Vector<u32> offsets_{};
+    Vector<u64> hashes_{};
+    Vector<u8> nulls_{};
+};
+
+// A row of the build side, chained with the following rows of the same key.
+export struct JoinHashEntry {
+    u64 hash_{};
+    u32 block_idx_{};
+    u32 row_idx_{};
+    // Index + 1 of the next entry of the same key in the partition, 0 for the end of the chain.
+    u32 next_{};
+};
+
+// What a build task collects before it is merged into the hash table.
+export struct JoinHashBuildLocal;
+
+// Hash table of the build side of a hash join, partitioned by the high bits of the hash:
+//   1. Each build task keeps its input blocks and scatters the rows into its local partitions (`Append`), then appends them to the
+//      partitions of the table once its input is exhausted (`Merge`).
+//   2. Each merge task builds the open-addressing tables of a range of partitions (`BuildPartitions`), the ranges don't overlap.
+//   3. The probe tasks look up the table (`ForEachMatch`), it's read-only since then.
+// The fragments of the three steps run one after another, so only `Merge` is synchronized.
+export class JoinHashTable {
+public:
+    static constexpr SizeT PARTITION_BITS = 6;
+    static constexpr SizeT PARTITION_COUNT = 1 << PARTITION_BITS;
+
+    static inline SizeT PartitionOf(u64 hash) { return hash >> (64 - PARTITION_BITS); }
+
+    static void Append(JoinHashBuildLocal &local, UniquePtr<DataBlock> block, JoinKeys keys);
+
+    void Merge(JoinHashBuildLocal &local);
+
+    void BuildPartitions(SizeT partition_begin, SizeT partition_end);
+
+    // Call `func(block, row_idx)` on each build row with the key of the probe row.
+    template <typename Func>
+    void ForEachMatch(const JoinKeys &probe_keys, SizeT probe_row, Func &&func) const {
+        u64 hash = probe_keys.Hash(probe_row);
+        const Partition &partition = partitions_[PartitionOf(hash)];
+        if (partition.slots_.empty()) {
+            return;
+        }
+        std::string_view key = probe_keys.Key(probe_row);
+        for (u64 slot = hash & partition.mask_;; slot = (slot + 1) & partition.mask_) {
+            u32 entry_id = partition.slots_[slot];
+            if (entry_id == 0) {
+                return;
+            }
+            const JoinHashEntry *entry = &partition.entries_[entry_id - 1];
+            if (entry->hash_ != hash || keys_[entry->block_idx_].Key(entry->row_idx_) != key) {
+                continue;
+            }
+            while (true) {
+                func(blocks_[entry->block_idx_].get(), entry->row_idx_);
+                if (entry->next_ == 0) {
+                    return;
+                }
+                entry = &partition.entries_[entry->next_ - 1];
+            }
+        }
+    }
+
+    inline SizeT row_count() const { return row_count_; }
+
+private:
+    struct Partition {
+        Vector<JoinHashEntry> entries_{};
+        // Index + 1 of the first entry of each key, 0 for an empty slot.
+        Vector<u32> slots_{};
+        u64 mask_{};
+    };
+
+    std::mutex mutex_{};
+    Vector<UniquePtr<DataBlock>> blocks_{};
+    Vector<JoinKeys> keys_{};
+    Array<Partition, PARTITION_COUNT> partitions_{};
+    SizeT row_count_{};
+};
+
+export struct JoinHashBuildLocal {
+    Vector<UniquePtr<DataBlock>> blocks_{};
+    Vector<JoinKeys> keys_{};
+    Array<Vector<JoinHashEntry>, JoinHashTable::PARTITION_COUNT> partitions_{};
+};
+
+// Copy the rows of `select` from `input` into new flat columns, with their null flags.
+export void GatherColumns(const DataBlock *input, const Selection &select, Vector<SharedPtr<ColumnVector>> &output_columns);
+
+// Copy a row into a column that has already been finalized past `dst_idx`, with its null flag.
+export void CopyJoinRow(ColumnVector &dst, SizeT dst_idx, const ColumnVector &src, SizeT src_idx);
+
+// Set a row of a column that has already been finalized past `dst_idx` to null.
+export void SetJoinNullRow(ColumnVector &dst, SizeT dst_idx);
+
+} // namespace infinity
@@ -22,8 +22,7 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
-import data_table;
-import hash_table;
+import aggregate_hash_table;
 import base_expression;
 import load_meta;
 import infinity_exception;
@@ -50,6 +49,13 @@ public:
         : PhysicalOperator(PhysicalOperatorType::kAggregate, std::move(left), nullptr, id, load_metas), groups_(std::move(groups)),
           aggregates_(std::move(aggregates)), groupby_index_(groupby_index), aggregate_index_(aggregate_index) {}
 
+    // Each task combines its groups into the table rather than output them, and the following merge aggregate outputs the table.
+    inline void SetMergeTable(SharedPtr<AggregateHashTable> merge_table) { merge_table_ = std::move(merge_table); }
+
+    inline const SharedPtr<AggregateHashTable> &merge_table() const { return merge_table_; }
+
+    UniquePtr<AggregateHashTable> MakeHashTable() const;
+
     ~PhysicalAggregate() override = default;
 
     void Init() override;
@@ -61,13 +67,8 @@ public:
         return 0;
     }
 
-    void GroupByInputTable(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
-
-    void GenerateGroupByResult(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
-
     Vector<SharedPtr<BaseExpression>> groups_{};
     Vector<SharedPtr<BaseExpression>> aggregates_{};
-    HashTable hash_table_;
 
     bool SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
                                 Vector<UniquePtr<DataBlock>> &output_blocks,
@@ -87,7 +88,7 @@ public:
     Vector<HashRange> GetHashRanges(i64 parallel_count) const;
 
 private:
-    SharedPtr<DataTable> input_table_{};
+    SharedPtr<AggregateHashTable> merge_table_{};
     u64 groupby_index_{};
     u64 aggregate_index_{};
 };
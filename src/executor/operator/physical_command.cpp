@@ -36,6 +36,7 @@ import status;
 import infinity_exception;
 import variables;
 import logger;
+import task_priority;
 
 namespace infinity {
 
@@ -64,6 +65,24 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             query_context->current_session()->SessionVariables()->enable_profile_ = set_command->value_bool();
                             return true;
                         }
+                        case SessionVariable::kQueryPriority: {
+                            if (set_command->value_type() != SetVarType::kString) {
+                                Status status = Status::DataTypeMismatch("String", set_command->value_type_str());
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            String priority_str = set_command->value_str();
+                            ToLower(priority_str);
+                            TaskPriorityClass priority_class = StringToTaskPriorityClass(priority_str);
+                            if (priority_class == TaskPriorityClass::kInvalid && priority_str != "auto") {
+                                Status status = Status::InvalidCommand(
+                                    fmt::format("Invalid query priority: {}, expect auto, interactive, normal or background", priority_str));
+                                LOG_ERROR(status.message());
+                                RecoverableError(status);
+                            }
+                            query_context->current_session()->SessionVariables()->query_priority_ = priority_class;
+                            return true;
+                        }
                         case SessionVariable::kInvalid: {
                             Status status = Status::InvalidCommand(fmt::format("Unknown session variable: {}", set_command->var_name()));
                             LOG_ERROR(status.message());
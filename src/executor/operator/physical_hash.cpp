@@ -14,15 +14,37 @@
 
 module;
 
+module physical_hash;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_hash;
+import data_block;
+import join_hash_table;
 
 namespace infinity {
 
 void PhysicalHash::Init() {}
 
-bool PhysicalHash::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHash::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *prev_op_state = operator_state->prev_op_state_;
+    auto *hash_operator_state = static_cast<HashOperatorState *>(operator_state);
+
+    for (auto &input_block : prev_op_state->data_block_array_) {
+        if (input_block->row_count() == 0) {
+            continue;
+        }
+        JoinKeys keys;
+        keys.Build(hash_keys_, hash_operator_state->key_states_, input_block.get());
+        JoinHashTable::Append(hash_operator_state->local_, std::move(input_block), std::move(keys));
+    }
+    prev_op_state->data_block_array_.clear();
+
+    if (prev_op_state->Complete()) {
+        hash_table_->Merge(hash_operator_state->local_);
+        operator_state->SetComplete();
+    }
+    return true;
+}
 
 } // namespace infinity
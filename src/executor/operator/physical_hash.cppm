@@ -22,6 +22,8 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import join_hash_table;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -29,14 +31,16 @@ import data_type;
 
 namespace infinity {
 
+// Build side of a hash join: each task appends its input blocks to the shared hash table.
 export class PhysicalHash final : public PhysicalOperator {
 public:
-    explicit PhysicalHash(SharedPtr<Vector<String>> output_names,
-                          SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                          u64 id,
+    explicit PhysicalHash(u64 id,
+                          UniquePtr<PhysicalOperator> left,
+                          Vector<SharedPtr<BaseExpression>> hash_keys,
+                          SharedPtr<JoinHashTable> hash_table,
                           SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kHash, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kHash, std::move(left), nullptr, id, load_metas), hash_keys_(std::move(hash_keys)),
+          hash_table_(std::move(hash_table)) {}
 
     ~PhysicalHash() override = default;
 
@@ -44,18 +48,20 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return left_->GetOutputNames(); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return left_->GetOutputTypes(); }
 
     SizeT TaskletCount() override {
         UnrecoverableError("Not implement: TaskletCount not Implement");
         return 0;
     }
 
+    inline const Vector<SharedPtr<BaseExpression>> &hash_keys() const { return hash_keys_; }
+
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    Vector<SharedPtr<BaseExpression>> hash_keys_{};
+    SharedPtr<JoinHashTable> hash_table_{};
 };
 
 } // namespace infinity
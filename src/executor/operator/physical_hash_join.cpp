@@ -14,19 +14,191 @@
 
 module;
 
-#include <string>
+module physical_hash_join;
+
+import stl;
 import query_context;
 import operator_state;
-import stl;
-
-
-module physical_hash_join;
+import base_expression;
+import expression_state;
+import expression_evaluator;
+import expression_selector;
+import join_hash_table;
+import join_reference;
+import column_vector;
+import data_block;
+import selection;
+import default_values;
+import logical_type;
+import data_type;
+import infinity_exception;
 
 namespace infinity {
 
 void PhysicalHashJoin::Init() {}
 
-bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *prev_op_state = operator_state->prev_op_state_;
+    auto *join_operator_state = static_cast<HashJoinOperatorState *>(operator_state);
+
+    for (const auto &input_block : prev_op_state->data_block_array_) {
+        if (input_block->row_count() == 0) {
+            continue;
+        }
+        ProbeBlock(input_block.get(), join_operator_state);
+    }
+    prev_op_state->data_block_array_.clear();
+
+    if (prev_op_state->Complete()) {
+        operator_state->SetComplete();
+    }
+    return true;
+}
+
+void PhysicalHashJoin::ProbeBlock(const DataBlock *input_block, HashJoinOperatorState *join_operator_state) const {
+    SizeT row_count = input_block->row_count();
+    JoinKeys probe_keys;
+    probe_keys.Build(probe_keys_, join_operator_state->key_states_, input_block);
+
+    // Collect the matches of the whole block first, so that the candidate blocks are built a column at a time.
+    Vector<u32> probe_rows;
+    Vector<const DataBlock *> build_blocks;
+    Vector<u32> build_rows;
+    for (SizeT row = 0; row < row_count; ++row) {
+        if (probe_keys.IsNull(row)) {
+            continue;
+        }
+        hash_table_->ForEachMatch(probe_keys, row, [&](const DataBlock *build_block, u32 build_row) {
+            probe_rows.push_back(row);
+            build_blocks.push_back(build_block);
+            build_rows.push_back(build_row);
+        });
+    }
+
+    Vector<u8> matched(row_count, 0);
+    SizeT match_count = probe_rows.size();
+    for (SizeT begin = 0; begin < match_count; begin += DEFAULT_VECTOR_SIZE) {
+        SizeT end = std::min(begin + DEFAULT_VECTOR_SIZE, match_count);
+        UniquePtr<DataBlock> candidate_block = MakeCandidateBlock(input_block, probe_rows, build_blocks, build_rows, begin, end);
+        if (conditions_.empty()) {
+            for (SizeT i = begin; i < end; ++i) {
+                matched[probe_rows[i]] = 1;
+            }
+            join_operator_state->data_block_array_.emplace_back(std::move(candidate_block));
+            continue;
+        }
+
+        SharedPtr<Selection> selected = FilterCandidates(candidate_block.get(), join_operator_state);
+        SizeT selected_count = selected->Size();
+        for (SizeT i = 0; i < selected_count; ++i) {
+            matched[probe_rows[begin + selected->Get(i)]] = 1;
+        }
+        if (selected_count == 0) {
+            continue;
+        }
+        if (selected_count == end - begin) {
+            join_operator_state->data_block_array_.emplace_back(std::move(candidate_block));
+            continue;
+        }
+        Vector<SharedPtr<ColumnVector>> output_columns;
+        GatherColumns(candidate_block.get(), *selected, output_columns);
+        UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(output_columns);
+        join_operator_state->data_block_array_.emplace_back(std::move(output_block));
+    }
+
+    if (join_type_ != JoinType::kLeft) {
+        return;
+    }
+
+    // The unmatched rows of a left join, with null right columns.
+    Selection select;
+    select.Initialize(row_count);
+    for (SizeT row = 0; row < row_count; ++row) {
+        if (matched[row] == 0) {
+            select.Append(row);
+        }
+    }
+    SizeT select_count = select.Size();
+    if (select_count == 0) {
+        return;
+    }
+    Vector<SharedPtr<ColumnVector>> output_columns;
+    GatherColumns(input_block, select, output_columns);
+    for (const auto &build_type : *build_types_) {
+        auto column = MakeShared<ColumnVector>(build_type);
+        column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        column->Finalize(select_count);
+        for (SizeT i = 0; i < select_count; ++i) {
+            SetJoinNullRow(*column, i);
+        }
+        output_columns.emplace_back(std::move(column));
+    }
+    UniquePtr<DataBlock> output_block = DataBlock::MakeUniquePtr();
+    output_block->Init(output_columns);
+    join_operator_state->data_block_array_.emplace_back(std::move(output_block));
+}
+
+UniquePtr<DataBlock> PhysicalHashJoin::MakeCandidateBlock(const DataBlock *input_block,
+                                                          const Vector<u32> &probe_rows,
+                                                          const Vector<const DataBlock *> &build_blocks,
+                                                          const Vector<u32> &build_rows,
+                                                          SizeT begin,
+                                                          SizeT end) const {
+    SizeT count = end - begin;
+    Selection probe_select;
+    probe_select.Initialize(count);
+    for (SizeT i = begin; i < end; ++i) {
+        probe_select.Append(probe_rows[i]);
+    }
+    Vector<SharedPtr<ColumnVector>> columns;
+    columns.reserve(input_block->column_count() + build_types_->size());
+    GatherColumns(input_block, probe_select, columns);
+
+    for (SizeT column_id = 0; column_id < build_types_->size(); ++column_id) {
+        auto column = MakeShared<ColumnVector>((*build_types_)[column_id]);
+        column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        column->Finalize(count);
+        for (SizeT i = begin; i < end; ++i) {
+            CopyJoinRow(*column, i - begin, *build_blocks[i]->column_vectors[column_id], build_rows[i]);
+        }
+        columns.emplace_back(std::move(column));
+    }
+
+    UniquePtr<DataBlock> candidate_block = DataBlock::MakeUniquePtr();
+    candidate_block->Init(columns);
+    return candidate_block;
+}
+
+SharedPtr<Selection> PhysicalHashJoin::FilterCandidates(const DataBlock *candidate_block, HashJoinOperatorState *join_operator_state) const {
+    SizeT row_count = candidate_block->row_count();
+    ExpressionEvaluator evaluator;
+    evaluator.Init(candidate_block);
+
+    // Count the conditions that are true on each row, null is not true.
+    Vector<u32> true_count(row_count, 0);
+    for (SizeT i = 0; i < conditions_.size(); ++i) {
+        auto bool_column = MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kBoolean));
+        bool_column->Initialize(ColumnVectorType::kCompactBit);
+        evaluator.Execute(conditions_[i], join_operator_state->condition_states_[i], bool_column);
+
+        auto true_select = MakeShared<Selection>();
+        true_select->Initialize(row_count);
+        ExpressionSelector::Select(bool_column, row_count, true_select, true);
+        for (SizeT j = 0; j < true_select->Size(); ++j) {
+            ++true_count[true_select->Get(j)];
+        }
+    }
+
+    auto selected = MakeShared<Selection>();
+    selected->Initialize(row_count);
+    for (SizeT row = 0; row < row_count; ++row) {
+        if (true_count[row] == conditions_.size()) {
+            selected->Append(row);
+        }
+    }
+    return selected;
+}
 
 SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
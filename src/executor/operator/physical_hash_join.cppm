@@ -22,17 +22,36 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import join_hash_table;
+import data_block;
+import selection;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import join_reference;
 import data_type;
 
 namespace infinity {
 
+// Probe side of an inner or left hash join. The right child builds the hash table (PhysicalMergeHash over PhysicalHash), the left child is probed
+// block by block, so the output keeps the order of the left input.
 export class PhysicalHashJoin : public PhysicalOperator {
 public:
-    explicit PhysicalHashJoin(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kJoinHash, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalHashJoin(u64 id,
+                              JoinType join_type,
+                              Vector<SharedPtr<BaseExpression>> probe_keys,
+                              Vector<SharedPtr<BaseExpression>> build_keys,
+                              Vector<SharedPtr<BaseExpression>> conditions,
+                              SharedPtr<JoinHashTable> hash_table,
+                              UniquePtr<PhysicalOperator> left,
+                              UniquePtr<PhysicalOperator> right,
+                              SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kJoinHash, std::move(left), std::move(right), id, load_metas), join_type_(join_type),
+          probe_keys_(std::move(probe_keys)), build_keys_(std::move(build_keys)), conditions_(std::move(conditions)),
+          hash_table_(std::move(hash_table)) {
+        build_types_ = right_->GetOutputTypes();
+    }
 
     ~PhysicalHashJoin() override = default;
 
@@ -48,6 +67,37 @@ public:
         UnrecoverableError("Not implement: TaskletCount not Implement");
         return 0;
     }
+
+    inline JoinType join_type() const { return join_type_; }
+
+    inline const Vector<SharedPtr<BaseExpression>> &probe_keys() const { return probe_keys_; }
+
+    // Bound to the output of the right child.
+    inline const Vector<SharedPtr<BaseExpression>> &build_keys() const { return build_keys_; }
+
+    // Conditions other than the key equalities, bound to the left columns followed by the right columns.
+    inline const Vector<SharedPtr<BaseExpression>> &conditions() const { return conditions_; }
+
+private:
+    void ProbeBlock(const DataBlock *input_block, HashJoinOperatorState *join_operator_state) const;
+
+    // Left columns of the probe rows followed by right columns of the matched build rows.
+    UniquePtr<DataBlock> MakeCandidateBlock(const DataBlock *input_block,
+                                            const Vector<u32> &probe_rows,
+                                            const Vector<const DataBlock *> &build_blocks,
+                                            const Vector<u32> &build_rows,
+                                            SizeT begin,
+                                            SizeT end) const;
+
+    // Rows of the candidate block on which all conditions are true.
+    SharedPtr<Selection> FilterCandidates(const DataBlock *candidate_block, HashJoinOperatorState *join_operator_state) const;
+
+    JoinType join_type_{JoinType::kInner};
+    Vector<SharedPtr<BaseExpression>> probe_keys_{};
+    Vector<SharedPtr<BaseExpression>> build_keys_{};
+    Vector<SharedPtr<BaseExpression>> conditions_{};
+    SharedPtr<JoinHashTable> hash_table_{};
+    SharedPtr<Vector<SharedPtr<DataType>>> build_types_{};
 };
 
 } // namespace infinity
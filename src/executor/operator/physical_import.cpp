@@ -53,6 +53,7 @@ import status;
 import column_vector;
 import default_values;
 import embedding_info;
+import internal_types;
 import column_def;
 import constant_expr;
 import wal_entry;
@@ -661,6 +662,17 @@ void PhysicalImport::JSONLRowHandler(const nlohmann::json &line_json, Vector<Col
                             column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
                             break;
                         }
+                        case kElemUInt8: {
+                            Vector<u8> &&embedding = line_json[column_def->name_].get<Vector<u8>>();
+                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                            break;
+                        }
+                        case kElemFloat16: {
+                            Vector<float> &&float_embedding = line_json[column_def->name_].get<Vector<float>>();
+                            Vector<Float16T> embedding(float_embedding.begin(), float_embedding.end());
+                            column_vector.AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                            break;
+                        }
                         default: {
                             UnrecoverableError("Not implement: Embedding type.");
                         }
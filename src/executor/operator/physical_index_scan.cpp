@@ -299,31 +299,16 @@ struct TrunkReaderT final : public TrunkReader<ColumnValueType> {
 template <typename ColumnValueType>
 struct TrunkReaderM final : public TrunkReader<ColumnValueType> {
     using KeyType = ConvertToOrderedType<ColumnValueType>;
-    const u32 segment_row_count_;
     SharedPtr<SecondaryIndexInMem> memory_secondary_index_;
-    Pair<u32, std::variant<Vector<u32>, Bitmask>> result_cache_;
-    TrunkReaderM(const u32 segment_row_count, const SharedPtr<SecondaryIndexInMem> &memory_secondary_index)
-        : segment_row_count_(segment_row_count), memory_secondary_index_(memory_secondary_index) {}
+    SecondaryIndexInMemRange result_cache_;
+    explicit TrunkReaderM(const SharedPtr<SecondaryIndexInMem> &memory_secondary_index) : memory_secondary_index_(memory_secondary_index) {}
     u32 GetResultCnt(const FilterIntervalRangeT<ColumnValueType> &interval_range) override {
         auto [begin_val, end_val] = interval_range.GetRange();
-        Tuple<u32, KeyType, KeyType> arg_tuple = {segment_row_count_, begin_val, end_val};
-        result_cache_ = memory_secondary_index_->RangeQuery(&arg_tuple);
-        return result_cache_.first;
-    }
-    void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) override {
-        std::visit(Overload{[&](Vector<u32> &selected_rows, const Vector<u32> &result) {
-                                selected_rows.insert(selected_rows.end(), result.begin(), result.end());
-                            },
-                            [](Vector<u32> &, const Bitmask &) { UnrecoverableError("TrunkReaderM::OutPut(): result count error."); },
-                            [&](Bitmask &bitmask, const Vector<u32> &result) {
-                                for (const auto offset : result) {
-                                    bitmask.SetTrue(offset);
-                                }
-                            },
-                            [&](Bitmask &bitmask, const Bitmask &result) { bitmask.MergeOr(result); }},
-                   selected_rows_,
-                   result_cache_.second);
+        Pair<KeyType, KeyType> arg_pair = {begin_val, end_val};
+        result_cache_ = memory_secondary_index_->RangeQuery(&arg_pair);
+        return result_cache_.count_;
     }
+    void OutPut(std::variant<Vector<u32>, Bitmask> &selected_rows_) override { result_cache_.Output(selected_rows_); }
 };
 
 // Vector<u32>: selected rows in segment (used when selected_num <= (segment_row_cnt / 32)), i.e. size(Vector) <= size(Bitmask)
@@ -463,7 +448,7 @@ struct FilterResult {
             }
         }
         if (memory_secondary_index) {
-            trunk_readers.emplace_back(MakeUnique<TrunkReaderM<ColumnValueType>>(segment_row_count, memory_secondary_index));
+            trunk_readers.emplace_back(MakeUnique<TrunkReaderM<ColumnValueType>>(memory_secondary_index));
         }
         u32 result_size = 0;
         for (auto &trunk_reader : trunk_readers) {
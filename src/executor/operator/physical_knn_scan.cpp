@@ -44,6 +44,8 @@ import merge_knn;
 import knn_result_handler;
 import ann_ivf_flat;
 import annivfflat_index_data;
+import ann_ivf_pq;
+import annivfpq_index_data;
 import buffer_handle;
 import data_block;
 import bitmask;
@@ -60,12 +62,15 @@ import status;
 import buffer_obj;
 import create_index_info;
 import knn_expr;
+import statement_common;
 import chunk_index_entry;
 
 import block_entry;
 import segment_index_entry;
 import segment_entry;
 import abstract_hnsw;
+import internal_types;
+import simd_dispatch;
 
 namespace infinity {
 
@@ -88,6 +93,17 @@ void ReadDataBlock(DataBlock *output,
     output->Finalize();
 }
 
+// Number of partitions scanned by an ivf index, set by the "nprobe" search option
+u32 GetIVFProbeCount(const Vector<InitParameter> &opt_params) {
+    u32 n_probes = 1;
+    for (const auto &opt_param : opt_params) {
+        if (opt_param.param_name_ == "nprobe") {
+            n_probes = std::max<u32>(1, std::stoul(opt_param.param_value_));
+        }
+    }
+    return n_probes;
+}
+
 void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
                       const SharedPtr<Bitmask> &input_null_mask,
                       const SizeT count,
@@ -139,6 +155,44 @@ void MergeIntoBitmask(const VectorBuffer *input_bool_column_buffer,
     }
 }
 
+// Reorders the hamming candidates of every query by the L2 distance of the float query to the float vectors of the rerank column, which
+// replaces the hamming distance, as a search on the float column reports it.
+void FloatRerank(BufferManager *buffer_mgr, BlockIndex *block_index, const KnnScanSharedData *shared_data, MergeKnn<f32, CompareMax> *merge_heap) {
+    const SizeT dim = shared_data->dimension_;
+    const ColumnID column_id = *shared_data->float_rerank_column_id_;
+    const auto l2_func = GetSIMDFunctions().F32L2(dim);
+    // key: segment id << 32 | block id
+    HashMap<u64, ColumnVector> column_vectors;
+    Vector<Pair<f32, RowID>> candidates;
+    for (u64 query_idx = 0; query_idx < shared_data->query_count_; ++query_idx) {
+        const f32 *float_query = shared_data->float_query_embedding_ + query_idx * dim;
+        f32 *dists = merge_heap->GetDistancesByIdx(query_idx);
+        RowID *row_ids = merge_heap->GetIDsByIdx(query_idx);
+        const SizeT result_n = merge_heap->GetResultCountByIdx(query_idx);
+        candidates.clear();
+        for (SizeT i = 0; i < result_n; ++i) {
+            const RowID row_id = row_ids[i];
+            const BlockID block_id = row_id.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+            const u64 key = (static_cast<u64>(row_id.segment_id_) << 32) | block_id;
+            auto iter = column_vectors.find(key);
+            if (iter == column_vectors.end()) {
+                BlockEntry *block_entry = block_index->GetBlockEntry(row_id.segment_id_, block_id);
+                if (block_entry == nullptr) {
+                    UnrecoverableError(fmt::format("Cannot find segment id: {}, block id: {}", row_id.segment_id_, block_id));
+                }
+                iter = column_vectors.emplace(key, block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr)).first;
+            }
+            const BlockOffset block_offset = row_id.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+            const auto *float_vec = reinterpret_cast<const f32 *>(iter->second.data()) + block_offset * dim;
+            candidates.emplace_back(l2_func(float_query, float_vec, dim), row_id);
+        }
+        std::stable_sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+        for (SizeT i = 0; i < result_n; ++i) {
+            std::tie(dists[i], row_ids[i]) = candidates[i];
+        }
+    }
+}
+
 void PhysicalKnnScan::Init() {}
 
 bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -148,8 +202,7 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
     switch (elem_type) {
         case kElemFloat: {
             switch (dist_type) {
-                case KnnDistanceType::kL2:
-                case KnnDistanceType::kHamming: {
+                case KnnDistanceType::kL2: {
                     ExecuteInternal<f32, CompareMax>(query_context, knn_scan_operator_state);
                     break;
                 }
@@ -166,6 +219,73 @@ bool PhysicalKnnScan::Execute(QueryContext *query_context, OperatorState *operat
             }
             break;
         }
+        case kElemInt8: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<i8, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kCosine:
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<i8, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    Status status = Status::NotSupport("Not implemented KNN distance");
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+            }
+            break;
+        }
+        case kElemUInt8: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<u8, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kCosine:
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<u8, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    Status status = Status::NotSupport("Not implemented KNN distance");
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+            }
+            break;
+        }
+        case kElemFloat16: {
+            switch (dist_type) {
+                case KnnDistanceType::kL2: {
+                    ExecuteInternal<Float16T, CompareMax>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                case KnnDistanceType::kCosine:
+                case KnnDistanceType::kInnerProduct: {
+                    ExecuteInternal<Float16T, CompareMin>(query_context, knn_scan_operator_state);
+                    break;
+                }
+                default: {
+                    Status status = Status::NotSupport("Not implemented KNN distance");
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+            }
+            break;
+        }
+        case kElemBit: {
+            // the packed bytes of bit vectors, only compared by hamming distance
+            if (dist_type != KnnDistanceType::kHamming) {
+                Status status = Status::NotSupport("Bit embedding only supports hamming distance");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            ExecuteInternal<u8, CompareMax>(query_context, knn_scan_operator_state);
+            break;
+        }
         default: {
             Status status = Status::NotSupport("Not implemented embedding data type");
             LOG_ERROR(status.message());
@@ -216,7 +336,7 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
             }
             // check index type
             if (auto index_type = table_index_entry->index_base()->index_type_;
-                index_type != IndexType::kIVFFlat and index_type != IndexType::kHnsw) {
+                index_type != IndexType::kIVFFlat and index_type != IndexType::kIVFPQ and index_type != IndexType::kHnsw) {
                 LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                 continue;
             }
@@ -257,9 +377,12 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
     auto knn_scan_function_data = operator_state->knn_scan_function_data_.get();
     auto knn_scan_shared_data = knn_scan_function_data->knn_scan_shared_data_;
 
-    auto dist_func = static_cast<KnnDistance1<DataType> *>(knn_scan_function_data->knn_distance_.get());
-    auto merge_heap = static_cast<MergeKnn<DataType, C> *>(knn_scan_function_data->merge_knn_base_.get());
+    // DataType is the element type of the column, distances are always f32
+    auto dist_func = static_cast<KnnDistance1<DataType, f32> *>(knn_scan_function_data->knn_distance_.get());
+    auto merge_heap = static_cast<MergeKnn<f32, C> *>(knn_scan_function_data->merge_knn_base_.get());
     auto query = static_cast<const DataType *>(knn_scan_shared_data->query_embedding_);
+    // the number of DataType elements of a vector, a bit vector of dimension bits is packed in bytes
+    const SizeT vec_size = EmbeddingT::EmbeddingSize(knn_scan_shared_data->elem_type_, knn_scan_shared_data->dimension_) / sizeof(DataType);
 
     SizeT index_task_n = knn_scan_shared_data->index_entries_->size();
     SizeT brute_task_n = knn_scan_shared_data->block_column_entries_->size();
@@ -269,6 +392,19 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         LOG_TRACE(fmt::format("KnnScan: {} brute force {}/{}", knn_scan_function_data->task_id_, block_column_idx + 1, brute_task_n));
         // brute force
         BlockColumnEntry *block_column_entry = knn_scan_shared_data->block_column_entries_->at(block_column_idx);
+        {
+            // read ahead the files of the next blocks while this one is computing
+            Vector<BufferObj *> readahead_buffers;
+            for (SizeT i = block_column_idx + 1; i < brute_task_n && i <= block_column_idx + DEFAULT_READAHEAD_BLOCK_COUNT; ++i) {
+                readahead_buffers.push_back(knn_scan_shared_data->block_column_entries_->at(i)->buffer());
+            }
+            if (readahead_buffers.empty()) {
+                // the last block, nothing is read ahead anymore
+                query_context->storage()->buffer_manager()->FinishReadahead();
+            } else {
+                query_context->storage()->buffer_manager()->Readahead(readahead_buffers);
+            }
+        }
         const BlockEntry *block_entry = block_column_entry->block_entry();
         const auto block_id = block_entry->block_id();
         const SegmentID segment_id = block_entry->GetSegmentEntry()->segment_id();
@@ -310,14 +446,32 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
             ColumnVector column_vector = block_column_entry->GetColumnVector(buffer_mgr);
 
             auto data = reinterpret_cast<const DataType *>(column_vector.data());
-            merge_heap->Search(query,
-                               data,
-                               knn_scan_shared_data->dimension_,
-                               dist_func->dist_func_,
-                               row_count,
-                               block_entry->segment_id(),
-                               block_entry->block_id(),
-                               bitmask);
+            bool batch_searched = false;
+            if constexpr (std::is_same_v<DataType, f32>) {
+                // A batch of queries is evaluated against the block with matrix multiplications
+                if (knn_scan_shared_data->query_count_ > 1 && (knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kL2 ||
+                                                                knn_scan_shared_data->knn_distance_type_ == KnnDistanceType::kInnerProduct)) {
+                    merge_heap->SearchBatch(query,
+                                            data,
+                                            vec_size,
+                                            knn_scan_shared_data->knn_distance_type_,
+                                            row_count,
+                                            block_entry->segment_id(),
+                                            block_entry->block_id(),
+                                            bitmask);
+                    batch_searched = true;
+                }
+            }
+            if (!batch_searched) {
+                merge_heap->Search(query,
+                                   data,
+                                   vec_size,
+                                   dist_func->dist_func_,
+                                   row_count,
+                                   block_entry->segment_id(),
+                                   block_entry->block_id(),
+                                   bitmask);
+            }
         }
     } else if (u64 index_idx = knn_scan_shared_data->current_index_idx_++; index_idx < index_task_n) {
         LOG_TRACE(fmt::format("KnnScan: {} index {}/{}", knn_scan_function_data->task_id_, index_idx + 1, index_task_n));
@@ -354,117 +508,196 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
 
             switch (segment_index_entry->table_index_entry()->index_base()->index_type_) {
                 case IndexType::kIVFFlat: {
-                    BufferHandle index_handle = segment_index_entry->GetIndex();
-                    auto index = static_cast<const AnnIVFFlatIndexData<DataType> *>(index_handle.GetData());
-                    i32 n_probes = 1;
-                    auto IVFFlatScanTemplate = [&]<typename AnnIVFFlatType, typename... OptionalFilter>(OptionalFilter &&...filter) {
-                        AnnIVFFlatType ann_ivfflat_query(query,
+                    if (knn_scan_shared_data->elem_type_ == kElemBit) {
+                        UnrecoverableError("IVFFlat index does not support bit embedding.");
+                    } else {
+                        BufferHandle index_handle = segment_index_entry->GetIndex();
+                        auto index = static_cast<const AnnIVFFlatIndexData<f32, DataType> *>(index_handle.GetData());
+                        u32 n_probes = GetIVFProbeCount(knn_scan_shared_data->opt_params_);
+                        auto IVFFlatScanTemplate = [&]<typename AnnIVFFlatType, typename... OptionalFilter>(OptionalFilter &&...filter) {
+                            AnnIVFFlatType ann_ivfflat_query(query,
+                                                             knn_scan_shared_data->query_count_,
+                                                             knn_scan_shared_data->topk_,
+                                                             knn_scan_shared_data->dimension_,
+                                                             knn_scan_shared_data->elem_type_);
+                            ann_ivfflat_query.Begin();
+                            ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
+                            ann_ivfflat_query.EndWithoutSort();
+                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                auto dists = ann_ivfflat_query.GetDistanceByIdx(query_idx);
+                                auto row_ids = ann_ivfflat_query.GetIDByIdx(query_idx);
+                                auto result_count = std::lower_bound(dists,
+                                                                     dists + knn_scan_shared_data->topk_,
+                                                                     AnnIVFFlatType::InvalidValue(),
+                                                                     AnnIVFFlatType::CompareDist) -
+                                                    dists;
+                                merge_heap->Search(query_idx, dists, row_ids, result_count);
+                            }
+                        };
+                        auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
+                            switch (knn_scan_shared_data->knn_distance_type_) {
+                                case KnnDistanceType::kL2: {
+                                    IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<f32, DataType>>(std::forward<OptionalFilter>(filter)...);
+                                    break;
+                                }
+                                case KnnDistanceType::kInnerProduct: {
+                                    IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<f32, DataType>>(std::forward<OptionalFilter>(filter)...);
+                                    break;
+                                }
+                                default: {
+                                    Status status = Status::NotSupport("Not implemented KNN distance");
+                                    LOG_ERROR(status.message());
+                                    RecoverableError(status);
+                                }
+                            }
+                        };
+                        if (use_bitmask) {
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                IVFFlatScan(filter);
+                            } else {
+                                BitmaskFilter<SegmentOffset> filter(bitmask);
+                                IVFFlatScan(filter);
+                            }
+                        } else {
+                            SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
+                                IVFFlatScan(filter);
+                            } else {
+                                IVFFlatScan();
+                            }
+                        }
+                    }
+                    break;
+                }
+                case IndexType::kIVFPQ: {
+                    if constexpr (!std::is_same_v<DataType, f32>) {
+                        UnrecoverableError("IVFPQ index only supports float embedding.");
+                    } else {
+                        BufferHandle index_handle = segment_index_entry->GetIndex();
+                        auto index = static_cast<const AnnIVFPQIndexData *>(index_handle.GetData());
+                        u32 n_probes = GetIVFProbeCount(knn_scan_shared_data->opt_params_);
+                        auto IVFPQScanTemplate = [&]<typename AnnIVFPQType, typename... OptionalFilter>(OptionalFilter &&...filter) {
+                            AnnIVFPQType ann_ivfpq_query(query,
                                                          knn_scan_shared_data->query_count_,
                                                          knn_scan_shared_data->topk_,
                                                          knn_scan_shared_data->dimension_,
                                                          knn_scan_shared_data->elem_type_);
-                        ann_ivfflat_query.Begin();
-                        ann_ivfflat_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
-                        ann_ivfflat_query.EndWithoutSort();
-                        auto dists = ann_ivfflat_query.GetDistances();
-                        auto row_ids = ann_ivfflat_query.GetIDs();
-                        // TODO: now only work for one query
-                        // FIXME: cant work for multiple queries
-                        auto result_count = std::lower_bound(dists,
-                                                             dists + knn_scan_shared_data->topk_,
-                                                             AnnIVFFlatType::InvalidValue(),
-                                                             AnnIVFFlatType::CompareDist) -
-                                            dists;
-                        merge_heap->Search(dists, row_ids, result_count);
-                    };
-                    auto IVFFlatScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
-                        switch (knn_scan_shared_data->knn_distance_type_) {
-                            case KnnDistanceType::kL2: {
-                                IVFFlatScanTemplate.template operator()<AnnIVFFlatL2<DataType>>(std::forward<OptionalFilter>(filter)...);
-                                break;
+                            ann_ivfpq_query.Begin();
+                            ann_ivfpq_query.Search(index, segment_id, n_probes, std::forward<OptionalFilter>(filter)...);
+                            ann_ivfpq_query.EndWithoutSort();
+                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                auto dists = ann_ivfpq_query.GetDistanceByIdx(query_idx);
+                                auto row_ids = ann_ivfpq_query.GetIDByIdx(query_idx);
+                                auto result_count = std::lower_bound(dists,
+                                                                     dists + knn_scan_shared_data->topk_,
+                                                                     AnnIVFPQType::InvalidValue(),
+                                                                     AnnIVFPQType::CompareDist) -
+                                                    dists;
+                                merge_heap->Search(query_idx, dists, row_ids, result_count);
                             }
-                            case KnnDistanceType::kInnerProduct: {
-                                IVFFlatScanTemplate.template operator()<AnnIVFFlatIP<DataType>>(std::forward<OptionalFilter>(filter)...);
-                                break;
+                        };
+                        auto IVFPQScan = [&]<typename... OptionalFilter>(OptionalFilter &&...filter) {
+                            switch (knn_scan_shared_data->knn_distance_type_) {
+                                case KnnDistanceType::kL2: {
+                                    IVFPQScanTemplate.template operator()<AnnIVFPQL2>(std::forward<OptionalFilter>(filter)...);
+                                    break;
+                                }
+                                case KnnDistanceType::kInnerProduct: {
+                                    IVFPQScanTemplate.template operator()<AnnIVFPQIP>(std::forward<OptionalFilter>(filter)...);
+                                    break;
+                                }
+                                default: {
+                                    Status status = Status::NotSupport("Not implemented KNN distance");
+                                    LOG_ERROR(status.message());
+                                    RecoverableError(status);
+                                }
                             }
-                            default: {
-                                Status status = Status::NotSupport("Not implemented KNN distance");
-                                LOG_ERROR(status.message());
-                                RecoverableError(status);
+                        };
+                        if (use_bitmask) {
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
+                                IVFPQScan(filter);
+                            } else {
+                                BitmaskFilter<SegmentOffset> filter(bitmask);
+                                IVFPQScan(filter);
                             }
-                        }
-                    };
-                    if (use_bitmask) {
-                        if (segment_entry->CheckAnyDelete(begin_ts)) {
-                            DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
-                            IVFFlatScan(filter);
                         } else {
-                            BitmaskFilter<SegmentOffset> filter(bitmask);
-                            IVFFlatScan(filter);
-                        }
-                    } else {
-                        SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
-                        if (segment_entry->CheckAnyDelete(begin_ts)) {
-                            DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
-                            IVFFlatScan(filter);
-                        } else {
-                            IVFFlatScan();
+                            SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                            if (segment_entry->CheckAnyDelete(begin_ts)) {
+                                DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
+                                IVFPQScan(filter);
+                            } else {
+                                IVFPQScan();
+                            }
                         }
                     }
                     break;
                 }
                 case IndexType::kHnsw: {
                     const auto *index_hnsw = static_cast<const IndexHnsw *>(segment_index_entry->table_index_entry()->index_base());
+                    const auto *column_expr = static_cast<const ColumnExpression *>(knn_expression_->arguments()[0].get());
+                    const SizeT knn_column_id = column_expr->binding().column_idx;
+                    BufferManager *buffer_mgr = query_context->storage()->buffer_manager();
 
                     auto hnsw_search = [&](BufferHandle index_handle, bool with_lock, int chunk_id = -1) {
-                        AbstractHnsw<f32, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
+                        AbstractHnsw<DataType, SegmentOffset> abstract_hnsw(index_handle.GetDataMut(), index_hnsw);
 
+                        // With rerank = r, topk * r candidates are searched in the index, and their exact distances are computed
+                        // from the raw vectors. It restores the precision lost by an encoded (lvq or pq) index.
+                        u64 rerank = 1;
                         for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
                             if (opt_param.param_name_ == "ef") {
                                 u64 ef = std::stoull(opt_param.param_value_);
                                 abstract_hnsw.SetEf(ef);
+                            } else if (opt_param.param_name_ == "rerank") {
+                                rerank = std::max<u64>(1, std::stoull(opt_param.param_value_));
                             }
                         }
+                        // a float rerank of the bit column needs more candidates
+                        const SizeT search_k = std::max<SizeT>(knn_scan_shared_data->topk_ * rerank, knn_scan_shared_data->candidate_n_);
+                        // the distances of a plain index, and the hamming distances of a bit index, are already exact. The float rerank is
+                        // the only second pass of a bit column.
+                        const bool raw_rerank = rerank > 1 && index_hnsw->encode_type_ != HnswEncodeType::kPlain &&
+                                                knn_scan_shared_data->elem_type_ != kElemBit;
+                        HashMap<BlockID, ColumnVector> raw_column_vectors;
 
-                        i64 result_n = -1;
                         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
                             const DataType *query =
-                                static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * knn_scan_shared_data->dimension_;
+                                static_cast<const DataType *>(knn_scan_shared_data->query_embedding_) + query_idx * vec_size;
 
                             SizeT result_n1 = 0;
-                            UniquePtr<DataType[]> d_ptr = nullptr;
+                            UniquePtr<f32[]> d_ptr = nullptr;
                             UniquePtr<SegmentOffset[]> l_ptr = nullptr;
                             if (use_bitmask) {
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteWithBitmaskFilter filter(bitmask, segment_entry, begin_ts);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, search_k, filter, with_lock);
                                 } else {
                                     BitmaskFilter<SegmentOffset> filter(bitmask);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, search_k, filter, with_lock);
                                 }
                             } else {
                                 SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
                                 if (segment_entry->CheckAnyDelete(begin_ts)) {
                                     DeleteFilter filter(segment_entry, begin_ts, max_segment_offset);
                                     std::tie(result_n1, d_ptr, l_ptr) =
-                                        abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, with_lock);
+                                        abstract_hnsw.KnnSearch(query, search_k, filter, with_lock);
                                 } else {
                                     if (!with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, false);
+                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, search_k, false);
                                     } else {
                                         AppendFilter filter(max_segment_offset);
-                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, knn_scan_shared_data->topk_, filter, true);
+                                        std::tie(result_n1, d_ptr, l_ptr) = abstract_hnsw.KnnSearch(query, search_k, filter, true);
                                     }
                                 }
                             }
 
-                            if (result_n < 0) {
-                                result_n = result_n1;
-                            } else if (result_n != (i64)result_n1) {
-                                UnrecoverableError("KnnScan: result_n mismatch");
-                            }
+                            // the filter may leave a different number of results for each query
+                            const i64 result_n = result_n1;
 
                             switch (knn_scan_shared_data->knn_distance_type_) {
                                 case KnnDistanceType::kInvalid: {
@@ -493,8 +726,19 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
                                     UnrecoverableError(
                                         fmt::format("Cannot find segment id: {}, block id: {}, index chunk is {}", segment_id, block_id, chunk_id));
                                 } // this is for debug
+                                if (raw_rerank) {
+                                    auto iter = raw_column_vectors.find(block_id);
+                                    if (iter == raw_column_vectors.end()) {
+                                        ColumnVector column_vector = block_entry->GetColumnBlockEntry(knn_column_id)->GetColumnVector(buffer_mgr);
+                                        iter = raw_column_vectors.emplace(block_id, std::move(column_vector)).first;
+                                    }
+                                    BlockOffset block_offset = l_ptr[i] % DEFAULT_BLOCK_CAPACITY;
+                                    const auto *raw_vec =
+                                        reinterpret_cast<const DataType *>(iter->second.data()) + block_offset * vec_size;
+                                    d_ptr[i] = dist_func->dist_func_(query, raw_vec, vec_size);
+                                }
                             }
-                            merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
+                            merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
                         }
                     };
 
@@ -526,64 +770,61 @@ void PhysicalKnnScan::ExecuteInternal(QueryContext *query_context, KnnScanOperat
         // all task Complete
 
         merge_heap->End();
-        i64 result_n = std::min(knn_scan_shared_data->topk_, merge_heap->total_count());
+        if constexpr (std::is_same_v<DataType, u8>) {
+            if (knn_scan_shared_data->float_rerank_column_id_.has_value()) {
+                FloatRerank(query_context->storage()->buffer_manager(), block_index, knn_scan_shared_data, merge_heap);
+            }
+        }
 
         if (!operator_state->data_block_array_.empty()) {
             UnrecoverableError("In physical_knn_scan : operator_state->data_block_array_ is not empty.");
         }
-        {
-            SizeT total_data_row_count = knn_scan_shared_data->query_count_ * result_n;
-            SizeT row_idx = 0;
-            do {
-                auto data_block = DataBlock::MakeUniquePtr();
-                data_block->Init(*GetOutputTypes());
-                operator_state->data_block_array_.emplace_back(std::move(data_block));
-                row_idx += DEFAULT_BLOCK_CAPACITY;
-            } while (row_idx < total_data_row_count);
-        }
 
-        SizeT output_block_row_id = 0;
-        SizeT output_block_idx = 0;
-        DataBlock *output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
+        // The results of every query start a new data block and take the same number of blocks, so that merge knn can
+        // tell the query of an input block from its index in the output of this task.
+        const SizeT blocks_per_query = (knn_scan_shared_data->topk_ + DEFAULT_BLOCK_CAPACITY - 1) / DEFAULT_BLOCK_CAPACITY;
+        const bool output_query_index = knn_scan_shared_data->query_count_ > 1;
+        const SizeT column_n = base_table_ref_->column_ids_.size();
+        const SizeT dist_column_idx = column_n + output_query_index;
         for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-            DataType *result_dists = merge_heap->GetDistancesByIdx(query_idx);
+            f32 *result_dists = merge_heap->GetDistancesByIdx(query_idx);
             RowID *row_ids = merge_heap->GetIDsByIdx(query_idx);
+            // more candidates than topk are kept for the float rerank
+            const SizeT result_n = std::min<SizeT>(merge_heap->GetResultCountByIdx(query_idx), knn_scan_shared_data->topk_);
+            const IntegerT query_index = query_idx;
+
+            for (SizeT block_i = 0; block_i < blocks_per_query; ++block_i) {
+                auto output_block_ptr = DataBlock::MakeUniquePtr();
+                output_block_ptr->Init(*GetOutputTypes());
+                const SizeT top_end = std::min(result_n, (block_i + 1) * DEFAULT_BLOCK_CAPACITY);
+                for (SizeT top_idx = block_i * DEFAULT_BLOCK_CAPACITY; top_idx < top_end; ++top_idx) {
+                    SegmentID segment_id = row_ids[top_idx].segment_id_;
+                    SegmentOffset segment_offset = row_ids[top_idx].segment_offset_;
+                    BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+                    BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
+
+                    BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                    if (block_entry == nullptr) {
+                        UnrecoverableError(fmt::format("Cannot find segment id: {}, block id: {}", segment_id, block_id));
+                    }
 
-            for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
-                SizeT id = query_idx * knn_scan_shared_data->query_count_ + top_idx;
-
-                SegmentID segment_id = row_ids[top_idx].segment_id_;
-                SegmentOffset segment_offset = row_ids[top_idx].segment_offset_;
-                BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-                BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-
-                BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
-                if (block_entry == nullptr) {
-                    UnrecoverableError(fmt::format("Cannot find segment id: {}, block id: {}", segment_id, block_id));
-                }
-
-                if (output_block_row_id == DEFAULT_BLOCK_CAPACITY) {
-                    output_block_ptr->Finalize();
-                    ++output_block_idx;
-                    output_block_ptr = operator_state->data_block_array_[output_block_idx].get();
-                    output_block_row_id = 0;
-                }
-
-                SizeT column_n = base_table_ref_->column_ids_.size();
-                for (SizeT i = 0; i < column_n; ++i) {
-                    SizeT column_id = base_table_ref_->column_ids_[i];
-                    auto *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
-                    ColumnVector &&column_vector = block_column_entry->GetColumnVector(query_context->storage()->buffer_manager());
+                    for (SizeT i = 0; i < column_n; ++i) {
+                        SizeT column_id = base_table_ref_->column_ids_[i];
+                        auto *block_column_entry = block_entry->GetColumnBlockEntry(column_id);
+                        ColumnVector &&column_vector = block_column_entry->GetColumnVector(query_context->storage()->buffer_manager());
 
-                    output_block_ptr->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
+                        output_block_ptr->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
+                    }
+                    if (output_query_index) {
+                        output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&query_index);
+                    }
+                    output_block_ptr->AppendValueByPtr(dist_column_idx, (ptr_t)&result_dists[top_idx]);
+                    output_block_ptr->AppendValueByPtr(dist_column_idx + 1, (ptr_t)&row_ids[top_idx]);
                 }
-                output_block_ptr->AppendValueByPtr(column_n, (ptr_t)&result_dists[id]);
-                output_block_ptr->AppendValueByPtr(column_n + 1, (ptr_t)&row_ids[id]);
-
-                ++output_block_row_id;
+                output_block_ptr->Finalize();
+                operator_state->data_block_array_.emplace_back(std::move(output_block_ptr));
             }
         }
-        output_block_ptr->Finalize();
         operator_state->SetComplete();
     }
 }
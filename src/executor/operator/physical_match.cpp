@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <chrono>
@@ -367,6 +368,8 @@ public:
         : FilterIteratorBase(common_query_filter, std::move(query_iterator)) {
         doc_freq_ = std::numeric_limits<u32>::max();
     }
+    // upper bound of the docs matching both the query and the filter, 0 if the query iterator does not know its doc_freq in advance
+    SizeT EstimateResultCount() const override { return std::min<SizeT>(query_iterator_->DocFreq(), filter_result_count_); }
     void UpdateScoreThreshold(float threshold) override { query_iterator_->UpdateScoreThreshold(threshold); }
 
     bool NextShallow(RowID doc_id) override {
@@ -546,6 +549,62 @@ struct FilterQueryNode final : public QueryNode {
     }
 };
 
+// The iterators a full text search can run.
+enum class FullTextSearchAlg : u8 {
+    kBMW,
+    kBMM,
+    kExhaustive,
+};
+
+const char *FullTextSearchAlgToString(FullTextSearchAlg alg) {
+    switch (alg) {
+        case FullTextSearchAlg::kBMW:
+            return "BMW";
+        case FullTextSearchAlg::kBMM:
+            return "BMM";
+        case FullTextSearchAlg::kExhaustive:
+            return "exhaustive";
+    }
+    return "invalid";
+}
+
+// The number of children of the widest OR in the optimized query tree.
+SizeT MaxOrWidth(const QueryNode *node) {
+    if (node == nullptr) {
+        return 0;
+    }
+    switch (node->GetType()) {
+        case QueryNodeType::FILTER: {
+            return MaxOrWidth(static_cast<const FilterQueryNode *>(node)->query_tree_.get());
+        }
+        case QueryNodeType::AND:
+        case QueryNodeType::AND_NOT:
+        case QueryNodeType::OR: {
+            const auto *multi_node = static_cast<const MultiQueryNode *>(node);
+            SizeT width = node->GetType() == QueryNodeType::OR ? multi_node->children_.size() : 0;
+            for (const auto &child : multi_node->children_) {
+                width = std::max(width, MaxOrWidth(child.get()));
+            }
+            return width;
+        }
+        default: {
+            return 0;
+        }
+    }
+}
+
+// Choose between the block-max iterators by the shape of the query. BMM only merges the essential terms of an OR and skips the others by
+// their score upper bounds, which pays off over BMW once the OR is wide. A large top-n keeps the threshold low, so that BMW pivots on
+// almost every doc, while BMM is cheaper per doc.
+FullTextSearchAlg ChooseBlockMaxAlg(const QueryNode *optimized_query_tree, u32 top_n) {
+    constexpr SizeT BMM_MIN_OR_WIDTH = 4;
+    constexpr u32 BMM_MIN_TOP_N = 1000;
+    if (MaxOrWidth(optimized_query_tree) >= BMM_MIN_OR_WIDTH or top_n >= BMM_MIN_TOP_N) {
+        return FullTextSearchAlg::kBMM;
+    }
+    return FullTextSearchAlg::kBMW;
+}
+
 void ASSERT_FLOAT_EQ(float bar, u32 i, float a, float b) {
     float diff_percent = std::abs(a - b) / std::max(std::abs(a), std::abs(b));
     if (diff_percent > bar) {
@@ -557,46 +616,112 @@ void ASSERT_FLOAT_EQ(float bar, u32 i, float a, float b) {
     }
 }
 
+// The segments searched by a task. Given doc ids in ascending order, it moves them forward to the segments of the task.
+class TaskSegmentCursor {
+public:
+    // `segment_ids` is in ascending order, nullptr for all segments.
+    explicit TaskSegmentCursor(const Vector<SegmentID> *segment_ids) : segment_ids_(segment_ids) {}
+
+    // The first doc id no less than `doc_id` in the segments of the task, INVALID_ROWID if there is none.
+    RowID Lower(RowID doc_id) {
+        if (segment_ids_ == nullptr or doc_id == INVALID_ROWID) {
+            return doc_id;
+        }
+        while (next_idx_ < segment_ids_->size() and (*segment_ids_)[next_idx_] < doc_id.segment_id_) {
+            ++next_idx_;
+        }
+        if (next_idx_ == segment_ids_->size()) {
+            return INVALID_ROWID;
+        }
+        if (const SegmentID segment_id = (*segment_ids_)[next_idx_]; segment_id != doc_id.segment_id_) {
+            return RowID(segment_id, 0);
+        }
+        return doc_id;
+    }
+
+private:
+    const Vector<SegmentID> *segment_ids_{};
+    SizeT next_idx_{};
+};
+
+// Raise the shared threshold to `threshold`.
+void PublishScoreThreshold(Atomic<float> *shared_threshold, float threshold) {
+    float current = shared_threshold->load(std::memory_order_relaxed);
+    while (threshold > current and !shared_threshold->compare_exchange_weak(current, threshold, std::memory_order_relaxed)) {
+    }
+}
+
+// Search the segments of the task, all segments if `segment_ids` is nullptr. With `shared_threshold`, the threshold of the result heap is
+// published to the other tasks, and the threshold published by them prunes this search.
 void ExecuteFTSearch(UniquePtr<EarlyTerminateIterator> &et_iter,
                      FullTextScoreResultHeap &result_heap,
                      u32 &blockmax_loop_cnt,
-                     EarlyTermAlg early_term_alg) {
+                     EarlyTermAlg early_term_alg,
+                     const Vector<SegmentID> *segment_ids = nullptr,
+                     Atomic<float> *shared_threshold = nullptr) {
     // et_iter is nullptr if fulltext index is present but there's no data
     if (et_iter == nullptr)
         return;
+    TaskSegmentCursor segment_cursor(segment_ids);
+    float applied_shared_threshold = 0.0f;
+    auto apply_shared_threshold = [&]() {
+        if (shared_threshold == nullptr) {
+            return;
+        }
+        if (const float threshold = shared_threshold->load(std::memory_order_relaxed); threshold > applied_shared_threshold) {
+            applied_shared_threshold = threshold;
+            et_iter->UpdateScoreThreshold(threshold);
+        }
+    };
+    auto add_result = [&](float et_score, RowID id) {
+        if (result_heap.AddResult(et_score, id)) {
+            // update threshold
+            if (const float new_threshold = result_heap.GetScoreThreshold(); new_threshold > 0.0f) {
+                et_iter->UpdateScoreThreshold(new_threshold);
+                if (shared_threshold != nullptr) {
+                    PublishScoreThreshold(shared_threshold, new_threshold);
+                }
+            }
+        }
+    };
     switch (early_term_alg) {
         case EarlyTermAlg::kBMM: {
-            while (true) {
-                auto [id, et_score] = et_iter->BlockNextWithThreshold(result_heap.GetScoreThreshold());
+            for (RowID target = segment_cursor.Lower(RowID(0, 0)); target != INVALID_ROWID;) {
+                apply_shared_threshold();
+                const float threshold = std::max(result_heap.GetScoreThreshold(), applied_shared_threshold);
+                auto [id, et_score] = et_iter->BlockNextWithThreshold(threshold, target);
                 if (id == INVALID_ROWID) [[unlikely]] {
                     break;
                 }
-                ++blockmax_loop_cnt;
-                if (result_heap.AddResult(et_score, id)) {
-                    // update threshold
-                    if (const float new_threshold = result_heap.GetScoreThreshold(); new_threshold > 0.0f) {
-                        et_iter->UpdateScoreThreshold(new_threshold);
-                    }
+                if (const RowID lower = segment_cursor.Lower(id); lower != id) {
+                    // not a segment of this task
+                    target = lower;
+                    continue;
                 }
+                ++blockmax_loop_cnt;
+                add_result(et_score, id);
+                target = id + 1;
             }
             break;
         }
         case EarlyTermAlg::kBMW:
         default: {
-            while (true) {
+            for (RowID target = segment_cursor.Lower(RowID(0, 0)); target != INVALID_ROWID;) {
                 ++blockmax_loop_cnt;
-                bool ok = et_iter->Next();
+                apply_shared_threshold();
+                bool ok = et_iter->Next(target);
                 if (!ok) [[unlikely]] {
                     break;
                 }
                 RowID id = et_iter->DocID();
-                float et_score = et_iter->BM25Score();
-                if (result_heap.AddResult(et_score, id)) {
-                    // update threshold
-                    if (const float new_threshold = result_heap.GetScoreThreshold(); new_threshold > 0.0f) {
-                        et_iter->UpdateScoreThreshold(new_threshold);
-                    }
+                if (const RowID lower = segment_cursor.Lower(id); lower != id) {
+                    // not a segment of this task
+                    target = lower;
+                    continue;
                 }
+                float et_score = et_iter->BM25Score();
+                add_result(et_score, id);
+                target = id + 1;
             }
         }
     }
@@ -617,24 +742,25 @@ bool PhysicalMatch::ExecuteInnerHomebrewed(QueryContext *query_context, Operator
     SearchOptions search_ops(match_expr_->options_text_);
     const String &default_field = search_ops.options_["default_field"];
     const String &block_max_option = search_ops.options_["block_max"];
-    bool use_ordinary_iter = false;
-    bool use_block_max_iter = false;
     const String &threshold = search_ops.options_["threshold"];
     const float begin_threshold = strtof(threshold.c_str(), nullptr);
-    EarlyTermAlg early_term_alg = EarlyTermAlg::kBMW;
-    if (block_max_option.empty() or block_max_option == "true" or block_max_option == "bmw") {
-        use_block_max_iter = true;
-        early_term_alg = EarlyTermAlg::kBMW;
+    // the iterator is chosen by cost unless the option names one, "compare" runs all of them and reports their statistics
+    FullTextSearchAlg search_alg = FullTextSearchAlg::kBMW;
+    bool choose_by_cost = false;
+    bool compare_algs = false;
+    if (block_max_option.empty() or block_max_option == "auto") {
+        choose_by_cost = true;
+    } else if (block_max_option == "true" or block_max_option == "bmw") {
+        search_alg = FullTextSearchAlg::kBMW;
     } else if (block_max_option == "bmm") {
-        use_block_max_iter = true;
-        early_term_alg = EarlyTermAlg::kBMM;
+        search_alg = FullTextSearchAlg::kBMM;
     } else if (block_max_option == "false") {
-        use_ordinary_iter = true;
+        search_alg = FullTextSearchAlg::kExhaustive;
     } else if (block_max_option == "compare") {
-        use_ordinary_iter = true;
-        use_block_max_iter = true;
+        choose_by_cost = true;
+        compare_algs = true;
     } else {
-        Status status = Status::SyntaxError("block_max option must be empty, true, false or compare");
+        Status status = Status::SyntaxError("block_max option must be empty, auto, true, bmw, bmm, false or compare");
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
@@ -652,55 +778,6 @@ bool PhysicalMatch::ExecuteInnerHomebrewed(QueryContext *query_context, Operator
     LOG_DEBUG(fmt::format("PhysicalMatch 1: Parse QueryNode tree time: {} ms", parse_query_tree_duration.count()));
 
     // 2 build query iterator
-    // result
-    FullTextQueryContext full_text_query_context;
-    u32 result_count = 0;
-    const float *score_result = nullptr;
-    const RowID *row_id_result = nullptr;
-    // for comparison
-    UniquePtr<EarlyTerminateIterator> et_iter;
-    UniquePtr<DocIterator> doc_iterator;
-    // run EarlyTerminateIterator again to avoid the effect of cache
-    UniquePtr<EarlyTerminateIterator> et_iter_2;
-    UniquePtr<EarlyTerminateIterator> et_iter_3;
-    u32 ordinary_loop_cnt = 0;
-    u32 blockmax_loop_cnt = 0;
-    u32 blockmax_loop_cnt_2 = 0;
-    u32 ordinary_result_count = 0;
-    u32 blockmax_result_count = 0;
-    u32 blockmax_result_count_2 = 0;
-    UniquePtr<float[]> ordinary_score_result;
-    UniquePtr<RowID[]> ordinary_row_id_result;
-    UniquePtr<float[]> blockmax_score_result;
-    UniquePtr<RowID[]> blockmax_row_id_result;
-    UniquePtr<float[]> blockmax_score_result_2;
-    UniquePtr<RowID[]> blockmax_row_id_result_2;
-    TimeDurationType ordinary_duration = {};
-    TimeDurationType blockmax_duration = {};
-    TimeDurationType blockmax_duration_2 = {};
-    TimeDurationType blockmax_duration_3 = {};
-    assert(common_query_filter_);
-    full_text_query_context.query_tree_ = MakeUnique<FilterQueryNode>(common_query_filter_.get(), std::move(query_tree));
-
-    if (use_block_max_iter) {
-        et_iter = query_builder.CreateEarlyTerminateSearch(full_text_query_context, early_term_alg);
-        // et_iter is nullptr if fulltext index is present but there's no data
-        if (et_iter != nullptr && begin_threshold > 0.0f)
-            et_iter->UpdateScoreThreshold(begin_threshold);
-    }
-    if (use_ordinary_iter) {
-        doc_iterator = query_builder.CreateSearch(full_text_query_context);
-    }
-    if (use_block_max_iter and use_ordinary_iter) {
-        et_iter_2 = query_builder.CreateEarlyTerminateSearch(full_text_query_context, early_term_alg);
-        et_iter_3 = query_builder.CreateEarlyTerminateSearch(full_text_query_context, early_term_alg);
-        if (et_iter_2 != nullptr && begin_threshold > 0.0f)
-            et_iter_2->UpdateScoreThreshold(begin_threshold);
-        if (et_iter_3 != nullptr && begin_threshold > 0.0f)
-            et_iter_3->UpdateScoreThreshold(begin_threshold);
-    }
-
-    // 3 full text search
     u32 top_n = 0;
     if (auto iter_n_option = search_ops.options_.find("topn"); iter_n_option != search_ops.options_.end()) {
         int top_n_option = std::stoi(iter_n_option->second);
@@ -713,136 +790,136 @@ bool PhysicalMatch::ExecuteInnerHomebrewed(QueryContext *query_context, Operator
     } else {
         top_n = DEFAULT_FULL_TEXT_OPTION_TOP_N;
     }
+    FullTextQueryContext full_text_query_context;
+    assert(common_query_filter_);
+    full_text_query_context.query_tree_ = MakeUnique<FilterQueryNode>(common_query_filter_.get(), std::move(query_tree));
+    full_text_query_context.optimized_query_tree_ = QueryNode::GetOptimizedQueryTree(std::move(full_text_query_context.query_tree_));
+    auto create_et_iter = [&](FullTextSearchAlg alg) {
+        const EarlyTermAlg early_term_alg = alg == FullTextSearchAlg::kBMM ? EarlyTermAlg::kBMM : EarlyTermAlg::kBMW;
+        UniquePtr<EarlyTerminateIterator> et_iter = query_builder.CreateEarlyTerminateSearch(full_text_query_context, early_term_alg);
+        // et_iter is nullptr if fulltext index is present but there's no data
+        if (et_iter != nullptr && begin_threshold > 0.0f)
+            et_iter->UpdateScoreThreshold(begin_threshold);
+        return et_iter;
+    };
+    UniquePtr<EarlyTerminateIterator> et_iter;
+    if (choose_by_cost) {
+        search_alg = ChooseBlockMaxAlg(full_text_query_context.optimized_query_tree_.get(), top_n);
+        et_iter = create_et_iter(search_alg);
+        const SizeT estimate_result_count = et_iter == nullptr ? 0 : et_iter->EstimateResultCount();
+        if (estimate_result_count > 0 and estimate_result_count <= top_n and begin_threshold <= 0.0f) {
+            // every matching doc makes the top-n, the block-max iterator would not skip any of them
+            search_alg = FullTextSearchAlg::kExhaustive;
+            et_iter.reset();
+        }
+    } else if (search_alg != FullTextSearchAlg::kExhaustive) {
+        et_iter = create_et_iter(search_alg);
+    }
     auto finish_query_builder_time = std::chrono::high_resolution_clock::now();
     TimeDurationType query_builder_duration = finish_query_builder_time - finish_parse_query_tree_time;
     LOG_DEBUG(fmt::format("PhysicalMatch Part 2: Build Query iterator time: {} ms", query_builder_duration.count()));
-    if (use_block_max_iter) {
-        blockmax_score_result = MakeUniqueForOverwrite<float[]>(top_n);
-        blockmax_row_id_result = MakeUniqueForOverwrite<RowID[]>(top_n);
-        FullTextScoreResultHeap result_heap(top_n, blockmax_score_result.get(), blockmax_row_id_result.get());
-#ifdef INFINITY_DEBUG
-        auto blockmax_begin_ts = std::chrono::high_resolution_clock::now();
-#endif
-        ExecuteFTSearch(et_iter, result_heap, blockmax_loop_cnt, early_term_alg);
-        result_heap.Sort();
-        blockmax_result_count = result_heap.GetResultSize();
-#ifdef INFINITY_DEBUG
-        auto blockmax_end_ts = std::chrono::high_resolution_clock::now();
-        blockmax_duration = blockmax_end_ts - blockmax_begin_ts;
-#endif
-    }
-    if (use_ordinary_iter) {
-        RowID iter_row_id = doc_iterator.get() == nullptr ? INVALID_ROWID : (doc_iterator->PrepareFirstDoc(), doc_iterator->Doc());
-        if (iter_row_id != INVALID_ROWID) [[likely]] {
-            ordinary_score_result = MakeUniqueForOverwrite<float[]>(top_n);
-            ordinary_row_id_result = MakeUniqueForOverwrite<RowID[]>(top_n);
-            FullTextScoreResultHeap result_heap(top_n, ordinary_score_result.get(), ordinary_row_id_result.get());
-#ifdef INFINITY_DEBUG
-            auto ordinary_begin_ts = std::chrono::high_resolution_clock::now();
-#endif
-            do {
-                ++ordinary_loop_cnt;
+
+    // 3 full text search
+    // a task of a parallel search only searches its segments
+    const Vector<SegmentID> *segment_ids = static_cast<MatchOperatorState *>(operator_state)->segment_ids_.get();
+    // search with one iterator, `alg_et_iter` is created if it is nullptr, return the result count
+    auto run_search = [&](FullTextSearchAlg alg,
+                          UniquePtr<EarlyTerminateIterator> alg_et_iter,
+                          float *alg_score_result,
+                          RowID *alg_row_id_result,
+                          u32 &loop_cnt,
+                          Atomic<float> *shared_threshold) -> u32 {
+        FullTextScoreResultHeap result_heap(top_n, alg_score_result, alg_row_id_result);
+        if (alg != FullTextSearchAlg::kExhaustive) {
+            if (alg_et_iter == nullptr) {
+                alg_et_iter = create_et_iter(alg);
+            }
+            const EarlyTermAlg early_term_alg = alg == FullTextSearchAlg::kBMM ? EarlyTermAlg::kBMM : EarlyTermAlg::kBMW;
+            ExecuteFTSearch(alg_et_iter, result_heap, loop_cnt, early_term_alg, segment_ids, shared_threshold);
+        } else {
+            UniquePtr<DocIterator> doc_iterator = query_builder.CreateSearch(full_text_query_context);
+            TaskSegmentCursor segment_cursor(segment_ids);
+            // skip the docs out of the segments of the task
+            auto seek_task_segments = [&](RowID row_id) {
+                while (row_id != INVALID_ROWID) {
+                    const RowID lower = segment_cursor.Lower(row_id);
+                    if (lower == row_id or lower == INVALID_ROWID) {
+                        return lower;
+                    }
+                    doc_iterator->Seek(lower);
+                    row_id = doc_iterator->Doc();
+                }
+                return row_id;
+            };
+            RowID iter_row_id =
+                doc_iterator.get() == nullptr ? INVALID_ROWID : (doc_iterator->PrepareFirstDoc(), seek_task_segments(doc_iterator->Doc()));
+            while (iter_row_id != INVALID_ROWID) {
+                ++loop_cnt;
                 // call scorer
                 float score = query_builder.Score(iter_row_id);
                 result_heap.AddResult(score, iter_row_id);
                 // get next row_id
-                iter_row_id = doc_iterator->Next();
-            } while (iter_row_id != INVALID_ROWID);
-            result_heap.Sort();
-            ordinary_result_count = result_heap.GetResultSize();
-#ifdef INFINITY_DEBUG
-            auto ordinary_end_ts = std::chrono::high_resolution_clock::now();
-            ordinary_duration = ordinary_end_ts - ordinary_begin_ts;
-#endif
+                iter_row_id = seek_task_segments(doc_iterator->Next());
+            }
         }
-    }
-    if (use_ordinary_iter and use_block_max_iter) {
-        blockmax_score_result_2 = MakeUniqueForOverwrite<float[]>(top_n);
-        blockmax_row_id_result_2 = MakeUniqueForOverwrite<RowID[]>(top_n);
-        FullTextScoreResultHeap result_heap(top_n, blockmax_score_result_2.get(), blockmax_row_id_result_2.get());
-#ifdef INFINITY_DEBUG
-        auto blockmax_begin_ts = std::chrono::high_resolution_clock::now();
-#endif
-        ExecuteFTSearch(et_iter_2, result_heap, blockmax_loop_cnt_2, early_term_alg);
         result_heap.Sort();
-        blockmax_result_count_2 = result_heap.GetResultSize();
+        return result_heap.GetResultSize();
+    };
+    u32 result_count = 0;
+    UniquePtr<float[]> score_result;
+    UniquePtr<RowID[]> row_id_result;
+    if (!compare_algs) {
+        score_result = MakeUniqueForOverwrite<float[]>(top_n);
+        row_id_result = MakeUniqueForOverwrite<RowID[]>(top_n);
+        // the tasks of a parallel block-max search share the threshold of the top-n
+        Atomic<float> *shared_threshold = (segment_ids != nullptr and search_alg != FullTextSearchAlg::kExhaustive) ? &score_threshold_ : nullptr;
+        u32 loop_cnt = 0;
+        result_count = run_search(search_alg, std::move(et_iter), score_result.get(), row_id_result.get(), loop_cnt, shared_threshold);
+        LOG_DEBUG(fmt::format("Full text search iterator: {}, loop count: {}", FullTextSearchAlgToString(search_alg), loop_cnt));
+    } else {
+        // profiling mode: run each iterator on its own, report their time and loop count, and output the results of the chosen one
+        et_iter.reset();
+        const FullTextSearchAlg compared_algs[] = {FullTextSearchAlg::kBMW, FullTextSearchAlg::kBMM, FullTextSearchAlg::kExhaustive};
+        Vector<UniquePtr<float[]>> compared_score_results;
+        Vector<UniquePtr<RowID[]>> compared_row_id_results;
+        Vector<u32> compared_result_counts;
+        String compare_info = fmt::format("Full text search \"{}\", chosen iterator: {}", match_expr_->matching_text_, FullTextSearchAlgToString(search_alg));
+        for (const FullTextSearchAlg alg : compared_algs) {
+            auto &alg_score_result = compared_score_results.emplace_back(MakeUniqueForOverwrite<float[]>(top_n));
+            auto &alg_row_id_result = compared_row_id_results.emplace_back(MakeUniqueForOverwrite<RowID[]>(top_n));
+            u32 loop_cnt = 0;
+            auto alg_begin_ts = std::chrono::high_resolution_clock::now();
+            const u32 alg_result_count = run_search(alg, nullptr, alg_score_result.get(), alg_row_id_result.get(), loop_cnt, nullptr);
+            TimeDurationType alg_duration = std::chrono::high_resolution_clock::now() - alg_begin_ts;
+            compared_result_counts.push_back(alg_result_count);
+            compare_info += fmt::format(", {}: {} ms, loop count {}, result count {}",
+                                        FullTextSearchAlgToString(alg),
+                                        alg_duration.count(),
+                                        loop_cnt,
+                                        alg_result_count);
+        }
+        LOG_INFO(compare_info);
+        query_context->AddProfileNote(std::move(compare_info));
 #ifdef INFINITY_DEBUG
-        auto blockmax_end_ts = std::chrono::high_resolution_clock::now();
-        blockmax_duration_2 = blockmax_end_ts - blockmax_begin_ts;
-        {
-            auto blockmax_score_result_3 = MakeUniqueForOverwrite<float[]>(top_n);
-            auto blockmax_row_id_result_3 = MakeUniqueForOverwrite<RowID[]>(top_n);
-            FullTextScoreResultHeap result_heap_3(top_n, blockmax_score_result_3.get(), blockmax_row_id_result_3.get());
-            auto blockmax_begin_ts_3 = std::chrono::high_resolution_clock::now();
-            u32 blockmax_loop_cnt_3 = 0;
-            ExecuteFTSearch(et_iter_3, result_heap_3, blockmax_loop_cnt_3, early_term_alg);
-            result_heap_3.Sort();
-            auto blockmax_end_ts_3 = std::chrono::high_resolution_clock::now();
-            if (blockmax_loop_cnt_3 != blockmax_loop_cnt_2) {
-                assert(false);
-            }
-            assert(result_heap_3.GetResultSize() == result_heap.GetResultSize());
-            for (u32 i = 0; i < top_n; ++i) {
-                assert(blockmax_score_result_2[i] == blockmax_score_result_3[i]);
-                assert(blockmax_row_id_result_2[i] == blockmax_row_id_result_3[i]);
-            }
-            blockmax_duration_3 = blockmax_end_ts_3 - blockmax_begin_ts_3;
+        for (SizeT i = 1; i < compared_result_counts.size(); ++i) {
+            if (compared_result_counts[i] != compared_result_counts[0]) {
+                Status status = Status::SyntaxError("Debug Info: result count mismatch!");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            for (u32 j = 0; j < compared_result_counts[0]; ++j) {
+                ASSERT_FLOAT_EQ(1e-4, j, compared_score_results[0][j], compared_score_results[i][j]);
+            }
         }
 #endif
-    }
-    if (use_block_max_iter) {
-        result_count = blockmax_result_count;
-        score_result = blockmax_score_result.get();
-        row_id_result = blockmax_row_id_result.get();
-    } else {
-        result_count = ordinary_result_count;
-        score_result = ordinary_score_result.get();
-        row_id_result = ordinary_row_id_result.get();
+        const SizeT chosen_idx = std::find(std::begin(compared_algs), std::end(compared_algs), search_alg) - std::begin(compared_algs);
+        result_count = compared_result_counts[chosen_idx];
+        score_result = std::move(compared_score_results[chosen_idx]);
+        row_id_result = std::move(compared_row_id_results[chosen_idx]);
     }
     auto finish_query_time = std::chrono::high_resolution_clock::now();
     TimeDurationType query_duration = finish_query_time - finish_query_builder_time;
     LOG_DEBUG(fmt::format("PhysicalMatch Part 3: Full text search time: {} ms", query_duration.count()));
-#ifdef INFINITY_DEBUG
-    {
-        OStringStream stat_info;
-        stat_info << "Full text search stat:\n";
-        if (use_block_max_iter) {
-            stat_info << "blockmax_duration: " << blockmax_duration << std::endl;
-            stat_info << "blockmax_loop_cnt: " << blockmax_loop_cnt << std::endl;
-        }
-        if (use_ordinary_iter) {
-            stat_info << "ordinary_duration: " << ordinary_duration << std::endl;
-            stat_info << "ordinary_loop_cnt: " << ordinary_loop_cnt << std::endl;
-        }
-        if (use_ordinary_iter and use_block_max_iter) {
-            stat_info << "blockmax_duration_2: " << blockmax_duration_2 << std::endl;
-            stat_info << "blockmax_duration_3: " << blockmax_duration_3 << std::endl;
-            stat_info << "blockmax_loop_cnt_2: " << blockmax_loop_cnt_2 << std::endl;
-        }
-        LOG_DEBUG(std::move(stat_info).str());
-    }
-    if (use_ordinary_iter and use_block_max_iter) {
-        OStringStream compare_info;
-        compare_info << "Compare ordinary and blockmax:\n";
-        compare_info << "duration ratio 1: " << blockmax_duration.count() / ordinary_duration.count() << std::endl;
-        compare_info << "duration ratio 2: " << blockmax_duration_2.count() / ordinary_duration.count() << std::endl;
-        compare_info << "duration ratio 3: " << blockmax_duration_3.count() / ordinary_duration.count() << std::endl;
-        compare_info << "duration ratio 2/1: " << blockmax_duration_2.count() / blockmax_duration.count() << std::endl;
-        compare_info << "duration ratio 3/2: " << blockmax_duration_3.count() / blockmax_duration_2.count() << std::endl;
-        compare_info << "loop count ratio: " << (static_cast<float>(blockmax_loop_cnt) / ordinary_loop_cnt) << std::endl;
-        LOG_DEBUG(std::move(compare_info).str());
-        if (blockmax_result_count != blockmax_result_count_2 or ordinary_result_count != blockmax_result_count or
-            blockmax_loop_cnt != blockmax_loop_cnt_2) {
-            Status status = Status::SyntaxError("Debug Info: result count mismatch!");
-            LOG_ERROR(status.message());
-            RecoverableError(status);
-        }
-        for (u32 i = 0; i < result_count; ++i) {
-            ASSERT_FLOAT_EQ(1e-4, i, ordinary_score_result[i], blockmax_score_result[i]);
-            ASSERT_FLOAT_EQ(0.0f, i, blockmax_score_result[i], blockmax_score_result_2[i]);
-        }
-    }
-#endif
     LOG_DEBUG(fmt::format("Full text search result count: {}", result_count));
     auto begin_output_time = std::chrono::high_resolution_clock::now();
     TimeDurationType output_info_duration = begin_output_time - finish_query_time;
@@ -911,6 +988,32 @@ PhysicalMatch::PhysicalMatch(u64 id,
 
 PhysicalMatch::~PhysicalMatch() = default;
 
+Vector<UniquePtr<Vector<SegmentID>>> PhysicalMatch::PlanSegments(u32 parallel_count) const {
+    // the largest segment first, each to the task with the fewest rows so far
+    Vector<Pair<SegmentOffset, SegmentID>> segments;
+    segments.reserve(base_table_ref_->block_index_->SegmentCount());
+    for (const auto &[segment_id, segment_snapshot] : base_table_ref_->block_index_->segment_block_index_) {
+        segments.emplace_back(segment_snapshot.segment_offset_, segment_id);
+    }
+    std::stable_sort(segments.begin(), segments.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+    Vector<UniquePtr<Vector<SegmentID>>> result;
+    result.reserve(parallel_count);
+    for (u32 i = 0; i < parallel_count; ++i) {
+        result.emplace_back(MakeUnique<Vector<SegmentID>>());
+    }
+    Vector<SizeT> task_row_counts(parallel_count, 0);
+    for (const auto &[row_count, segment_id] : segments) {
+        const SizeT task_id = std::min_element(task_row_counts.begin(), task_row_counts.end()) - task_row_counts.begin();
+        result[task_id]->emplace_back(segment_id);
+        task_row_counts[task_id] += row_count;
+    }
+    // a task searches its segments in the order of the doc ids
+    for (auto &segment_ids : result) {
+        std::sort(segment_ids->begin(), segment_ids->end());
+    }
+    return result;
+}
+
 void PhysicalMatch::Init() {}
 
 bool PhysicalMatch::Execute(QueryContext *query_context, OperatorState *operator_state) {
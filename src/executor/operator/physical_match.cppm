@@ -53,10 +53,11 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    // One tasklet per segment, each task searches the postings of its segments.
+    SizeT TaskletCount() override { return base_table_ref_->block_index_->SegmentCount(); }
+
+    // Assign the segments to the tasks by their row count.
+    Vector<UniquePtr<Vector<SegmentID>>> PlanSegments(u32 parallel_count) const;
 
     void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
         table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
@@ -82,6 +83,10 @@ private:
     // for filter
     SharedPtr<CommonQueryFilter> common_query_filter_;
 
+    // Score threshold of the top-k shared by the tasks. The k-th score found by any task is a lower bound of the k-th score of the table, so
+    // each task publishes the threshold of its result heap here and prunes with the highest one.
+    Atomic<float> score_threshold_{0.0f};
+
     bool ExecuteInner(QueryContext *query_context, OperatorState *operator_state);
     bool ExecuteInnerHomebrewed(QueryContext *query_context, OperatorState *operator_state);
 };
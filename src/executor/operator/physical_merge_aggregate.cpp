@@ -26,6 +26,7 @@ import data_block;
 
 import physical_aggregate;
 import aggregate_expression;
+import aggregate_hash_table;
 
 import infinity_exception;
 
@@ -42,6 +43,18 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
 
     auto merge_aggregate_op_state = static_cast<MergeAggregateOperatorState *>(operator_state);
 
+    auto agg_op = static_cast<PhysicalAggregate *>(this->left());
+    if (!agg_op->groups_.empty()) {
+        // The aggregate tasks have combined their groups into the merge table, their output blocks are empty.
+        merge_aggregate_op_state->input_data_block_.reset();
+        if (merge_aggregate_op_state->input_complete_) {
+            agg_op->merge_table()->Finalize(merge_aggregate_op_state->data_block_array_);
+            merge_aggregate_op_state->SetComplete();
+            return true;
+        }
+        return false;
+    }
+
     SimpleMergeAggregateExecute(merge_aggregate_op_state);
 
     if (merge_aggregate_op_state->input_complete_) {
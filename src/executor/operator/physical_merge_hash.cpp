@@ -14,15 +14,22 @@
 
 module;
 
+module physical_merge_hash;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_merge_hash;
+import join_hash_table;
 
 namespace infinity {
 
 void PhysicalMergeHash::Init() {}
 
-bool PhysicalMergeHash::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalMergeHash::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *merge_hash_operator_state = static_cast<MergeHashOperatorState *>(operator_state);
+    hash_table_->BuildPartitions(merge_hash_operator_state->partition_begin_, merge_hash_operator_state->partition_end_);
+    operator_state->SetComplete();
+    return true;
+}
 
 } // namespace infinity
@@ -22,6 +22,7 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import join_hash_table;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -29,11 +30,11 @@ import data_type;
 
 namespace infinity {
 
+// Builds the partitions of the hash table of a hash join once all build tasks are merged, each task a range of partitions.
 export class PhysicalMergeHash final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeHash(SharedPtr<Vector<String>> output_names, SharedPtr<Vector<SharedPtr<DataType>>> output_types, u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeHash, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+    explicit PhysicalMergeHash(u64 id, UniquePtr<PhysicalOperator> left, SharedPtr<JoinHashTable> hash_table, SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kMergeHash, std::move(left), nullptr, id, load_metas), hash_table_(std::move(hash_table)) {}
 
     ~PhysicalMergeHash() override = default;
 
@@ -41,9 +42,9 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return left_->GetOutputNames(); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return left_->GetOutputTypes(); }
 
     SizeT TaskletCount() override {
         UnrecoverableError("Not implement: TaskletCount not Implement");
@@ -51,8 +52,7 @@ public:
     }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    SharedPtr<JoinHashTable> hash_table_{};
 };
 
 } // namespace infinity
@@ -37,6 +37,7 @@ import data_block;
 import knn_expression;
 import value;
 import column_vector;
+import internal_types;
 
 namespace infinity {
 
@@ -58,7 +59,11 @@ bool PhysicalMergeKnn::Execute(QueryContext *query_context, OperatorState *opera
         case kElemInvalid: {
             UnrecoverableError("Invalid elem type");
         }
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemInt8:
+        case kElemUInt8:
+        case kElemFloat16:
+        case kElemBit: {
             switch (merge_knn_data.heap_type_) {
                 case MergeKnnHeapType::kInvalid: {
                     UnrecoverableError("Invalid heap type");
@@ -104,7 +109,13 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
     auto dists = reinterpret_cast<DataType *>(dist_column.data());
     auto row_ids = reinterpret_cast<RowID *>(row_id_column.data());
     SizeT row_n = input_data.row_count();
-    merge_knn->Search(dists, row_ids, row_n);
+    // Every query of the knn scan output starts a new data block and takes the same number of blocks
+    const SizeT blocks_per_query = (merge_knn_data.topk_ + DEFAULT_BLOCK_CAPACITY - 1) / DEFAULT_BLOCK_CAPACITY;
+    const SizeT query_idx = merge_knn_state->input_data_idx_ / blocks_per_query;
+    if (query_idx >= (SizeT)merge_knn_data.query_count_) {
+        UnrecoverableError("Input data block exceeds the query count");
+    }
+    merge_knn->Search(query_idx, dists, row_ids, row_n);
 
     if (merge_knn_state->input_complete_) {
         merge_knn->End(); // reorder the heap
@@ -113,11 +124,13 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
         BlockIndex *block_index = merge_knn_data.table_ref_->block_index_.get();
 
         u64 output_row_count{0};
-        i64 result_n = std::min(merge_knn_data.topk_, merge_knn->total_count());
+        const bool output_query_index = merge_knn_data.query_count_ > 1;
         for (i64 query_idx = 0; query_idx < merge_knn_data.query_count_; ++query_idx) {
             DataType *result_dists = merge_knn->GetDistancesByIdx(query_idx);
             RowID *result_row_ids = merge_knn->GetIDsByIdx(query_idx);
-            for (i64 top_idx = 0; top_idx < result_n; ++top_idx) {
+            const SizeT result_n = merge_knn->GetResultCountByIdx(query_idx);
+            const IntegerT query_index = query_idx;
+            for (SizeT top_idx = 0; top_idx < result_n; ++top_idx) {
                 u32 segment_id = result_row_ids[top_idx].segment_id_;
                 u32 segment_offset = result_row_ids[top_idx].segment_offset_;
                 u16 block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
@@ -144,8 +157,11 @@ void PhysicalMergeKnn::ExecuteInner(QueryContext *query_context, MergeKnnOperato
                     ColumnVector &&column_vector = block_entry->GetColumnBlockEntry(column_id)->GetColumnVector(buffer_mgr);
                     output_data_block->column_vectors[i]->AppendWith(column_vector, block_offset, 1);
                 }
-                output_data_block->AppendValueByPtr(column_n, (ptr_t)&result_dists[top_idx]);
-                output_data_block->AppendValueByPtr(column_n + 1, (ptr_t)&result_row_ids[top_idx]);
+                if (output_query_index) {
+                    output_data_block->AppendValueByPtr(column_n, (ptr_t)&query_index);
+                }
+                output_data_block->AppendValueByPtr(column_n + output_query_index, (ptr_t)&result_dists[top_idx]);
+                output_data_block->AppendValueByPtr(column_n + output_query_index + 1, (ptr_t)&result_row_ids[top_idx]);
                 ++output_row_count;
             }
             // for (SizeT i = 0; i < column_n; ++i) {
@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstdlib>
+
+module physical_merge_match;
+
+import stl;
+import query_context;
+import physical_operator_type;
+import operator_state;
+import logger;
+import infinity_exception;
+import default_values;
+import data_block;
+import match_expression;
+import search_options;
+
+namespace infinity {
+
+PhysicalMergeMatch::PhysicalMergeMatch(const u64 id,
+                                       UniquePtr<PhysicalOperator> left,
+                                       const u64 table_index,
+                                       SharedPtr<BaseTableRef> base_table_ref,
+                                       SharedPtr<MatchExpression> match_expr,
+                                       SharedPtr<Vector<LoadMeta>> load_metas)
+    : PhysicalOperator(PhysicalOperatorType::kMergeMatch, std::move(left), nullptr, id, load_metas), table_index_(table_index),
+      base_table_ref_(std::move(base_table_ref)), match_expr_(std::move(match_expr)) {}
+
+void PhysicalMergeMatch::Init() {
+    left()->Init();
+    // an invalid topn is reported by PhysicalMatch
+    topn_ = DEFAULT_FULL_TEXT_OPTION_TOP_N;
+    SearchOptions search_ops(match_expr_->options_text_);
+    if (auto iter_n_option = search_ops.options_.find("topn"); iter_n_option != search_ops.options_.end()) {
+        if (int top_n_option = std::atoi(iter_n_option->second.c_str()); top_n_option > 0) {
+            topn_ = top_n_option;
+        }
+    }
+}
+
+SizeT PhysicalMergeMatch::TaskletCount() {
+    UnrecoverableError("Not Expected: TaskletCount of PhysicalMergeMatch?");
+    return 0;
+}
+
+bool PhysicalMergeMatch::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *merge_match_op_state = static_cast<MergeMatchOperatorState *>(operator_state);
+    if (merge_match_op_state->input_complete_) {
+        LOG_TRACE("PhysicalMergeMatch::Input is complete");
+    }
+    ExecuteInner(query_context, merge_match_op_state);
+    return true;
+}
+
+void PhysicalMergeMatch::ExecuteInner(QueryContext *query_context, MergeMatchOperatorState *operator_state) const {
+    auto &output_data_block_array = operator_state->data_block_array_;
+    if (!output_data_block_array.empty()) {
+        UnrecoverableError("output data_block_array_ is not empty");
+    }
+    auto &input_data_block_array = operator_state->input_data_blocks_;
+    if (input_data_block_array.empty()) {
+        UnrecoverableError("PhysicalMergeMatch: empty input");
+        return;
+    }
+    const auto output_type_ptr = GetOutputTypes();
+    const u32 score_column_idx = output_type_ptr->size() - 2;
+    auto &middle_data_block_array = operator_state->middle_sorted_data_blocks_;
+    auto &middle_result_count = operator_state->middle_result_count_;
+    // both the middle result and the input are sorted by score in descending order
+    struct Cursor {
+        const Vector<UniquePtr<DataBlock>> *blocks_{};
+        SizeT block_idx_{};
+        SizeT row_idx_{};
+
+        bool Valid() const { return block_idx_ < blocks_->size() and row_idx_ < (*blocks_)[block_idx_]->row_count(); }
+        DataBlock *Block() const { return (*blocks_)[block_idx_].get(); }
+        void Advance() {
+            if (++row_idx_ == (*blocks_)[block_idx_]->row_count()) {
+                ++block_idx_;
+                row_idx_ = 0;
+            }
+        }
+    };
+    auto skip_empty_blocks = [](Cursor &cursor) {
+        while (cursor.block_idx_ < cursor.blocks_->size() and (*cursor.blocks_)[cursor.block_idx_]->row_count() == 0) {
+            ++cursor.block_idx_;
+        }
+    };
+    auto score_of = [&](const Cursor &cursor) {
+        return reinterpret_cast<const float *>(cursor.Block()->column_vectors[score_column_idx]->data())[cursor.row_idx_];
+    };
+    Cursor middle{&middle_data_block_array}, input{&input_data_block_array};
+    skip_empty_blocks(middle);
+    skip_empty_blocks(input);
+    // merge sort by score, and keep topn
+    Vector<UniquePtr<DataBlock>> new_middle_data_block_array;
+    u32 new_result_count = 0;
+    while (new_result_count < topn_ and (middle.Valid() or input.Valid())) {
+        Cursor &chosen = (!input.Valid() or (middle.Valid() and score_of(middle) >= score_of(input))) ? middle : input;
+        if (new_result_count % DEFAULT_BLOCK_CAPACITY == 0) {
+            if (!new_middle_data_block_array.empty()) {
+                new_middle_data_block_array.back()->Finalize();
+            }
+            auto data_block = DataBlock::MakeUniquePtr();
+            data_block->Init(*output_type_ptr);
+            new_middle_data_block_array.push_back(std::move(data_block));
+        }
+        new_middle_data_block_array.back()->AppendWith(chosen.Block(), chosen.row_idx_, 1);
+        ++new_result_count;
+        chosen.Advance();
+        skip_empty_blocks(chosen);
+    }
+    if (!new_middle_data_block_array.empty()) {
+        new_middle_data_block_array.back()->Finalize();
+    }
+    middle_data_block_array = std::move(new_middle_data_block_array);
+    middle_result_count = new_result_count;
+    input_data_block_array.clear();
+    if (operator_state->input_complete_) {
+        output_data_block_array = std::move(middle_data_block_array);
+        if (output_data_block_array.empty()) {
+            // provide an empty data block
+            auto data_block = DataBlock::MakeUniquePtr();
+            data_block->Init(*output_type_ptr);
+            data_block->Finalize();
+            output_data_block_array.push_back(std::move(data_block));
+        }
+        operator_state->SetComplete();
+    }
+}
+
+} // namespace infinity
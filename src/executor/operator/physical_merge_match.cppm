@@ -0,0 +1,76 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module physical_merge_match;
+
+import stl;
+import query_context;
+import operator_state;
+import physical_operator;
+import table_entry;
+import match_expression;
+import base_table_ref;
+import data_type;
+
+namespace infinity {
+struct LoadMeta;
+
+// Merges the top-k results of the tasks of a parallel full text search into the top-k of the table.
+export class PhysicalMergeMatch final : public PhysicalOperator {
+public:
+    PhysicalMergeMatch(u64 id,
+                       UniquePtr<PhysicalOperator> left,
+                       u64 table_index,
+                       SharedPtr<BaseTableRef> base_table_ref,
+                       SharedPtr<MatchExpression> match_expr,
+                       SharedPtr<Vector<LoadMeta>> load_metas);
+
+    void Init() override;
+
+    bool Execute(QueryContext *query_context, OperatorState *operator_state) override;
+
+    SharedPtr<Vector<String>> GetOutputNames() const override { return left()->GetOutputNames(); }
+
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const override { return left()->GetOutputTypes(); }
+
+    SizeT TaskletCount() override;
+
+    void FillingTableRefs(HashMap<SizeT, SharedPtr<BaseTableRef>> &table_refs) override {
+        table_refs.insert({base_table_ref_->table_index_, base_table_ref_});
+    }
+
+    [[nodiscard]] inline String TableAlias() const { return base_table_ref_->alias_; }
+
+    [[nodiscard]] inline TableEntry *table_collection_ptr() const { return base_table_ref_->table_entry_ptr_; }
+
+    [[nodiscard]] inline u64 table_index() const { return table_index_; }
+
+    [[nodiscard]] inline MatchExpression *match_expr() const { return match_expr_.get(); }
+
+    [[nodiscard]] inline u32 GetTopN() const { return topn_; }
+
+private:
+    u64 table_index_ = 0;
+    SharedPtr<BaseTableRef> base_table_ref_;
+    SharedPtr<MatchExpression> match_expr_;
+    // the topn option of the match expression
+    // inited by Init()
+    u32 topn_ = 0;
+
+    void ExecuteInner(QueryContext *query_context, MergeMatchOperatorState *operator_state) const;
+};
+
+} // namespace infinity
@@ -14,15 +14,29 @@
 
 module;
 
+module physical_merge_parallel_aggregate;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_merge_parallel_aggregate;
+import aggregate_hash_table;
+import physical_parallel_aggregate;
 
 namespace infinity {
 
 void PhysicalMergeParallelAggregate::Init() {}
 
-bool PhysicalMergeParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalMergeParallelAggregate::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *merge_operator_state = static_cast<MergeParallelAggregateOperatorState *>(operator_state);
+    const auto *parallel_aggregate = static_cast<const PhysicalParallelAggregate *>(left_.get());
+
+    UniquePtr<AggregateHashTable> hash_table = parallel_aggregate->MakeHashTable();
+    for (const auto &partial_table : partial_tables_->tables()) {
+        hash_table->CombinePartitions(*partial_table, merge_operator_state->partition_begin_, merge_operator_state->partition_end_);
+    }
+    hash_table->Finalize(merge_operator_state->data_block_array_);
+    operator_state->SetComplete();
+    return true;
+}
 
 } // namespace infinity
@@ -22,6 +22,7 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import aggregate_hash_table;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -29,14 +30,16 @@ import data_type;
 
 namespace infinity {
 
+// Second phase of a parallel group-by aggregate: once all tables of the parallel aggregate are collected, each task combines the groups
+// of a range of partitions of them and outputs these groups.
 export class PhysicalMergeParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeParallelAggregate(SharedPtr<Vector<String>> output_names,
-                                            SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                            u64 id,
+    explicit PhysicalMergeParallelAggregate(u64 id,
+                                            UniquePtr<PhysicalOperator> left,
+                                            SharedPtr<PartialAggregateTables> partial_tables,
                                             SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, std::move(left), nullptr, id, load_metas),
+          partial_tables_(std::move(partial_tables)) {}
 
     ~PhysicalMergeParallelAggregate() override = default;
 
@@ -44,9 +47,9 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return left_->GetOutputNames(); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return left_->GetOutputTypes(); }
 
     SizeT TaskletCount() override {
         UnrecoverableError("Not implement: TaskletCount not Implement");
@@ -54,8 +57,7 @@ public:
     }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    SharedPtr<PartialAggregateTables> partial_tables_{};
 };
 
 } // namespace infinity
@@ -14,15 +14,29 @@
 
 module;
 
+module physical_merge_sort;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_merge_sort;
+import external_sort;
+import default_values;
 
 namespace infinity {
 
-void PhysicalMergeSort::Init() {}
+void PhysicalMergeSort::Init() { left_->Init(); }
 
-bool PhysicalMergeSort::Execute(QueryContext *query_context, OperatorState *operator_state) { return true; }
+bool PhysicalMergeSort::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *merge_sort_operator_state = static_cast<MergeSortOperatorState *>(operator_state);
+    if (merge_sort_operator_state->merger_.get() == nullptr) {
+        merge_sort_operator_state->merger_ = MakeUnique<SortRunMerger>(sort_runs_->Take());
+    }
+    // The task runs again until all runs are merged, a few blocks at a time.
+    if (MergeSortRuns(*merge_sort_operator_state->merger_, merge_sort_operator_state->data_block_array_, SORT_MERGE_BLOCK_COUNT)) {
+        merge_sort_operator_state->merger_.reset();
+        merge_sort_operator_state->SetComplete();
+    }
+    return true;
+}
 
 } // namespace infinity
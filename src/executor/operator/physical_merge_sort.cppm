@@ -26,17 +26,15 @@ import load_meta;
 import infinity_exception;
 import internal_types;
 import data_type;
+import external_sort;
 
 namespace infinity {
 
+// Merges the sorted runs of all tasks of the sort once they are all collected, one block of each run is loaded at a time.
 export class PhysicalMergeSort final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeSort(SharedPtr<Vector<String>> output_names,
-                               SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                               u64 id,
-                               SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeSort, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+    explicit PhysicalMergeSort(u64 id, UniquePtr<PhysicalOperator> left, SharedPtr<SortRuns> sort_runs, SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kMergeSort, std::move(left), nullptr, id, load_metas), sort_runs_(std::move(sort_runs)) {}
 
     ~PhysicalMergeSort() override = default;
 
@@ -44,9 +42,9 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    inline SharedPtr<Vector<String>> GetOutputNames() const final { return left_->GetOutputNames(); }
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return left_->GetOutputTypes(); }
 
     SizeT TaskletCount() override {
         UnrecoverableError("Not implement: TaskletCount not Implement");
@@ -54,8 +52,7 @@ public:
     }
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    SharedPtr<SortRuns> sort_runs_{};
 };
 
 } // namespace infinity
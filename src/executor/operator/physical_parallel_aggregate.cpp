@@ -14,15 +14,57 @@
 
 module;
 
+module physical_parallel_aggregate;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_parallel_aggregate;
+import aggregate_hash_table;
+import data_type;
 
 namespace infinity {
 
 void PhysicalParallelAggregate::Init() {}
 
-bool PhysicalParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalParallelAggregate::Execute(QueryContext *, OperatorState *operator_state) {
+    OperatorState *prev_op_state = operator_state->prev_op_state_;
+    auto *parallel_aggregate_operator_state = static_cast<ParallelAggregateOperatorState *>(operator_state);
+
+    AggregateHashTable *hash_table = parallel_aggregate_operator_state->hash_table_.get();
+    for (const auto &input_block : prev_op_state->data_block_array_) {
+        hash_table->Aggregate(groups_, aggregates_, input_block.get());
+    }
+    prev_op_state->data_block_array_.clear();
+    if (prev_op_state->Complete()) {
+        hash_table->BuildPartitionIndex();
+        partial_tables_->Add(std::move(parallel_aggregate_operator_state->hash_table_));
+        operator_state->SetComplete();
+    }
+    return true;
+}
+
+SharedPtr<Vector<String>> PhysicalParallelAggregate::GetOutputNames() const {
+    SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &group_expr : groups_) {
+        result->emplace_back(group_expr->Name());
+    }
+    for (const auto &aggregate_expr : aggregates_) {
+        result->emplace_back(aggregate_expr->Name());
+    }
+    return result;
+}
+
+SharedPtr<Vector<SharedPtr<DataType>>> PhysicalParallelAggregate::GetOutputTypes() const {
+    SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &group_expr : groups_) {
+        result->emplace_back(MakeShared<DataType>(group_expr->Type()));
+    }
+    for (const auto &aggregate_expr : aggregates_) {
+        result->emplace_back(MakeShared<DataType>(aggregate_expr->Type()));
+    }
+    return result;
+}
 
 } // namespace infinity
@@ -22,6 +22,7 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import aggregate_hash_table;
 import base_expression;
 import load_meta;
 import infinity_exception;
@@ -30,14 +31,21 @@ import data_type;
 
 namespace infinity {
 
+// First phase of a parallel group-by aggregate: each task aggregates its blocks into a table of its own, then hands the table over to
+// the merge parallel aggregate.
 export class PhysicalParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalParallelAggregate(SharedPtr<Vector<String>> output_names,
-                                       SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                       u64 id,
+    explicit PhysicalParallelAggregate(u64 id,
+                                       UniquePtr<PhysicalOperator> left,
+                                       Vector<SharedPtr<BaseExpression>> groups,
+                                       u64 groupby_index,
+                                       Vector<SharedPtr<BaseExpression>> aggregates,
+                                       u64 aggregate_index,
+                                       SharedPtr<PartialAggregateTables> partial_tables,
                                        SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, std::move(left), nullptr, id, load_metas), groups_(std::move(groups)),
+          aggregates_(std::move(aggregates)), groupby_index_(groupby_index), aggregate_index_(aggregate_index),
+          partial_tables_(std::move(partial_tables)) {}
 
     ~PhysicalParallelAggregate() override = default;
 
@@ -45,18 +53,25 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    SharedPtr<Vector<String>> GetOutputNames() const final;
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        UnrecoverableError("Not implement: TaskletCount not Implement");
-        return 0;
-    }
+    SizeT TaskletCount() override { return left_->TaskletCount(); }
+
+    inline UniquePtr<AggregateHashTable> MakeHashTable() const { return AggregateHashTable::Make(groups_, aggregates_); }
+
+    inline u64 GroupTableIndex() const { return groupby_index_; }
+
+    inline u64 AggregateTableIndex() const { return aggregate_index_; }
+
+    Vector<SharedPtr<BaseExpression>> groups_{};
+    Vector<SharedPtr<BaseExpression>> aggregates_{};
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    u64 groupby_index_{};
+    u64 aggregate_index_{};
+    SharedPtr<PartialAggregateTables> partial_tables_{};
 };
 
 } // namespace infinity
@@ -50,6 +50,7 @@ import status;
 import local_file_system;
 import utility;
 import buffer_manager;
+import file_worker;
 import session_manager;
 import compilation_config;
 import logical_type;
@@ -63,9 +64,28 @@ import catalog;
 import txn_manager;
 import wal_manager;
 import logger;
+import task_scheduler;
+import task_priority;
 
 namespace infinity {
 
+namespace {
+
+TaskPriorityClass GlobalVariableToPriorityClass(GlobalVariable global_var) {
+    switch (global_var) {
+        case GlobalVariable::kInteractiveTaskQueue:
+            return TaskPriorityClass::kInteractive;
+        case GlobalVariable::kNormalTaskQueue:
+            return TaskPriorityClass::kNormal;
+        case GlobalVariable::kBackgroundTaskQueue:
+            return TaskPriorityClass::kBackground;
+        default:
+            return TaskPriorityClass::kInvalid;
+    }
+}
+
+} // namespace
+
 void PhysicalShow::Init() {
     auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
     auto bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
@@ -354,6 +374,19 @@ void PhysicalShow::Init() {
             output_types_->emplace_back(varchar_type);
             break;
         }
+        case ShowType::kShowBuffer: {
+            output_names_->reserve(4);
+            output_types_->reserve(4);
+            output_names_->emplace_back("type");
+            output_names_->emplace_back("hit");
+            output_names_->emplace_back("miss");
+            output_names_->emplace_back("eviction");
+            output_types_->emplace_back(varchar_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            output_types_->emplace_back(bigint_type);
+            break;
+        }
         default: {
             Status status = Status::NotSupport("Not implemented show type");
             LOG_ERROR(status.message());
@@ -447,6 +480,10 @@ bool PhysicalShow::Execute(QueryContext *query_context, OperatorState *operator_
             ExecuteShowConfig(query_context, show_operator_state);
             break;
         }
+        case ShowType::kShowBuffer: {
+            ExecuteShowBuffer(query_context, show_operator_state);
+            break;
+        }
         default: {
             UnrecoverableError("Invalid chunk scan type");
         }
@@ -2242,6 +2279,69 @@ void PhysicalShow::ExecuteShowConfigs(QueryContext *query_context, ShowOperatorS
         }
     }
 
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(HNSW_BUILD_THREAD_NUM_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->HnswBuildThreadNum()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Thread number of building a hnsw index");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(SCRUB_INTERVAL_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->ScrubInterval()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("File checksum scrub period interval");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
+    {
+        {
+            // option name
+            Value value = Value::MakeVarchar(SCRUB_IO_RATE_LIMIT_OPTION_NAME);
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar(std::to_string(global_config->ScrubIORateLimit()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+        }
+        {
+            // option name type
+            Value value = Value::MakeVarchar("Bytes read per second by the file checksum scrub");
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+        }
+    }
+
     {
         {
             // option name
@@ -2705,6 +2805,25 @@ void PhysicalShow::ExecuteShowSessionVariable(QueryContext *query_context, ShowO
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
         }
+        case SessionVariable::kQueryPriority: {
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                varchar_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+
+            Value value = Value::MakeVarchar(TaskPriorityClassToString(session_ptr->SessionVariables()->query_priority_));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
         default: {
             operator_state->status_ = Status::NoSysVar(object_name_);
             LOG_ERROR(operator_state->status_.message());
@@ -2851,6 +2970,27 @@ void PhysicalShow::ExecuteShowSessionVariables(QueryContext *query_context, Show
                 }
                 break;
             }
+            case SessionVariable::kQueryPriority: {
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    Value value = Value::MakeVarchar(TaskPriorityClassToString(session_ptr->SessionVariables()->query_priority_));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("Scheduling class of the queries in this session: auto, interactive, normal or background");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
             default: {
                 operator_state->status_ = Status::NoSysVar(var_name);
                 LOG_ERROR(operator_state->status_.message());
@@ -2947,7 +3087,7 @@ void PhysicalShow::ExecuteShowGlobalVariable(QueryContext *query_context, ShowOp
 
             output_block_ptr->Init(output_column_types);
 
-            Value value = Value::MakeVarchar("round robin");
+            Value value = Value::MakeVarchar("work stealing, weighted priority classes");
             ValueExpression value_expr(value);
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
@@ -3152,6 +3292,29 @@ void PhysicalShow::ExecuteShowGlobalVariable(QueryContext *query_context, ShowOp
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
         }
+        case GlobalVariable::kInteractiveTaskQueue:
+        case GlobalVariable::kNormalTaskQueue:
+        case GlobalVariable::kBackgroundTaskQueue: {
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                varchar_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+
+            TaskPriorityClass priority_class = GlobalVariableToPriorityClass(global_var);
+            PriorityClassStatistics statistics = query_context->scheduler()->GetPriorityClassStatistics(priority_class);
+            Value value = Value::MakeVarchar(statistics.ToString());
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
         default: {
             operator_state->status_ = Status::NoSysVar(object_name_);
             LOG_ERROR(operator_state->status_.message());
@@ -3267,7 +3430,7 @@ void PhysicalShow::ExecuteShowGlobalVariables(QueryContext *query_context, ShowO
                 }
                 {
                     // option value
-                    Value value = Value::MakeVarchar("round robin");
+                    Value value = Value::MakeVarchar("work stealing, weighted priority classes");
                     ValueExpression value_expr(value);
                     value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
                 }
@@ -3499,6 +3662,31 @@ void PhysicalShow::ExecuteShowGlobalVariables(QueryContext *query_context, ShowO
                 }
                 break;
             }
+            case GlobalVariable::kInteractiveTaskQueue:
+            case GlobalVariable::kNormalTaskQueue:
+            case GlobalVariable::kBackgroundTaskQueue: {
+                TaskPriorityClass priority_class = GlobalVariableToPriorityClass(global_var_enum);
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    PriorityClassStatistics statistics = query_context->scheduler()->GetPriorityClassStatistics(priority_class);
+                    Value value = Value::MakeVarchar(statistics.ToString());
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar(fmt::format("Queue depth and wait time of {} tasks", TaskPriorityClassToString(priority_class)));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
             default: {
                 operator_state->status_ = Status::NoSysVar(var_name);
                 LOG_ERROR(operator_state->status_.message());
@@ -3796,4 +3984,31 @@ void PhysicalShow::ExecuteShowConfig(QueryContext *query_context, ShowOperatorSt
 //    show_operator_state->output_.emplace_back(std::move(output_block_ptr));
 //}
 
+void PhysicalShow::ExecuteShowBuffer(QueryContext *query_context, ShowOperatorState *show_operator_state) {
+    auto varchar_type = MakeShared<DataType>(LogicalType::kVarchar);
+    auto bigint_type = MakeShared<DataType>(LogicalType::kBigInt);
+
+    UniquePtr<DataBlock> output_block_ptr = DataBlock::MakeUniquePtr();
+    Vector<SharedPtr<DataType>> column_types{varchar_type, bigint_type, bigint_type, bigint_type};
+    output_block_ptr->Init(column_types);
+
+    BufferManager *buffer_manager = query_context->storage()->buffer_manager();
+    for (const auto &statistics : buffer_manager->GetBufferStatistics()) {
+        ValueExpression type_expr(Value::MakeVarchar(FileWorkerTypeToString(statistics.type_)));
+        type_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+
+        ValueExpression hit_expr(Value::MakeBigInt(statistics.hit_count_));
+        hit_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+
+        ValueExpression miss_expr(Value::MakeBigInt(statistics.miss_count_));
+        miss_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+
+        ValueExpression evict_expr(Value::MakeBigInt(statistics.evict_count_));
+        evict_expr.AppendToChunk(output_block_ptr->column_vectors[3]);
+    }
+
+    output_block_ptr->Finalize();
+    show_operator_state->output_.emplace_back(std::move(output_block_ptr));
+}
+
 } // namespace infinity
@@ -116,6 +116,8 @@ private:
 
     void ExecuteShowConfig(QueryContext *query_context, ShowOperatorState *operator_state);
 
+    void ExecuteShowBuffer(QueryContext *query_context, ShowOperatorState *operator_state);
+
 private:
     ShowType scan_type_{ShowType::kInvalid};
     String db_name_{};
@@ -399,6 +399,16 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(MessageSinkState *message_
             message_sink_state->message_ = MakeUnique<String>("Tmp for test");
             break;
         }
+        case PhysicalOperatorType::kHash:
+        case PhysicalOperatorType::kMergeHash: {
+            // The hash table reaches the hash join through the operators, there is nothing to pass on.
+            break;
+        }
+        case PhysicalOperatorType::kParallelAggregate:
+        case PhysicalOperatorType::kSort: {
+            // Likewise the partial hash tables and the sorted runs reach their merge operators through the operators.
+            break;
+        }
         default: {
             RecoverableError(
                 Status::NotSupport(fmt::format("{} isn't supported here.", PhysicalOperatorToString(task_operator_state->operator_type_))));
@@ -28,10 +28,11 @@ import data_table;
 import data_block;
 import load_meta;
 import infinity_exception;
-import physical_top;
 import internal_types;
 import select_statement;
 import data_type;
+import external_sort;
+import default_values;
 
 namespace infinity {
 
@@ -41,9 +42,11 @@ public:
                           UniquePtr<PhysicalOperator> left,
                           Vector<SharedPtr<BaseExpression>> expressions,
                           Vector<OrderType> order_by_types,
-                          SharedPtr<Vector<LoadMeta>> load_metas)
+                          SharedPtr<Vector<LoadMeta>> load_metas,
+                          SharedPtr<SortRuns> sort_runs = nullptr)
         : PhysicalOperator(PhysicalOperatorType::kSort, std::move(left), nullptr, id, load_metas), expressions_(std::move(expressions)),
-          order_by_types_(std::move(order_by_types)) {}
+          order_by_types_(std::move(order_by_types)), sort_runs_(std::move(sort_runs)),
+          memory_budget_(MakeShared<SortMemoryBudget>(SORT_RUN_MEMORY_BUDGET)) {}
 
     ~PhysicalSort() override = default;
 
@@ -60,12 +63,16 @@ public:
     // for OperatorState
     inline auto const &GetSortExpressions() const { return expressions_; }
 
+    // Where the tasks hand over their sorted runs to the merge sort, nullptr if the sort merges its runs itself.
+    inline const SharedPtr<SortRuns> &sort_runs() const { return sort_runs_; }
+
     Vector<SharedPtr<BaseExpression>> expressions_;
     Vector<OrderType> order_by_types_{};
 
 private:
-    u64 input_table_index_{};
-    CompareTwoRowAndPreferLeft prefer_left_function_; // compare function
+    SharedPtr<SortRuns> sort_runs_{};
+    // Shared by the tasks of the sort.
+    SharedPtr<SortMemoryBudget> memory_budget_{};
 };
 
 } // namespace infinity
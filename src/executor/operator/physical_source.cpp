@@ -55,7 +55,8 @@ bool PhysicalSource::Execute(QueryContext *, SourceState *source_state) {
         }
         case SourceStateType::kQueue: {
             QueueSourceState *queue_source_state = static_cast<QueueSourceState *>(source_state);
-            return queue_source_state->GetData();
+            queue_source_state->complete_ = queue_source_state->GetData();
+            return queue_source_state->complete_;
         }
         default: {
             Status status = Status::NotSupport("Not support source state type");
@@ -42,9 +42,34 @@ import infinity_exception;
 import logical_type;
 
 import block_entry;
+import block_column_entry;
+import buffer_manager;
+import buffer_obj;
+import bitmask;
+import column_encoding;
 
 namespace infinity {
 
+namespace {
+
+// Evaluate the filters on the encoded columns of the block. Return the rows they leave, or null if none of the columns is
+// encoded.
+SharedPtr<Bitmask> FilterEncodedColumns(const Vector<EncodedColumnFilter> &filters, BlockEntry *block_entry, BufferManager *buffer_mgr) {
+    if (filters.empty()) {
+        return nullptr;
+    }
+    SharedPtr<Bitmask> selected_rows = Bitmask::Make(block_entry->row_capacity());
+    bool filtered = false;
+    for (const auto &filter : filters) {
+        if (block_entry->GetColumnBlockEntry(filter.column_id_)->FilterEncoded(buffer_mgr, filter, *selected_rows)) {
+            filtered = true;
+        }
+    }
+    return filtered ? selected_rows : nullptr;
+}
+
+} // namespace
+
 void PhysicalTableScan::Init() {}
 
 bool PhysicalTableScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -177,6 +202,21 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                                       block_ids_idx,
                                       block_ids->size()));
             }
+
+            // read ahead the files of the next blocks while this one is being scanned
+            Vector<BufferObj *> readahead_buffers;
+            for (SizeT i = block_ids_idx + 1; i < block_ids->size() && i <= block_ids_idx + DEFAULT_READAHEAD_BLOCK_COUNT; ++i) {
+                BlockEntry *next_block_entry = block_index->GetBlockEntry(block_ids->at(i).segment_id_, block_ids->at(i).block_id_);
+                for (auto column_id : column_ids) {
+                    if (column_id != COLUMN_IDENTIFIER_ROW_ID) {
+                        readahead_buffers.push_back(next_block_entry->GetColumnBlockEntry(column_id)->buffer());
+                    }
+                }
+            }
+            query_context->storage()->buffer_manager()->Readahead(readahead_buffers);
+
+            table_scan_function_data_ptr->selected_rows_ =
+                FilterEncodedColumns(encoded_column_filters_, current_block_entry, query_context->storage()->buffer_manager());
         }
         auto [row_begin, row_end] = current_block_entry->GetVisibleRange(begin_ts, read_offset);
         if (row_begin == row_end) {
@@ -189,6 +229,21 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
             // output is full
             break;
         }
+        if (const Bitmask *selected_rows = table_scan_function_data_ptr->selected_rows_.get(); selected_rows != nullptr) {
+            // skip the rows ruled out by the encoded column filters, and read up to the next one
+            while (row_begin < row_end && !selected_rows->IsTrue(row_begin)) {
+                ++row_begin;
+            }
+            if (row_begin == row_end) {
+                read_offset = row_end;
+                continue;
+            }
+            BlockOffset selected_end = row_begin + 1;
+            while (selected_end < row_end && selected_rows->IsTrue(selected_end)) {
+                ++selected_end;
+            }
+            row_end = selected_end;
+        }
         auto write_size = std::min(write_capacity, SizeT(row_end - row_begin));
 
         read_offset = row_begin;
@@ -212,6 +267,7 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
     LOG_TRACE(fmt::format("TableScan: block_ids_idx: {}, block_ids.size(): {}", block_ids_idx, block_ids->size()));
 
     if (block_ids_idx >= block_ids->size()) {
+        query_context->storage()->buffer_manager()->FinishReadahead();
         table_scan_operator_state->SetComplete();
     }
 
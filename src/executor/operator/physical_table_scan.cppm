@@ -31,6 +31,7 @@ import load_meta;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import column_encoding;
 
 namespace infinity {
 
@@ -40,9 +41,11 @@ public:
                                SharedPtr<BaseTableRef> base_table_ref,
                                UniquePtr<FastRoughFilterEvaluator> &&fast_rough_filter_evaluator,
                                SharedPtr<Vector<LoadMeta>> load_metas,
-                               bool add_row_id = false)
+                               bool add_row_id = false,
+                               Vector<EncodedColumnFilter> encoded_column_filters = {})
         : PhysicalOperator(PhysicalOperatorType::kTableScan, nullptr, nullptr, id, load_metas), base_table_ref_(std::move(base_table_ref)),
-          fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)), add_row_id_(add_row_id) {}
+          fast_rough_filter_evaluator_(std::move(fast_rough_filter_evaluator)), encoded_column_filters_(std::move(encoded_column_filters)),
+          add_row_id_(add_row_id) {}
 
     ~PhysicalTableScan() override = default;
 
@@ -86,6 +89,10 @@ private:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
+    // Comparisons from the filter above the scan, which skip the rows they rule out in blocks whose columns are encoded.
+    // The filter still evaluates all the rows left.
+    Vector<EncodedColumnFilter> encoded_column_filters_{};
+
     bool add_row_id_;
     mutable Vector<SizeT> column_ids_;
 };
@@ -86,6 +86,7 @@ bool QueueSourceState::GetData() {
             auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             MergeKnnOperatorState *merge_knn_op_state = (MergeKnnOperatorState *)next_op_state;
             merge_knn_op_state->input_data_block_ = std::move(fragment_data->data_block_);
+            merge_knn_op_state->input_data_idx_ = fragment_data->data_idx_.value_or(0);
             merge_knn_op_state->input_complete_ = completed;
             break;
         }
@@ -96,6 +97,13 @@ bool QueueSourceState::GetData() {
             merge_match_tensor_op_state->input_complete_ = completed;
             break;
         }
+        case PhysicalOperatorType::kMergeMatch: {
+            auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+            MergeMatchOperatorState *merge_match_op_state = (MergeMatchOperatorState *)next_op_state;
+            merge_match_op_state->input_data_blocks_.push_back(std::move(fragment_data->data_block_));
+            merge_match_op_state->input_complete_ = completed;
+            break;
+        }
         case PhysicalOperatorType::kFusion: {
             auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
             FusionOperatorState *fusion_op_state = (FusionOperatorState *)next_op_state;
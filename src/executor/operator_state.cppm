@@ -36,6 +36,9 @@ import internal_types;
 import column_def;
 import data_type;
 import segment_entry;
+import join_hash_table;
+import aggregate_hash_table;
+import external_sort;
 
 namespace infinity {
 
@@ -70,6 +73,8 @@ export struct AggregateOperatorState : public OperatorState {
         : OperatorState(PhysicalOperatorType::kAggregate), states_(std::move(states)) {}
 
     Vector<UniquePtr<char[]>> states_;
+    // The groups of the task if there is a group by.
+    UniquePtr<AggregateHashTable> hash_table_{};
 };
 
 // Merge Aggregate
@@ -84,12 +89,18 @@ export struct MergeAggregateOperatorState : public OperatorState {
 
 // Merge Parallel Aggregate
 export struct MergeParallelAggregateOperatorState : public OperatorState {
-    inline explicit MergeParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kMergeParallelAggregate) {}
+    inline explicit MergeParallelAggregateOperatorState(SizeT partition_begin, SizeT partition_end)
+        : OperatorState(PhysicalOperatorType::kMergeParallelAggregate), partition_begin_(partition_begin), partition_end_(partition_end) {}
+
+    SizeT partition_begin_{};
+    SizeT partition_end_{};
 };
 
 // Parallel Aggregate
 export struct ParallelAggregateOperatorState : public OperatorState {
     inline explicit ParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kParallelAggregate) {}
+
+    UniquePtr<AggregateHashTable> hash_table_{};
 };
 
 // UnionAll
@@ -134,6 +145,7 @@ export struct MergeKnnOperatorState : public OperatorState {
     inline explicit MergeKnnOperatorState() : OperatorState(PhysicalOperatorType::kMergeKnn) {}
 
     UniquePtr<DataBlock> input_data_block_{nullptr}; // Since merge knn is the first op, no previous operator state. This ptr is to get input data.
+    SizeT input_data_idx_{0};                        // Index of the input block in the output of the knn scan task
     bool input_complete_{false};
     SharedPtr<MergeKnnFunctionData> merge_knn_function_data_{};
 };
@@ -154,16 +166,26 @@ export struct IndexScanOperatorState : public OperatorState {
 // Hash
 export struct HashOperatorState : public OperatorState {
     inline explicit HashOperatorState() : OperatorState(PhysicalOperatorType::kHash) {}
+
+    Vector<SharedPtr<ExpressionState>> key_states_{};
+    JoinHashBuildLocal local_{};
 };
 
 // Merge Hash
 export struct MergeHashOperatorState : public OperatorState {
-    inline explicit MergeHashOperatorState() : OperatorState(PhysicalOperatorType::kMergeHash) {}
+    inline explicit MergeHashOperatorState(SizeT partition_begin, SizeT partition_end)
+        : OperatorState(PhysicalOperatorType::kMergeHash), partition_begin_(partition_begin), partition_end_(partition_end) {}
+
+    SizeT partition_begin_{};
+    SizeT partition_end_{};
 };
 
 // Hash Join
 export struct HashJoinOperatorState : public OperatorState {
     inline explicit HashJoinOperatorState() : OperatorState(PhysicalOperatorType::kJoinHash) {}
+
+    Vector<SharedPtr<ExpressionState>> key_states_{};
+    Vector<SharedPtr<ExpressionState>> condition_states_{};
 };
 
 // Nested Loop
@@ -224,12 +246,14 @@ export struct ProjectionOperatorState : public OperatorState {
 export struct SortOperatorState : public OperatorState {
     inline explicit SortOperatorState() : OperatorState(PhysicalOperatorType::kSort) {}
     Vector<SharedPtr<ExpressionState>> expr_states_; // expression states
-    Vector<UniquePtr<DataBlock>> unmerge_sorted_blocks_{};
+    UniquePtr<SortRunBuilder> run_builder_{};
+    UniquePtr<SortRunMerger> merger_{};
 };
 
 // Merge Sort
 export struct MergeSortOperatorState : public OperatorState {
     inline explicit MergeSortOperatorState() : OperatorState(PhysicalOperatorType::kMergeSort) {}
+    UniquePtr<SortRunMerger> merger_{};
 };
 
 // Delete
@@ -367,6 +391,18 @@ export struct OptimizeOperatorState : public OperatorState {
 // Match
 export struct MatchOperatorState : public OperatorState {
     inline explicit MatchOperatorState() : OperatorState(PhysicalOperatorType::kMatch) {}
+
+    UniquePtr<Vector<SegmentID>> segment_ids_{}; // segments searched by this task, nullptr for all segments
+};
+
+// MergeMatch
+export struct MergeMatchOperatorState : public OperatorState {
+    inline explicit MergeMatchOperatorState() : OperatorState(PhysicalOperatorType::kMergeMatch) {}
+
+    Vector<UniquePtr<DataBlock>> middle_sorted_data_blocks_; // middle result
+    u32 middle_result_count_{};
+    Vector<UniquePtr<DataBlock>> input_data_blocks_;
+    bool input_complete_{false};
 };
 
 // Fusion
@@ -135,6 +135,8 @@ String PhysicalOperatorToString(PhysicalOperatorType type) {
             return "CompactFinish";
         case PhysicalOperatorType::kMatch:
             return "Match";
+        case PhysicalOperatorType::kMergeMatch:
+            return "MergeMatch";
         case PhysicalOperatorType::kMatchTensorScan:
             return "MatchTensorScan";
         case PhysicalOperatorType::kMergeMatchTensor:
@@ -42,6 +42,7 @@ export enum class PhysicalOperatorType : i8 {
     kMatchTensorScan,
     kMergeMatchTensor,
     kMatch,
+    kMergeMatch,
     kFusion,
 
     kHash,
@@ -57,6 +57,7 @@ import physical_merge_parallel_aggregate;
 import physical_merge_sort;
 import physical_merge_top;
 import physical_merge_match_tensor;
+import physical_merge_match;
 import physical_nested_loop_join;
 import physical_parallel_aggregate;
 import physical_prepared_plan;
@@ -126,6 +127,16 @@ import logical_fusion;
 
 import value;
 import value_expression;
+import base_expression;
+import reference_expression;
+import cast_expression;
+import function_expression;
+import expression_type;
+import join_hash_table;
+import aggregate_hash_table;
+import external_sort;
+import default_values;
+import join_reference;
 import explain_physical_plan;
 import third_party;
 import status;
@@ -569,6 +580,23 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
 
     SizeT tasklet_count = input_physical_operator->TaskletCount();
 
+    if (!logical_aggregate->groups_.empty() && tasklet_count >= PARALLEL_AGGREGATE_MIN_BLOCK_COUNT) {
+        // Two phases: each task aggregates its blocks into a table of its own, then the tables are merged one range of partitions per task.
+        auto partial_tables = MakeShared<PartialAggregateTables>();
+        auto physical_parallel_agg_op = MakeUnique<PhysicalParallelAggregate>(logical_aggregate->node_id(),
+                                                                              std::move(input_physical_operator),
+                                                                              logical_aggregate->groups_,
+                                                                              logical_aggregate->groupby_index_,
+                                                                              logical_aggregate->aggregates_,
+                                                                              logical_aggregate->aggregate_index_,
+                                                                              partial_tables,
+                                                                              logical_operator->load_metas());
+        return MakeUnique<PhysicalMergeParallelAggregate>(query_context_ptr_->GetNextNodeID(),
+                                                          std::move(physical_parallel_agg_op),
+                                                          std::move(partial_tables),
+                                                          MakeShared<Vector<LoadMeta>>());
+    }
+
     auto physical_agg_op = MakeUnique<PhysicalAggregate>(logical_aggregate->node_id(),
                                                          std::move(input_physical_operator),
                                                          logical_aggregate->groups_,
@@ -580,6 +608,9 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     if (tasklet_count == 1) {
         return physical_agg_op;
     } else {
+        if (!physical_agg_op->groups_.empty()) {
+            physical_agg_op->SetMergeTable(physical_agg_op->MakeHashTable());
+        }
         return MakeUnique<PhysicalMergeAggregate>(query_context_ptr_->GetNextNodeID(),
                                                   logical_aggregate->base_table_ref_,
                                                   std::move(physical_agg_op),
@@ -589,6 +620,81 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     }
 }
 
+namespace {
+
+// The inputs of a join an expression reads: bit 0 for the left input, bit 1 for the right one.
+u8 JoinInputsOf(const SharedPtr<BaseExpression> &expr, SizeT left_column_count) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            auto *reference_expr = static_cast<ReferenceExpression *>(expr.get());
+            return reference_expr->column_index() < left_column_count ? 1 : 2;
+        }
+        case ExpressionType::kCast:
+        case ExpressionType::kFunction: {
+            u8 inputs = 0;
+            for (const auto &argument : expr->arguments()) {
+                inputs |= JoinInputsOf(argument, left_column_count);
+            }
+            return inputs;
+        }
+        case ExpressionType::kValue: {
+            return 0;
+        }
+        default: {
+            // Not known to be a key, it stays a condition of the join.
+            return 3;
+        }
+    }
+}
+
+// Copy an expression on the right input of a join with its columns relative to the right input.
+SharedPtr<BaseExpression> RebaseJoinKey(const SharedPtr<BaseExpression> &expr, SizeT left_column_count) {
+    switch (expr->type()) {
+        case ExpressionType::kReference: {
+            auto reference_expr = static_pointer_cast<ReferenceExpression>(expr);
+            return ReferenceExpression::Make(reference_expr->Type(),
+                                             reference_expr->table_name(),
+                                             reference_expr->column_name(),
+                                             reference_expr->alias_,
+                                             reference_expr->column_index() - left_column_count);
+        }
+        case ExpressionType::kCast: {
+            auto cast_expr = static_pointer_cast<CastExpression>(expr);
+            return MakeShared<CastExpression>(cast_expr->func_, RebaseJoinKey(cast_expr->arguments()[0], left_column_count), cast_expr->Type());
+        }
+        case ExpressionType::kFunction: {
+            auto function_expr = static_pointer_cast<FunctionExpression>(expr);
+            Vector<SharedPtr<BaseExpression>> arguments;
+            for (const auto &argument : function_expr->arguments()) {
+                arguments.emplace_back(RebaseJoinKey(argument, left_column_count));
+            }
+            return MakeShared<FunctionExpression>(function_expr->func_, std::move(arguments));
+        }
+        default: {
+            return expr;
+        }
+    }
+}
+
+// Whether the operator streams the rows of a scan, so that each task of its fragment can sort its own rows.
+bool StreamsScan(PhysicalOperator *op) {
+    switch (op->operator_type()) {
+        case PhysicalOperatorType::kTableScan:
+        case PhysicalOperatorType::kIndexScan: {
+            return true;
+        }
+        case PhysicalOperatorType::kFilter:
+        case PhysicalOperatorType::kProjection: {
+            return op->left() != nullptr && StreamsScan(op->left());
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNode> &logical_operator) const {
 
     auto left_node = logical_operator->left_node();
@@ -602,6 +708,42 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNo
     }
 
     SharedPtr<LogicalJoin> logical_join = static_pointer_cast<LogicalJoin>(logical_operator);
+    if (logical_join->join_type_ != JoinType::kInner && logical_join->join_type_ != JoinType::kLeft) {
+        Status status = Status::NotSupport(fmt::format("{} join isn't supported.", JoinReference::ToString(logical_join->join_type_)));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
+    // Split the conditions into the key equalities of the hash table and the rest, which are checked on the matched rows.
+    SizeT left_column_count = left_node->GetColumnBindings().size();
+    Vector<SharedPtr<BaseExpression>> probe_keys;
+    Vector<SharedPtr<BaseExpression>> build_keys;
+    Vector<SharedPtr<BaseExpression>> conditions;
+    for (const auto &condition : logical_join->conditions_) {
+        if (condition->type() == ExpressionType::kFunction && static_cast<FunctionExpression *>(condition.get())->ScalarFunctionName() == "=") {
+            auto &arguments = condition->arguments();
+            u8 first_inputs = JoinInputsOf(arguments[0], left_column_count);
+            u8 second_inputs = JoinInputsOf(arguments[1], left_column_count);
+            if (arguments[0]->Type() == arguments[1]->Type() && IsJoinKeyType(arguments[0]->Type().type())) {
+                if (first_inputs == 1 && second_inputs == 2) {
+                    probe_keys.emplace_back(arguments[0]);
+                    build_keys.emplace_back(RebaseJoinKey(arguments[1], left_column_count));
+                    continue;
+                }
+                if (first_inputs == 2 && second_inputs == 1) {
+                    probe_keys.emplace_back(arguments[1]);
+                    build_keys.emplace_back(RebaseJoinKey(arguments[0], left_column_count));
+                    continue;
+                }
+            }
+        }
+        conditions.emplace_back(condition);
+    }
+    if (probe_keys.empty()) {
+        Status status = Status::NotSupport("Join without an equality condition between both sides isn't supported.");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
 
     UniquePtr<PhysicalOperator> left_physical_operator{};
     UniquePtr<PhysicalOperator> right_physical_operator{};
@@ -609,12 +751,25 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNo
     left_physical_operator = BuildPhysicalOperator(left_node);
     right_physical_operator = BuildPhysicalOperator(right_node);
 
-    return MakeUnique<PhysicalNestedLoopJoin>(logical_operator->node_id(),
-                                              logical_join->join_type_,
-                                              logical_join->conditions_,
-                                              std::move(left_physical_operator),
-                                              std::move(right_physical_operator),
-                                              logical_operator->load_metas());
+    // The right input is built into the hash table, the left input is streamed through it.
+    auto hash_table = MakeShared<JoinHashTable>();
+    auto physical_hash = MakeUnique<PhysicalHash>(query_context_ptr_->GetNextNodeID(),
+                                                  std::move(right_physical_operator),
+                                                  build_keys,
+                                                  hash_table,
+                                                  MakeShared<Vector<LoadMeta>>());
+    auto physical_merge_hash =
+        MakeUnique<PhysicalMergeHash>(query_context_ptr_->GetNextNodeID(), std::move(physical_hash), hash_table, MakeShared<Vector<LoadMeta>>());
+
+    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(),
+                                        logical_join->join_type_,
+                                        std::move(probe_keys),
+                                        std::move(build_keys),
+                                        std::move(conditions),
+                                        std::move(hash_table),
+                                        std::move(left_physical_operator),
+                                        std::move(physical_merge_hash),
+                                        logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildCrossProduct(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -657,11 +812,25 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildSort(const SharedPtr<LogicalNo
 
     SharedPtr<LogicalSort> logical_sort = static_pointer_cast<LogicalSort>(logical_operator);
 
-    return MakeUnique<PhysicalSort>(logical_operator->node_id(),
-                                    std::move(input_physical_operator),
-                                    logical_sort->expressions_,
-                                    logical_sort->order_by_types_,
-                                    logical_operator->load_metas());
+    if (!StreamsScan(input_physical_operator.get()) || input_physical_operator->TaskletCount() <= 1) {
+        return MakeUnique<PhysicalSort>(logical_operator->node_id(),
+                                        std::move(input_physical_operator),
+                                        logical_sort->expressions_,
+                                        logical_sort->order_by_types_,
+                                        logical_operator->load_metas());
+    }
+    // Each task sorts its blocks into runs, then the runs of all tasks are merged.
+    auto sort_runs = MakeShared<SortRuns>();
+    auto physical_sort_op = MakeUnique<PhysicalSort>(logical_operator->node_id(),
+                                                     std::move(input_physical_operator),
+                                                     logical_sort->expressions_,
+                                                     logical_sort->order_by_types_,
+                                                     logical_operator->load_metas(),
+                                                     sort_runs);
+    return MakeUnique<PhysicalMergeSort>(query_context_ptr_->GetNextNodeID(),
+                                         std::move(physical_sort_op),
+                                         std::move(sort_runs),
+                                         MakeShared<Vector<LoadMeta>>());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildLimit(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -798,7 +967,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildFilter(const SharedPtr<Logical
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIntersect(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalIntersect>(logical_operator->GetOutputNames(),
+                                         logical_operator->GetOutputTypes(),
+                                         logical_operator->node_id(),
+                                         logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildUnion(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -806,7 +978,10 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildUnion(const SharedPtr<LogicalN
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildExcept(const SharedPtr<LogicalNode> &logical_operator) const {
-    return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(), logical_operator->load_metas());
+    return MakeUnique<PhysicalExcept>(logical_operator->GetOutputNames(),
+                                      logical_operator->GetOutputTypes(),
+                                      logical_operator->node_id(),
+                                      logical_operator->load_metas());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildShow(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -829,7 +1004,8 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildTableScan(const SharedPtr<Logi
                                          logical_table_scan->base_table_ref_,
                                          std::move(logical_table_scan->fast_rough_filter_evaluator_),
                                          logical_operator->load_metas(),
-                                         logical_table_scan->add_row_id_);
+                                         logical_table_scan->add_row_id_,
+                                         std::move(logical_table_scan->encoded_column_filters_));
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildIndexScan(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -871,12 +1047,22 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildOptimize(const SharedPtr<Logic
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatch(const SharedPtr<LogicalNode> &logical_operator) const {
     SharedPtr<LogicalMatch> logical_match = static_pointer_cast<LogicalMatch>(logical_operator);
-    return MakeUnique<PhysicalMatch>(logical_match->node_id(),
-                                     logical_match->base_table_ref_,
-                                     logical_match->match_expr_,
-                                     logical_match->common_query_filter_,
-                                     logical_match->TableIndex(),
-                                     logical_operator->load_metas());
+    auto match_op = MakeUnique<PhysicalMatch>(logical_match->node_id(),
+                                              logical_match->base_table_ref_,
+                                              logical_match->match_expr_,
+                                              logical_match->common_query_filter_,
+                                              logical_match->TableIndex(),
+                                              logical_operator->load_metas());
+    if (match_op->TaskletCount() <= 1) {
+        return match_op;
+    }
+    // the segments are searched in parallel, the top-k of the tasks are merged
+    return MakeUnique<PhysicalMergeMatch>(query_context_ptr_->GetNextNodeID(),
+                                          std::move(match_op),
+                                          logical_match->TableIndex(),
+                                          logical_match->base_table_ref_,
+                                          logical_match->match_expr_,
+                                          MakeShared<Vector<LoadMeta>>());
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildMatchTensorScan(const SharedPtr<LogicalNode> &logical_operator) const {
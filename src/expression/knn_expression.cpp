@@ -50,14 +50,16 @@ String KnnExpression::KnnDistanceType2Str(KnnDistanceType type) {
 
 KnnExpression::KnnExpression(EmbeddingDataType embedding_data_type,
                              i64 dimension,
+                             i64 query_count,
                              KnnDistanceType knn_distance_type,
                              EmbeddingT query_embedding,
+                             UniquePtr<f32[]> float_query_embedding,
                              Vector<SharedPtr<BaseExpression>> arguments,
                              i64 topn,
                              Vector<InitParameter *> *opt_params)
-    : BaseExpression(ExpressionType::kKnn, std::move(arguments)), dimension_(dimension), embedding_data_type_(embedding_data_type),
-      distance_type_(knn_distance_type), query_embedding_(std::move(query_embedding)),
-      topn_(topn) // Should call move constructor, otherwise there will be memory leak.
+    : BaseExpression(ExpressionType::kKnn, std::move(arguments)), dimension_(dimension), query_count_(query_count),
+      embedding_data_type_(embedding_data_type), distance_type_(knn_distance_type), query_embedding_(std::move(query_embedding)),
+      float_query_embedding_(std::move(float_query_embedding)), topn_(topn) // Should call move constructor, otherwise there will be memory leak.
 {
     if (opt_params) {
         for (auto &param : *opt_params) {
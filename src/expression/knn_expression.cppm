@@ -33,8 +33,10 @@ public:
 public:
     KnnExpression(EmbeddingDataType embedding_data_type,
                   i64 dimension,
+                  i64 query_count,
                   KnnDistanceType knn_distance_type,
                   EmbeddingT query_embedding,
+                  UniquePtr<f32[]> float_query_embedding,
                   Vector<SharedPtr<BaseExpression>> arguments,
                   i64 topn,
                   Vector<InitParameter *> *opt_params);
@@ -45,9 +47,14 @@ public:
 
 public:
     const i64 dimension_{0};
+    // query_embedding_ holds query_count_ vectors of dimension_ elements
+    const i64 query_count_{1};
     const EmbeddingDataType embedding_data_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType distance_type_{KnnDistanceType::kInvalid};
     const EmbeddingT query_embedding_;
+    // A float query of a hamming search on a bit column, query_embedding_ holds its sign bits. The float rerank compares the candidates
+    // with it. Null when the query is given as bits.
+    const UniquePtr<f32[]> float_query_embedding_;
     const i64 topn_;
     Vector<InitParameter> opt_params_;
 };
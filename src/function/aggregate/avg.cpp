@@ -52,6 +52,12 @@ public:
         RecoverableError(status);
     }
 
+    inline void Combine(const AvgState &) {
+        Status status = Status::NotSupport("Combine average state.");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
     inline ptr_t Finalize() {
         Status status = Status::NotSupport("Finalize average state.");
         LOG_ERROR(status.message());
@@ -90,6 +96,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     [[nodiscard]] inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -124,6 +135,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -158,6 +174,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -192,6 +213,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -226,6 +252,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
@@ -260,6 +291,11 @@ public:
         value_ += (input[idx] * count);
     }
 
+    inline void Combine(const AvgState &other) {
+        this->count_ += other.count_;
+        value_ += other.value_;
+    }
+
     inline ptr_t Finalize() {
         result_ = value_ / count_;
         return (ptr_t)&result_;
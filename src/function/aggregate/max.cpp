@@ -41,6 +41,8 @@ public:
 
     inline void ConstantUpdate(const ValueType *__restrict, SizeT, SizeT) { UnrecoverableError("Not implement: Max::ConstantUpdate"); }
 
+    inline void Combine(const MaxState &) { UnrecoverableError("Not implement: Max::Combine"); }
+
     [[nodiscard]] ptr_t Finalize() const { UnrecoverableError("Not implement: Max::Finalize"); }
 
     inline static SizeT Size(const DataType &) { UnrecoverableError("Not implement: Max::Size"); }
@@ -57,6 +59,8 @@ public:
 
     inline void ConstantUpdate(const BooleanT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(BooleanT); }
@@ -73,6 +77,8 @@ public:
 
     inline void ConstantUpdate(const TinyIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(TinyIntT); }
@@ -89,6 +95,8 @@ public:
 
     inline void ConstantUpdate(const SmallIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(SmallIntT); }
@@ -105,6 +113,8 @@ public:
 
     inline void ConstantUpdate(const IntegerT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(IntegerT); }
@@ -121,6 +131,8 @@ public:
 
     inline void ConstantUpdate(const BigIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(BigIntT); }
@@ -140,6 +152,8 @@ public:
 
     inline void ConstantUpdate(const HugeIntT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(HugeIntT); }
@@ -156,6 +170,8 @@ public:
 
     inline void ConstantUpdate(const FloatT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(FloatT); }
@@ -172,6 +188,8 @@ public:
 
     inline void ConstantUpdate(const DoubleT *__restrict input, SizeT idx, SizeT) { value_ = value_ < input[idx] ? input[idx] : value_; }
 
+    inline void Combine(const MaxState &other) { Update(&other.value_, 0); }
+
     inline ptr_t Finalize() { return (ptr_t)&value_; }
 
     inline static SizeT Size(const DataType &) { return sizeof(DoubleT); }
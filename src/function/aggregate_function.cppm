@@ -14,6 +14,7 @@
 
 module;
 
+#include <new>
 #include <type_traits>
 
 export module aggregate_function;
@@ -33,15 +34,29 @@ namespace infinity {
 
 using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
+// Update the state of each row, the state of row i is at `states[i] + state_offset`.
+using AggregateScatterUpdateFuncType = std::function<void(const ptr_t *, SizeT, SizeT, const SharedPtr<ColumnVector> &)>;
+// Combine the second state into the first one.
+using AggregateCombineFuncType = std::function<void(ptr_t, const_ptr_t)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
+// Release the memory owned by a state, empty if the state owns none.
+using AggregateDestroyFuncType = std::function<void(ptr_t)>;
 
 class AggregateOperation {
 public:
     template <typename AggregateState>
     static inline void StateInitialize(const ptr_t state) {
+        if constexpr (!std::is_trivially_destructible_v<AggregateState>) {
+            new (state) AggregateState();
+        }
         ((AggregateState *)state)->Initialize();
     }
 
+    template <typename AggregateState>
+    static inline void StateDestroy(const ptr_t state) {
+        ((AggregateState *)state)->~AggregateState();
+    }
+
     template <typename AggregateState, typename InputType>
     static inline void StateUpdate(const ptr_t state, const SharedPtr<ColumnVector> &input_column_vector) {
         // Loop execute state update according to the input column vector
@@ -93,6 +108,62 @@ public:
         }
     }
 
+    template <typename AggregateState, typename InputType>
+    static inline void
+    StateScatterUpdate(const ptr_t *states, SizeT state_offset, SizeT row_count, const SharedPtr<ColumnVector> &input_column_vector) {
+        switch (input_column_vector->vector_type()) {
+            case ColumnVectorType::kCompactBit: {
+                if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                    UnrecoverableError("kCompactBit column vector only support Boolean type");
+                } else {
+                    BooleanT value;
+                    const VectorBuffer *buffer = input_column_vector->buffer_.get();
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        value = buffer->GetCompactBit(idx);
+                        ((AggregateState *)(states[idx] + state_offset))->Update(&value, 0);
+                    }
+                }
+                break;
+            }
+            case ColumnVectorType::kFlat: {
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)(states[idx] + state_offset))->Update(input_ptr, idx);
+                }
+                break;
+            }
+            case ColumnVectorType::kConstant: {
+                if (input_column_vector->data_type()->type() == LogicalType::kBoolean) {
+                    if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                        UnrecoverableError("types do not match");
+                    } else {
+                        BooleanT value = input_column_vector->buffer_->GetCompactBit(0);
+                        for (SizeT idx = 0; idx < row_count; ++idx) {
+                            ((AggregateState *)(states[idx] + state_offset))->Update(&value, 0);
+                        }
+                    }
+                    break;
+                }
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)(states[idx] + state_offset))->Update(input_ptr, 0);
+                }
+                break;
+            }
+            case ColumnVectorType::kHeterogeneous: {
+                UnrecoverableError("Not implement: Heterogeneous type");
+            }
+            default: {
+                UnrecoverableError("Not implement: Other type");
+            }
+        }
+    }
+
+    template <typename AggregateState>
+    static inline void StateCombine(const ptr_t state, const_ptr_t other_state) {
+        ((AggregateState *)state)->Combine(*(const AggregateState *)other_state);
+    }
+
     template <typename AggregateState, typename ResultType>
     static inline ptr_t StateFinalize(const ptr_t state) {
         // Loop execute state update according to the input column vector
@@ -109,9 +180,14 @@ public:
                                SizeT state_size,
                                AggregateInitializeFuncType init_func,
                                AggregateUpdateFuncType update_func,
-                               AggregateFinalizeFuncType finalize_func)
+                               AggregateScatterUpdateFuncType scatter_update_func,
+                               AggregateCombineFuncType combine_func,
+                               AggregateFinalizeFuncType finalize_func,
+                               AggregateDestroyFuncType destroy_func = nullptr)
         : Function(std::move(name), FunctionType::kAggregate), init_func_(std::move(init_func)), update_func_(std::move(update_func)),
-          finalize_func_(std::move(finalize_func)), argument_type_(std::move(argument_type)), return_type_(std::move(return_type)),
+          scatter_update_func_(std::move(scatter_update_func)), combine_func_(std::move(combine_func)), finalize_func_(std::move(finalize_func)),
+          destroy_func_(std::move(destroy_func)),
+          argument_type_(std::move(argument_type)), return_type_(std::move(return_type)),
           state_size_(state_size) {}
 
     void CastArgumentTypes(BaseExpression &input_argument);
@@ -127,7 +203,10 @@ public:
 public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
+    AggregateScatterUpdateFuncType scatter_update_func_;
+    AggregateCombineFuncType combine_func_;
     AggregateFinalizeFuncType finalize_func_;
+    AggregateDestroyFuncType destroy_func_;
 
     DataType argument_type_;
     DataType return_type_;
@@ -143,7 +222,11 @@ inline AggregateFunction UnaryAggregate(const String &name, const DataType &inpu
                              AggregateState::Size(input_type),
                              AggregateOperation::StateInitialize<AggregateState>,
                              AggregateOperation::StateUpdate<AggregateState, InputType>,
-                             AggregateOperation::StateFinalize<AggregateState, ResultType>);
+                             AggregateOperation::StateScatterUpdate<AggregateState, InputType>,
+                             AggregateOperation::StateCombine<AggregateState>,
+                             AggregateOperation::StateFinalize<AggregateState, ResultType>,
+                             std::is_trivially_destructible_v<AggregateState> ? AggregateDestroyFuncType()
+                                                                             : AggregateDestroyFuncType(AggregateOperation::StateDestroy<AggregateState>));
 }
 
 } // namespace infinity
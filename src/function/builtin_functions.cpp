@@ -123,6 +123,10 @@ void BuiltinFunctions::RegisterSpecialFunction() {
 
     SharedPtr<SpecialFunction> delete_ts_function = MakeShared<SpecialFunction>("SCORE", DataType(LogicalType::kFloat), 3, SpecialType::kScore);
     Catalog::AddSpecialFunction(catalog_ptr_.get(), delete_ts_function);
+
+    SharedPtr<SpecialFunction> query_index_function =
+        MakeShared<SpecialFunction>("QUERY_INDEX", DataType(LogicalType::kInteger), 4, SpecialType::kQueryIndex);
+    Catalog::AddSpecialFunction(catalog_ptr_.get(), query_index_function);
 }
 
 } // namespace infinity
@@ -82,6 +82,12 @@ export inline BoundCastFunc BindEmbeddingCast(const DataType &source, const Data
         case EmbeddingDataType::kElemDouble: {
             return BindEmbeddingCast<DoubleT>(target_info);
         }
+        case EmbeddingDataType::kElemUInt8: {
+            return BindEmbeddingCast<UInt8T>(target_info);
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            return BindEmbeddingCast<Float16T>(target_info);
+        }
         default: {
             UnrecoverableError(fmt::format("Can't cast from {} to Embedding type", target.ToString()));
         }
@@ -113,6 +119,12 @@ inline BoundCastFunc BindEmbeddingCast(const EmbeddingInfo *target) {
         case EmbeddingDataType::kElemDouble: {
             return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, DoubleT, EmbeddingTryCastToFixlen>);
         }
+        case EmbeddingDataType::kElemUInt8: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, UInt8T, EmbeddingTryCastToFixlen>);
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            return BoundCastFunc(&ColumnVectorCast::TryCastColumnVectorEmbedding<SourceElemType, Float16T, EmbeddingTryCastToFixlen>);
+        }
         default: {
             UnrecoverableError(fmt::format("Can't cast from Embedding type to {}", target->ToString()));
         }
@@ -126,7 +138,8 @@ struct EmbeddingTryCastToFixlen {
         if constexpr (std::is_same_v<TargetElemType, bool>) {
             if constexpr (!(std::is_same_v<SourceElemType, TinyIntT> || std::is_same_v<SourceElemType, SmallIntT> ||
                             std::is_same_v<SourceElemType, IntegerT> || std::is_same_v<SourceElemType, BigIntT> ||
-                            std::is_same_v<SourceElemType, FloatT> || std::is_same_v<SourceElemType, DoubleT>)) {
+                            std::is_same_v<SourceElemType, FloatT> || std::is_same_v<SourceElemType, DoubleT> ||
+                            std::is_same_v<SourceElemType, UInt8T>)) {
                 UnrecoverableError(fmt::format("Not support to cast from {} to {}",
                                                DataType::TypeToString<SourceElemType>(),
                                                DataType::TypeToString<TargetElemType>()));
@@ -142,7 +155,8 @@ struct EmbeddingTryCastToFixlen {
         } else if constexpr (std::is_same_v<SourceElemType, bool>) {
             if constexpr (!(std::is_same_v<TargetElemType, TinyIntT> || std::is_same_v<TargetElemType, SmallIntT> ||
                             std::is_same_v<TargetElemType, IntegerT> || std::is_same_v<TargetElemType, BigIntT> ||
-                            std::is_same_v<TargetElemType, FloatT> || std::is_same_v<TargetElemType, DoubleT>)) {
+                            std::is_same_v<TargetElemType, FloatT> || std::is_same_v<TargetElemType, DoubleT> ||
+                            std::is_same_v<TargetElemType, UInt8T>)) {
                 UnrecoverableError(fmt::format("Not support to cast from {} to {}",
                                                DataType::TypeToString<SourceElemType>(),
                                                DataType::TypeToString<TargetElemType>()));
@@ -152,6 +166,23 @@ struct EmbeddingTryCastToFixlen {
                 target[i] = (src[i / 8] & (1u << (i % 8))) ? 1 : 0;
             }
             return true;
+        } else if constexpr (std::is_same_v<SourceElemType, UInt8T> || std::is_same_v<SourceElemType, Float16T> ||
+                             std::is_same_v<TargetElemType, UInt8T> || std::is_same_v<TargetElemType, Float16T>) {
+            // uint8 and float16 have no column type of their own, their elements are cast through double
+            for (SizeT i = 0; i < len; ++i) {
+                const auto value = static_cast<DoubleT>(source[i]);
+                if constexpr (std::is_same_v<TargetElemType, Float16T>) {
+                    target[i] = Float16T(static_cast<FloatT>(value));
+                } else {
+                    if constexpr (std::is_integral_v<TargetElemType>) {
+                        if (value < std::numeric_limits<TargetElemType>::lowest() || value > std::numeric_limits<TargetElemType>::max()) {
+                            return false;
+                        }
+                    }
+                    target[i] = static_cast<TargetElemType>(value);
+                }
+            }
+            return true;
         } else if constexpr (std::is_same<SourceElemType, TinyIntT>() || std::is_same<SourceElemType, SmallIntT>() ||
                              std::is_same<SourceElemType, IntegerT>() || std::is_same<SourceElemType, BigIntT>()) {
             for (SizeT i = 0; i < len; ++i) {
@@ -27,6 +27,7 @@ export enum class SpecialType {
     kRowID,
     kDistance,
     kScore,
+    kQueryIndex,
     kCreateTs,
     kDeleteTs,
 };
@@ -42,9 +42,51 @@ import internal_types;
 import data_type;
 import status;
 import logger;
+import table_entry;
+import column_def;
+import embedding_info;
+import default_values;
 
 namespace infinity {
 
+void KnnScanSharedData::InitFloatRerank() {
+    candidate_n_ = topk_;
+    const String *column_name = nullptr;
+    i64 rerank = DEFAULT_FLOAT_RERANK_FACTOR;
+    for (const auto &opt_param : opt_params_) {
+        if (opt_param.param_name_ == "rerank_column") {
+            column_name = &opt_param.param_value_;
+        } else if (opt_param.param_name_ == "rerank") {
+            rerank = std::max<i64>(1, std::stoll(opt_param.param_value_));
+        }
+    }
+    if (column_name == nullptr) {
+        return;
+    }
+    if (elem_type_ != EmbeddingDataType::kElemBit or knn_distance_type_ != KnnDistanceType::kHamming) {
+        Status status = Status::NotSupport("rerank_column is only supported by hamming distance on a bit embedding column");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    if (float_query_embedding_ == nullptr) {
+        Status status = Status::NotSupport("rerank_column needs a float query vector, whose sign bits are searched by hamming distance");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    const TableEntry *table_entry = table_ref_->table_entry_ptr_;
+    const ColumnID column_id = table_entry->GetColumnIdByName(*column_name);
+    const DataType *column_type = table_entry->GetColumnDefByID(column_id)->type().get();
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_type->type_info().get());
+    if (column_type->type() != LogicalType::kEmbedding or embedding_info->Type() != EmbeddingDataType::kElemFloat or
+        (i64)embedding_info->Dimension() != dimension_) {
+        Status status = Status::InvalidParameterValue("rerank_column", *column_name, "expect a float embedding column of the same dimension");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    float_rerank_column_id_ = column_id;
+    candidate_n_ = topk_ * rerank;
+}
+
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
@@ -63,6 +105,65 @@ KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type) {
     }
 }
 
+template <>
+KnnDistance1<i8, f32>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = L2Distance<f32, i8, i8, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = IPDistance<f32, i8, i8, SizeT>;
+            break;
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type));
+            RecoverableError(status);
+        }
+    }
+}
+
+// u8 is the element type of both the uint8 and the bit embedding, a bit embedding is only compared by hamming distance
+template <>
+KnnDistance1<u8, f32>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = L2Distance<f32, u8, u8, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = IPDistance<f32, u8, u8, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kHamming: {
+            dist_func_ = HammingDistance<f32, SizeT>;
+            break;
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type));
+            RecoverableError(status);
+        }
+    }
+}
+
+template <>
+KnnDistance1<Float16T, f32>::KnnDistance1(KnnDistanceType dist_type) {
+    switch (dist_type) {
+        case KnnDistanceType::kL2: {
+            dist_func_ = L2Distance<f32, Float16T, Float16T, SizeT>;
+            break;
+        }
+        case KnnDistanceType::kInnerProduct: {
+            dist_func_ = IPDistance<f32, Float16T, Float16T, SizeT>;
+            break;
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("KnnDistanceType: {} is not support.", (i32)dist_type));
+            RecoverableError(status);
+        }
+    }
+}
+
 // --------------------------------------------
 
 KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 current_parallel_idx)
@@ -72,6 +173,23 @@ KnnScanFunctionData::KnnScanFunctionData(KnnScanSharedData *shared_data, u32 cur
             Init<f32>();
             break;
         }
+        case EmbeddingDataType::kElemInt8: {
+            Init<i8>();
+            break;
+        }
+        case EmbeddingDataType::kElemUInt8: {
+            Init<u8>();
+            break;
+        }
+        case EmbeddingDataType::kElemFloat16: {
+            Init<Float16T>();
+            break;
+        }
+        case EmbeddingDataType::kElemBit: {
+            // the bit vectors are compared as their packed bytes
+            Init<u8>();
+            break;
+        }
         default: {
             Status status = Status::NotSupport(
                 fmt::format("EmbeddingDataType: {} is not support.", EmbeddingType::EmbeddingDataType2String(knn_scan_shared_data_->elem_type_)));
@@ -89,21 +207,22 @@ void KnnScanFunctionData::Init() {
         }
         case KnnDistanceType::kL2:
         case KnnDistanceType::kHamming: {
-            auto merge_knn_max = MakeUnique<MergeKnn<DataType, CompareMax>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+            auto merge_knn_max = MakeUnique<MergeKnn<f32, CompareMax>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->candidate_n_);
             merge_knn_max->Begin();
             merge_knn_base_ = std::move(merge_knn_max);
             break;
         }
         case KnnDistanceType::kCosine:
         case KnnDistanceType::kInnerProduct: {
-            auto merge_knn_min = MakeUnique<MergeKnn<DataType, CompareMin>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->topk_);
+            auto merge_knn_min = MakeUnique<MergeKnn<f32, CompareMin>>(knn_scan_shared_data_->query_count_, knn_scan_shared_data_->candidate_n_);
             merge_knn_min->Begin();
             merge_knn_base_ = std::move(merge_knn_min);
             break;
         }
     }
 
-    knn_distance_ = MakeUnique<KnnDistance1<DataType>>(knn_scan_shared_data_->knn_distance_type_);
+    // Distances are always f32, whatever the element type
+    knn_distance_ = MakeUnique<KnnDistance1<DataType, f32>>(knn_scan_shared_data_->knn_distance_type_);
 }
 
 } // namespace infinity
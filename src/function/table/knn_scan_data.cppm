@@ -33,6 +33,7 @@ import expression_state;
 import knn_expr;
 import statement_common;
 import base_table_ref;
+import internal_types;
 
 namespace infinity {
 
@@ -46,11 +47,17 @@ public:
                       i64 dimension,
                       i64 query_embedding_count,
                       void *query_embedding,
+                      const f32 *float_query_embedding,
                       EmbeddingDataType elem_type,
                       KnnDistanceType knn_distance_type)
         : table_ref_(table_ref), block_column_entries_(std::move(block_column_entries)), index_entries_(std::move(index_entries)),
           opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension), query_count_(query_embedding_count),
-          query_embedding_(query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_embedding_(query_embedding), float_query_embedding_(float_query_embedding), elem_type_(elem_type), knn_distance_type_(knn_distance_type) {
+        InitFloatRerank();
+    }
+
+private:
+    void InitFloatRerank();
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -63,9 +70,16 @@ public:
     const i64 dimension_;
     const u64 query_count_;
     void *const query_embedding_;
+    // the float query of a hamming search, see KnnExpression
+    const f32 *const float_query_embedding_;
     const EmbeddingDataType elem_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
 
+    // A hamming search on a bit column with a float query keeps topk * rerank candidates of every query and reranks them by the L2 distance
+    // of the query to the float column named by the rerank_column option, see PhysicalKnnScan. Without it the candidates are the topk results.
+    Optional<ColumnID> float_rerank_column_id_{};
+    i64 candidate_n_{};
+
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
 };
@@ -74,21 +88,22 @@ public:
 
 export class KnnDistanceBase1 {};
 
-export template <typename DataType>
+// DataType is the element type of the column and query, distances are DistType.
+export template <typename DataType, typename DistType = DataType>
 class KnnDistance1 : public KnnDistanceBase1 {
 public:
     KnnDistance1(KnnDistanceType dist_type);
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
-        Vector<DataType> res(data_count);
+    Vector<DistType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim) {
+        Vector<DistType> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             res[i] = dist_func_(query, datas + i * dim, dim);
         }
         return res;
     }
 
-    Vector<DataType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
-        Vector<DataType> res(data_count);
+    Vector<DistType> Calculate(const DataType *datas, SizeT data_count, const DataType *query, SizeT dim, Bitmask &bitmask) {
+        Vector<DistType> res(data_count);
         for (SizeT i = 0; i < data_count; ++i) {
             if (bitmask.IsTrue(i)) {
                 res[i] = dist_func_(query, datas + i * dim, dim);
@@ -98,7 +113,7 @@ public:
     }
 
 public:
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    using DistFunc = DistType (*)(const DataType *, const DataType *, SizeT);
 
     DistFunc dist_func_{};
 };
@@ -106,6 +121,15 @@ public:
 template <>
 KnnDistance1<f32>::KnnDistance1(KnnDistanceType dist_type);
 
+template <>
+KnnDistance1<i8, f32>::KnnDistance1(KnnDistanceType dist_type);
+
+template <>
+KnnDistance1<u8, f32>::KnnDistance1(KnnDistanceType dist_type);
+
+template <>
+KnnDistance1<Float16T, f32>::KnnDistance1(KnnDistanceType dist_type);
+
 //-------------------------------------------------------------------
 
 export class KnnScanFunctionData final : public TableFunctionData {
@@ -38,7 +38,12 @@ MergeKnnFunctionData::MergeKnnFunctionData(i64 query_count,
         case kElemInvalid: {
             UnrecoverableError("Invalid element type");
         }
-        case kElemFloat: {
+        case kElemFloat:
+        case kElemInt8:
+        case kElemUInt8:
+        case kElemFloat16:
+        case kElemBit: {
+            // Distances are f32 for all supported element types
             MergeKnnFunctionData::InitMergeKnn<f32>(knn_distance_type);
             break;
         }
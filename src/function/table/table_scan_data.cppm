@@ -19,6 +19,7 @@ import function_data;
 import table_function;
 import global_block_id;
 import block_index;
+import bitmask;
 
 export module table_scan_function_data;
 
@@ -35,6 +36,8 @@ public:
 
     u64 current_block_ids_idx_{0};
     SizeT current_read_offset_{0};
+    // rows of the current block left by the encoded column filters, null if no filter was evaluated on it
+    SharedPtr<Bitmask> selected_rows_{};
 };
 
 } // namespace infinity
@@ -297,6 +297,33 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // Hnsw build thread number
+        i64 hnsw_build_thread_num = DEFAULT_HNSW_BUILD_THREAD_NUM;
+        UniquePtr<IntegerOption> hnsw_build_thread_num_option =
+            MakeUnique<IntegerOption>(HNSW_BUILD_THREAD_NUM_OPTION_NAME, hnsw_build_thread_num, MAX_HNSW_BUILD_THREAD_NUM, MIN_HNSW_BUILD_THREAD_NUM);
+        status = global_options_.AddOption(std::move(hnsw_build_thread_num_option));
+        if(!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
+        // Scrub Interval
+        i64 scrub_interval = DEFAULT_SCRUB_INTERVAL_SEC;
+        UniquePtr<IntegerOption> scrub_interval_option =
+            MakeUnique<IntegerOption>(SCRUB_INTERVAL_OPTION_NAME, scrub_interval, MAX_SCRUB_INTERVAL_SEC, MIN_SCRUB_INTERVAL_SEC);
+        status = global_options_.AddOption(std::move(scrub_interval_option));
+        if(!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
+        // Scrub IO Rate Limit
+        i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+        UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+            MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, MAX_SCRUB_IO_RATE_LIMIT, MIN_SCRUB_IO_RATE_LIMIT);
+        status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+        if(!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
         // Buffer Manager Size
         i64 buffer_manager_size = DEFAULT_BUFFER_MANAGER_SIZE;
         UniquePtr<IntegerOption> buffer_manager_size_option =
@@ -372,6 +399,26 @@ Status Config::Init(const SharedPtr<String> &config_path) {
             UnrecoverableError(status.message());
         }
 
+        // WAL Group Commit Max Wait
+        i64 wal_group_commit_max_wait = DEFAULT_WAL_GROUP_COMMIT_MAX_WAIT_US;
+        UniquePtr<IntegerOption> wal_group_commit_max_wait_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_WAIT_OPTION_NAME,
+                                                                                              wal_group_commit_max_wait,
+                                                                                              MAX_WAL_GROUP_COMMIT_MAX_WAIT_US,
+                                                                                              MIN_WAL_GROUP_COMMIT_MAX_WAIT_US);
+        status = global_options_.AddOption(std::move(wal_group_commit_max_wait_option));
+        if(!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
+        // Replay WAL Thread Num
+        i64 replay_wal_thread_num = DEFAULT_REPLAY_WAL_THREAD_NUM;
+        UniquePtr<IntegerOption> replay_wal_thread_num_option =
+            MakeUnique<IntegerOption>(REPLAY_WAL_THREAD_NUM_OPTION_NAME, replay_wal_thread_num, MAX_REPLAY_WAL_THREAD_NUM, MIN_REPLAY_WAL_THREAD_NUM);
+        status = global_options_.AddOption(std::move(replay_wal_thread_num_option));
+        if(!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
         // Resource Dir
         String resource_dir = "/var/infinity/resource";
         UniquePtr<StringOption> resource_dir_option = MakeUnique<StringOption>("resource_dir", resource_dir);
@@ -1022,6 +1069,74 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kHnswBuildThreadNum: {
+                            // Hnsw build thread number
+                            i64 hnsw_build_thread_num = DEFAULT_HNSW_BUILD_THREAD_NUM;
+                            if(elem.second.is_integer()) {
+                                hnsw_build_thread_num = elem.second.value_or(hnsw_build_thread_num);
+                            } else {
+                                return Status::InvalidConfig("'hnsw_build_thread_num' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> hnsw_build_thread_num_option =
+                                MakeUnique<IntegerOption>(HNSW_BUILD_THREAD_NUM_OPTION_NAME, hnsw_build_thread_num, MAX_HNSW_BUILD_THREAD_NUM, MIN_HNSW_BUILD_THREAD_NUM);
+                            if (!hnsw_build_thread_num_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid hnsw build thread number: {}", hnsw_build_thread_num));
+                            }
+                            Status status = global_options_.AddOption(std::move(hnsw_build_thread_num_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kScrubInterval: {
+                            // Scrub Interval
+                            i64 scrub_interval = DEFAULT_SCRUB_INTERVAL_SEC;
+                            if(elem.second.is_string()) {
+                                String scrub_interval_str = elem.second.value_or(DEFAULT_SCRUB_INTERVAL_SEC_STR.data());
+                                auto res = ParseTimeInfo(scrub_interval_str, scrub_interval);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'scrub_interval' field isn't string, such as \"1m\".");
+                            }
+
+                            UniquePtr<IntegerOption> scrub_interval_option =
+                                MakeUnique<IntegerOption>(SCRUB_INTERVAL_OPTION_NAME, scrub_interval, MAX_SCRUB_INTERVAL_SEC, MIN_SCRUB_INTERVAL_SEC);
+                            if (!scrub_interval_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid scrub interval: {}", scrub_interval));
+                            }
+                            Status status = global_options_.AddOption(std::move(scrub_interval_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kScrubIORateLimit: {
+                            // Scrub IO Rate Limit
+                            i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+                            if(elem.second.is_string()) {
+                                String scrub_io_rate_limit_str = elem.second.value_or(DEFAULT_SCRUB_IO_RATE_LIMIT_STR.data());
+                                auto res = ParseByteSize(scrub_io_rate_limit_str, scrub_io_rate_limit);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'scrub_io_rate_limit' field isn't string, such as \"4MB\".");
+                            }
+
+                            UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+                                MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, MAX_SCRUB_IO_RATE_LIMIT, MIN_SCRUB_IO_RATE_LIMIT);
+                            if (!scrub_io_rate_limit_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid scrub io rate limit: {}", scrub_io_rate_limit));
+                            }
+                            Status status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+                            if(!status.ok()) {
+                                UnrecoverableError(status.message());
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1082,6 +1197,39 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                     }
                 }
 
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kHnswBuildThreadNum) == nullptr) {
+                    // Hnsw build thread number
+                    i64 hnsw_build_thread_num = DEFAULT_HNSW_BUILD_THREAD_NUM;
+                    UniquePtr<IntegerOption> hnsw_build_thread_num_option =
+                        MakeUnique<IntegerOption>(HNSW_BUILD_THREAD_NUM_OPTION_NAME, hnsw_build_thread_num, MAX_HNSW_BUILD_THREAD_NUM, MIN_HNSW_BUILD_THREAD_NUM);
+                    Status status = global_options_.AddOption(std::move(hnsw_build_thread_num_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kScrubInterval) == nullptr) {
+                    // Scrub Interval
+                    i64 scrub_interval = DEFAULT_SCRUB_INTERVAL_SEC;
+                    UniquePtr<IntegerOption> scrub_interval_option =
+                        MakeUnique<IntegerOption>(SCRUB_INTERVAL_OPTION_NAME, scrub_interval, MAX_SCRUB_INTERVAL_SEC, MIN_SCRUB_INTERVAL_SEC);
+                    Status status = global_options_.AddOption(std::move(scrub_interval_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kScrubIORateLimit) == nullptr) {
+                    // Scrub IO Rate Limit
+                    i64 scrub_io_rate_limit = DEFAULT_SCRUB_IO_RATE_LIMIT;
+                    UniquePtr<IntegerOption> scrub_io_rate_limit_option =
+                        MakeUnique<IntegerOption>(SCRUB_IO_RATE_LIMIT_OPTION_NAME, scrub_io_rate_limit, MAX_SCRUB_IO_RATE_LIMIT, MIN_SCRUB_IO_RATE_LIMIT);
+                    Status status = global_options_.AddOption(std::move(scrub_io_rate_limit_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -1313,9 +1461,9 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                                 if (IsEqual(flush_option_str, "flush_at_once")) {
                                     flush_option_type = FlushOptionType::kFlushAtOnce;
                                 } else if (IsEqual(flush_option_str, "only_write")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kOnlyWrite;
                                 } else if (IsEqual(flush_option_str, "flush_per_second")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kFlushPerSecond;
                                 } else {
                                     return Status::InvalidConfig(fmt::format("Unsupported flush option: {}", flush_option_str));
                                 }
@@ -1330,6 +1478,49 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kWALGroupCommitMaxWait: {
+                            // WAL Group Commit Max Wait
+                            i64 wal_group_commit_max_wait = DEFAULT_WAL_GROUP_COMMIT_MAX_WAIT_US;
+                            if (elem.second.is_integer()) {
+                                wal_group_commit_max_wait = elem.second.value_or(wal_group_commit_max_wait);
+                            } else {
+                                return Status::InvalidConfig("'wal_group_commit_max_wait' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> wal_group_commit_max_wait_option =
+                                MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_WAIT_OPTION_NAME,
+                                                          wal_group_commit_max_wait,
+                                                          MAX_WAL_GROUP_COMMIT_MAX_WAIT_US,
+                                                          MIN_WAL_GROUP_COMMIT_MAX_WAIT_US);
+                            if (!wal_group_commit_max_wait_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid wal group commit max wait: {}", wal_group_commit_max_wait));
+                            }
+                            Status status = global_options_.AddOption(std::move(wal_group_commit_max_wait_option));
+                            if (!status.ok()) {
+                                return status;
+                            }
+                            break;
+                        }
+                        case GlobalOptionIndex::kReplayWALThreadNum: {
+                            // Replay WAL Thread Num
+                            i64 replay_wal_thread_num = DEFAULT_REPLAY_WAL_THREAD_NUM;
+                            if (elem.second.is_integer()) {
+                                replay_wal_thread_num = elem.second.value_or(replay_wal_thread_num);
+                            } else {
+                                return Status::InvalidConfig("'replay_wal_thread_num' field isn't integer.");
+                            }
+
+                            UniquePtr<IntegerOption> replay_wal_thread_num_option =
+                                MakeUnique<IntegerOption>(REPLAY_WAL_THREAD_NUM_OPTION_NAME, replay_wal_thread_num, MAX_REPLAY_WAL_THREAD_NUM, MIN_REPLAY_WAL_THREAD_NUM);
+                            if (!replay_wal_thread_num_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid replay wal thread number: {}", replay_wal_thread_num));
+                            }
+                            Status status = global_options_.AddOption(std::move(replay_wal_thread_num_option));
+                            if (!status.ok()) {
+                                return status;
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'wal' field", var_name));
                         }
@@ -1405,6 +1596,30 @@ Status Config::Init(const SharedPtr<String> &config_path) {
                         UnrecoverableError(status.message());
                     }
                 }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kWALGroupCommitMaxWait) == nullptr) {
+                    // WAL Group Commit Max Wait
+                    i64 wal_group_commit_max_wait = DEFAULT_WAL_GROUP_COMMIT_MAX_WAIT_US;
+                    UniquePtr<IntegerOption> wal_group_commit_max_wait_option = MakeUnique<IntegerOption>(WAL_GROUP_COMMIT_MAX_WAIT_OPTION_NAME,
+                                                                                                          wal_group_commit_max_wait,
+                                                                                                          MAX_WAL_GROUP_COMMIT_MAX_WAIT_US,
+                                                                                                          MIN_WAL_GROUP_COMMIT_MAX_WAIT_US);
+                    Status status = global_options_.AddOption(std::move(wal_group_commit_max_wait_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
+                if(global_options_.GetOptionByIndex(GlobalOptionIndex::kReplayWALThreadNum) == nullptr) {
+                    // Replay WAL Thread Num
+                    i64 replay_wal_thread_num = DEFAULT_REPLAY_WAL_THREAD_NUM;
+                    UniquePtr<IntegerOption> replay_wal_thread_num_option =
+                        MakeUnique<IntegerOption>(REPLAY_WAL_THREAD_NUM_OPTION_NAME, replay_wal_thread_num, MAX_REPLAY_WAL_THREAD_NUM, MIN_REPLAY_WAL_THREAD_NUM);
+                    Status status = global_options_.AddOption(std::move(replay_wal_thread_num_option));
+                    if(!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'wal' section in configure file.");
             }
@@ -1590,6 +1805,26 @@ i64 Config::MemIndexCapacity() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexCapacity);
 }
 
+i64 Config::ScrubInterval() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kScrubInterval);
+}
+
+i64 Config::ScrubIORateLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kScrubIORateLimit);
+}
+
+i64 Config::HnswBuildThreadNum() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    i64 hnsw_build_thread_num = global_options_.GetIntegerValue(GlobalOptionIndex::kHnswBuildThreadNum);
+    if (hnsw_build_thread_num == 0) {
+        // Follow cpu_count
+        return global_options_.GetIntegerValue(GlobalOptionIndex::kWorkerCPULimit);
+    }
+    return hnsw_build_thread_num;
+}
+
 // Buffer
 i64 Config::BufferManagerSize() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1637,6 +1872,21 @@ FlushOptionType Config::FlushMethodAtCommit() {
     return flush_option->value_;
 }
 
+i64 Config::WALGroupCommitMaxWait() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kWALGroupCommitMaxWait);
+}
+
+i64 Config::ReplayWALThreadNum() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    i64 replay_wal_thread_num = global_options_.GetIntegerValue(GlobalOptionIndex::kReplayWALThreadNum);
+    if (replay_wal_thread_num == 0) {
+        // Follow cpu_count
+        return global_options_.GetIntegerValue(GlobalOptionIndex::kWorkerCPULimit);
+    }
+    return replay_wal_thread_num;
+}
+
 // Resource
 String Config::ResourcePath() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -1686,6 +1936,9 @@ void Config::PrintAll() {
     fmt::print(" - compact_interval: {}\n", Utility::FormatTimeInfo(CompactInterval()));
     fmt::print(" - optimize_index_interval: {}\n", Utility::FormatTimeInfo(OptimizeIndexInterval()));
     fmt::print(" - memindex_capacity: {}\n", Utility::FormatByteSize(MemIndexCapacity()));
+    fmt::print(" - hnsw_build_thread_num: {}\n", HnswBuildThreadNum());
+    fmt::print(" - scrub_interval: {}\n", Utility::FormatTimeInfo(ScrubInterval()));
+    fmt::print(" - scrub_io_rate_limit: {}\n", Utility::FormatByteSize(ScrubIORateLimit()));
 
     // Buffer manager
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
@@ -1698,6 +1951,8 @@ void Config::PrintAll() {
     fmt::print(" - delta_checkpoint_interval: {}\n", Utility::FormatTimeInfo(DeltaCheckpointInterval()));
     fmt::print(" - delta_checkpoint_threshold: {}\n", Utility::FormatByteSize(DeltaCheckpointThreshold()));
     fmt::print(" - flush_method_at_commit: {}\n", FlushOptionTypeToString(FlushMethodAtCommit()));
+    fmt::print(" - wal_group_commit_max_wait: {}us\n", WALGroupCommitMaxWait());
+    fmt::print(" - replay_wal_thread_num: {}\n", ReplayWALThreadNum());
 
     // Resource dir
     fmt::print(" - resource_dir: {}\n", ResourcePath());
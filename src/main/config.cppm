@@ -71,6 +71,12 @@ public:
 
     i64 MemIndexCapacity();
 
+    i64 HnswBuildThreadNum();
+
+    i64 ScrubInterval();
+
+    i64 ScrubIORateLimit();
+
     // Buffer
     i64 BufferManagerSize();
 
@@ -89,6 +95,10 @@ public:
 
     FlushOptionType FlushMethodAtCommit();
 
+    i64 WALGroupCommitMaxWait();
+
+    i64 ReplayWALThreadNum();
+
     // Resource
     String ResourcePath();
 
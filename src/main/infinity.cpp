@@ -250,7 +250,7 @@ QueryResult Infinity::SetVariableOrConfig(const String &name, String value, SetS
                             InfinityContext::instance().session_manager());
 
     UniquePtr<CommandStatement> command_statement = MakeUnique<CommandStatement>();
-    command_statement->command_info_ = MakeUnique<SetCmd>(scope, SetVarType::kDouble, name, value);
+    command_statement->command_info_ = MakeUnique<SetCmd>(scope, SetVarType::kString, name, value);
     QueryResult result = query_context_ptr->QueryStatement(command_statement.get());
     return result;
 }
@@ -50,6 +50,7 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(COMPACT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kCompactInterval;
     name2index_[String(OPTIMIZE_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kOptimizeIndexInterval;
     name2index_[String(MEM_INDEX_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kMemIndexCapacity;
+    name2index_[String(HNSW_BUILD_THREAD_NUM_OPTION_NAME)] = GlobalOptionIndex::kHnswBuildThreadNum;
 
     name2index_[String(BUFFER_MANAGER_SIZE_OPTION_NAME)] = GlobalOptionIndex::kBufferManagerSize;
     name2index_[String(TEMP_DIR_OPTION_NAME)] = GlobalOptionIndex::kTempDir;
@@ -61,6 +62,10 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME)] = GlobalOptionIndex::kDeltaCheckpointThreshold;
     name2index_[String(WAL_FLUSH_OPTION_NAME)] = GlobalOptionIndex::kFlushMethodAtCommit;
     name2index_[String(RESOURCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kResourcePath;
+    name2index_[String(SCRUB_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kScrubInterval;
+    name2index_[String(SCRUB_IO_RATE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kScrubIORateLimit;
+    name2index_[String(REPLAY_WAL_THREAD_NUM_OPTION_NAME)] = GlobalOptionIndex::kReplayWALThreadNum;
+    name2index_[String(WAL_GROUP_COMMIT_MAX_WAIT_OPTION_NAME)] = GlobalOptionIndex::kWALGroupCommitMaxWait;
 }
 
 Status GlobalOptions::AddOption(UniquePtr<BaseOption> option) {
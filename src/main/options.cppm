@@ -132,16 +132,21 @@ export enum class GlobalOptionIndex {
     kCompactInterval = 17,
     kOptimizeIndexInterval = 18,
     kMemIndexCapacity = 19,
-    kBufferManagerSize = 20,
-    kTempDir = 21,
-    kWALDir = 22,
-    kWALCompactThreshold = 23,
-    kFullCheckpointInterval = 24,
-    kDeltaCheckpointInterval = 25,
-    kDeltaCheckpointThreshold = 26,
-    kFlushMethodAtCommit = 27,
-    kResourcePath = 28,
-    kInvalid = 29
+    kHnswBuildThreadNum = 20,
+    kBufferManagerSize = 21,
+    kTempDir = 22,
+    kWALDir = 23,
+    kWALCompactThreshold = 24,
+    kFullCheckpointInterval = 25,
+    kDeltaCheckpointInterval = 26,
+    kDeltaCheckpointThreshold = 27,
+    kFlushMethodAtCommit = 28,
+    kResourcePath = 29,
+    kScrubInterval = 30,
+    kScrubIORateLimit = 31,
+    kReplayWALThreadNum = 32,
+    kWALGroupCommitMaxWait = 33,
+    kInvalid = 34
 };
 
 export struct GlobalOptions {
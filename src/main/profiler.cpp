@@ -202,6 +202,14 @@ void QueryProfiler::Stop() {
     current_phase_ = QueryPhase::kInvalid;
 }
 
+i64 QueryProfiler::PlanningElapsed() const {
+    i64 elapsed = 0;
+    for (auto phase = magic_enum::enum_integer(QueryPhase::kParser); phase <= magic_enum::enum_integer(QueryPhase::kTaskBuild); ++phase) {
+        elapsed += profilers_[phase].Elapsed();
+    }
+    return elapsed;
+}
+
 void QueryProfiler::Flush(TaskProfiler &&profiler) {
     if (!enable_) {
         return;
@@ -211,6 +219,15 @@ void QueryProfiler::Flush(TaskProfiler &&profiler) {
     records_[profiler.binding_.fragment_id_][profiler.binding_.task_id_].push_back(profiler);
 }
 
+void QueryProfiler::AddNote(String note) {
+    if (!enable_) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lk(flush_lock_);
+    notes_.emplace_back(std::move(note));
+}
+
 void QueryProfiler::ExecuteRender(std::stringstream &ss) const {
     for (const auto &fragment : records_) {
         ss << "Fragment #" << fragment.first << std::endl;
@@ -248,6 +265,9 @@ String QueryProfiler::ToString() const {
     ss.setf(std::ios_base::fixed, std::ios_base::floatfield);
     ss.setf(std::ios_base::showpoint);
     ss.precision(2);
+    i64 planning_elapsed = PlanningElapsed();
+    ss << "Planning: " << BaseProfiler::ElapsedToString(NanoSeconds(planning_elapsed)) << "("
+       << static_cast<double>(planning_elapsed * 100) / cost_sum << "%)" << std::endl;
     for (SizeT idx = 0; idx < profilers_count; ++idx) {
         const BaseProfiler &profiler = profilers_[idx];
         ss << profiler.name() << ": " << profiler.ElapsedToString() << "(" << static_cast<double>(profiler.Elapsed() * 100) / cost_sum << "%)"
@@ -259,6 +279,9 @@ String QueryProfiler::ToString() const {
             ExecuteRender(ss);
         }
     }
+    for (const auto &note : notes_) {
+        ss << "Note: " << note << std::endl;
+    }
     return ss.str();
 }
 
@@ -321,6 +344,10 @@ nlohmann::json QueryProfiler::Serialize(const QueryProfiler *profiler) {
         json["fragments"].push_back(json_fragments);
     }
     json["total"] = end - start;
+    json["planning"] = profiler->PlanningElapsed();
+    for (const auto &note : profiler->notes_) {
+        json["notes"].push_back(note);
+    }
     json["time_unit"] = "ns";
 
     return json;
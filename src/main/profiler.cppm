@@ -193,10 +193,16 @@ public:
 
     void Flush(TaskProfiler &&profiler);
 
+    // Statistics reported by an operator, e.g. the iterators compared by a full text search in profiling mode.
+    void AddNote(String note);
+
     i64 ElapsedAt(SizeT index) {
         return profilers_[index].Elapsed();
     }
 
+    // Time taken by the query before its execution, from parsing to task building.
+    [[nodiscard]] i64 PlanningElapsed() const;
+
     OptimizerProfiler &optimizer() { return optimizer_; }
 
     [[nodiscard]] String ToString() const;
@@ -210,6 +216,7 @@ private:
 
     std::mutex flush_lock_{};
     HashMap<u64, HashMap<i64, Vector<TaskProfiler>>> records_{};
+    Vector<String> notes_{};
     Vector<BaseProfiler> profilers_{static_cast<magic_enum::underlying_type_t<QueryPhase>>(QueryPhase::kInvalid)};
     OptimizerProfiler optimizer_;
     QueryPhase current_phase_{QueryPhase::kInvalid};
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <sstream>
 #include <csignal>
 //#include "gperftools/profiler.h"
@@ -52,6 +53,11 @@ import parser_result;
 import parser_assert;
 import plan_fragment;
 import bg_query_state;
+import statement_cache;
+import constant_expr;
+import data_table;
+import column_def;
+import data_type;
 
 namespace infinity {
 
@@ -85,8 +91,8 @@ QueryResult QueryContext::Query(const String &query) {
     CreateQueryProfiler();
 
     StartProfile(QueryPhase::kParser);
-    UniquePtr<ParserResult> parsed_result = MakeUnique<ParserResult>();
-    parser_->Parse(query, parsed_result.get());
+    NormalizedQuery normalized_query = NormalizeQuery(query);
+    SharedPtr<ParserResult> parsed_result = Parse(normalized_query, query);
 
     if (parsed_result->IsError()) {
         StopProfile(QueryPhase::kParser);
@@ -97,8 +103,10 @@ QueryResult QueryContext::Query(const String &query) {
         UnrecoverableError("Only support single statement.");
     }
     StopProfile(QueryPhase::kParser);
+    BindParameters(normalized_query, {});
     for (BaseStatement *statement : *parsed_result->statements_ptr_) {
         QueryResult query_result = QueryStatement(statement);
+        parameter_values_.clear();
         return query_result;
     }
 
@@ -106,6 +114,136 @@ QueryResult QueryContext::Query(const String &query) {
     return QueryResult::UnusedResult();
 }
 
+Status QueryContext::Prepare(const String &name, const String &query) {
+    NormalizedQuery normalized_query = NormalizeQuery(query);
+    SharedPtr<ParserResult> parsed_result = Parse(normalized_query, query);
+    if (parsed_result->IsError()) {
+        return Status::ParserError(parsed_result->error_message_);
+    }
+    if (parsed_result->statements_ptr_ == nullptr || parsed_result->statements_ptr_->size() != 1) {
+        return Status::ParserError("Only support single statement.");
+    }
+    if (!IsCacheableStatement(*parsed_result)) {
+        parsed_result = nullptr;
+    }
+    session_ptr_->AddPreparedStatement(name, PreparedStatement{query, std::move(normalized_query), std::move(parsed_result)});
+    return Status::OK();
+}
+
+QueryResult QueryContext::ExecutePrepared(const String &name, const Vector<SharedPtr<ConstantExpr>> &parameters) {
+    const PreparedStatement *prepared_statement = session_ptr_->GetPreparedStatement(name);
+    if (prepared_statement == nullptr) {
+        QueryResult query_result;
+        query_result.status_ = Status::DataNotExist(fmt::format("prepared statement {}", name));
+        return query_result;
+    }
+
+    CreateQueryProfiler();
+
+    StartProfile(QueryPhase::kParser);
+    SharedPtr<ParserResult> parsed_result = PreparedParserResult(*prepared_statement);
+    StopProfile(QueryPhase::kParser);
+    BindParameters(prepared_statement->normalized_query_, parameters);
+    QueryResult query_result = QueryStatement((*parsed_result->statements_ptr_)[0]);
+    parameter_values_.clear();
+    return query_result;
+}
+
+QueryResult QueryContext::DescribePrepared(const String &name, const Vector<SharedPtr<ConstantExpr>> &parameters) {
+    QueryResult query_result;
+    const PreparedStatement *prepared_statement = session_ptr_->GetPreparedStatement(name);
+    if (prepared_statement == nullptr) {
+        query_result.status_ = Status::DataNotExist(fmt::format("prepared statement {}", name));
+        return query_result;
+    }
+    SharedPtr<ParserResult> parsed_result = PreparedParserResult(*prepared_statement);
+    BindParameters(prepared_statement->normalized_query_, parameters);
+    const BaseStatement *statement = (*parsed_result->statements_ptr_)[0];
+
+    // The statement is only bound, in a transaction which changes nothing.
+    this->BeginTxn();
+    try {
+        SharedPtr<BindContext> bind_context;
+        auto status = logical_planner_->Build(statement, bind_context);
+        if (!status.ok()) {
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        const SharedPtr<LogicalNode> &logical_plan = logical_planner_->LogicalPlans().back();
+        SharedPtr<Vector<String>> column_names = logical_plan->GetOutputNames();
+        SharedPtr<Vector<SharedPtr<DataType>>> column_types = logical_plan->GetOutputTypes();
+        Vector<SharedPtr<ColumnDef>> column_defs;
+        column_defs.reserve(column_names->size());
+        for (SizeT col_idx = 0; col_idx < column_names->size(); ++col_idx) {
+            column_defs.emplace_back(MakeShared<ColumnDef>(col_idx, column_types->at(col_idx), column_names->at(col_idx), std::set<ConstraintType>()));
+        }
+        query_result.result_table_ = DataTable::MakeResultTable(column_defs);
+        query_result.root_operator_type_ = logical_plan->operator_type();
+    } catch (RecoverableException &e) {
+        query_result.result_table_ = nullptr;
+        query_result.status_.Init(e.ErrorCode(), e.what());
+    }
+    this->RollbackTxn();
+    parameter_values_.clear();
+    return query_result;
+}
+
+SharedPtr<ParserResult> QueryContext::PreparedParserResult(const PreparedStatement &prepared_statement) {
+    // a statement which is not cacheable is parsed again for every use
+    if (prepared_statement.parsed_result_.get() != nullptr) {
+        return prepared_statement.parsed_result_;
+    }
+    return Parse(prepared_statement.normalized_query_, prepared_statement.query_);
+}
+
+SharedPtr<ParserResult> QueryContext::Parse(const NormalizedQuery &normalized_query, const String &query) {
+    StatementCache *statement_cache = session_manager_->statement_cache();
+    SharedPtr<ParserResult> parsed_result;
+    if (normalized_query.select_) {
+        parsed_result = statement_cache->Get(normalized_query.text_);
+        if (parsed_result.get() != nullptr) {
+            return parsed_result;
+        }
+    }
+
+    parsed_result = MakeShared<ParserResult>();
+    parser_->Parse(normalized_query.text_, parsed_result.get());
+    bool literal_taken = std::any_of(normalized_query.slots_.begin(), normalized_query.slots_.end(), [](const ParameterSlot &slot) {
+        return slot.literal_.get() != nullptr;
+    });
+    if (parsed_result->IsError() && literal_taken) {
+        // A literal in a position the parser doesn't take `?` at, the statement has no parameters and the slots aren't read.
+        parsed_result = MakeShared<ParserResult>();
+        parser_->Parse(query, parsed_result.get());
+        return parsed_result;
+    }
+    if (normalized_query.select_ && IsCacheableStatement(*parsed_result)) {
+        statement_cache->Put(normalized_query.text_, parsed_result);
+    }
+    return parsed_result;
+}
+
+void QueryContext::BindParameters(const NormalizedQuery &normalized_query, const Vector<SharedPtr<ConstantExpr>> &parameters) {
+    parameter_values_.clear();
+    parameter_values_.reserve(normalized_query.slots_.size());
+    for (const ParameterSlot &slot : normalized_query.slots_) {
+        if (slot.literal_.get() != nullptr) {
+            parameter_values_.push_back(slot.literal_);
+        } else {
+            parameter_values_.push_back(slot.parameter_index_ < parameters.size() ? parameters[slot.parameter_index_] : nullptr);
+        }
+    }
+}
+
+const ConstantExpr *QueryContext::GetParameterValue(SizeT parameter_index) const {
+    if (parameter_index >= parameter_values_.size() || parameter_values_[parameter_index].get() == nullptr) {
+        Status status = Status::SyntaxError("A parameter of the statement has no value.");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    return parameter_values_[parameter_index].get();
+}
+
 QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
     QueryResult query_result;
     Vector<SharedPtr<LogicalNode>> logical_plans{};
@@ -171,7 +309,7 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *statement) {
         StopProfile(QueryPhase::kTaskBuild);
 //        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kExecution);
-        scheduler_->Schedule(plan_fragment.get(), statement);
+        scheduler_->Schedule(plan_fragment.get(), statement, session_ptr_->SessionVariables()->query_priority_);
         query_result.result_table_ = plan_fragment->GetResult();
         query_result.root_operator_type_ = logical_plans.back()->operator_type();
         StopProfile(QueryPhase::kExecution);
@@ -29,6 +29,9 @@ import optimizer;
 import status;
 import query_result;
 import base_statement;
+import parser_result;
+import statement_cache;
+import constant_expr;
 
 export module query_context;
 
@@ -64,6 +67,18 @@ public:
 
     QueryResult Query(const String &query);
 
+    // Parse the query and keep it in the session under the name, to be executed by `ExecutePrepared`. The query may have `$n` or `?`
+    // placeholders, which are bound to the parameters of each execution.
+    Status Prepare(const String &name, const String &query);
+
+    QueryResult ExecutePrepared(const String &name, const Vector<SharedPtr<ConstantExpr>> &parameters = {});
+
+    // The result columns of a prepared statement, from binding it without executing it. The result table has no rows.
+    QueryResult DescribePrepared(const String &name, const Vector<SharedPtr<ConstantExpr>> &parameters = {});
+
+    // The value of a parameter slot of the statement being bound, a literal taken out of the query or the parameter of a placeholder.
+    const ConstantExpr *GetParameterValue(SizeT parameter_index) const;
+
     QueryResult QueryStatement(const BaseStatement *statement);
 
     bool ExecuteBGStatement(BaseStatement *statement, BGQueryState &state);
@@ -78,6 +93,13 @@ public:
 
     [[nodiscard]] inline bool is_enable_profiling() const { return session_ptr_->SessionVariables()->enable_profile_; }
 
+    // Add statistics of an operator to the profile of the query, if profiling is enabled.
+    inline void AddProfileNote(String note) {
+        if (query_profiler_) {
+            query_profiler_->AddNote(std::move(note));
+        }
+    }
+
     [[nodiscard]] inline u64 memory_size_limit() const { return memory_size_limit_; }
 
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
@@ -130,6 +152,15 @@ public:
     }
 
 private:
+    // Parse the normalized query, or take its statement from the statement cache. A query whose literals the parser doesn't take `?` for
+    // is parsed as it is.
+    SharedPtr<ParserResult> Parse(const NormalizedQuery &normalized_query, const String &query);
+
+    // Set the values of the slots of the statement to be bound. A placeholder whose parameter isn't given has no value.
+    void BindParameters(const NormalizedQuery &normalized_query, const Vector<SharedPtr<ConstantExpr>> &parameters);
+
+    SharedPtr<ParserResult> PreparedParserResult(const PreparedStatement &prepared_statement);
+
     inline void CreateQueryProfiler() {
         if (is_enable_profiling()) {
             query_profiler_ = MakeShared<QueryProfiler>(true);
@@ -178,6 +209,9 @@ private:
 
     u64 catalog_version_{};
 
+    // the values of the parameter slots of the statement being bound
+    Vector<SharedPtr<ConstantExpr>> parameter_values_{};
+
     // User / Tenant information
     String tenant_name_;
     String user_name_;
@@ -22,6 +22,9 @@ import config;
 import options;
 import profiler;
 import catalog;
+import task_priority;
+import parser_result;
+import statement_cache;
 
 namespace infinity {
 
@@ -30,6 +33,8 @@ public:
     i64 query_count_{};
     i64 total_commit_count_{};
     bool enable_profile_{false};
+    // kInvalid: derive the scheduling class from the statement type
+    TaskPriorityClass query_priority_{TaskPriorityClass::kInvalid};
     i64 connected_time_{};
 };
 
@@ -38,6 +43,14 @@ export enum class SessionType {
     kRemote,
 };
 
+export struct PreparedStatement {
+    String query_{};
+    // The query with its literals and placeholders taken out, the slots are bound again by each execution.
+    NormalizedQuery normalized_query_{};
+    // The statement shared by the executions, nullptr if it can't be reused and each execution parses the query again.
+    SharedPtr<ParserResult> parsed_result_{};
+};
+
 export class BaseSession {
 
 public:
@@ -69,6 +82,18 @@ public:
 
     String ConnectedTimeToStr() const { return std::asctime(std::localtime(&connected_time_)); }
 
+    // A statement prepared again under the same name replaces the previous one.
+    void AddPreparedStatement(const String &name, PreparedStatement prepared_statement) {
+        prepared_statements_[name] = std::move(prepared_statement);
+    }
+
+    const PreparedStatement *GetPreparedStatement(const String &name) const {
+        auto iter = prepared_statements_.find(name);
+        return iter == prepared_statements_.end() ? nullptr : &iter->second;
+    }
+
+    void RemovePreparedStatement(const String &name) { prepared_statements_.erase(name); }
+
 protected:
     std::time_t connected_time_;
 
@@ -88,6 +113,8 @@ protected:
 
     u64 committed_txn_count_{0};
     u64 rollbacked_txn_count_{0};
+
+    HashMap<String, PreparedStatement> prepared_statements_{};
 };
 
 export class LocalSession : public BaseSession {
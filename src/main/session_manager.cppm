@@ -17,6 +17,8 @@ export module session_manager;
 
 import stl;
 import session;
+import statement_cache;
+import default_values;
 
 namespace infinity {
 
@@ -69,6 +71,8 @@ public:
 
     u64 total_query_count() const { return total_query_count_; }
 
+    StatementCache *statement_cache() { return &statement_cache_; }
+
 private:
     std::shared_mutex rw_locker_{};
     HashMap<u64, BaseSession*> sessions_;
@@ -77,6 +81,9 @@ private:
     atomic_u64 session_id_generator_{};
 
     Atomic<u64> total_query_count_{0};
+
+    // Parsed statements shared by the sessions.
+    StatementCache statement_cache_{STATEMENT_CACHE_CAPACITY};
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,461 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+module statement_cache;
+
+import stl;
+import parser_result;
+import base_statement;
+import constant_expr;
+
+namespace infinity {
+
+namespace {
+
+bool IsWordChar(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+SizeT SkipSpace(const String &query, SizeT pos) {
+    while (pos < query.size() && std::isspace(static_cast<unsigned char>(query[pos]))) {
+        ++pos;
+    }
+    return pos;
+}
+
+bool EqualsKeyword(std::string_view word, std::string_view keyword) {
+    return word.size() == keyword.size() &&
+           std::equal(word.begin(), word.end(), keyword.begin(), [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == b; });
+}
+
+// A number as the lexer reads it: -?[0-9]+ is an integer, -?[0-9]+.[0-9]* and .[0-9]* are floats. nullptr if there is no number at pos or
+// the integer is out of range, pos is moved past the number otherwise.
+SharedPtr<ConstantExpr> ReadNumber(const String &query, SizeT &pos) {
+    SizeT end = pos;
+    if (end < query.size() && query[end] == '-') {
+        ++end;
+    }
+    const SizeT digit_begin = end;
+    while (end < query.size() && std::isdigit(static_cast<unsigned char>(query[end]))) {
+        ++end;
+    }
+    const bool has_integer_part = end > digit_begin;
+    bool is_double = false;
+    if (end < query.size() && query[end] == '.' && (has_integer_part || query[pos] == '.')) {
+        is_double = true;
+        ++end;
+        while (end < query.size() && std::isdigit(static_cast<unsigned char>(query[end]))) {
+            ++end;
+        }
+    }
+    if ((!has_integer_part && !is_double) || (end < query.size() && IsWordChar(query[end]))) {
+        return nullptr;
+    }
+    SharedPtr<ConstantExpr> constant;
+    if (is_double) {
+        constant = MakeShared<ConstantExpr>(LiteralType::kDouble);
+        constant->double_value_ = std::strtod(query.c_str() + pos, nullptr);
+    } else {
+        i64 value = 0;
+        auto [ptr, ec] = std::from_chars(query.data() + pos, query.data() + end, value);
+        if (ec != std::errc() || ptr != query.data() + end) {
+            return nullptr;
+        }
+        constant = MakeShared<ConstantExpr>(LiteralType::kInteger);
+        constant->integer_value_ = value;
+    }
+    pos = end;
+    return constant;
+}
+
+// A flat array of integers or of floats, as the parser reads an array_expr. nullptr if there is none at pos, pos is moved past the array
+// otherwise.
+SharedPtr<ConstantExpr> ReadArray(const String &query, SizeT &pos) {
+    if (pos >= query.size() || query[pos] != '[') {
+        return nullptr;
+    }
+    SizeT end = pos + 1;
+    Vector<SharedPtr<ConstantExpr>> elements;
+    while (true) {
+        end = SkipSpace(query, end);
+        SharedPtr<ConstantExpr> element = ReadNumber(query, end);
+        if (element.get() == nullptr || (!elements.empty() && element->literal_type_ != elements.front()->literal_type_)) {
+            return nullptr;
+        }
+        elements.push_back(std::move(element));
+        end = SkipSpace(query, end);
+        if (end < query.size() && query[end] == ',') {
+            ++end;
+            continue;
+        }
+        if (end < query.size() && query[end] == ']') {
+            ++end;
+            break;
+        }
+        return nullptr;
+    }
+    SharedPtr<ConstantExpr> array;
+    if (elements.front()->literal_type_ == LiteralType::kInteger) {
+        array = MakeShared<ConstantExpr>(LiteralType::kIntegerArray);
+        for (const auto &element : elements) {
+            array->long_array_.push_back(element->integer_value_);
+        }
+    } else {
+        array = MakeShared<ConstantExpr>(LiteralType::kDoubleArray);
+        for (const auto &element : elements) {
+            array->double_array_.push_back(element->double_value_);
+        }
+    }
+    pos = end;
+    return array;
+}
+
+// The end of the quoted text starting at pos, a doubled quote inside a single quoted string is a quote. String::npos if it isn't closed.
+SizeT QuoteEnd(const String &query, SizeT pos) {
+    const char quote = query[pos];
+    for (SizeT end = pos + 1; end < query.size(); ++end) {
+        if (query[end] != quote) {
+            continue;
+        }
+        if (quote == '\'' && end + 1 < query.size() && query[end + 1] == '\'') {
+            ++end;
+            continue;
+        }
+        return end + 1;
+    }
+    return String::npos;
+}
+
+// Whether a literal taken out of a filter is followed by what an operand can be followed by, and not, say, by the unit of an interval.
+bool EndsOperand(const String &query, SizeT pos) {
+    pos = SkipSpace(query, pos);
+    if (pos == query.size() || query[pos] == ')' || query[pos] == ',' || query[pos] == ';') {
+        return true;
+    }
+    SizeT end = pos;
+    while (end < query.size() && IsWordChar(query[end])) {
+        ++end;
+    }
+    std::string_view word(query.data() + pos, end - pos);
+    for (std::string_view keyword : {"AND", "OR", "ORDER", "GROUP", "HAVING", "LIMIT", "OFFSET", "UNION", "INTERSECT", "EXCEPT"}) {
+        if (EqualsKeyword(word, keyword)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+class QueryNormalizer {
+public:
+    explicit QueryNormalizer(const String &query) : query_(query) {}
+
+    NormalizedQuery Normalize();
+
+private:
+    enum class LiteralPosition {
+        kNone,
+        // the operand of a comparison, or a bound of a between, in a filter
+        kFilter,
+        // the query vector of a MATCH VECTOR
+        kQueryVector,
+    };
+
+    struct Paren {
+        bool match_vector_{false};
+        SizeT comma_count_{};
+    };
+
+    void Emit(std::string_view token) {
+        if (pending_space_ && !normalized_.text_.empty()) {
+            normalized_.text_.push_back(' ');
+        }
+        pending_space_ = false;
+        normalized_.text_.append(token);
+    }
+
+    void EmitSlot(ParameterSlot slot) {
+        Emit("?");
+        normalized_.slots_.push_back(std::move(slot));
+    }
+
+    // Take the literal at pos_ out of the query if it is in a position the parser takes a `?` at, return whether it is taken.
+    bool TakeLiteral();
+
+    void OnWord(std::string_view word);
+
+    const String &query_;
+    SizeT pos_{};
+    NormalizedQuery normalized_{};
+    bool pending_space_{false};
+    SizeT sequential_parameter_count_{};
+
+    // the state of the select query around pos_
+    bool in_filter_{false};
+    bool after_comparison_{false};
+    bool between_open_{false};
+    bool after_between_{false};
+    bool after_match_{false};
+    bool match_vector_pending_{false};
+    bool after_query_vector_comma_{false};
+    Vector<Paren> parens_{};
+};
+
+bool QueryNormalizer::TakeLiteral() {
+    LiteralPosition position = LiteralPosition::kNone;
+    if (after_query_vector_comma_) {
+        position = LiteralPosition::kQueryVector;
+    } else if (in_filter_ && (after_comparison_ || after_between_)) {
+        position = LiteralPosition::kFilter;
+    }
+    if (!normalized_.select_ || position == LiteralPosition::kNone) {
+        return false;
+    }
+
+    SizeT end = pos_;
+    SharedPtr<ConstantExpr> literal;
+    const char c = query_[pos_];
+    if (c == '[') {
+        literal = ReadArray(query_, end);
+    } else if (position == LiteralPosition::kQueryVector) {
+        return false;
+    } else if (c == '\'') {
+        end = QuoteEnd(query_, pos_);
+        if (end == String::npos) {
+            return false;
+        }
+        String value;
+        for (SizeT i = pos_ + 1; i + 1 < end; ++i) {
+            value.push_back(query_[i]);
+            if (query_[i] == '\'') {
+                ++i;
+            }
+        }
+        literal = MakeShared<ConstantExpr>(LiteralType::kString);
+        literal->str_value_ = strdup(value.c_str());
+    } else {
+        literal = ReadNumber(query_, end);
+    }
+    if (literal.get() == nullptr) {
+        return false;
+    }
+    if (position == LiteralPosition::kQueryVector ? query_[SkipSpace(query_, end)] != ',' : !EndsOperand(query_, end)) {
+        return false;
+    }
+    EmitSlot(ParameterSlot{std::move(literal), 0});
+    pos_ = end;
+    return true;
+}
+
+void QueryNormalizer::OnWord(std::string_view word) {
+    if (EqualsKeyword(word, "WHERE") || EqualsKeyword(word, "HAVING")) {
+        in_filter_ = true;
+    } else if (EqualsKeyword(word, "SELECT") || EqualsKeyword(word, "GROUP") || EqualsKeyword(word, "ORDER") || EqualsKeyword(word, "LIMIT") ||
+               EqualsKeyword(word, "WITH")) {
+        // the index parameters after WITH are identifiers and literals only
+        in_filter_ = false;
+    } else if (EqualsKeyword(word, "BETWEEN")) {
+        between_open_ = true;
+        after_between_ = true;
+    } else if (EqualsKeyword(word, "AND") && between_open_) {
+        between_open_ = false;
+        after_between_ = true;
+    }
+    match_vector_pending_ = after_match_ && EqualsKeyword(word, "VECTOR");
+    after_match_ = EqualsKeyword(word, "MATCH");
+}
+
+NormalizedQuery QueryNormalizer::Normalize() {
+    SizeT first = SkipSpace(query_, 0);
+    while (first < query_.size() && query_[first] == '(') {
+        first = SkipSpace(query_, first + 1);
+    }
+    SizeT first_end = first;
+    while (first_end < query_.size() && IsWordChar(query_[first_end])) {
+        ++first_end;
+    }
+    normalized_.select_ = EqualsKeyword(std::string_view(query_.data() + first, first_end - first), "SELECT");
+
+    while (pos_ < query_.size()) {
+        const char c = query_[pos_];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pending_space_ = true;
+            ++pos_;
+            continue;
+        }
+
+        const bool literal_taken = TakeLiteral();
+        const bool was_match_vector_pending = match_vector_pending_;
+        after_comparison_ = false;
+        after_between_ = false;
+        after_query_vector_comma_ = false;
+        if (literal_taken) {
+            match_vector_pending_ = false;
+            after_match_ = false;
+            continue;
+        }
+
+        if (c == '\'' || c == '"') {
+            SizeT end = QuoteEnd(query_, pos_);
+            end = end == String::npos ? query_.size() : end;
+            Emit(std::string_view(query_.data() + pos_, end - pos_));
+            pos_ = end;
+            match_vector_pending_ = false;
+            after_match_ = false;
+            continue;
+        }
+        if (c == '?') {
+            EmitSlot(ParameterSlot{nullptr, sequential_parameter_count_++});
+            normalized_.parameter_count_ = std::max(normalized_.parameter_count_, sequential_parameter_count_);
+            ++pos_;
+            match_vector_pending_ = false;
+            after_match_ = false;
+            continue;
+        }
+        if (c == '$' && pos_ + 1 < query_.size() && std::isdigit(static_cast<unsigned char>(query_[pos_ + 1]))) {
+            SizeT end = pos_ + 1;
+            SizeT index = 0;
+            while (end < query_.size() && std::isdigit(static_cast<unsigned char>(query_[end]))) {
+                index = index * 10 + (query_[end] - '0');
+                ++end;
+            }
+            if (index > 0) {
+                EmitSlot(ParameterSlot{nullptr, index - 1});
+                normalized_.parameter_count_ = std::max(normalized_.parameter_count_, index);
+            } else {
+                Emit(std::string_view(query_.data() + pos_, end - pos_));
+            }
+            pos_ = end;
+            match_vector_pending_ = false;
+            after_match_ = false;
+            continue;
+        }
+        if (IsWordChar(c)) {
+            SizeT end = pos_;
+            while (end < query_.size() && IsWordChar(query_[end])) {
+                ++end;
+            }
+            std::string_view word(query_.data() + pos_, end - pos_);
+            Emit(word);
+            OnWord(word);
+            pos_ = end;
+            continue;
+        }
+
+        SizeT length = 1;
+        if (pos_ + 1 < query_.size()) {
+            std::string_view two_chars(query_.data() + pos_, 2);
+            if (two_chars == "==" || two_chars == "!=" || two_chars == "<>" || two_chars == "<=" || two_chars == ">=") {
+                length = 2;
+            }
+        }
+        Emit(std::string_view(query_.data() + pos_, length));
+        pos_ += length;
+        if (length == 2 || c == '=' || c == '<' || c == '>') {
+            after_comparison_ = true;
+        } else if (c == '(') {
+            parens_.push_back(Paren{was_match_vector_pending, 0});
+        } else if (c == ')') {
+            if (!parens_.empty()) {
+                parens_.pop_back();
+            }
+        } else if (c == ',') {
+            if (!parens_.empty()) {
+                Paren &paren = parens_.back();
+                ++paren.comma_count_;
+                after_query_vector_comma_ = paren.match_vector_ && paren.comma_count_ == 1;
+            }
+        }
+        match_vector_pending_ = false;
+        after_match_ = false;
+    }
+
+    String &text = normalized_.text_;
+    while (!text.empty() && (text.back() == ';' || text.back() == ' ')) {
+        text.pop_back();
+    }
+    return std::move(normalized_);
+}
+
+} // namespace
+
+NormalizedQuery NormalizeQuery(const String &query) { return QueryNormalizer(query).Normalize(); }
+
+SharedPtr<ConstantExpr> ParseParameterValue(const String &text) {
+    SizeT pos = SkipSpace(text, 0);
+    SharedPtr<ConstantExpr> value = pos < text.size() && text[pos] == '[' ? ReadArray(text, pos) : ReadNumber(text, pos);
+    if (value.get() != nullptr && SkipSpace(text, pos) == text.size()) {
+        return value;
+    }
+    value = MakeShared<ConstantExpr>(LiteralType::kString);
+    value->str_value_ = strdup(text.c_str());
+    return value;
+}
+
+bool IsCacheableStatement(const ParserResult &parsed_result) {
+    if (parsed_result.IsError() || parsed_result.statements_ptr_ == nullptr || parsed_result.statements_ptr_->size() != 1) {
+        return false;
+    }
+    return (*parsed_result.statements_ptr_)[0]->type_ == StatementType::kSelect;
+}
+
+StatementCache::StatementCache(SizeT capacity, SizeT shard_count)
+    : shard_capacity_((capacity + shard_count - 1) / shard_count), shards_(shard_count) {}
+
+SharedPtr<ParserResult> StatementCache::Get(const String &key) {
+    Shard &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto iter = shard.entry_map_.find(key);
+    if (iter == shard.entry_map_.end()) {
+        ++miss_count_;
+        return nullptr;
+    }
+    ++hit_count_;
+    shard.entries_.splice(shard.entries_.begin(), shard.entries_, iter->second);
+    return iter->second->second;
+}
+
+void StatementCache::Put(const String &key, SharedPtr<ParserResult> parsed_result) {
+    if (shard_capacity_ == 0) {
+        return;
+    }
+    Shard &shard = GetShard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto iter = shard.entry_map_.find(key);
+    if (iter != shard.entry_map_.end()) {
+        iter->second->second = std::move(parsed_result);
+        shard.entries_.splice(shard.entries_.begin(), shard.entries_, iter->second);
+        return;
+    }
+    if (shard.entries_.size() == shard_capacity_) {
+        shard.entry_map_.erase(shard.entries_.back().first);
+        shard.entries_.pop_back();
+    }
+    shard.entries_.emplace_front(key, std::move(parsed_result));
+    shard.entry_map_.emplace(key, shard.entries_.begin());
+}
+
+SizeT StatementCache::size() {
+    SizeT size = 0;
+    for (Shard &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        size += shard.entries_.size();
+    }
+    return size;
+}
+
+} // namespace infinity
@@ -0,0 +1,95 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module statement_cache;
+
+import stl;
+import parser_result;
+import constant_expr;
+
+namespace infinity {
+
+export struct ParameterSlot {
+    // The literal taken out of the query, nullptr for a `?` or `$n` placeholder.
+    SharedPtr<ConstantExpr> literal_{};
+    // The parameter of a placeholder, from 0.
+    SizeT parameter_index_{};
+};
+
+export struct NormalizedQuery {
+    // The key of the query in the statement cache and the text which is parsed: each parameter slot is replaced by `?`, runs of whitespace
+    // out of quotes are collapsed into one space, and the leading and trailing whitespace and semicolons are removed.
+    String text_{};
+    // The slots in the order of their `?` in the text, which is the order of the parameter indexes given by the parser.
+    Vector<ParameterSlot> slots_{};
+    // The number of parameters the placeholders take.
+    SizeT parameter_count_{};
+    // Only a select query is looked up in the statement cache.
+    bool select_{false};
+};
+
+// Take the literals and the placeholders out of a query. The literals taken out of a select query are the constants compared with in its
+// where and having clauses and the query vectors of its MATCH VECTOR, so that the queries which only differ in them share a statement.
+export NormalizedQuery NormalizeQuery(const String &query);
+
+// The value of a parameter given as text, read as the parser reads a literal: an integer, a float, an array of either, or else a string.
+export SharedPtr<ConstantExpr> ParseParameterValue(const String &text);
+
+// Whether the parsed query can be shared by the executions of the query. Only a single select statement is, the planner moves the
+// members out of the other statements.
+export bool IsCacheableStatement(const ParserResult &parsed_result);
+
+// LRU cache of parsed statements keyed by normalized query. A query hitting the cache skips the parser, and its slots are bound to the
+// literals and the parameters of the execution. Its statement is still bound and planned by each execution, against the catalog of the
+// transaction of the execution, so a cached statement never goes stale on a catalog change. The entries are split into shards by key, each
+// with its own lock and its share of the capacity, so that concurrent queries rarely wait for each other.
+export class StatementCache {
+public:
+    explicit StatementCache(SizeT capacity, SizeT shard_count = STATEMENT_CACHE_SHARD_COUNT);
+
+    // nullptr on a miss.
+    SharedPtr<ParserResult> Get(const String &key);
+
+    void Put(const String &key, SharedPtr<ParserResult> parsed_result);
+
+    SizeT size();
+
+    [[nodiscard]] inline u64 hit_count() const { return hit_count_; }
+
+    [[nodiscard]] inline u64 miss_count() const { return miss_count_; }
+
+private:
+    using Entry = Pair<String, SharedPtr<ParserResult>>;
+
+    struct Shard {
+        std::mutex mutex_{};
+        // The most recently used entry first.
+        List<Entry> entries_{};
+        HashMap<String, List<Entry>::iterator> entry_map_{};
+    };
+
+    static constexpr SizeT STATEMENT_CACHE_SHARD_COUNT = 16;
+
+    Shard &GetShard(const String &key) { return shards_[std::hash<String>{}(key) % shards_.size()]; }
+
+    SizeT shard_capacity_{};
+    Vector<Shard> shards_;
+
+    Atomic<u64> hit_count_{0};
+    Atomic<u64> miss_count_{0};
+};
+
+} // namespace infinity
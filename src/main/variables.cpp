@@ -35,12 +35,16 @@ void VarUtil::InitVariablesMap() {
     global_name_map_["total_rollback_count"] = GlobalVariable::kTotalRollbackCount;
     global_name_map_["active_wal_filename"] = GlobalVariable::kActiveWALFilename;
     global_name_map_["profile_record_capacity"] = GlobalVariable::kProfileRecordCapacity;
+    global_name_map_["interactive_task_queue"] = GlobalVariable::kInteractiveTaskQueue;
+    global_name_map_["normal_task_queue"] = GlobalVariable::kNormalTaskQueue;
+    global_name_map_["background_task_queue"] = GlobalVariable::kBackgroundTaskQueue;
 
     session_name_map_["query_count"] = SessionVariable::kQueryCount;
     session_name_map_["total_commit_count"] = SessionVariable::kTotalCommitCount;
     session_name_map_["total_rollback_count"] = SessionVariable::kTotalRollbackCount;
     session_name_map_["connected_timestamp"] = SessionVariable::kConnectedTime;
     session_name_map_["enable_profile"] = SessionVariable::kEnableProfile;
+    session_name_map_["query_priority"] = SessionVariable::kQueryPriority;
 }
 
 HashMap<String, GlobalVariable> VarUtil::global_name_map_;
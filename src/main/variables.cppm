@@ -37,6 +37,9 @@ export enum class GlobalVariable {
     kTotalRollbackCount,        // global
     kActiveWALFilename,         // global
     kProfileRecordCapacity,     // global
+    kInteractiveTaskQueue,      // global
+    kNormalTaskQueue,           // global
+    kBackgroundTaskQueue,       // global
 
     kInvalid,
 };
@@ -47,6 +50,7 @@ export enum class SessionVariable {
     kTotalRollbackCount,        // session
     kConnectedTime,             // session
     kEnableProfile,             // session
+    kQueryPriority,             // session
 
     kInvalid,
 };
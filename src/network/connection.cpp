@@ -38,6 +38,9 @@ import type_info;
 import logical_type;
 import embedding_info;
 import data_type;
+import status;
+import statement_cache;
+import constant_expr;
 
 namespace infinity {
 
@@ -101,6 +104,11 @@ void Connection::HandleConnection() {
 void Connection::HandleRequest() {
     const auto cmd_type = pg_handler_->read_command_type();
 
+    if (skip_until_sync_ && cmd_type != PGMessageType::kSyncCommand && cmd_type != PGMessageType::kTerminateCommand) {
+        pg_handler_->skip_command_body();
+        return;
+    }
+
     // FIXME
     UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_.get());
     query_context_ptr->Init(InfinityContext::instance().config(),
@@ -111,19 +119,28 @@ void Connection::HandleRequest() {
 
     switch (cmd_type) {
         case PGMessageType::kBindCommand: {
-            LOG_TRACE("BindCommand");
+            HandlerBind();
             break;
         }
         case PGMessageType::kDescribeCommand: {
-            LOG_TRACE("DescribeCommand");
+            HandlerDescribe(query_context_ptr.get());
             break;
         }
         case PGMessageType::kExecuteCommand: {
-            LOG_TRACE("ExecuteCommand");
+            HandlerExecute(query_context_ptr.get());
             break;
         }
         case PGMessageType::kParseCommand: {
-            LOG_TRACE("ParseCommand");
+            HandlerParse(query_context_ptr.get());
+            break;
+        }
+        case PGMessageType::kCloseCommand: {
+            HandlerClose();
+            break;
+        }
+        case PGMessageType::kFlushCommand: {
+            pg_handler_->skip_command_body();
+            pg_handler_->force_flush();
             break;
         }
         case PGMessageType::kSimpleQueryCommand: {
@@ -131,7 +148,7 @@ void Connection::HandleRequest() {
             break;
         }
         case PGMessageType::kSyncCommand: {
-            LOG_TRACE("SyncCommand");
+            HandlerSync();
             break;
         }
         case PGMessageType::kTerminateCommand: {
@@ -165,7 +182,128 @@ void Connection::HandlerSimpleQuery(QueryContext *query_context) {
     pg_handler_->send_ready_for_query();
 }
 
-void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
+void Connection::HandlerParse(QueryContext *query_context) {
+    auto [statement_name, query] = pg_handler_->read_parse_packet();
+    LOG_TRACE(fmt::format("Parse: {}", query));
+
+    Status status = query_context->Prepare(statement_name, query);
+    if (!status.ok()) {
+        SendExtendedQueryError(status.message());
+        return;
+    }
+    pg_handler_->send_status_message(PGMessageType::kParseComplete);
+}
+
+void Connection::HandlerBind() {
+    PGBindPacket bind_packet = pg_handler_->read_bind_packet();
+    const PreparedStatement *prepared_statement = session_->GetPreparedStatement(bind_packet.statement_name_);
+    if (prepared_statement == nullptr) {
+        SendExtendedQueryError(fmt::format("Prepared statement {} doesn't exist", bind_packet.statement_name_));
+        return;
+    }
+    if (bind_packet.parameters_.size() != prepared_statement->normalized_query_.parameter_count_) {
+        SendExtendedQueryError(fmt::format("Prepared statement {} takes {} parameters, {} are given",
+                                           bind_packet.statement_name_,
+                                           prepared_statement->normalized_query_.parameter_count_,
+                                           bind_packet.parameters_.size()));
+        return;
+    }
+    for (i16 parameter_format : bind_packet.parameter_formats_) {
+        if (parameter_format != 0) {
+            SendExtendedQueryError("Parameters in binary format aren't supported");
+            return;
+        }
+    }
+
+    portals_.erase(bind_packet.portal_name_);
+    Portal &portal = portals_[bind_packet.portal_name_];
+    portal.statement_name_ = bind_packet.statement_name_;
+    portal.parameters_.reserve(bind_packet.parameters_.size());
+    for (const Optional<String> &parameter : bind_packet.parameters_) {
+        portal.parameters_.push_back(parameter.has_value() ? ParseParameterValue(*parameter) : MakeShared<ConstantExpr>(LiteralType::kNull));
+    }
+    pg_handler_->send_status_message(PGMessageType::kBindComplete);
+}
+
+void Connection::HandlerDescribe(QueryContext *query_context) {
+    auto [object_kind, object_name] = pg_handler_->read_object_packet();
+    if (object_kind == 'S') {
+        const PreparedStatement *prepared_statement = session_->GetPreparedStatement(object_name);
+        if (prepared_statement == nullptr) {
+            SendExtendedQueryError(fmt::format("Prepared statement {} doesn't exist", object_name));
+            return;
+        }
+        // The result columns of a statement are only known once it is planned, the client gets them by describing its portal.
+        pg_handler_->send_parameter_description(prepared_statement->normalized_query_.parameter_count_);
+        pg_handler_->send_status_message(PGMessageType::kNoData);
+        return;
+    }
+
+    auto iter = portals_.find(object_name);
+    if (iter == portals_.end()) {
+        SendExtendedQueryError(fmt::format("Portal {} doesn't exist", object_name));
+        return;
+    }
+    // The result columns of a portal are described by binding its statement, it is only executed by Execute.
+    QueryResult description = query_context->DescribePrepared(iter->second.statement_name_, iter->second.parameters_);
+    if (description.result_table_.get() == nullptr) {
+        SendExtendedQueryError(description.status_.message());
+        return;
+    }
+    if (!SendTableDescription(description.result_table_)) {
+        pg_handler_->send_status_message(PGMessageType::kNoData);
+    }
+}
+
+void Connection::HandlerExecute(QueryContext *query_context) {
+    String portal_name = pg_handler_->read_execute_packet();
+    auto iter = portals_.find(portal_name);
+    if (iter == portals_.end()) {
+        SendExtendedQueryError(fmt::format("Portal {} doesn't exist", portal_name));
+        return;
+    }
+    if (!ExecutePortal(query_context, iter->second)) {
+        return;
+    }
+    SendQueryResponse(iter->second.result_);
+    portals_.erase(iter);
+}
+
+void Connection::HandlerClose() {
+    auto [object_kind, object_name] = pg_handler_->read_object_packet();
+    if (object_kind == 'S') {
+        session_->RemovePreparedStatement(object_name);
+    } else {
+        portals_.erase(object_name);
+    }
+    pg_handler_->send_status_message(PGMessageType::kCloseComplete);
+}
+
+void Connection::HandlerSync() {
+    pg_handler_->read_sync_packet();
+    skip_until_sync_ = false;
+    // Each statement commits its own transaction, which the portals don't outlive.
+    portals_.clear();
+    pg_handler_->send_ready_for_query();
+}
+
+bool Connection::ExecutePortal(QueryContext *query_context, Portal &portal) {
+    portal.result_ = query_context->ExecutePrepared(portal.statement_name_, portal.parameters_);
+    if (portal.result_.result_table_.get() == nullptr) {
+        SendExtendedQueryError(portal.result_.status_.message());
+        return false;
+    }
+    return true;
+}
+
+void Connection::SendExtendedQueryError(const String &error_message) {
+    HashMap<PGMessageType, String> error_message_map;
+    error_message_map[PGMessageType::kHumanReadableError] = error_message;
+    pg_handler_->send_error_response(error_message_map);
+    skip_until_sync_ = true;
+}
+
+bool Connection::SendTableDescription(const SharedPtr<DataTable> &result_table) {
     u32 column_name_length_sum = 0;
     SizeT column_count = result_table->ColumnCount();
     for (SizeT idx = 0; idx < column_count; ++idx) {
@@ -174,7 +312,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
     // No output columns, no need to send table description, just return.
     if (column_name_length_sum == 0)
-        return;
+        return false;
 
     pg_handler_->SendDescriptionHeader(column_name_length_sum, column_count);
 
@@ -295,6 +433,17 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
                         object_width = 8;
                         break;
                     }
+                    case kElemUInt8: {
+                        // postgres has no unsigned types, uint8 is sent as an int2 array
+                        object_id = 1005;
+                        object_width = 1;
+                        break;
+                    }
+                    case kElemFloat16: {
+                        object_id = 1021;
+                        object_width = 2;
+                        break;
+                    }
                     case kElemInvalid: {
                         UnrecoverableError("Invalid embedding data type");
                     }
@@ -308,6 +457,7 @@ void Connection::SendTableDescription(const SharedPtr<DataTable> &result_table)
 
         pg_handler_->SendDescription(result_table->GetColumnNameById(idx), object_id, object_width);
     }
+    return true;
 }
 
 void Connection::SendQueryResponse(const QueryResult &query_result) {
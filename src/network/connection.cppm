@@ -23,6 +23,7 @@ import pg_protocol_handler;
 import query_context;
 import data_table;
 import query_result;
+import constant_expr;
 
 namespace infinity {
 
@@ -43,7 +44,33 @@ private:
 
     void HandlerSimpleQuery(QueryContext *query_context);
 
-    void SendTableDescription(const SharedPtr<DataTable> &result_table);
+    // Extended query protocol: a statement is prepared by Parse, bound into a portal by Bind and executed by Execute.
+    void HandlerParse(QueryContext *query_context);
+
+    void HandlerBind();
+
+    void HandlerDescribe(QueryContext *query_context);
+
+    void HandlerExecute(QueryContext *query_context);
+
+    void HandlerClose();
+
+    void HandlerSync();
+
+    struct Portal {
+        String statement_name_{};
+        Vector<SharedPtr<ConstantExpr>> parameters_{};
+        QueryResult result_{};
+    };
+
+    // Execute the portal, send an error and return false if it fails.
+    bool ExecutePortal(QueryContext *query_context, Portal &portal);
+
+    // Send the error, and skip the messages until the next Sync.
+    void SendExtendedQueryError(const String &error_message);
+
+    // Return false if there is no column to describe.
+    bool SendTableDescription(const SharedPtr<DataTable> &result_table);
 
     void SendQueryResponse(const QueryResult &query_result);
 
@@ -54,6 +81,10 @@ private:
 
     bool terminate_connection_ = false;
 
+    bool skip_until_sync_ = false;
+
+    HashMap<String, Portal> portals_{};
+
     SharedPtr<RemoteSession> session_{};
 };
 
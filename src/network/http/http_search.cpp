@@ -33,6 +33,7 @@ import statement_common;
 import query_result;
 import data_block;
 import value;
+import internal_types;
 
 namespace infinity {
 
@@ -58,6 +59,8 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
         MatchExpr *match_expr{nullptr};
         // SearchExpr *search_expr = new SearchExpr();
         SearchExpr *search_expr{nullptr};
+        // A knn query_vector of several vectors is searched as a batch, the output is grouped by query
+        bool batch_query = false;
         DeferFn defer_fn([&]() {
             if (output_columns != nullptr) {
                 for (auto &expr : *output_columns) {
@@ -200,6 +203,9 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                     response["error_message"] = "KNN field should be object";
                     return;
                 }
+                if (auto iter = knn_json.find("query_vector"); iter != knn_json.end()) {
+                    batch_query = iter->is_array() && !iter->empty() && iter->front().is_array();
+                }
                 knn_expr = ParseKnn(knn_json, http_status, response);
                 if (knn_expr == nullptr) {
                     return;
@@ -232,6 +238,20 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
             search_exprs = nullptr;
         }
 
+        if (batch_query) {
+            if (output_columns == nullptr) {
+                output_columns = new Vector<ParsedExpr *>();
+            }
+            // the last output column tells the query of each row
+            nlohmann::json query_index_json = "query_index()";
+            Vector<ParsedExpr *> *query_index_column = ParseOutput(nlohmann::json::array({query_index_json}), http_status, response);
+            if (query_index_column == nullptr) {
+                return;
+            }
+            output_columns->push_back(query_index_column->front());
+            delete query_index_column;
+        }
+
         const QueryResult result = infinity_ptr->Search(db_name, table_name, search_expr, filter, output_columns);
 
         output_columns = nullptr;
@@ -239,10 +259,16 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
         search_expr = nullptr;
         if (result.IsOk()) {
             SizeT block_rows = result.result_table_->DataBlockCount();
+            if (batch_query) {
+                response["output"] = nlohmann::json::array();
+            }
             for (SizeT block_id = 0; block_id < block_rows; ++block_id) {
                 DataBlock *data_block = result.result_table_->GetDataBlockById(block_id).get();
                 auto row_count = data_block->row_count();
                 auto column_cnt = result.result_table_->ColumnCount();
+                if (batch_query) {
+                    --column_cnt;
+                }
 
                 for (int row = 0; row < row_count; ++row) {
                     nlohmann::json json_result_row;
@@ -252,7 +278,17 @@ void HTTPSearch::Process(Infinity *infinity_ptr,
                         const String &column_value = value.ToString();
                         json_result_row[column_name] = column_value;
                     }
-                    response["output"].push_back(json_result_row);
+                    if (batch_query) {
+                        // output is an array of result sets, one for each query
+                        SizeT query_index = data_block->GetValue(column_cnt, row).GetValue<IntegerT>();
+                        auto &output = response["output"];
+                        while (output.size() <= query_index) {
+                            output.push_back(nlohmann::json::array());
+                        }
+                        output[query_index].push_back(json_result_row);
+                    } else {
+                        response["output"].push_back(json_result_row);
+                    }
                 }
             }
 
@@ -366,7 +402,21 @@ KnnExpr *HTTPSearch::ParseKnn(nlohmann::json &knn_json_object, HTTPStatus &http_
                 return nullptr;
             }
 
-            auto [dimension, embedding_ptr] = ParseVector(field_json_obj.value(), knn_expr->embedding_data_type_, http_status, response);
+            auto &query_vector = field_json_obj.value();
+            if (query_vector.is_array() && !query_vector.empty() && query_vector.front().is_array()) {
+                // a batch of query vectors of the same dimension, they are concatenated
+                nlohmann::json flat_vector = nlohmann::json::array();
+                for (const auto &sub_vector : query_vector) {
+                    if (!sub_vector.is_array() || sub_vector.size() != query_vector.front().size()) {
+                        response["error_code"] = ErrorCode::kInvalidExpression;
+                        response["error_message"] = "Query vectors of a batch should have the same dimension";
+                        return nullptr;
+                    }
+                    flat_vector.insert(flat_vector.end(), sub_vector.begin(), sub_vector.end());
+                }
+                query_vector = std::move(flat_vector);
+            }
+            auto [dimension, embedding_ptr] = ParseVector(query_vector, knn_expr->embedding_data_type_, http_status, response);
             knn_expr->dimension_ = dimension;
             knn_expr->embedding_data_ptr_ = embedding_ptr;
         } else if (IsEqual(key, "element_type")) {
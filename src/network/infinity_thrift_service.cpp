@@ -1804,6 +1804,13 @@ infinity_thrift_rpc::ElementType::type InfinityThriftService::EmbeddingDataTypeT
             return infinity_thrift_rpc::ElementType::ElementFloat32;
         case EmbeddingDataType::kElemDouble:
             return infinity_thrift_rpc::ElementType::ElementFloat64;
+        case EmbeddingDataType::kElemUInt8:
+        case EmbeddingDataType::kElemFloat16: {
+            Status status = Status::NotSupport(
+                fmt::format("Embedding element type {} is not supported by the thrift protocol", EmbeddingType::EmbeddingDataType2String(embedding_info.Type())));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
         case EmbeddingDataType::kElemInvalid: {
             UnrecoverableError("Invalid embedding element data type");
         }
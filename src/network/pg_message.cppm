@@ -25,6 +25,9 @@ constexpr auto LENGTH_FIELD_SIZE = 4u;
 
 constexpr char NULL_END = '\0';
 
+// OID of the text type
+constexpr u32 TEXT_TYPE_OID = 25;
+
 enum class NullTerminator : bool {
     kYes = true,
     kNo = false,
@@ -40,6 +43,11 @@ enum class PGMessageType : unsigned char {
     kRowDescription = 'T',
     kData = 'D',
     kComplete = 'C',
+    kParseComplete = '1',
+    kBindComplete = '2',
+    kCloseComplete = '3',
+    kNoData = 'n',
+    kParameterDescription = 't',
 
     // Errors
     kHumanReadableError = 'M',
@@ -77,6 +77,83 @@ String PGProtocolHandler::read_command_body() {
     return buffer_reader_.read_string(command_length);
 }
 
+void PGProtocolHandler::skip_command_body() {
+    const auto body_length = buffer_reader_.read_value_u32() - LENGTH_FIELD_SIZE;
+    buffer_reader_.read_string(body_length, NullTerminator::kNo);
+}
+
+Pair<String, String> PGProtocolHandler::read_parse_packet() {
+    buffer_reader_.read_value_u32();
+    String statement_name = buffer_reader_.read_string();
+    String query = buffer_reader_.read_string();
+
+    const auto parameter_type_count = buffer_reader_.read_value_u16();
+    for (u16 idx = 0; idx < parameter_type_count; ++idx) {
+        buffer_reader_.read_value_u32();
+    }
+    return {std::move(statement_name), std::move(query)};
+}
+
+PGBindPacket PGProtocolHandler::read_bind_packet() {
+    PGBindPacket bind_packet;
+    buffer_reader_.read_value_u32();
+    bind_packet.portal_name_ = buffer_reader_.read_string();
+    bind_packet.statement_name_ = buffer_reader_.read_string();
+
+    const auto parameter_format_count = buffer_reader_.read_value_u16();
+    bind_packet.parameter_formats_.reserve(parameter_format_count);
+    for (u16 idx = 0; idx < parameter_format_count; ++idx) {
+        bind_packet.parameter_formats_.push_back(buffer_reader_.read_value_i16());
+    }
+
+    const auto parameter_count = buffer_reader_.read_value_u16();
+    bind_packet.parameters_.reserve(parameter_count);
+    for (u16 idx = 0; idx < parameter_count; ++idx) {
+        const auto value_length = buffer_reader_.read_value_i32();
+        if (value_length == -1) {
+            bind_packet.parameters_.emplace_back(None);
+        } else {
+            bind_packet.parameters_.emplace_back(buffer_reader_.read_string(value_length, NullTerminator::kNo));
+        }
+    }
+
+    const auto result_format_count = buffer_reader_.read_value_u16();
+    for (u16 idx = 0; idx < result_format_count; ++idx) {
+        buffer_reader_.read_value_i16();
+    }
+    return bind_packet;
+}
+
+Pair<char, String> PGProtocolHandler::read_object_packet() {
+    buffer_reader_.read_value_u32();
+    const char object_kind = buffer_reader_.read_value_i8();
+    String object_name = buffer_reader_.read_string();
+    return {object_kind, std::move(object_name)};
+}
+
+String PGProtocolHandler::read_execute_packet() {
+    buffer_reader_.read_value_u32();
+    String portal_name = buffer_reader_.read_string();
+    buffer_reader_.read_value_u32();
+    return portal_name;
+}
+
+void PGProtocolHandler::read_sync_packet() { buffer_reader_.read_value_u32(); }
+
+void PGProtocolHandler::send_status_message(const PGMessageType message_type) {
+    buffer_writer_.send_value_u8(static_cast<u8>(message_type));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE);
+}
+
+void PGProtocolHandler::send_parameter_description(u16 parameter_count) {
+    buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kParameterDescription));
+    buffer_writer_.send_value_u32(LENGTH_FIELD_SIZE + sizeof(u16) + parameter_count * sizeof(u32));
+    buffer_writer_.send_value_u16(parameter_count);
+    for (u16 idx = 0; idx < parameter_count; ++idx) {
+        buffer_writer_.send_value_u32(TEXT_TYPE_OID);
+    }
+}
+
 void PGProtocolHandler::send_error_response(const HashMap<PGMessageType, String> &error_response_map) {
     // message header
     buffer_writer_.send_value_u8(static_cast<u8>(PGMessageType::kError));
@@ -23,6 +23,16 @@ export module pg_protocol_handler;
 
 namespace infinity {
 
+// Body of a Bind message of the extended query protocol.
+export struct PGBindPacket {
+    String portal_name_{};
+    String statement_name_{};
+    // Format codes of the parameters, 0 for text and 1 for binary. None means all are text and a single one applies to all.
+    Vector<i16> parameter_formats_{};
+    // Values of the parameters, nullopt for a null.
+    Vector<Optional<String>> parameters_{};
+};
+
 export class PGProtocolHandler {
 public:
     explicit PGProtocolHandler(const SharedPtr<boost::asio::ip::tcp::socket> &socket);
@@ -41,6 +51,28 @@ public:
 
     String read_command_body();
 
+    // Skip the body of a message, the messages following an error of the extended query protocol are skipped until a Sync.
+    void skip_command_body();
+
+    // Name and query of a Parse message, the types of its parameters are skipped.
+    Pair<String, String> read_parse_packet();
+
+    PGBindPacket read_bind_packet();
+
+    // Kind and name of the object of a Describe or Close message, 'S' for a prepared statement and 'P' for a portal.
+    Pair<char, String> read_object_packet();
+
+    // Portal of an Execute message, the maximum number of rows to return is ignored: all rows are returned.
+    String read_execute_packet();
+
+    void read_sync_packet();
+
+    // Send a message without body, such as ParseComplete or NoData.
+    void send_status_message(PGMessageType message_type);
+
+    // ParameterDescription of a statement, whose parameters are all taken as text.
+    void send_parameter_description(u16 parameter_count);
+
     void send_error_response(const HashMap<PGMessageType, String> &error_response_map);
     //
     //    String read_query_packet();
@@ -52,13 +84,8 @@ public:
     void SendData(const Vector<Optional<String>> &values_as_strings, u64 string_length_sum);
 
     void SendComplete(const String &complete_message);
-    //
-    //    pair<String, String> read_parse_packet();
-    //    void read_sync_packet();
-    //
-    //    void send_status_message(const PGMessageType message_type);
 
-    //    void force_flush() { buffer_writer_.flush(); }
+    void force_flush() { buffer_writer_.flush(); }
 
 private:
     BufferReader buffer_reader_;
@@ -48,12 +48,14 @@ KnnExpr::~KnnExpr() {
                 break;
             }
             case EmbeddingDataType::kElemBit:
-            case EmbeddingDataType::kElemInt8: {
+            case EmbeddingDataType::kElemInt8:
+            case EmbeddingDataType::kElemUInt8: {
                 int8_t *data_ptr = reinterpret_cast<int8_t *>(embedding_data_ptr_);
                 delete[] data_ptr;
                 break;
             }
-            case EmbeddingDataType::kElemInt16: {
+            case EmbeddingDataType::kElemInt16:
+            case EmbeddingDataType::kElemFloat16: {
                 int16_t *data_ptr = reinterpret_cast<int16_t *>(embedding_data_ptr_);
                 delete[] data_ptr;
                 break;
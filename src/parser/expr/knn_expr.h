@@ -49,6 +49,9 @@ public:
     KnnDistanceType distance_type_{KnnDistanceType::kInvalid};
     int64_t topn_{};
     std::vector<InitParameter *> *opt_params_{};
+    // The parameter slot of a `?` query vector, whose embedding is built when the statement is bound. -1 if the query vector is in the
+    // statement.
+    int64_t query_parameter_index_{-1};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -12,29 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-module;
 
-export module hash_table;
-
-import stl;
-import column_vector;
-import internal_types;
-import data_type;
+#include "parameter_expr.h"
 
 namespace infinity {
 
-export class HashTable {
-public:
-    void Init(const Vector<DataType> &types);
-
-    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count);
-
-public:
-    Vector<DataType> types_{};
-    SizeT key_size_{};
-
-    // Key -> (block id -> row array)
-    HashMap<String, HashMap<SizeT, Vector<SizeT>>> hash_table_{};
-};
+std::string ParameterExpr::ToString() const { return "?"; }
 
 } // namespace infinity
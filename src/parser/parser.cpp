@@ -298,108 +298,110 @@ enum yysymbol_kind_t
   YYSYMBOL_184_ = 184,                     /* '.'  */
   YYSYMBOL_185_ = 185,                     /* ';'  */
   YYSYMBOL_186_ = 186,                     /* ','  */
-  YYSYMBOL_YYACCEPT = 187,                 /* $accept  */
-  YYSYMBOL_input_pattern = 188,            /* input_pattern  */
-  YYSYMBOL_statement_list = 189,           /* statement_list  */
-  YYSYMBOL_statement = 190,                /* statement  */
-  YYSYMBOL_explainable_statement = 191,    /* explainable_statement  */
-  YYSYMBOL_create_statement = 192,         /* create_statement  */
-  YYSYMBOL_table_element_array = 193,      /* table_element_array  */
-  YYSYMBOL_table_element = 194,            /* table_element  */
-  YYSYMBOL_table_column = 195,             /* table_column  */
-  YYSYMBOL_column_type = 196,              /* column_type  */
-  YYSYMBOL_column_constraints = 197,       /* column_constraints  */
-  YYSYMBOL_column_constraint = 198,        /* column_constraint  */
-  YYSYMBOL_default_expr = 199,             /* default_expr  */
-  YYSYMBOL_table_constraint = 200,         /* table_constraint  */
-  YYSYMBOL_identifier_array = 201,         /* identifier_array  */
-  YYSYMBOL_delete_statement = 202,         /* delete_statement  */
-  YYSYMBOL_insert_statement = 203,         /* insert_statement  */
-  YYSYMBOL_optional_identifier_array = 204, /* optional_identifier_array  */
-  YYSYMBOL_explain_statement = 205,        /* explain_statement  */
-  YYSYMBOL_explain_type = 206,             /* explain_type  */
-  YYSYMBOL_update_statement = 207,         /* update_statement  */
-  YYSYMBOL_update_expr_array = 208,        /* update_expr_array  */
-  YYSYMBOL_update_expr = 209,              /* update_expr  */
-  YYSYMBOL_drop_statement = 210,           /* drop_statement  */
-  YYSYMBOL_copy_statement = 211,           /* copy_statement  */
-  YYSYMBOL_select_statement = 212,         /* select_statement  */
-  YYSYMBOL_select_with_paren = 213,        /* select_with_paren  */
-  YYSYMBOL_select_without_paren = 214,     /* select_without_paren  */
-  YYSYMBOL_select_clause_with_modifier = 215, /* select_clause_with_modifier  */
-  YYSYMBOL_select_clause_without_modifier_paren = 216, /* select_clause_without_modifier_paren  */
-  YYSYMBOL_select_clause_without_modifier = 217, /* select_clause_without_modifier  */
-  YYSYMBOL_order_by_clause = 218,          /* order_by_clause  */
-  YYSYMBOL_order_by_expr_list = 219,       /* order_by_expr_list  */
-  YYSYMBOL_order_by_expr = 220,            /* order_by_expr  */
-  YYSYMBOL_order_by_type = 221,            /* order_by_type  */
-  YYSYMBOL_limit_expr = 222,               /* limit_expr  */
-  YYSYMBOL_offset_expr = 223,              /* offset_expr  */
-  YYSYMBOL_distinct = 224,                 /* distinct  */
-  YYSYMBOL_from_clause = 225,              /* from_clause  */
-  YYSYMBOL_search_clause = 226,            /* search_clause  */
-  YYSYMBOL_where_clause = 227,             /* where_clause  */
-  YYSYMBOL_having_clause = 228,            /* having_clause  */
-  YYSYMBOL_group_by_clause = 229,          /* group_by_clause  */
-  YYSYMBOL_set_operator = 230,             /* set_operator  */
-  YYSYMBOL_table_reference = 231,          /* table_reference  */
-  YYSYMBOL_table_reference_unit = 232,     /* table_reference_unit  */
-  YYSYMBOL_table_reference_name = 233,     /* table_reference_name  */
-  YYSYMBOL_table_name = 234,               /* table_name  */
-  YYSYMBOL_table_alias = 235,              /* table_alias  */
-  YYSYMBOL_with_clause = 236,              /* with_clause  */
-  YYSYMBOL_with_expr_list = 237,           /* with_expr_list  */
-  YYSYMBOL_with_expr = 238,                /* with_expr  */
-  YYSYMBOL_join_clause = 239,              /* join_clause  */
-  YYSYMBOL_join_type = 240,                /* join_type  */
-  YYSYMBOL_show_statement = 241,           /* show_statement  */
-  YYSYMBOL_flush_statement = 242,          /* flush_statement  */
-  YYSYMBOL_optimize_statement = 243,       /* optimize_statement  */
-  YYSYMBOL_command_statement = 244,        /* command_statement  */
-  YYSYMBOL_compact_statement = 245,        /* compact_statement  */
-  YYSYMBOL_expr_array = 246,               /* expr_array  */
-  YYSYMBOL_expr_array_list = 247,          /* expr_array_list  */
-  YYSYMBOL_expr_alias = 248,               /* expr_alias  */
-  YYSYMBOL_expr = 249,                     /* expr  */
-  YYSYMBOL_operand = 250,                  /* operand  */
-  YYSYMBOL_extra_match_tensor_option = 251, /* extra_match_tensor_option  */
-  YYSYMBOL_match_tensor_expr = 252,        /* match_tensor_expr  */
-  YYSYMBOL_match_vector_expr = 253,        /* match_vector_expr  */
-  YYSYMBOL_match_text_expr = 254,          /* match_text_expr  */
-  YYSYMBOL_query_expr = 255,               /* query_expr  */
-  YYSYMBOL_fusion_expr = 256,              /* fusion_expr  */
-  YYSYMBOL_sub_search_array = 257,         /* sub_search_array  */
-  YYSYMBOL_function_expr = 258,            /* function_expr  */
-  YYSYMBOL_conjunction_expr = 259,         /* conjunction_expr  */
-  YYSYMBOL_between_expr = 260,             /* between_expr  */
-  YYSYMBOL_in_expr = 261,                  /* in_expr  */
-  YYSYMBOL_case_expr = 262,                /* case_expr  */
-  YYSYMBOL_case_check_array = 263,         /* case_check_array  */
-  YYSYMBOL_cast_expr = 264,                /* cast_expr  */
-  YYSYMBOL_subquery_expr = 265,            /* subquery_expr  */
-  YYSYMBOL_column_expr = 266,              /* column_expr  */
-  YYSYMBOL_constant_expr = 267,            /* constant_expr  */
-  YYSYMBOL_common_array_expr = 268,        /* common_array_expr  */
-  YYSYMBOL_subarray_array_expr = 269,      /* subarray_array_expr  */
-  YYSYMBOL_unclosed_subarray_array_expr = 270, /* unclosed_subarray_array_expr  */
-  YYSYMBOL_array_expr = 271,               /* array_expr  */
-  YYSYMBOL_long_array_expr = 272,          /* long_array_expr  */
-  YYSYMBOL_unclosed_long_array_expr = 273, /* unclosed_long_array_expr  */
-  YYSYMBOL_double_array_expr = 274,        /* double_array_expr  */
-  YYSYMBOL_unclosed_double_array_expr = 275, /* unclosed_double_array_expr  */
-  YYSYMBOL_interval_expr = 276,            /* interval_expr  */
-  YYSYMBOL_copy_option_list = 277,         /* copy_option_list  */
-  YYSYMBOL_copy_option = 278,              /* copy_option  */
-  YYSYMBOL_file_path = 279,                /* file_path  */
-  YYSYMBOL_if_exists = 280,                /* if_exists  */
-  YYSYMBOL_if_not_exists = 281,            /* if_not_exists  */
-  YYSYMBOL_semicolon = 282,                /* semicolon  */
-  YYSYMBOL_if_not_exists_info = 283,       /* if_not_exists_info  */
-  YYSYMBOL_with_index_param_list = 284,    /* with_index_param_list  */
-  YYSYMBOL_optional_table_properties_list = 285, /* optional_table_properties_list  */
-  YYSYMBOL_index_param_list = 286,         /* index_param_list  */
-  YYSYMBOL_index_param = 287,              /* index_param  */
-  YYSYMBOL_index_info_list = 288           /* index_info_list  */
+  YYSYMBOL_187_ = 187,                     /* '?'  */
+  YYSYMBOL_YYACCEPT = 188,                 /* $accept  */
+  YYSYMBOL_input_pattern = 189,            /* input_pattern  */
+  YYSYMBOL_statement_list = 190,           /* statement_list  */
+  YYSYMBOL_statement = 191,                /* statement  */
+  YYSYMBOL_explainable_statement = 192,    /* explainable_statement  */
+  YYSYMBOL_create_statement = 193,         /* create_statement  */
+  YYSYMBOL_table_element_array = 194,      /* table_element_array  */
+  YYSYMBOL_table_element = 195,            /* table_element  */
+  YYSYMBOL_table_column = 196,             /* table_column  */
+  YYSYMBOL_column_type = 197,              /* column_type  */
+  YYSYMBOL_column_constraints = 198,       /* column_constraints  */
+  YYSYMBOL_column_constraint = 199,        /* column_constraint  */
+  YYSYMBOL_default_expr = 200,             /* default_expr  */
+  YYSYMBOL_table_constraint = 201,         /* table_constraint  */
+  YYSYMBOL_identifier_array = 202,         /* identifier_array  */
+  YYSYMBOL_delete_statement = 203,         /* delete_statement  */
+  YYSYMBOL_insert_statement = 204,         /* insert_statement  */
+  YYSYMBOL_optional_identifier_array = 205, /* optional_identifier_array  */
+  YYSYMBOL_explain_statement = 206,        /* explain_statement  */
+  YYSYMBOL_explain_type = 207,             /* explain_type  */
+  YYSYMBOL_update_statement = 208,         /* update_statement  */
+  YYSYMBOL_update_expr_array = 209,        /* update_expr_array  */
+  YYSYMBOL_update_expr = 210,              /* update_expr  */
+  YYSYMBOL_drop_statement = 211,           /* drop_statement  */
+  YYSYMBOL_copy_statement = 212,           /* copy_statement  */
+  YYSYMBOL_select_statement = 213,         /* select_statement  */
+  YYSYMBOL_select_with_paren = 214,        /* select_with_paren  */
+  YYSYMBOL_select_without_paren = 215,     /* select_without_paren  */
+  YYSYMBOL_select_clause_with_modifier = 216, /* select_clause_with_modifier  */
+  YYSYMBOL_select_clause_without_modifier_paren = 217, /* select_clause_without_modifier_paren  */
+  YYSYMBOL_select_clause_without_modifier = 218, /* select_clause_without_modifier  */
+  YYSYMBOL_order_by_clause = 219,          /* order_by_clause  */
+  YYSYMBOL_order_by_expr_list = 220,       /* order_by_expr_list  */
+  YYSYMBOL_order_by_expr = 221,            /* order_by_expr  */
+  YYSYMBOL_order_by_type = 222,            /* order_by_type  */
+  YYSYMBOL_limit_expr = 223,               /* limit_expr  */
+  YYSYMBOL_offset_expr = 224,              /* offset_expr  */
+  YYSYMBOL_distinct = 225,                 /* distinct  */
+  YYSYMBOL_from_clause = 226,              /* from_clause  */
+  YYSYMBOL_search_clause = 227,            /* search_clause  */
+  YYSYMBOL_where_clause = 228,             /* where_clause  */
+  YYSYMBOL_having_clause = 229,            /* having_clause  */
+  YYSYMBOL_group_by_clause = 230,          /* group_by_clause  */
+  YYSYMBOL_set_operator = 231,             /* set_operator  */
+  YYSYMBOL_table_reference = 232,          /* table_reference  */
+  YYSYMBOL_table_reference_unit = 233,     /* table_reference_unit  */
+  YYSYMBOL_table_reference_name = 234,     /* table_reference_name  */
+  YYSYMBOL_table_name = 235,               /* table_name  */
+  YYSYMBOL_table_alias = 236,              /* table_alias  */
+  YYSYMBOL_with_clause = 237,              /* with_clause  */
+  YYSYMBOL_with_expr_list = 238,           /* with_expr_list  */
+  YYSYMBOL_with_expr = 239,                /* with_expr  */
+  YYSYMBOL_join_clause = 240,              /* join_clause  */
+  YYSYMBOL_join_type = 241,                /* join_type  */
+  YYSYMBOL_show_statement = 242,           /* show_statement  */
+  YYSYMBOL_flush_statement = 243,          /* flush_statement  */
+  YYSYMBOL_optimize_statement = 244,       /* optimize_statement  */
+  YYSYMBOL_command_statement = 245,        /* command_statement  */
+  YYSYMBOL_compact_statement = 246,        /* compact_statement  */
+  YYSYMBOL_expr_array = 247,               /* expr_array  */
+  YYSYMBOL_expr_array_list = 248,          /* expr_array_list  */
+  YYSYMBOL_expr_alias = 249,               /* expr_alias  */
+  YYSYMBOL_expr = 250,                     /* expr  */
+  YYSYMBOL_operand = 251,                  /* operand  */
+  YYSYMBOL_extra_match_tensor_option = 252, /* extra_match_tensor_option  */
+  YYSYMBOL_match_tensor_expr = 253,        /* match_tensor_expr  */
+  YYSYMBOL_match_vector_expr = 254,        /* match_vector_expr  */
+  YYSYMBOL_match_text_expr = 255,          /* match_text_expr  */
+  YYSYMBOL_query_expr = 256,               /* query_expr  */
+  YYSYMBOL_fusion_expr = 257,              /* fusion_expr  */
+  YYSYMBOL_sub_search_array = 258,         /* sub_search_array  */
+  YYSYMBOL_function_expr = 259,            /* function_expr  */
+  YYSYMBOL_conjunction_expr = 260,         /* conjunction_expr  */
+  YYSYMBOL_between_expr = 261,             /* between_expr  */
+  YYSYMBOL_in_expr = 262,                  /* in_expr  */
+  YYSYMBOL_case_expr = 263,                /* case_expr  */
+  YYSYMBOL_case_check_array = 264,         /* case_check_array  */
+  YYSYMBOL_cast_expr = 265,                /* cast_expr  */
+  YYSYMBOL_subquery_expr = 266,            /* subquery_expr  */
+  YYSYMBOL_column_expr = 267,              /* column_expr  */
+  YYSYMBOL_parameter_expr = 268,           /* parameter_expr  */
+  YYSYMBOL_constant_expr = 269,            /* constant_expr  */
+  YYSYMBOL_common_array_expr = 270,        /* common_array_expr  */
+  YYSYMBOL_subarray_array_expr = 271,      /* subarray_array_expr  */
+  YYSYMBOL_unclosed_subarray_array_expr = 272, /* unclosed_subarray_array_expr  */
+  YYSYMBOL_array_expr = 273,               /* array_expr  */
+  YYSYMBOL_long_array_expr = 274,          /* long_array_expr  */
+  YYSYMBOL_unclosed_long_array_expr = 275, /* unclosed_long_array_expr  */
+  YYSYMBOL_double_array_expr = 276,        /* double_array_expr  */
+  YYSYMBOL_unclosed_double_array_expr = 277, /* unclosed_double_array_expr  */
+  YYSYMBOL_interval_expr = 278,            /* interval_expr  */
+  YYSYMBOL_copy_option_list = 279,         /* copy_option_list  */
+  YYSYMBOL_copy_option = 280,              /* copy_option  */
+  YYSYMBOL_file_path = 281,                /* file_path  */
+  YYSYMBOL_if_exists = 282,                /* if_exists  */
+  YYSYMBOL_if_not_exists = 283,            /* if_not_exists  */
+  YYSYMBOL_semicolon = 284,                /* semicolon  */
+  YYSYMBOL_if_not_exists_info = 285,       /* if_not_exists_info  */
+  YYSYMBOL_with_index_param_list = 286,    /* with_index_param_list  */
+  YYSYMBOL_optional_table_properties_list = 287, /* optional_table_properties_list  */
+  YYSYMBOL_index_param_list = 288,         /* index_param_list  */
+  YYSYMBOL_index_param = 289,              /* index_param  */
+  YYSYMBOL_index_info_list = 290           /* index_info_list  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -413,7 +415,7 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #endif
 
-#line 417 "parser.cpp"
+#line 419 "parser.cpp"
 
 #ifdef short
 # undef short
@@ -737,18 +739,18 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  84
+#define YYFINAL  85
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   993
+#define YYLAST   1013
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  187
+#define YYNTOKENS  188
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  102
+#define YYNNTS  103
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  391
+#define YYNRULES  397
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  798
+#define YYNSTATES  818
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   426
@@ -771,7 +773,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,   179,     2,     2,
      182,   183,   177,   175,   186,   176,   184,   178,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,   185,
-     173,   172,   174,     2,     2,     2,     2,     2,     2,     2,
+     173,   172,   174,   187,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,   180,     2,   181,     2,     2,     2,     2,     2,     2,
@@ -821,39 +823,39 @@ static const yytype_int16 yyrline[] =
      670,   709,   745,   746,   747,   748,   749,   750,   751,   752,
      753,   754,   755,   756,   757,   758,   759,   760,   761,   762,
      763,   766,   768,   769,   770,   771,   774,   775,   776,   777,
-     778,   779,   780,   781,   782,   783,   784,   785,   786,   787,
-     788,   789,   790,   791,   792,   793,   794,   795,   796,   797,
-     798,   799,   800,   801,   802,   803,   804,   805,   824,   828,
-     838,   841,   844,   847,   851,   854,   859,   864,   871,   877,
-     887,   903,   937,   950,   953,   960,   966,   969,   972,   975,
-     978,   981,   984,   987,   994,  1007,  1011,  1016,  1029,  1042,
-    1057,  1072,  1087,  1110,  1151,  1196,  1199,  1202,  1211,  1221,
-    1224,  1228,  1233,  1255,  1258,  1263,  1279,  1282,  1286,  1290,
-    1295,  1301,  1304,  1307,  1311,  1315,  1317,  1321,  1323,  1326,
-    1330,  1333,  1337,  1342,  1346,  1349,  1353,  1356,  1360,  1363,
-    1367,  1370,  1373,  1376,  1384,  1387,  1402,  1402,  1404,  1418,
-    1427,  1432,  1441,  1446,  1451,  1457,  1464,  1467,  1471,  1474,
-    1479,  1491,  1498,  1512,  1515,  1518,  1521,  1524,  1527,  1530,
-    1536,  1540,  1544,  1548,  1552,  1559,  1563,  1567,  1571,  1577,
-    1583,  1589,  1600,  1611,  1622,  1634,  1646,  1659,  1673,  1684,
-    1702,  1706,  1710,  1718,  1732,  1738,  1743,  1749,  1755,  1763,
-    1769,  1775,  1781,  1787,  1795,  1801,  1807,  1813,  1819,  1827,
-    1833,  1840,  1857,  1861,  1866,  1870,  1897,  1903,  1907,  1908,
-    1909,  1910,  1911,  1913,  1916,  1922,  1925,  1926,  1927,  1928,
-    1929,  1930,  1931,  1932,  1933,  1935,  1938,  1944,  1966,  2132,
-    2140,  2151,  2157,  2166,  2172,  2182,  2186,  2190,  2194,  2198,
-    2202,  2206,  2210,  2214,  2218,  2223,  2231,  2239,  2248,  2255,
-    2262,  2269,  2276,  2283,  2291,  2299,  2307,  2315,  2323,  2331,
-    2339,  2347,  2355,  2363,  2371,  2379,  2409,  2417,  2426,  2434,
-    2443,  2451,  2457,  2464,  2470,  2477,  2482,  2489,  2496,  2504,
-    2528,  2534,  2540,  2547,  2555,  2562,  2569,  2574,  2584,  2589,
-    2594,  2599,  2604,  2609,  2614,  2619,  2624,  2629,  2632,  2635,
-    2639,  2642,  2646,  2650,  2655,  2660,  2663,  2667,  2671,  2676,
-    2681,  2685,  2690,  2695,  2701,  2707,  2713,  2719,  2725,  2731,
-    2737,  2743,  2749,  2755,  2761,  2772,  2776,  2781,  2803,  2813,
-    2819,  2823,  2824,  2826,  2827,  2829,  2830,  2842,  2850,  2854,
-    2857,  2861,  2864,  2868,  2872,  2877,  2882,  2890,  2897,  2908,
-    2956,  3005
+     778,   779,   780,   781,   782,   798,   799,   800,   801,   802,
+     803,   804,   805,   806,   807,   808,   809,   810,   811,   812,
+     813,   814,   815,   816,   817,   818,   819,   820,   821,   822,
+     856,   860,   870,   873,   876,   879,   883,   886,   891,   896,
+     903,   909,   919,   935,   969,   982,   985,   992,   998,  1001,
+    1004,  1007,  1010,  1013,  1016,  1019,  1026,  1039,  1043,  1048,
+    1061,  1074,  1089,  1104,  1119,  1142,  1183,  1228,  1231,  1234,
+    1243,  1253,  1256,  1260,  1265,  1287,  1290,  1295,  1311,  1314,
+    1318,  1322,  1327,  1333,  1336,  1339,  1343,  1347,  1349,  1353,
+    1355,  1358,  1362,  1365,  1369,  1374,  1378,  1381,  1385,  1388,
+    1392,  1395,  1399,  1402,  1405,  1408,  1416,  1419,  1434,  1434,
+    1436,  1450,  1459,  1464,  1473,  1478,  1483,  1489,  1496,  1499,
+    1503,  1506,  1511,  1523,  1530,  1544,  1547,  1550,  1553,  1556,
+    1559,  1562,  1568,  1572,  1576,  1580,  1584,  1591,  1595,  1599,
+    1603,  1607,  1613,  1619,  1625,  1636,  1647,  1658,  1670,  1682,
+    1695,  1709,  1720,  1738,  1742,  1746,  1754,  1768,  1774,  1779,
+    1785,  1791,  1799,  1805,  1811,  1817,  1823,  1831,  1837,  1843,
+    1849,  1855,  1863,  1869,  1876,  1893,  1897,  1902,  1906,  1933,
+    1939,  1943,  1944,  1945,  1946,  1947,  1949,  1952,  1958,  1961,
+    1962,  1963,  1964,  1965,  1966,  1967,  1968,  1969,  1970,  1972,
+    1975,  1981,  2003,  2168,  2220,  2228,  2239,  2245,  2254,  2260,
+    2270,  2274,  2278,  2282,  2286,  2290,  2294,  2298,  2302,  2306,
+    2311,  2319,  2327,  2336,  2343,  2350,  2357,  2364,  2371,  2379,
+    2387,  2395,  2403,  2411,  2419,  2427,  2435,  2443,  2451,  2459,
+    2467,  2497,  2505,  2514,  2522,  2531,  2539,  2545,  2552,  2558,
+    2565,  2570,  2577,  2584,  2592,  2616,  2622,  2628,  2635,  2643,
+    2650,  2657,  2662,  2672,  2676,  2681,  2686,  2691,  2696,  2701,
+    2706,  2711,  2716,  2721,  2724,  2727,  2731,  2734,  2738,  2742,
+    2747,  2752,  2755,  2759,  2763,  2768,  2773,  2777,  2782,  2787,
+    2793,  2799,  2805,  2811,  2817,  2823,  2829,  2835,  2841,  2847,
+    2853,  2864,  2868,  2873,  2895,  2905,  2911,  2915,  2916,  2918,
+    2919,  2921,  2922,  2934,  2942,  2946,  2949,  2953,  2956,  2960,
+    2964,  2969,  2974,  2982,  2989,  3000,  3050,  3101
 };
 #endif
 
@@ -894,7 +896,7 @@ static const char *const yytname[] =
   "EXPORT", "PROFILE", "CONFIGS", "CONFIG", "PROFILES", "VARIABLES",
   "VARIABLE", "SEARCH", "MATCH", "MAXSIM", "QUERY", "FUSION", "NUMBER",
   "'='", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'['", "']'",
-  "'('", "')'", "'.'", "';'", "','", "$accept", "input_pattern",
+  "'('", "')'", "'.'", "';'", "','", "'?'", "$accept", "input_pattern",
   "statement_list", "statement", "explainable_statement",
   "create_statement", "table_element_array", "table_element",
   "table_column", "column_type", "column_constraints", "column_constraint",
@@ -917,7 +919,7 @@ static const char *const yytname[] =
   "match_vector_expr", "match_text_expr", "query_expr", "fusion_expr",
   "sub_search_array", "function_expr", "conjunction_expr", "between_expr",
   "in_expr", "case_expr", "case_check_array", "cast_expr", "subquery_expr",
-  "column_expr", "constant_expr", "common_array_expr",
+  "column_expr", "parameter_expr", "constant_expr", "common_array_expr",
   "subarray_array_expr", "unclosed_subarray_array_expr", "array_expr",
   "long_array_expr", "unclosed_long_array_expr", "double_array_expr",
   "unclosed_double_array_expr", "interval_expr", "copy_option_list",
@@ -934,12 +936,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-698)
+#define YYPACT_NINF (-675)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-379)
+#define YYTABLE_NINF (-385)
 
 #define yytable_value_is_error(Yyn) \
   ((Yyn) == YYTABLE_NINF)
@@ -948,86 +950,88 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     611,   279,    23,   339,    85,   -17,    85,    56,   436,   231,
-      46,   138,    95,    85,   109,   -27,   -63,   139,   -32,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,   235,  -698,  -698,
-     135,  -698,  -698,  -698,  -698,  -698,    72,    72,    72,    72,
-      17,    85,   125,   125,   125,   125,   125,    74,   218,    85,
-      97,   206,   268,   281,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,   637,   300,    85,  -698,  -698,  -698,    50,    58,  -698,
-     304,  -698,    85,  -698,  -698,  -698,  -698,  -698,   255,   127,
-    -698,   318,   134,   147,  -698,    52,  -698,   333,  -698,  -698,
-       0,   293,  -698,   298,   322,   375,    85,    85,    85,   401,
-     343,   232,   341,   424,    85,    85,    85,   434,   440,   445,
-     414,   446,   446,    22,    26,    48,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,   235,  -698,  -698,  -698,  -698,  -698,  -698,
-     361,  -698,   479,  -698,   490,  -698,  -698,   319,   109,   446,
-    -698,  -698,  -698,  -698,     0,  -698,  -698,  -698,   395,   448,
-     431,   438,  -698,   -33,  -698,   232,  -698,    85,   516,    24,
-    -698,  -698,  -698,  -698,  -698,   457,  -698,   349,   -52,  -698,
-     395,  -698,  -698,   450,   460,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-     524,   534,  -698,  -698,  -698,  -698,  -698,   135,  -698,  -698,
-     360,   362,   385,  -698,  -698,   604,   429,   392,   409,   248,
-     547,   555,   564,   590,  -698,  -698,   594,   420,    83,   421,
-     425,   512,   512,  -698,     5,   282,   -40,  -698,   -21,   582,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,   426,  -698,  -698,  -698,  -112,  -698,  -698,   -99,
-    -698,   -89,  -698,   395,   395,   538,  -698,   -63,    27,   556,
-     435,  -698,    55,   437,  -698,    85,   395,   445,  -698,   117,
-     447,   449,  -698,   247,   452,  -698,  -698,   165,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-     512,   451,   659,   549,   395,   395,   -76,   186,  -698,  -698,
-    -698,  -698,   604,  -698,   626,   461,   463,   472,   628,   651,
-     195,   195,  -698,  -698,  -698,   459,    73,     4,   395,   491,
-     656,   395,   395,   -50,   483,    -4,   512,   512,   512,   512,
-     512,   512,   512,   512,   512,   512,   512,   512,   512,   512,
-      10,  -698,   486,  -698,   661,  -698,   663,   487,  -698,   -25,
-     117,   395,  -698,   235,   750,   552,   493,   129,  -698,  -698,
-    -698,   -63,   516,   494,  -698,   675,   395,   497,  -698,   117,
-    -698,   386,   386,   674,  -698,  -698,   395,  -698,   160,   549,
-     535,   501,    30,   -54,   193,  -698,   395,   395,   609,   395,
-     687,    11,   172,   196,  -698,  -698,   -63,   507,   523,  -698,
-      54,  -698,  -698,    66,   414,  -698,  -698,   548,   514,   512,
-     282,   573,  -698,   311,   311,    51,    51,   638,   311,   311,
-      51,    51,   195,   195,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,   395,  -698,  -698,  -698,   117,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,   526,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,   529,
-     531,   532,   533,   123,   536,   516,   670,    27,   235,   219,
-     516,  -698,   243,   537,   705,   714,  -698,   261,  -698,   277,
-     671,   308,  -698,   539,  -698,   750,   395,  -698,   395,   -41,
-      60,   512,    57,   543,  -698,    96,  -698,   716,  -698,   719,
-      20,     4,   672,  -698,  -698,  -698,  -698,  -698,  -698,   673,
-    -698,   743,  -698,  -698,  -698,  -698,  -698,  -698,   561,   695,
-     282,   311,   566,   309,  -698,   512,  -698,   744,   208,   348,
-     444,   456,   627,   630,  -698,  -698,    13,   123,  -698,  -698,
-     516,   323,   571,  -698,  -698,   607,   324,  -698,   395,  -698,
-    -698,  -698,   386,  -698,   758,  -698,  -698,   583,   117,    25,
-    -698,   395,   527,   585,   763,   486,   586,   588,    54,   523,
-       4,     4,   591,    66,   718,   713,   592,   325,  -698,  -698,
-     659,   342,   593,   600,   601,   603,   605,   606,   608,   612,
-     613,   614,   619,   620,   621,   622,   632,   634,   635,   636,
-     639,   640,   641,   642,   643,   644,   677,   678,   681,   682,
-     685,   686,   688,   689,  -698,  -698,  -698,  -698,  -698,   369,
-    -698,   771,   773,   623,   377,  -698,  -698,  -698,  -698,   117,
-    -698,   332,   690,   383,   691,  -698,  -698,  -698,  -698,   727,
-     516,  -698,  -698,  -698,  -698,  -698,   395,   395,  -698,  -698,
-    -698,  -698,   789,   791,   817,   818,   854,   855,   867,   872,
-     873,   874,   875,   876,   877,   878,   879,   880,   881,   882,
-     883,   884,   885,   886,   887,   888,   889,   890,   891,   892,
-     893,   894,   895,   896,   897,  -698,   732,   393,  -698,   698,
-     902,  -698,   903,  -698,   904,   905,   395,   406,   720,   117,
-     728,   729,   730,   731,   733,   734,   735,   736,   737,   738,
-     739,   740,   741,   742,   745,   746,   747,   748,   749,   751,
-     752,   753,   754,   755,   756,   757,   759,   760,   761,   762,
-     764,   765,   766,   357,  -698,   771,   768,  -698,   698,   724,
-     769,   767,   117,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,  -698,
-    -698,   771,  -698,   911,  -698,   922,   407,   770,   772,  -698,
-     921,   929,   774,   776,  -698,  -698,   698,  -698
+     614,   296,     8,   378,    55,    -6,    55,    45,   407,   203,
+     103,   379,   141,    55,   149,    18,   -70,   155,    -4,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,   188,  -675,  -675,
+     201,  -675,  -675,  -675,  -675,  -675,   140,   140,   140,   140,
+      -3,    55,   158,   158,   158,   158,   158,    44,   223,    55,
+     127,   247,   255,   260,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   635,   269,    55,  -675,  -675,  -675,  -675,  -102,   146,
+    -675,   289,  -675,    55,  -675,  -675,  -675,  -675,  -675,   250,
+     131,  -675,   318,   164,   174,  -675,   589,  -675,   341,  -675,
+    -675,     0,   297,  -675,   300,   299,   386,    55,    55,    55,
+     388,   332,   218,   339,   403,    55,    55,    55,   413,   418,
+     419,   360,   435,   435,    15,    42,    62,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,   188,  -675,  -675,  -675,  -675,  -675,
+    -675,   214,  -675,   445,  -675,   468,  -675,  -675,   293,   149,
+     435,  -675,  -675,  -675,  -675,     0,  -675,  -675,  -675,   366,
+     426,   423,   422,  -675,   -43,  -675,   218,  -675,    55,   485,
+      20,  -675,  -675,  -675,  -675,  -675,   442,  -675,   326,   -55,
+    -675,   366,  -675,  -675,   443,   459,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   521,   533,  -675,  -675,  -675,  -675,  -675,   201,  -675,
+    -675,   361,   362,   367,  -675,  -675,   726,   398,   374,   382,
+     248,   546,   572,   573,   575,  -675,  -675,   576,   401,   -35,
+     402,   404,   507,   507,  -675,     5,   309,  -675,   -62,  -675,
+     -37,   590,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,   409,  -675,  -675,  -675,  -675,  -120,
+    -675,  -675,  -112,  -675,    -9,  -675,   366,   366,   517,  -675,
+     -70,    11,   532,   412,  -675,   133,   415,  -675,    55,   366,
+     419,  -675,   182,   424,   425,  -675,   249,   408,  -675,  -675,
+     113,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,   507,   431,   696,   516,   366,   366,    -1,
+     150,  -675,  -675,  -675,  -675,   726,  -675,   613,   436,   437,
+     438,   618,   627,   107,   107,  -675,  -675,  -675,   449,    23,
+       4,   366,   467,   640,   366,   366,   -50,   456,   -18,   507,
+     507,   507,   507,   507,   507,   507,   507,   507,   507,   507,
+     507,   507,   507,    13,  -675,   470,  -675,   647,  -675,   649,
+     469,  -675,   -40,   182,   366,  -675,   188,   796,   535,   477,
+     162,  -675,  -675,  -675,   -70,   485,   481,  -675,   662,   366,
+     483,  -675,   182,  -675,   490,   490,   661,  -675,  -675,   366,
+    -675,   175,   516,   520,   488,   -26,   -59,   171,  -675,   366,
+     366,   595,   366,   669,    14,   204,   213,  -675,  -675,   -70,
+     489,   395,  -675,    26,  -675,  -675,   165,   360,  -675,  -675,
+     531,   497,   507,   309,   556,  -675,   705,   705,   384,   384,
+     633,   705,   705,   384,   384,   107,   107,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,   366,  -675,  -675,  -675,   182,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,   499,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,   503,   504,   506,   508,   -31,   509,   485,   664,
+      11,   188,   243,   485,  -675,   278,   513,   692,   694,  -675,
+     279,  -675,   280,   648,   291,  -675,   518,  -675,   796,   366,
+    -675,   366,   -51,   -45,   507,   -71,   514,  -675,    60,  -675,
+     695,  -675,   698,    16,     4,   646,  -675,  -675,  -675,  -675,
+    -675,  -675,   650,  -675,   702,  -675,  -675,  -675,  -675,  -675,
+    -675,   523,   653,   309,   705,   527,   304,  -675,   507,  -675,
+     706,   177,   288,   132,   211,   587,   591,  -675,  -675,    47,
+     -31,  -675,  -675,   485,   320,   534,  -675,  -675,   562,   321,
+    -675,   366,  -675,  -675,  -675,   490,  -675,   712,  -675,  -675,
+     536,   182,    -5,  -675,   366,   578,  -123,   720,   470,   542,
+     543,    26,   395,     4,     4,   545,   165,   675,   676,   547,
+     331,  -675,  -675,   696,   333,   551,   552,   553,   555,   557,
+     558,   559,   560,   561,   563,   574,   586,   588,   593,   596,
+     598,   599,   600,   601,   602,   603,   604,   605,   606,   607,
+     609,   611,   612,   615,   616,   617,   628,   629,   630,  -675,
+    -675,  -675,  -675,  -675,   335,  -675,   739,   756,   626,   337,
+    -675,  -675,  -675,  -675,   182,  -675,   334,   632,   634,   354,
+     636,  -675,  -675,  -675,  -675,   736,   485,  -675,  -675,  -675,
+    -675,  -675,   366,   366,  -675,  -675,  -675,  -675,   794,   798,
+     807,   813,   817,   818,   819,   820,   821,   822,   823,   825,
+     826,   827,   828,   829,   830,   831,   836,   837,   838,   839,
+     845,   846,   847,   848,   870,   900,   901,   903,   904,   907,
+     908,   911,   912,  -675,   747,   368,  -675,   841,   918,  -675,
+     919,   920,  -675,   921,   922,   366,   369,   741,   182,   745,
+     746,   748,   749,   750,   751,   752,   753,   754,   755,   757,
+     758,   759,   760,   761,   762,   763,   764,   765,   766,   767,
+     768,   769,   770,   771,   772,   773,   774,   775,   776,   777,
+     778,   779,   780,   781,   338,  -675,   739,   740,  -675,   841,
+     744,   782,   783,   784,   182,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,  -675,
+    -675,  -675,  -675,  -675,  -675,   739,  -675,   935,   961,  -675,
+     963,   383,   785,   786,   787,  -675,   968,   969,   965,   793,
+     795,   797,  -675,  -675,   841,   841,  -675,  -675
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -1035,118 +1039,120 @@ static const yytype_int16 yypact[] =
    means the default is an error.  */
 static const yytype_int16 yydefact[] =
 {
-     187,     0,     0,     0,     0,     0,     0,     0,   123,     0,
-       0,     0,     0,     0,     0,     0,   187,     0,   376,     3,
-       5,    10,    12,    13,    11,     6,     7,     9,   136,   135,
-       0,     8,    14,    15,    16,    17,   374,   374,   374,   374,
-     374,     0,   372,   372,   372,   372,   372,   180,     0,     0,
-       0,     0,     0,     0,   117,   121,   118,   119,   120,   122,
-     116,   187,     0,     0,   201,   202,   200,     0,     0,   203,
-       0,   205,     0,   220,   221,   222,   224,   223,     0,   186,
-     188,     0,     0,     0,     1,   187,     2,   170,   172,   173,
-       0,   159,   141,   147,     0,     0,     0,     0,     0,     0,
-       0,   114,     0,     0,     0,     0,     0,     0,     0,     0,
-     165,     0,     0,     0,     0,     0,   115,    18,    23,    25,
-      24,    19,    20,    22,    21,    26,    27,    28,    29,   210,
-     211,   206,     0,   207,     0,   204,   241,     0,     0,     0,
-     140,   139,     4,   171,     0,   137,   138,   158,     0,     0,
-     155,     0,    30,     0,    31,   114,   377,     0,     0,   187,
-     371,   128,   130,   129,   131,     0,   181,     0,   165,   125,
-       0,   110,   370,     0,     0,   228,   230,   229,   226,   227,
-     233,   235,   234,   231,   232,   238,   240,   239,   236,   237,
-       0,     0,   213,   212,   218,   208,   209,     0,   189,   225,
-       0,     0,   324,   328,   331,   332,     0,     0,     0,     0,
-       0,     0,     0,     0,   329,   330,     0,     0,     0,     0,
-       0,     0,     0,   326,     0,   187,   161,   242,   247,   248,
-     262,   260,   261,   263,   264,   257,   252,   251,   250,   258,
-     259,   249,   256,   255,   339,   341,     0,   340,   345,     0,
-     346,     0,   338,     0,     0,   157,   373,   187,     0,     0,
-       0,   108,     0,     0,   112,     0,     0,     0,   124,   164,
-       0,     0,   219,   214,     0,   144,   143,     0,   354,   353,
-     356,   355,   358,   357,   360,   359,   362,   361,   364,   363,
-       0,     0,   290,   187,     0,     0,     0,     0,   333,   334,
-     335,   336,     0,   337,     0,     0,     0,     0,     0,     0,
-     292,   291,   351,   348,   343,     0,     0,     0,     0,   163,
+     189,     0,     0,     0,     0,     0,     0,     0,   125,     0,
+       0,     0,     0,     0,     0,     0,   189,     0,   382,     3,
+       5,    10,    12,    13,    11,     6,     7,     9,   138,   137,
+       0,     8,    14,    15,    16,    17,   380,   380,   380,   380,
+     380,     0,   378,   378,   378,   378,   378,   182,     0,     0,
+       0,     0,     0,     0,   119,   123,   120,   121,   122,   124,
+     118,   189,     0,     0,   203,   204,   202,   207,     0,     0,
+     205,     0,   208,     0,   223,   224,   225,   227,   226,     0,
+     188,   190,     0,     0,     0,     1,   189,     2,   172,   174,
+     175,     0,   161,   143,   149,     0,     0,     0,     0,     0,
+       0,     0,   116,     0,     0,     0,     0,     0,     0,     0,
+       0,   167,     0,     0,     0,     0,     0,   117,    18,    23,
+      25,    24,    19,    20,    22,    21,    26,    27,    28,    29,
+     213,   214,   209,     0,   210,     0,   206,   244,     0,     0,
+       0,   142,   141,     4,   173,     0,   139,   140,   160,     0,
+       0,   157,     0,    30,     0,    31,   116,   383,     0,     0,
+     189,   377,   130,   132,   131,   133,     0,   183,     0,   167,
+     127,     0,   112,   376,     0,     0,   231,   233,   232,   229,
+     230,   236,   238,   237,   234,   235,   241,   243,   242,   239,
+     240,     0,     0,   216,   215,   221,   211,   212,     0,   191,
+     228,     0,     0,   329,   334,   337,   338,     0,     0,     0,
+       0,     0,     0,     0,     0,   335,   336,     0,     0,     0,
+       0,     0,     0,     0,   331,     0,   189,   333,   163,   245,
+     250,   251,   265,   263,   264,   266,   267,   260,   255,   254,
+     253,   261,   262,   252,   259,   268,   258,   345,   347,     0,
+     346,   351,     0,   352,     0,   344,     0,     0,   159,   379,
+     189,     0,     0,     0,   110,     0,     0,   114,     0,     0,
+       0,   126,   166,     0,     0,   222,   217,     0,   146,   145,
+       0,   360,   359,   362,   361,   364,   363,   366,   365,   368,
+     367,   370,   369,     0,     0,   295,   189,     0,     0,     0,
+       0,   339,   340,   341,   342,     0,   343,     0,     0,     0,
+       0,     0,     0,   297,   296,   357,   354,   349,     0,     0,
+       0,     0,   165,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   348,     0,   353,     0,   356,     0,
+     148,   150,   155,   156,     0,   144,    33,     0,     0,     0,
+       0,    36,    38,    39,   189,     0,    35,   115,     0,     0,
+     113,   134,   129,   128,     0,     0,     0,   218,   192,     0,
+     290,     0,   189,     0,     0,     0,     0,     0,   320,     0,
+       0,     0,     0,     0,     0,     0,     0,   257,   256,   189,
+     162,   176,   178,   187,   179,   246,     0,   167,   249,   313,
+     314,     0,     0,   189,     0,   294,   304,   305,   308,   309,
+       0,   311,   303,   306,   307,   299,   298,   300,   301,   302,
+     330,   332,   350,   355,   358,     0,   153,   154,   152,   158,
+      42,    45,    46,    43,    44,    47,    48,    62,    49,    51,
+      50,    65,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,     0,     0,     0,     0,   107,     0,     0,   388,
+       0,    34,     0,     0,   111,     0,     0,     0,     0,   375,
+       0,   371,     0,   219,     0,   291,     0,   325,     0,     0,
+     318,     0,     0,     0,     0,     0,     0,   329,     0,   276,
+       0,   278,     0,     0,     0,     0,   196,   197,   198,   199,
+     195,   200,     0,   185,     0,   180,   282,   280,   281,   283,
+     284,   164,   171,   189,   312,     0,     0,   293,     0,   151,
+       0,     0,     0,     0,     0,     0,     0,   103,   104,     0,
+     107,   100,    40,     0,     0,     0,    32,    37,   397,     0,
+     247,     0,   374,   373,   136,     0,   135,     0,   292,   326,
+       0,   322,     0,   321,     0,     0,     0,     0,     0,     0,
+       0,   187,   177,     0,     0,   184,     0,     0,   169,     0,
+       0,   327,   316,   315,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   342,     0,   347,     0,   350,     0,   146,   148,   153,
-     154,     0,   142,    33,     0,     0,     0,     0,    36,    38,
-      39,   187,     0,    35,   113,     0,     0,   111,   132,   127,
-     126,     0,     0,     0,   215,   190,     0,   285,     0,   187,
-       0,     0,     0,     0,     0,   315,     0,     0,     0,     0,
-       0,     0,     0,     0,   254,   253,   187,   160,   174,   176,
-     185,   177,   243,     0,   165,   246,   308,   309,     0,     0,
-     187,     0,   289,   299,   300,   303,   304,     0,   306,   298,
-     301,   302,   294,   293,   295,   296,   297,   325,   327,   344,
-     349,   352,     0,   151,   152,   150,   156,    42,    45,    46,
-      43,    44,    47,    48,    62,    49,    51,    50,    65,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,     0,
-       0,     0,     0,   105,     0,     0,   382,     0,    34,     0,
-       0,   109,     0,     0,     0,     0,   369,     0,   365,     0,
-     216,     0,   286,     0,   320,     0,     0,   313,     0,     0,
-       0,     0,     0,     0,   324,     0,   271,     0,   273,     0,
-       0,     0,     0,   194,   195,   196,   197,   193,   198,     0,
-     183,     0,   178,   277,   275,   276,   278,   279,   162,   169,
-     187,   307,     0,     0,   288,     0,   149,     0,     0,     0,
-       0,     0,     0,     0,   101,   102,     0,   105,    98,    40,
-       0,     0,     0,    32,    37,   391,     0,   244,     0,   368,
-     367,   134,     0,   133,     0,   287,   321,     0,   317,     0,
-     316,     0,     0,     0,     0,     0,     0,     0,   185,   175,
-       0,     0,   182,     0,     0,   167,     0,     0,   322,   311,
-     310,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   105,
+     102,   106,   101,    41,     0,   109,     0,     0,     0,     0,
+     372,   220,   324,   319,   323,   310,     0,     0,     0,     0,
+       0,   277,   279,   181,   193,     0,     0,   287,   285,   286,
+     288,   289,     0,     0,   147,   328,   317,    64,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   103,   100,   104,    99,    41,     0,
-     107,     0,     0,     0,     0,   366,   217,   319,   314,   318,
-     305,     0,     0,     0,     0,   272,   274,   179,   191,     0,
-       0,   282,   280,   281,   283,   284,     0,     0,   145,   323,
-     312,    64,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   106,   385,     0,   383,   380,
-       0,   245,     0,   269,     0,     0,     0,     0,   168,   166,
+       0,     0,     0,   108,   391,     0,   389,   386,     0,   248,
+       0,     0,   274,     0,     0,     0,     0,   170,   168,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   381,     0,     0,   389,   380,     0,
-       0,     0,   192,   184,    63,    69,    70,    67,    68,    71,
-      72,    73,    66,    93,    94,    91,    92,    95,    96,    97,
-      90,    77,    78,    75,    76,    79,    80,    81,    74,    85,
-      86,    83,    84,    87,    88,    89,    82,   386,   388,   387,
-     384,     0,   390,     0,   270,     0,     0,     0,   266,   379,
-       0,     0,     0,     0,   265,   267,   380,   268
+       0,     0,     0,     0,     0,   387,     0,     0,   395,   386,
+       0,     0,     0,     0,   194,   186,    63,    74,    69,    70,
+      67,    68,    71,    72,    73,    66,    99,    94,    95,    92,
+      93,    96,    97,    98,    91,    78,    79,    76,    77,    80,
+      81,    82,    75,    86,    87,    84,    85,    88,    89,    90,
+      83,   392,   394,   393,   390,     0,   396,     0,     0,   275,
+       0,     0,     0,     0,   270,   385,     0,     0,     0,     0,
+       0,     0,   269,   271,   386,   386,   273,   272
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -698,  -698,  -698,   856,  -698,   899,  -698,   484,  -698,   469,
-    -698,   418,   427,  -698,  -357,   900,   901,   808,  -698,  -698,
-     906,  -698,   679,   907,   908,   -57,   949,   -15,   775,   822,
-     -42,  -698,  -698,   541,  -698,  -698,  -698,  -698,  -698,  -698,
-    -162,  -698,  -698,  -698,  -698,   470,  -181,    32,   402,  -698,
-    -698,   836,  -698,  -698,   914,   915,   916,   917,   918,  -275,
-    -698,   662,  -170,  -172,  -698,  -394,  -383,  -382,  -381,  -379,
-    -698,  -698,  -698,  -698,  -698,  -698,   692,  -698,  -698,   595,
-     453,  -221,  -698,  -698,   419,  -698,  -698,  -698,  -698,   777,
-     615,   432,    -7,   283,   382,  -698,  -698,  -697,  -698,   200,
-     250,  -698
+    -675,  -675,  -675,   891,  -675,   923,  -675,   511,  -675,   491,
+    -675,   446,   447,  -675,  -359,   924,   927,   833,  -675,  -675,
+     929,  -675,   713,   930,   931,   -57,   966,   -15,   799,   849,
+     -32,  -675,  -675,   564,  -675,  -675,  -675,  -675,  -675,  -675,
+    -164,  -675,  -675,  -675,  -675,   492,  -220,    31,   427,  -675,
+    -675,   854,  -675,  -675,   934,   939,   940,   941,   942,  -278,
+    -675,   683,  -171,  -173,  -675,  -384,  -383,  -382,  -381,  -379,
+    -675,  -675,  -675,  -675,  -675,  -675,   707,  -675,  -675,   619,
+    -675,   466,  -222,  -675,  -675,   441,  -675,  -675,  -675,  -675,
+     791,   637,   454,   -67,   233,   394,  -675,  -675,  -674,  -675,
+     215,   265,  -675
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,    17,    18,    19,   116,    20,   357,   358,   359,   463,
-     537,   538,   539,   360,   262,    21,    22,   159,    23,    61,
-      24,   168,   169,    25,    26,    27,    28,    29,    92,   145,
-      93,   150,   347,   348,   435,   255,   352,   148,   319,   404,
-     171,   648,   575,    90,   397,   398,   399,   400,   512,    30,
-      79,    80,   401,   509,    31,    32,    33,    34,    35,   226,
-     367,   227,   228,   229,   792,   230,   231,   232,   233,   234,
-     518,   235,   236,   237,   238,   239,   297,   240,   241,   242,
-     243,   244,   245,   246,   247,   248,   249,   250,   251,   252,
-     477,   478,   173,   103,    95,    86,   100,   737,   543,   687,
-     688,   363
+       0,    17,    18,    19,   117,    20,   360,   361,   362,   466,
+     540,   541,   542,   363,   265,    21,    22,   160,    23,    61,
+      24,   169,   170,    25,    26,    27,    28,    29,    93,   146,
+      94,   151,   350,   351,   438,   258,   355,   149,   322,   407,
+     172,   654,   578,    91,   400,   401,   402,   403,   515,    30,
+      80,    81,   404,   512,    31,    32,    33,    34,    35,   228,
+     370,   229,   230,   231,   809,   232,   233,   234,   235,   236,
+     521,   237,   238,   239,   240,   241,   300,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   480,   481,   174,   104,    96,    87,   101,   748,   546,
+     695,   696,   366
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -1154,210 +1160,214 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-     269,    83,   378,   314,   123,   469,   268,    47,    91,   513,
-     312,   313,   295,   427,   494,   170,    14,   203,   204,   205,
-     514,   515,   516,   257,   517,   175,   408,   176,   177,   180,
-     354,   181,   182,   486,   292,   320,    48,   317,    50,   296,
-      87,   782,    88,   560,    89,    77,   433,   434,   146,   310,
-     311,   185,  -375,   186,   187,   316,    41,   510,   263,     1,
-      49,     2,     3,     4,     5,     6,     7,     8,     9,   341,
-     411,   321,   322,   101,   342,    10,    72,    11,    12,    13,
-    -378,   110,   343,   349,   350,   178,   485,   344,    47,   183,
-      94,   472,   345,   321,   322,   130,   369,   346,    76,   797,
-     409,   481,   201,    14,   136,   174,   321,   322,   541,   628,
-     511,   188,    78,   546,   210,   211,   212,   213,   292,    16,
-     412,   429,   321,   322,   382,   383,   321,   322,   153,   154,
-     155,    14,   199,    81,   267,   523,   162,   163,   164,    84,
-     214,   215,   216,    91,   264,    94,   318,   561,   355,   258,
-     356,   406,   407,    85,   413,   414,   415,   416,   417,   418,
-     419,   420,   421,   422,   423,   424,   425,   426,   202,   203,
-     204,   205,   321,   322,   111,   112,   325,   321,   322,   641,
-     179,   436,   144,   619,   184,   224,   396,   428,   223,   260,
-     642,   643,   644,   224,   645,  -379,  -379,   532,   102,   305,
-     353,   306,   307,   568,   321,   322,   189,   321,   322,   113,
-     315,    15,    51,    52,   131,   132,   489,   490,    53,   492,
-     321,   322,   133,   134,  -379,  -379,   335,   336,   337,   338,
-     339,   376,   109,   218,    16,   219,   220,   521,   364,   206,
-     207,   365,   519,   563,   533,   577,   534,   535,   208,   536,
-     209,   202,   203,   204,   205,    87,   395,    88,   108,    89,
-      62,    63,   349,    64,   321,   322,   210,   211,   212,   213,
-     385,   114,   386,   624,   387,    65,    66,   487,   381,   488,
-     340,   387,   565,   697,   115,   202,   203,   204,   205,    73,
-      74,    75,   214,   215,   216,   373,   374,   368,   582,   583,
-     584,   585,   586,   129,   468,   587,   588,   135,    36,    37,
-      38,   137,   466,   138,   217,   467,   558,   140,   559,   562,
-      39,    40,   206,   207,   139,   589,   104,   105,   106,   107,
-     141,   208,   218,   209,   219,   220,   295,   312,   313,   500,
-     221,   222,   223,   482,   634,   224,   318,   225,   377,   210,
-     211,   212,   213,   580,   143,   496,   206,   207,   497,   147,
-     777,    14,   778,   779,   483,   208,   149,   209,    42,    43,
-      44,   698,   337,   338,   339,   214,   215,   216,   152,   498,
-      45,    46,   499,   210,   211,   212,   213,    67,    68,   638,
-     639,   629,    69,    70,    71,   522,   151,   217,   202,   203,
-     204,   205,   545,   190,   156,   365,   157,   191,   192,   214,
-     215,   216,   193,   194,   158,   218,   160,   219,   220,    96,
-      97,    98,    99,   221,   222,   223,   547,   161,   224,   318,
-     225,   217,   202,   203,   204,   205,   325,   165,   590,   591,
-     592,   593,   594,   166,   551,   595,   596,   552,   167,   218,
-     172,   219,   220,  -379,  -379,   328,   329,   221,   222,   223,
-     553,  -379,   224,   552,   225,   597,   474,   475,   476,   206,
-     207,    54,    55,    56,    57,    58,    59,   699,   208,    60,
-     209,   170,   195,  -379,   333,   334,   335,   336,   337,   338,
-     339,   555,   579,   196,   318,   318,   210,   211,   212,   213,
-     254,   197,   253,   290,   291,   576,   620,   623,   650,   365,
-     365,   318,   208,   256,   209,   202,   203,   204,   205,   261,
-     265,   266,   214,   215,   216,   651,   742,   272,   652,   270,
-     210,   211,   212,   213,   598,   599,   600,   601,   602,   271,
-     273,   603,   604,   275,   217,   276,   606,   607,   608,   609,
-     610,   298,   685,   611,   612,   365,   214,   215,   216,   299,
-     691,   605,   218,   318,   219,   220,   693,   277,   300,   694,
-     221,   222,   223,   613,   293,   224,   734,   225,   217,   735,
-     502,  -199,   503,   504,   505,   506,   290,   507,   508,   743,
-     789,   294,   365,   735,   301,   208,   218,   209,   219,   220,
-     302,   380,   304,   308,   221,   222,   223,   309,   351,   224,
-     340,   225,   361,   210,   211,   212,   213,   362,     1,   366,
-       2,     3,     4,     5,     6,     7,     8,     9,    14,   371,
-     388,   372,   392,   379,    10,   375,    11,    12,    13,   214,
-     215,   216,   394,   389,     1,   390,     2,     3,     4,     5,
-       6,     7,   325,     9,   391,   393,   323,   403,   324,   405,
-      10,   217,    11,    12,    13,   410,   224,   430,   431,   326,
-     327,   328,   329,   432,   464,   465,   470,   331,   471,   218,
-     480,   219,   220,   473,   484,   409,   491,   221,   222,   223,
-      14,   493,   224,   501,   225,   321,   520,   524,   542,   332,
-     333,   334,   335,   336,   337,   338,   339,   325,   527,   549,
-     630,   528,   380,   529,   530,   531,    14,   550,   540,   548,
-     566,   554,   556,   567,   326,   327,   328,   329,   330,   564,
-     570,   571,   331,   380,   278,   279,   280,   281,   282,   283,
-     284,   285,   286,   287,   288,   289,   572,   573,   574,   578,
-     581,   614,   615,   621,   332,   333,   334,   335,   336,   337,
-     338,   339,   622,   325,   626,   631,   627,   633,   647,   635,
-      15,   636,   646,   640,   686,   649,   689,   736,   690,   653,
-     326,   327,   328,   329,   325,   525,   654,   655,   331,   656,
-     696,   657,   658,    16,   659,   700,    15,   701,   660,   661,
-     662,   326,   327,   328,   329,   663,   664,   665,   666,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,   667,    16,
-     668,   669,   670,   702,   703,   671,   672,   673,   674,   675,
-     676,   332,   333,   334,   335,   336,   337,   338,   339,   437,
-     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
-     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
-     704,   705,   458,   677,   678,   459,   460,   679,   680,   461,
-     462,   681,   682,   706,   683,   684,   692,   695,   707,   708,
-     709,   710,   711,   712,   713,   714,   715,   716,   717,   718,
-     719,   720,   721,   722,   723,   724,   725,   726,   727,   728,
-     729,   730,   731,   732,   733,   738,   318,   739,   740,   741,
-     783,   744,   745,   746,   747,   787,   748,   749,   750,   751,
-     752,   753,   754,   755,   756,   757,   788,   793,   758,   759,
-     760,   761,   762,   794,   763,   764,   765,   766,   767,   768,
-     769,   142,   770,   771,   772,   773,   370,   774,   775,   776,
-     781,   544,   784,   785,   557,   617,   790,   795,   791,   796,
-     117,   118,   119,   259,   618,    82,   200,   120,   121,   122,
-     637,   569,   274,   526,   198,   124,   125,   126,   127,   128,
-     402,   786,   632,     0,   625,   780,   495,   479,   384,   616,
-       0,     0,     0,   303
+     272,    84,   381,   317,   124,   271,   472,    47,    92,    14,
+     315,   316,   171,   260,   357,   320,   430,   497,   176,   323,
+     177,   178,   516,   517,   518,   519,   411,   520,   489,   513,
+     488,   436,   437,   563,   295,    48,    88,    50,    89,   299,
+      90,    41,   564,   535,    78,   181,   175,   182,   183,   313,
+     314,   204,   205,   206,   266,   319,   414,   636,    47,   147,
+    -384,   344,   132,   133,   637,   186,   345,   187,   188,   346,
+      95,    49,   102,   200,   347,   796,   324,   325,   179,   633,
+     111,   308,   514,   309,   310,   352,   353,   298,   324,   325,
+     536,   475,   537,   538,   131,   539,   324,   325,   372,    14,
+     412,   484,   324,   325,   137,   184,   415,   324,   325,   544,
+     324,   325,    16,   202,   549,   566,   203,   204,   205,   206,
+     295,   324,   325,   432,   321,   189,   385,   386,   154,   155,
+     156,   270,   358,    73,   359,   526,   163,   164,   165,   261,
+     816,   817,   324,   325,    77,   267,   324,   325,   211,   212,
+     213,   214,    79,   409,   410,    85,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     324,   325,   348,   180,   215,   216,   217,   349,    82,   379,
+     585,    86,   145,   439,   624,   225,   399,   207,   208,   263,
+     431,   224,   647,   648,   649,   650,   209,   651,   210,   571,
+     185,    51,    52,   356,   112,   113,   398,    53,    88,    92,
+      89,   318,    90,    95,   211,   212,   213,   214,   492,   493,
+     190,   495,   603,   604,   605,   606,   607,   225,   109,   608,
+     609,   103,    62,    63,   388,    64,   389,   110,   390,   524,
+     215,   216,   217,   522,   343,   580,   568,    65,    66,   610,
+     114,   203,   204,   205,   206,   490,   191,   491,   115,   390,
+     192,   193,   218,   116,   352,   194,   195,   586,   587,   588,
+     589,   590,   130,   629,   591,   592,   105,   106,   107,   108,
+     219,   384,   220,   221,   340,   341,   342,   706,   222,   223,
+     224,   594,   136,   225,   593,   226,   380,   376,   377,   371,
+     227,   611,   612,   613,   614,   615,   138,   471,   616,   617,
+     134,   135,   203,   204,   205,   206,   367,   139,   561,   368,
+     562,   565,   207,   208,   140,    36,    37,    38,   618,   324,
+     325,   209,   219,   210,   220,   221,   298,    39,    40,   315,
+     316,   791,   503,   792,   793,   469,   640,   141,   470,   211,
+     212,   213,   214,   644,   645,   583,    67,   142,   485,    68,
+      69,   321,   144,   148,    70,    71,    72,   486,   150,   203,
+     204,   205,   206,   152,   707,   215,   216,   217,   595,   596,
+     597,   598,   599,   207,   208,   600,   601,   499,    14,   153,
+     500,   157,   209,   634,   210,   158,   501,   218,   525,   502,
+     159,   203,   204,   205,   206,   602,   162,    42,    43,    44,
+     211,   212,   213,   214,   161,   219,   166,   220,   221,    45,
+      46,   167,   168,   222,   223,   224,   548,   171,   225,   368,
+     226,    97,    98,    99,   100,   227,   215,   216,   217,   173,
+     207,   208,    54,    55,    56,    57,    58,    59,   196,   209,
+      60,   210,   505,  -201,   506,   507,   508,   509,   218,   510,
+     511,   550,   554,   556,   321,   555,   555,   211,   212,   213,
+     214,   197,   293,   294,   558,   198,   219,   321,   220,   221,
+     256,   209,   708,   210,   222,   223,   224,   582,   264,   225,
+     321,   226,   257,   215,   216,   217,   227,   259,   269,   211,
+     212,   213,   214,   625,   628,   268,   368,   368,   579,   328,
+     203,   204,   205,   206,   656,   218,   657,   321,   693,   658,
+     699,   368,   273,   321,   275,   215,   216,   217,  -385,  -385,
+      74,    75,    76,   219,   754,   220,   221,   702,   274,   276,
+     703,   222,   223,   224,   278,   279,   225,   218,   226,   280,
+     301,   745,   755,   227,   746,   368,   296,  -385,  -385,   338,
+     339,   340,   341,   342,   297,   219,   805,   220,   221,   746,
+     477,   478,   479,   222,   223,   224,   302,   303,   225,   304,
+     226,   293,   305,   307,   311,   227,   312,   354,   364,  -381,
+     209,   378,   210,   343,   365,    14,     1,   369,     2,     3,
+       4,     5,     6,     7,     8,     9,   374,   375,   211,   212,
+     213,   214,    10,   382,    11,    12,    13,   391,   392,   393,
+     394,     1,   395,     2,     3,     4,     5,     6,     7,     8,
+       9,   396,   397,   406,   215,   216,   217,    10,   413,    11,
+      12,    13,     1,   408,     2,     3,     4,     5,     6,     7,
+     225,     9,   383,   433,   434,   435,   218,   467,    10,   468,
+      11,    12,    13,   473,   326,   474,   327,   483,    14,   476,
+     412,   487,   494,   496,   219,   504,   220,   221,   324,   523,
+     527,   530,   222,   223,   224,   531,   532,   225,   533,   226,
+     534,   543,   545,    14,   227,   551,   552,   553,   557,   569,
+     567,   559,   570,   328,   573,   575,   577,   383,   574,   576,
+     581,   619,   584,   620,    14,   328,   626,   627,   631,   632,
+     329,   330,   331,   332,   639,   641,   642,   646,   334,   652,
+     655,   653,   329,   330,   331,   332,   333,   659,   660,   661,
+     334,   662,   694,   663,   664,   665,   666,   667,    15,   668,
+     335,   336,   337,   338,   339,   340,   341,   342,   328,   697,
+     669,   635,   335,   336,   337,   338,   339,   340,   341,   342,
+     383,    16,   670,    15,   671,   329,   330,   331,   332,   672,
+     528,   698,   673,   334,   674,   675,   676,   677,   678,   679,
+     680,   681,   682,   683,    15,   684,    16,   685,   686,   705,
+     709,   687,   688,   689,   710,   335,   336,   337,   338,   339,
+     340,   341,   342,   711,   690,   691,   692,    16,   700,   712,
+     701,   328,   704,   713,   714,   715,   716,   717,   718,   719,
+     328,   720,   721,   722,   723,   724,   725,   726,   329,   330,
+     331,   332,   727,   728,   729,   730,   334,  -385,  -385,   331,
+     332,   731,   732,   733,   734,  -385,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   335,   336,
+     337,   338,   339,   340,   341,   342,   735,  -385,   336,   337,
+     338,   339,   340,   341,   342,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   458,   459,   460,   736,   737,   461,   738,
+     739,   462,   463,   740,   741,   464,   465,   742,   743,   744,
+     747,   749,   795,   750,   751,   752,   753,   321,   756,   757,
+     797,   758,   759,   760,   761,   762,   763,   764,   765,   802,
+     766,   767,   768,   769,   770,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
+     786,   787,   788,   789,   790,   803,   799,   804,   798,   812,
+     800,   806,   807,   808,   810,   811,   813,   143,   814,   560,
+     815,   547,    83,   373,   118,   119,   622,   623,   120,   262,
+     121,   122,   123,   199,   201,   125,   572,   277,   643,   529,
+     126,   127,   128,   129,   405,   621,   387,   638,   306,   630,
+     801,   794,   482,   498
 };
 
 static const yytype_int16 yycheck[] =
 {
-     170,    16,   277,   224,    61,   362,   168,     3,     8,   403,
-       5,     6,    88,     3,     3,    67,    79,     4,     5,     6,
-     403,   403,   403,    56,   403,     3,    76,     5,     6,     3,
-       3,     5,     6,    87,   206,    56,     4,    77,     6,   209,
-      20,   738,    22,    84,    24,    13,    71,    72,    90,   221,
-     222,     3,     0,     5,     6,   225,    33,     3,    34,     7,
-      77,     9,    10,    11,    12,    13,    14,    15,    16,   181,
-      74,   147,   148,    41,   186,    23,    30,    25,    26,    27,
-      63,    49,   181,   253,   254,    63,    56,   186,     3,    63,
-      73,   366,   181,   147,   148,    63,   266,   186,     3,   796,
-     150,   376,   144,    79,    72,   112,   147,   148,   465,    84,
-      56,    63,     3,   470,   101,   102,   103,   104,   290,   182,
-     124,   342,   147,   148,   294,   295,   147,   148,    96,    97,
-      98,    79,   139,   160,   186,   410,   104,   105,   106,     0,
-     127,   128,   129,     8,   159,    73,   186,    87,   121,   182,
-     123,   321,   322,   185,   326,   327,   328,   329,   330,   331,
-     332,   333,   334,   335,   336,   337,   338,   339,     3,     4,
-       5,     6,   147,   148,    77,    78,   125,   147,   148,   573,
-     158,   351,   182,   540,   158,   180,   182,   177,   177,   157,
-     573,   573,   573,   180,   573,   144,   145,    74,    73,   116,
-     257,   118,   119,   183,   147,   148,   158,   147,   148,     3,
-     225,   159,   156,   157,   164,   165,   386,   387,   162,   389,
-     147,   148,   164,   165,   173,   174,   175,   176,   177,   178,
-     179,    66,    14,   167,   182,   169,   170,   409,   183,    74,
-      75,   186,   404,   186,   121,   520,   123,   124,    83,   126,
-      85,     3,     4,     5,     6,    20,   183,    22,   184,    24,
-      29,    30,   432,    32,   147,   148,   101,   102,   103,   104,
-      84,     3,    86,   548,    88,    44,    45,    84,   293,    86,
-     184,    88,   186,   640,     3,     3,     4,     5,     6,   151,
-     152,   153,   127,   128,   129,    48,    49,   265,    90,    91,
-      92,    93,    94,     3,   361,    97,    98,     3,    29,    30,
-      31,    56,   183,   186,   149,   186,   486,   183,   488,   491,
-      41,    42,    74,    75,     6,   117,    43,    44,    45,    46,
-     183,    83,   167,    85,   169,   170,    88,     5,     6,   396,
-     175,   176,   177,   183,   565,   180,   186,   182,   183,   101,
-     102,   103,   104,   525,    21,   183,    74,    75,   186,    66,
-       3,    79,     5,     6,   379,    83,    68,    85,    29,    30,
-      31,   646,   177,   178,   179,   127,   128,   129,     3,   183,
-      41,    42,   186,   101,   102,   103,   104,   156,   157,   570,
-     571,   561,   161,   162,   163,   410,    74,   149,     3,     4,
-       5,     6,   183,    42,     3,   186,    63,    46,    47,   127,
-     128,   129,    51,    52,   182,   167,    75,   169,   170,    37,
-      38,    39,    40,   175,   176,   177,   183,     3,   180,   186,
-     182,   149,     3,     4,     5,     6,   125,     3,    90,    91,
-      92,    93,    94,     3,   183,    97,    98,   186,     3,   167,
-       4,   169,   170,   142,   143,   144,   145,   175,   176,   177,
-     183,   150,   180,   186,   182,   117,    80,    81,    82,    74,
-      75,    35,    36,    37,    38,    39,    40,   647,    83,    43,
-      85,    67,     3,   172,   173,   174,   175,   176,   177,   178,
-     179,   183,   183,     3,   186,   186,   101,   102,   103,   104,
-      69,   182,    54,    74,    75,   520,   183,   183,   183,   186,
-     186,   186,    83,    75,    85,     3,     4,     5,     6,     3,
-      63,   172,   127,   128,   129,   183,   696,     3,   186,    79,
-     101,   102,   103,   104,    90,    91,    92,    93,    94,    79,
-       6,    97,    98,   183,   149,   183,    90,    91,    92,    93,
-      94,     4,   183,    97,    98,   186,   127,   128,   129,     4,
-     183,   117,   167,   186,   169,   170,   183,   182,     4,   186,
-     175,   176,   177,   117,   182,   180,   183,   182,   149,   186,
-      57,    58,    59,    60,    61,    62,    74,    64,    65,   183,
-     183,   182,   186,   186,     4,    83,   167,    85,   169,   170,
-       6,    74,   182,   182,   175,   176,   177,   182,    70,   180,
-     184,   182,    56,   101,   102,   103,   104,   182,     7,   182,
-       9,    10,    11,    12,    13,    14,    15,    16,    79,   182,
-       4,   182,     4,   182,    23,   183,    25,    26,    27,   127,
-     128,   129,   183,   182,     7,   182,     9,    10,    11,    12,
-      13,    14,   125,    16,   182,     4,    74,   166,    76,     3,
-      23,   149,    25,    26,    27,   182,   180,     6,     5,   142,
-     143,   144,   145,   186,   122,   182,   182,   150,     3,   167,
-       6,   169,   170,   186,   183,   150,    77,   175,   176,   177,
-      79,     4,   180,   186,   182,   147,   182,   124,    28,   172,
-     173,   174,   175,   176,   177,   178,   179,   125,   182,     4,
-     183,   182,    74,   182,   182,   182,    79,     3,   182,   182,
-       4,    50,   183,     4,   142,   143,   144,   145,   146,   186,
-      58,    58,   150,    74,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,   139,   140,   141,     3,   186,    53,   183,
-       6,   124,   122,   182,   172,   173,   174,   175,   176,   177,
-     178,   179,   155,   125,     6,   180,   183,     4,    55,   183,
-     159,   183,    54,   182,     3,   183,     3,    79,   155,   186,
-     142,   143,   144,   145,   125,   147,   186,   186,   150,   186,
-      63,   186,   186,   182,   186,     6,   159,     6,   186,   186,
-     186,   142,   143,   144,   145,   186,   186,   186,   186,   150,
-     172,   173,   174,   175,   176,   177,   178,   179,   186,   182,
-     186,   186,   186,     6,     6,   186,   186,   186,   186,   186,
-     186,   172,   173,   174,   175,   176,   177,   178,   179,    89,
-      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
-     100,   101,   102,   103,   104,   105,   106,   107,   108,   109,
-       6,     6,   112,   186,   186,   115,   116,   186,   186,   119,
-     120,   186,   186,     6,   186,   186,   186,   186,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,   172,     3,   186,     4,     4,     4,
-     186,   183,   183,   183,   183,     4,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,     4,     6,   183,   183,
-     183,   183,   183,     4,   183,   183,   183,   183,   183,   183,
-     183,    85,   183,   183,   183,   183,   267,   183,   183,   183,
-     182,   467,   183,   186,   485,   537,   186,   183,   186,   183,
-      61,    61,    61,   155,   537,    16,   144,    61,    61,    61,
-     568,   501,   197,   432,   138,    61,    61,    61,    61,    61,
-     318,   781,   563,    -1,   552,   735,   391,   372,   296,   536,
-      -1,    -1,    -1,   216
+     171,    16,   280,   225,    61,   169,   365,     3,     8,    79,
+       5,     6,    67,    56,     3,    77,     3,     3,     3,    56,
+       5,     6,   406,   406,   406,   406,    76,   406,    87,     3,
+      56,    71,    72,    84,   207,     4,    20,     6,    22,   210,
+      24,    33,    87,    74,    13,     3,   113,     5,     6,   222,
+     223,     4,     5,     6,    34,   226,    74,   180,     3,    91,
+      63,   181,   164,   165,   187,     3,   186,     5,     6,   181,
+      73,    77,    41,   140,   186,   749,   147,   148,    63,    84,
+      49,   116,    56,   118,   119,   256,   257,    88,   147,   148,
+     121,   369,   123,   124,    63,   126,   147,   148,   269,    79,
+     150,   379,   147,   148,    73,    63,   124,   147,   148,   468,
+     147,   148,   182,   145,   473,   186,     3,     4,     5,     6,
+     293,   147,   148,   345,   186,    63,   297,   298,    97,    98,
+      99,   186,   121,    30,   123,   413,   105,   106,   107,   182,
+     814,   815,   147,   148,     3,   160,   147,   148,   101,   102,
+     103,   104,     3,   324,   325,     0,   329,   330,   331,   332,
+     333,   334,   335,   336,   337,   338,   339,   340,   341,   342,
+     147,   148,   181,   158,   127,   128,   129,   186,   160,    66,
+       3,   185,   182,   354,   543,   180,   182,    74,    75,   158,
+     177,   177,   576,   576,   576,   576,    83,   576,    85,   183,
+     158,   156,   157,   260,    77,    78,   183,   162,    20,     8,
+      22,   226,    24,    73,   101,   102,   103,   104,   389,   390,
+     158,   392,    90,    91,    92,    93,    94,   180,   184,    97,
+      98,    73,    29,    30,    84,    32,    86,    14,    88,   412,
+     127,   128,   129,   407,   184,   523,   186,    44,    45,   117,
+       3,     3,     4,     5,     6,    84,    42,    86,     3,    88,
+      46,    47,   149,     3,   435,    51,    52,    90,    91,    92,
+      93,    94,     3,   551,    97,    98,    43,    44,    45,    46,
+     167,   296,   169,   170,   177,   178,   179,   646,   175,   176,
+     177,     3,     3,   180,   117,   182,   183,    48,    49,   268,
+     187,    90,    91,    92,    93,    94,    56,   364,    97,    98,
+     164,   165,     3,     4,     5,     6,   183,   186,   489,   186,
+     491,   494,    74,    75,     6,    29,    30,    31,   117,   147,
+     148,    83,   167,    85,   169,   170,    88,    41,    42,     5,
+       6,     3,   399,     5,     6,   183,   568,   183,   186,   101,
+     102,   103,   104,   573,   574,   528,   153,   183,   183,   156,
+     157,   186,    21,    66,   161,   162,   163,   382,    68,     3,
+       4,     5,     6,    74,   652,   127,   128,   129,    90,    91,
+      92,    93,    94,    74,    75,    97,    98,   183,    79,     3,
+     186,     3,    83,   564,    85,    63,   183,   149,   413,   186,
+     182,     3,     4,     5,     6,   117,     3,    29,    30,    31,
+     101,   102,   103,   104,    75,   167,     3,   169,   170,    41,
+      42,     3,     3,   175,   176,   177,   183,    67,   180,   186,
+     182,    37,    38,    39,    40,   187,   127,   128,   129,     4,
+      74,    75,    35,    36,    37,    38,    39,    40,     3,    83,
+      43,    85,    57,    58,    59,    60,    61,    62,   149,    64,
+      65,   183,   183,   183,   186,   186,   186,   101,   102,   103,
+     104,     3,    74,    75,   183,   182,   167,   186,   169,   170,
+      54,    83,   653,    85,   175,   176,   177,   183,     3,   180,
+     186,   182,    69,   127,   128,   129,   187,    75,   172,   101,
+     102,   103,   104,   183,   183,    63,   186,   186,   523,   125,
+       3,     4,     5,     6,   183,   149,   183,   186,   183,   186,
+     183,   186,    79,   186,     3,   127,   128,   129,   144,   145,
+     151,   152,   153,   167,   705,   169,   170,   183,    79,     6,
+     186,   175,   176,   177,   183,   183,   180,   149,   182,   182,
+       4,   183,   183,   187,   186,   186,   182,   173,   174,   175,
+     176,   177,   178,   179,   182,   167,   183,   169,   170,   186,
+      80,    81,    82,   175,   176,   177,     4,     4,   180,     4,
+     182,    74,     6,   182,   182,   187,   182,    70,    56,     0,
+      83,   183,    85,   184,   182,    79,     7,   182,     9,    10,
+      11,    12,    13,    14,    15,    16,   182,   182,   101,   102,
+     103,   104,    23,   182,    25,    26,    27,     4,   182,   182,
+     182,     7,     4,     9,    10,    11,    12,    13,    14,    15,
+      16,     4,   183,   166,   127,   128,   129,    23,   182,    25,
+      26,    27,     7,     3,     9,    10,    11,    12,    13,    14,
+     180,    16,    74,     6,     5,   186,   149,   122,    23,   182,
+      25,    26,    27,   182,    74,     3,    76,     6,    79,   186,
+     150,   183,    77,     4,   167,   186,   169,   170,   147,   182,
+     124,   182,   175,   176,   177,   182,   182,   180,   182,   182,
+     182,   182,    28,    79,   187,   182,     4,     3,    50,     4,
+     186,   183,     4,   125,    58,     3,    53,    74,    58,   186,
+     183,   124,     6,   122,    79,   125,   182,   155,     6,   183,
+     142,   143,   144,   145,     4,   183,   183,   182,   150,    54,
+     183,    55,   142,   143,   144,   145,   146,   186,   186,   186,
+     150,   186,     3,   186,   186,   186,   186,   186,   159,   186,
+     172,   173,   174,   175,   176,   177,   178,   179,   125,     3,
+     186,   183,   172,   173,   174,   175,   176,   177,   178,   179,
+      74,   182,   186,   159,   186,   142,   143,   144,   145,   186,
+     147,   155,   186,   150,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   159,   186,   182,   186,   186,    63,
+       6,   186,   186,   186,     6,   172,   173,   174,   175,   176,
+     177,   178,   179,     6,   186,   186,   186,   182,   186,     6,
+     186,   125,   186,     6,     6,     6,     6,     6,     6,     6,
+     125,     6,     6,     6,     6,     6,     6,     6,   142,   143,
+     144,   145,     6,     6,     6,     6,   150,   142,   143,   144,
+     145,     6,     6,     6,     6,   150,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   172,   173,
+     174,   175,   176,   177,   178,   179,     6,   172,   173,   174,
+     175,   176,   177,   178,   179,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,     6,     6,   112,     6,
+       6,   115,   116,     6,     6,   119,   120,     6,     6,   172,
+      79,     3,   182,     4,     4,     4,     4,   186,   183,   183,
+     186,   183,   183,   183,   183,   183,   183,   183,   183,     4,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,     4,   183,     4,   186,     4,
+     186,   186,   186,   186,     6,     6,   183,    86,   183,   488,
+     183,   470,    16,   270,    61,    61,   540,   540,    61,   156,
+      61,    61,    61,   139,   145,    61,   504,   198,   571,   435,
+      61,    61,    61,    61,   321,   539,   299,   566,   217,   555,
+     795,   746,   375,   394
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1365,130 +1375,132 @@ static const yytype_int16 yycheck[] =
 static const yytype_int16 yystos[] =
 {
        0,     7,     9,    10,    11,    12,    13,    14,    15,    16,
-      23,    25,    26,    27,    79,   159,   182,   188,   189,   190,
-     192,   202,   203,   205,   207,   210,   211,   212,   213,   214,
-     236,   241,   242,   243,   244,   245,    29,    30,    31,    41,
-      42,    33,    29,    30,    31,    41,    42,     3,   234,    77,
-     234,   156,   157,   162,    35,    36,    37,    38,    39,    40,
-      43,   206,    29,    30,    32,    44,    45,   156,   157,   161,
-     162,   163,    30,   151,   152,   153,     3,   234,     3,   237,
-     238,   160,   213,   214,     0,   185,   282,    20,    22,    24,
-     230,     8,   215,   217,    73,   281,   281,   281,   281,   281,
-     283,   234,    73,   280,   280,   280,   280,   280,   184,    14,
-     234,    77,    78,     3,     3,     3,   191,   192,   202,   203,
-     207,   210,   211,   212,   241,   242,   243,   244,   245,     3,
-     234,   164,   165,   164,   165,     3,   234,    56,   186,     6,
-     183,   183,   190,    21,   182,   216,   217,    66,   224,    68,
-     218,    74,     3,   234,   234,   234,     3,    63,   182,   204,
-      75,     3,   234,   234,   234,     3,     3,     3,   208,   209,
-      67,   227,     4,   279,   279,     3,     5,     6,    63,   158,
-       3,     5,     6,    63,   158,     3,     5,     6,    63,   158,
-      42,    46,    47,    51,    52,     3,     3,   182,   238,   279,
-     216,   217,     3,     4,     5,     6,    74,    75,    83,    85,
-     101,   102,   103,   104,   127,   128,   129,   149,   167,   169,
-     170,   175,   176,   177,   180,   182,   246,   248,   249,   250,
-     252,   253,   254,   255,   256,   258,   259,   260,   261,   262,
-     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
-     274,   275,   276,    54,    69,   222,    75,    56,   182,   204,
-     234,     3,   201,    34,   214,    63,   172,   186,   227,   249,
-      79,    79,     3,     6,   215,   183,   183,   182,   130,   131,
-     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
-      74,    75,   250,   182,   182,    88,   249,   263,     4,     4,
-       4,     4,     6,   276,   182,   116,   118,   119,   182,   182,
-     250,   250,     5,     6,   268,   214,   249,    77,   186,   225,
-      56,   147,   148,    74,    76,   125,   142,   143,   144,   145,
-     146,   150,   172,   173,   174,   175,   176,   177,   178,   179,
-     184,   181,   186,   181,   186,   181,   186,   219,   220,   249,
-     249,    70,   223,   212,     3,   121,   123,   193,   194,   195,
-     200,    56,   182,   288,   183,   186,   182,   247,   234,   249,
-     209,   182,   182,    48,    49,   183,    66,   183,   246,   182,
-      74,   214,   249,   249,   263,    84,    86,    88,     4,   182,
-     182,   182,     4,     4,   183,   183,   182,   231,   232,   233,
-     234,   239,   248,   166,   226,     3,   249,   249,    76,   150,
-     182,    74,   124,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,     3,   177,   268,
-       6,     5,   186,    71,    72,   221,   249,    89,    90,    91,
-      92,    93,    94,    95,    96,    97,    98,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   112,   115,
-     116,   119,   120,   196,   122,   182,   183,   186,   212,   201,
-     182,     3,   246,   186,    80,    81,    82,   277,   278,   277,
-       6,   246,   183,   214,   183,    56,    87,    84,    86,   249,
-     249,    77,   249,     4,     3,   266,   183,   186,   183,   186,
-     212,   186,    57,    59,    60,    61,    62,    64,    65,   240,
-       3,    56,   235,   252,   253,   254,   255,   256,   257,   227,
-     182,   250,   214,   246,   124,   147,   220,   182,   182,   182,
-     182,   182,    74,   121,   123,   124,   126,   197,   198,   199,
-     182,   201,    28,   285,   194,   183,   201,   183,   182,     4,
-       3,   183,   186,   183,    50,   183,   183,   196,   249,   249,
-      84,    87,   250,   186,   186,   186,     4,     4,   183,   232,
-      58,    58,     3,   186,    53,   229,   214,   246,   183,   183,
-     250,     6,    90,    91,    92,    93,    94,    97,    98,   117,
-      90,    91,    92,    93,    94,    97,    98,   117,    90,    91,
-      92,    93,    94,    97,    98,   117,    90,    91,    92,    93,
-      94,    97,    98,   117,   124,   122,   267,   198,   199,   201,
-     183,   182,   155,   183,   246,   278,     6,   183,    84,   249,
-     183,   180,   271,     4,   268,   183,   183,   235,   233,   233,
-     182,   252,   253,   254,   255,   256,    54,    55,   228,   183,
-     183,   183,   186,   186,   186,   186,   186,   186,   186,   186,
+      23,    25,    26,    27,    79,   159,   182,   189,   190,   191,
+     193,   203,   204,   206,   208,   211,   212,   213,   214,   215,
+     237,   242,   243,   244,   245,   246,    29,    30,    31,    41,
+      42,    33,    29,    30,    31,    41,    42,     3,   235,    77,
+     235,   156,   157,   162,    35,    36,    37,    38,    39,    40,
+      43,   207,    29,    30,    32,    44,    45,   153,   156,   157,
+     161,   162,   163,    30,   151,   152,   153,     3,   235,     3,
+     238,   239,   160,   214,   215,     0,   185,   284,    20,    22,
+      24,   231,     8,   216,   218,    73,   283,   283,   283,   283,
+     283,   285,   235,    73,   282,   282,   282,   282,   282,   184,
+      14,   235,    77,    78,     3,     3,     3,   192,   193,   203,
+     204,   208,   211,   212,   213,   242,   243,   244,   245,   246,
+       3,   235,   164,   165,   164,   165,     3,   235,    56,   186,
+       6,   183,   183,   191,    21,   182,   217,   218,    66,   225,
+      68,   219,    74,     3,   235,   235,   235,     3,    63,   182,
+     205,    75,     3,   235,   235,   235,     3,     3,     3,   209,
+     210,    67,   228,     4,   281,   281,     3,     5,     6,    63,
+     158,     3,     5,     6,    63,   158,     3,     5,     6,    63,
+     158,    42,    46,    47,    51,    52,     3,     3,   182,   239,
+     281,   217,   218,     3,     4,     5,     6,    74,    75,    83,
+      85,   101,   102,   103,   104,   127,   128,   129,   149,   167,
+     169,   170,   175,   176,   177,   180,   182,   187,   247,   249,
+     250,   251,   253,   254,   255,   256,   257,   259,   260,   261,
+     262,   263,   265,   266,   267,   268,   269,   270,   271,   272,
+     273,   274,   275,   276,   277,   278,    54,    69,   223,    75,
+      56,   182,   205,   235,     3,   202,    34,   215,    63,   172,
+     186,   228,   250,    79,    79,     3,     6,   216,   183,   183,
+     182,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,    74,    75,   251,   182,   182,    88,   250,
+     264,     4,     4,     4,     4,     6,   278,   182,   116,   118,
+     119,   182,   182,   251,   251,     5,     6,   270,   215,   250,
+      77,   186,   226,    56,   147,   148,    74,    76,   125,   142,
+     143,   144,   145,   146,   150,   172,   173,   174,   175,   176,
+     177,   178,   179,   184,   181,   186,   181,   186,   181,   186,
+     220,   221,   250,   250,    70,   224,   213,     3,   121,   123,
+     194,   195,   196,   201,    56,   182,   290,   183,   186,   182,
+     248,   235,   250,   210,   182,   182,    48,    49,   183,    66,
+     183,   247,   182,    74,   215,   250,   250,   264,    84,    86,
+      88,     4,   182,   182,   182,     4,     4,   183,   183,   182,
+     232,   233,   234,   235,   240,   249,   166,   227,     3,   250,
+     250,    76,   150,   182,    74,   124,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+       3,   177,   270,     6,     5,   186,    71,    72,   222,   250,
+      89,    90,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   112,   115,   116,   119,   120,   197,   122,   182,   183,
+     186,   213,   202,   182,     3,   247,   186,    80,    81,    82,
+     279,   280,   279,     6,   247,   183,   215,   183,    56,    87,
+      84,    86,   250,   250,    77,   250,     4,     3,   267,   183,
+     186,   183,   186,   213,   186,    57,    59,    60,    61,    62,
+      64,    65,   241,     3,    56,   236,   253,   254,   255,   256,
+     257,   258,   228,   182,   251,   215,   247,   124,   147,   221,
+     182,   182,   182,   182,   182,    74,   121,   123,   124,   126,
+     198,   199,   200,   182,   202,    28,   287,   195,   183,   202,
+     183,   182,     4,     3,   183,   186,   183,    50,   183,   183,
+     197,   250,   250,    84,    87,   251,   186,   186,   186,     4,
+       4,   183,   233,    58,    58,     3,   186,    53,   230,   215,
+     247,   183,   183,   251,     6,     3,    90,    91,    92,    93,
+      94,    97,    98,   117,     3,    90,    91,    92,    93,    94,
+      97,    98,   117,    90,    91,    92,    93,    94,    97,    98,
+     117,    90,    91,    92,    93,    94,    97,    98,   117,   124,
+     122,   269,   199,   200,   202,   183,   182,   155,   183,   247,
+     280,     6,   183,    84,   250,   183,   180,   187,   273,     4,
+     270,   183,   183,   236,   234,   234,   182,   253,   254,   255,
+     256,   257,    54,    55,   229,   183,   183,   183,   186,   186,
      186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
      186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186,   183,     3,   286,   287,     3,
-     155,   183,   186,   183,   186,   186,    63,   201,   246,   249,
+     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   183,     3,   288,   289,     3,   155,   183,
+     186,   186,   183,   186,   186,    63,   202,   247,   250,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,   172,   183,   186,    79,   284,     3,     4,
-       4,     4,   249,   183,   183,   183,   183,   183,   183,   183,
+       6,     6,     6,     6,   172,   183,   186,    79,   286,     3,
+       4,     4,     4,     4,   250,   183,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
      183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
      183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
-     183,   183,   183,   183,   183,   183,   183,     3,     5,     6,
-     287,   182,   284,   186,   183,   186,   286,     4,     4,   183,
-     186,   186,   251,     6,     4,   183,   183,   284
+     183,     3,     5,     6,   289,   182,   286,   186,   186,   183,
+     186,   288,     4,     4,     4,   183,   186,   186,   186,   252,
+       6,     6,     4,   183,   183,   183,   286,   286
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int16 yyr1[] =
 {
-       0,   187,   188,   189,   189,   190,   190,   190,   190,   190,
-     190,   190,   190,   190,   190,   190,   190,   190,   191,   191,
-     191,   191,   191,   191,   191,   191,   191,   191,   191,   191,
-     192,   192,   192,   192,   192,   192,   193,   193,   194,   194,
-     195,   195,   196,   196,   196,   196,   196,   196,   196,   196,
-     196,   196,   196,   196,   196,   196,   196,   196,   196,   196,
-     196,   196,   196,   196,   196,   196,   196,   196,   196,   196,
-     196,   196,   196,   196,   196,   196,   196,   196,   196,   196,
-     196,   196,   196,   196,   196,   196,   196,   196,   196,   196,
-     196,   196,   196,   196,   196,   196,   196,   196,   197,   197,
-     198,   198,   198,   198,   199,   199,   200,   200,   201,   201,
-     202,   203,   203,   204,   204,   205,   206,   206,   206,   206,
-     206,   206,   206,   206,   207,   208,   208,   209,   210,   210,
-     210,   210,   210,   211,   211,   212,   212,   212,   212,   213,
-     213,   214,   215,   216,   216,   217,   218,   218,   219,   219,
-     220,   221,   221,   221,   222,   222,   223,   223,   224,   224,
+       0,   188,   189,   190,   190,   191,   191,   191,   191,   191,
+     191,   191,   191,   191,   191,   191,   191,   191,   192,   192,
+     192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+     193,   193,   193,   193,   193,   193,   194,   194,   195,   195,
+     196,   196,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     197,   197,   197,   197,   197,   197,   197,   197,   197,   197,
+     198,   198,   199,   199,   199,   199,   200,   200,   201,   201,
+     202,   202,   203,   204,   204,   205,   205,   206,   207,   207,
+     207,   207,   207,   207,   207,   207,   208,   209,   209,   210,
+     211,   211,   211,   211,   211,   212,   212,   213,   213,   213,
+     213,   214,   214,   215,   216,   217,   217,   218,   219,   219,
+     220,   220,   221,   222,   222,   222,   223,   223,   224,   224,
      225,   225,   226,   226,   227,   227,   228,   228,   229,   229,
-     230,   230,   230,   230,   231,   231,   232,   232,   233,   233,
-     234,   234,   235,   235,   235,   235,   236,   236,   237,   237,
-     238,   239,   239,   240,   240,   240,   240,   240,   240,   240,
-     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
-     242,   242,   242,   243,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   245,   246,   246,   247,   247,   248,   248,   249,   249,
-     249,   249,   249,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   251,   251,   252,   253,   254,
-     254,   255,   255,   256,   256,   257,   257,   257,   257,   257,
-     257,   257,   257,   257,   257,   258,   258,   258,   258,   258,
+     230,   230,   231,   231,   231,   231,   232,   232,   233,   233,
+     234,   234,   235,   235,   236,   236,   236,   236,   237,   237,
+     238,   238,   239,   240,   240,   241,   241,   241,   241,   241,
+     241,   241,   242,   242,   242,   242,   242,   242,   242,   242,
+     242,   242,   242,   242,   242,   242,   242,   242,   242,   242,
+     242,   242,   242,   243,   243,   243,   244,   245,   245,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   245,   246,   247,   247,   248,   248,   249,
+     249,   250,   250,   250,   250,   250,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   252,
+     252,   253,   254,   254,   255,   255,   256,   256,   257,   257,
      258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   259,   259,
-     260,   261,   261,   262,   262,   262,   262,   263,   263,   264,
-     265,   265,   265,   265,   266,   266,   266,   266,   267,   267,
-     267,   267,   267,   267,   267,   267,   267,   267,   267,   267,
-     268,   268,   269,   270,   270,   271,   271,   272,   273,   273,
-     274,   275,   275,   276,   276,   276,   276,   276,   276,   276,
-     276,   276,   276,   276,   276,   277,   277,   278,   278,   278,
-     279,   280,   280,   281,   281,   282,   282,   283,   283,   284,
-     284,   285,   285,   286,   286,   287,   287,   287,   287,   288,
-     288,   288
+     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   259,   260,   260,   261,   262,   262,   263,   263,
+     263,   263,   264,   264,   265,   266,   266,   266,   266,   267,
+     267,   267,   267,   268,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   270,   270,   271,   272,
+     272,   273,   273,   274,   275,   275,   276,   277,   277,   278,
+     278,   278,   278,   278,   278,   278,   278,   278,   278,   278,
+     278,   279,   279,   280,   280,   280,   281,   282,   282,   283,
+     283,   284,   284,   285,   285,   286,   286,   287,   287,   288,
+     288,   289,   289,   289,   289,   290,   290,   290
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1503,37 +1515,37 @@ static const yytype_int8 yyr2[] =
        1,     1,     1,     6,     4,     1,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
        6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,     6,     6,     6,     1,     2,
-       2,     1,     1,     2,     2,     0,     5,     4,     1,     3,
-       4,     6,     5,     3,     0,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     5,     1,     3,     3,     4,     4,
-       4,     4,     6,     8,     8,     1,     1,     3,     3,     3,
-       3,     2,     4,     3,     3,     8,     3,     0,     1,     3,
-       2,     1,     1,     0,     2,     0,     2,     0,     1,     0,
-       2,     0,     2,     0,     2,     0,     2,     0,     3,     0,
-       1,     2,     1,     1,     1,     3,     1,     1,     2,     4,
-       1,     3,     2,     1,     5,     0,     2,     0,     1,     3,
-       5,     4,     6,     1,     1,     1,     1,     1,     1,     0,
-       2,     2,     2,     2,     3,     2,     3,     3,     4,     4,
-       3,     3,     4,     4,     5,     6,     7,     9,     4,     5,
-       2,     2,     2,     2,     2,     4,     4,     4,     4,     4,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       1,     2,     2,     1,     1,     2,     2,     0,     5,     4,
+       1,     3,     4,     6,     5,     3,     0,     3,     1,     1,
+       1,     1,     1,     1,     1,     0,     5,     1,     3,     3,
+       4,     4,     4,     4,     6,     8,     8,     1,     1,     3,
+       3,     3,     3,     2,     4,     3,     3,     8,     3,     0,
+       1,     3,     2,     1,     1,     0,     2,     0,     2,     0,
+       1,     0,     2,     0,     2,     0,     2,     0,     2,     0,
+       3,     0,     1,     2,     1,     1,     1,     3,     1,     1,
+       2,     4,     1,     3,     2,     1,     5,     0,     2,     0,
+       1,     3,     5,     4,     6,     1,     1,     1,     1,     1,
+       1,     0,     2,     2,     2,     2,     3,     2,     2,     3,
+       3,     4,     4,     3,     3,     4,     4,     5,     6,     7,
+       9,     4,     5,     2,     2,     2,     2,     2,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     3,     1,     3,     3,     5,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     0,    12,    14,     7,
-       9,     4,     6,     4,     6,     1,     1,     1,     1,     1,
-       3,     3,     3,     3,     3,     3,     4,     5,     4,     3,
-       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     6,     3,     4,     3,     3,
-       5,     5,     6,     4,     6,     3,     5,     4,     5,     6,
-       4,     5,     5,     6,     1,     3,     1,     3,     1,     1,
-       1,     1,     1,     2,     2,     2,     2,     2,     1,     1,
-       1,     1,     2,     2,     3,     1,     1,     2,     2,     3,
-       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     1,     3,     2,     2,     1,
-       1,     2,     0,     3,     0,     1,     0,     2,     0,     4,
-       0,     4,     0,     1,     3,     1,     3,     3,     3,     6,
-       7,     3
+       4,     4,     4,     4,     3,     1,     3,     3,     5,     3,
+       1,     1,     1,     1,     1,     1,     3,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,    12,    14,    14,     7,     9,     4,     6,     4,     6,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     4,     5,     4,     3,     2,     2,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       6,     3,     4,     3,     3,     5,     5,     6,     4,     6,
+       3,     5,     4,     5,     6,     4,     5,     5,     6,     1,
+       3,     1,     3,     1,     1,     1,     1,     1,     1,     2,
+       2,     2,     2,     2,     1,     1,     1,     1,     2,     2,
+       3,     1,     1,     2,     2,     3,     2,     2,     3,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     1,     3,     2,     2,     1,     1,     2,     0,     3,
+       0,     1,     0,     2,     0,     4,     0,     4,     0,     1,
+       3,     1,     3,     3,     3,     6,     7,     3
 };
 
 
@@ -2101,7 +2113,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2105 "parser.cpp"
+#line 2117 "parser.cpp"
         break;
 
     case YYSYMBOL_STRING: /* STRING  */
@@ -2109,7 +2121,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2113 "parser.cpp"
+#line 2125 "parser.cpp"
         break;
 
     case YYSYMBOL_statement_list: /* statement_list  */
@@ -2123,7 +2135,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).stmt_array));
     }
 }
-#line 2127 "parser.cpp"
+#line 2139 "parser.cpp"
         break;
 
     case YYSYMBOL_table_element_array: /* table_element_array  */
@@ -2137,7 +2149,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_element_array_t));
     }
 }
-#line 2141 "parser.cpp"
+#line 2153 "parser.cpp"
         break;
 
     case YYSYMBOL_column_constraints: /* column_constraints  */
@@ -2148,7 +2160,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).column_constraints_t));
     }
 }
-#line 2152 "parser.cpp"
+#line 2164 "parser.cpp"
         break;
 
     case YYSYMBOL_default_expr: /* default_expr  */
@@ -2156,7 +2168,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2160 "parser.cpp"
+#line 2172 "parser.cpp"
         break;
 
     case YYSYMBOL_identifier_array: /* identifier_array  */
@@ -2165,7 +2177,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2169 "parser.cpp"
+#line 2181 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_identifier_array: /* optional_identifier_array  */
@@ -2174,7 +2186,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy identifier array\n");
     delete (((*yyvaluep).identifier_array_t));
 }
-#line 2178 "parser.cpp"
+#line 2190 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr_array: /* update_expr_array  */
@@ -2188,7 +2200,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).update_expr_array_t));
     }
 }
-#line 2192 "parser.cpp"
+#line 2204 "parser.cpp"
         break;
 
     case YYSYMBOL_update_expr: /* update_expr  */
@@ -2199,7 +2211,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).update_expr_t);
     }
 }
-#line 2203 "parser.cpp"
+#line 2215 "parser.cpp"
         break;
 
     case YYSYMBOL_select_statement: /* select_statement  */
@@ -2209,7 +2221,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2213 "parser.cpp"
+#line 2225 "parser.cpp"
         break;
 
     case YYSYMBOL_select_with_paren: /* select_with_paren  */
@@ -2219,7 +2231,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2223 "parser.cpp"
+#line 2235 "parser.cpp"
         break;
 
     case YYSYMBOL_select_without_paren: /* select_without_paren  */
@@ -2229,7 +2241,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2233 "parser.cpp"
+#line 2245 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_with_modifier: /* select_clause_with_modifier  */
@@ -2239,7 +2251,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2243 "parser.cpp"
+#line 2255 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier_paren: /* select_clause_without_modifier_paren  */
@@ -2249,7 +2261,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2253 "parser.cpp"
+#line 2265 "parser.cpp"
         break;
 
     case YYSYMBOL_select_clause_without_modifier: /* select_clause_without_modifier  */
@@ -2259,7 +2271,7 @@ yydestruct (const char *yymsg,
         delete ((*yyvaluep).select_stmt);
     }
 }
-#line 2263 "parser.cpp"
+#line 2275 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_clause: /* order_by_clause  */
@@ -2273,7 +2285,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2277 "parser.cpp"
+#line 2289 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr_list: /* order_by_expr_list  */
@@ -2287,7 +2299,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).order_by_expr_list_t));
     }
 }
-#line 2291 "parser.cpp"
+#line 2303 "parser.cpp"
         break;
 
     case YYSYMBOL_order_by_expr: /* order_by_expr  */
@@ -2297,7 +2309,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).order_by_expr_t)->expr_;
     delete ((*yyvaluep).order_by_expr_t);
 }
-#line 2301 "parser.cpp"
+#line 2313 "parser.cpp"
         break;
 
     case YYSYMBOL_limit_expr: /* limit_expr  */
@@ -2305,7 +2317,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2309 "parser.cpp"
+#line 2321 "parser.cpp"
         break;
 
     case YYSYMBOL_offset_expr: /* offset_expr  */
@@ -2313,7 +2325,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2317 "parser.cpp"
+#line 2329 "parser.cpp"
         break;
 
     case YYSYMBOL_from_clause: /* from_clause  */
@@ -2322,7 +2334,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2326 "parser.cpp"
+#line 2338 "parser.cpp"
         break;
 
     case YYSYMBOL_search_clause: /* search_clause  */
@@ -2330,7 +2342,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2334 "parser.cpp"
+#line 2346 "parser.cpp"
         break;
 
     case YYSYMBOL_where_clause: /* where_clause  */
@@ -2338,7 +2350,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2342 "parser.cpp"
+#line 2354 "parser.cpp"
         break;
 
     case YYSYMBOL_having_clause: /* having_clause  */
@@ -2346,7 +2358,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2350 "parser.cpp"
+#line 2362 "parser.cpp"
         break;
 
     case YYSYMBOL_group_by_clause: /* group_by_clause  */
@@ -2360,7 +2372,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2364 "parser.cpp"
+#line 2376 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference: /* table_reference  */
@@ -2369,7 +2381,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2373 "parser.cpp"
+#line 2385 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_unit: /* table_reference_unit  */
@@ -2378,7 +2390,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2382 "parser.cpp"
+#line 2394 "parser.cpp"
         break;
 
     case YYSYMBOL_table_reference_name: /* table_reference_name  */
@@ -2387,7 +2399,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2391 "parser.cpp"
+#line 2403 "parser.cpp"
         break;
 
     case YYSYMBOL_table_name: /* table_name  */
@@ -2400,7 +2412,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).table_name_t));
     }
 }
-#line 2404 "parser.cpp"
+#line 2416 "parser.cpp"
         break;
 
     case YYSYMBOL_table_alias: /* table_alias  */
@@ -2409,7 +2421,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table alias\n");
     delete (((*yyvaluep).table_alias_t));
 }
-#line 2413 "parser.cpp"
+#line 2425 "parser.cpp"
         break;
 
     case YYSYMBOL_with_clause: /* with_clause  */
@@ -2423,7 +2435,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2427 "parser.cpp"
+#line 2439 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr_list: /* with_expr_list  */
@@ -2437,7 +2449,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_expr_list_t));
     }
 }
-#line 2441 "parser.cpp"
+#line 2453 "parser.cpp"
         break;
 
     case YYSYMBOL_with_expr: /* with_expr  */
@@ -2447,7 +2459,7 @@ yydestruct (const char *yymsg,
     delete ((*yyvaluep).with_expr_t)->select_;
     delete ((*yyvaluep).with_expr_t);
 }
-#line 2451 "parser.cpp"
+#line 2463 "parser.cpp"
         break;
 
     case YYSYMBOL_join_clause: /* join_clause  */
@@ -2456,7 +2468,7 @@ yydestruct (const char *yymsg,
     fprintf(stderr, "destroy table reference\n");
     delete (((*yyvaluep).table_reference_t));
 }
-#line 2460 "parser.cpp"
+#line 2472 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array: /* expr_array  */
@@ -2470,7 +2482,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2474 "parser.cpp"
+#line 2486 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_array_list: /* expr_array_list  */
@@ -2487,7 +2499,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_list_t));
     }
 }
-#line 2491 "parser.cpp"
+#line 2503 "parser.cpp"
         break;
 
     case YYSYMBOL_expr_alias: /* expr_alias  */
@@ -2495,7 +2507,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2499 "parser.cpp"
+#line 2511 "parser.cpp"
         break;
 
     case YYSYMBOL_expr: /* expr  */
@@ -2503,7 +2515,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2507 "parser.cpp"
+#line 2519 "parser.cpp"
         break;
 
     case YYSYMBOL_operand: /* operand  */
@@ -2511,7 +2523,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2515 "parser.cpp"
+#line 2527 "parser.cpp"
         break;
 
     case YYSYMBOL_extra_match_tensor_option: /* extra_match_tensor_option  */
@@ -2519,7 +2531,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2523 "parser.cpp"
+#line 2535 "parser.cpp"
         break;
 
     case YYSYMBOL_match_tensor_expr: /* match_tensor_expr  */
@@ -2527,7 +2539,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2531 "parser.cpp"
+#line 2543 "parser.cpp"
         break;
 
     case YYSYMBOL_match_vector_expr: /* match_vector_expr  */
@@ -2535,7 +2547,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2539 "parser.cpp"
+#line 2551 "parser.cpp"
         break;
 
     case YYSYMBOL_match_text_expr: /* match_text_expr  */
@@ -2543,7 +2555,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2547 "parser.cpp"
+#line 2559 "parser.cpp"
         break;
 
     case YYSYMBOL_query_expr: /* query_expr  */
@@ -2551,7 +2563,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2555 "parser.cpp"
+#line 2567 "parser.cpp"
         break;
 
     case YYSYMBOL_fusion_expr: /* fusion_expr  */
@@ -2559,7 +2571,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2563 "parser.cpp"
+#line 2575 "parser.cpp"
         break;
 
     case YYSYMBOL_sub_search_array: /* sub_search_array  */
@@ -2573,7 +2585,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).expr_array_t));
     }
 }
-#line 2577 "parser.cpp"
+#line 2589 "parser.cpp"
         break;
 
     case YYSYMBOL_function_expr: /* function_expr  */
@@ -2581,7 +2593,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2585 "parser.cpp"
+#line 2597 "parser.cpp"
         break;
 
     case YYSYMBOL_conjunction_expr: /* conjunction_expr  */
@@ -2589,7 +2601,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2593 "parser.cpp"
+#line 2605 "parser.cpp"
         break;
 
     case YYSYMBOL_between_expr: /* between_expr  */
@@ -2597,7 +2609,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2601 "parser.cpp"
+#line 2613 "parser.cpp"
         break;
 
     case YYSYMBOL_in_expr: /* in_expr  */
@@ -2605,7 +2617,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2609 "parser.cpp"
+#line 2621 "parser.cpp"
         break;
 
     case YYSYMBOL_case_expr: /* case_expr  */
@@ -2613,7 +2625,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2617 "parser.cpp"
+#line 2629 "parser.cpp"
         break;
 
     case YYSYMBOL_case_check_array: /* case_check_array  */
@@ -2626,7 +2638,7 @@ yydestruct (const char *yymsg,
         }
     }
 }
-#line 2630 "parser.cpp"
+#line 2642 "parser.cpp"
         break;
 
     case YYSYMBOL_cast_expr: /* cast_expr  */
@@ -2634,7 +2646,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2638 "parser.cpp"
+#line 2650 "parser.cpp"
         break;
 
     case YYSYMBOL_subquery_expr: /* subquery_expr  */
@@ -2642,7 +2654,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2646 "parser.cpp"
+#line 2658 "parser.cpp"
         break;
 
     case YYSYMBOL_column_expr: /* column_expr  */
@@ -2650,7 +2662,15 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).expr_t));
 }
-#line 2654 "parser.cpp"
+#line 2666 "parser.cpp"
+        break;
+
+    case YYSYMBOL_parameter_expr: /* parameter_expr  */
+#line 316 "parser.y"
+            {
+    delete (((*yyvaluep).expr_t));
+}
+#line 2674 "parser.cpp"
         break;
 
     case YYSYMBOL_constant_expr: /* constant_expr  */
@@ -2658,7 +2678,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2662 "parser.cpp"
+#line 2682 "parser.cpp"
         break;
 
     case YYSYMBOL_common_array_expr: /* common_array_expr  */
@@ -2666,7 +2686,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2670 "parser.cpp"
+#line 2690 "parser.cpp"
         break;
 
     case YYSYMBOL_subarray_array_expr: /* subarray_array_expr  */
@@ -2674,7 +2694,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2678 "parser.cpp"
+#line 2698 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_subarray_array_expr: /* unclosed_subarray_array_expr  */
@@ -2682,7 +2702,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2686 "parser.cpp"
+#line 2706 "parser.cpp"
         break;
 
     case YYSYMBOL_array_expr: /* array_expr  */
@@ -2690,7 +2710,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2694 "parser.cpp"
+#line 2714 "parser.cpp"
         break;
 
     case YYSYMBOL_long_array_expr: /* long_array_expr  */
@@ -2698,7 +2718,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2702 "parser.cpp"
+#line 2722 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_long_array_expr: /* unclosed_long_array_expr  */
@@ -2706,7 +2726,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2710 "parser.cpp"
+#line 2730 "parser.cpp"
         break;
 
     case YYSYMBOL_double_array_expr: /* double_array_expr  */
@@ -2714,7 +2734,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2718 "parser.cpp"
+#line 2738 "parser.cpp"
         break;
 
     case YYSYMBOL_unclosed_double_array_expr: /* unclosed_double_array_expr  */
@@ -2722,7 +2742,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2726 "parser.cpp"
+#line 2746 "parser.cpp"
         break;
 
     case YYSYMBOL_interval_expr: /* interval_expr  */
@@ -2730,7 +2750,7 @@ yydestruct (const char *yymsg,
             {
     delete (((*yyvaluep).const_expr_t));
 }
-#line 2734 "parser.cpp"
+#line 2754 "parser.cpp"
         break;
 
     case YYSYMBOL_file_path: /* file_path  */
@@ -2738,7 +2758,7 @@ yydestruct (const char *yymsg,
             {
     free(((*yyvaluep).str_value));
 }
-#line 2742 "parser.cpp"
+#line 2762 "parser.cpp"
         break;
 
     case YYSYMBOL_if_not_exists_info: /* if_not_exists_info  */
@@ -2749,7 +2769,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).if_not_exists_info_t));
     }
 }
-#line 2753 "parser.cpp"
+#line 2773 "parser.cpp"
         break;
 
     case YYSYMBOL_with_index_param_list: /* with_index_param_list  */
@@ -2763,7 +2783,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2767 "parser.cpp"
+#line 2787 "parser.cpp"
         break;
 
     case YYSYMBOL_optional_table_properties_list: /* optional_table_properties_list  */
@@ -2777,7 +2797,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).with_index_param_list_t));
     }
 }
-#line 2781 "parser.cpp"
+#line 2801 "parser.cpp"
         break;
 
     case YYSYMBOL_index_info_list: /* index_info_list  */
@@ -2791,7 +2811,7 @@ yydestruct (const char *yymsg,
         delete (((*yyvaluep).index_info_list_t));
     }
 }
-#line 2795 "parser.cpp"
+#line 2815 "parser.cpp"
         break;
 
       default:
@@ -2899,7 +2919,7 @@ YYLTYPE yylloc = yyloc_default;
   yylloc.string_length = 0;
 }
 
-#line 2903 "parser.cpp"
+#line 2923 "parser.cpp"
 
   yylsp[0] = yylloc;
   goto yysetstate;
@@ -3114,7 +3134,7 @@ yyreduce:
                                          {
     result->statements_ptr_ = (yyvsp[-1].stmt_array);
 }
-#line 3118 "parser.cpp"
+#line 3138 "parser.cpp"
     break;
 
   case 3: /* statement_list: statement  */
@@ -3125,7 +3145,7 @@ yyreduce:
     (yyval.stmt_array) = new std::vector<infinity::BaseStatement*>();
     (yyval.stmt_array)->push_back((yyvsp[0].base_stmt));
 }
-#line 3129 "parser.cpp"
+#line 3149 "parser.cpp"
     break;
 
   case 4: /* statement_list: statement_list ';' statement  */
@@ -3136,157 +3156,157 @@ yyreduce:
     (yyvsp[-2].stmt_array)->push_back((yyvsp[0].base_stmt));
     (yyval.stmt_array) = (yyvsp[-2].stmt_array);
 }
-#line 3140 "parser.cpp"
+#line 3160 "parser.cpp"
     break;
 
   case 5: /* statement: create_statement  */
 #line 494 "parser.y"
                              { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3146 "parser.cpp"
+#line 3166 "parser.cpp"
     break;
 
   case 6: /* statement: drop_statement  */
 #line 495 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3152 "parser.cpp"
+#line 3172 "parser.cpp"
     break;
 
   case 7: /* statement: copy_statement  */
 #line 496 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3158 "parser.cpp"
+#line 3178 "parser.cpp"
     break;
 
   case 8: /* statement: show_statement  */
 #line 497 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3164 "parser.cpp"
+#line 3184 "parser.cpp"
     break;
 
   case 9: /* statement: select_statement  */
 #line 498 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3170 "parser.cpp"
+#line 3190 "parser.cpp"
     break;
 
   case 10: /* statement: delete_statement  */
 #line 499 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3176 "parser.cpp"
+#line 3196 "parser.cpp"
     break;
 
   case 11: /* statement: update_statement  */
 #line 500 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3182 "parser.cpp"
+#line 3202 "parser.cpp"
     break;
 
   case 12: /* statement: insert_statement  */
 #line 501 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3188 "parser.cpp"
+#line 3208 "parser.cpp"
     break;
 
   case 13: /* statement: explain_statement  */
 #line 502 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].explain_stmt); }
-#line 3194 "parser.cpp"
+#line 3214 "parser.cpp"
     break;
 
   case 14: /* statement: flush_statement  */
 #line 503 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3200 "parser.cpp"
+#line 3220 "parser.cpp"
     break;
 
   case 15: /* statement: optimize_statement  */
 #line 504 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3206 "parser.cpp"
+#line 3226 "parser.cpp"
     break;
 
   case 16: /* statement: command_statement  */
 #line 505 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3212 "parser.cpp"
+#line 3232 "parser.cpp"
     break;
 
   case 17: /* statement: compact_statement  */
 #line 506 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3218 "parser.cpp"
+#line 3238 "parser.cpp"
     break;
 
   case 18: /* explainable_statement: create_statement  */
 #line 508 "parser.y"
                                          { (yyval.base_stmt) = (yyvsp[0].create_stmt); }
-#line 3224 "parser.cpp"
+#line 3244 "parser.cpp"
     break;
 
   case 19: /* explainable_statement: drop_statement  */
 #line 509 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].drop_stmt); }
-#line 3230 "parser.cpp"
+#line 3250 "parser.cpp"
     break;
 
   case 20: /* explainable_statement: copy_statement  */
 #line 510 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].copy_stmt); }
-#line 3236 "parser.cpp"
+#line 3256 "parser.cpp"
     break;
 
   case 21: /* explainable_statement: show_statement  */
 #line 511 "parser.y"
                  { (yyval.base_stmt) = (yyvsp[0].show_stmt); }
-#line 3242 "parser.cpp"
+#line 3262 "parser.cpp"
     break;
 
   case 22: /* explainable_statement: select_statement  */
 #line 512 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].select_stmt); }
-#line 3248 "parser.cpp"
+#line 3268 "parser.cpp"
     break;
 
   case 23: /* explainable_statement: delete_statement  */
 #line 513 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].delete_stmt); }
-#line 3254 "parser.cpp"
+#line 3274 "parser.cpp"
     break;
 
   case 24: /* explainable_statement: update_statement  */
 #line 514 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].update_stmt); }
-#line 3260 "parser.cpp"
+#line 3280 "parser.cpp"
     break;
 
   case 25: /* explainable_statement: insert_statement  */
 #line 515 "parser.y"
                    { (yyval.base_stmt) = (yyvsp[0].insert_stmt); }
-#line 3266 "parser.cpp"
+#line 3286 "parser.cpp"
     break;
 
   case 26: /* explainable_statement: flush_statement  */
 #line 516 "parser.y"
                   { (yyval.base_stmt) = (yyvsp[0].flush_stmt); }
-#line 3272 "parser.cpp"
+#line 3292 "parser.cpp"
     break;
 
   case 27: /* explainable_statement: optimize_statement  */
 #line 517 "parser.y"
                      { (yyval.base_stmt) = (yyvsp[0].optimize_stmt); }
-#line 3278 "parser.cpp"
+#line 3298 "parser.cpp"
     break;
 
   case 28: /* explainable_statement: command_statement  */
 #line 518 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].command_stmt); }
-#line 3284 "parser.cpp"
+#line 3304 "parser.cpp"
     break;
 
   case 29: /* explainable_statement: compact_statement  */
 #line 519 "parser.y"
                     { (yyval.base_stmt) = (yyvsp[0].compact_stmt); }
-#line 3290 "parser.cpp"
+#line 3310 "parser.cpp"
     break;
 
   case 30: /* create_statement: CREATE DATABASE if_not_exists IDENTIFIER  */
@@ -3306,7 +3326,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_schema_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3310 "parser.cpp"
+#line 3330 "parser.cpp"
     break;
 
   case 31: /* create_statement: CREATE COLLECTION if_not_exists table_name  */
@@ -3324,7 +3344,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 3328 "parser.cpp"
+#line 3348 "parser.cpp"
     break;
 
   case 32: /* create_statement: CREATE TABLE if_not_exists table_name '(' table_element_array ')' optional_table_properties_list  */
@@ -3357,7 +3377,7 @@ yyreduce:
     (yyval.create_stmt)->create_info_ = create_table_info;
     (yyval.create_stmt)->create_info_->conflict_type_ = (yyvsp[-5].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 3361 "parser.cpp"
+#line 3381 "parser.cpp"
     break;
 
   case 33: /* create_statement: CREATE TABLE if_not_exists table_name AS select_statement  */
@@ -3377,7 +3397,7 @@ yyreduce:
     create_table_info->select_ = (yyvsp[0].select_stmt);
     (yyval.create_stmt)->create_info_ = create_table_info;
 }
-#line 3381 "parser.cpp"
+#line 3401 "parser.cpp"
     break;
 
   case 34: /* create_statement: CREATE VIEW if_not_exists table_name optional_identifier_array AS select_statement  */
@@ -3398,7 +3418,7 @@ yyreduce:
     create_view_info->conflict_type_ = (yyvsp[-4].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     (yyval.create_stmt)->create_info_ = create_view_info;
 }
-#line 3402 "parser.cpp"
+#line 3422 "parser.cpp"
     break;
 
   case 35: /* create_statement: CREATE INDEX if_not_exists_info ON table_name index_info_list  */
@@ -3431,7 +3451,7 @@ yyreduce:
     (yyval.create_stmt) = new infinity::CreateStatement();
     (yyval.create_stmt)->create_info_ = create_index_info;
 }
-#line 3435 "parser.cpp"
+#line 3455 "parser.cpp"
     break;
 
   case 36: /* table_element_array: table_element  */
@@ -3440,7 +3460,7 @@ yyreduce:
     (yyval.table_element_array_t) = new std::vector<infinity::TableElement*>();
     (yyval.table_element_array_t)->push_back((yyvsp[0].table_element_t));
 }
-#line 3444 "parser.cpp"
+#line 3464 "parser.cpp"
     break;
 
   case 37: /* table_element_array: table_element_array ',' table_element  */
@@ -3449,7 +3469,7 @@ yyreduce:
     (yyvsp[-2].table_element_array_t)->push_back((yyvsp[0].table_element_t));
     (yyval.table_element_array_t) = (yyvsp[-2].table_element_array_t);
 }
-#line 3453 "parser.cpp"
+#line 3473 "parser.cpp"
     break;
 
   case 38: /* table_element: table_column  */
@@ -3457,7 +3477,7 @@ yyreduce:
                              {
     (yyval.table_element_t) = (yyvsp[0].table_column_t);
 }
-#line 3461 "parser.cpp"
+#line 3481 "parser.cpp"
     break;
 
   case 39: /* table_element: table_constraint  */
@@ -3465,7 +3485,7 @@ yyreduce:
                    {
     (yyval.table_element_t) = (yyvsp[0].table_constraint_t);
 }
-#line 3469 "parser.cpp"
+#line 3489 "parser.cpp"
     break;
 
   case 40: /* table_column: IDENTIFIER column_type default_expr  */
@@ -3509,7 +3529,7 @@ yyreduce:
     }
     */
 }
-#line 3513 "parser.cpp"
+#line 3533 "parser.cpp"
     break;
 
   case 41: /* table_column: IDENTIFIER column_type column_constraints default_expr  */
@@ -3548,356 +3568,398 @@ yyreduce:
     }
     */
 }
-#line 3552 "parser.cpp"
+#line 3572 "parser.cpp"
     break;
 
   case 42: /* column_type: BOOLEAN  */
 #line 745 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3558 "parser.cpp"
+#line 3578 "parser.cpp"
     break;
 
   case 43: /* column_type: TINYINT  */
 #line 746 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTinyInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3564 "parser.cpp"
+#line 3584 "parser.cpp"
     break;
 
   case 44: /* column_type: SMALLINT  */
 #line 747 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kSmallInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3570 "parser.cpp"
+#line 3590 "parser.cpp"
     break;
 
   case 45: /* column_type: INTEGER  */
 #line 748 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3576 "parser.cpp"
+#line 3596 "parser.cpp"
     break;
 
   case 46: /* column_type: INT  */
 #line 749 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kInteger, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3582 "parser.cpp"
+#line 3602 "parser.cpp"
     break;
 
   case 47: /* column_type: BIGINT  */
 #line 750 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBigInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3588 "parser.cpp"
+#line 3608 "parser.cpp"
     break;
 
   case 48: /* column_type: HUGEINT  */
 #line 751 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kHugeInt, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3594 "parser.cpp"
+#line 3614 "parser.cpp"
     break;
 
   case 49: /* column_type: FLOAT  */
 #line 752 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3600 "parser.cpp"
+#line 3620 "parser.cpp"
     break;
 
   case 50: /* column_type: REAL  */
 #line 753 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kFloat, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3606 "parser.cpp"
+#line 3626 "parser.cpp"
     break;
 
   case 51: /* column_type: DOUBLE  */
 #line 754 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDouble, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3612 "parser.cpp"
+#line 3632 "parser.cpp"
     break;
 
   case 52: /* column_type: DATE  */
 #line 755 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDate, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3618 "parser.cpp"
+#line 3638 "parser.cpp"
     break;
 
   case 53: /* column_type: TIME  */
 #line 756 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3624 "parser.cpp"
+#line 3644 "parser.cpp"
     break;
 
   case 54: /* column_type: DATETIME  */
 #line 757 "parser.y"
            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDateTime, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3630 "parser.cpp"
+#line 3650 "parser.cpp"
     break;
 
   case 55: /* column_type: TIMESTAMP  */
 #line 758 "parser.y"
             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTimestamp, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3636 "parser.cpp"
+#line 3656 "parser.cpp"
     break;
 
   case 56: /* column_type: UUID  */
 #line 759 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kUuid, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3642 "parser.cpp"
+#line 3662 "parser.cpp"
     break;
 
   case 57: /* column_type: POINT  */
 #line 760 "parser.y"
         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kPoint, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3648 "parser.cpp"
+#line 3668 "parser.cpp"
     break;
 
   case 58: /* column_type: LINE  */
 #line 761 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLine, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3654 "parser.cpp"
+#line 3674 "parser.cpp"
     break;
 
   case 59: /* column_type: LSEG  */
 #line 762 "parser.y"
        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kLineSeg, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3660 "parser.cpp"
+#line 3680 "parser.cpp"
     break;
 
   case 60: /* column_type: BOX  */
 #line 763 "parser.y"
       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kBox, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3666 "parser.cpp"
+#line 3686 "parser.cpp"
     break;
 
   case 61: /* column_type: CIRCLE  */
 #line 766 "parser.y"
          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kCircle, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3672 "parser.cpp"
+#line 3692 "parser.cpp"
     break;
 
   case 62: /* column_type: VARCHAR  */
 #line 768 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kVarchar, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3678 "parser.cpp"
+#line 3698 "parser.cpp"
     break;
 
   case 63: /* column_type: DECIMAL '(' LONG_VALUE ',' LONG_VALUE ')'  */
 #line 769 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-3].long_value), (yyvsp[-1].long_value), infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3684 "parser.cpp"
+#line 3704 "parser.cpp"
     break;
 
   case 64: /* column_type: DECIMAL '(' LONG_VALUE ')'  */
 #line 770 "parser.y"
                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, (yyvsp[-1].long_value), 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3690 "parser.cpp"
+#line 3710 "parser.cpp"
     break;
 
   case 65: /* column_type: DECIMAL  */
 #line 771 "parser.y"
           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kDecimal, 0, 0, 0, infinity::EmbeddingDataType::kElemInvalid}; }
-#line 3696 "parser.cpp"
+#line 3716 "parser.cpp"
     break;
 
   case 66: /* column_type: EMBEDDING '(' BIT ',' LONG_VALUE ')'  */
 #line 774 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3702 "parser.cpp"
+#line 3722 "parser.cpp"
     break;
 
   case 67: /* column_type: EMBEDDING '(' TINYINT ',' LONG_VALUE ')'  */
 #line 775 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3708 "parser.cpp"
+#line 3728 "parser.cpp"
     break;
 
   case 68: /* column_type: EMBEDDING '(' SMALLINT ',' LONG_VALUE ')'  */
 #line 776 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3714 "parser.cpp"
+#line 3734 "parser.cpp"
     break;
 
   case 69: /* column_type: EMBEDDING '(' INTEGER ',' LONG_VALUE ')'  */
 #line 777 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3720 "parser.cpp"
+#line 3740 "parser.cpp"
     break;
 
   case 70: /* column_type: EMBEDDING '(' INT ',' LONG_VALUE ')'  */
 #line 778 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3726 "parser.cpp"
+#line 3746 "parser.cpp"
     break;
 
   case 71: /* column_type: EMBEDDING '(' BIGINT ',' LONG_VALUE ')'  */
 #line 779 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3732 "parser.cpp"
+#line 3752 "parser.cpp"
     break;
 
   case 72: /* column_type: EMBEDDING '(' FLOAT ',' LONG_VALUE ')'  */
 #line 780 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3738 "parser.cpp"
+#line 3758 "parser.cpp"
     break;
 
   case 73: /* column_type: EMBEDDING '(' DOUBLE ',' LONG_VALUE ')'  */
 #line 781 "parser.y"
                                           { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3744 "parser.cpp"
+#line 3764 "parser.cpp"
     break;
 
-  case 74: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
+  case 74: /* column_type: EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')'  */
 #line 782 "parser.y"
+                                              {
+    // element types that have no keyword of their own
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType embedding_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "uint8") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemUInt8;
+    } else if (strcmp((yyvsp[-3].str_value), "float16") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (embedding_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, embedding_type};
+}
+#line 3785 "parser.cpp"
+    break;
+
+  case 75: /* column_type: TENSOR '(' BIT ',' LONG_VALUE ')'  */
+#line 798 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3750 "parser.cpp"
+#line 3791 "parser.cpp"
     break;
 
-  case 75: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 783 "parser.y"
+  case 76: /* column_type: TENSOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 799 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3756 "parser.cpp"
+#line 3797 "parser.cpp"
     break;
 
-  case 76: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 784 "parser.y"
+  case 77: /* column_type: TENSOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 800 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3762 "parser.cpp"
+#line 3803 "parser.cpp"
     break;
 
-  case 77: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 785 "parser.y"
+  case 78: /* column_type: TENSOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 801 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3768 "parser.cpp"
+#line 3809 "parser.cpp"
     break;
 
-  case 78: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
-#line 786 "parser.y"
+  case 79: /* column_type: TENSOR '(' INT ',' LONG_VALUE ')'  */
+#line 802 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3774 "parser.cpp"
+#line 3815 "parser.cpp"
     break;
 
-  case 79: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 787 "parser.y"
+  case 80: /* column_type: TENSOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 803 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3780 "parser.cpp"
+#line 3821 "parser.cpp"
     break;
 
-  case 80: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 788 "parser.y"
+  case 81: /* column_type: TENSOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 804 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3786 "parser.cpp"
+#line 3827 "parser.cpp"
     break;
 
-  case 81: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 789 "parser.y"
+  case 82: /* column_type: TENSOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 805 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensor, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3792 "parser.cpp"
+#line 3833 "parser.cpp"
     break;
 
-  case 82: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
-#line 790 "parser.y"
+  case 83: /* column_type: TENSORARRAY '(' BIT ',' LONG_VALUE ')'  */
+#line 806 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3798 "parser.cpp"
+#line 3839 "parser.cpp"
     break;
 
-  case 83: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
-#line 791 "parser.y"
+  case 84: /* column_type: TENSORARRAY '(' TINYINT ',' LONG_VALUE ')'  */
+#line 807 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3804 "parser.cpp"
+#line 3845 "parser.cpp"
     break;
 
-  case 84: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 792 "parser.y"
+  case 85: /* column_type: TENSORARRAY '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 808 "parser.y"
                                               { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3810 "parser.cpp"
+#line 3851 "parser.cpp"
     break;
 
-  case 85: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
-#line 793 "parser.y"
+  case 86: /* column_type: TENSORARRAY '(' INTEGER ',' LONG_VALUE ')'  */
+#line 809 "parser.y"
                                              { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3816 "parser.cpp"
+#line 3857 "parser.cpp"
     break;
 
-  case 86: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
-#line 794 "parser.y"
+  case 87: /* column_type: TENSORARRAY '(' INT ',' LONG_VALUE ')'  */
+#line 810 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3822 "parser.cpp"
+#line 3863 "parser.cpp"
     break;
 
-  case 87: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
-#line 795 "parser.y"
+  case 88: /* column_type: TENSORARRAY '(' BIGINT ',' LONG_VALUE ')'  */
+#line 811 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3828 "parser.cpp"
+#line 3869 "parser.cpp"
     break;
 
-  case 88: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
-#line 796 "parser.y"
+  case 89: /* column_type: TENSORARRAY '(' FLOAT ',' LONG_VALUE ')'  */
+#line 812 "parser.y"
                                            { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3834 "parser.cpp"
+#line 3875 "parser.cpp"
     break;
 
-  case 89: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 797 "parser.y"
+  case 90: /* column_type: TENSORARRAY '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 813 "parser.y"
                                             { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kTensorArray, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3840 "parser.cpp"
+#line 3881 "parser.cpp"
     break;
 
-  case 90: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
-#line 798 "parser.y"
+  case 91: /* column_type: VECTOR '(' BIT ',' LONG_VALUE ')'  */
+#line 814 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemBit}; }
-#line 3846 "parser.cpp"
+#line 3887 "parser.cpp"
     break;
 
-  case 91: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
-#line 799 "parser.y"
+  case 92: /* column_type: VECTOR '(' TINYINT ',' LONG_VALUE ')'  */
+#line 815 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt8}; }
-#line 3852 "parser.cpp"
+#line 3893 "parser.cpp"
     break;
 
-  case 92: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
-#line 800 "parser.y"
+  case 93: /* column_type: VECTOR '(' SMALLINT ',' LONG_VALUE ')'  */
+#line 816 "parser.y"
                                          { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt16}; }
-#line 3858 "parser.cpp"
+#line 3899 "parser.cpp"
     break;
 
-  case 93: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
-#line 801 "parser.y"
+  case 94: /* column_type: VECTOR '(' INTEGER ',' LONG_VALUE ')'  */
+#line 817 "parser.y"
                                         { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3864 "parser.cpp"
+#line 3905 "parser.cpp"
     break;
 
-  case 94: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
-#line 802 "parser.y"
+  case 95: /* column_type: VECTOR '(' INT ',' LONG_VALUE ')'  */
+#line 818 "parser.y"
                                     { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt32}; }
-#line 3870 "parser.cpp"
+#line 3911 "parser.cpp"
     break;
 
-  case 95: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
-#line 803 "parser.y"
+  case 96: /* column_type: VECTOR '(' BIGINT ',' LONG_VALUE ')'  */
+#line 819 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemInt64}; }
-#line 3876 "parser.cpp"
+#line 3917 "parser.cpp"
     break;
 
-  case 96: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
-#line 804 "parser.y"
+  case 97: /* column_type: VECTOR '(' FLOAT ',' LONG_VALUE ')'  */
+#line 820 "parser.y"
                                       { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemFloat}; }
-#line 3882 "parser.cpp"
+#line 3923 "parser.cpp"
     break;
 
-  case 97: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
-#line 805 "parser.y"
+  case 98: /* column_type: VECTOR '(' DOUBLE ',' LONG_VALUE ')'  */
+#line 821 "parser.y"
                                        { (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, infinity::kElemDouble}; }
-#line 3888 "parser.cpp"
+#line 3929 "parser.cpp"
     break;
 
-  case 98: /* column_constraints: column_constraint  */
-#line 824 "parser.y"
+  case 99: /* column_type: VECTOR '(' IDENTIFIER ',' LONG_VALUE ')'  */
+#line 822 "parser.y"
+                                           {
+    // element types that have no keyword of their own
+    ParserHelper::ToLower((yyvsp[-3].str_value));
+    infinity::EmbeddingDataType embedding_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp((yyvsp[-3].str_value), "uint8") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemUInt8;
+    } else if (strcmp((yyvsp[-3].str_value), "float16") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemFloat16;
+    }
+    free((yyvsp[-3].str_value));
+    if (embedding_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    (yyval.column_type_t) = infinity::ColumnType{infinity::LogicalType::kEmbedding, (yyvsp[-1].long_value), 0, 0, embedding_type};
+}
+#line 3950 "parser.cpp"
+    break;
+
+  case 100: /* column_constraints: column_constraint  */
+#line 856 "parser.y"
                                        {
     (yyval.column_constraints_t) = new std::set<infinity::ConstraintType>();
     (yyval.column_constraints_t)->insert((yyvsp[0].column_constraint_t));
 }
-#line 3897 "parser.cpp"
+#line 3959 "parser.cpp"
     break;
 
-  case 99: /* column_constraints: column_constraints column_constraint  */
-#line 828 "parser.y"
+  case 101: /* column_constraints: column_constraints column_constraint  */
+#line 860 "parser.y"
                                        {
     if((yyvsp[-1].column_constraints_t)->contains((yyvsp[0].column_constraint_t))) {
         yyerror(&yyloc, scanner, result, "Duplicate column constraint.");
@@ -3907,101 +3969,101 @@ yyreduce:
     (yyvsp[-1].column_constraints_t)->insert((yyvsp[0].column_constraint_t));
     (yyval.column_constraints_t) = (yyvsp[-1].column_constraints_t);
 }
-#line 3911 "parser.cpp"
+#line 3973 "parser.cpp"
     break;
 
-  case 100: /* column_constraint: PRIMARY KEY  */
-#line 838 "parser.y"
+  case 102: /* column_constraint: PRIMARY KEY  */
+#line 870 "parser.y"
                                 {
     (yyval.column_constraint_t) = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3919 "parser.cpp"
+#line 3981 "parser.cpp"
     break;
 
-  case 101: /* column_constraint: UNIQUE  */
-#line 841 "parser.y"
+  case 103: /* column_constraint: UNIQUE  */
+#line 873 "parser.y"
          {
     (yyval.column_constraint_t) = infinity::ConstraintType::kUnique;
 }
-#line 3927 "parser.cpp"
+#line 3989 "parser.cpp"
     break;
 
-  case 102: /* column_constraint: NULLABLE  */
-#line 844 "parser.y"
+  case 104: /* column_constraint: NULLABLE  */
+#line 876 "parser.y"
            {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNull;
 }
-#line 3935 "parser.cpp"
+#line 3997 "parser.cpp"
     break;
 
-  case 103: /* column_constraint: NOT NULLABLE  */
-#line 847 "parser.y"
+  case 105: /* column_constraint: NOT NULLABLE  */
+#line 879 "parser.y"
                {
     (yyval.column_constraint_t) = infinity::ConstraintType::kNotNull;
 }
-#line 3943 "parser.cpp"
+#line 4005 "parser.cpp"
     break;
 
-  case 104: /* default_expr: DEFAULT constant_expr  */
-#line 851 "parser.y"
+  case 106: /* default_expr: DEFAULT constant_expr  */
+#line 883 "parser.y"
                                      {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 3951 "parser.cpp"
+#line 4013 "parser.cpp"
     break;
 
-  case 105: /* default_expr: %empty  */
-#line 854 "parser.y"
+  case 107: /* default_expr: %empty  */
+#line 886 "parser.y"
                             {
     (yyval.const_expr_t) = nullptr;
 }
-#line 3959 "parser.cpp"
+#line 4021 "parser.cpp"
     break;
 
-  case 106: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
-#line 859 "parser.y"
+  case 108: /* table_constraint: PRIMARY KEY '(' identifier_array ')'  */
+#line 891 "parser.y"
                                                         {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kPrimaryKey;
 }
-#line 3969 "parser.cpp"
+#line 4031 "parser.cpp"
     break;
 
-  case 107: /* table_constraint: UNIQUE '(' identifier_array ')'  */
-#line 864 "parser.y"
+  case 109: /* table_constraint: UNIQUE '(' identifier_array ')'  */
+#line 896 "parser.y"
                                   {
     (yyval.table_constraint_t) = new infinity::TableConstraint();
     (yyval.table_constraint_t)->names_ptr_ = (yyvsp[-1].identifier_array_t);
     (yyval.table_constraint_t)->constraint_ = infinity::ConstraintType::kUnique;
 }
-#line 3979 "parser.cpp"
+#line 4041 "parser.cpp"
     break;
 
-  case 108: /* identifier_array: IDENTIFIER  */
-#line 871 "parser.y"
+  case 110: /* identifier_array: IDENTIFIER  */
+#line 903 "parser.y"
                               {
     (yyval.identifier_array_t) = new std::vector<std::string>();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 3990 "parser.cpp"
+#line 4052 "parser.cpp"
     break;
 
-  case 109: /* identifier_array: identifier_array ',' IDENTIFIER  */
-#line 877 "parser.y"
+  case 111: /* identifier_array: identifier_array ',' IDENTIFIER  */
+#line 909 "parser.y"
                                   {
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyvsp[-2].identifier_array_t)->emplace_back((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
     (yyval.identifier_array_t) = (yyvsp[-2].identifier_array_t);
 }
-#line 4001 "parser.cpp"
+#line 4063 "parser.cpp"
     break;
 
-  case 110: /* delete_statement: DELETE FROM table_name where_clause  */
-#line 887 "parser.y"
+  case 112: /* delete_statement: DELETE FROM table_name where_clause  */
+#line 919 "parser.y"
                                                        {
     (yyval.delete_stmt) = new infinity::DeleteStatement();
 
@@ -4014,11 +4076,11 @@ yyreduce:
     delete (yyvsp[-1].table_name_t);
     (yyval.delete_stmt)->where_expr_ = (yyvsp[0].expr_t);
 }
-#line 4018 "parser.cpp"
+#line 4080 "parser.cpp"
     break;
 
-  case 111: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
-#line 903 "parser.y"
+  case 113: /* insert_statement: INSERT INTO table_name optional_identifier_array VALUES expr_array_list  */
+#line 935 "parser.y"
                                                                                           {
     bool is_error{false};
     for (auto expr_array : *(yyvsp[0].expr_array_list_t)) {
@@ -4053,11 +4115,11 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-2].identifier_array_t);
     (yyval.insert_stmt)->values_ = (yyvsp[0].expr_array_list_t);
 }
-#line 4057 "parser.cpp"
+#line 4119 "parser.cpp"
     break;
 
-  case 112: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
-#line 937 "parser.y"
+  case 114: /* insert_statement: INSERT INTO table_name optional_identifier_array select_without_paren  */
+#line 969 "parser.y"
                                                                         {
     (yyval.insert_stmt) = new infinity::InsertStatement();
     if((yyvsp[-2].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4070,101 +4132,101 @@ yyreduce:
     (yyval.insert_stmt)->columns_ = (yyvsp[-1].identifier_array_t);
     (yyval.insert_stmt)->select_ = (yyvsp[0].select_stmt);
 }
-#line 4074 "parser.cpp"
+#line 4136 "parser.cpp"
     break;
 
-  case 113: /* optional_identifier_array: '(' identifier_array ')'  */
-#line 950 "parser.y"
+  case 115: /* optional_identifier_array: '(' identifier_array ')'  */
+#line 982 "parser.y"
                                                     {
     (yyval.identifier_array_t) = (yyvsp[-1].identifier_array_t);
 }
-#line 4082 "parser.cpp"
+#line 4144 "parser.cpp"
     break;
 
-  case 114: /* optional_identifier_array: %empty  */
-#line 953 "parser.y"
+  case 116: /* optional_identifier_array: %empty  */
+#line 985 "parser.y"
   {
     (yyval.identifier_array_t) = nullptr;
 }
-#line 4090 "parser.cpp"
+#line 4152 "parser.cpp"
     break;
 
-  case 115: /* explain_statement: EXPLAIN explain_type explainable_statement  */
-#line 960 "parser.y"
+  case 117: /* explain_statement: EXPLAIN explain_type explainable_statement  */
+#line 992 "parser.y"
                                                                {
     (yyval.explain_stmt) = new infinity::ExplainStatement();
     (yyval.explain_stmt)->type_ = (yyvsp[-1].explain_type_t);
     (yyval.explain_stmt)->statement_ = (yyvsp[0].base_stmt);
 }
-#line 4100 "parser.cpp"
+#line 4162 "parser.cpp"
     break;
 
-  case 116: /* explain_type: ANALYZE  */
-#line 966 "parser.y"
+  case 118: /* explain_type: ANALYZE  */
+#line 998 "parser.y"
                       {
     (yyval.explain_type_t) = infinity::ExplainType::kAnalyze;
 }
-#line 4108 "parser.cpp"
+#line 4170 "parser.cpp"
     break;
 
-  case 117: /* explain_type: AST  */
-#line 969 "parser.y"
+  case 119: /* explain_type: AST  */
+#line 1001 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kAst;
 }
-#line 4116 "parser.cpp"
+#line 4178 "parser.cpp"
     break;
 
-  case 118: /* explain_type: RAW  */
-#line 972 "parser.y"
+  case 120: /* explain_type: RAW  */
+#line 1004 "parser.y"
       {
     (yyval.explain_type_t) = infinity::ExplainType::kUnOpt;
 }
-#line 4124 "parser.cpp"
+#line 4186 "parser.cpp"
     break;
 
-  case 119: /* explain_type: LOGICAL  */
-#line 975 "parser.y"
+  case 121: /* explain_type: LOGICAL  */
+#line 1007 "parser.y"
           {
     (yyval.explain_type_t) = infinity::ExplainType::kOpt;
 }
-#line 4132 "parser.cpp"
+#line 4194 "parser.cpp"
     break;
 
-  case 120: /* explain_type: PHYSICAL  */
-#line 978 "parser.y"
+  case 122: /* explain_type: PHYSICAL  */
+#line 1010 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4140 "parser.cpp"
+#line 4202 "parser.cpp"
     break;
 
-  case 121: /* explain_type: PIPELINE  */
-#line 981 "parser.y"
+  case 123: /* explain_type: PIPELINE  */
+#line 1013 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kPipeline;
 }
-#line 4148 "parser.cpp"
+#line 4210 "parser.cpp"
     break;
 
-  case 122: /* explain_type: FRAGMENT  */
-#line 984 "parser.y"
+  case 124: /* explain_type: FRAGMENT  */
+#line 1016 "parser.y"
            {
     (yyval.explain_type_t) = infinity::ExplainType::kFragment;
 }
-#line 4156 "parser.cpp"
+#line 4218 "parser.cpp"
     break;
 
-  case 123: /* explain_type: %empty  */
-#line 987 "parser.y"
+  case 125: /* explain_type: %empty  */
+#line 1019 "parser.y"
   {
     (yyval.explain_type_t) = infinity::ExplainType::kPhysical;
 }
-#line 4164 "parser.cpp"
+#line 4226 "parser.cpp"
     break;
 
-  case 124: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
-#line 994 "parser.y"
+  case 126: /* update_statement: UPDATE table_name SET update_expr_array where_clause  */
+#line 1026 "parser.y"
                                                                        {
     (yyval.update_stmt) = new infinity::UpdateStatement();
     if((yyvsp[-3].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4177,29 +4239,29 @@ yyreduce:
     (yyval.update_stmt)->where_expr_ = (yyvsp[0].expr_t);
     (yyval.update_stmt)->update_expr_array_ = (yyvsp[-1].update_expr_array_t);
 }
-#line 4181 "parser.cpp"
+#line 4243 "parser.cpp"
     break;
 
-  case 125: /* update_expr_array: update_expr  */
-#line 1007 "parser.y"
+  case 127: /* update_expr_array: update_expr  */
+#line 1039 "parser.y"
                                {
     (yyval.update_expr_array_t) = new std::vector<infinity::UpdateExpr*>();
     (yyval.update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
 }
-#line 4190 "parser.cpp"
+#line 4252 "parser.cpp"
     break;
 
-  case 126: /* update_expr_array: update_expr_array ',' update_expr  */
-#line 1011 "parser.y"
+  case 128: /* update_expr_array: update_expr_array ',' update_expr  */
+#line 1043 "parser.y"
                                     {
     (yyvsp[-2].update_expr_array_t)->emplace_back((yyvsp[0].update_expr_t));
     (yyval.update_expr_array_t) = (yyvsp[-2].update_expr_array_t);
 }
-#line 4199 "parser.cpp"
+#line 4261 "parser.cpp"
     break;
 
-  case 127: /* update_expr: IDENTIFIER '=' expr  */
-#line 1016 "parser.y"
+  case 129: /* update_expr: IDENTIFIER '=' expr  */
+#line 1048 "parser.y"
                                   {
     (yyval.update_expr_t) = new infinity::UpdateExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4207,11 +4269,11 @@ yyreduce:
     free((yyvsp[-2].str_value));
     (yyval.update_expr_t)->value = (yyvsp[0].expr_t);
 }
-#line 4211 "parser.cpp"
+#line 4273 "parser.cpp"
     break;
 
-  case 128: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
-#line 1029 "parser.y"
+  case 130: /* drop_statement: DROP DATABASE if_exists IDENTIFIER  */
+#line 1061 "parser.y"
                                                    {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropSchemaInfo> drop_schema_info = std::make_shared<infinity::DropSchemaInfo>();
@@ -4223,11 +4285,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_ = drop_schema_info;
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
 }
-#line 4227 "parser.cpp"
+#line 4289 "parser.cpp"
     break;
 
-  case 129: /* drop_statement: DROP COLLECTION if_exists table_name  */
-#line 1042 "parser.y"
+  case 131: /* drop_statement: DROP COLLECTION if_exists table_name  */
+#line 1074 "parser.y"
                                        {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropCollectionInfo> drop_collection_info = std::make_unique<infinity::DropCollectionInfo>();
@@ -4241,11 +4303,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4245 "parser.cpp"
+#line 4307 "parser.cpp"
     break;
 
-  case 130: /* drop_statement: DROP TABLE if_exists table_name  */
-#line 1057 "parser.y"
+  case 132: /* drop_statement: DROP TABLE if_exists table_name  */
+#line 1089 "parser.y"
                                   {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropTableInfo> drop_table_info = std::make_unique<infinity::DropTableInfo>();
@@ -4259,11 +4321,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4263 "parser.cpp"
+#line 4325 "parser.cpp"
     break;
 
-  case 131: /* drop_statement: DROP VIEW if_exists table_name  */
-#line 1072 "parser.y"
+  case 133: /* drop_statement: DROP VIEW if_exists table_name  */
+#line 1104 "parser.y"
                                  {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropViewInfo> drop_view_info = std::make_unique<infinity::DropViewInfo>();
@@ -4277,11 +4339,11 @@ yyreduce:
     (yyval.drop_stmt)->drop_info_->conflict_type_ = (yyvsp[-1].bool_value) ? infinity::ConflictType::kIgnore : infinity::ConflictType::kError;
     delete (yyvsp[0].table_name_t);
 }
-#line 4281 "parser.cpp"
+#line 4343 "parser.cpp"
     break;
 
-  case 132: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
-#line 1087 "parser.y"
+  case 134: /* drop_statement: DROP INDEX if_exists IDENTIFIER ON table_name  */
+#line 1119 "parser.y"
                                                 {
     (yyval.drop_stmt) = new infinity::DropStatement();
     std::shared_ptr<infinity::DropIndexInfo> drop_index_info = std::make_shared<infinity::DropIndexInfo>();
@@ -4300,11 +4362,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 4304 "parser.cpp"
+#line 4366 "parser.cpp"
     break;
 
-  case 133: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
-#line 1110 "parser.y"
+  case 135: /* copy_statement: COPY table_name TO file_path WITH '(' copy_option_list ')'  */
+#line 1142 "parser.y"
                                                                            {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4346,11 +4408,11 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4350 "parser.cpp"
+#line 4412 "parser.cpp"
     break;
 
-  case 134: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
-#line 1151 "parser.y"
+  case 136: /* copy_statement: COPY table_name FROM file_path WITH '(' copy_option_list ')'  */
+#line 1183 "parser.y"
                                                                {
     (yyval.copy_stmt) = new infinity::CopyStatement();
 
@@ -4392,27 +4454,27 @@ yyreduce:
     }
     delete (yyvsp[-1].copy_option_array);
 }
-#line 4396 "parser.cpp"
+#line 4458 "parser.cpp"
     break;
 
-  case 135: /* select_statement: select_without_paren  */
-#line 1196 "parser.y"
+  case 137: /* select_statement: select_without_paren  */
+#line 1228 "parser.y"
                                         {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4404 "parser.cpp"
+#line 4466 "parser.cpp"
     break;
 
-  case 136: /* select_statement: select_with_paren  */
-#line 1199 "parser.y"
+  case 138: /* select_statement: select_with_paren  */
+#line 1231 "parser.y"
                     {
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4412 "parser.cpp"
+#line 4474 "parser.cpp"
     break;
 
-  case 137: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
-#line 1202 "parser.y"
+  case 139: /* select_statement: select_statement set_operator select_clause_without_modifier_paren  */
+#line 1234 "parser.y"
                                                                      {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4422,11 +4484,11 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4426 "parser.cpp"
+#line 4488 "parser.cpp"
     break;
 
-  case 138: /* select_statement: select_statement set_operator select_clause_without_modifier  */
-#line 1211 "parser.y"
+  case 140: /* select_statement: select_statement set_operator select_clause_without_modifier  */
+#line 1243 "parser.y"
                                                                {
     infinity::SelectStatement* node = (yyvsp[-2].select_stmt);
     while(node->nested_select_ != nullptr) {
@@ -4436,36 +4498,36 @@ yyreduce:
     node->nested_select_ = (yyvsp[0].select_stmt);
     (yyval.select_stmt) = (yyvsp[-2].select_stmt);
 }
-#line 4440 "parser.cpp"
+#line 4502 "parser.cpp"
     break;
 
-  case 139: /* select_with_paren: '(' select_without_paren ')'  */
-#line 1221 "parser.y"
+  case 141: /* select_with_paren: '(' select_without_paren ')'  */
+#line 1253 "parser.y"
                                                  {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4448 "parser.cpp"
+#line 4510 "parser.cpp"
     break;
 
-  case 140: /* select_with_paren: '(' select_with_paren ')'  */
-#line 1224 "parser.y"
+  case 142: /* select_with_paren: '(' select_with_paren ')'  */
+#line 1256 "parser.y"
                             {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4456 "parser.cpp"
+#line 4518 "parser.cpp"
     break;
 
-  case 141: /* select_without_paren: with_clause select_clause_with_modifier  */
-#line 1228 "parser.y"
+  case 143: /* select_without_paren: with_clause select_clause_with_modifier  */
+#line 1260 "parser.y"
                                                               {
     (yyvsp[0].select_stmt)->with_exprs_ = (yyvsp[-1].with_expr_list_t);
     (yyval.select_stmt) = (yyvsp[0].select_stmt);
 }
-#line 4465 "parser.cpp"
+#line 4527 "parser.cpp"
     break;
 
-  case 142: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
-#line 1233 "parser.y"
+  case 144: /* select_clause_with_modifier: select_clause_without_modifier order_by_clause limit_expr offset_expr  */
+#line 1265 "parser.y"
                                                                                                    {
     if((yyvsp[-1].expr_t) == nullptr and (yyvsp[0].expr_t) != nullptr) {
         delete (yyvsp[-3].select_stmt);
@@ -4487,27 +4549,27 @@ yyreduce:
     (yyvsp[-3].select_stmt)->offset_expr_ = (yyvsp[0].expr_t);
     (yyval.select_stmt) = (yyvsp[-3].select_stmt);
 }
-#line 4491 "parser.cpp"
+#line 4553 "parser.cpp"
     break;
 
-  case 143: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
-#line 1255 "parser.y"
+  case 145: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier ')'  */
+#line 1287 "parser.y"
                                                                              {
   (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4499 "parser.cpp"
+#line 4561 "parser.cpp"
     break;
 
-  case 144: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
-#line 1258 "parser.y"
+  case 146: /* select_clause_without_modifier_paren: '(' select_clause_without_modifier_paren ')'  */
+#line 1290 "parser.y"
                                                {
     (yyval.select_stmt) = (yyvsp[-1].select_stmt);
 }
-#line 4507 "parser.cpp"
+#line 4569 "parser.cpp"
     break;
 
-  case 145: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
-#line 1263 "parser.y"
+  case 147: /* select_clause_without_modifier: SELECT distinct expr_array from_clause search_clause where_clause group_by_clause having_clause  */
+#line 1295 "parser.y"
                                                                                                 {
     (yyval.select_stmt) = new infinity::SelectStatement();
     (yyval.select_stmt)->select_list_ = (yyvsp[-5].expr_array_t);
@@ -4523,245 +4585,245 @@ yyreduce:
         YYERROR;
     }
 }
-#line 4527 "parser.cpp"
+#line 4589 "parser.cpp"
     break;
 
-  case 146: /* order_by_clause: ORDER BY order_by_expr_list  */
-#line 1279 "parser.y"
+  case 148: /* order_by_clause: ORDER BY order_by_expr_list  */
+#line 1311 "parser.y"
                                               {
     (yyval.order_by_expr_list_t) = (yyvsp[0].order_by_expr_list_t);
 }
-#line 4535 "parser.cpp"
+#line 4597 "parser.cpp"
     break;
 
-  case 147: /* order_by_clause: %empty  */
-#line 1282 "parser.y"
+  case 149: /* order_by_clause: %empty  */
+#line 1314 "parser.y"
                        {
     (yyval.order_by_expr_list_t) = nullptr;
 }
-#line 4543 "parser.cpp"
+#line 4605 "parser.cpp"
     break;
 
-  case 148: /* order_by_expr_list: order_by_expr  */
-#line 1286 "parser.y"
+  case 150: /* order_by_expr_list: order_by_expr  */
+#line 1318 "parser.y"
                                   {
     (yyval.order_by_expr_list_t) = new std::vector<infinity::OrderByExpr*>();
     (yyval.order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
 }
-#line 4552 "parser.cpp"
+#line 4614 "parser.cpp"
     break;
 
-  case 149: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
-#line 1290 "parser.y"
+  case 151: /* order_by_expr_list: order_by_expr_list ',' order_by_expr  */
+#line 1322 "parser.y"
                                        {
     (yyvsp[-2].order_by_expr_list_t)->emplace_back((yyvsp[0].order_by_expr_t));
     (yyval.order_by_expr_list_t) = (yyvsp[-2].order_by_expr_list_t);
 }
-#line 4561 "parser.cpp"
+#line 4623 "parser.cpp"
     break;
 
-  case 150: /* order_by_expr: expr order_by_type  */
-#line 1295 "parser.y"
+  case 152: /* order_by_expr: expr order_by_type  */
+#line 1327 "parser.y"
                                    {
     (yyval.order_by_expr_t) = new infinity::OrderByExpr();
     (yyval.order_by_expr_t)->expr_ = (yyvsp[-1].expr_t);
     (yyval.order_by_expr_t)->type_ = (yyvsp[0].order_by_type_t);
 }
-#line 4571 "parser.cpp"
+#line 4633 "parser.cpp"
     break;
 
-  case 151: /* order_by_type: ASC  */
-#line 1301 "parser.y"
+  case 153: /* order_by_type: ASC  */
+#line 1333 "parser.y"
                    {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4579 "parser.cpp"
+#line 4641 "parser.cpp"
     break;
 
-  case 152: /* order_by_type: DESC  */
-#line 1304 "parser.y"
+  case 154: /* order_by_type: DESC  */
+#line 1336 "parser.y"
        {
     (yyval.order_by_type_t) = infinity::kDesc;
 }
-#line 4587 "parser.cpp"
+#line 4649 "parser.cpp"
     break;
 
-  case 153: /* order_by_type: %empty  */
-#line 1307 "parser.y"
+  case 155: /* order_by_type: %empty  */
+#line 1339 "parser.y"
   {
     (yyval.order_by_type_t) = infinity::kAsc;
 }
-#line 4595 "parser.cpp"
+#line 4657 "parser.cpp"
     break;
 
-  case 154: /* limit_expr: LIMIT expr  */
-#line 1311 "parser.y"
+  case 156: /* limit_expr: LIMIT expr  */
+#line 1343 "parser.y"
                        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4603 "parser.cpp"
+#line 4665 "parser.cpp"
     break;
 
-  case 155: /* limit_expr: %empty  */
-#line 1315 "parser.y"
+  case 157: /* limit_expr: %empty  */
+#line 1347 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4609 "parser.cpp"
+#line 4671 "parser.cpp"
     break;
 
-  case 156: /* offset_expr: OFFSET expr  */
-#line 1317 "parser.y"
+  case 158: /* offset_expr: OFFSET expr  */
+#line 1349 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4617 "parser.cpp"
+#line 4679 "parser.cpp"
     break;
 
-  case 157: /* offset_expr: %empty  */
-#line 1321 "parser.y"
+  case 159: /* offset_expr: %empty  */
+#line 1353 "parser.y"
 {   (yyval.expr_t) = nullptr; }
-#line 4623 "parser.cpp"
+#line 4685 "parser.cpp"
     break;
 
-  case 158: /* distinct: DISTINCT  */
-#line 1323 "parser.y"
+  case 160: /* distinct: DISTINCT  */
+#line 1355 "parser.y"
                     {
     (yyval.bool_value) = true;
 }
-#line 4631 "parser.cpp"
+#line 4693 "parser.cpp"
     break;
 
-  case 159: /* distinct: %empty  */
-#line 1326 "parser.y"
+  case 161: /* distinct: %empty  */
+#line 1358 "parser.y"
   {
     (yyval.bool_value) = false;
 }
-#line 4639 "parser.cpp"
+#line 4701 "parser.cpp"
     break;
 
-  case 160: /* from_clause: FROM table_reference  */
-#line 1330 "parser.y"
+  case 162: /* from_clause: FROM table_reference  */
+#line 1362 "parser.y"
                                   {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4647 "parser.cpp"
+#line 4709 "parser.cpp"
     break;
 
-  case 161: /* from_clause: %empty  */
-#line 1333 "parser.y"
+  case 163: /* from_clause: %empty  */
+#line 1365 "parser.y"
                        {
     (yyval.table_reference_t) = nullptr;
 }
-#line 4655 "parser.cpp"
+#line 4717 "parser.cpp"
     break;
 
-  case 162: /* search_clause: SEARCH sub_search_array  */
-#line 1337 "parser.y"
+  case 164: /* search_clause: SEARCH sub_search_array  */
+#line 1369 "parser.y"
                                        {
     infinity::SearchExpr* search_expr = new infinity::SearchExpr();
     search_expr->SetExprs((yyvsp[0].expr_array_t));
     (yyval.expr_t) = search_expr;
 }
-#line 4665 "parser.cpp"
+#line 4727 "parser.cpp"
     break;
 
-  case 163: /* search_clause: %empty  */
-#line 1342 "parser.y"
+  case 165: /* search_clause: %empty  */
+#line 1374 "parser.y"
                          {
     (yyval.expr_t) = nullptr;
 }
-#line 4673 "parser.cpp"
+#line 4735 "parser.cpp"
     break;
 
-  case 164: /* where_clause: WHERE expr  */
-#line 1346 "parser.y"
+  case 166: /* where_clause: WHERE expr  */
+#line 1378 "parser.y"
                          {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4681 "parser.cpp"
+#line 4743 "parser.cpp"
     break;
 
-  case 165: /* where_clause: %empty  */
-#line 1349 "parser.y"
+  case 167: /* where_clause: %empty  */
+#line 1381 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4689 "parser.cpp"
+#line 4751 "parser.cpp"
     break;
 
-  case 166: /* having_clause: HAVING expr  */
-#line 1353 "parser.y"
+  case 168: /* having_clause: HAVING expr  */
+#line 1385 "parser.y"
                            {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 4697 "parser.cpp"
+#line 4759 "parser.cpp"
     break;
 
-  case 167: /* having_clause: %empty  */
-#line 1356 "parser.y"
+  case 169: /* having_clause: %empty  */
+#line 1388 "parser.y"
                         {
     (yyval.expr_t) = nullptr;
 }
-#line 4705 "parser.cpp"
+#line 4767 "parser.cpp"
     break;
 
-  case 168: /* group_by_clause: GROUP BY expr_array  */
-#line 1360 "parser.y"
+  case 170: /* group_by_clause: GROUP BY expr_array  */
+#line 1392 "parser.y"
                                      {
     (yyval.expr_array_t) = (yyvsp[0].expr_array_t);
 }
-#line 4713 "parser.cpp"
+#line 4775 "parser.cpp"
     break;
 
-  case 169: /* group_by_clause: %empty  */
-#line 1363 "parser.y"
+  case 171: /* group_by_clause: %empty  */
+#line 1395 "parser.y"
   {
     (yyval.expr_array_t) = nullptr;
 }
-#line 4721 "parser.cpp"
+#line 4783 "parser.cpp"
     break;
 
-  case 170: /* set_operator: UNION  */
-#line 1367 "parser.y"
+  case 172: /* set_operator: UNION  */
+#line 1399 "parser.y"
                      {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnion;
 }
-#line 4729 "parser.cpp"
+#line 4791 "parser.cpp"
     break;
 
-  case 171: /* set_operator: UNION ALL  */
-#line 1370 "parser.y"
+  case 173: /* set_operator: UNION ALL  */
+#line 1402 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kUnionAll;
 }
-#line 4737 "parser.cpp"
+#line 4799 "parser.cpp"
     break;
 
-  case 172: /* set_operator: INTERSECT  */
-#line 1373 "parser.y"
+  case 174: /* set_operator: INTERSECT  */
+#line 1405 "parser.y"
             {
     (yyval.set_operator_t) = infinity::SetOperatorType::kIntersect;
 }
-#line 4745 "parser.cpp"
+#line 4807 "parser.cpp"
     break;
 
-  case 173: /* set_operator: EXCEPT  */
-#line 1376 "parser.y"
+  case 175: /* set_operator: EXCEPT  */
+#line 1408 "parser.y"
          {
     (yyval.set_operator_t) = infinity::SetOperatorType::kExcept;
 }
-#line 4753 "parser.cpp"
+#line 4815 "parser.cpp"
     break;
 
-  case 174: /* table_reference: table_reference_unit  */
-#line 1384 "parser.y"
+  case 176: /* table_reference: table_reference_unit  */
+#line 1416 "parser.y"
                                        {
     (yyval.table_reference_t) = (yyvsp[0].table_reference_t);
 }
-#line 4761 "parser.cpp"
+#line 4823 "parser.cpp"
     break;
 
-  case 175: /* table_reference: table_reference ',' table_reference_unit  */
-#line 1387 "parser.y"
+  case 177: /* table_reference: table_reference ',' table_reference_unit  */
+#line 1419 "parser.y"
                                            {
     infinity::CrossProductReference* cross_product_ref = nullptr;
     if((yyvsp[-2].table_reference_t)->type_ == infinity::TableRefType::kCrossProduct) {
@@ -4775,11 +4837,11 @@ yyreduce:
 
     (yyval.table_reference_t) = cross_product_ref;
 }
-#line 4779 "parser.cpp"
+#line 4841 "parser.cpp"
     break;
 
-  case 178: /* table_reference_name: table_name table_alias  */
-#line 1404 "parser.y"
+  case 180: /* table_reference_name: table_name table_alias  */
+#line 1436 "parser.y"
                                               {
     infinity::TableReference* table_ref = new infinity::TableReference();
     if((yyvsp[-1].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -4793,32 +4855,32 @@ yyreduce:
     table_ref->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = table_ref;
 }
-#line 4797 "parser.cpp"
+#line 4859 "parser.cpp"
     break;
 
-  case 179: /* table_reference_name: '(' select_statement ')' table_alias  */
-#line 1418 "parser.y"
+  case 181: /* table_reference_name: '(' select_statement ')' table_alias  */
+#line 1450 "parser.y"
                                        {
     infinity::SubqueryReference* subquery_reference = new infinity::SubqueryReference();
     subquery_reference->select_statement_ = (yyvsp[-2].select_stmt);
     subquery_reference->alias_ = (yyvsp[0].table_alias_t);
     (yyval.table_reference_t) = subquery_reference;
 }
-#line 4808 "parser.cpp"
+#line 4870 "parser.cpp"
     break;
 
-  case 180: /* table_name: IDENTIFIER  */
-#line 1427 "parser.y"
+  case 182: /* table_name: IDENTIFIER  */
+#line 1459 "parser.y"
                         {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4818 "parser.cpp"
+#line 4880 "parser.cpp"
     break;
 
-  case 181: /* table_name: IDENTIFIER '.' IDENTIFIER  */
-#line 1432 "parser.y"
+  case 183: /* table_name: IDENTIFIER '.' IDENTIFIER  */
+#line 1464 "parser.y"
                             {
     (yyval.table_name_t) = new infinity::TableName();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -4826,84 +4888,84 @@ yyreduce:
     (yyval.table_name_t)->schema_name_ptr_ = (yyvsp[-2].str_value);
     (yyval.table_name_t)->table_name_ptr_ = (yyvsp[0].str_value);
 }
-#line 4830 "parser.cpp"
+#line 4892 "parser.cpp"
     break;
 
-  case 182: /* table_alias: AS IDENTIFIER  */
-#line 1441 "parser.y"
+  case 184: /* table_alias: AS IDENTIFIER  */
+#line 1473 "parser.y"
                             {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4840 "parser.cpp"
+#line 4902 "parser.cpp"
     break;
 
-  case 183: /* table_alias: IDENTIFIER  */
-#line 1446 "parser.y"
+  case 185: /* table_alias: IDENTIFIER  */
+#line 1478 "parser.y"
              {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[0].str_value);
 }
-#line 4850 "parser.cpp"
+#line 4912 "parser.cpp"
     break;
 
-  case 184: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
-#line 1451 "parser.y"
+  case 186: /* table_alias: AS IDENTIFIER '(' identifier_array ')'  */
+#line 1483 "parser.y"
                                          {
     (yyval.table_alias_t) = new infinity::TableAlias();
     ParserHelper::ToLower((yyvsp[-3].str_value));
     (yyval.table_alias_t)->alias_ = (yyvsp[-3].str_value);
     (yyval.table_alias_t)->column_alias_array_ = (yyvsp[-1].identifier_array_t);
 }
-#line 4861 "parser.cpp"
+#line 4923 "parser.cpp"
     break;
 
-  case 185: /* table_alias: %empty  */
-#line 1457 "parser.y"
+  case 187: /* table_alias: %empty  */
+#line 1489 "parser.y"
   {
     (yyval.table_alias_t) = nullptr;
 }
-#line 4869 "parser.cpp"
+#line 4931 "parser.cpp"
     break;
 
-  case 186: /* with_clause: WITH with_expr_list  */
-#line 1464 "parser.y"
+  case 188: /* with_clause: WITH with_expr_list  */
+#line 1496 "parser.y"
                                   {
     (yyval.with_expr_list_t) = (yyvsp[0].with_expr_list_t);
 }
-#line 4877 "parser.cpp"
+#line 4939 "parser.cpp"
     break;
 
-  case 187: /* with_clause: %empty  */
-#line 1467 "parser.y"
+  case 189: /* with_clause: %empty  */
+#line 1499 "parser.y"
                           {
     (yyval.with_expr_list_t) = nullptr;
 }
-#line 4885 "parser.cpp"
+#line 4947 "parser.cpp"
     break;
 
-  case 188: /* with_expr_list: with_expr  */
-#line 1471 "parser.y"
+  case 190: /* with_expr_list: with_expr  */
+#line 1503 "parser.y"
                           {
     (yyval.with_expr_list_t) = new std::vector<infinity::WithExpr*>();
     (yyval.with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
 }
-#line 4894 "parser.cpp"
+#line 4956 "parser.cpp"
     break;
 
-  case 189: /* with_expr_list: with_expr_list ',' with_expr  */
-#line 1474 "parser.y"
+  case 191: /* with_expr_list: with_expr_list ',' with_expr  */
+#line 1506 "parser.y"
                                  {
     (yyvsp[-2].with_expr_list_t)->emplace_back((yyvsp[0].with_expr_t));
     (yyval.with_expr_list_t) = (yyvsp[-2].with_expr_list_t);
 }
-#line 4903 "parser.cpp"
+#line 4965 "parser.cpp"
     break;
 
-  case 190: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
-#line 1479 "parser.y"
+  case 192: /* with_expr: IDENTIFIER AS '(' select_clause_with_modifier ')'  */
+#line 1511 "parser.y"
                                                              {
     (yyval.with_expr_t) = new infinity::WithExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -4911,11 +4973,11 @@ yyreduce:
     free((yyvsp[-4].str_value));
     (yyval.with_expr_t)->select_ = (yyvsp[-1].select_stmt);
 }
-#line 4915 "parser.cpp"
+#line 4977 "parser.cpp"
     break;
 
-  case 191: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
-#line 1491 "parser.y"
+  case 193: /* join_clause: table_reference_unit NATURAL JOIN table_reference_name  */
+#line 1523 "parser.y"
                                                                     {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-3].table_reference_t);
@@ -4923,11 +4985,11 @@ yyreduce:
     join_reference->join_type_ = infinity::JoinType::kNatural;
     (yyval.table_reference_t) = join_reference;
 }
-#line 4927 "parser.cpp"
+#line 4989 "parser.cpp"
     break;
 
-  case 192: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
-#line 1498 "parser.y"
+  case 194: /* join_clause: table_reference_unit join_type JOIN table_reference_name ON expr  */
+#line 1530 "parser.y"
                                                                    {
     infinity::JoinReference* join_reference = new infinity::JoinReference();
     join_reference->left_ = (yyvsp[-5].table_reference_t);
@@ -4936,102 +4998,102 @@ yyreduce:
     join_reference->condition_ = (yyvsp[0].expr_t);
     (yyval.table_reference_t) = join_reference;
 }
-#line 4940 "parser.cpp"
+#line 5002 "parser.cpp"
     break;
 
-  case 193: /* join_type: INNER  */
-#line 1512 "parser.y"
+  case 195: /* join_type: INNER  */
+#line 1544 "parser.y"
                   {
     (yyval.join_type_t) = infinity::JoinType::kInner;
 }
-#line 4948 "parser.cpp"
+#line 5010 "parser.cpp"
     break;
 
-  case 194: /* join_type: LEFT  */
-#line 1515 "parser.y"
+  case 196: /* join_type: LEFT  */
+#line 1547 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kLeft;
 }
-#line 4956 "parser.cpp"
+#line 5018 "parser.cpp"
     break;
 
-  case 195: /* join_type: RIGHT  */
-#line 1518 "parser.y"
+  case 197: /* join_type: RIGHT  */
+#line 1550 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kRight;
 }
-#line 4964 "parser.cpp"
+#line 5026 "parser.cpp"
     break;
 
-  case 196: /* join_type: OUTER  */
-#line 1521 "parser.y"
+  case 198: /* join_type: OUTER  */
+#line 1553 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4972 "parser.cpp"
+#line 5034 "parser.cpp"
     break;
 
-  case 197: /* join_type: FULL  */
-#line 1524 "parser.y"
+  case 199: /* join_type: FULL  */
+#line 1556 "parser.y"
        {
     (yyval.join_type_t) = infinity::JoinType::kFull;
 }
-#line 4980 "parser.cpp"
+#line 5042 "parser.cpp"
     break;
 
-  case 198: /* join_type: CROSS  */
-#line 1527 "parser.y"
+  case 200: /* join_type: CROSS  */
+#line 1559 "parser.y"
         {
     (yyval.join_type_t) = infinity::JoinType::kCross;
 }
-#line 4988 "parser.cpp"
+#line 5050 "parser.cpp"
     break;
 
-  case 199: /* join_type: %empty  */
-#line 1530 "parser.y"
+  case 201: /* join_type: %empty  */
+#line 1562 "parser.y"
                 {
 }
-#line 4995 "parser.cpp"
+#line 5057 "parser.cpp"
     break;
 
-  case 200: /* show_statement: SHOW DATABASES  */
-#line 1536 "parser.y"
+  case 202: /* show_statement: SHOW DATABASES  */
+#line 1568 "parser.y"
                                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabases;
 }
-#line 5004 "parser.cpp"
+#line 5066 "parser.cpp"
     break;
 
-  case 201: /* show_statement: SHOW TABLES  */
-#line 1540 "parser.y"
+  case 203: /* show_statement: SHOW TABLES  */
+#line 1572 "parser.y"
               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTables;
 }
-#line 5013 "parser.cpp"
+#line 5075 "parser.cpp"
     break;
 
-  case 202: /* show_statement: SHOW VIEWS  */
-#line 1544 "parser.y"
+  case 204: /* show_statement: SHOW VIEWS  */
+#line 1576 "parser.y"
              {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kViews;
 }
-#line 5022 "parser.cpp"
+#line 5084 "parser.cpp"
     break;
 
-  case 203: /* show_statement: SHOW CONFIGS  */
-#line 1548 "parser.y"
+  case 205: /* show_statement: SHOW CONFIGS  */
+#line 1580 "parser.y"
                {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfigs;
 }
-#line 5031 "parser.cpp"
+#line 5093 "parser.cpp"
     break;
 
-  case 204: /* show_statement: SHOW CONFIG IDENTIFIER  */
-#line 1552 "parser.y"
+  case 206: /* show_statement: SHOW CONFIG IDENTIFIER  */
+#line 1584 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kConfig;
@@ -5039,71 +5101,80 @@ yyreduce:
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5043 "parser.cpp"
+#line 5105 "parser.cpp"
     break;
 
-  case 205: /* show_statement: SHOW PROFILES  */
-#line 1559 "parser.y"
+  case 207: /* show_statement: SHOW BUFFER  */
+#line 1591 "parser.y"
+              {
+    (yyval.show_stmt) = new infinity::ShowStatement();
+    (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBuffer;
+}
+#line 5114 "parser.cpp"
+    break;
+
+  case 208: /* show_statement: SHOW PROFILES  */
+#line 1595 "parser.y"
                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kProfiles;
 }
-#line 5052 "parser.cpp"
+#line 5123 "parser.cpp"
     break;
 
-  case 206: /* show_statement: SHOW SESSION VARIABLES  */
-#line 1563 "parser.y"
+  case 209: /* show_statement: SHOW SESSION VARIABLES  */
+#line 1599 "parser.y"
                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariables;
 }
-#line 5061 "parser.cpp"
+#line 5132 "parser.cpp"
     break;
 
-  case 207: /* show_statement: SHOW GLOBAL VARIABLES  */
-#line 1567 "parser.y"
+  case 210: /* show_statement: SHOW GLOBAL VARIABLES  */
+#line 1603 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariables;
 }
-#line 5070 "parser.cpp"
+#line 5141 "parser.cpp"
     break;
 
-  case 208: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
-#line 1571 "parser.y"
+  case 211: /* show_statement: SHOW SESSION VARIABLE IDENTIFIER  */
+#line 1607 "parser.y"
                                    {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSessionVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5081 "parser.cpp"
+#line 5152 "parser.cpp"
     break;
 
-  case 209: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
-#line 1577 "parser.y"
+  case 212: /* show_statement: SHOW GLOBAL VARIABLE IDENTIFIER  */
+#line 1613 "parser.y"
                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kGlobalVariable;
     (yyval.show_stmt)->var_name_ = std::string((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5092 "parser.cpp"
+#line 5163 "parser.cpp"
     break;
 
-  case 210: /* show_statement: SHOW DATABASE IDENTIFIER  */
-#line 1583 "parser.y"
+  case 213: /* show_statement: SHOW DATABASE IDENTIFIER  */
+#line 1619 "parser.y"
                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kDatabase;
     (yyval.show_stmt)->schema_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5103 "parser.cpp"
+#line 5174 "parser.cpp"
     break;
 
-  case 211: /* show_statement: SHOW TABLE table_name  */
-#line 1589 "parser.y"
+  case 214: /* show_statement: SHOW TABLE table_name  */
+#line 1625 "parser.y"
                         {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kTable;
@@ -5115,11 +5186,11 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5119 "parser.cpp"
+#line 5190 "parser.cpp"
     break;
 
-  case 212: /* show_statement: SHOW TABLE table_name COLUMNS  */
-#line 1600 "parser.y"
+  case 215: /* show_statement: SHOW TABLE table_name COLUMNS  */
+#line 1636 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kColumns;
@@ -5131,11 +5202,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5135 "parser.cpp"
+#line 5206 "parser.cpp"
     break;
 
-  case 213: /* show_statement: SHOW TABLE table_name SEGMENTS  */
-#line 1611 "parser.y"
+  case 216: /* show_statement: SHOW TABLE table_name SEGMENTS  */
+#line 1647 "parser.y"
                                  {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegments;
@@ -5147,11 +5218,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5151 "parser.cpp"
+#line 5222 "parser.cpp"
     break;
 
-  case 214: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
-#line 1622 "parser.y"
+  case 217: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE  */
+#line 1658 "parser.y"
                                            {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kSegment;
@@ -5164,11 +5235,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-2].table_name_t);
 }
-#line 5168 "parser.cpp"
+#line 5239 "parser.cpp"
     break;
 
-  case 215: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
-#line 1634 "parser.y"
+  case 218: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCKS  */
+#line 1670 "parser.y"
                                                   {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlocks;
@@ -5181,11 +5252,11 @@ yyreduce:
     (yyval.show_stmt)->segment_id_ = (yyvsp[-1].long_value);
     delete (yyvsp[-3].table_name_t);
 }
-#line 5185 "parser.cpp"
+#line 5256 "parser.cpp"
     break;
 
-  case 216: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
-#line 1646 "parser.y"
+  case 219: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE  */
+#line 1682 "parser.y"
                                                             {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlock;
@@ -5199,11 +5270,11 @@ yyreduce:
     (yyval.show_stmt)->block_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-4].table_name_t);
 }
-#line 5203 "parser.cpp"
+#line 5274 "parser.cpp"
     break;
 
-  case 217: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
-#line 1659 "parser.y"
+  case 220: /* show_statement: SHOW TABLE table_name SEGMENT LONG_VALUE BLOCK LONG_VALUE COLUMN LONG_VALUE  */
+#line 1695 "parser.y"
                                                                               {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kBlockColumn;
@@ -5218,11 +5289,11 @@ yyreduce:
     (yyval.show_stmt)->column_id_ = (yyvsp[0].long_value);
     delete (yyvsp[-6].table_name_t);
 }
-#line 5222 "parser.cpp"
+#line 5293 "parser.cpp"
     break;
 
-  case 218: /* show_statement: SHOW TABLE table_name INDEXES  */
-#line 1673 "parser.y"
+  case 221: /* show_statement: SHOW TABLE table_name INDEXES  */
+#line 1709 "parser.y"
                                 {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndexes;
@@ -5234,11 +5305,11 @@ yyreduce:
     free((yyvsp[-1].table_name_t)->table_name_ptr_);
     delete (yyvsp[-1].table_name_t);
 }
-#line 5238 "parser.cpp"
+#line 5309 "parser.cpp"
     break;
 
-  case 219: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
-#line 1684 "parser.y"
+  case 222: /* show_statement: SHOW TABLE table_name INDEX IDENTIFIER  */
+#line 1720 "parser.y"
                                          {
     (yyval.show_stmt) = new infinity::ShowStatement();
     (yyval.show_stmt)->show_type_ = infinity::ShowStmtType::kIndex;
@@ -5253,38 +5324,38 @@ yyreduce:
     (yyval.show_stmt)->index_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5257 "parser.cpp"
+#line 5328 "parser.cpp"
     break;
 
-  case 220: /* flush_statement: FLUSH DATA  */
-#line 1702 "parser.y"
+  case 223: /* flush_statement: FLUSH DATA  */
+#line 1738 "parser.y"
                             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kData;
 }
-#line 5266 "parser.cpp"
+#line 5337 "parser.cpp"
     break;
 
-  case 221: /* flush_statement: FLUSH LOG  */
-#line 1706 "parser.y"
+  case 224: /* flush_statement: FLUSH LOG  */
+#line 1742 "parser.y"
             {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kLog;
 }
-#line 5275 "parser.cpp"
+#line 5346 "parser.cpp"
     break;
 
-  case 222: /* flush_statement: FLUSH BUFFER  */
-#line 1710 "parser.y"
+  case 225: /* flush_statement: FLUSH BUFFER  */
+#line 1746 "parser.y"
                {
     (yyval.flush_stmt) = new infinity::FlushStatement();
     (yyval.flush_stmt)->type_ = infinity::FlushType::kBuffer;
 }
-#line 5284 "parser.cpp"
+#line 5355 "parser.cpp"
     break;
 
-  case 223: /* optimize_statement: OPTIMIZE table_name  */
-#line 1718 "parser.y"
+  case 226: /* optimize_statement: OPTIMIZE table_name  */
+#line 1754 "parser.y"
                                         {
     (yyval.optimize_stmt) = new infinity::OptimizeStatement();
     if((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5295,54 +5366,54 @@ yyreduce:
     free((yyvsp[0].table_name_t)->table_name_ptr_);
     delete (yyvsp[0].table_name_t);
 }
-#line 5299 "parser.cpp"
+#line 5370 "parser.cpp"
     break;
 
-  case 224: /* command_statement: USE IDENTIFIER  */
-#line 1732 "parser.y"
+  case 227: /* command_statement: USE IDENTIFIER  */
+#line 1768 "parser.y"
                                   {
     (yyval.command_stmt) = new infinity::CommandStatement();
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::UseCmd>((yyvsp[0].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5310 "parser.cpp"
+#line 5381 "parser.cpp"
     break;
 
-  case 225: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
-#line 1738 "parser.y"
+  case 228: /* command_statement: EXPORT PROFILE LONG_VALUE file_path  */
+#line 1774 "parser.y"
                                       {
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::ExportCmd>((yyvsp[0].str_value), infinity::ExportType::kProfileRecord, (yyvsp[-1].long_value));
     free((yyvsp[0].str_value));
 }
-#line 5320 "parser.cpp"
+#line 5391 "parser.cpp"
     break;
 
-  case 226: /* command_statement: SET SESSION IDENTIFIER ON  */
-#line 1743 "parser.y"
+  case 229: /* command_statement: SET SESSION IDENTIFIER ON  */
+#line 1779 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5331 "parser.cpp"
+#line 5402 "parser.cpp"
     break;
 
-  case 227: /* command_statement: SET SESSION IDENTIFIER OFF  */
-#line 1749 "parser.y"
+  case 230: /* command_statement: SET SESSION IDENTIFIER OFF  */
+#line 1785 "parser.y"
                              {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5342 "parser.cpp"
+#line 5413 "parser.cpp"
     break;
 
-  case 228: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
-#line 1755 "parser.y"
+  case 231: /* command_statement: SET SESSION IDENTIFIER IDENTIFIER  */
+#line 1791 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5351,55 +5422,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5355 "parser.cpp"
+#line 5426 "parser.cpp"
     break;
 
-  case 229: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
-#line 1763 "parser.y"
+  case 232: /* command_statement: SET SESSION IDENTIFIER LONG_VALUE  */
+#line 1799 "parser.y"
                                     {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5366 "parser.cpp"
+#line 5437 "parser.cpp"
     break;
 
-  case 230: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
-#line 1769 "parser.y"
+  case 233: /* command_statement: SET SESSION IDENTIFIER DOUBLE_VALUE  */
+#line 1805 "parser.y"
                                       {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kSession, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5377 "parser.cpp"
+#line 5448 "parser.cpp"
     break;
 
-  case 231: /* command_statement: SET GLOBAL IDENTIFIER ON  */
-#line 1775 "parser.y"
+  case 234: /* command_statement: SET GLOBAL IDENTIFIER ON  */
+#line 1811 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5388 "parser.cpp"
+#line 5459 "parser.cpp"
     break;
 
-  case 232: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
-#line 1781 "parser.y"
+  case 235: /* command_statement: SET GLOBAL IDENTIFIER OFF  */
+#line 1817 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5399 "parser.cpp"
+#line 5470 "parser.cpp"
     break;
 
-  case 233: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
-#line 1787 "parser.y"
+  case 236: /* command_statement: SET GLOBAL IDENTIFIER IDENTIFIER  */
+#line 1823 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5408,55 +5479,55 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5412 "parser.cpp"
+#line 5483 "parser.cpp"
     break;
 
-  case 234: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
-#line 1795 "parser.y"
+  case 237: /* command_statement: SET GLOBAL IDENTIFIER LONG_VALUE  */
+#line 1831 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5423 "parser.cpp"
+#line 5494 "parser.cpp"
     break;
 
-  case 235: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
-#line 1801 "parser.y"
+  case 238: /* command_statement: SET GLOBAL IDENTIFIER DOUBLE_VALUE  */
+#line 1837 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kGlobal, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5434 "parser.cpp"
+#line 5505 "parser.cpp"
     break;
 
-  case 236: /* command_statement: SET CONFIG IDENTIFIER ON  */
-#line 1807 "parser.y"
+  case 239: /* command_statement: SET CONFIG IDENTIFIER ON  */
+#line 1843 "parser.y"
                            {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), true);
     free((yyvsp[-1].str_value));
 }
-#line 5445 "parser.cpp"
+#line 5516 "parser.cpp"
     break;
 
-  case 237: /* command_statement: SET CONFIG IDENTIFIER OFF  */
-#line 1813 "parser.y"
+  case 240: /* command_statement: SET CONFIG IDENTIFIER OFF  */
+#line 1849 "parser.y"
                             {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kBool, (yyvsp[-1].str_value), false);
     free((yyvsp[-1].str_value));
 }
-#line 5456 "parser.cpp"
+#line 5527 "parser.cpp"
     break;
 
-  case 238: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
-#line 1819 "parser.y"
+  case 241: /* command_statement: SET CONFIG IDENTIFIER IDENTIFIER  */
+#line 1855 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -5465,33 +5536,33 @@ yyreduce:
     free((yyvsp[-1].str_value));
     free((yyvsp[0].str_value));
 }
-#line 5469 "parser.cpp"
+#line 5540 "parser.cpp"
     break;
 
-  case 239: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
-#line 1827 "parser.y"
+  case 242: /* command_statement: SET CONFIG IDENTIFIER LONG_VALUE  */
+#line 1863 "parser.y"
                                    {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kInteger, (yyvsp[-1].str_value), (yyvsp[0].long_value));
     free((yyvsp[-1].str_value));
 }
-#line 5480 "parser.cpp"
+#line 5551 "parser.cpp"
     break;
 
-  case 240: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
-#line 1833 "parser.y"
+  case 243: /* command_statement: SET CONFIG IDENTIFIER DOUBLE_VALUE  */
+#line 1869 "parser.y"
                                      {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     (yyval.command_stmt) = new infinity::CommandStatement();
     (yyval.command_stmt)->command_info_ = std::make_unique<infinity::SetCmd>(infinity::SetScope::kConfig, infinity::SetVarType::kDouble, (yyvsp[-1].str_value), (yyvsp[0].double_value));
     free((yyvsp[-1].str_value));
 }
-#line 5491 "parser.cpp"
+#line 5562 "parser.cpp"
     break;
 
-  case 241: /* compact_statement: COMPACT TABLE table_name  */
-#line 1840 "parser.y"
+  case 244: /* compact_statement: COMPACT TABLE table_name  */
+#line 1876 "parser.y"
                                             {
     std::string schema_name;
     if ((yyvsp[0].table_name_t)->schema_name_ptr_ != nullptr) {
@@ -5504,38 +5575,38 @@ yyreduce:
     (yyval.compact_stmt) = new infinity::ManualCompactStatement(std::move(schema_name), std::move(table_name));
     delete (yyvsp[0].table_name_t);
 }
-#line 5508 "parser.cpp"
+#line 5579 "parser.cpp"
     break;
 
-  case 242: /* expr_array: expr_alias  */
-#line 1857 "parser.y"
+  case 245: /* expr_array: expr_alias  */
+#line 1893 "parser.y"
                         {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5517 "parser.cpp"
+#line 5588 "parser.cpp"
     break;
 
-  case 243: /* expr_array: expr_array ',' expr_alias  */
-#line 1861 "parser.y"
+  case 246: /* expr_array: expr_array ',' expr_alias  */
+#line 1897 "parser.y"
                             {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5526 "parser.cpp"
+#line 5597 "parser.cpp"
     break;
 
-  case 244: /* expr_array_list: '(' expr_array ')'  */
-#line 1866 "parser.y"
+  case 247: /* expr_array_list: '(' expr_array ')'  */
+#line 1902 "parser.y"
                                      {
     (yyval.expr_array_list_t) = new std::vector<std::vector<infinity::ParsedExpr*>*>();
     (yyval.expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
 }
-#line 5535 "parser.cpp"
+#line 5606 "parser.cpp"
     break;
 
-  case 245: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
-#line 1870 "parser.y"
+  case 248: /* expr_array_list: expr_array_list ',' '(' expr_array ')'  */
+#line 1906 "parser.y"
                                          {
     if(!(yyvsp[-4].expr_array_list_t)->empty() && (yyvsp[-4].expr_array_list_t)->back()->size() != (yyvsp[-1].expr_array_t)->size()) {
         yyerror(&yyloc, scanner, result, "The expr_array in list shall have the same size.");
@@ -5551,73 +5622,73 @@ yyreduce:
     (yyvsp[-4].expr_array_list_t)->push_back((yyvsp[-1].expr_array_t));
     (yyval.expr_array_list_t) = (yyvsp[-4].expr_array_list_t);
 }
-#line 5555 "parser.cpp"
+#line 5626 "parser.cpp"
     break;
 
-  case 246: /* expr_alias: expr AS IDENTIFIER  */
-#line 1897 "parser.y"
+  case 249: /* expr_alias: expr AS IDENTIFIER  */
+#line 1933 "parser.y"
                                 {
     (yyval.expr_t) = (yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
     (yyval.expr_t)->alias_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 5566 "parser.cpp"
+#line 5637 "parser.cpp"
     break;
 
-  case 247: /* expr_alias: expr  */
-#line 1903 "parser.y"
+  case 250: /* expr_alias: expr  */
+#line 1939 "parser.y"
        {
     (yyval.expr_t) = (yyvsp[0].expr_t);
 }
-#line 5574 "parser.cpp"
+#line 5645 "parser.cpp"
     break;
 
-  case 253: /* operand: '(' expr ')'  */
-#line 1913 "parser.y"
+  case 256: /* operand: '(' expr ')'  */
+#line 1949 "parser.y"
                       {
     (yyval.expr_t) = (yyvsp[-1].expr_t);
 }
-#line 5582 "parser.cpp"
+#line 5653 "parser.cpp"
     break;
 
-  case 254: /* operand: '(' select_without_paren ')'  */
-#line 1916 "parser.y"
+  case 257: /* operand: '(' select_without_paren ')'  */
+#line 1952 "parser.y"
                                {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kScalar;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 5593 "parser.cpp"
+#line 5664 "parser.cpp"
     break;
 
-  case 255: /* operand: constant_expr  */
-#line 1922 "parser.y"
+  case 258: /* operand: constant_expr  */
+#line 1958 "parser.y"
                 {
     (yyval.expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 5601 "parser.cpp"
+#line 5672 "parser.cpp"
     break;
 
-  case 265: /* extra_match_tensor_option: ',' STRING  */
-#line 1935 "parser.y"
+  case 269: /* extra_match_tensor_option: ',' STRING  */
+#line 1972 "parser.y"
                                        {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 5609 "parser.cpp"
+#line 5680 "parser.cpp"
     break;
 
-  case 266: /* extra_match_tensor_option: %empty  */
-#line 1938 "parser.y"
+  case 270: /* extra_match_tensor_option: %empty  */
+#line 1975 "parser.y"
   {
     (yyval.str_value) = nullptr;
 }
-#line 5617 "parser.cpp"
+#line 5688 "parser.cpp"
     break;
 
-  case 267: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
-#line 1944 "parser.y"
+  case 271: /* match_tensor_expr: MATCH TENSOR '(' column_expr ',' common_array_expr ',' STRING ',' STRING extra_match_tensor_option ')'  */
+#line 1981 "parser.y"
                                                                                                                            {
     infinity::MatchTensorExpr* match_tensor_expr = new infinity::MatchTensorExpr();
     (yyval.expr_t) = match_tensor_expr;
@@ -5639,11 +5710,11 @@ yyreduce:
         free((yyvsp[-1].str_value));
     }
 }
-#line 5643 "parser.cpp"
+#line 5714 "parser.cpp"
     break;
 
-  case 268: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
-#line 1966 "parser.y"
+  case 272: /* match_vector_expr: MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2003 "parser.y"
                                                                                                                         {
     infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
     (yyval.expr_t) = match_vector_expr;
@@ -5674,9 +5745,9 @@ yyreduce:
         YYERROR;
     }
 
-    // KNN data type
+    // KNN data type, a float query of a hamming search is binarized by the binder
     ParserHelper::ToLower((yyvsp[-6].str_value));
-    if(strcmp((yyvsp[-6].str_value), "float") == 0 and match_vector_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
+    if(strcmp((yyvsp[-6].str_value), "float") == 0) {
         match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemFloat;
         if(!((yyvsp[-8].const_expr_t)->double_array_.empty())) {
             match_vector_expr->dimension_ = (yyvsp[-8].const_expr_t)->double_array_.size();
@@ -5809,11 +5880,67 @@ yyreduce:
     match_vector_expr->topn_ = (yyvsp[-2].long_value);
     match_vector_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
 }
-#line 5813 "parser.cpp"
+#line 5884 "parser.cpp"
     break;
 
-  case 269: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
-#line 2132 "parser.y"
+  case 273: /* match_vector_expr: MATCH VECTOR '(' expr ',' '?' ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list  */
+#line 2168 "parser.y"
+                                                                                               {
+    // the query vector is a parameter, its embedding is built from the value of the parameter by the binder
+    infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
+    (yyval.expr_t) = match_vector_expr;
+    match_vector_expr->column_expr_ = (yyvsp[-10].expr_t);
+    match_vector_expr->query_parameter_index_ = result->parameter_count_++;
+    match_vector_expr->topn_ = (yyvsp[-2].long_value);
+    match_vector_expr->opt_params_ = (yyvsp[0].with_index_param_list_t);
+
+    ParserHelper::ToLower((yyvsp[-4].str_value));
+    if(strcmp((yyvsp[-4].str_value), "l2") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kL2;
+    } else if(strcmp((yyvsp[-4].str_value), "ip") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kInnerProduct;
+    } else if(strcmp((yyvsp[-4].str_value), "cosine") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kCosine;
+    } else if(strcmp((yyvsp[-4].str_value), "hamming") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kHamming;
+    }
+
+    ParserHelper::ToLower((yyvsp[-6].str_value));
+    bool hamming = match_vector_expr->distance_type_ == infinity::KnnDistanceType::kHamming;
+    if(strcmp((yyvsp[-6].str_value), "float") == 0) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemFloat;
+    } else if(strcmp((yyvsp[-6].str_value), "tinyint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt8;
+    } else if(strcmp((yyvsp[-6].str_value), "smallint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt16;
+    } else if(strcmp((yyvsp[-6].str_value), "integer") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt32;
+    } else if(strcmp((yyvsp[-6].str_value), "bigint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt64;
+    } else if(strcmp((yyvsp[-6].str_value), "double") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemDouble;
+    } else if(strcmp((yyvsp[-6].str_value), "bit") == 0 and hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemBit;
+    }
+    free((yyvsp[-6].str_value));
+    free((yyvsp[-4].str_value));
+
+    if(match_vector_expr->distance_type_ == infinity::KnnDistanceType::kInvalid) {
+        delete (yyval.expr_t);
+        yyerror(&yyloc, scanner, result, "Invalid knn distance type");
+        YYERROR;
+    }
+    if(match_vector_expr->embedding_data_type_ == infinity::EmbeddingDataType::kElemInvalid) {
+        delete (yyval.expr_t);
+        yyerror(&yyloc, scanner, result, "Invalid knn data type");
+        YYERROR;
+    }
+}
+#line 5940 "parser.cpp"
+    break;
+
+  case 274: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ')'  */
+#line 2220 "parser.y"
                                                        {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-3].str_value));
@@ -5822,11 +5949,11 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5826 "parser.cpp"
+#line 5953 "parser.cpp"
     break;
 
-  case 270: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
-#line 2140 "parser.y"
+  case 275: /* match_text_expr: MATCH TEXT '(' STRING ',' STRING ',' STRING ')'  */
+#line 2228 "parser.y"
                                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->fields_ = std::string((yyvsp[-5].str_value));
@@ -5837,22 +5964,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5841 "parser.cpp"
+#line 5968 "parser.cpp"
     break;
 
-  case 271: /* query_expr: QUERY '(' STRING ')'  */
-#line 2151 "parser.y"
+  case 276: /* query_expr: QUERY '(' STRING ')'  */
+#line 2239 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5852 "parser.cpp"
+#line 5979 "parser.cpp"
     break;
 
-  case 272: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
-#line 2157 "parser.y"
+  case 277: /* query_expr: QUERY '(' STRING ',' STRING ')'  */
+#line 2245 "parser.y"
                                   {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
     match_text_expr->matching_text_ = std::string((yyvsp[-3].str_value));
@@ -5861,22 +5988,22 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = match_text_expr;
 }
-#line 5865 "parser.cpp"
+#line 5992 "parser.cpp"
     break;
 
-  case 273: /* fusion_expr: FUSION '(' STRING ')'  */
-#line 2166 "parser.y"
+  case 278: /* fusion_expr: FUSION '(' STRING ')'  */
+#line 2254 "parser.y"
                                     {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-1].str_value));
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5876 "parser.cpp"
+#line 6003 "parser.cpp"
     break;
 
-  case 274: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
-#line 2172 "parser.y"
+  case 279: /* fusion_expr: FUSION '(' STRING ',' STRING ')'  */
+#line 2260 "parser.y"
                                    {
     infinity::FusionExpr* fusion_expr = new infinity::FusionExpr();
     fusion_expr->method_ = std::string((yyvsp[-3].str_value));
@@ -5885,101 +6012,101 @@ yyreduce:
     free((yyvsp[-1].str_value));
     (yyval.expr_t) = fusion_expr;
 }
-#line 5889 "parser.cpp"
+#line 6016 "parser.cpp"
     break;
 
-  case 275: /* sub_search_array: match_vector_expr  */
-#line 2182 "parser.y"
+  case 280: /* sub_search_array: match_vector_expr  */
+#line 2270 "parser.y"
                                      {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5898 "parser.cpp"
+#line 6025 "parser.cpp"
     break;
 
-  case 276: /* sub_search_array: match_text_expr  */
-#line 2186 "parser.y"
+  case 281: /* sub_search_array: match_text_expr  */
+#line 2274 "parser.y"
                   {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5907 "parser.cpp"
+#line 6034 "parser.cpp"
     break;
 
-  case 277: /* sub_search_array: match_tensor_expr  */
-#line 2190 "parser.y"
+  case 282: /* sub_search_array: match_tensor_expr  */
+#line 2278 "parser.y"
                     {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5916 "parser.cpp"
+#line 6043 "parser.cpp"
     break;
 
-  case 278: /* sub_search_array: query_expr  */
-#line 2194 "parser.y"
+  case 283: /* sub_search_array: query_expr  */
+#line 2282 "parser.y"
              {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5925 "parser.cpp"
+#line 6052 "parser.cpp"
     break;
 
-  case 279: /* sub_search_array: fusion_expr  */
-#line 2198 "parser.y"
+  case 284: /* sub_search_array: fusion_expr  */
+#line 2286 "parser.y"
               {
     (yyval.expr_array_t) = new std::vector<infinity::ParsedExpr*>();
     (yyval.expr_array_t)->emplace_back((yyvsp[0].expr_t));
 }
-#line 5934 "parser.cpp"
+#line 6061 "parser.cpp"
     break;
 
-  case 280: /* sub_search_array: sub_search_array ',' match_vector_expr  */
-#line 2202 "parser.y"
+  case 285: /* sub_search_array: sub_search_array ',' match_vector_expr  */
+#line 2290 "parser.y"
                                          {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5943 "parser.cpp"
+#line 6070 "parser.cpp"
     break;
 
-  case 281: /* sub_search_array: sub_search_array ',' match_text_expr  */
-#line 2206 "parser.y"
+  case 286: /* sub_search_array: sub_search_array ',' match_text_expr  */
+#line 2294 "parser.y"
                                        {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5952 "parser.cpp"
+#line 6079 "parser.cpp"
     break;
 
-  case 282: /* sub_search_array: sub_search_array ',' match_tensor_expr  */
-#line 2210 "parser.y"
+  case 287: /* sub_search_array: sub_search_array ',' match_tensor_expr  */
+#line 2298 "parser.y"
                                          {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5961 "parser.cpp"
+#line 6088 "parser.cpp"
     break;
 
-  case 283: /* sub_search_array: sub_search_array ',' query_expr  */
-#line 2214 "parser.y"
+  case 288: /* sub_search_array: sub_search_array ',' query_expr  */
+#line 2302 "parser.y"
                                   {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5970 "parser.cpp"
+#line 6097 "parser.cpp"
     break;
 
-  case 284: /* sub_search_array: sub_search_array ',' fusion_expr  */
-#line 2218 "parser.y"
+  case 289: /* sub_search_array: sub_search_array ',' fusion_expr  */
+#line 2306 "parser.y"
                                    {
     (yyvsp[-2].expr_array_t)->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_array_t) = (yyvsp[-2].expr_array_t);
 }
-#line 5979 "parser.cpp"
+#line 6106 "parser.cpp"
     break;
 
-  case 285: /* function_expr: IDENTIFIER '(' ')'  */
-#line 2223 "parser.y"
+  case 290: /* function_expr: IDENTIFIER '(' ')'  */
+#line 2311 "parser.y"
                                    {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-2].str_value));
@@ -5988,11 +6115,11 @@ yyreduce:
     func_expr->arguments_ = nullptr;
     (yyval.expr_t) = func_expr;
 }
-#line 5992 "parser.cpp"
+#line 6119 "parser.cpp"
     break;
 
-  case 286: /* function_expr: IDENTIFIER '(' expr_array ')'  */
-#line 2231 "parser.y"
+  case 291: /* function_expr: IDENTIFIER '(' expr_array ')'  */
+#line 2319 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6001,11 +6128,11 @@ yyreduce:
     func_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = func_expr;
 }
-#line 6005 "parser.cpp"
+#line 6132 "parser.cpp"
     break;
 
-  case 287: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
-#line 2239 "parser.y"
+  case 292: /* function_expr: IDENTIFIER '(' DISTINCT expr_array ')'  */
+#line 2327 "parser.y"
                                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-4].str_value));
@@ -6015,11 +6142,11 @@ yyreduce:
     func_expr->distinct_ = true;
     (yyval.expr_t) = func_expr;
 }
-#line 6019 "parser.cpp"
+#line 6146 "parser.cpp"
     break;
 
-  case 288: /* function_expr: operand IS NOT NULLABLE  */
-#line 2248 "parser.y"
+  case 293: /* function_expr: operand IS NOT NULLABLE  */
+#line 2336 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_not_null";
@@ -6027,11 +6154,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-3].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6031 "parser.cpp"
+#line 6158 "parser.cpp"
     break;
 
-  case 289: /* function_expr: operand IS NULLABLE  */
-#line 2255 "parser.y"
+  case 294: /* function_expr: operand IS NULLABLE  */
+#line 2343 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "is_null";
@@ -6039,11 +6166,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-2].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6043 "parser.cpp"
+#line 6170 "parser.cpp"
     break;
 
-  case 290: /* function_expr: NOT operand  */
-#line 2262 "parser.y"
+  case 295: /* function_expr: NOT operand  */
+#line 2350 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not";
@@ -6051,11 +6178,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6055 "parser.cpp"
+#line 6182 "parser.cpp"
     break;
 
-  case 291: /* function_expr: '-' operand  */
-#line 2269 "parser.y"
+  case 296: /* function_expr: '-' operand  */
+#line 2357 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6063,11 +6190,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6067 "parser.cpp"
+#line 6194 "parser.cpp"
     break;
 
-  case 292: /* function_expr: '+' operand  */
-#line 2276 "parser.y"
+  case 297: /* function_expr: '+' operand  */
+#line 2364 "parser.y"
               {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6075,11 +6202,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6079 "parser.cpp"
+#line 6206 "parser.cpp"
     break;
 
-  case 293: /* function_expr: operand '-' operand  */
-#line 2283 "parser.y"
+  case 298: /* function_expr: operand '-' operand  */
+#line 2371 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "-";
@@ -6088,11 +6215,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6092 "parser.cpp"
+#line 6219 "parser.cpp"
     break;
 
-  case 294: /* function_expr: operand '+' operand  */
-#line 2291 "parser.y"
+  case 299: /* function_expr: operand '+' operand  */
+#line 2379 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "+";
@@ -6101,11 +6228,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6105 "parser.cpp"
+#line 6232 "parser.cpp"
     break;
 
-  case 295: /* function_expr: operand '*' operand  */
-#line 2299 "parser.y"
+  case 300: /* function_expr: operand '*' operand  */
+#line 2387 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "*";
@@ -6114,11 +6241,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6118 "parser.cpp"
+#line 6245 "parser.cpp"
     break;
 
-  case 296: /* function_expr: operand '/' operand  */
-#line 2307 "parser.y"
+  case 301: /* function_expr: operand '/' operand  */
+#line 2395 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "/";
@@ -6127,11 +6254,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6131 "parser.cpp"
+#line 6258 "parser.cpp"
     break;
 
-  case 297: /* function_expr: operand '%' operand  */
-#line 2315 "parser.y"
+  case 302: /* function_expr: operand '%' operand  */
+#line 2403 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "%";
@@ -6140,11 +6267,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6144 "parser.cpp"
+#line 6271 "parser.cpp"
     break;
 
-  case 298: /* function_expr: operand '=' operand  */
-#line 2323 "parser.y"
+  case 303: /* function_expr: operand '=' operand  */
+#line 2411 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6153,11 +6280,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6157 "parser.cpp"
+#line 6284 "parser.cpp"
     break;
 
-  case 299: /* function_expr: operand EQUAL operand  */
-#line 2331 "parser.y"
+  case 304: /* function_expr: operand EQUAL operand  */
+#line 2419 "parser.y"
                         {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "=";
@@ -6166,11 +6293,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6170 "parser.cpp"
+#line 6297 "parser.cpp"
     break;
 
-  case 300: /* function_expr: operand NOT_EQ operand  */
-#line 2339 "parser.y"
+  case 305: /* function_expr: operand NOT_EQ operand  */
+#line 2427 "parser.y"
                          {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<>";
@@ -6179,11 +6306,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6183 "parser.cpp"
+#line 6310 "parser.cpp"
     break;
 
-  case 301: /* function_expr: operand '<' operand  */
-#line 2347 "parser.y"
+  case 306: /* function_expr: operand '<' operand  */
+#line 2435 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<";
@@ -6192,11 +6319,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6196 "parser.cpp"
+#line 6323 "parser.cpp"
     break;
 
-  case 302: /* function_expr: operand '>' operand  */
-#line 2355 "parser.y"
+  case 307: /* function_expr: operand '>' operand  */
+#line 2443 "parser.y"
                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">";
@@ -6205,11 +6332,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6209 "parser.cpp"
+#line 6336 "parser.cpp"
     break;
 
-  case 303: /* function_expr: operand LESS_EQ operand  */
-#line 2363 "parser.y"
+  case 308: /* function_expr: operand LESS_EQ operand  */
+#line 2451 "parser.y"
                           {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "<=";
@@ -6218,11 +6345,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6222 "parser.cpp"
+#line 6349 "parser.cpp"
     break;
 
-  case 304: /* function_expr: operand GREATER_EQ operand  */
-#line 2371 "parser.y"
+  case 309: /* function_expr: operand GREATER_EQ operand  */
+#line 2459 "parser.y"
                              {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = ">=";
@@ -6231,11 +6358,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6235 "parser.cpp"
+#line 6362 "parser.cpp"
     break;
 
-  case 305: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
-#line 2379 "parser.y"
+  case 310: /* function_expr: EXTRACT '(' STRING FROM operand ')'  */
+#line 2467 "parser.y"
                                       {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     ParserHelper::ToLower((yyvsp[-3].str_value));
@@ -6266,11 +6393,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[-1].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6270 "parser.cpp"
+#line 6397 "parser.cpp"
     break;
 
-  case 306: /* function_expr: operand LIKE operand  */
-#line 2409 "parser.y"
+  case 311: /* function_expr: operand LIKE operand  */
+#line 2497 "parser.y"
                        {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "like";
@@ -6279,11 +6406,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6283 "parser.cpp"
+#line 6410 "parser.cpp"
     break;
 
-  case 307: /* function_expr: operand NOT LIKE operand  */
-#line 2417 "parser.y"
+  case 312: /* function_expr: operand NOT LIKE operand  */
+#line 2505 "parser.y"
                            {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "not_like";
@@ -6292,11 +6419,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6296 "parser.cpp"
+#line 6423 "parser.cpp"
     break;
 
-  case 308: /* conjunction_expr: expr AND expr  */
-#line 2426 "parser.y"
+  case 313: /* conjunction_expr: expr AND expr  */
+#line 2514 "parser.y"
                                 {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "and";
@@ -6305,11 +6432,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6309 "parser.cpp"
+#line 6436 "parser.cpp"
     break;
 
-  case 309: /* conjunction_expr: expr OR expr  */
-#line 2434 "parser.y"
+  case 314: /* conjunction_expr: expr OR expr  */
+#line 2522 "parser.y"
                {
     infinity::FunctionExpr* func_expr = new infinity::FunctionExpr();
     func_expr->func_name_ = "or";
@@ -6318,11 +6445,11 @@ yyreduce:
     func_expr->arguments_->emplace_back((yyvsp[0].expr_t));
     (yyval.expr_t) = func_expr;
 }
-#line 6322 "parser.cpp"
+#line 6449 "parser.cpp"
     break;
 
-  case 310: /* between_expr: operand BETWEEN operand AND operand  */
-#line 2443 "parser.y"
+  case 315: /* between_expr: operand BETWEEN operand AND operand  */
+#line 2531 "parser.y"
                                                   {
     infinity::BetweenExpr* between_expr = new infinity::BetweenExpr();
     between_expr->value_ = (yyvsp[-4].expr_t);
@@ -6330,44 +6457,44 @@ yyreduce:
     between_expr->upper_bound_ = (yyvsp[0].expr_t);
     (yyval.expr_t) = between_expr;
 }
-#line 6334 "parser.cpp"
+#line 6461 "parser.cpp"
     break;
 
-  case 311: /* in_expr: operand IN '(' expr_array ')'  */
-#line 2451 "parser.y"
+  case 316: /* in_expr: operand IN '(' expr_array ')'  */
+#line 2539 "parser.y"
                                        {
     infinity::InExpr* in_expr = new infinity::InExpr(true);
     in_expr->left_ = (yyvsp[-4].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6345 "parser.cpp"
+#line 6472 "parser.cpp"
     break;
 
-  case 312: /* in_expr: operand NOT IN '(' expr_array ')'  */
-#line 2457 "parser.y"
+  case 317: /* in_expr: operand NOT IN '(' expr_array ')'  */
+#line 2545 "parser.y"
                                     {
     infinity::InExpr* in_expr = new infinity::InExpr(false);
     in_expr->left_ = (yyvsp[-5].expr_t);
     in_expr->arguments_ = (yyvsp[-1].expr_array_t);
     (yyval.expr_t) = in_expr;
 }
-#line 6356 "parser.cpp"
+#line 6483 "parser.cpp"
     break;
 
-  case 313: /* case_expr: CASE expr case_check_array END  */
-#line 2464 "parser.y"
+  case 318: /* case_expr: CASE expr case_check_array END  */
+#line 2552 "parser.y"
                                           {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-2].expr_t);
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6367 "parser.cpp"
+#line 6494 "parser.cpp"
     break;
 
-  case 314: /* case_expr: CASE expr case_check_array ELSE expr END  */
-#line 2470 "parser.y"
+  case 319: /* case_expr: CASE expr case_check_array ELSE expr END  */
+#line 2558 "parser.y"
                                            {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->expr_ = (yyvsp[-4].expr_t);
@@ -6375,32 +6502,32 @@ yyreduce:
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6379 "parser.cpp"
+#line 6506 "parser.cpp"
     break;
 
-  case 315: /* case_expr: CASE case_check_array END  */
-#line 2477 "parser.y"
+  case 320: /* case_expr: CASE case_check_array END  */
+#line 2565 "parser.y"
                             {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-1].case_check_array_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6389 "parser.cpp"
+#line 6516 "parser.cpp"
     break;
 
-  case 316: /* case_expr: CASE case_check_array ELSE expr END  */
-#line 2482 "parser.y"
+  case 321: /* case_expr: CASE case_check_array ELSE expr END  */
+#line 2570 "parser.y"
                                       {
     infinity::CaseExpr* case_expr = new infinity::CaseExpr();
     case_expr->case_check_array_ = (yyvsp[-3].case_check_array_t);
     case_expr->else_expr_ = (yyvsp[-1].expr_t);
     (yyval.expr_t) = case_expr;
 }
-#line 6400 "parser.cpp"
+#line 6527 "parser.cpp"
     break;
 
-  case 317: /* case_check_array: WHEN expr THEN expr  */
-#line 2489 "parser.y"
+  case 322: /* case_check_array: WHEN expr THEN expr  */
+#line 2577 "parser.y"
                                       {
     (yyval.case_check_array_t) = new std::vector<infinity::WhenThen*>();
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
@@ -6408,11 +6535,11 @@ yyreduce:
     when_then_ptr->then_ = (yyvsp[0].expr_t);
     (yyval.case_check_array_t)->emplace_back(when_then_ptr);
 }
-#line 6412 "parser.cpp"
+#line 6539 "parser.cpp"
     break;
 
-  case 318: /* case_check_array: case_check_array WHEN expr THEN expr  */
-#line 2496 "parser.y"
+  case 323: /* case_check_array: case_check_array WHEN expr THEN expr  */
+#line 2584 "parser.y"
                                        {
     infinity::WhenThen* when_then_ptr = new infinity::WhenThen();
     when_then_ptr->when_ = (yyvsp[-2].expr_t);
@@ -6420,11 +6547,11 @@ yyreduce:
     (yyvsp[-4].case_check_array_t)->emplace_back(when_then_ptr);
     (yyval.case_check_array_t) = (yyvsp[-4].case_check_array_t);
 }
-#line 6424 "parser.cpp"
+#line 6551 "parser.cpp"
     break;
 
-  case 319: /* cast_expr: CAST '(' expr AS column_type ')'  */
-#line 2504 "parser.y"
+  case 324: /* cast_expr: CAST '(' expr AS column_type ')'  */
+#line 2592 "parser.y"
                                             {
     std::shared_ptr<infinity::TypeInfo> type_info_ptr{nullptr};
     switch((yyvsp[-1].column_type_t).logical_type_) {
@@ -6448,33 +6575,33 @@ yyreduce:
     cast_expr->expr_ = (yyvsp[-3].expr_t);
     (yyval.expr_t) = cast_expr;
 }
-#line 6452 "parser.cpp"
+#line 6579 "parser.cpp"
     break;
 
-  case 320: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
-#line 2528 "parser.y"
+  case 325: /* subquery_expr: EXISTS '(' select_without_paren ')'  */
+#line 2616 "parser.y"
                                                    {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6463 "parser.cpp"
+#line 6590 "parser.cpp"
     break;
 
-  case 321: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
-#line 2534 "parser.y"
+  case 326: /* subquery_expr: NOT EXISTS '(' select_without_paren ')'  */
+#line 2622 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotExists;
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6474 "parser.cpp"
+#line 6601 "parser.cpp"
     break;
 
-  case 322: /* subquery_expr: operand IN '(' select_without_paren ')'  */
-#line 2540 "parser.y"
+  case 327: /* subquery_expr: operand IN '(' select_without_paren ')'  */
+#line 2628 "parser.y"
                                           {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kIn;
@@ -6482,11 +6609,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6486 "parser.cpp"
+#line 6613 "parser.cpp"
     break;
 
-  case 323: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
-#line 2547 "parser.y"
+  case 328: /* subquery_expr: operand NOT IN '(' select_without_paren ')'  */
+#line 2635 "parser.y"
                                               {
     infinity::SubqueryExpr* subquery_expr = new infinity::SubqueryExpr();
     subquery_expr->subquery_type_ = infinity::SubqueryType::kNotIn;
@@ -6494,11 +6621,11 @@ yyreduce:
     subquery_expr->select_ = (yyvsp[-1].select_stmt);
     (yyval.expr_t) = subquery_expr;
 }
-#line 6498 "parser.cpp"
+#line 6625 "parser.cpp"
     break;
 
-  case 324: /* column_expr: IDENTIFIER  */
-#line 2555 "parser.y"
+  case 329: /* column_expr: IDENTIFIER  */
+#line 2643 "parser.y"
                          {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6506,11 +6633,11 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6510 "parser.cpp"
+#line 6637 "parser.cpp"
     break;
 
-  case 325: /* column_expr: column_expr '.' IDENTIFIER  */
-#line 2562 "parser.y"
+  case 330: /* column_expr: column_expr '.' IDENTIFIER  */
+#line 2650 "parser.y"
                              {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     ParserHelper::ToLower((yyvsp[0].str_value));
@@ -6518,21 +6645,21 @@ yyreduce:
     free((yyvsp[0].str_value));
     (yyval.expr_t) = column_expr;
 }
-#line 6522 "parser.cpp"
+#line 6649 "parser.cpp"
     break;
 
-  case 326: /* column_expr: '*'  */
-#line 2569 "parser.y"
+  case 331: /* column_expr: '*'  */
+#line 2657 "parser.y"
       {
     infinity::ColumnExpr* column_expr = new infinity::ColumnExpr();
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6532 "parser.cpp"
+#line 6659 "parser.cpp"
     break;
 
-  case 327: /* column_expr: column_expr '.' '*'  */
-#line 2574 "parser.y"
+  case 332: /* column_expr: column_expr '.' '*'  */
+#line 2662 "parser.y"
                       {
     infinity::ColumnExpr* column_expr = (infinity::ColumnExpr*)(yyvsp[-2].expr_t);
     if(column_expr->star_) {
@@ -6542,388 +6669,396 @@ yyreduce:
     column_expr->star_ = true;
     (yyval.expr_t) = column_expr;
 }
-#line 6546 "parser.cpp"
+#line 6673 "parser.cpp"
     break;
 
-  case 328: /* constant_expr: STRING  */
-#line 2584 "parser.y"
+  case 333: /* parameter_expr: '?'  */
+#line 2672 "parser.y"
+                    {
+    (yyval.expr_t) = new infinity::ParameterExpr(result->parameter_count_++);
+}
+#line 6681 "parser.cpp"
+    break;
+
+  case 334: /* constant_expr: STRING  */
+#line 2676 "parser.y"
                       {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6556 "parser.cpp"
+#line 6691 "parser.cpp"
     break;
 
-  case 329: /* constant_expr: TRUE  */
-#line 2589 "parser.y"
+  case 335: /* constant_expr: TRUE  */
+#line 2681 "parser.y"
        {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = true;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6566 "parser.cpp"
+#line 6701 "parser.cpp"
     break;
 
-  case 330: /* constant_expr: FALSE  */
-#line 2594 "parser.y"
+  case 336: /* constant_expr: FALSE  */
+#line 2686 "parser.y"
         {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kBoolean);
     const_expr->bool_value_ = false;
     (yyval.const_expr_t) = const_expr;
 }
-#line 6576 "parser.cpp"
+#line 6711 "parser.cpp"
     break;
 
-  case 331: /* constant_expr: DOUBLE_VALUE  */
-#line 2599 "parser.y"
+  case 337: /* constant_expr: DOUBLE_VALUE  */
+#line 2691 "parser.y"
                {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDouble);
     const_expr->double_value_ = (yyvsp[0].double_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6586 "parser.cpp"
+#line 6721 "parser.cpp"
     break;
 
-  case 332: /* constant_expr: LONG_VALUE  */
-#line 2604 "parser.y"
+  case 338: /* constant_expr: LONG_VALUE  */
+#line 2696 "parser.y"
              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInteger);
     const_expr->integer_value_ = (yyvsp[0].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6596 "parser.cpp"
+#line 6731 "parser.cpp"
     break;
 
-  case 333: /* constant_expr: DATE STRING  */
-#line 2609 "parser.y"
+  case 339: /* constant_expr: DATE STRING  */
+#line 2701 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDate);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6606 "parser.cpp"
+#line 6741 "parser.cpp"
     break;
 
-  case 334: /* constant_expr: TIME STRING  */
-#line 2614 "parser.y"
+  case 340: /* constant_expr: TIME STRING  */
+#line 2706 "parser.y"
               {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6616 "parser.cpp"
+#line 6751 "parser.cpp"
     break;
 
-  case 335: /* constant_expr: DATETIME STRING  */
-#line 2619 "parser.y"
+  case 341: /* constant_expr: DATETIME STRING  */
+#line 2711 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDateTime);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6626 "parser.cpp"
+#line 6761 "parser.cpp"
     break;
 
-  case 336: /* constant_expr: TIMESTAMP STRING  */
-#line 2624 "parser.y"
+  case 342: /* constant_expr: TIMESTAMP STRING  */
+#line 2716 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kTimestamp);
     const_expr->date_value_ = (yyvsp[0].str_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6636 "parser.cpp"
+#line 6771 "parser.cpp"
     break;
 
-  case 337: /* constant_expr: INTERVAL interval_expr  */
-#line 2629 "parser.y"
+  case 343: /* constant_expr: INTERVAL interval_expr  */
+#line 2721 "parser.y"
                          {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6644 "parser.cpp"
+#line 6779 "parser.cpp"
     break;
 
-  case 338: /* constant_expr: interval_expr  */
-#line 2632 "parser.y"
+  case 344: /* constant_expr: interval_expr  */
+#line 2724 "parser.y"
                 {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6652 "parser.cpp"
+#line 6787 "parser.cpp"
     break;
 
-  case 339: /* constant_expr: common_array_expr  */
-#line 2635 "parser.y"
+  case 345: /* constant_expr: common_array_expr  */
+#line 2727 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6660 "parser.cpp"
+#line 6795 "parser.cpp"
     break;
 
-  case 340: /* common_array_expr: array_expr  */
-#line 2639 "parser.y"
+  case 346: /* common_array_expr: array_expr  */
+#line 2731 "parser.y"
                               {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6668 "parser.cpp"
+#line 6803 "parser.cpp"
     break;
 
-  case 341: /* common_array_expr: subarray_array_expr  */
-#line 2642 "parser.y"
+  case 347: /* common_array_expr: subarray_array_expr  */
+#line 2734 "parser.y"
                       {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6676 "parser.cpp"
+#line 6811 "parser.cpp"
     break;
 
-  case 342: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
-#line 2646 "parser.y"
+  case 348: /* subarray_array_expr: unclosed_subarray_array_expr ']'  */
+#line 2738 "parser.y"
                                                       {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6684 "parser.cpp"
+#line 6819 "parser.cpp"
     break;
 
-  case 343: /* unclosed_subarray_array_expr: '[' common_array_expr  */
-#line 2650 "parser.y"
+  case 349: /* unclosed_subarray_array_expr: '[' common_array_expr  */
+#line 2742 "parser.y"
                                                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kSubArrayArray);
     const_expr->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6694 "parser.cpp"
+#line 6829 "parser.cpp"
     break;
 
-  case 344: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
-#line 2655 "parser.y"
+  case 350: /* unclosed_subarray_array_expr: unclosed_subarray_array_expr ',' common_array_expr  */
+#line 2747 "parser.y"
                                                      {
     (yyvsp[-2].const_expr_t)->sub_array_array_.emplace_back((yyvsp[0].const_expr_t));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6703 "parser.cpp"
+#line 6838 "parser.cpp"
     break;
 
-  case 345: /* array_expr: long_array_expr  */
-#line 2660 "parser.y"
+  case 351: /* array_expr: long_array_expr  */
+#line 2752 "parser.y"
                             {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6711 "parser.cpp"
+#line 6846 "parser.cpp"
     break;
 
-  case 346: /* array_expr: double_array_expr  */
-#line 2663 "parser.y"
+  case 352: /* array_expr: double_array_expr  */
+#line 2755 "parser.y"
                     {
     (yyval.const_expr_t) = (yyvsp[0].const_expr_t);
 }
-#line 6719 "parser.cpp"
+#line 6854 "parser.cpp"
     break;
 
-  case 347: /* long_array_expr: unclosed_long_array_expr ']'  */
-#line 2667 "parser.y"
+  case 353: /* long_array_expr: unclosed_long_array_expr ']'  */
+#line 2759 "parser.y"
                                               {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6727 "parser.cpp"
+#line 6862 "parser.cpp"
     break;
 
-  case 348: /* unclosed_long_array_expr: '[' LONG_VALUE  */
-#line 2671 "parser.y"
+  case 354: /* unclosed_long_array_expr: '[' LONG_VALUE  */
+#line 2763 "parser.y"
                                          {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kIntegerArray);
     const_expr->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6737 "parser.cpp"
+#line 6872 "parser.cpp"
     break;
 
-  case 349: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
-#line 2676 "parser.y"
+  case 355: /* unclosed_long_array_expr: unclosed_long_array_expr ',' LONG_VALUE  */
+#line 2768 "parser.y"
                                           {
     (yyvsp[-2].const_expr_t)->long_array_.emplace_back((yyvsp[0].long_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6746 "parser.cpp"
+#line 6881 "parser.cpp"
     break;
 
-  case 350: /* double_array_expr: unclosed_double_array_expr ']'  */
-#line 2681 "parser.y"
+  case 356: /* double_array_expr: unclosed_double_array_expr ']'  */
+#line 2773 "parser.y"
                                                   {
     (yyval.const_expr_t) = (yyvsp[-1].const_expr_t);
 }
-#line 6754 "parser.cpp"
+#line 6889 "parser.cpp"
     break;
 
-  case 351: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
-#line 2685 "parser.y"
+  case 357: /* unclosed_double_array_expr: '[' DOUBLE_VALUE  */
+#line 2777 "parser.y"
                                              {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kDoubleArray);
     const_expr->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = const_expr;
 }
-#line 6764 "parser.cpp"
+#line 6899 "parser.cpp"
     break;
 
-  case 352: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
-#line 2690 "parser.y"
+  case 358: /* unclosed_double_array_expr: unclosed_double_array_expr ',' DOUBLE_VALUE  */
+#line 2782 "parser.y"
                                               {
     (yyvsp[-2].const_expr_t)->double_array_.emplace_back((yyvsp[0].double_value));
     (yyval.const_expr_t) = (yyvsp[-2].const_expr_t);
 }
-#line 6773 "parser.cpp"
+#line 6908 "parser.cpp"
     break;
 
-  case 353: /* interval_expr: LONG_VALUE SECONDS  */
-#line 2695 "parser.y"
+  case 359: /* interval_expr: LONG_VALUE SECONDS  */
+#line 2787 "parser.y"
                                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6784 "parser.cpp"
+#line 6919 "parser.cpp"
     break;
 
-  case 354: /* interval_expr: LONG_VALUE SECOND  */
-#line 2701 "parser.y"
+  case 360: /* interval_expr: LONG_VALUE SECOND  */
+#line 2793 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kSecond;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6795 "parser.cpp"
+#line 6930 "parser.cpp"
     break;
 
-  case 355: /* interval_expr: LONG_VALUE MINUTES  */
-#line 2707 "parser.y"
+  case 361: /* interval_expr: LONG_VALUE MINUTES  */
+#line 2799 "parser.y"
                      {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6806 "parser.cpp"
+#line 6941 "parser.cpp"
     break;
 
-  case 356: /* interval_expr: LONG_VALUE MINUTE  */
-#line 2713 "parser.y"
+  case 362: /* interval_expr: LONG_VALUE MINUTE  */
+#line 2805 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMinute;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6817 "parser.cpp"
+#line 6952 "parser.cpp"
     break;
 
-  case 357: /* interval_expr: LONG_VALUE HOURS  */
-#line 2719 "parser.y"
+  case 363: /* interval_expr: LONG_VALUE HOURS  */
+#line 2811 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6828 "parser.cpp"
+#line 6963 "parser.cpp"
     break;
 
-  case 358: /* interval_expr: LONG_VALUE HOUR  */
-#line 2725 "parser.y"
+  case 364: /* interval_expr: LONG_VALUE HOUR  */
+#line 2817 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kHour;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6839 "parser.cpp"
+#line 6974 "parser.cpp"
     break;
 
-  case 359: /* interval_expr: LONG_VALUE DAYS  */
-#line 2731 "parser.y"
+  case 365: /* interval_expr: LONG_VALUE DAYS  */
+#line 2823 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6850 "parser.cpp"
+#line 6985 "parser.cpp"
     break;
 
-  case 360: /* interval_expr: LONG_VALUE DAY  */
-#line 2737 "parser.y"
+  case 366: /* interval_expr: LONG_VALUE DAY  */
+#line 2829 "parser.y"
                  {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kDay;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6861 "parser.cpp"
+#line 6996 "parser.cpp"
     break;
 
-  case 361: /* interval_expr: LONG_VALUE MONTHS  */
-#line 2743 "parser.y"
+  case 367: /* interval_expr: LONG_VALUE MONTHS  */
+#line 2835 "parser.y"
                     {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6872 "parser.cpp"
+#line 7007 "parser.cpp"
     break;
 
-  case 362: /* interval_expr: LONG_VALUE MONTH  */
-#line 2749 "parser.y"
+  case 368: /* interval_expr: LONG_VALUE MONTH  */
+#line 2841 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kMonth;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6883 "parser.cpp"
+#line 7018 "parser.cpp"
     break;
 
-  case 363: /* interval_expr: LONG_VALUE YEARS  */
-#line 2755 "parser.y"
+  case 369: /* interval_expr: LONG_VALUE YEARS  */
+#line 2847 "parser.y"
                    {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6894 "parser.cpp"
+#line 7029 "parser.cpp"
     break;
 
-  case 364: /* interval_expr: LONG_VALUE YEAR  */
-#line 2761 "parser.y"
+  case 370: /* interval_expr: LONG_VALUE YEAR  */
+#line 2853 "parser.y"
                   {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kInterval);
     const_expr->interval_type_ = infinity::TimeUnit::kYear;
     const_expr->integer_value_ = (yyvsp[-1].long_value);
     (yyval.const_expr_t) = const_expr;
 }
-#line 6905 "parser.cpp"
+#line 7040 "parser.cpp"
     break;
 
-  case 365: /* copy_option_list: copy_option  */
-#line 2772 "parser.y"
+  case 371: /* copy_option_list: copy_option  */
+#line 2864 "parser.y"
                                {
     (yyval.copy_option_array) = new std::vector<infinity::CopyOption*>();
     (yyval.copy_option_array)->push_back((yyvsp[0].copy_option_t));
 }
-#line 6914 "parser.cpp"
+#line 7049 "parser.cpp"
     break;
 
-  case 366: /* copy_option_list: copy_option_list ',' copy_option  */
-#line 2776 "parser.y"
+  case 372: /* copy_option_list: copy_option_list ',' copy_option  */
+#line 2868 "parser.y"
                                    {
     (yyvsp[-2].copy_option_array)->push_back((yyvsp[0].copy_option_t));
     (yyval.copy_option_array) = (yyvsp[-2].copy_option_array);
 }
-#line 6923 "parser.cpp"
+#line 7058 "parser.cpp"
     break;
 
-  case 367: /* copy_option: FORMAT IDENTIFIER  */
-#line 2781 "parser.y"
+  case 373: /* copy_option: FORMAT IDENTIFIER  */
+#line 2873 "parser.y"
                                 {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kFormat;
@@ -6946,11 +7081,11 @@ yyreduce:
         YYERROR;
     }
 }
-#line 6950 "parser.cpp"
+#line 7085 "parser.cpp"
     break;
 
-  case 368: /* copy_option: DELIMITER STRING  */
-#line 2803 "parser.y"
+  case 374: /* copy_option: DELIMITER STRING  */
+#line 2895 "parser.y"
                    {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kDelimiter;
@@ -6961,53 +7096,53 @@ yyreduce:
     }
     free((yyvsp[0].str_value));
 }
-#line 6965 "parser.cpp"
+#line 7100 "parser.cpp"
     break;
 
-  case 369: /* copy_option: HEADER  */
-#line 2813 "parser.y"
+  case 375: /* copy_option: HEADER  */
+#line 2905 "parser.y"
          {
     (yyval.copy_option_t) = new infinity::CopyOption();
     (yyval.copy_option_t)->option_type_ = infinity::CopyOptionType::kHeader;
     (yyval.copy_option_t)->header_ = true;
 }
-#line 6975 "parser.cpp"
+#line 7110 "parser.cpp"
     break;
 
-  case 370: /* file_path: STRING  */
-#line 2819 "parser.y"
+  case 376: /* file_path: STRING  */
+#line 2911 "parser.y"
                    {
     (yyval.str_value) = (yyvsp[0].str_value);
 }
-#line 6983 "parser.cpp"
+#line 7118 "parser.cpp"
     break;
 
-  case 371: /* if_exists: IF EXISTS  */
-#line 2823 "parser.y"
+  case 377: /* if_exists: IF EXISTS  */
+#line 2915 "parser.y"
                      { (yyval.bool_value) = true; }
-#line 6989 "parser.cpp"
+#line 7124 "parser.cpp"
     break;
 
-  case 372: /* if_exists: %empty  */
-#line 2824 "parser.y"
+  case 378: /* if_exists: %empty  */
+#line 2916 "parser.y"
   { (yyval.bool_value) = false; }
-#line 6995 "parser.cpp"
+#line 7130 "parser.cpp"
     break;
 
-  case 373: /* if_not_exists: IF NOT EXISTS  */
-#line 2826 "parser.y"
+  case 379: /* if_not_exists: IF NOT EXISTS  */
+#line 2918 "parser.y"
                               { (yyval.bool_value) = true; }
-#line 7001 "parser.cpp"
+#line 7136 "parser.cpp"
     break;
 
-  case 374: /* if_not_exists: %empty  */
-#line 2827 "parser.y"
+  case 380: /* if_not_exists: %empty  */
+#line 2919 "parser.y"
   { (yyval.bool_value) = false; }
-#line 7007 "parser.cpp"
+#line 7142 "parser.cpp"
     break;
 
-  case 377: /* if_not_exists_info: if_not_exists IDENTIFIER  */
-#line 2842 "parser.y"
+  case 383: /* if_not_exists_info: if_not_exists IDENTIFIER  */
+#line 2934 "parser.y"
                                               {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
     (yyval.if_not_exists_info_t)->exists_ = true;
@@ -7016,79 +7151,79 @@ yyreduce:
     (yyval.if_not_exists_info_t)->info_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7020 "parser.cpp"
+#line 7155 "parser.cpp"
     break;
 
-  case 378: /* if_not_exists_info: %empty  */
-#line 2850 "parser.y"
+  case 384: /* if_not_exists_info: %empty  */
+#line 2942 "parser.y"
   {
     (yyval.if_not_exists_info_t) = new infinity::IfNotExistsInfo();
 }
-#line 7028 "parser.cpp"
+#line 7163 "parser.cpp"
     break;
 
-  case 379: /* with_index_param_list: WITH '(' index_param_list ')'  */
-#line 2854 "parser.y"
+  case 385: /* with_index_param_list: WITH '(' index_param_list ')'  */
+#line 2946 "parser.y"
                                                       {
     (yyval.with_index_param_list_t) = std::move((yyvsp[-1].index_param_list_t));
 }
-#line 7036 "parser.cpp"
+#line 7171 "parser.cpp"
     break;
 
-  case 380: /* with_index_param_list: %empty  */
-#line 2857 "parser.y"
+  case 386: /* with_index_param_list: %empty  */
+#line 2949 "parser.y"
   {
     (yyval.with_index_param_list_t) = new std::vector<infinity::InitParameter*>();
 }
-#line 7044 "parser.cpp"
+#line 7179 "parser.cpp"
     break;
 
-  case 381: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
-#line 2861 "parser.y"
+  case 387: /* optional_table_properties_list: PROPERTIES '(' index_param_list ')'  */
+#line 2953 "parser.y"
                                                                      {
     (yyval.with_index_param_list_t) = (yyvsp[-1].index_param_list_t);
 }
-#line 7052 "parser.cpp"
+#line 7187 "parser.cpp"
     break;
 
-  case 382: /* optional_table_properties_list: %empty  */
-#line 2864 "parser.y"
+  case 388: /* optional_table_properties_list: %empty  */
+#line 2956 "parser.y"
   {
     (yyval.with_index_param_list_t) = nullptr;
 }
-#line 7060 "parser.cpp"
+#line 7195 "parser.cpp"
     break;
 
-  case 383: /* index_param_list: index_param  */
-#line 2868 "parser.y"
+  case 389: /* index_param_list: index_param  */
+#line 2960 "parser.y"
                                {
     (yyval.index_param_list_t) = new std::vector<infinity::InitParameter*>();
     (yyval.index_param_list_t)->push_back((yyvsp[0].index_param_t));
 }
-#line 7069 "parser.cpp"
+#line 7204 "parser.cpp"
     break;
 
-  case 384: /* index_param_list: index_param_list ',' index_param  */
-#line 2872 "parser.y"
+  case 390: /* index_param_list: index_param_list ',' index_param  */
+#line 2964 "parser.y"
                                    {
     (yyvsp[-2].index_param_list_t)->push_back((yyvsp[0].index_param_t));
     (yyval.index_param_list_t) = (yyvsp[-2].index_param_list_t);
 }
-#line 7078 "parser.cpp"
+#line 7213 "parser.cpp"
     break;
 
-  case 385: /* index_param: IDENTIFIER  */
-#line 2877 "parser.y"
+  case 391: /* index_param: IDENTIFIER  */
+#line 2969 "parser.y"
                          {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7088 "parser.cpp"
+#line 7223 "parser.cpp"
     break;
 
-  case 386: /* index_param: IDENTIFIER '=' IDENTIFIER  */
-#line 2882 "parser.y"
+  case 392: /* index_param: IDENTIFIER '=' IDENTIFIER  */
+#line 2974 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7097,11 +7232,11 @@ yyreduce:
     (yyval.index_param_t)->param_value_ = (yyvsp[0].str_value);
     free((yyvsp[0].str_value));
 }
-#line 7101 "parser.cpp"
+#line 7236 "parser.cpp"
     break;
 
-  case 387: /* index_param: IDENTIFIER '=' LONG_VALUE  */
-#line 2890 "parser.y"
+  case 393: /* index_param: IDENTIFIER '=' LONG_VALUE  */
+#line 2982 "parser.y"
                             {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7109,11 +7244,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].long_value));
 }
-#line 7113 "parser.cpp"
+#line 7248 "parser.cpp"
     break;
 
-  case 388: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
-#line 2897 "parser.y"
+  case 394: /* index_param: IDENTIFIER '=' DOUBLE_VALUE  */
+#line 2989 "parser.y"
                               {
     (yyval.index_param_t) = new infinity::InitParameter();
     (yyval.index_param_t)->param_name_ = (yyvsp[-2].str_value);
@@ -7121,11 +7256,11 @@ yyreduce:
 
     (yyval.index_param_t)->param_value_ = std::to_string((yyvsp[0].double_value));
 }
-#line 7125 "parser.cpp"
+#line 7260 "parser.cpp"
     break;
 
-  case 389: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2908 "parser.y"
+  case 395: /* index_info_list: '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3000 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7135,6 +7270,8 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -7174,11 +7311,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7178 "parser.cpp"
+#line 7315 "parser.cpp"
     break;
 
-  case 390: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
-#line 2956 "parser.y"
+  case 396: /* index_info_list: index_info_list '(' identifier_array ')' USING IDENTIFIER with_index_param_list  */
+#line 3050 "parser.y"
                                                                                   {
     ParserHelper::ToLower((yyvsp[-1].str_value));
     infinity::IndexType index_type = infinity::IndexType::kInvalid;
@@ -7188,6 +7325,8 @@ yyreduce:
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp((yyvsp[-1].str_value), "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp((yyvsp[-1].str_value), "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
     } else {
         free((yyvsp[-1].str_value));
         delete (yyvsp[-4].identifier_array_t);
@@ -7228,11 +7367,11 @@ yyreduce:
     }
     delete (yyvsp[-4].identifier_array_t);
 }
-#line 7232 "parser.cpp"
+#line 7371 "parser.cpp"
     break;
 
-  case 391: /* index_info_list: '(' identifier_array ')'  */
-#line 3005 "parser.y"
+  case 397: /* index_info_list: '(' identifier_array ')'  */
+#line 3101 "parser.y"
                            {
     infinity::IndexType index_type = infinity::IndexType::kSecondary;
     size_t index_count = (yyvsp[-1].identifier_array_t)->size();
@@ -7246,11 +7385,11 @@ yyreduce:
     }
     delete (yyvsp[-1].identifier_array_t);
 }
-#line 7250 "parser.cpp"
+#line 7389 "parser.cpp"
     break;
 
 
-#line 7254 "parser.cpp"
+#line 7393 "parser.cpp"
 
       default: break;
     }
@@ -7479,7 +7618,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 3019 "parser.y"
+#line 3115 "parser.y"
 
 
 void
@@ -422,7 +422,7 @@ struct SQL_LTYPE {
 %type <expr_t>                  expr expr_alias column_expr function_expr subquery_expr match_vector_expr match_tensor_expr
 %type <expr_t>                  having_clause where_clause limit_expr offset_expr operand in_expr between_expr
 %type <expr_t>                  conjunction_expr cast_expr case_expr
-%type <expr_t>                  match_text_expr query_expr fusion_expr search_clause
+%type <expr_t>                  match_text_expr query_expr fusion_expr search_clause parameter_expr
 %type <const_expr_t>            constant_expr interval_expr default_expr
 %type <const_expr_t>            array_expr long_array_expr unclosed_long_array_expr double_array_expr unclosed_double_array_expr
 %type <const_expr_t>            common_array_expr subarray_array_expr unclosed_subarray_array_expr
@@ -779,6 +779,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | EMBEDDING '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | EMBEDDING '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | EMBEDDING '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| EMBEDDING '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // element types that have no keyword of their own
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType embedding_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "uint8") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemUInt8;
+    } else if (strcmp($3, "float16") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemFloat16;
+    }
+    free($3);
+    if (embedding_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, embedding_type};
+}
 | TENSOR '(' BIT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemBit}; }
 | TENSOR '(' TINYINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemInt8}; }
 | TENSOR '(' SMALLINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kTensor, $5, 0, 0, infinity::kElemInt16}; }
@@ -803,6 +819,22 @@ BOOLEAN { $$ = infinity::ColumnType{infinity::LogicalType::kBoolean, 0, 0, 0, in
 | VECTOR '(' BIGINT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemInt64}; }
 | VECTOR '(' FLOAT ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemFloat}; }
 | VECTOR '(' DOUBLE ',' LONG_VALUE ')' { $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, infinity::kElemDouble}; }
+| VECTOR '(' IDENTIFIER ',' LONG_VALUE ')' {
+    // element types that have no keyword of their own
+    ParserHelper::ToLower($3);
+    infinity::EmbeddingDataType embedding_type = infinity::EmbeddingDataType::kElemInvalid;
+    if (strcmp($3, "uint8") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemUInt8;
+    } else if (strcmp($3, "float16") == 0) {
+        embedding_type = infinity::EmbeddingDataType::kElemFloat16;
+    }
+    free($3);
+    if (embedding_type == infinity::EmbeddingDataType::kElemInvalid) {
+        yyerror(&yyloc, scanner, result, "Invalid embedding element type");
+        YYERROR;
+    }
+    $$ = infinity::ColumnType{infinity::LogicalType::kEmbedding, $5, 0, 0, embedding_type};
+}
 /*
 | DECIMAL opt_decimal_specification {
   $$ = infinity::ColumnType{DataType::DECIMAL, 0, $2->first, $2->second};
@@ -1556,6 +1588,10 @@ show_statement: SHOW DATABASES {
     $$->var_name_ = std::string($3);
     free($3);
 }
+| SHOW BUFFER {
+    $$ = new infinity::ShowStatement();
+    $$->show_type_ = infinity::ShowStmtType::kBuffer;
+}
 | SHOW PROFILES {
     $$ = new infinity::ShowStatement();
     $$->show_type_ = infinity::ShowStmtType::kProfiles;
@@ -1931,6 +1967,7 @@ operand: '(' expr ')' {
 | match_tensor_expr
 | query_expr
 | fusion_expr
+| parameter_expr
 
 extra_match_tensor_option : ',' STRING {
     $$ = $2;
@@ -1993,9 +2030,9 @@ match_vector_expr : MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING '
         YYERROR;
     }
 
-    // KNN data type
+    // KNN data type, a float query of a hamming search is binarized by the binder
     ParserHelper::ToLower($8);
-    if(strcmp($8, "float") == 0 and match_vector_expr->distance_type_ != infinity::KnnDistanceType::kHamming) {
+    if(strcmp($8, "float") == 0) {
         match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemFloat;
         if(!($6->double_array_.empty())) {
             match_vector_expr->dimension_ = $6->double_array_.size();
@@ -2128,6 +2165,57 @@ match_vector_expr : MATCH VECTOR '(' expr ',' array_expr ',' STRING ',' STRING '
     match_vector_expr->topn_ = $12;
     match_vector_expr->opt_params_ = $14;
 }
+| MATCH VECTOR '(' expr ',' '?' ',' STRING ',' STRING ',' LONG_VALUE ')' with_index_param_list {
+    // the query vector is a parameter, its embedding is built from the value of the parameter by the binder
+    infinity::KnnExpr* match_vector_expr = new infinity::KnnExpr();
+    $$ = match_vector_expr;
+    match_vector_expr->column_expr_ = $4;
+    match_vector_expr->query_parameter_index_ = result->parameter_count_++;
+    match_vector_expr->topn_ = $12;
+    match_vector_expr->opt_params_ = $14;
+
+    ParserHelper::ToLower($10);
+    if(strcmp($10, "l2") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kL2;
+    } else if(strcmp($10, "ip") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kInnerProduct;
+    } else if(strcmp($10, "cosine") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kCosine;
+    } else if(strcmp($10, "hamming") == 0) {
+        match_vector_expr->distance_type_ = infinity::KnnDistanceType::kHamming;
+    }
+
+    ParserHelper::ToLower($8);
+    bool hamming = match_vector_expr->distance_type_ == infinity::KnnDistanceType::kHamming;
+    if(strcmp($8, "float") == 0) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemFloat;
+    } else if(strcmp($8, "tinyint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt8;
+    } else if(strcmp($8, "smallint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt16;
+    } else if(strcmp($8, "integer") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt32;
+    } else if(strcmp($8, "bigint") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemInt64;
+    } else if(strcmp($8, "double") == 0 and !hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemDouble;
+    } else if(strcmp($8, "bit") == 0 and hamming) {
+        match_vector_expr->embedding_data_type_ = infinity::EmbeddingDataType::kElemBit;
+    }
+    free($8);
+    free($10);
+
+    if(match_vector_expr->distance_type_ == infinity::KnnDistanceType::kInvalid) {
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Invalid knn distance type");
+        YYERROR;
+    }
+    if(match_vector_expr->embedding_data_type_ == infinity::EmbeddingDataType::kElemInvalid) {
+        delete $$;
+        yyerror(&yyloc, scanner, result, "Invalid knn data type");
+        YYERROR;
+    }
+}
 
 match_text_expr : MATCH TEXT '(' STRING ',' STRING ')' {
     infinity::MatchExpr* match_text_expr = new infinity::MatchExpr();
@@ -2581,6 +2669,10 @@ column_expr : IDENTIFIER {
     $$ = column_expr;
 };
 
+parameter_expr: '?' {
+    $$ = new infinity::ParameterExpr(result->parameter_count_++);
+}
+
 constant_expr: STRING {
     infinity::ConstantExpr* const_expr = new infinity::ConstantExpr(infinity::LiteralType::kString);
     const_expr->str_value_ = $1;
@@ -2914,6 +3006,8 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($5, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($5, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
     } else {
         free($5);
         delete $2;
@@ -2962,6 +3056,8 @@ index_info_list : '(' identifier_array ')' USING IDENTIFIER with_index_param_lis
         index_type = infinity::IndexType::kHnsw;
     } else if (strcmp($6, "ivfflat") == 0) {
         index_type = infinity::IndexType::kIVFFlat;
+    } else if (strcmp($6, "ivfpq") == 0) {
+        index_type = infinity::IndexType::kIVFPQ;
     } else {
         free($6);
         delete $3;
@@ -41,12 +41,15 @@ public:
         error_message_.clear();
         error_line_ = 0;
         error_position_ = 0;
+        parameter_count_ = 0;
     }
 
     std::vector<BaseStatement *> *statements_ptr_;
     std::string error_message_;
     size_t error_line_;
     size_t error_position_;
+    // The number of `?` placeholders parsed so far, the index of the next one.
+    size_t parameter_count_{0};
 };
 
 } // namespace infinity
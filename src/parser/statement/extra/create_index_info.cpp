@@ -33,6 +33,9 @@ std::string IndexInfo::IndexTypeToString(IndexType index_type) {
         case IndexType::kSecondary: {
             return "SECONDARY";
         }
+        case IndexType::kIVFPQ: {
+            return "IVFPQ";
+        }
         case IndexType::kInvalid: {
             ParserError("Invalid conflict type.");
         }
@@ -49,6 +52,8 @@ IndexType IndexInfo::StringToIndexType(const std::string &index_type_str) {
         return IndexType::kFullText;
     } else if (index_type_str == "SECONDARY") {
         return IndexType::kSecondary;
+    } else if (index_type_str == "IVFPQ") {
+        return IndexType::kIVFPQ;
     } else {
         return IndexType::kInvalid;
     }
@@ -104,6 +104,10 @@ std::string ShowStatement::ToString() const {
             ss << "Show config";
             break;
         }
+        case ShowStmtType::kBuffer: {
+            ss << "Show buffer";
+            break;
+        }
     }
     return ss.str();
 }
@@ -41,6 +41,7 @@ enum class ShowStmtType {
     kGlobalVariable,
     kGlobalVariables,
     kConfig,
+    kBuffer,
 };
 
 class ShowStatement : public BaseStatement {
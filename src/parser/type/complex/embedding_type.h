@@ -15,6 +15,7 @@
 #pragma once
 
 #include "parser_assert.h"
+#include "type/number/float16.h"
 #include <bitset>
 #include <charconv>
 #include <cstdint>
@@ -23,7 +24,18 @@
 
 namespace infinity {
 
-enum EmbeddingDataType : int8_t { kElemBit, kElemInt8, kElemInt16, kElemInt32, kElemInt64, kElemFloat, kElemDouble, kElemInvalid };
+enum EmbeddingDataType : int8_t {
+    kElemBit,
+    kElemInt8,
+    kElemInt16,
+    kElemInt32,
+    kElemInt64,
+    kElemFloat,
+    kElemDouble,
+    kElemUInt8,
+    kElemFloat16,
+    kElemInvalid
+};
 
 template <typename T>
 inline EmbeddingDataType ToEmbeddingDataType() {
@@ -65,6 +77,16 @@ inline EmbeddingDataType ToEmbeddingDataType<double>() {
     return EmbeddingDataType::kElemDouble;
 }
 
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<uint8_t>() {
+    return EmbeddingDataType::kElemUInt8;
+}
+
+template <>
+inline EmbeddingDataType ToEmbeddingDataType<float16_t>() {
+    return EmbeddingDataType::kElemFloat16;
+}
+
 struct EmbeddingType {
 public:
     char *ptr{};
@@ -101,6 +123,10 @@ public:
                 return "FLOAT32";
             case kElemDouble:
                 return "FLOAT64";
+            case kElemUInt8:
+                return "UINT8";
+            case kElemFloat16:
+                return "FLOAT16";
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -124,6 +150,10 @@ public:
                 return Embedding2StringInternal<float>(embedding, dimension);
             case kElemDouble:
                 return Embedding2StringInternal<double>(embedding, dimension);
+            case kElemUInt8:
+                return Embedding2StringInternal<uint8_t>(embedding, dimension);
+            case kElemFloat16:
+                return Embedding2StringInternal<float16_t>(embedding, dimension);
             default: {
                 ParserError("Unexpected embedding type");
             }
@@ -135,10 +165,17 @@ private:
     template <typename T>
     static inline std::string Embedding2StringInternal(const EmbeddingType &embedding, size_t dimension) {
         std::stringstream ss;
-        for (size_t i = 0; i < dimension - 1; ++i) {
-            ss << ((T *)(embedding.ptr))[i] << ',';
+        for (size_t i = 0; i < dimension; ++i) {
+            if (i > 0) {
+                ss << ',';
+            }
+            // one byte elements are numbers, not characters
+            if constexpr (sizeof(T) == 1) {
+                ss << int(((T *)(embedding.ptr))[i]);
+            } else {
+                ss << ((T *)(embedding.ptr))[i];
+            }
         }
-        ss << ((T *)(embedding.ptr))[dimension - 1];
         return ss.str();
     }
 
@@ -384,6 +384,16 @@ std::string DataType::TypeToString<DoubleT>() {
     return "Double";
 }
 
+template <>
+std::string DataType::TypeToString<UInt8T>() {
+    return "UInt8";
+}
+
+template <>
+std::string DataType::TypeToString<Float16T>() {
+    return "Float16";
+}
+
 template <>
 std::string DataType::TypeToString<DecimalT>() {
     return "Decimal";
@@ -613,4 +623,24 @@ DoubleT DataType::StringToValue<DoubleT>(const std::string_view &str) {
 #endif
     return value;
 }
+
+template <>
+UInt8T DataType::StringToValue<UInt8T>(const std::string_view &str) {
+    if (str.empty()) {
+        return UInt8T{};
+    }
+    UInt8T value{};
+    auto res = std::from_chars(str.begin(), str.end(), value);
+    if(res.ptr != str.data() + str.size()) {
+        std::string error_message = fmt::format("Error: parse uint8: {} to {}", str, value);
+        std::cerr << error_message << std::endl;
+        ParserError(error_message);
+    }
+    return value;
+}
+
+template <>
+Float16T DataType::StringToValue<Float16T>(const std::string_view &str) {
+    return Float16T(StringToValue<FloatT>(str));
+}
 } // namespace infinity
@@ -222,6 +222,12 @@ std::string DataType::TypeToString<FloatT>();
 template <>
 std::string DataType::TypeToString<DoubleT>();
 
+template <>
+std::string DataType::TypeToString<UInt8T>();
+
+template <>
+std::string DataType::TypeToString<Float16T>();
+
 template <>
 std::string DataType::TypeToString<DecimalT>();
 
@@ -312,4 +318,10 @@ FloatT DataType::StringToValue<FloatT>(const std::string_view &str_view);
 
 template <>
 DoubleT DataType::StringToValue<DoubleT>(const std::string_view &str_view);
+
+template <>
+UInt8T DataType::StringToValue<UInt8T>(const std::string_view &str_view);
+
+template <>
+Float16T DataType::StringToValue<Float16T>(const std::string_view &str_view);
 } // namespace infinity
@@ -47,6 +47,10 @@ std::string EmbeddingInfo::EmbeddingDataTypeToString(EmbeddingDataType type) {
             return "float";
         case kElemDouble:
             return "double";
+        case kElemUInt8:
+            return "uint8";
+        case kElemFloat16:
+            return "float16";
         default:
             ParserError("Unexpected embedding type");
     }
@@ -31,6 +31,9 @@ export using infinity::HugeIntT;
 export using infinity::DoubleT;
 export using infinity::FloatT;
 
+export using infinity::UInt8T;
+export using infinity::Float16T;
+
 export using infinity::DecimalT;
 
 export using infinity::VarcharT;
@@ -52,6 +52,10 @@ using HugeIntT = HugeInt;
 using FloatT = float;
 using DoubleT = double;
 
+// Embedding element types without a column type of their own
+using UInt8T = uint8_t;
+using Float16T = float16_t;
+
 using DecimalT = DecimalType;
 
 // std::string
@@ -139,6 +139,8 @@ public:
     bool single_row = false;
 
     bool allow_distance = false;
+    // Set when the MATCH VECTOR is a batch of query vectors
+    bool allow_query_index = false;
     bool allow_score = false;
 
 public:
@@ -33,20 +33,24 @@ namespace {
 
 using namespace infinity;
 
-void ConvertAvgToSumDivideCount(FunctionExpr &func_expression, const Vector<String> &column_names) {
-    func_expression.func_name_ = "/";
-    func_expression.arguments_->clear();
+// A new sum / count expression of the column of avg, the parsed statement is not changed since it may be cached and bound again.
+UniquePtr<FunctionExpr> MakeSumDivideCount(const FunctionExpr &avg_expression, const Vector<String> &column_names) {
     auto createFunctionWithColumnArg = [&column_names](const String &func_name) {
         auto function_expression = MakeUnique<FunctionExpr>();
         function_expression->func_name_ = func_name;
         function_expression->arguments_ = new Vector<ParsedExpr *>();
         auto column_expr = MakeUnique<ColumnExpr>();
-        column_expr->names_.push_back(column_names[0]);
+        column_expr->names_ = column_names;
         function_expression->arguments_->push_back(column_expr.release());
         return function_expression.release();
     };
-    func_expression.arguments_->push_back(createFunctionWithColumnArg("sum"));
-    func_expression.arguments_->push_back(createFunctionWithColumnArg("count"));
+    auto func_expression = MakeUnique<FunctionExpr>();
+    func_expression->func_name_ = "/";
+    func_expression->alias_ = avg_expression.alias_;
+    func_expression->arguments_ = new Vector<ParsedExpr *>();
+    func_expression->arguments_->push_back(createFunctionWithColumnArg("sum"));
+    func_expression->arguments_->push_back(createFunctionWithColumnArg("count"));
+    return func_expression;
 }
 
 } // namespace
@@ -58,7 +62,7 @@ SharedPtr<BaseExpression> ProjectBinder::BuildExpression(const ParsedExpr &expr,
 
     // Covert avg function expr to (sum / count) function expr
     if (expr.type_ == ParsedExprType::kFunction) {
-        auto &function_expression = (FunctionExpr &)expr;
+        const auto &function_expression = (const FunctionExpr &)expr;
         auto special_function = TryBuildSpecialFuncExpr(function_expression, bind_context_ptr, depth);
         if (special_function.has_value()) {
             return ExpressionBinder::BuildExpression(expr, bind_context_ptr, depth, root);
@@ -67,11 +71,9 @@ SharedPtr<BaseExpression> ProjectBinder::BuildExpression(const ParsedExpr &expr,
 
         if (IsEqual(function_set_ptr->name(), String("AVG")) && function_expression.arguments_->size() == 1 &&
             (*function_expression.arguments_)[0]->type_ == ParsedExprType::kColumn) {
-            auto column_expr = (ColumnExpr *)(*function_expression.arguments_)[0];
-            Vector<String> column_names(std::move(column_expr->names_));
-            delete column_expr;
-            ConvertAvgToSumDivideCount(function_expression, column_names);
-            return ExpressionBinder::BuildExpression(expr, bind_context_ptr, depth, root);
+            const auto *column_expr = (const ColumnExpr *)(*function_expression.arguments_)[0];
+            UniquePtr<FunctionExpr> sum_divide_count = MakeSumDivideCount(function_expression, column_expr->names_);
+            return ExpressionBinder::BuildExpression(*sum_divide_count, bind_context_ptr, depth, root);
         }
     }
     // If the expr isn't from aggregate function and coming from group by lists.
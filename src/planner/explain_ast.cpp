@@ -580,6 +580,10 @@ void ExplainAST::BuildShow(const ShowStatement *show_statement, SharedPtr<Vector
             result->emplace_back(MakeShared<String>("SHOW CONFIG"));
             break;
         }
+        case ShowStmtType::kBuffer: {
+            result->emplace_back(MakeShared<String>("SHOW BUFFER"));
+            break;
+        }
     }
 }
 
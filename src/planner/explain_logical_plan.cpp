@@ -896,7 +896,9 @@ void ExplainLogicalPlan::Explain(const LogicalKnnScan *knn_scan_node, SharedPtr<
     // Query embedding
     String query_embedding = String(intent_size + 2, ' ');
     query_embedding += " - query embedding: ";
-    query_embedding += EmbeddingT::Embedding2String(knn_expr_raw->query_embedding_, knn_expr_raw->embedding_data_type_, knn_expr_raw->dimension_);
+    query_embedding += EmbeddingT::Embedding2String(knn_expr_raw->query_embedding_,
+                                                     knn_expr_raw->embedding_data_type_,
+                                                     knn_expr_raw->dimension_ * knn_expr_raw->query_count_);
     result->emplace_back(MakeShared<String>(query_embedding));
 
     // filter expression
@@ -1626,6 +1628,24 @@ void ExplainLogicalPlan::Explain(const LogicalShow *show_node, SharedPtr<Vector<
             result->emplace_back(MakeShared<String>(output_columns_str));
             break;
         }
+        case ShowType::kShowBuffer: {
+            String show_str;
+            if (intent_size != 0) {
+                show_str = String(intent_size - 2, ' ');
+                show_str += "-> SHOW BUFFER ";
+            } else {
+                show_str = "SHOW BUFFER ";
+            }
+            show_str += "(";
+            show_str += std::to_string(show_node->node_id());
+            show_str += ")";
+            result->emplace_back(MakeShared<String>(show_str));
+
+            String output_columns_str = String(intent_size, ' ');
+            output_columns_str += " - output columns: [type, hit, miss, eviction]";
+            result->emplace_back(MakeShared<String>(output_columns_str));
+            break;
+        }
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid show type");
         }
@@ -14,6 +14,9 @@
 
 module;
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 
 module expression_binder;
@@ -66,6 +69,7 @@ import column_expr;
 import case_expr;
 import in_expr;
 import knn_expr;
+import parameter_expr;
 import search_expr;
 import cast_expr;
 import between_expr;
@@ -105,6 +109,10 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildExpression(const ParsedExpr &ex
         case ParsedExprType::kConstant: {
             return BuildValueExpr((const ConstantExpr &)expr, bind_context_ptr, depth, root);
         }
+        case ParsedExprType::kParameter: {
+            const ConstantExpr *parameter_value = query_context_->GetParameterValue(((const ParameterExpr &)expr).parameter_index_);
+            return BuildValueExpr(*parameter_value, bind_context_ptr, depth, root);
+        }
         case ParsedExprType::kColumn: {
             return BuildColExpr((const ColumnExpr &)expr, bind_context_ptr, depth, root);
         }
@@ -533,6 +541,132 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildInExpr(const InExpr &expr, Bind
     return in_expression_ptr;
 }
 
+// Convert the query embedding to the element type of the searched column, so that the scan works on one element type.
+// Integral queries are exact on float columns, a float query on an int8 column must be integral and in range.
+template <typename To, typename From>
+void ConvertQueryEmbedding(To *dst, const From *src, i64 dimension) {
+    for (i64 i = 0; i < dimension; ++i) {
+        if constexpr (std::is_integral_v<To>) {
+            auto v = static_cast<f64>(src[i]);
+            if (v != std::trunc(v) || v < std::numeric_limits<To>::lowest() || v > std::numeric_limits<To>::max()) {
+                Status status = Status::SyntaxError(fmt::format("Query embedding element {} can't be converted to the column element type", v));
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+        }
+        if constexpr (std::is_same_v<To, Float16T>) {
+            dst[i] = Float16T(static_cast<f32>(src[i]));
+        } else {
+            dst[i] = static_cast<To>(src[i]);
+        }
+    }
+}
+
+template <typename To>
+ptr_t ConvertQueryEmbedding(const void *query_ptr, EmbeddingDataType query_type, i64 dimension, EmbeddingDataType column_type) {
+    auto converted_ptr = MakeUniqueForOverwrite<char[]>(EmbeddingT::EmbeddingSize(column_type, dimension));
+    auto *dst = reinterpret_cast<To *>(converted_ptr.get());
+    switch (query_type) {
+        case EmbeddingDataType::kElemInt8: {
+            ConvertQueryEmbedding(dst, static_cast<const i8 *>(query_ptr), dimension);
+            break;
+        }
+        case EmbeddingDataType::kElemInt16: {
+            ConvertQueryEmbedding(dst, static_cast<const i16 *>(query_ptr), dimension);
+            break;
+        }
+        case EmbeddingDataType::kElemInt32: {
+            ConvertQueryEmbedding(dst, static_cast<const i32 *>(query_ptr), dimension);
+            break;
+        }
+        case EmbeddingDataType::kElemInt64: {
+            ConvertQueryEmbedding(dst, static_cast<const i64 *>(query_ptr), dimension);
+            break;
+        }
+        case EmbeddingDataType::kElemFloat: {
+            ConvertQueryEmbedding(dst, static_cast<const f32 *>(query_ptr), dimension);
+            break;
+        }
+        case EmbeddingDataType::kElemDouble: {
+            ConvertQueryEmbedding(dst, static_cast<const f64 *>(query_ptr), dimension);
+            break;
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("Query embedding type {} doesn't match column embedding type {}",
+                                                           EmbeddingType::EmbeddingDataType2String(query_type),
+                                                           EmbeddingType::EmbeddingDataType2String(column_type)));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+    return converted_ptr.release();
+}
+
+// The query embedding of a MATCH VECTOR whose query vector is a parameter, in the element type named by the query, as the parser builds
+// the embedding of an array in the statement.
+UniquePtr<char[]> ParameterQueryEmbedding(const ConstantExpr &value, EmbeddingDataType query_type, i64 &dimension) {
+    const void *array_ptr = nullptr;
+    EmbeddingDataType array_type = EmbeddingDataType::kElemInvalid;
+    if (value.literal_type_ == LiteralType::kIntegerArray) {
+        array_ptr = value.long_array_.data();
+        array_type = EmbeddingDataType::kElemInt64;
+        dimension = value.long_array_.size();
+    } else if (value.literal_type_ == LiteralType::kDoubleArray) {
+        array_ptr = value.double_array_.data();
+        array_type = EmbeddingDataType::kElemDouble;
+        dimension = value.double_array_.size();
+    } else {
+        Status status = Status::SyntaxError(fmt::format("The query vector parameter {} isn't an array", value.ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
+    if (query_type == EmbeddingDataType::kElemBit) {
+        if (array_type != EmbeddingDataType::kElemInt64 || dimension % 8 != 0) {
+            Status status = Status::SyntaxError("The query vector of bit type should be 0 and 1 with a length aligned with 8");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        auto embedding = MakeUnique<char[]>(dimension / 8);
+        for (i64 i = 0; i < dimension; ++i) {
+            const i64 bit = value.long_array_[i];
+            if (bit != 0 && bit != 1) {
+                Status status = Status::SyntaxError("The query vector of bit type should be 0 and 1 with a length aligned with 8");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            embedding[i / 8] |= static_cast<char>(bit << (i % 8));
+        }
+        return embedding;
+    }
+    switch (query_type) {
+        case EmbeddingDataType::kElemInt8: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<i8>(array_ptr, array_type, dimension, query_type));
+        }
+        case EmbeddingDataType::kElemInt16: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<i16>(array_ptr, array_type, dimension, query_type));
+        }
+        case EmbeddingDataType::kElemInt32: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<i32>(array_ptr, array_type, dimension, query_type));
+        }
+        case EmbeddingDataType::kElemInt64: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<i64>(array_ptr, array_type, dimension, query_type));
+        }
+        case EmbeddingDataType::kElemFloat: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<f32>(array_ptr, array_type, dimension, query_type));
+        }
+        case EmbeddingDataType::kElemDouble: {
+            return UniquePtr<char[]>(ConvertQueryEmbedding<f64>(array_ptr, array_type, dimension, query_type));
+        }
+        default: {
+            Status status = Status::NotSupport(fmt::format("Query embedding type {}", EmbeddingType::EmbeddingDataType2String(query_type)));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+    return nullptr;
+}
+
 SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_knn_expr, BindContext *bind_context_ptr, i64 depth, bool) {
     // Bind KNN expression
     Vector<SharedPtr<BaseExpression>> arguments;
@@ -548,32 +682,123 @@ SharedPtr<BaseExpression> ExpressionBinder::BuildKnnExpr(const KnnExpr &parsed_k
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
+    // The query vector is in the statement, or is the value of a parameter
+    const void *query_data = parsed_knn_expr.embedding_data_ptr_;
+    i64 query_dimension = parsed_knn_expr.dimension_;
+    UniquePtr<char[]> parameter_embedding;
+    if (parsed_knn_expr.query_parameter_index_ >= 0) {
+        const ConstantExpr *parameter_value = query_context_->GetParameterValue(parsed_knn_expr.query_parameter_index_);
+        parameter_embedding = ParameterQueryEmbedding(*parameter_value, parsed_knn_expr.embedding_data_type_, query_dimension);
+        query_data = parameter_embedding.get();
+    }
+
     auto expr_ptr = BuildColExpr((ColumnExpr &)*parsed_knn_expr.column_expr_, bind_context_ptr, depth, false);
     TypeInfo *type_info = expr_ptr->Type().type_info().get();
+    EmbeddingDataType column_elem_type = parsed_knn_expr.embedding_data_type_;
+    i64 dimension = query_dimension;
+    i64 query_count = 1;
     if (type_info == nullptr or type_info->type() != TypeInfoType::kEmbedding) {
         Status status = Status::SyntaxError("Expect the column search is an embedding column");
         LOG_ERROR(status.message());
         RecoverableError(status);
     } else {
         EmbeddingInfo *embedding_info = (EmbeddingInfo *)type_info;
-        if ((i64)embedding_info->Dimension() != parsed_knn_expr.dimension_) {
+        column_elem_type = embedding_info->Type();
+        // A query embedding of several column dimensions is a batch of query vectors
+        dimension = embedding_info->Dimension();
+        if (query_dimension == 0 || query_dimension % dimension != 0) {
             Status status = Status::SyntaxError(fmt::format("Query embedding with dimension: {} which doesn't not matched with {}",
-                                                            parsed_knn_expr.dimension_,
+                                                            query_dimension,
                                                             embedding_info->Dimension()));
             LOG_ERROR(status.message());
             RecoverableError(status);
         }
+        query_count = query_dimension / dimension;
+    }
+    if (query_count > 1) {
+        if (!bind_context_ptr->allow_distance) {
+            Status status = Status::SyntaxError("A batch of query vectors is only allowed in a single MATCH VECTOR without fusion");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        bind_context_ptr->allow_query_index = true;
     }
 
     arguments.emplace_back(expr_ptr);
 
-    // Create query embedding
-    EmbeddingT query_embedding((ptr_t)parsed_knn_expr.embedding_data_ptr_, false);
+    // bit vectors are only compared by hamming distance, which is only defined on them
+    if ((column_elem_type == EmbeddingDataType::kElemBit) != (parsed_knn_expr.distance_type_ == KnnDistanceType::kHamming)) {
+        Status status = Status::NotSupport("Hamming distance is only supported on bit embedding columns");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+
+    // Create query embedding, converted to the element type of float, float16, int8 and uint8 columns
+    EmbeddingDataType query_elem_type = parsed_knn_expr.embedding_data_type_;
+    ptr_t query_ptr = (ptr_t)query_data;
+    bool new_allocated = false;
+    UniquePtr<f32[]> float_query_embedding;
+    if (column_elem_type == EmbeddingDataType::kElemBit && query_elem_type == EmbeddingDataType::kElemFloat) {
+        // A float query of a hamming search is binarized by sign for the hamming stage, the float rerank compares the candidates with it
+        float_query_embedding = MakeUniqueForOverwrite<f32[]>(query_dimension);
+        std::copy_n(static_cast<const f32 *>(query_data), query_dimension, float_query_embedding.get());
+        const i64 query_bytes = (dimension + 7) / 8;
+        auto query_bits = MakeUnique<char[]>(query_count * query_bytes);
+        for (i64 query_idx = 0; query_idx < query_count; ++query_idx) {
+            auto *bits = reinterpret_cast<u8 *>(query_bits.get()) + query_idx * query_bytes;
+            const f32 *query = float_query_embedding.get() + query_idx * dimension;
+            for (i64 i = 0; i < dimension; ++i) {
+                bits[i / 8] |= static_cast<u8>(query[i] > 0) << (i % 8);
+            }
+        }
+        query_ptr = query_bits.release();
+        query_elem_type = EmbeddingDataType::kElemBit;
+        new_allocated = true;
+    }
+    if (query_elem_type != column_elem_type) {
+        switch (column_elem_type) {
+            case EmbeddingDataType::kElemFloat: {
+                query_ptr = ConvertQueryEmbedding<f32>(query_data, query_elem_type, query_dimension, column_elem_type);
+                query_elem_type = column_elem_type;
+                new_allocated = true;
+                break;
+            }
+            case EmbeddingDataType::kElemInt8: {
+                query_ptr = ConvertQueryEmbedding<i8>(query_data, query_elem_type, query_dimension, column_elem_type);
+                query_elem_type = column_elem_type;
+                new_allocated = true;
+                break;
+            }
+            case EmbeddingDataType::kElemUInt8: {
+                query_ptr = ConvertQueryEmbedding<u8>(query_data, query_elem_type, query_dimension, column_elem_type);
+                query_elem_type = column_elem_type;
+                new_allocated = true;
+                break;
+            }
+            case EmbeddingDataType::kElemFloat16: {
+                query_ptr = ConvertQueryEmbedding<Float16T>(query_data, query_elem_type, query_dimension, column_elem_type);
+                query_elem_type = column_elem_type;
+                new_allocated = true;
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+    if (!new_allocated && parameter_embedding.get() != nullptr) {
+        // the bound expression keeps the embedding of the parameter
+        query_ptr = parameter_embedding.release();
+        new_allocated = true;
+    }
+    EmbeddingT query_embedding(std::move(query_ptr), new_allocated);
 
-    SharedPtr<KnnExpression> bound_knn_expr = MakeShared<KnnExpression>(parsed_knn_expr.embedding_data_type_,
-                                                                        parsed_knn_expr.dimension_,
+    SharedPtr<KnnExpression> bound_knn_expr = MakeShared<KnnExpression>(query_elem_type,
+                                                                        dimension,
+                                                                        query_count,
                                                                         parsed_knn_expr.distance_type_,
                                                                         std::move(query_embedding),
+                                                                        std::move(float_query_embedding),
                                                                         arguments,
                                                                         parsed_knn_expr.topn_,
                                                                         parsed_knn_expr.opt_params_);
@@ -912,6 +1137,14 @@ Optional<SharedPtr<BaseExpression>> ExpressionBinder::TryBuildSpecialFuncExpr(co
                 }
                 break;
             }
+            case SpecialType::kQueryIndex: {
+                if (!bind_context_ptr->allow_query_index) {
+                    Status status = Status::SyntaxError("QUERY_INDEX() requires MATCH VECTOR with a batch of query vectors");
+                    LOG_ERROR(status.message());
+                    RecoverableError(status);
+                }
+                break;
+            }
             default: {
                 break;
             }
@@ -68,6 +68,7 @@ import status;
 import default_values;
 import index_base;
 import index_ivfflat;
+import index_ivfpq;
 import index_hnsw;
 import index_secondary;
 import index_full_text;
@@ -673,12 +674,12 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
         }
         case IndexType::kHnsw: {
             assert(index_info->index_param_list_ != nullptr);
-            // The following check might affect performance
-            IndexHnsw::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
             base_index_ptr = IndexHnsw::Make(index_name,
                                              fmt::format("{}_{}", create_index_info->table_name_, *index_name),
                                              {index_info->column_name_},
                                              *(index_info->index_param_list_));
+            // The following check might affect performance
+            static_cast<IndexHnsw *>(base_index_ptr.get())->ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
             break;
         }
         case IndexType::kIVFFlat: {
@@ -690,6 +691,15 @@ Status LogicalPlanner::BuildCreateIndex(const CreateStatement *statement, Shared
                                                 *(index_info->index_param_list_));
             break;
         }
+        case IndexType::kIVFPQ: {
+            assert(index_info->index_param_list_ != nullptr);
+            base_index_ptr = IndexIVFPQ::Make(index_name,
+                                              fmt::format("{}_{}", create_index_info->table_name_, *index_name),
+                                              {index_info->column_name_},
+                                              *(index_info->index_param_list_));
+            static_cast<IndexIVFPQ *>(base_index_ptr.get())->ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
+            break;
+        }
         case IndexType::kSecondary: {
             IndexSecondary::ValidateColumnDataType(base_table_ref, index_info->column_name_); // may throw exception
             base_index_ptr =
@@ -1056,6 +1066,9 @@ Status LogicalPlanner::BuildShow(ShowStatement *statement, SharedPtr<BindContext
         case ShowStmtType::kConfig: {
             return BuildShowConfig(statement, bind_context_ptr);
         }
+        case ShowStmtType::kBuffer: {
+            return BuildShowBuffer(statement, bind_context_ptr);
+        }
         default: {
             UnrecoverableError("Unexpected show statement type.");
         }
@@ -1292,6 +1305,17 @@ Status LogicalPlanner::BuildShowConfig(const ShowStatement *statement, SharedPtr
     return Status::OK();
 }
 
+Status LogicalPlanner::BuildShowBuffer(const ShowStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    SharedPtr<LogicalNode> logical_show = MakeShared<LogicalShow>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                                  ShowType::kShowBuffer,
+                                                                  statement->schema_name_,
+                                                                  statement->table_name_,
+                                                                  bind_context_ptr->GenerateTableIndex());
+
+    this->logical_plan_ = logical_show;
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildFlush(const FlushStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     switch (statement->type()) {
         case FlushType::kData: {
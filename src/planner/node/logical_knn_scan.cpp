@@ -37,10 +37,13 @@ LogicalKnnScan::LogicalKnnScan(u64 node_id, SharedPtr<BaseTableRef> base_table_r
 Vector<ColumnBinding> LogicalKnnScan::GetColumnBindings() const {
     Vector<ColumnBinding> result;
     SizeT column_count = base_table_ref_->column_ids_.size();
-    result.reserve(column_count + 1);
+    result.reserve(column_count + 2);
     for (SizeT i = 0; i < column_count; ++i) {
         result.emplace_back(base_table_ref_->table_index_, base_table_ref_->column_ids_[i]);
     }
+    if (knn_expression_->query_count_ > 1) {
+        result.emplace_back(knn_table_index_, 1);
+    }
     result.emplace_back(knn_table_index_, 0);
     return result;
 }
@@ -53,6 +56,9 @@ SharedPtr<Vector<String>> LogicalKnnScan::GetOutputNames() const {
         const auto &column_name = base_table_ref_->column_names_->at(col_idx);
         result_names->emplace_back(column_name);
     }
+    if (knn_expression_->query_count_ > 1) {
+        result_names->emplace_back(COLUMN_NAME_QUERY_INDEX);
+    }
     result_names->emplace_back(knn_expression_->Name());
     result_names->emplace_back(COLUMN_NAME_ROW_ID);
     return result_names;
@@ -60,7 +66,11 @@ SharedPtr<Vector<String>> LogicalKnnScan::GetOutputNames() const {
 
 SharedPtr<Vector<SharedPtr<DataType>>> LogicalKnnScan::GetOutputTypes() const {
     Vector<SharedPtr<DataType>> result_types = *base_table_ref_->column_types_;
-    result_types.reserve(result_types.size() + 2);
+    result_types.reserve(result_types.size() + 3);
+    if (knn_expression_->query_count_ > 1) {
+        // the index of the query in the batch
+        result_types.emplace_back(MakeShared<DataType>(LogicalType::kInteger));
+    }
     result_types.emplace_back(MakeShared<DataType>(knn_expression_->Type()));
     result_types.emplace_back(MakeShared<DataType>(LogicalType::kRowID));
     return MakeShared<Vector<SharedPtr<DataType>>>(result_types);
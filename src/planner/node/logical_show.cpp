@@ -68,6 +68,8 @@ String ToString(ShowType type) {
             return "Show global variables";
         case ShowType::kShowConfig:
             return "Show config";
+        case ShowType::kShowBuffer:
+            return "Show buffer";
         case ShowType::kInvalid: {
             UnrecoverableError("Invalid chunk scan type");
         }
@@ -47,6 +47,7 @@ export enum class ShowType {
     kShowGlobalVariable,
     kShowGlobalVariables,
     kShowConfig,
+    kShowBuffer,
 };
 
 export String ToString(ShowType type);
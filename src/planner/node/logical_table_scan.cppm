@@ -24,6 +24,7 @@ import table_entry;
 import internal_types;
 import data_type;
 import fast_rough_filter;
+import column_encoding;
 
 export module logical_table_scan;
 
@@ -53,6 +54,9 @@ public:
 
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_;
 
+    // evaluated on the encoded column files to skip rows before the filter
+    Vector<EncodedColumnFilter> encoded_column_filters_;
+
     bool add_row_id_;
 };
 
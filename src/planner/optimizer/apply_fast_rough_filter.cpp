@@ -49,6 +49,7 @@ public:
             } else if (op->left_node()->operator_type() == LogicalNodeType::kTableScan) {
                 auto &table_scan = static_cast<LogicalTableScan &>(*(op->left_node()));
                 table_scan.fast_rough_filter_evaluator_ = FilterExpressionPushDown::PushDownToFastRoughFilter(filter_expression);
+                table_scan.encoded_column_filters_ = FilterExpressionPushDown::PushDownToEncodedColumnFilter(filter_expression);
             } else if (op->left_node()->operator_type() == LogicalNodeType::kIndexScan) {
                 // warn
                 LOG_WARN("ApplyFastRoughFilterMethod: IndexScan exist after Filter. A part of filter condition has been removed.");
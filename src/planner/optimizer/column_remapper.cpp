@@ -87,6 +87,14 @@ SharedPtr<BaseExpression> BindingRemapper::VisitReplace(const SharedPtr<ColumnEx
                                                  expression->alias_,
                                                  column_cnt_ - 2);
             }
+            case SpecialType::kQueryIndex: {
+                // only a batched knn scan outputs it, before the distance
+                return ReferenceExpression::Make(expression->Type(),
+                                                 expression->table_name(),
+                                                 expression->column_name(),
+                                                 expression->alias_,
+                                                 column_cnt_ - 3);
+            }
             default: {
                 LOG_ERROR(fmt::format("Unknown special function: {}", expression->Name()));
             }
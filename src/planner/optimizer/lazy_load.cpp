@@ -33,6 +33,22 @@ import load_meta;
 
 namespace infinity {
 
+bool PlanHasJoin(const LogicalNode &op) {
+    switch (op.operator_type()) {
+        case LogicalNodeType::kJoin:
+        case LogicalNodeType::kCrossProduct: {
+            return true;
+        }
+        default: {
+            break;
+        }
+    }
+    if (op.left_node().get() != nullptr && PlanHasJoin(*op.left_node())) {
+        return true;
+    }
+    return op.right_node().get() != nullptr && PlanHasJoin(*op.right_node());
+}
+
 Optional<BaseTableRef *> GetScanTableRef(LogicalNode &op) {
     switch (op.operator_type()) {
         case LogicalNodeType::kTableScan: {
@@ -57,6 +57,9 @@ private:
     Vector<SizeT> scan_table_indexes_{};
 };
 
+// The rows of a join mix the row ids of its inputs, there is no single table to load the columns from.
+bool PlanHasJoin(const LogicalNode &op);
+
 export class LazyLoad : public OptimizerRule {
 public:
     inline void ApplyToPlan(QueryContext *query_context_ptr, SharedPtr<LogicalNode> &logical_plan) final {
@@ -78,6 +81,9 @@ public:
             case LogicalNodeType::kPrepare:
                 return;
             default:
+                if (PlanHasJoin(*logical_plan)) {
+                    return;
+                }
                 collector.VisitNode(*logical_plan);
                 cleaner_.VisitNode(*logical_plan);
         }
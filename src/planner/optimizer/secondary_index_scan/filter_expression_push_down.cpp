@@ -46,6 +46,7 @@ import value;
 import column_vector;
 import filter_expression_push_down_helper;
 import table_index_meta;
+import column_encoding;
 
 namespace infinity {
 
@@ -787,4 +788,91 @@ UniquePtr<FastRoughFilterEvaluator> FilterExpressionPushDown::PushDownToFastRoug
     return FastRoughFilterExpressionPushDownMethod::SolveForFastRoughFilter(expression);
 }
 
+class EncodedColumnFilterPushDownMethod {
+public:
+    // collect "[cast] x compare (=, <, >, <=, >=) value_expr" on integer columns from the "and" expressions,
+    // the other expressions are only evaluated by the filter
+    static inline void SolveForEncodedColumnFilter(SharedPtr<BaseExpression> &expression, Vector<EncodedColumnFilter> &filters, u32 sub_expr_depth = 0) {
+        if (!expression || expression->type() != ExpressionType::kFunction) {
+            return;
+        }
+        static constexpr std::array<const char *, 5> FunctionNames = {"=", "<", ">", "<=", ">="};
+        static constexpr std::array<FilterCompareType, 5> CompareTypes = {FilterCompareType::kEqual,
+                                                                          FilterCompareType::kLess,
+                                                                          FilterCompareType::kGreater,
+                                                                          FilterCompareType::kLessEqual,
+                                                                          FilterCompareType::kGreaterEqual};
+        static constexpr std::array<FilterCompareType, 5> ReverseCompareTypes = {FilterCompareType::kEqual,
+                                                                                 FilterCompareType::kGreater,
+                                                                                 FilterCompareType::kLess,
+                                                                                 FilterCompareType::kGreaterEqual,
+                                                                                 FilterCompareType::kLessEqual};
+        auto function_expression = std::static_pointer_cast<FunctionExpression>(expression);
+        auto const &f_name = function_expression->ScalarFunctionName();
+        if (f_name == "AND") {
+            SolveForEncodedColumnFilter(expression->arguments()[0], filters, sub_expr_depth + 1);
+            SolveForEncodedColumnFilter(expression->arguments()[1], filters, sub_expr_depth + 1);
+            return;
+        }
+        auto it = std::find(FunctionNames.begin(), FunctionNames.end(), f_name);
+        if (it == FunctionNames.end()) {
+            return;
+        }
+        auto is_valid_column = [](const SharedPtr<BaseExpression> &expr, u32) -> bool { return expr->Type().SupportMinMaxFilter(); };
+        SizeT function_idx = std::distance(FunctionNames.begin(), it);
+        if (FilterExpressionPushDownMethodBase::HaveLeftColumnAndRightValue(function_expression, sub_expr_depth + 1, is_valid_column)) {
+            AddFilter(expression->arguments()[0], expression->arguments()[1], CompareTypes[function_idx], filters);
+        } else if (FilterExpressionPushDownMethodBase::HaveRightColumnAndLeftValue(function_expression, sub_expr_depth + 1, is_valid_column)) {
+            AddFilter(expression->arguments()[1], expression->arguments()[0], ReverseCompareTypes[function_idx], filters);
+        }
+    }
+
+private:
+    static inline void AddFilter(SharedPtr<BaseExpression> &col_expr,
+                                 SharedPtr<BaseExpression> &val_expr,
+                                 FilterCompareType initial_compare_type,
+                                 Vector<EncodedColumnFilter> &filters) {
+        auto val_right = FilterExpressionPushDownHelper::CalcValueResult(val_expr);
+        auto [column_id, value, compare_type] = FilterExpressionPushDownHelper::UnwindCast(col_expr, std::move(val_right), initial_compare_type);
+        if (compare_type != FilterCompareType::kEqual && compare_type != FilterCompareType::kLessEqual &&
+            compare_type != FilterCompareType::kGreaterEqual) {
+            return;
+        }
+        // the value has the type of the column after the cast is unwound
+        i64 integer_value = 0;
+        switch (value.type().type()) {
+            case kTinyInt: {
+                integer_value = value.GetValue<TinyIntT>();
+                break;
+            }
+            case kSmallInt: {
+                integer_value = value.GetValue<SmallIntT>();
+                break;
+            }
+            case kInteger: {
+                integer_value = value.GetValue<IntegerT>();
+                break;
+            }
+            case kBigInt: {
+                integer_value = value.GetValue<BigIntT>();
+                break;
+            }
+            case kDate: {
+                integer_value = value.GetValue<DateT>().value;
+                break;
+            }
+            default: {
+                return;
+            }
+        }
+        filters.push_back({column_id, compare_type, integer_value});
+    }
+};
+
+Vector<EncodedColumnFilter> FilterExpressionPushDown::PushDownToEncodedColumnFilter(SharedPtr<BaseExpression> &expression) {
+    Vector<EncodedColumnFilter> filters;
+    EncodedColumnFilterPushDownMethod::SolveForEncodedColumnFilter(expression, filters);
+    return filters;
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -24,6 +24,7 @@ import index_base;
 import table_index_entry;
 import secondary_index_scan_execute_expression;
 import fast_rough_filter;
+import column_encoding;
 
 namespace infinity {
 
@@ -50,6 +51,9 @@ public:
     PushDownToIndexScan(QueryContext *query_context, const BaseTableRef &base_table_ref, const SharedPtr<BaseExpression> &expression);
 
     static UniquePtr<FastRoughFilterEvaluator> PushDownToFastRoughFilter(SharedPtr<BaseExpression> &expression);
+
+    // The comparisons of integer columns with constants in the top level conjunction, for encoded column files.
+    static Vector<EncodedColumnFilter> PushDownToEncodedColumnFilter(SharedPtr<BaseExpression> &expression);
 };
 
 } // namespace infinity
\ No newline at end of file
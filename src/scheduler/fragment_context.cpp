@@ -34,6 +34,7 @@ import physical_table_scan;
 import physical_index_scan;
 import physical_knn_scan;
 import physical_aggregate;
+import aggregate_hash_table;
 import physical_explain;
 import physical_create_index_prepare;
 import physical_create_index_do;
@@ -41,10 +42,15 @@ import physical_sort;
 import physical_top;
 import physical_merge_top;
 import physical_match_tensor_scan;
+import physical_match;
 import physical_compact;
 import physical_compact_index_prepare;
 import physical_compact_index_do;
 import physical_compact_finish;
+import physical_hash;
+import physical_hash_join;
+import physical_parallel_aggregate;
+import join_hash_table;
 
 import global_block_id;
 import knn_expression;
@@ -52,6 +58,7 @@ import value_expression;
 import column_expression;
 import third_party;
 import query_context;
+import config;
 import physical_source;
 import physical_sink;
 import data_table;
@@ -120,6 +127,16 @@ UniquePtr<OperatorState> MakeMergeMatchTensorState(PhysicalOperator *physical_op
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeMatchState(PhysicalMatch *physical_match, FragmentTask *task, FragmentContext *fragment_ctx) {
+    auto operator_state = MakeUnique<MatchOperatorState>();
+    if (SizeT task_count = fragment_ctx->Tasks().size(); task_count > 1) {
+        // Each task searches the postings of its segments.
+        Vector<UniquePtr<Vector<SegmentID>>> segment_ids = physical_match->PlanSegments(task_count);
+        operator_state->segment_ids_ = std::move(segment_ids[task->TaskID()]);
+    }
+    return operator_state;
+}
+
 UniquePtr<OperatorState> MakeIndexScanState(PhysicalIndexScan *physical_index_scan, FragmentTask *task) {
     SourceState *source_state = task->source_state_.get();
     if (source_state->state_type_ != SourceStateType::kIndexScan) {
@@ -214,15 +231,18 @@ UniquePtr<OperatorState> MakeAggregateState(PhysicalAggregate *physical_aggregat
         auto agg_expr = std::static_pointer_cast<AggregateExpression>(expr);
         states.push_back(agg_expr->aggregate_function_.InitState());
     }
-    return MakeUnique<AggregateOperatorState>(std::move(states));
+    auto operator_state = MakeUnique<AggregateOperatorState>(std::move(states));
+    if (!physical_aggregate->groups_.empty()) {
+        operator_state->hash_table_ = physical_aggregate->MakeHashTable();
+    }
+    return operator_state;
 }
 
 UniquePtr<OperatorState> MakeMergeKnnState(PhysicalMergeKnn *physical_merge_knn, FragmentTask *task) {
     KnnExpression *knn_expr = physical_merge_knn->knn_expression_.get();
     UniquePtr<OperatorState> operator_state = MakeUnique<MergeKnnOperatorState>();
     MergeKnnOperatorState *merge_knn_op_state_ptr = (MergeKnnOperatorState *)(operator_state.get());
-    // Set fake parallel number here. It will be set in SetMergeKnnState
-    merge_knn_op_state_ptr->merge_knn_function_data_ = MakeShared<MergeKnnFunctionData>(1,
+    merge_knn_op_state_ptr->merge_knn_function_data_ = MakeShared<MergeKnnFunctionData>(knn_expr->query_count_,
                                                                                         knn_expr->topn_,
                                                                                         knn_expr->embedding_data_type_,
                                                                                         knn_expr->distance_type_,
@@ -264,6 +284,49 @@ UniquePtr<OperatorState> MakeMergeTopState(PhysicalOperator *physical_op) {
     return operator_state;
 }
 
+UniquePtr<OperatorState> MakeHashState(PhysicalHash *physical_hash) {
+    auto operator_state = MakeUnique<HashOperatorState>();
+    for (auto &expr : physical_hash->hash_keys()) {
+        operator_state->key_states_.emplace_back(ExpressionState::CreateState(expr));
+    }
+    return operator_state;
+}
+
+UniquePtr<OperatorState> MakeMergeHashState(FragmentTask *task, FragmentContext *fragment_ctx) {
+    // Each task builds a contiguous range of partitions.
+    SizeT task_count = fragment_ctx->Tasks().size();
+    SizeT task_id = task->TaskID();
+    SizeT partition_begin = JoinHashTable::PARTITION_COUNT * task_id / task_count;
+    SizeT partition_end = JoinHashTable::PARTITION_COUNT * (task_id + 1) / task_count;
+    return MakeUnique<MergeHashOperatorState>(partition_begin, partition_end);
+}
+
+UniquePtr<OperatorState> MakeParallelAggregateState(PhysicalParallelAggregate *physical_parallel_aggregate) {
+    auto operator_state = MakeUnique<ParallelAggregateOperatorState>();
+    operator_state->hash_table_ = physical_parallel_aggregate->MakeHashTable();
+    return operator_state;
+}
+
+UniquePtr<OperatorState> MakeMergeParallelAggregateState(FragmentTask *task, FragmentContext *fragment_ctx) {
+    // Each task merges a contiguous range of partitions.
+    SizeT task_count = fragment_ctx->Tasks().size();
+    SizeT task_id = task->TaskID();
+    SizeT partition_begin = AggregateHashTable::PARTITION_COUNT * task_id / task_count;
+    SizeT partition_end = AggregateHashTable::PARTITION_COUNT * (task_id + 1) / task_count;
+    return MakeUnique<MergeParallelAggregateOperatorState>(partition_begin, partition_end);
+}
+
+UniquePtr<OperatorState> MakeHashJoinState(PhysicalHashJoin *physical_hash_join) {
+    auto operator_state = MakeUnique<HashJoinOperatorState>();
+    for (auto &expr : physical_hash_join->probe_keys()) {
+        operator_state->key_states_.emplace_back(ExpressionState::CreateState(expr));
+    }
+    for (auto &expr : physical_hash_join->conditions()) {
+        operator_state->condition_states_.emplace_back(ExpressionState::CreateState(expr));
+    }
+    return operator_state;
+}
+
 UniquePtr<OperatorState>
 MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops, FragmentTask *task, FragmentContext *fragment_ctx) {
     switch (physical_ops[operator_id]->operator_type()) {
@@ -294,10 +357,11 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<MergeAggregateOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kParallelAggregate: {
-            return MakeTaskStateTemplate<ParallelAggregateOperatorState>(physical_ops[operator_id]);
+            auto physical_parallel_aggregate = static_cast<PhysicalParallelAggregate *>(physical_ops[operator_id]);
+            return MakeParallelAggregateState(physical_parallel_aggregate);
         }
         case PhysicalOperatorType::kMergeParallelAggregate: {
-            return MakeTaskStateTemplate<MergeParallelAggregateOperatorState>(physical_ops[operator_id]);
+            return MakeMergeParallelAggregateState(task, fragment_ctx);
         }
         case PhysicalOperatorType::kFilter: {
             return MakeTaskStateTemplate<FilterOperatorState>(physical_ops[operator_id]);
@@ -318,10 +382,15 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeMergeKnnState(physical_merge_knn, task);
         }
         case PhysicalOperatorType::kHash: {
-            return MakeTaskStateTemplate<HashOperatorState>(physical_ops[operator_id]);
+            auto physical_hash = static_cast<PhysicalHash *>(physical_ops[operator_id]);
+            return MakeHashState(physical_hash);
         }
         case PhysicalOperatorType::kMergeHash: {
-            return MakeTaskStateTemplate<MergeHashOperatorState>(physical_ops[operator_id]);
+            return MakeMergeHashState(task, fragment_ctx);
+        }
+        case PhysicalOperatorType::kJoinHash: {
+            auto physical_hash_join = static_cast<PhysicalHashJoin *>(physical_ops[operator_id]);
+            return MakeHashJoinState(physical_hash_join);
         }
         case PhysicalOperatorType::kLimit: {
             return MakeTaskStateTemplate<LimitOperatorState>(physical_ops[operator_id]);
@@ -435,7 +504,11 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
             return MakeTaskStateTemplate<ShowOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kMatch: {
-            return MakeTaskStateTemplate<MatchOperatorState>(physical_ops[operator_id]);
+            auto physical_match = static_cast<PhysicalMatch *>(physical_ops[operator_id]);
+            return MakeMatchState(physical_match, task, fragment_ctx);
+        }
+        case PhysicalOperatorType::kMergeMatch: {
+            return MakeTaskStateTemplate<MergeMatchOperatorState>(physical_ops[operator_id]);
         }
         case PhysicalOperatorType::kFusion: {
             return MakeTaskStateTemplate<FusionOperatorState>(physical_ops[operator_id]);
@@ -645,8 +718,9 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
-                                              1,
+                                              knn_expr->query_count_,
                                               knn_expr->query_embedding_.ptr,
+                                              knn_expr->float_query_embedding_.get(),
                                               knn_expr->embedding_data_type_,
                                               knn_expr->distance_type_);
             break;
@@ -660,8 +734,9 @@ SizeT InitKnnScanFragmentContext(PhysicalKnnScan *knn_scan_operator, FragmentCon
                                               std::move(knn_expr->opt_params_),
                                               knn_expr->topn_,
                                               knn_expr->dimension_,
-                                              1,
+                                              knn_expr->query_count_,
                                               knn_expr->query_embedding_.ptr,
+                                              knn_expr->float_query_embedding_.get(),
                                               knn_expr->embedding_data_type_,
                                               knn_expr->distance_type_);
             break;
@@ -796,12 +871,11 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             break;
         }
         case PhysicalOperatorType::kMergeAggregate:
-        case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
         case PhysicalOperatorType::kMergeTop:
-        case PhysicalOperatorType::kMergeSort:
         case PhysicalOperatorType::kMergeKnn:
         case PhysicalOperatorType::kMergeMatchTensor:
+        case PhysicalOperatorType::kMergeMatch:
         case PhysicalOperatorType::kFusion: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
@@ -827,6 +901,7 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kCreateIndexDo:
         case PhysicalOperatorType::kCompactIndexDo: {
             if (fragment_type_ != FragmentType::kParallelMaterialize) {
@@ -838,6 +913,18 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kMergeSort:
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            // A serial parent, e.g. a sort, makes the fragment serial, its only task then merges all partitions.
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+            for (auto &task : tasks_) {
+                task->source_state_ = MakeUnique<EmptySourceState>();
+            }
+            break;
+        }
         case PhysicalOperatorType::kUnionAll:
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
@@ -908,6 +995,21 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kMatch: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            for (auto &task : tasks_) {
+                task->source_state_ = MakeUnique<EmptySourceState>();
+            }
+            break;
+        }
         case PhysicalOperatorType::kCommand:
         case PhysicalOperatorType::kInsert:
         case PhysicalOperatorType::kImport:
@@ -926,7 +1028,6 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kDropView:
         case PhysicalOperatorType::kExplain:
         case PhysicalOperatorType::kShow:
-        case PhysicalOperatorType::kMatch:
         case PhysicalOperatorType::kOptimize:
         case PhysicalOperatorType::kFlush:
         case PhysicalOperatorType::kCompactFinish:
@@ -974,25 +1075,6 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kParallelAggregate:
-        case PhysicalOperatorType::kHash: {
-            if (fragment_type_ != FragmentType::kParallelStream) {
-                UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
-            }
-
-            if ((i64)tasks_.size() != parallel_count) {
-                UnrecoverableError(fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type())));
-            }
-
-            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
-                auto sink_state = MakeUnique<MaterializeSinkState>(fragment_ptr_->FragmentID(), task_id);
-                sink_state->column_types_ = last_operator->GetOutputTypes();
-                sink_state->column_names_ = last_operator->GetOutputNames();
-
-                tasks_[task_id]->sink_state_ = std::move(sink_state);
-            }
-            break;
-        }
         case PhysicalOperatorType::kLimit: {
             if (fragment_type_ != FragmentType::kParallelStream) {
                 UnrecoverableError(fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
@@ -1009,13 +1091,12 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kMergeParallelAggregate:
         case PhysicalOperatorType::kMergeAggregate:
-        case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
         case PhysicalOperatorType::kMergeTop:
         case PhysicalOperatorType::kMergeSort:
         case PhysicalOperatorType::kMergeMatchTensor:
+        case PhysicalOperatorType::kMergeMatch:
         case PhysicalOperatorType::kMergeKnn: {
             if (fragment_type_ != FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
@@ -1053,8 +1134,23 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
+        case PhysicalOperatorType::kSort: {
+            if (static_cast<PhysicalSort *>(last_operator)->sort_runs().get() != nullptr) {
+                // The sorted runs are handed over to the merge sort through the operator.
+                for (auto &task : tasks_) {
+                    task->sink_state_ = MakeUnique<MessageSinkState>();
+                }
+                break;
+            }
+            if (fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in serial materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+            tasks_[0]->sink_state_ = MakeUnique<QueueSinkState>(fragment_ptr_->FragmentID(), 0);
+            break;
+        }
         case PhysicalOperatorType::kTop:
-        case PhysicalOperatorType::kSort:
+        case PhysicalOperatorType::kMergeParallelAggregate:
         case PhysicalOperatorType::kMatchTensorScan:
         case PhysicalOperatorType::kKnnScan: {
             if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
@@ -1073,6 +1169,7 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         }
         case PhysicalOperatorType::kTableScan:
         case PhysicalOperatorType::kFilter:
+        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kIndexScan: {
             if (fragment_type_ == FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
@@ -1119,7 +1216,6 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
@@ -1158,6 +1254,14 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             tasks_[0]->sink_state_ = MakeUnique<MessageSinkState>();
             break;
         }
+        case PhysicalOperatorType::kParallelAggregate:
+        case PhysicalOperatorType::kHash: {
+            for (auto &task : tasks_) {
+                task->sink_state_ = MakeUnique<MessageSinkState>();
+            }
+            break;
+        }
+        case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kCreateIndexDo:
         case PhysicalOperatorType::kCompact:
         case PhysicalOperatorType::kCompactIndexDo: {
@@ -1240,9 +1344,17 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count, FragmentCon
             }
             break;
         }
-        case PhysicalOperatorType::kMatch:
+        case PhysicalOperatorType::kMatch: {
+            auto *match_operator = static_cast<PhysicalMatch *>(first_operator);
+            parallel_count = std::min(parallel_count, (i64)(match_operator->TaskletCount()));
+            if (parallel_count == 0) {
+                parallel_count = 1;
+            }
+            break;
+        }
         case PhysicalOperatorType::kMergeKnn:
         case PhysicalOperatorType::kMergeMatchTensor:
+        case PhysicalOperatorType::kMergeMatch:
         case PhysicalOperatorType::kProjection: {
             // Serial Materialize
             parallel_count = 1;
@@ -1251,6 +1363,8 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count, FragmentCon
         case PhysicalOperatorType::kCreateIndexDo: {
             const auto *create_index_do_operator = static_cast<const PhysicalCreateIndexDo *>(first_operator);
             InitCreateIndexDoFragmentContext(create_index_do_operator, this);
+            // All tasks build the same graphs, vertices are fetched from a shared counter per segment
+            parallel_count = std::min(parallel_count, query_context_->global_config()->HnswBuildThreadNum());
             parallel_count = std::max(parallel_count, 1l);
             break;
         }
@@ -1272,6 +1386,14 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count, FragmentCon
             }
             break;
         }
+        case PhysicalOperatorType::kMergeHash: {
+            parallel_count = std::min(parallel_count, (i64)JoinHashTable::PARTITION_COUNT);
+            break;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            parallel_count = std::min(parallel_count, (i64)AggregateHashTable::PARTITION_COUNT);
+            break;
+        }
         case PhysicalOperatorType::kCompactIndexDo: {
             auto *compact_index_do_operator = static_cast<PhysicalCompactIndexDo *>(first_operator);
             InitCompactIndexDoFragmentContext(compact_index_do_operator, this, parent_context);
@@ -65,7 +65,11 @@ void FragmentTask::OnExecute() {
     }
 
     bool execute_success{false};
-    source_op->Execute(query_context, source_state_.get());
+    // A complete source has nothing left to read. The task still runs while its operators have output left, e.g. a sort emitting merged
+    // blocks.
+    if (!source_state_->Complete()) {
+        source_op->Execute(query_context, source_state_.get());
+    }
     Status operator_status{};
     if (source_state_->status_.ok()) {
         // No source error
@@ -77,6 +81,12 @@ void FragmentTask::OnExecute() {
         profiler.Begin();
         try {
             for (i64 op_idx = operator_count_ - 1; op_idx >= 0; --op_idx) {
+                if (operator_states_[op_idx]->Complete()) {
+                    // All its output has been taken by the next operator.
+                    operator_refs[op_idx]->FillingTableRefs(table_refs);
+                    execute_success = true;
+                    continue;
+                }
                 profiler.StartOperator(operator_refs[op_idx]);
                 DeferFn defer_fn([&]() { profiler.StopOperator(operator_states_[op_idx].get()); });
 
@@ -142,6 +152,10 @@ bool FragmentTask::QuitFromWorkerLoop() {
         return false;
     }
     auto *queue_state = static_cast<QueueSourceState *>(source_state_.get());
+    if (queue_state->Complete()) {
+        // All input is read, the operators have output left.
+        return false;
+    }
 
     std::unique_lock lock(mutex_);
     if (queue_state->source_queue_.Empty() && status_ == FragmentTaskStatus::kRunning) {
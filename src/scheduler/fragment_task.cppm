@@ -19,6 +19,7 @@ export module fragment_task;
 import stl;
 import profiler;
 import operator_state;
+import task_priority;
 
 namespace infinity {
 
@@ -63,6 +64,23 @@ public:
 
     [[nodiscard]] inline i64 LastWorkerID() const { return last_worker_id_; }
 
+    inline void SetPriorityClass(TaskPriorityClass priority_class) { priority_class_ = priority_class; }
+
+    [[nodiscard]] inline TaskPriorityClass PriorityClass() const { return priority_class_; }
+
+    // Queue wait accounting, only touched by the scheduler
+    inline void SetEnqueueTime(TimePoint<Clock> enqueue_time) {
+        enqueue_time_ = enqueue_time;
+        waiting_ = true;
+    }
+
+    [[nodiscard]] inline bool Waiting() const { return waiting_; }
+
+    inline TimePoint<Clock> TakeEnqueueTime() {
+        waiting_ = false;
+        return enqueue_time_;
+    }
+
     u64 FragmentId() const;
 
     [[nodiscard]] inline i64 TaskID() const { return task_id_; }
@@ -100,6 +118,9 @@ private:
     void *fragment_context_{};
     bool is_terminator_{false};
     i64 last_worker_id_{-1};
+    TaskPriorityClass priority_class_{TaskPriorityClass::kInteractive};
+    bool waiting_{false};
+    TimePoint<Clock> enqueue_time_{};
     i64 task_id_{-1};
     i64 operator_count_{0};
 };
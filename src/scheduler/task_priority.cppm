@@ -0,0 +1,62 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module task_priority;
+
+import stl;
+
+namespace infinity {
+
+// Scheduling class of all fragment tasks of a statement. Lower value is served first.
+export enum class TaskPriorityClass : i8 {
+    kInteractive = 0, // select / explain
+    kNormal = 1,      // dml
+    kBackground = 2,  // compact, create index, ...
+    kInvalid = 3,     // not set, derived from the statement type
+};
+
+export constexpr SizeT PRIORITY_CLASS_COUNT = static_cast<SizeT>(TaskPriorityClass::kInvalid);
+
+// Relative worker share of each class when all classes have runnable tasks
+export constexpr Array<i64, PRIORITY_CLASS_COUNT> PRIORITY_CLASS_WEIGHTS = {8, 4, 1};
+
+export String TaskPriorityClassToString(TaskPriorityClass priority_class) {
+    switch (priority_class) {
+        case TaskPriorityClass::kInteractive:
+            return "interactive";
+        case TaskPriorityClass::kNormal:
+            return "normal";
+        case TaskPriorityClass::kBackground:
+            return "background";
+        case TaskPriorityClass::kInvalid:
+            return "auto";
+    }
+}
+
+export TaskPriorityClass StringToTaskPriorityClass(const String &str) {
+    if (str == "interactive") {
+        return TaskPriorityClass::kInteractive;
+    }
+    if (str == "normal") {
+        return TaskPriorityClass::kNormal;
+    }
+    if (str == "background") {
+        return TaskPriorityClass::kBackground;
+    }
+    return TaskPriorityClass::kInvalid;
+}
+
+} // namespace infinity
@@ -38,6 +38,7 @@ import base_statement;
 import extra_ddl_info;
 import create_statement;
 import command_statement;
+import task_priority;
 
 namespace infinity {
 
@@ -49,6 +50,7 @@ void TaskScheduler::Init(Config *config_ptr) {
     worker_count_ = config_ptr->CPULimit();
     worker_array_.reserve(worker_count_);
     worker_workloads_.resize(worker_count_);
+    worker_counters_.resize(worker_count_);
     u64 cpu_count = Thread::hardware_concurrency();
 
     u64 cpu_select_step = cpu_count / worker_count_;
@@ -58,20 +60,31 @@ void TaskScheduler::Init(Config *config_ptr) {
         cpu_select_step = 1;
     }
 
-    for (u64 cpu_id = 0; cpu_id < worker_count_; cpu_id += cpu_select_step) {
+    // Worker id is the index into worker_array_, cpu id is only used for pinning.
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        u64 cpu_id = (worker_id * cpu_select_step) % cpu_count;
         UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>();
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), cpu_id);
-        // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id % cpu_count);
-
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
-        worker_workloads_[cpu_id] = 0;
+        worker_array_.emplace_back(cpu_id, std::move(worker_queue));
+        worker_workloads_[worker_id] = 0;
     }
 
+    // Only background class is capped, interactive and normal classes may use every worker.
+    priority_class_running_limits_.fill(0);
+    priority_class_running_limits_[static_cast<SizeT>(TaskPriorityClass::kBackground)] =
+        std::max(static_cast<u64>(1), worker_count_ * BACKGROUND_TASK_WORKER_PERCENT / 100);
+
     if (worker_array_.empty()) {
         UnrecoverableError("No cpu is used in scheduler");
     }
 
+    // Start threads after all workers exist, since a worker may steal from any other.
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        Worker &worker = worker_array_[worker_id];
+        worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_id);
+        // Pin the thread to specific cpu
+        ThreadUtil::pin(*worker.thread_, worker.cpu_id_);
+    }
+
     initialized_ = true;
 }
 
@@ -83,6 +96,17 @@ void TaskScheduler::UnInit() {
         worker.queue_->Enqueue(terminate_task.get());
         worker.thread_->join();
     }
+
+    for (const auto &statistics : GetWorkerStatistics()) {
+        LOG_INFO(fmt::format("Worker: {}, executed: {}, steal: {}/{}, stolen: {}, idle: {} times, {} us",
+                             statistics.worker_id_,
+                             statistics.executed_count_,
+                             statistics.steal_count_,
+                             statistics.steal_attempt_count_,
+                             statistics.stolen_count_,
+                             statistics.idle_count_,
+                             statistics.idle_time_us_));
+    }
 }
 
 u64 TaskScheduler::FindLeastWorkloadWorker() {
@@ -98,7 +122,31 @@ u64 TaskScheduler::FindLeastWorkloadWorker() {
     return min_workload_worker_id;
 }
 
-void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement) {
+TaskPriorityClass TaskScheduler::StatementPriorityClass(const BaseStatement *base_statement) {
+    switch (base_statement->Type()) {
+        case StatementType::kSelect:
+        case StatementType::kExplain:
+        case StatementType::kShow: {
+            return TaskPriorityClass::kInteractive;
+        }
+        case StatementType::kCompact:
+        case StatementType::kOptimize: {
+            return TaskPriorityClass::kBackground;
+        }
+        case StatementType::kCreate: {
+            const CreateStatement *create_statement = static_cast<const CreateStatement *>(base_statement);
+            if (create_statement->create_info_->type_ == DDLType::kIndex) {
+                return TaskPriorityClass::kBackground;
+            }
+            return TaskPriorityClass::kNormal;
+        }
+        default: {
+            return TaskPriorityClass::kNormal;
+        }
+    }
+}
+
+void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *base_statement, TaskPriorityClass priority_class) {
     if (!initialized_) {
         UnrecoverableError("Scheduler isn't initialized");
     }
@@ -140,6 +188,20 @@ void TaskScheduler::Schedule(PlanFragment *plan_fragment, const BaseStatement *b
         }
     }
 
+    if (priority_class == TaskPriorityClass::kInvalid) {
+        priority_class = StatementPriorityClass(base_statement);
+    }
+    // All fragments of the statement share the class, including the ones scheduled later by ScheduleFragment
+    std::function<void(PlanFragment *)> SetFragmentPriority = [&](PlanFragment *fragment) {
+        for (auto &task : fragment->GetContext()->Tasks()) {
+            task->SetPriorityClass(priority_class);
+        }
+        for (auto &child : fragment->Children()) {
+            SetFragmentPriority(child.get());
+        }
+    };
+    SetFragmentPriority(plan_fragment);
+
     Vector<PlanFragment *> start_fragments;
     SizeT task_n = plan_fragment->GetStartFragments(start_fragments);
     plan_fragment->GetContext()->notifier()->SetTaskN(task_n);
@@ -196,72 +258,229 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
 }
 
 void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
+    PriorityClassCounter &class_counter = priority_class_counters_[static_cast<SizeT>(task->PriorityClass())];
+    ++class_counter.queued_count_;
+    ++class_counter.scheduled_count_;
+    task->SetEnqueueTime(Clock::now());
+
     ++worker_workloads_[worker_id];
     worker_array_[worker_id].queue_->Enqueue(task);
 }
 
-void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
-    List<FragmentTask *> task_lists;
-    auto iter = task_lists.end();
-    auto last_iter = task_lists.end();
-    while (true) {
-        if (iter == last_iter) {
-            Vector<FragmentTask *> dequeue_output;
-            if (task_lists.empty()) {
-                task_queue->DequeueBulk(dequeue_output);
-            } else {
-                task_queue->TryDequeueBulk(dequeue_output);
+bool TaskScheduler::TryAdmit(TaskPriorityClass priority_class) {
+    SizeT class_idx = static_cast<SizeT>(priority_class);
+    atomic_u64 &running_count = priority_class_counters_[class_idx].running_count_;
+    u64 running_limit = priority_class_running_limits_[class_idx];
+    if (running_limit == 0) {
+        ++running_count;
+        return true;
+    }
+    u64 current = running_count.load();
+    while (current < running_limit) {
+        if (running_count.compare_exchange_weak(current, current + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::Release(TaskPriorityClass priority_class) { --priority_class_counters_[static_cast<SizeT>(priority_class)].running_count_; }
+
+void TaskScheduler::RecordQueueWait(FragmentTask *task) {
+    if (!task->Waiting()) {
+        return;
+    }
+    PriorityClassCounter &class_counter = priority_class_counters_[static_cast<SizeT>(task->PriorityClass())];
+    u64 wait_us = ChronoCast<MicroSeconds>(ElapsedFromStart(Clock::now(), task->TakeEnqueueTime())).count();
+    --class_counter.queued_count_;
+    class_counter.total_wait_us_ += wait_us;
+    u64 max_wait_us = class_counter.max_wait_us_.load();
+    while (wait_us > max_wait_us && !class_counter.max_wait_us_.compare_exchange_weak(max_wait_us, wait_us)) {
+    }
+}
+
+bool TaskScheduler::TrySteal(u64 thief_id) {
+    WorkerCounter &thief_counter = worker_counters_[thief_id];
+    ++thief_counter.steal_attempt_count_;
+
+    // Higher priority classes first, start from the neighbour so that thieves don't all hit worker 0
+    for (SizeT class_idx = 0; class_idx < PRIORITY_CLASS_COUNT; ++class_idx) {
+        for (u64 i = 1; i < worker_count_; ++i) {
+            u64 victim_id = (thief_id + i) % worker_count_;
+            FragmentTaskDeque *victim_deque = worker_array_[victim_id].deques_[class_idx].get();
+            if (victim_deque->Empty()) {
+                continue;
             }
-            if (!dequeue_output.empty()) {
-                task_lists.insert(task_lists.end(), dequeue_output.begin(), dequeue_output.end());
+            FragmentTask *task = nullptr;
+            if (victim_deque->Steal(task)) {
+                --worker_workloads_[victim_id];
+                ++worker_workloads_[thief_id];
+                ++worker_counters_[victim_id].stolen_count_;
+                ++thief_counter.steal_count_;
+                worker_array_[thief_id].deques_[class_idx]->Push(task);
+                return true;
             }
-            last_iter = task_lists.end();
         }
-        if (iter == task_lists.end()) {
-            iter = task_lists.begin();
+    }
+    return false;
+}
+
+FragmentTask *TaskScheduler::PickTask(u64 worker_id, Array<i64, PRIORITY_CLASS_COUNT> &credits) {
+    Worker &worker = worker_array_[worker_id];
+    // Weighted round-robin: each class may run `weight` tasks per round, a round ends once no class with credit has runnable tasks.
+    for (SizeT round = 0; round < 2; ++round) {
+        for (SizeT class_idx = 0; class_idx < PRIORITY_CLASS_COUNT; ++class_idx) {
+            if (credits[class_idx] <= 0 || worker.deques_[class_idx]->Empty()) {
+                continue;
+            }
+            auto priority_class = static_cast<TaskPriorityClass>(class_idx);
+            if (!TryAdmit(priority_class)) {
+                continue;
+            }
+            // Take tasks from the top as thieves do, so the tasks of one class run round-robin.
+            FragmentTask *task = nullptr;
+            if (worker.deques_[class_idx]->Steal(task)) {
+                --credits[class_idx];
+                return task;
+            }
+            Release(priority_class);
         }
-        auto &fragment_task = *iter;
-        if (fragment_task->IsTerminator()) {
-            break;
+        credits = PRIORITY_CLASS_WEIGHTS;
+    }
+    return nullptr;
+}
+
+void TaskScheduler::WorkerLoop(u64 worker_id) {
+    Worker &worker = worker_array_[worker_id];
+    FragmentTaskBlockQueue *task_queue = worker.queue_.get();
+    WorkerCounter &counter = worker_counters_[worker_id];
+
+    Array<i64, PRIORITY_CLASS_COUNT> credits = PRIORITY_CLASS_WEIGHTS;
+    i64 idle_wait_us = MIN_SCHEDULER_IDLE_WAIT_US;
+    Vector<FragmentTask *> dequeue_output;
+    while (true) {
+        dequeue_output.clear();
+        task_queue->TryDequeueBulk(dequeue_output);
+        for (auto *task : dequeue_output) {
+            if (task->IsTerminator()) {
+                return;
+            }
+            worker.deques_[static_cast<SizeT>(task->PriorityClass())]->Push(task);
         }
+
+        FragmentTask *fragment_task = PickTask(worker_id, credits);
+        if (fragment_task == nullptr && work_stealing_ && TrySteal(worker_id)) {
+            fragment_task = PickTask(worker_id, credits);
+        }
+        if (fragment_task == nullptr) {
+            // Nothing runnable or admitted, park on the inbox and back off
+            ++counter.idle_count_;
+            auto idle_begin = Clock::now();
+            dequeue_output.clear();
+            task_queue->DequeueBulkFor(dequeue_output, MicroSeconds(idle_wait_us));
+            counter.idle_time_us_ += ChronoCast<MicroSeconds>(ElapsedFromStart(Clock::now(), idle_begin)).count();
+            idle_wait_us = std::min(idle_wait_us * 2, MAX_SCHEDULER_IDLE_WAIT_US);
+            for (auto *task : dequeue_output) {
+                if (task->IsTerminator()) {
+                    return;
+                }
+                worker.deques_[static_cast<SizeT>(task->PriorityClass())]->Push(task);
+            }
+            continue;
+        }
+        idle_wait_us = MIN_SCHEDULER_IDLE_WAIT_US;
+
+        TaskPriorityClass priority_class = fragment_task->PriorityClass();
+        RecordQueueWait(fragment_task);
+
         auto *fragment_ctx = fragment_task->fragment_context();
         if (!fragment_ctx->notifier()->StartTask()) {
+            Release(priority_class);
             --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
             continue;
         }
 
         fragment_task->OnExecute();
         fragment_task->SetLastWorkID(worker_id);
+        ++counter.executed_count_;
+        Release(priority_class);
 
         bool error = false;
         bool finish = false;
+        bool requeue = false;
 
         if (fragment_task->status() != FragmentTaskStatus::kError) {
             if (fragment_task->IsComplete()) {
                 // auto *sink_op = fragment_ctx->GetSinkOperator();
                 --worker_workloads_[worker_id];
                 fragment_task->CompleteTask();
-                iter = task_lists.erase(iter);
                 finish = true;
             } else if (fragment_task->QuitFromWorkerLoop()) {
                 --worker_workloads_[worker_id];
-                iter = task_lists.erase(iter);
             } else {
-                ++iter;
+                requeue = true;
             }
         } else {
             error = true;
             finish = true;
             --worker_workloads_[worker_id];
-            iter = task_lists.erase(iter);
         }
         if (finish || error) {
             fragment_ctx->notifier()->FinishTask(error, fragment_ctx);
         } else {
             fragment_ctx->notifier()->UnstartTask();
         }
+        if (requeue) {
+            // Re-push only after UnstartTask, once visible in the deque the task may be stolen.
+            worker.deques_[static_cast<SizeT>(priority_class)]->Push(fragment_task);
+        }
+    }
+}
+
+Vector<WorkerStatistics> TaskScheduler::GetWorkerStatistics() const {
+    Vector<WorkerStatistics> result;
+    result.reserve(worker_array_.size());
+    for (u64 worker_id = 0; worker_id < worker_array_.size(); ++worker_id) {
+        const WorkerCounter &counter = worker_counters_[worker_id];
+        WorkerStatistics statistics;
+        statistics.worker_id_ = worker_id;
+        statistics.cpu_id_ = worker_array_[worker_id].cpu_id_;
+        statistics.workload_ = worker_workloads_[worker_id];
+        statistics.executed_count_ = counter.executed_count_;
+        statistics.steal_attempt_count_ = counter.steal_attempt_count_;
+        statistics.steal_count_ = counter.steal_count_;
+        statistics.stolen_count_ = counter.stolen_count_;
+        statistics.idle_count_ = counter.idle_count_;
+        statistics.idle_time_us_ = counter.idle_time_us_;
+        result.emplace_back(statistics);
     }
+    return result;
+}
+
+PriorityClassStatistics TaskScheduler::GetPriorityClassStatistics(TaskPriorityClass priority_class) const {
+    SizeT class_idx = static_cast<SizeT>(priority_class);
+    const PriorityClassCounter &class_counter = priority_class_counters_[class_idx];
+    PriorityClassStatistics statistics;
+    statistics.priority_class_ = priority_class;
+    statistics.queued_count_ = class_counter.queued_count_;
+    statistics.running_count_ = class_counter.running_count_;
+    statistics.running_limit_ = priority_class_running_limits_[class_idx];
+    statistics.scheduled_count_ = class_counter.scheduled_count_;
+    u64 started_count = statistics.scheduled_count_ - statistics.queued_count_;
+    statistics.avg_wait_us_ = started_count == 0 ? 0 : class_counter.total_wait_us_ / started_count;
+    statistics.max_wait_us_ = class_counter.max_wait_us_;
+    return statistics;
+}
+
+String PriorityClassStatistics::ToString() const {
+    String running_limit = running_limit_ == 0 ? "unlimited" : std::to_string(running_limit_);
+    return fmt::format("queued: {}, running: {}/{}, scheduled: {}, avg wait: {}us, max wait: {}us",
+                       queued_count_,
+                       running_count_,
+                       running_limit,
+                       scheduled_count_,
+                       avg_wait_us_,
+                       max_wait_us_);
 }
 
 void TaskScheduler::DumpPlanFragment(PlanFragment *root) {
@@ -18,9 +18,12 @@ export module task_scheduler;
 
 import config;
 import stl;
+import default_values;
 import fragment_task;
 import blocking_queue;
+import work_stealing_deque;
 import base_statement;
+import task_priority;
 
 namespace infinity {
 
@@ -28,15 +31,77 @@ class QueryContext;
 class PlanFragment;
 
 using FragmentTaskBlockQueue = BlockingQueue<FragmentTask*>;
+using FragmentTaskDeque = WorkStealingDeque<FragmentTask*>;
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
-        : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
+    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue) : cpu_id_(cpu_id), queue_(std::move(queue)) {
+        for (auto &deque : deques_) {
+            deque = MakeUnique<FragmentTaskDeque>(DEFAULT_WORK_STEALING_DEQUE_SIZE);
+        }
+    }
+
+    [[nodiscard]] bool AllDequeEmpty() const {
+        for (const auto &deque : deques_) {
+            if (!deque->Empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     u64 cpu_id_{0};
+    // Inbox: any thread may enqueue, only the worker dequeues. Also used to park an idle worker.
     UniquePtr<FragmentTaskBlockQueue> queue_{};
+    // Runnable tasks owned by the worker, one deque per priority class. Other idle workers steal from their top.
+    Array<UniquePtr<FragmentTaskDeque>, PRIORITY_CLASS_COUNT> deques_{};
     UniquePtr<Thread> thread_{};
 };
 
+struct WorkerCounter {
+    atomic_u64 executed_count_{0};
+    atomic_u64 steal_attempt_count_{0};
+    atomic_u64 steal_count_{0};
+    atomic_u64 stolen_count_{0};
+    atomic_u64 idle_count_{0};
+    atomic_u64 idle_time_us_{0};
+};
+
+export struct WorkerStatistics {
+    u64 worker_id_{0};
+    u64 cpu_id_{0};
+    u64 workload_{0};
+    u64 executed_count_{0};
+    u64 steal_attempt_count_{0};
+    // tasks this worker took from others
+    u64 steal_count_{0};
+    // tasks others took from this worker
+    u64 stolen_count_{0};
+    u64 idle_count_{0};
+    u64 idle_time_us_{0};
+};
+
+struct PriorityClassCounter {
+    // scheduled but never started yet
+    atomic_u64 queued_count_{0};
+    atomic_u64 running_count_{0};
+    atomic_u64 scheduled_count_{0};
+    atomic_u64 total_wait_us_{0};
+    atomic_u64 max_wait_us_{0};
+};
+
+export struct PriorityClassStatistics {
+    TaskPriorityClass priority_class_{TaskPriorityClass::kInvalid};
+    u64 queued_count_{0};
+    u64 running_count_{0};
+    // 0 means unlimited
+    u64 running_limit_{0};
+    u64 scheduled_count_{0};
+    u64 avg_wait_us_{0};
+    u64 max_wait_us_{0};
+
+    String ToString() const;
+};
+
 export class TaskScheduler {
 public:
     explicit TaskScheduler(Config *config_ptr);
@@ -47,14 +112,25 @@ public:
 
     void UnInit();
 
-    // Schedule start fragments
-    void Schedule(PlanFragment * plan_fragment_root, const BaseStatement* base_statement);
+    // Schedule start fragments, `priority_class` kInvalid means derive it from the statement
+    void Schedule(PlanFragment *plan_fragment_root,
+                  const BaseStatement *base_statement,
+                  TaskPriorityClass priority_class = TaskPriorityClass::kInvalid);
 
     // `plan_fragment` can be scheduled because all of its dependencies are met.
     void ScheduleFragment(PlanFragment *plan_fragment);
 
     void DumpPlanFragment(PlanFragment *plan_fragment);
 
+    Vector<WorkerStatistics> GetWorkerStatistics() const;
+
+    PriorityClassStatistics GetPriorityClassStatistics(TaskPriorityClass priority_class) const;
+
+    static TaskPriorityClass StatementPriorityClass(const BaseStatement *base_statement);
+
+    // Stealing is on by default, turning it off keeps every task on the worker it's scheduled to. For benchmarks.
+    void SetWorkStealing(bool enable) { work_stealing_ = enable; }
+
 private:
     u64 FindLeastWorkloadWorker();
 
@@ -62,15 +138,32 @@ private:
 
     void RunTask(FragmentTask *task);
 
-    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
+    // Steal one task from another worker's deque into `thief_id`'s deque
+    bool TrySteal(u64 thief_id);
+
+    // Weighted pick among the worker's own deques, the picked task is admitted and counted as running
+    FragmentTask *PickTask(u64 worker_id, Array<i64, PRIORITY_CLASS_COUNT> &credits);
+
+    // Admission control: background tasks may only occupy a share of the workers
+    bool TryAdmit(TaskPriorityClass priority_class);
+
+    void Release(TaskPriorityClass priority_class);
+
+    void RecordQueueWait(FragmentTask *task);
+
+    void WorkerLoop(u64 worker_id);
 
 private:
     bool initialized_{false};
 
     Vector<Worker> worker_array_{};
     Deque<Atomic<u64>> worker_workloads_{};
+    Deque<WorkerCounter> worker_counters_{};
+    Array<PriorityClassCounter, PRIORITY_CLASS_COUNT> priority_class_counters_{};
+    Array<u64, PRIORITY_CLASS_COUNT> priority_class_running_limits_{};
 
     u64 worker_count_{0};
+    Atomic<bool> work_stealing_{true};
 };
 
 } // namespace infinity
@@ -90,6 +90,13 @@ void BGTaskProcessor::Process() {
                     LOG_DEBUG("Cleanup in background done");
                     break;
                 }
+                case BGTaskType::kScrub: {
+                    LOG_DEBUG("Scrub in background");
+                    auto task = static_cast<ScrubTask *>(bg_task.get());
+                    task->Execute();
+                    LOG_DEBUG("Scrub in background done");
+                    break;
+                }
                 case BGTaskType::kUpdateSegmentBloomFilterData: {
                     LOG_DEBUG("Update segment bloom filter");
                     auto *task = static_cast<UpdateSegmentBloomFilterTask *>(bg_task.get());
@@ -20,6 +20,7 @@ import catalog;
 import catalog_delta_entry;
 import cleanup_scanner;
 import buffer_manager;
+import file_scrubber;
 
 export module bg_task;
 
@@ -33,6 +34,7 @@ export enum class BGTaskType {
     kNotifyCompact,
     kNotifyOptimize,
     kCleanup,
+    kScrub,
     kUpdateSegmentBloomFilterData, // Not used
     kInvalid
 };
@@ -53,6 +55,8 @@ export String BGTaskTypeToString(BGTaskType type) {
             return "NotifyOptimize";
         case BGTaskType::kCleanup:
             return "Cleanup";
+        case BGTaskType::kScrub:
+            return "Scrub";
         case BGTaskType::kUpdateSegmentBloomFilterData:
             return "UpdateSegmentBloomFilterData";
         default:
@@ -159,6 +163,23 @@ private:
     BufferManager *buffer_mgr_;
 };
 
+export class ScrubTask final : public BGTask {
+public:
+    ScrubTask(SharedPtr<FileScrubber> scrubber, SizeT byte_budget)
+        : BGTask(BGTaskType::kScrub, true), scrubber_(std::move(scrubber)), byte_budget_(byte_budget) {}
+
+    ~ScrubTask() override = default;
+
+    String ToString() const override { return "ScrubTask"; }
+
+    void Execute() { scrubber_->Scrub(byte_budget_); }
+
+private:
+    SharedPtr<FileScrubber> scrubber_;
+
+    const SizeT byte_budget_;
+};
+
 export class NotifyCompactTask final : public BGTask {
 public:
     NotifyCompactTask() : BGTask(BGTaskType::kNotifyCompact, true) {}
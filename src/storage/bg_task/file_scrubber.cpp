@@ -0,0 +1,132 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module file_scrubber;
+
+import stl;
+import buffer_manager;
+import file_worker;
+import file_system;
+import file_system_type;
+import local_file_system;
+import defer_op;
+import crc;
+import status;
+import logger;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT SCRUB_READ_SIZE = 1024 * 1024;
+
+} // namespace
+
+void FileScrubber::Scrub(SizeT byte_budget) {
+    scheduled_ = false;
+    bool new_pass = false;
+    while (byte_budget > 0) {
+        if (file_path_.empty()) {
+            if (pending_files_.empty()) {
+                // at most one pass a call, or a call would spin on a few small files
+                const auto now = std::chrono::steady_clock::now();
+                if (new_pass || now < next_pass_time_) {
+                    break;
+                }
+                pending_files_ = buffer_mgr_->GetColdFiles();
+                next_pass_time_ = now + pass_interval_;
+                new_pass = true;
+            }
+            if (!NextFile()) {
+                continue;
+            }
+        }
+        ScrubFile(byte_budget);
+    }
+}
+
+bool FileScrubber::NextFile() {
+    if (pending_files_.empty()) {
+        return false;
+    }
+    String file_path = std::move(pending_files_.back());
+    pending_files_.pop_back();
+
+    // Cleanup deletes files on the background thread as well, so a file that exists now can be opened.
+    LocalFileSystem fs;
+    if (!fs.Exists(file_path)) {
+        return false;
+    }
+    auto file_handler = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kNoLock);
+    DeferFn defer_fn([&]() { file_handler->Close(); });
+    if (!FileChecksumFooter::ReadFooter(*file_handler, footer_)) {
+        // written by an older version
+        return false;
+    }
+    file_path_ = std::move(file_path);
+    offset_ = 0;
+    checksum_ = 0;
+    return true;
+}
+
+void FileScrubber::ScrubFile(SizeT &byte_budget) {
+    LocalFileSystem fs;
+    if (!fs.Exists(file_path_)) {
+        file_path_.clear();
+        return;
+    }
+    auto file_handler = fs.OpenFile(file_path_, FileFlags::READ_FLAG, FileLockType::kNoLock);
+    DeferFn defer_fn([&]() { file_handler->Close(); });
+
+    // A checkpoint may rewrite the file between two calls, or during this one. Its footer changes then.
+    auto Rewritten = [&]() {
+        FileChecksumFooter footer;
+        return !FileChecksumFooter::ReadFooter(*file_handler, footer) || footer != footer_;
+    };
+    if (Rewritten()) {
+        file_path_.clear();
+        return;
+    }
+
+    Vector<char> buffer(std::min(byte_budget, SCRUB_READ_SIZE));
+    while (offset_ < footer_.payload_size_ && byte_budget > 0) {
+        SizeT nbytes = std::min({buffer.size(), footer_.payload_size_ - offset_, byte_budget});
+        i64 read_count = fs.ReadAt(*file_handler, offset_, buffer.data(), nbytes);
+        if (read_count <= 0) {
+            file_path_.clear();
+            return;
+        }
+        checksum_ = CRC32C(buffer.data(), read_count, checksum_);
+        offset_ += read_count;
+        byte_budget -= read_count;
+    }
+    if (offset_ < footer_.payload_size_) {
+        return;
+    }
+
+    if (!Rewritten()) {
+        ++scrubbed_file_count_;
+        if (checksum_ != footer_.checksum_) {
+            ++corrupted_file_count_;
+            Status status = Status::DataCorrupted(file_path_);
+            LOG_ERROR(fmt::format("Scrub: {}, checksum: {:#x}, expected: {:#x}", status.message(), checksum_, footer_.checksum_));
+        }
+    }
+    file_path_.clear();
+}
+
+} // namespace infinity
@@ -0,0 +1,64 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module file_scrubber;
+
+import stl;
+import buffer_manager;
+import file_worker;
+
+namespace infinity {
+
+// Verifies the checksum footers of the files of cold buffer objects, so that corruption is found before the data is
+// needed. A call to Scrub reads at most its byte budget and the next call resumes from there, so the caller paces the
+// reads by the budget and the frequency of the calls. A pass over the cold files starts at most every pass_interval.
+export class FileScrubber {
+public:
+    FileScrubber(BufferManager *buffer_mgr, std::chrono::seconds pass_interval) : buffer_mgr_(buffer_mgr), pass_interval_(pass_interval) {}
+
+    void Scrub(SizeT byte_budget);
+
+    // Return false if a scrub is already scheduled and hasn't run yet, so that slices don't pile up behind other work.
+    bool TrySchedule() { return !scheduled_.exchange(true); }
+
+    u64 scrubbed_file_count() const { return scrubbed_file_count_; }
+
+    u64 corrupted_file_count() const { return corrupted_file_count_; }
+
+private:
+    // Start on the next file that has a footer, return false if none is left in this pass.
+    bool NextFile();
+
+    void ScrubFile(SizeT &byte_budget);
+
+    BufferManager *const buffer_mgr_;
+    const std::chrono::seconds pass_interval_;
+    std::chrono::steady_clock::time_point next_pass_time_{};
+    Atomic<bool> scheduled_{false};
+
+    Vector<String> pending_files_{};
+
+    // the file being verified
+    String file_path_{};
+    FileChecksumFooter footer_{};
+    u64 offset_{};
+    u32 checksum_{};
+
+    Atomic<u64> scrubbed_file_count_{};
+    Atomic<u64> corrupted_file_count_{};
+};
+
+} // namespace infinity
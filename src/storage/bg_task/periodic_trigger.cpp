@@ -45,6 +45,14 @@ void CleanupPeriodicTrigger::Trigger() {
     bg_processor_->Submit(std::move(cleanup_task));
 }
 
+void ScrubPeriodicTrigger::Trigger() {
+    if (!scrubber_->TrySchedule()) {
+        return;
+    }
+    auto scrub_task = MakeShared<ScrubTask>(scrubber_, byte_budget_);
+    bg_processor_->Submit(std::move(scrub_task));
+}
+
 void CheckpointPeriodicTrigger::Trigger() {
     auto checkpoint_task = MakeShared<CheckpointTask>(is_full_checkpoint_);
     LOG_DEBUG(fmt::format("Trigger {} periodic checkpoint.", is_full_checkpoint_ ? "FULL" : "DELTA"));
@@ -22,6 +22,7 @@ import compaction_process;
 import catalog;
 import txn_manager;
 import wal_manager;
+import file_scrubber;
 
 namespace infinity {
 
@@ -64,6 +65,24 @@ private:
     TxnTimeStamp last_visible_ts_{0};
 };
 
+// Submits a short slice of scrub reads every SCRUB_SLICE_INTERVAL instead of a whole interval of reads at once, so the
+// scrubber never holds the background thread for long and its I/O rate is io_rate_limit.
+export class ScrubPeriodicTrigger final : public PeriodicTrigger {
+public:
+    static constexpr std::chrono::milliseconds SCRUB_SLICE_INTERVAL{100};
+
+    ScrubPeriodicTrigger(BGTaskProcessor *bg_processor, SharedPtr<FileScrubber> scrubber, SizeT io_rate_limit)
+        : PeriodicTrigger(SCRUB_SLICE_INTERVAL), bg_processor_(bg_processor), scrubber_(std::move(scrubber)),
+          byte_budget_(std::max<SizeT>(io_rate_limit * SCRUB_SLICE_INTERVAL.count() / 1000, 1)) {}
+
+    virtual void Trigger() override;
+
+private:
+    BGTaskProcessor *const bg_processor_{};
+    SharedPtr<FileScrubber> scrubber_{};
+    const SizeT byte_budget_{};
+};
+
 export class CheckpointPeriodicTrigger final : public PeriodicTrigger {
 public:
     explicit CheckpointPeriodicTrigger(std::chrono::milliseconds interval, WalManager *wal_mgr, bool full_checkpoint)
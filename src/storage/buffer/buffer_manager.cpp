@@ -14,6 +14,7 @@
 
 module;
 
+#include <cstring>
 #include <vector>
 
 module buffer_manager;
@@ -26,8 +27,33 @@ import logger;
 import specific_concurrent_queue;
 import infinity_exception;
 import buffer_obj;
+import async_io;
+import file_system;
+import file_system_type;
+import default_values;
 
 namespace infinity {
+
+namespace {
+
+// The file stays open until the readahead is completed.
+struct ReadaheadRequest : public AsyncIORequest {
+    UniquePtr<FileHandler> file_handler_{};
+};
+
+// Temp buffers are already spilled and cheap to evict; index buffers are the most expensive to load again.
+SizeT GCListIdx(FileWorkerType file_worker_type, bool is_temp, bool reused) {
+    SizeT priority = 1;
+    if (is_temp) {
+        priority = 0;
+    } else if (file_worker_type == FileWorkerType::kIndexFile || file_worker_type == FileWorkerType::kRawFile) {
+        priority = 2;
+    }
+    return reused ? 3 + priority : priority;
+}
+
+} // namespace
+
 BufferManager::BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir)
     : data_dir_(std::move(data_dir)), temp_dir_(std::move(temp_dir)), memory_limit_(memory_limit), current_memory_size_(0) {
     LocalFileSystem fs;
@@ -36,10 +62,42 @@ BufferManager::BufferManager(u64 memory_limit, SharedPtr<String> data_dir, Share
     }
 
     fs.CleanupDirectory(*temp_dir_);
+
+    async_io_ = AsyncIO::Make(DEFAULT_ASYNC_IO_QUEUE_DEPTH);
+    LOG_TRACE(fmt::format("Buffer manager asynchronous I/O: {}", async_io_->Name()));
 }
 
 BufferManager::~BufferManager() { RemoveClean(); }
 
+void BufferManager::Readahead(const Vector<BufferObj *> &buffer_objs) {
+    // reap the finished readaheads, which closes their files
+    async_io_->Complete(0);
+
+    LocalFileSystem fs;
+    for (auto *buffer_obj : buffer_objs) {
+        if (buffer_obj == nullptr || !buffer_obj->OnDisk()) {
+            continue;
+        }
+        String file_path = buffer_obj->GetFilename();
+        if (!fs.Exists(file_path)) {
+            continue;
+        }
+        auto *request = new ReadaheadRequest();
+        request->file_handler_ = fs.OpenFile(file_path, FileFlags::READ_FLAG, FileLockType::kNoLock);
+        request->callback_ = [](AsyncIORequest *request) {
+            if (request->result_ < 0) {
+                LOG_TRACE(fmt::format("Readahead failed: {}", strerror(-request->result_)));
+            }
+            delete static_cast<ReadaheadRequest *>(request);
+        };
+        fs.SubmitReadahead(*async_io_, *request->file_handler_, request);
+    }
+    // a readahead only queues the reads in the kernel, most are done by now
+    async_io_->Complete(0);
+}
+
+void BufferManager::FinishReadahead() { async_io_->Complete(async_io_->InFlight()); }
+
 BufferObj *BufferManager::AllocateBufferObject(UniquePtr<FileWorker> file_worker) {
     String file_path = file_worker->GetFilePath();
     auto buffer_obj = MakeUnique<BufferObj>(this, true, std::move(file_worker));
@@ -96,7 +154,8 @@ void BufferManager::RemoveClean() {
         std::unique_lock lock(gc_locker_);
         for (auto *buffer_obj : clean_list) {
             if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-                gc_list_.erase(iter->second);
+                auto [list_idx, list_iter] = iter->second;
+                gc_lists_[list_idx].erase(list_iter);
                 gc_map_.erase(iter);
             }
         }
@@ -118,20 +177,43 @@ SizeT BufferManager::BufferedObjectCount() {
     return buffer_map_.size();
 }
 
+Vector<String> BufferManager::GetColdFiles() {
+    Vector<String> cold_files;
+    std::unique_lock lock(w_locker_);
+    for (const auto &[file_path, buffer_obj] : buffer_map_) {
+        if (buffer_obj->OnDisk()) {
+            cold_files.push_back(file_path);
+        }
+    }
+    return cold_files;
+}
+
+Vector<BufferStatistics> BufferManager::GetBufferStatistics() const {
+    Vector<BufferStatistics> statistics;
+    statistics.reserve(FILE_WORKER_TYPE_COUNT);
+    for (SizeT i = 0; i < FILE_WORKER_TYPE_COUNT; ++i) {
+        statistics.push_back({static_cast<FileWorkerType>(i), hit_counts_[i].load(), miss_counts_[i].load(), evict_counts_[i].load()});
+    }
+    return statistics;
+}
+
 void BufferManager::RequestSpace(SizeT need_size) {
     std::unique_lock lock(gc_locker_);
-    auto iter = gc_list_.begin();
-    while (current_memory_size_ + need_size > memory_limit_ && iter != gc_list_.end()) {
-        auto *buffer_obj = *iter;
-
-        // Free return false when the buffer is freed by cleanup
-        // will not dead lock because caller is in kNew or kFree state, and `buffer_obj` is in kUnloaded or state
-        if (buffer_obj->Free()) {
-            current_memory_size_ -= buffer_obj->GetBufferSize();
-            iter = gc_list_.erase(iter);
-            gc_map_.erase(buffer_obj);
-        } else {
-            ++iter;
+    for (auto &gc_list : gc_lists_) {
+        auto iter = gc_list.begin();
+        while (current_memory_size_ + need_size > memory_limit_ && iter != gc_list.end()) {
+            auto *buffer_obj = *iter;
+
+            // Free return false when the buffer is freed by cleanup
+            // will not dead lock because caller is in kNew or kFree state, and `buffer_obj` is in kUnloaded or state
+            if (buffer_obj->Free()) {
+                current_memory_size_ -= buffer_obj->GetBufferSize();
+                ++evict_counts_[static_cast<SizeT>(buffer_obj->file_worker()->Type())];
+                iter = gc_list.erase(iter);
+                gc_map_.erase(buffer_obj);
+            } else {
+                ++iter;
+            }
         }
     }
     if (current_memory_size_ + need_size > memory_limit_) {
@@ -140,14 +222,22 @@ void BufferManager::RequestSpace(SizeT need_size) {
     current_memory_size_ += need_size;
 }
 
-void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
+void BufferManager::PushGCQueue(BufferObj *buffer_obj, bool is_temp, bool reused) {
+    SizeT list_idx = GCListIdx(buffer_obj->file_worker()->Type(), is_temp, reused);
     std::unique_lock lock(gc_locker_);
     auto iter = gc_map_.find(buffer_obj);
     if (iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
+        auto [old_list_idx, old_list_iter] = iter->second;
+        gc_lists_[old_list_idx].erase(old_list_iter);
     }
-    gc_list_.push_back(buffer_obj);
-    gc_map_[buffer_obj] = --gc_list_.end();
+    auto &gc_list = gc_lists_[list_idx];
+    gc_list.push_back(buffer_obj);
+    gc_map_[buffer_obj] = {list_idx, --gc_list.end()};
+}
+
+void BufferManager::CountLoad(FileWorkerType type, bool hit) {
+    auto &counts = hit ? hit_counts_ : miss_counts_;
+    ++counts[static_cast<SizeT>(type)];
 }
 
 bool BufferManager::RemoveFromGCQueue(BufferObj *buffer_obj) {
@@ -200,7 +290,8 @@ void BufferManager::MoveTemp(BufferObj *buffer_obj) {
 
 bool BufferManager::RemoveFromGCQueueInner(BufferObj *buffer_obj) {
     if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
+        auto [list_idx, list_iter] = iter->second;
+        gc_lists_[list_idx].erase(list_iter);
         gc_map_.erase(iter);
         return true;
     }
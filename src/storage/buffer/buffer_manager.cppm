@@ -16,6 +16,7 @@ module;
 
 import stl;
 import file_worker;
+import async_io;
 // import specific_concurrent_queue;
 
 export module buffer_manager;
@@ -24,6 +25,14 @@ namespace infinity {
 
 class BufferObj;
 
+// Load and eviction counters of the buffer objects of one file worker type
+export struct BufferStatistics {
+    FileWorkerType type_{FileWorkerType::kInvalid};
+    u64 hit_count_{};
+    u64 miss_count_{};
+    u64 evict_count_{};
+};
+
 export class BufferManager {
 public:
     explicit BufferManager(u64 memory_limit, SharedPtr<String> data_dir, SharedPtr<String> temp_dir);
@@ -55,16 +64,34 @@ public:
 
     SizeT BufferedObjectCount();
 
+    Vector<BufferStatistics> GetBufferStatistics() const;
+
+    // Files of the persistent buffer objects that are not in memory, which are only read when the objects are loaded.
+    Vector<String> GetColdFiles();
+
     void RemoveClean();
 
+    // Issue asynchronous readahead for the files of buffer objects that will be loaded soon, so that
+    // their Load is served from the page cache. It doesn't wait for the I/O.
+    void Readahead(const Vector<BufferObj *> &buffer_objs);
+
+    // Wait for the readaheads in flight and close their files, called when a scan is done.
+    void FinishReadahead();
+
 private:
     friend class BufferObj;
 
     // BufferHandle calls it, before allocate memory. It will start GC if necessary.
     void RequestSpace(SizeT need_size);
 
-    // BufferHandle calls it, after unload.
-    void PushGCQueue(BufferObj *buffer_obj);
+    // BufferObj calls it when a loaded object takes less memory than it requested.
+    void ReleaseSpace(SizeT size) { current_memory_size_ -= size; }
+
+    // BufferHandle calls it, after unload. `reused` is whether the object was loaded again after its previous unload.
+    void PushGCQueue(BufferObj *buffer_obj, bool is_temp, bool reused);
+
+    // BufferObj calls it on load. A hit is a load that doesn't read the file.
+    void CountLoad(FileWorkerType type, bool hit);
 
     bool RemoveFromGCQueue(BufferObj *buffer_obj);
 
@@ -89,10 +116,20 @@ private:
     std::mutex w_locker_{};
     HashMap<String, UniquePtr<BufferObj>> buffer_map_{};
 
+    // Unloaded objects are evicted list by list in LRU order. The first lists are probationary: an object only gets
+    // into the protected lists when it is reused after an unload, so a one-off scan can't evict the hot objects.
+    // Within each half, temp buffers go first and index buffers last.
+    static constexpr SizeT GC_LIST_COUNT = 6;
+
     std::mutex gc_locker_{};
     using GCListIter = List<BufferObj *>::iterator;
-    HashMap<BufferObj *, GCListIter> gc_map_{};
-    List<BufferObj *> gc_list_{};
+    HashMap<BufferObj *, Pair<SizeT, GCListIter>> gc_map_{};
+    Array<List<BufferObj *>, GC_LIST_COUNT> gc_lists_{};
+
+    static constexpr SizeT FILE_WORKER_TYPE_COUNT = static_cast<SizeT>(FileWorkerType::kInvalid);
+    Array<Atomic<u64>, FILE_WORKER_TYPE_COUNT> hit_counts_{};
+    Array<Atomic<u64>, FILE_WORKER_TYPE_COUNT> miss_counts_{};
+    Array<Atomic<u64>, FILE_WORKER_TYPE_COUNT> evict_counts_{};
 
     std::mutex clean_locker_{};
     Vector<BufferObj *> clean_list_{};
@@ -100,6 +137,8 @@ private:
     std::mutex temp_locker_{};
     HashSet<BufferObj *> temp_set_;
     HashSet<BufferObj *> clean_temp_set_;
+
+    UniquePtr<AsyncIO> async_io_{};
 };
 
 } // namespace infinity
\ No newline at end of file
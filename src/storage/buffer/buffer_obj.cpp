@@ -48,24 +48,37 @@ BufferHandle BufferObj::Load() {
     std::unique_lock<std::mutex> locker(w_locker_);
     switch (status_) {
         case BufferStatus::kLoaded: {
+            buffer_mgr_->CountLoad(file_worker_->Type(), true);
             break;
         }
         case BufferStatus::kUnloaded: {
             if (!buffer_mgr_->RemoveFromGCQueue(this)) {
                 UnrecoverableError(fmt::format("attempt to buffer: {} status is UNLOADED, but not in GC queue", GetFilename()));
             }
+            buffer_mgr_->CountLoad(file_worker_->Type(), true);
+            reused_ = true;
             break;
         }
         case BufferStatus::kFreed: {
-            buffer_mgr_->RequestSpace(GetBufferSize());
+            buffer_mgr_->CountLoad(file_worker_->Type(), false);
+            reused_ = false;
+            SizeT request_size = GetBufferSize();
+            buffer_mgr_->RequestSpace(request_size);
             if (type_ == BufferType::kEphemeral) {
                 UnrecoverableError("Invalid state.");
             }
             bool from_spill = type_ != BufferType::kPersistent;
             file_worker_->ReadFromFile(from_spill);
+            // The memory cost is known after reading the file, when it is kept encoded in memory.
+            if (SizeT load_size = GetBufferSize(); load_size > request_size) {
+                buffer_mgr_->RequestSpace(load_size - request_size);
+            } else if (load_size < request_size) {
+                buffer_mgr_->ReleaseSpace(request_size - load_size);
+            }
             break;
         }
         case BufferStatus::kNew: {
+            reused_ = false;
             LOG_TRACE(fmt::format("Request memory {}", GetBufferSize()));
             buffer_mgr_->RequestSpace(GetBufferSize());
             file_worker_->AllocateInMemory();
@@ -180,12 +193,18 @@ void BufferObj::CleanupFile() const {
 
 void BufferObj::CleanupTempFile() const {
     std::unique_lock<std::mutex> locker(w_locker_);
-    if (type_ == BufferType::kTemp) {
+    // Spilled again since it was modified, its temp file is current. Once cleaned up it has to go however.
+    if (type_ == BufferType::kTemp && status_ != BufferStatus::kClean) {
         return;
     }
     file_worker_->CleanupTempFile();
 }
 
+bool BufferObj::OnDisk() const {
+    std::unique_lock<std::mutex> locker(w_locker_);
+    return status_ == BufferStatus::kFreed && type_ == BufferType::kPersistent;
+}
+
 void BufferObj::LoadInner() {
     std::unique_lock<std::mutex> locker(w_locker_);
     if (status_ != BufferStatus::kLoaded) {
@@ -208,7 +227,7 @@ void BufferObj::UnloadInner() {
         case BufferStatus::kLoaded: {
             --rc_;
             if (rc_ == 0) {
-                buffer_mgr_->PushGCQueue(this);
+                buffer_mgr_->PushGCQueue(this, type_ == BufferType::kTemp, reused_);
                 status_ = BufferStatus::kUnloaded;
             }
             break;
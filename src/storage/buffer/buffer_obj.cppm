@@ -87,6 +87,9 @@ public:
 
     FileWorker *file_worker() { return file_worker_.get(); }
 
+    // Whether the next Load will read the persistent file, i.e. whether a readahead is useful.
+    bool OnDisk() const;
+
 private:
     // Friend to encapsulate `Unload` interface and to increase `rc_`.
     friend class BufferHandle;
@@ -119,6 +122,8 @@ protected:
     BufferStatus status_{BufferStatus::kNew};
     BufferType type_{BufferType::kTemp};
     u64 rc_{0};
+    // loaded again after an unload since it was read into memory, which protects it from eviction by scans
+    bool reused_{false};
     const UniquePtr<FileWorker> file_worker_;
 };
 
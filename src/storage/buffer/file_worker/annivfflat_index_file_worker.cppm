@@ -29,6 +29,7 @@ import embedding_info;
 import create_index_info;
 import knn_expr;
 import column_def;
+import internal_types;
 
 namespace infinity {
 
@@ -102,8 +103,20 @@ void AnnIVFFlatIndexFileWorker<DataType>::AllocateInMemory() {
             data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType>(index_ivfflat->metric_type_, dimension, centroids_count));
             break;
         }
+        case kElemInt8: {
+            data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType, i8>(index_ivfflat->metric_type_, dimension, centroids_count));
+            break;
+        }
+        case kElemUInt8: {
+            data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType, u8>(index_ivfflat->metric_type_, dimension, centroids_count));
+            break;
+        }
+        case kElemFloat16: {
+            data_ = static_cast<void *>(new AnnIVFFlatIndexData<DataType, Float16T>(index_ivfflat->metric_type_, dimension, centroids_count));
+            break;
+        }
         default: {
-            UnrecoverableError("Index should be created on float embedding column now.");
+            UnrecoverableError("Index should be created on float, float16, int8 or uint8 embedding column now.");
         }
     }
 }
@@ -113,23 +126,87 @@ void AnnIVFFlatIndexFileWorker<DataType>::FreeInMemory() {
     if (!data_) {
         UnrecoverableError("Data is not allocated.");
     }
-    auto index = static_cast<AnnIVFFlatIndexData<DataType> *>(data_);
-    delete index;
+    switch (GetType()) {
+        case kElemFloat: {
+            delete static_cast<AnnIVFFlatIndexData<DataType> *>(data_);
+            break;
+        }
+        case kElemInt8: {
+            delete static_cast<AnnIVFFlatIndexData<DataType, i8> *>(data_);
+            break;
+        }
+        case kElemUInt8: {
+            delete static_cast<AnnIVFFlatIndexData<DataType, u8> *>(data_);
+            break;
+        }
+        case kElemFloat16: {
+            delete static_cast<AnnIVFFlatIndexData<DataType, Float16T> *>(data_);
+            break;
+        }
+        default: {
+            UnrecoverableError("Index should be created on float, float16, int8 or uint8 embedding column now.");
+        }
+    }
     data_ = nullptr;
 }
 
 template <typename DataType>
 void AnnIVFFlatIndexFileWorker<DataType>::WriteToFileImpl(bool to_spill, bool &prepare_success) {
-    auto *index = static_cast<AnnIVFFlatIndexData<DataType> *>(data_);
-    index->SaveIndexInner(*file_handler_);
+    switch (GetType()) {
+        case kElemFloat: {
+            static_cast<AnnIVFFlatIndexData<DataType> *>(data_)->SaveIndexInner(*file_handler_);
+            break;
+        }
+        case kElemInt8: {
+            static_cast<AnnIVFFlatIndexData<DataType, i8> *>(data_)->SaveIndexInner(*file_handler_);
+            break;
+        }
+        case kElemUInt8: {
+            static_cast<AnnIVFFlatIndexData<DataType, u8> *>(data_)->SaveIndexInner(*file_handler_);
+            break;
+        }
+        case kElemFloat16: {
+            static_cast<AnnIVFFlatIndexData<DataType, Float16T> *>(data_)->SaveIndexInner(*file_handler_);
+            break;
+        }
+        default: {
+            UnrecoverableError("Index should be created on float, float16, int8 or uint8 embedding column now.");
+        }
+    }
     prepare_success = true;
 }
 
 template <typename DataType>
 void AnnIVFFlatIndexFileWorker<DataType>::ReadFromFileImpl() {
-    data_ = new AnnIVFFlatIndexData<DataType>();
-    auto *index = static_cast<AnnIVFFlatIndexData<DataType> *>(data_);
-    index->ReadIndexInner(*file_handler_);
+    switch (GetType()) {
+        case kElemFloat: {
+            auto *index = new AnnIVFFlatIndexData<DataType>();
+            index->ReadIndexInner(*file_handler_);
+            data_ = index;
+            break;
+        }
+        case kElemInt8: {
+            auto *index = new AnnIVFFlatIndexData<DataType, i8>();
+            index->ReadIndexInner(*file_handler_);
+            data_ = index;
+            break;
+        }
+        case kElemUInt8: {
+            auto *index = new AnnIVFFlatIndexData<DataType, u8>();
+            index->ReadIndexInner(*file_handler_);
+            data_ = index;
+            break;
+        }
+        case kElemFloat16: {
+            auto *index = new AnnIVFFlatIndexData<DataType, Float16T>();
+            index->ReadIndexInner(*file_handler_);
+            data_ = index;
+            break;
+        }
+        default: {
+            UnrecoverableError("Index should be created on float, float16, int8 or uint8 embedding column now.");
+        }
+    }
 }
 
 template <typename DataType>
@@ -22,11 +22,20 @@ import local_file_system;
 import third_party;
 import status;
 import logger;
+import column_encoding;
+import bitmask;
 
 namespace infinity {
 
-DataFileWorker::DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size)
-    : FileWorker(std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size) {}
+namespace {
+
+constexpr u64 PLAIN_MAGIC_NUMBER = 0x00dd3344;
+constexpr u64 ENCODED_MAGIC_NUMBER = 0x00dd3345;
+
+} // namespace
+
+DataFileWorker::DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size, SizeT elem_size)
+    : FileWorker(std::move(file_dir), std::move(file_name)), buffer_size_(buffer_size), elem_size_(elem_size) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -43,6 +52,7 @@ void DataFileWorker::AllocateInMemory() {
         UnrecoverableError("Buffer size is 0.");
     }
     data_ = static_cast<void *>(new char[buffer_size_]{});
+    encoding_type_ = ColumnEncodingType::kPlain;
 }
 
 void DataFileWorker::FreeInMemory() {
@@ -59,10 +69,25 @@ void DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
     // File structure:
     // - header: magic number
     // - header: buffer size
-    // - data buffer
-    // - footer: checksum
+    // - header: encoding type | elem size << 8, encoded size (encoded file only)
+    // - data buffer, or the encoded data buffer
+    // - footer: checksum, always 0. FileWorker appends the CRC32C footer after it.
+
+    // A spilled buffer is read back soon, so only the checkpoint pays for the encoding. Data kept encoded in memory is
+    // written as it is.
+    Vector<u8> encoded;
+    ColumnEncodingType encoding_type = encoding_type_;
+    const void *encoded_data = data_;
+    SizeT encoded_size = encoded_size_;
+    SizeT elem_size = encoded_elem_size_;
+    if (encoding_type == ColumnEncodingType::kPlain && !to_spill && sealed_ && elem_size_ > 0) {
+        encoding_type = ColumnEncoding::Encode(data_, buffer_size_, elem_size_, encoded);
+        encoded_data = encoded.data();
+        encoded_size = encoded.size();
+        elem_size = elem_size_;
+    }
 
-    u64 magic_number = 0x00dd3344;
+    u64 magic_number = encoding_type == ColumnEncodingType::kPlain ? PLAIN_MAGIC_NUMBER : ENCODED_MAGIC_NUMBER;
     u64 nbytes = fs.Write(*file_handler_, &magic_number, sizeof(magic_number));
     if (nbytes != sizeof(magic_number)) {
         Status status = Status::DataIOError(fmt::format("Write magic number which length is {}.", nbytes));
@@ -77,11 +102,29 @@ void DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
         RecoverableError(status);
     }
 
-    nbytes = fs.Write(*file_handler_, data_, buffer_size_);
-    if (nbytes != buffer_size_) {
-        Status status = Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes));
-        LOG_ERROR(status.message());
-        RecoverableError(status);
+    if (encoding_type == ColumnEncodingType::kPlain) {
+        nbytes = fs.Write(*file_handler_, data_, buffer_size_);
+        if (nbytes != buffer_size_) {
+            Status status =
+                Status::DataIOError(fmt::format("Expect to write buffer with size: {}, but {} bytes is written", buffer_size_, nbytes));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    } else {
+        u64 encoding_header[2] = {static_cast<u64>(encoding_type) | (elem_size << 8), encoded_size};
+        nbytes = fs.Write(*file_handler_, encoding_header, sizeof(encoding_header));
+        if (nbytes != sizeof(encoding_header)) {
+            Status status = Status::DataIOError(fmt::format("Write encoding header which length is {}.", nbytes));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        nbytes = fs.Write(*file_handler_, const_cast<void *>(encoded_data), encoded_size);
+        if (nbytes != encoded_size) {
+            Status status =
+                Status::DataIOError(fmt::format("Expect to write encoded buffer with size: {}, but {} bytes is written", encoded_size, nbytes));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
     }
 
     u64 checksum{};
@@ -97,7 +140,7 @@ void DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
 void DataFileWorker::ReadFromFileImpl() {
     LocalFileSystem fs;
 
-    SizeT file_size = fs.GetFileSize(*file_handler_);
+    SizeT file_size = PayloadSize();
     if (file_size < sizeof(u64) * 3) {
         Status status = Status::DataIOError(fmt::format("Incorrect file length {}.", file_size));
         LOG_ERROR(status.message());
@@ -112,7 +155,7 @@ void DataFileWorker::ReadFromFileImpl() {
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
-    if (magic_number != 0x00dd3344) {
+    if (magic_number != PLAIN_MAGIC_NUMBER && magic_number != ENCODED_MAGIC_NUMBER) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes));
         LOG_ERROR(status.message());
         RecoverableError(status);
@@ -125,29 +168,86 @@ void DataFileWorker::ReadFromFileImpl() {
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
-    if (file_size != buffer_size_ + 3 * sizeof(u64)) {
-        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
+    if (magic_number == ENCODED_MAGIC_NUMBER) {
+        ReadEncoded(file_size);
+    } else {
+        if (file_size != buffer_size_ + 3 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+
+        // file body
+        data_ = static_cast<void *>(new char[buffer_size_]{});
+        nbytes = fs.Read(*file_handler_, data_, buffer_size_);
+        if (nbytes != buffer_size_) {
+            Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes));
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+        encoding_type_ = ColumnEncodingType::kPlain;
+    }
+
+    // file footer: checksum
+    u64 checksum{0};
+    nbytes = fs.Read(*file_handler_, &checksum, sizeof(checksum));
+    if (nbytes != sizeof(checksum)) {
+        Status status = Status::DataIOError(fmt::format("Incorrect file checksum length: {}.", nbytes));
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
+}
 
-    // file body
-    data_ = static_cast<void *>(new char[buffer_size_]{});
-    nbytes = fs.Read(*file_handler_, data_, buffer_size_);
-    if (nbytes != buffer_size_) {
-        Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes));
+void DataFileWorker::ReadEncoded(SizeT file_size) {
+    LocalFileSystem fs;
+    u64 encoding_header[2]{};
+    u64 nbytes = fs.Read(*file_handler_, encoding_header, sizeof(encoding_header));
+    if (nbytes != sizeof(encoding_header)) {
+        Status status = Status::DataIOError(fmt::format("Read encoding header which length isn't {}.", nbytes));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    auto encoding_type = static_cast<ColumnEncodingType>(encoding_header[0] & 0xff);
+    SizeT elem_size = encoding_header[0] >> 8;
+    SizeT encoded_size = encoding_header[1];
+    if (encoding_type == ColumnEncodingType::kPlain || file_size != encoded_size + 5 * sizeof(u64)) {
+        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 5 * sizeof(u64)));
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
 
-    // file footer: checksum
-    u64 checksum{0};
-    nbytes = fs.Read(*file_handler_, &checksum, sizeof(checksum));
-    if (nbytes != sizeof(checksum)) {
-        Status status = Status::DataIOError(fmt::format("Incorrect file checksum length: {}.", nbytes));
+    // The data stays encoded in memory, it is decoded by the readers.
+    data_ = static_cast<void *>(new char[encoded_size]{});
+    nbytes = fs.Read(*file_handler_, data_, encoded_size);
+    if (nbytes != encoded_size) {
+        delete[] static_cast<char *>(data_);
+        data_ = nullptr;
+        Status status = Status::DataIOError(fmt::format("Expect to read encoded buffer with size: {}, but {} bytes is read", encoded_size, nbytes));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    encoding_type_ = encoding_type;
+    encoded_size_ = encoded_size;
+    encoded_elem_size_ = elem_size;
+}
+
+void DataFileWorker::Decode(void *data, SizeT size) const {
+    if (!ColumnEncoding::Decode(encoding_type_, static_cast<const u8 *>(data_), encoded_size_, encoded_elem_size_, data, size)) {
+        Status status = Status::DataIOError(fmt::format("Corrupted {} encoded file: {}", ColumnEncodingTypeToString(encoding_type_), GetFilePath()));
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
 }
 
-} // namespace infinity
\ No newline at end of file
+bool DataFileWorker::Filter(const EncodedColumnFilter &filter, SizeT count, Bitmask &selected) const {
+    return ColumnEncoding::Filter(encoding_type_,
+                                  static_cast<const u8 *>(data_),
+                                  encoded_size_,
+                                  encoded_elem_size_,
+                                  count,
+                                  filter.compare_type_,
+                                  filter.value_,
+                                  selected);
+}
+
+} // namespace infinity
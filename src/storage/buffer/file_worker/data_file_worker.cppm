@@ -18,12 +18,16 @@ export module data_file_worker;
 
 import stl;
 import file_worker;
+import column_encoding;
+import bitmask;
 
 namespace infinity {
 
 export class DataFileWorker : public FileWorker {
 public:
-    explicit DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size);
+    // elem_size is the width of the fixed width values in the buffer. When it is not 0 and the buffer is sealed, it is
+    // written with a column encoding at checkpoint if that makes the file smaller.
+    explicit DataFileWorker(SharedPtr<String> file_dir, SharedPtr<String> file_name, SizeT buffer_size, SizeT elem_size = 0);
 
     virtual ~DataFileWorker() override;
 
@@ -32,7 +36,24 @@ public:
 
     void FreeInMemory() override;
 
-    SizeT GetMemoryCost() const override { return buffer_size_; }
+    // An encoded file is kept encoded in memory.
+    SizeT GetMemoryCost() const override { return encoding_type_ == ColumnEncodingType::kPlain ? buffer_size_ : encoded_size_; }
+
+    FileWorkerType Type() const override { return FileWorkerType::kDataFile; }
+
+    SizeT BufferSize() const { return buffer_size_; }
+
+    // The buffer won't be modified any more, so it can be encoded when written and kept encoded when read back.
+    void Seal() { sealed_ = true; }
+
+    // Whether the data in memory is encoded, then it has to be decoded with Decode instead of being read directly.
+    bool Encoded() const { return encoding_type_ != ColumnEncodingType::kPlain; }
+
+    // Decode the data in memory into the `size` bytes of `data`.
+    void Decode(void *data, SizeT size) const;
+
+    // Evaluate `filter` on the `count` values of the encoded data in memory, see ColumnEncoding::Filter.
+    bool Filter(const EncodedColumnFilter &filter, SizeT count, Bitmask &selected) const;
 
 protected:
     void WriteToFileImpl(bool to_spill, bool &prepare_success) override;
@@ -40,6 +61,17 @@ protected:
     void ReadFromFileImpl() override;
 
 private:
+    // Read the body of a file written with a column encoding, the file header is already read.
+    void ReadEncoded(SizeT file_size);
+
     const SizeT buffer_size_;
+    const SizeT elem_size_;
+    bool sealed_{false};
+
+    // The encoding of the data in memory, and the size and width of its values when it is encoded. It is kept after
+    // FreeInMemory so that the memory cost is the same when the buffer is loaded again.
+    ColumnEncodingType encoding_type_{ColumnEncodingType::kPlain};
+    SizeT encoded_size_{};
+    SizeT encoded_elem_size_{};
 };
 } // namespace infinity
\ No newline at end of file
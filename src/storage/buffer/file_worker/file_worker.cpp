@@ -43,7 +43,8 @@ void FileWorker::WriteToFile(bool to_spill) {
     }
     String write_path = fmt::format("{}/{}", write_dir, *file_name_);
 
-    u8 flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+    // The file is rewritten as a whole, and may be shorter than the previous version of it.
+    u8 flags = FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE;
     file_handler_ = fs.OpenFile(write_path, flags, FileLockType::kWriteLock);
     if (to_spill) {
         auto local_file_handle = static_cast<LocalFileHandler *>(file_handler_.get());
@@ -56,7 +57,17 @@ void FileWorker::WriteToFile(bool to_spill) {
         file_handler_ = nullptr;
     });
 
+    file_handler_->StartChecksum();
     WriteToFileImpl(to_spill, prepare_success);
+    file_handler_->StopChecksum();
+
+    FileChecksumFooter footer{file_handler_->checksum_size(), file_handler_->checksum(), FileChecksumFooter::MAGIC};
+    i64 nbytes = fs.Write(*file_handler_, &footer, sizeof(footer));
+    if (nbytes != sizeof(footer)) {
+        Status status = Status::DataIOError(fmt::format("Write checksum footer which length is {}.", nbytes));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
     if (prepare_success) {
         if (to_spill) {
             LOG_TRACE(fmt::format("Write to spill file {} finished. success {}", write_path, prepare_success));
@@ -75,7 +86,50 @@ void FileWorker::ReadFromFile(bool from_spill) {
         file_handler_->Close();
         file_handler_ = nullptr;
     });
+
+    FileChecksumFooter footer;
+    bool has_footer = FileChecksumFooter::ReadFooter(*file_handler_, footer);
+    payload_size_ = has_footer ? footer.payload_size_ : fs.GetFileSize(*file_handler_);
+
+    file_handler_->StartChecksum();
     ReadFromFileImpl();
+    if (has_footer) {
+        VerifyChecksum(footer);
+    }
+}
+
+bool FileChecksumFooter::ReadFooter(FileHandler &file_handler, FileChecksumFooter &footer) {
+    SizeT file_size = file_handler.file_system_.GetFileSize(file_handler);
+    if (file_size < sizeof(FileChecksumFooter)) {
+        return false;
+    }
+    i64 nbytes = file_handler.file_system_.ReadAt(file_handler, file_size - sizeof(FileChecksumFooter), &footer, sizeof(FileChecksumFooter));
+    return nbytes == sizeof(FileChecksumFooter) && footer.Valid(file_size);
+}
+
+void FileWorker::VerifyChecksum(const FileChecksumFooter &footer) {
+    LocalFileSystem fs;
+    // The loader may not read the payload to its end.
+    constexpr SizeT read_size = 1024 * 1024;
+    Vector<char> buffer;
+    while (file_handler_->checksum_size() < footer.payload_size_) {
+        SizeT nbytes = std::min(read_size, footer.payload_size_ - file_handler_->checksum_size());
+        buffer.resize(nbytes);
+        if (fs.Read(*file_handler_, buffer.data(), nbytes) <= 0) {
+            break;
+        }
+    }
+    file_handler_->StopChecksum();
+
+    if (file_handler_->checksum_size() != footer.payload_size_ || file_handler_->checksum() != footer.checksum_) {
+        if (data_ != nullptr) {
+            FreeInMemory();
+            data_ = nullptr;
+        }
+        Status status = Status::DataCorrupted(file_handler_->path_.string());
+        LOG_ERROR(fmt::format("{}, checksum: {:#x}, expected: {:#x}", status.message(), file_handler_->checksum(), footer.checksum_));
+        RecoverableError(status);
+    }
 }
 
 void FileWorker::MoveFile() {
@@ -22,6 +22,49 @@ import third_party;
 
 namespace infinity {
 
+export enum class FileWorkerType {
+    kDataFile,
+    kVersionFile,
+    kIndexFile,
+    kRawFile,
+
+    kInvalid,
+};
+
+export String FileWorkerTypeToString(FileWorkerType type) {
+    switch (type) {
+        case FileWorkerType::kDataFile:
+            return "data";
+        case FileWorkerType::kVersionFile:
+            return "version";
+        case FileWorkerType::kIndexFile:
+            return "index";
+        case FileWorkerType::kRawFile:
+            return "raw";
+        default:
+            return "invalid";
+    }
+}
+
+// Appended to every file written by a file worker, to detect torn or corrupted files on load.
+export struct FileChecksumFooter {
+    static constexpr u32 MAGIC = 0x43524332;
+
+    // CRC32C of the bytes before the footer
+    u64 payload_size_{};
+    u32 checksum_{};
+    u32 magic_{};
+
+    // Files written by older versions have no footer.
+    bool Valid(SizeT file_size) const { return magic_ == MAGIC && payload_size_ + sizeof(FileChecksumFooter) == file_size; }
+
+    bool operator==(const FileChecksumFooter &other) const = default;
+
+    // Read the footer at the end of the file, return false if the file has none.
+    static bool ReadFooter(FileHandler &file_handler, FileChecksumFooter &footer);
+};
+static_assert(sizeof(FileChecksumFooter) == 16);
+
 export class FileWorker {
 public:
     // spill_dir_ is not init here
@@ -43,6 +86,8 @@ public:
 
     virtual SizeT GetMemoryCost() const = 0;
 
+    virtual FileWorkerType Type() const = 0;
+
     void *GetData() { return data_; }
 
     void SetBaseTempDir(SharedPtr<String> base_dir, SharedPtr<String> temp_dir) {
@@ -62,9 +107,15 @@ protected:
 
     virtual void ReadFromFileImpl() = 0;
 
+    // Size of the file being read, without the checksum footer. Only valid in ReadFromFileImpl.
+    SizeT PayloadSize() const { return payload_size_; }
+
 private:
     String ChooseFileDir(bool spill) const { return spill ? fmt::format("{}{}", *temp_dir_, *file_dir_) : *file_dir_; }
 
+    // Called after ReadFromFileImpl, which has checksummed what it read.
+    void VerifyChecksum(const FileChecksumFooter &footer);
+
 public:
     const SharedPtr<String> file_dir_{};
     const SharedPtr<String> file_name_{};
@@ -74,6 +125,8 @@ protected:
     UniquePtr<FileHandler> file_handler_{nullptr};
 
 private:
+    SizeT payload_size_{};
+
     // following members are not init in constructor
     SharedPtr<String> base_dir_{};
     SharedPtr<String> temp_dir_{};
@@ -65,8 +65,27 @@ void HnswFileWorker::AllocateInMemory() {
             data_ = abstract_hnsw.RawPtr();
             break;
         }
+        case kElemInt8: {
+            AbstractHnsw<i8, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Make(chunk_size_, max_chunk_num_, dimension, M, ef_c);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
+        case kElemFloat16: {
+            AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Make(chunk_size_, max_chunk_num_, dimension, M, ef_c);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
+        case kElemBit:
+        case kElemUInt8: {
+            AbstractHnsw<u8, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Make(chunk_size_, max_chunk_num_, dimension, M, ef_c);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
         default: {
-            UnrecoverableError("Index should be created on float embedding column now.");
+            UnrecoverableError("Index should be created on float, float16, int8, uint8 or bit embedding column now.");
         }
     }
 }
@@ -83,8 +102,24 @@ void HnswFileWorker::FreeInMemory() {
             abstract_hnsw.Free();
             break;
         }
+        case kElemInt8: {
+            AbstractHnsw<i8, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Free();
+            break;
+        }
+        case kElemFloat16: {
+            AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Free();
+            break;
+        }
+        case kElemBit:
+        case kElemUInt8: {
+            AbstractHnsw<u8, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Free();
+            break;
+        }
         default: {
-            UnrecoverableError(fmt::format("Index should be created on float embedding column now, type: {}",
+            UnrecoverableError(fmt::format("Index should be created on float, float16, int8, uint8 or bit embedding column now, type: {}",
                                            EmbeddingType::EmbeddingDataType2String(embedding_type)));
         }
     }
@@ -103,8 +138,24 @@ void HnswFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
             abstract_hnsw.Save(*file_handler_);
             break;
         }
+        case kElemInt8: {
+            AbstractHnsw<i8, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Save(*file_handler_);
+            break;
+        }
+        case kElemFloat16: {
+            AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Save(*file_handler_);
+            break;
+        }
+        case kElemBit:
+        case kElemUInt8: {
+            AbstractHnsw<u8, SegmentOffset> abstract_hnsw(data_, index_hnsw);
+            abstract_hnsw.Save(*file_handler_);
+            break;
+        }
         default: {
-            UnrecoverableError("Index should be created on float embedding column now.");
+            UnrecoverableError("Index should be created on float, float16, int8, uint8 or bit embedding column now.");
         }
     }
     prepare_success = true;
@@ -121,8 +172,27 @@ void HnswFileWorker::ReadFromFileImpl() {
             data_ = abstract_hnsw.RawPtr();
             break;
         }
+        case kElemInt8: {
+            AbstractHnsw<i8, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Load(*file_handler_);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
+        case kElemFloat16: {
+            AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Load(*file_handler_);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
+        case kElemBit:
+        case kElemUInt8: {
+            AbstractHnsw<u8, SegmentOffset> abstract_hnsw(nullptr, index_hnsw);
+            abstract_hnsw.Load(*file_handler_);
+            data_ = abstract_hnsw.RawPtr();
+            break;
+        }
         default: {
-            UnrecoverableError("Index should be created on float embedding column now.");
+            UnrecoverableError("Index should be created on float, float16, int8, uint8 or bit embedding column now.");
         }
     }
 }
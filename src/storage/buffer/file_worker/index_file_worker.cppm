@@ -46,6 +46,8 @@ public:
 
     SizeT GetMemoryCost() const override { return 0; }
 
+    FileWorkerType Type() const override { return FileWorkerType::kIndexFile; }
+
     ~IndexFileWorker() override = default;
 };
 
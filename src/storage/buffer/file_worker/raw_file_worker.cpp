@@ -68,7 +68,7 @@ void RawFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success) {
 
 void RawFileWorker::ReadFromFileImpl() {
     LocalFileSystem fs;
-    buffer_size_ = fs.GetFileSize(*file_handler_);
+    buffer_size_ = PayloadSize();
     data_ = static_cast<void *>(new char[buffer_size_]);
     i64 nbytes = fs.Read(*file_handler_, data_, buffer_size_);
     if (nbytes != (i64)buffer_size_) {
@@ -38,6 +38,8 @@ public:
 
     SizeT GetMemoryCost() const override { return buffer_size_; }
 
+    FileWorkerType Type() const override { return FileWorkerType::kRawFile; }
+
 protected:
     void WriteToFileImpl(bool to_spill, bool &prepare_success) override;
 
@@ -34,6 +34,8 @@ public:
 
     SizeT GetMemoryCost() const override;
 
+    FileWorkerType Type() const override { return FileWorkerType::kVersionFile; }
+
     void SetCheckpointTS(TxnTimeStamp ts) { checkpoint_ts_ = ts; }
 
 protected:
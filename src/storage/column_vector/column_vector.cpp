@@ -1509,6 +1509,14 @@ void ColumnVector::AppendByStringView(std::string_view sv, char delimiter) {
                     AppendEmbedding<DoubleT>(ele_str_views, dst_off);
                     break;
                 }
+                case kElemUInt8: {
+                    AppendEmbedding<UInt8T>(ele_str_views, dst_off);
+                    break;
+                }
+                case kElemFloat16: {
+                    AppendEmbedding<Float16T>(ele_str_views, dst_off);
+                    break;
+                }
                 default: {
                     UnrecoverableError("Invalid embedding type");
                 }
@@ -1740,6 +1748,24 @@ void ColumnVector::AppendByConstantExpr(const ConstantExpr *const_expr) {
                     AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
                     break;
                 }
+                case kElemUInt8: {
+                    Vector<UInt8T> embedding;
+                    embedding.reserve(const_expr->long_array_.size());
+                    std::transform(const_expr->long_array_.begin(), const_expr->long_array_.end(), std::back_inserter(embedding), [](auto &v) {
+                        return static_cast<UInt8T>(v);
+                    });
+                    AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                    break;
+                }
+                case kElemFloat16: {
+                    Vector<Float16T> embedding;
+                    embedding.reserve(const_expr->double_array_.size());
+                    std::transform(const_expr->double_array_.begin(), const_expr->double_array_.end(), std::back_inserter(embedding), [](auto &v) {
+                        return Float16T(static_cast<float>(v));
+                    });
+                    AppendByPtr(reinterpret_cast<const_ptr_t>(embedding.data()));
+                    break;
+                }
                 default: {
                     UnrecoverableError("Not implement: Embedding type.");
                 }
@@ -210,6 +210,8 @@ public:
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemBit, vec.size()));
         } else if constexpr (std::is_same_v<T, i8>) {
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemInt8, vec.size()));
+        } else if constexpr (std::is_same_v<T, u8>) {
+            value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemUInt8, vec.size()));
         } else if constexpr (std::is_same_v<T, i16>) {
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemInt16, vec.size()));
         } else if constexpr (std::is_same_v<T, i32>) {
@@ -218,6 +220,8 @@ public:
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemInt64, vec.size()));
         } else if constexpr (std::is_same_v<T, float>) {
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat, vec.size()));
+        } else if constexpr (std::is_same_v<T, Float16T>) {
+            value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemFloat16, vec.size()));
         } else if constexpr (std::is_same_v<T, double>) {
             value.type_ = DataType(LogicalType::kEmbedding, EmbeddingInfo::Make(EmbeddingDataType::kElemDouble, vec.size()));
         } else {
@@ -22,6 +22,7 @@ import buffer_manager;
 import buffer_handle;
 import infinity_exception;
 import block_column_entry;
+import data_file_worker;
 import default_values;
 
 namespace infinity {
@@ -129,10 +130,19 @@ void VectorBuffer::Initialize(BufferManager *buffer_mgr, BlockColumnEntry *block
     if (buffer_obj == nullptr) {
         UnrecoverableError("Buffer object is nullptr.");
     }
-    if (buffer_obj->GetBufferSize() != data_size) {
+    auto *file_worker = static_cast<DataFileWorker *>(buffer_obj->file_worker());
+    if (file_worker->BufferSize() != data_size) {
         UnrecoverableError("Buffer object size is not equal to data size.");
     }
-    ptr_ = buffer_obj->Load();
+    BufferHandle buffer_handle = buffer_obj->Load();
+    if (file_worker->Encoded()) {
+        // A sealed column stays encoded in the buffer manager, each vector reading it decodes its own copy.
+        auto decoded = MakeUniqueForOverwrite<char[]>(data_size);
+        file_worker->Decode(decoded.get(), data_size);
+        ptr_ = std::move(decoded);
+    } else {
+        ptr_ = std::move(buffer_handle);
+    }
     if (buffer_type_ == VectorBufferType::kHeap) {
         fix_heap_mgr_ = MakeUnique<FixHeapManager>(0, buffer_mgr, block_column_entry, DEFAULT_FIXLEN_CHUNK_SIZE);
     } else if (buffer_type_ == VectorBufferType::kTensorHeap) {
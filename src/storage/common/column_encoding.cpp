@@ -0,0 +1,408 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module column_encoding;
+
+import stl;
+import fastpfor;
+import bitmask;
+import filter_expression_push_down_helper;
+
+namespace infinity {
+
+namespace {
+
+// more distinct values than this are left to the other encodings
+constexpr SizeT MAX_DICTIONARY_SIZE = 65536;
+
+template <typename T>
+void AppendValue(Vector<u8> &out, T value) {
+    SizeT offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+void AppendBytes(Vector<u8> &out, const void *data, SizeT size) {
+    SizeT offset = out.size();
+    out.resize(offset + size);
+    std::memcpy(out.data() + offset, data, size);
+}
+
+template <typename T>
+bool ReadValue(const u8 *&ptr, const u8 *end, T &value) {
+    if (end - ptr < (i64)sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+// The packed words are appended behind their count. The codec relies on the alignment of its buffers, so the words
+// are always packed and unpacked in a buffer of their own.
+void PackU32(const Vector<u32> &values, Vector<u8> &out) {
+    SIMDBitPacking codec;
+    SizeT word_count = values.size() + 1024;
+    Vector<u32> words(word_count);
+    codec.Compress(values.data(), values.size(), words.data(), word_count);
+    AppendValue<u32>(out, word_count);
+    AppendBytes(out, words.data(), word_count * sizeof(u32));
+}
+
+bool UnpackU32(const u8 *&ptr, const u8 *end, SizeT value_count, Vector<u32> &values) {
+    u32 word_count = 0;
+    if (!ReadValue(ptr, end, word_count) || (SizeT)(end - ptr) < word_count * sizeof(u32)) {
+        return false;
+    }
+    Vector<u32> words(word_count);
+    std::memcpy(words.data(), ptr, word_count * sizeof(u32));
+    ptr += word_count * sizeof(u32);
+
+    SIMDBitPacking codec;
+    values.resize(value_count);
+    SizeT out_count = value_count;
+    codec.Decompress(words.data(), word_count, values.data(), out_count);
+    return out_count == value_count;
+}
+
+i64 LoadSigned(const u8 *ptr, SizeT elem_size) {
+    switch (elem_size) {
+        case 1: {
+            i8 value;
+            std::memcpy(&value, ptr, 1);
+            return value;
+        }
+        case 2: {
+            i16 value;
+            std::memcpy(&value, ptr, 2);
+            return value;
+        }
+        case 4: {
+            i32 value;
+            std::memcpy(&value, ptr, 4);
+            return value;
+        }
+        default: {
+            i64 value;
+            std::memcpy(&value, ptr, 8);
+            return value;
+        }
+    }
+}
+
+void StoreSigned(u8 *ptr, SizeT elem_size, i64 value) {
+    switch (elem_size) {
+        case 1: {
+            auto narrow = static_cast<i8>(value);
+            std::memcpy(ptr, &narrow, 1);
+            break;
+        }
+        case 2: {
+            auto narrow = static_cast<i16>(value);
+            std::memcpy(ptr, &narrow, 2);
+            break;
+        }
+        case 4: {
+            auto narrow = static_cast<i32>(value);
+            std::memcpy(ptr, &narrow, 4);
+            break;
+        }
+        default: {
+            std::memcpy(ptr, &value, 8);
+            break;
+        }
+    }
+}
+
+// Each encoder gives up and returns false as soon as its output reaches `limit` bytes.
+
+bool EncodeRunLength(const u8 *data, SizeT count, SizeT elem_size, SizeT limit, Vector<u8> &out) {
+    for (SizeT i = 0; i < count;) {
+        SizeT j = i + 1;
+        while (j < count && j - i < std::numeric_limits<u32>::max() && std::memcmp(data + j * elem_size, data + i * elem_size, elem_size) == 0) {
+            ++j;
+        }
+        AppendValue<u32>(out, j - i);
+        AppendBytes(out, data + i * elem_size, elem_size);
+        if (out.size() >= limit) {
+            return false;
+        }
+        i = j;
+    }
+    return true;
+}
+
+bool DecodeRunLength(const u8 *ptr, const u8 *end, SizeT count, SizeT elem_size, u8 *data) {
+    for (SizeT i = 0; i < count;) {
+        u32 run_length = 0;
+        if (!ReadValue(ptr, end, run_length) || run_length == 0 || run_length > count - i || (SizeT)(end - ptr) < elem_size) {
+            return false;
+        }
+        for (u32 j = 0; j < run_length; ++j, ++i) {
+            std::memcpy(data + i * elem_size, ptr, elem_size);
+        }
+        ptr += elem_size;
+    }
+    return ptr == end;
+}
+
+bool EncodeDictionary(const u8 *data, SizeT count, SizeT elem_size, SizeT limit, Vector<u8> &out) {
+    HashMap<std::string_view, u32> codes_map;
+    Vector<const u8 *> dictionary;
+    Vector<u32> codes(count);
+    for (SizeT i = 0; i < count; ++i) {
+        const u8 *value = data + i * elem_size;
+        auto [iter, inserted] = codes_map.emplace(std::string_view(reinterpret_cast<const char *>(value), elem_size), dictionary.size());
+        if (inserted) {
+            dictionary.push_back(value);
+            if (dictionary.size() > MAX_DICTIONARY_SIZE || dictionary.size() * elem_size >= limit) {
+                return false;
+            }
+        }
+        codes[i] = iter->second;
+    }
+    AppendValue<u32>(out, dictionary.size());
+    for (const u8 *value : dictionary) {
+        AppendBytes(out, value, elem_size);
+    }
+    PackU32(codes, out);
+    return out.size() < limit;
+}
+
+bool DecodeDictionary(const u8 *ptr, const u8 *end, SizeT count, SizeT elem_size, u8 *data) {
+    u32 dictionary_size = 0;
+    if (!ReadValue(ptr, end, dictionary_size) || (SizeT)(end - ptr) < dictionary_size * elem_size) {
+        return false;
+    }
+    const u8 *dictionary = ptr;
+    ptr += dictionary_size * elem_size;
+    Vector<u32> codes;
+    if (!UnpackU32(ptr, end, count, codes) || ptr != end) {
+        return false;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        if (codes[i] >= dictionary_size) {
+            return false;
+        }
+        std::memcpy(data + i * elem_size, dictionary + codes[i] * elem_size, elem_size);
+    }
+    return true;
+}
+
+bool EncodeFrameOfReference(const u8 *data, SizeT count, SizeT elem_size, SizeT limit, Vector<u8> &out) {
+    if (elem_size != 1 && elem_size != 2 && elem_size != 4 && elem_size != 8) {
+        return false;
+    }
+    i64 min_value = std::numeric_limits<i64>::max();
+    i64 max_value = std::numeric_limits<i64>::min();
+    for (SizeT i = 0; i < count; ++i) {
+        i64 value = LoadSigned(data + i * elem_size, elem_size);
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+    }
+    if ((u64)max_value - (u64)min_value > std::numeric_limits<u32>::max()) {
+        return false;
+    }
+    Vector<u32> offsets(count);
+    for (SizeT i = 0; i < count; ++i) {
+        offsets[i] = (u64)LoadSigned(data + i * elem_size, elem_size) - (u64)min_value;
+    }
+    AppendValue<i64>(out, min_value);
+    PackU32(offsets, out);
+    return out.size() < limit;
+}
+
+bool DecodeFrameOfReference(const u8 *ptr, const u8 *end, SizeT count, SizeT elem_size, u8 *data) {
+    i64 min_value = 0;
+    Vector<u32> offsets;
+    if (!ReadValue(ptr, end, min_value) || !UnpackU32(ptr, end, count, offsets) || ptr != end) {
+        return false;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        StoreSigned(data + i * elem_size, elem_size, (i64)((u64)min_value + offsets[i]));
+    }
+    return true;
+}
+
+bool Compare(i64 value, FilterCompareType compare_type, i64 constant) {
+    switch (compare_type) {
+        case FilterCompareType::kEqual:
+            return value == constant;
+        case FilterCompareType::kLessEqual:
+            return value <= constant;
+        case FilterCompareType::kGreaterEqual:
+            return value >= constant;
+        default:
+            return true;
+    }
+}
+
+bool FilterFrameOfReference(const u8 *ptr, const u8 *end, SizeT count, FilterCompareType compare_type, i64 constant, Bitmask &selected) {
+    i64 min_value = 0;
+    Vector<u32> offsets;
+    if (!ReadValue(ptr, end, min_value) || !UnpackU32(ptr, end, count, offsets) || ptr != end) {
+        return false;
+    }
+    // Move the constant into the offset domain. Constants out of the range of the offsets match all or none of them.
+    if (constant < min_value) {
+        if (compare_type != FilterCompareType::kGreaterEqual) {
+            selected.SetAllFalse();
+        }
+        return true;
+    }
+    u64 constant_offset = (u64)constant - (u64)min_value;
+    if (constant_offset > std::numeric_limits<u32>::max()) {
+        if (compare_type != FilterCompareType::kLessEqual) {
+            selected.SetAllFalse();
+        }
+        return true;
+    }
+    auto offset = static_cast<u32>(constant_offset);
+    for (SizeT i = 0; i < count; ++i) {
+        bool match = compare_type == FilterCompareType::kEqual       ? offsets[i] == offset
+                     : compare_type == FilterCompareType::kLessEqual ? offsets[i] <= offset
+                                                                     : offsets[i] >= offset;
+        if (!match) {
+            selected.SetFalse(i);
+        }
+    }
+    return true;
+}
+
+bool FilterDictionary(const u8 *ptr,
+                      const u8 *end,
+                      SizeT count,
+                      SizeT elem_size,
+                      FilterCompareType compare_type,
+                      i64 constant,
+                      Bitmask &selected) {
+    u32 dictionary_size = 0;
+    if (!ReadValue(ptr, end, dictionary_size) || (SizeT)(end - ptr) < dictionary_size * elem_size) {
+        return false;
+    }
+    Vector<bool> code_matches(dictionary_size);
+    for (u32 code = 0; code < dictionary_size; ++code) {
+        code_matches[code] = Compare(LoadSigned(ptr + code * elem_size, elem_size), compare_type, constant);
+    }
+    ptr += dictionary_size * elem_size;
+    Vector<u32> codes;
+    if (!UnpackU32(ptr, end, count, codes) || ptr != end) {
+        return false;
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        if (codes[i] >= dictionary_size) {
+            return false;
+        }
+    }
+    for (SizeT i = 0; i < count; ++i) {
+        if (!code_matches[codes[i]]) {
+            selected.SetFalse(i);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+ColumnEncodingType ColumnEncoding::Encode(const void *data, SizeT size, SizeT elem_size, Vector<u8> &encoded) {
+    encoded.clear();
+    if (elem_size == 0 || size == 0 || size % elem_size != 0) {
+        return ColumnEncodingType::kPlain;
+    }
+    const auto *bytes = static_cast<const u8 *>(data);
+    const SizeT count = size / elem_size;
+
+    ColumnEncodingType best_type = ColumnEncodingType::kPlain;
+    Vector<u8> candidate;
+    auto TryEncoding = [&](ColumnEncodingType type, auto encoder) {
+        candidate.clear();
+        SizeT limit = best_type == ColumnEncodingType::kPlain ? size : encoded.size();
+        if (encoder(bytes, count, elem_size, limit, candidate)) {
+            best_type = type;
+            encoded.swap(candidate);
+        }
+    };
+    TryEncoding(ColumnEncodingType::kRunLength, EncodeRunLength);
+    TryEncoding(ColumnEncodingType::kFrameOfReference, EncodeFrameOfReference);
+    TryEncoding(ColumnEncodingType::kDictionary, EncodeDictionary);
+    if (best_type == ColumnEncodingType::kPlain) {
+        encoded.clear();
+    }
+    return best_type;
+}
+
+bool ColumnEncoding::Decode(ColumnEncodingType type, const u8 *encoded, SizeT encoded_size, SizeT elem_size, void *data, SizeT size) {
+    if (elem_size == 0 || size % elem_size != 0) {
+        return false;
+    }
+    auto *bytes = static_cast<u8 *>(data);
+    const SizeT count = size / elem_size;
+    const u8 *end = encoded + encoded_size;
+    switch (type) {
+        case ColumnEncodingType::kPlain: {
+            if (encoded_size != size) {
+                return false;
+            }
+            std::memcpy(bytes, encoded, size);
+            return true;
+        }
+        case ColumnEncodingType::kRunLength: {
+            return DecodeRunLength(encoded, end, count, elem_size, bytes);
+        }
+        case ColumnEncodingType::kDictionary: {
+            return DecodeDictionary(encoded, end, count, elem_size, bytes);
+        }
+        case ColumnEncodingType::kFrameOfReference: {
+            return DecodeFrameOfReference(encoded, end, count, elem_size, bytes);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+bool ColumnEncoding::Filter(ColumnEncodingType type,
+                            const u8 *encoded,
+                            SizeT encoded_size,
+                            SizeT elem_size,
+                            SizeT count,
+                            FilterCompareType compare_type,
+                            i64 constant,
+                            Bitmask &selected) {
+    if (elem_size != 1 && elem_size != 2 && elem_size != 4 && elem_size != 8) {
+        return false;
+    }
+    if (compare_type != FilterCompareType::kEqual && compare_type != FilterCompareType::kLessEqual &&
+        compare_type != FilterCompareType::kGreaterEqual) {
+        return false;
+    }
+    const u8 *end = encoded + encoded_size;
+    switch (type) {
+        case ColumnEncodingType::kFrameOfReference: {
+            return FilterFrameOfReference(encoded, end, count, compare_type, constant, selected);
+        }
+        case ColumnEncodingType::kDictionary: {
+            return FilterDictionary(encoded, end, count, elem_size, compare_type, constant, selected);
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace infinity
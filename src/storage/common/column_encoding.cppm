@@ -0,0 +1,82 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import bitmask;
+import filter_expression_push_down_helper;
+
+export module column_encoding;
+
+namespace infinity {
+
+// Lightweight encodings of a buffer of fixed width values. They are lossless on the bytes of the values, so they
+// work for every fixed width column type; integer-like columns benefit the most.
+export enum class ColumnEncodingType : u8 {
+    kPlain,
+    // (run length: u32, value) pairs
+    kRunLength,
+    // distinct values, then the bit-packed value codes
+    kDictionary,
+    // minimum value as i64, then the bit-packed offsets to it. For values of 1, 2, 4 or 8 bytes.
+    kFrameOfReference,
+};
+
+export String ColumnEncodingTypeToString(ColumnEncodingType type) {
+    switch (type) {
+        case ColumnEncodingType::kPlain:
+            return "plain";
+        case ColumnEncodingType::kRunLength:
+            return "run length";
+        case ColumnEncodingType::kDictionary:
+            return "dictionary";
+        case ColumnEncodingType::kFrameOfReference:
+            return "frame of reference";
+        default:
+            return "invalid";
+    }
+}
+
+// A comparison of an integer column with a constant, which can be evaluated on an encoded column buffer.
+export struct EncodedColumnFilter {
+    ColumnID column_id_{};
+    // kEqual, kLessEqual or kGreaterEqual
+    FilterCompareType compare_type_{FilterCompareType::kEqual};
+    i64 value_{};
+};
+
+export struct ColumnEncoding {
+    // Encode the `size` bytes of `elem_size` wide values in `data` with the encoding that gives the smallest output.
+    // Return kPlain and leave `encoded` empty if no encoding is smaller than the data itself.
+    static ColumnEncodingType Encode(const void *data, SizeT size, SizeT elem_size, Vector<u8> &encoded);
+
+    // Decode `encoded` into the `size` bytes of `data`. Return false if `encoded` is malformed.
+    static bool Decode(ColumnEncodingType type, const u8 *encoded, SizeT encoded_size, SizeT elem_size, void *data, SizeT size);
+
+    // Clear the bits in `selected` of the `count` values that don't satisfy `value compare_type constant`, the values being
+    // signed integers of `elem_size` bytes. Frame-of-reference offsets are compared without adding the minimum back, and a
+    // dictionary is compared once per distinct value. Return false, leaving `selected` unchanged, for other encodings or
+    // a malformed `encoded`.
+    static bool Filter(ColumnEncodingType type,
+                       const u8 *encoded,
+                       SizeT encoded_size,
+                       SizeT elem_size,
+                       SizeT count,
+                       FilterCompareType compare_type,
+                       i64 constant,
+                       Bitmask &selected);
+};
+
+} // namespace infinity
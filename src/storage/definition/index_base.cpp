@@ -22,6 +22,7 @@ module index_base;
 import stl;
 import serialize;
 import index_ivfflat;
+import index_ivfpq;
 import index_hnsw;
 import index_full_text;
 import index_secondary;
@@ -43,6 +44,9 @@ String MetricTypeToString(MetricType metric_type) {
         case MetricType::kMetricL2: {
             return "l2";
         }
+        case MetricType::kMetricHamming: {
+            return "hamming";
+        }
         case MetricType::kInvalid: {
             return "Invalid";
         }
@@ -54,6 +58,8 @@ MetricType StringToMetricType(const String &str) {
         return MetricType::kMetricInnerProduct;
     } else if (str == "l2") {
         return MetricType::kMetricL2;
+    } else if (str == "hamming") {
+        return MetricType::kMetricHamming;
     } else {
         return MetricType::kInvalid;
     }
@@ -113,6 +119,13 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(char *&ptr, int32_t maxbytes) {
             res = MakeShared<IndexIVFFlat>(index_name, file_name, column_names, centroids_count, metric_type);
             break;
         }
+        case IndexType::kIVFPQ: {
+            SizeT centroids_count = ReadBufAdv<SizeT>(ptr);
+            SizeT subspace_num = ReadBufAdv<SizeT>(ptr);
+            MetricType metric_type = ReadBufAdv<MetricType>(ptr);
+            res = MakeShared<IndexIVFPQ>(index_name, file_name, column_names, centroids_count, subspace_num, metric_type);
+            break;
+        }
         case IndexType::kHnsw: {
             MetricType metric_type = ReadBufAdv<MetricType>(ptr);
             HnswEncodeType encode_type = ReadBufAdv<HnswEncodeType>(ptr);
@@ -184,6 +197,14 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             res = std::static_pointer_cast<IndexBase>(ptr);
             break;
         }
+        case IndexType::kIVFPQ: {
+            SizeT centroids_count = index_def_json["centroids_count"];
+            SizeT subspace_num = index_def_json["subspace_num"];
+            MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
+            auto ptr = MakeShared<IndexIVFPQ>(index_name, file_name, std::move(column_names), centroids_count, subspace_num, metric_type);
+            res = std::static_pointer_cast<IndexBase>(ptr);
+            break;
+        }
         case IndexType::kHnsw: {
             SizeT M = index_def_json["M"];
             SizeT ef_construction = index_def_json["ef_construction"];
@@ -31,6 +31,8 @@ import index_base;
 import logical_type;
 import statement_common;
 import logger;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -39,6 +41,8 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "pq") {
+        return HnswEncodeType::kPQ;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -50,6 +54,8 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kPQ:
+            return "pq";
         default:
             return "invalid";
     }
@@ -147,7 +153,7 @@ nlohmann::json IndexHnsw::Serialize() const {
     return res;
 }
 
-void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) {
+void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const {
     auto &column_names_vector = *(base_table_ref->column_names_);
     auto &column_types_vector = *(base_table_ref->column_types_);
     SizeT column_id = std::find(column_names_vector.begin(), column_names_vector.end(), column_name) - column_names_vector.begin();
@@ -160,6 +166,26 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
             fmt::format("Attempt to create HNSW index on column: {}, data type: {}.", column_name, data_type->ToString()));
         LOG_ERROR(status.message());
         RecoverableError(status);
+    } else if (auto elem_type = static_cast<EmbeddingInfo *>(data_type->type_info().get())->Type();
+               elem_type != EmbeddingDataType::kElemFloat and elem_type != EmbeddingDataType::kElemFloat16 and
+               elem_type != EmbeddingDataType::kElemInt8 and elem_type != EmbeddingDataType::kElemUInt8 and elem_type != EmbeddingDataType::kElemBit) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create HNSW index on column: {}, data type: {}.", column_name, data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if ((elem_type == EmbeddingDataType::kElemBit) != (metric_type_ == MetricType::kMetricHamming)) {
+        Status status = Status::InvalidIndexDefinition(fmt::format("Hamming distance is the only metric of bit embedding, column: {}, data type: {}.",
+                                                                   column_name,
+                                                                   data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (encode_type_ != HnswEncodeType::kPlain and elem_type != EmbeddingDataType::kElemFloat) {
+        Status status = Status::InvalidIndexDefinition(fmt::format("{} encoding only supports float embedding, column: {}, data type: {}.",
+                                                                   HnswEncodeTypeToString(encode_type_),
+                                                                   column_name,
+                                                                   data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
     }
 }
 
@@ -30,6 +30,7 @@ namespace infinity {
 export enum class HnswEncodeType {
     kPlain,
     kLVQ,
+    kPQ,
     kInvalid,
 };
 
@@ -71,7 +72,8 @@ public:
     virtual nlohmann::json Serialize() const override;
 
 public:
-    static void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name);
+    // Depends on the encode type, so it's checked on the made index
+    void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const;
 
 public:
     const MetricType metric_type_{MetricType::kInvalid};
@@ -30,6 +30,8 @@ import index_base;
 import logical_type;
 import statement_common;
 import logger;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -51,6 +53,11 @@ SharedPtr<IndexBase> IndexIVFFlat::Make(SharedPtr<String> index_name,
         LOG_ERROR(status.message());
         RecoverableError(status);
     }
+    if (metric_type == MetricType::kMetricHamming) {
+        Status status = Status::InvalidIndexParam("Metric type");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
     return MakeShared<IndexIVFFlat>(index_name, file_name, std::move(column_names), centroids_count, metric_type);
 }
 
@@ -122,6 +129,13 @@ void IndexIVFFlat::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_ta
             fmt::format("Attempt to create IVFFLAT index on column: {}, data type: {}.", column_name, data_type->ToString()));
         LOG_ERROR(status.message());
         RecoverableError(status);
+    } else if (auto elem_type = static_cast<EmbeddingInfo *>(data_type->type_info().get())->Type();
+               elem_type != EmbeddingDataType::kElemFloat and elem_type != EmbeddingDataType::kElemFloat16 and
+               elem_type != EmbeddingDataType::kElemInt8 and elem_type != EmbeddingDataType::kElemUInt8) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create IVFFLAT index on column: {}, data type: {}.", column_name, data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
     }
 }
 
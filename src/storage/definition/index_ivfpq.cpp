@@ -0,0 +1,148 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+module index_ivfpq;
+
+import infinity_exception;
+import stl;
+import index_base;
+import status;
+import third_party;
+import serialize;
+import logical_type;
+import statement_common;
+import logger;
+import embedding_info;
+import internal_types;
+
+namespace infinity {
+
+SharedPtr<IndexBase> IndexIVFPQ::Make(SharedPtr<String> index_name,
+                                      const String &file_name,
+                                      Vector<String> column_names,
+                                      const Vector<InitParameter *> &index_param_list) {
+    SizeT centroids_count = 0;
+    SizeT subspace_num = 0;
+    MetricType metric_type = MetricType::kInvalid;
+    for (auto para : index_param_list) {
+        if (para->param_name_ == "centroids_count") {
+            centroids_count = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "subspace_num") {
+            subspace_num = std::stoi(para->param_value_);
+        } else if (para->param_name_ == "metric") {
+            metric_type = StringToMetricType(para->param_value_);
+        } else {
+            Status status = Status::InvalidIndexParam(para->param_name_);
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+        }
+    }
+    if (metric_type == MetricType::kInvalid) {
+        Status status = Status::LackIndexParam();
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    if (metric_type == MetricType::kMetricHamming) {
+        Status status = Status::InvalidIndexParam("Metric type");
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    return MakeShared<IndexIVFPQ>(index_name, file_name, std::move(column_names), centroids_count, subspace_num, metric_type);
+}
+
+bool IndexIVFPQ::operator==(const IndexIVFPQ &other) const {
+    if (this->index_type_ != other.index_type_ || this->file_name_ != other.file_name_ || this->column_names_ != other.column_names_) {
+        return false;
+    }
+    return centroids_count_ == other.centroids_count_ && subspace_num_ == other.subspace_num_ && metric_type_ == other.metric_type_;
+}
+
+bool IndexIVFPQ::operator!=(const IndexIVFPQ &other) const { return !(*this == other); }
+
+i32 IndexIVFPQ::GetSizeInBytes() const {
+    SizeT size = IndexBase::GetSizeInBytes();
+    size += sizeof(centroids_count_);
+    size += sizeof(subspace_num_);
+    size += sizeof(metric_type_);
+    return size;
+}
+
+void IndexIVFPQ::WriteAdv(char *&ptr) const {
+    IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, centroids_count_);
+    WriteBufAdv(ptr, subspace_num_);
+    WriteBufAdv(ptr, metric_type_);
+}
+
+String IndexIVFPQ::ToString() const {
+    std::stringstream ss;
+    ss << IndexBase::ToString() << ", " << centroids_count_ << ", " << subspace_num_ << ", " << MetricTypeToString(metric_type_);
+    return ss.str();
+}
+
+String IndexIVFPQ::BuildOtherParamsString() const {
+    std::stringstream ss;
+    ss << "metric = " << MetricTypeToString(metric_type_) << ", centroids_count = " << centroids_count_ << ", subspace_num = " << subspace_num_;
+    return ss.str();
+}
+
+nlohmann::json IndexIVFPQ::Serialize() const {
+    nlohmann::json res = IndexBase::Serialize();
+    res["centroids_count"] = centroids_count_;
+    res["subspace_num"] = subspace_num_;
+    res["metric_type"] = MetricTypeToString(metric_type_);
+    return res;
+}
+
+SizeT IndexIVFPQ::SubspaceNum(SizeT dimension) const {
+    if (subspace_num_ != 0) {
+        return subspace_num_;
+    }
+    return (dimension + kDefaultSubspaceDim - 1) / kDefaultSubspaceDim;
+}
+
+void IndexIVFPQ::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const {
+    auto &column_names_vector = *(base_table_ref->column_names_);
+    auto &column_types_vector = *(base_table_ref->column_types_);
+    SizeT column_id = std::find(column_names_vector.begin(), column_names_vector.end(), column_name) - column_names_vector.begin();
+    if (column_id == column_names_vector.size()) {
+        Status status = Status::ColumnNotExist(column_name);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (auto &data_type = column_types_vector[column_id]; data_type->type() != LogicalType::kEmbedding) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create IVFPQ index on column: {}, data type: {}.", column_name, data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (auto embedding_info = static_cast<EmbeddingInfo *>(data_type->type_info().get());
+               embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create IVFPQ index on column: {}, data type: {}.", column_name, data_type->ToString()));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    } else if (SizeT dimension = embedding_info->Dimension(); SubspaceNum(dimension) > dimension) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("IVFPQ subspace_num {} is larger than the dimension {} of column: {}.", subspace_num_, dimension, column_name));
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,77 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module index_ivfpq;
+
+import stl;
+import index_base;
+import third_party;
+import base_table_ref;
+import create_index_info;
+import statement_common;
+
+namespace infinity {
+
+export class IndexIVFPQ final : public IndexBase {
+public:
+    // subspaces of this dimension when subspace_num is not given
+    static constexpr SizeT kDefaultSubspaceDim = 8;
+
+    static SharedPtr<IndexBase>
+    Make(SharedPtr<String> index_name, const String &file_name, Vector<String> column_names, const Vector<InitParameter *> &index_param_list);
+
+    IndexIVFPQ(SharedPtr<String> index_name,
+               const String &file_name,
+               Vector<String> column_names,
+               SizeT centroids_count,
+               SizeT subspace_num,
+               MetricType metric_type)
+        : IndexBase(IndexType::kIVFPQ, index_name, file_name, std::move(column_names)), centroids_count_(centroids_count),
+          subspace_num_(subspace_num), metric_type_(metric_type) {}
+
+    ~IndexIVFPQ() final = default;
+
+    bool operator==(const IndexIVFPQ &other) const;
+
+    bool operator!=(const IndexIVFPQ &other) const;
+
+public:
+    virtual i32 GetSizeInBytes() const override;
+
+    virtual void WriteAdv(char *&ptr) const override;
+
+    virtual String ToString() const override;
+
+    virtual String BuildOtherParamsString() const override;
+
+    virtual nlohmann::json Serialize() const override;
+
+public:
+    void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name) const;
+
+    // subspace_num_ or the default for `dimension`
+    SizeT SubspaceNum(SizeT dimension) const;
+
+public:
+    // 0 for sqrt(row count of the segment)
+    const SizeT centroids_count_{};
+    // 0 for subspaces of kDefaultSubspaceDim dimensions
+    const SizeT subspace_num_{};
+
+    const MetricType metric_type_{MetricType::kInvalid};
+};
+
+} // namespace infinity
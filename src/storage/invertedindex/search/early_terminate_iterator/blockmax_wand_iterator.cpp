@@ -48,6 +48,8 @@ BlockMaxWandIterator::BlockMaxWandIterator(Vector<UniquePtr<EarlyTerminateIterat
     SizeT num_iterators = sorted_iterators_.size();
     for (SizeT i = 0; i < num_iterators; i++){
         bm25_score_upper_bound_ += sorted_iterators_[i]->BM25ScoreUpperBound();
+        // init df
+        doc_freq_ += sorted_iterators_[i]->DocFreq();
     }
 }
 
@@ -31,8 +31,10 @@ bool EarlyTerminateIterator::Next() {
     return Next(target_doc_id);
 }
 
-Pair<RowID, float> EarlyTerminateIterator::BlockNextWithThreshold(float threshold) {
-    for (RowID next_skip = doc_id_ + 1;;) {
+Pair<RowID, float> EarlyTerminateIterator::BlockNextWithThreshold(float threshold) { return BlockNextWithThreshold(threshold, doc_id_ + 1); }
+
+Pair<RowID, float> EarlyTerminateIterator::BlockNextWithThreshold(float threshold, RowID doc_id) {
+    for (RowID next_skip = doc_id;;) {
         if (!BlockSkipTo(next_skip, threshold)) [[unlikely]] {
             return {INVALID_ROWID, 0.0F};
         }
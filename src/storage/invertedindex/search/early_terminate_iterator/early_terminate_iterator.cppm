@@ -46,8 +46,14 @@ public:
 
     inline float BM25ScoreUpperBound() const { return bm25_score_upper_bound_; }
 
+    // upper bound of the result count if known in advance, 0 otherwise
+    virtual SizeT EstimateResultCount() const { return 0; }
+
     Pair<RowID, float> BlockNextWithThreshold(float threshold);
 
+    // Same as above, but the result is no less than given doc_id instead of larger than the previous one.
+    Pair<RowID, float> BlockNextWithThreshold(float threshold, RowID doc_id);
+
     virtual void UpdateScoreThreshold(float threshold){
         if (threshold > threshold_)
             threshold_ = threshold;
@@ -0,0 +1,374 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define INFINITY_IO_URING 1
+#endif
+
+module async_io;
+
+import stl;
+import third_party;
+import logger;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+constexpr u32 kFallbackThreadCount = 4;
+
+i64 ExecuteSync(const AsyncIORequest &request) {
+    switch (request.type_) {
+        case AsyncIOType::kRead: {
+            i64 ret = pread(request.fd_, request.data_, request.nbytes_, request.offset_);
+            return ret < 0 ? -errno : ret;
+        }
+        case AsyncIOType::kWrite: {
+            i64 ret = pwrite(request.fd_, request.data_, request.nbytes_, request.offset_);
+            return ret < 0 ? -errno : ret;
+        }
+        case AsyncIOType::kSync: {
+            return fsync(request.fd_) < 0 ? -errno : 0;
+        }
+        case AsyncIOType::kReadahead: {
+            // posix_fadvise returns the error number instead of setting errno
+            return -posix_fadvise(request.fd_, request.offset_, request.nbytes_, POSIX_FADV_WILLNEED);
+        }
+    }
+    return -EINVAL;
+}
+
+void RunCallbacks(const Vector<AsyncIORequest *> &finished) {
+    for (auto *request : finished) {
+        if (request->callback_) {
+            request->callback_(request);
+        }
+    }
+}
+
+} // namespace
+
+class ThreadPoolAsyncIO final : public AsyncIO {
+public:
+    ThreadPoolAsyncIO(u32 queue_depth, u32 thread_count) : queue_depth_(queue_depth), thread_pool_(thread_count) {}
+
+    ~ThreadPoolAsyncIO() override { Complete(InFlight()); }
+
+    void Submit(const Vector<AsyncIORequest *> &requests) override {
+        for (auto *request : requests) {
+            while (InFlight() >= queue_depth_) {
+                Complete(1);
+            }
+            {
+                std::unique_lock lock(mutex_);
+                ++in_flight_;
+            }
+            thread_pool_.push([this, request](int) {
+                request->result_ = ExecuteSync(*request);
+                {
+                    std::unique_lock lock(mutex_);
+                    finished_.push_back(request);
+                }
+                cv_.notify_all();
+            });
+        }
+    }
+
+    SizeT Complete(SizeT min_complete) override {
+        Vector<AsyncIORequest *> finished;
+        {
+            std::unique_lock lock(mutex_);
+            min_complete = std::min(min_complete, in_flight_);
+            cv_.wait(lock, [&] { return finished_.size() >= min_complete; });
+            finished.swap(finished_);
+            in_flight_ -= finished.size();
+        }
+        RunCallbacks(finished);
+        return finished.size();
+    }
+
+    SizeT InFlight() const override {
+        std::unique_lock lock(mutex_);
+        return in_flight_;
+    }
+
+    const char *Name() const override { return "thread pool"; }
+
+private:
+    const SizeT queue_depth_;
+
+    mutable std::mutex mutex_{};
+    std::condition_variable cv_{};
+    // submitted but not completed, including the finished ones whose callback hasn't run
+    SizeT in_flight_{0};
+    Vector<AsyncIORequest *> finished_{};
+
+    // declared last so that the workers stop before the members they use are destroyed
+    ThreadPool thread_pool_;
+};
+
+#ifdef INFINITY_IO_URING
+
+// io_uring driven by the raw system calls, without the SQPOLL thread.
+class IoUringAsyncIO final : public AsyncIO {
+public:
+    explicit IoUringAsyncIO(u32 queue_depth) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        ring_fd_ = syscall(__NR_io_uring_setup, queue_depth, &params);
+        if (ring_fd_ < 0) {
+            LOG_WARN(fmt::format("io_uring_setup failed: {}", strerror(errno)));
+            return;
+        }
+        if (!SupportOps()) {
+            return;
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(u32);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = MapRing(sq_ring_size_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == nullptr) {
+            return;
+        }
+        cq_ring_ = single_mmap ? sq_ring_ : MapRing(cq_ring_size_, IORING_OFF_CQ_RING);
+        if (cq_ring_ == nullptr) {
+            return;
+        }
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe *>(MapRing(sqes_size_, IORING_OFF_SQES));
+        if (sqes_ == nullptr) {
+            return;
+        }
+
+        auto *sq = static_cast<u8 *>(sq_ring_);
+        sq_head_ = reinterpret_cast<u32 *>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<u32 *>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<u32 *>(sq + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<u32 *>(sq + params.sq_off.array);
+        sq_entries_ = params.sq_entries;
+
+        auto *cq = static_cast<u8 *>(cq_ring_);
+        cq_head_ = reinterpret_cast<u32 *>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<u32 *>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<u32 *>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+        cq_entries_ = params.cq_entries;
+
+        valid_ = true;
+    }
+
+    ~IoUringAsyncIO() override {
+        if (valid_) {
+            Complete(InFlight());
+        }
+        if (sqes_ != nullptr) {
+            munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr) {
+            munmap(sq_ring_, sq_ring_size_);
+        }
+        if (ring_fd_ >= 0) {
+            close(ring_fd_);
+        }
+    }
+
+    bool Valid() const { return valid_; }
+
+    void Submit(const Vector<AsyncIORequest *> &requests) override {
+        SizeT request_idx = 0;
+        while (request_idx < requests.size()) {
+            // the completion ring must have room for every request in flight
+            while (in_flight_ >= cq_entries_) {
+                Complete(1);
+            }
+            std::unique_lock lock(sq_mutex_);
+            u32 tail = *sq_tail_;
+            const u32 head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+            u32 submit_count = 0;
+            while (request_idx < requests.size() && tail - head < sq_entries_ && in_flight_ + submit_count < cq_entries_) {
+                const u32 idx = tail & sq_mask_;
+                PrepareSqe(&sqes_[idx], requests[request_idx]);
+                sq_array_[idx] = idx;
+                ++tail;
+                ++request_idx;
+                ++submit_count;
+            }
+            __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+            in_flight_ += submit_count;
+            while (submit_count > 0) {
+                i32 ret = syscall(__NR_io_uring_enter, ring_fd_, submit_count, 0, 0, nullptr, 0);
+                if (ret < 0) {
+                    if (errno == EINTR || errno == EAGAIN) {
+                        continue;
+                    }
+                    UnrecoverableError(fmt::format("io_uring_enter failed: {}", strerror(errno)));
+                }
+                submit_count -= ret;
+            }
+        }
+    }
+
+    SizeT Complete(SizeT min_complete) override {
+        Vector<AsyncIORequest *> finished;
+        {
+            std::unique_lock lock(cq_mutex_);
+            min_complete = std::min(min_complete, InFlight());
+            while (true) {
+                u32 head = *cq_head_;
+                const u32 tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+                for (; head != tail; ++head) {
+                    const io_uring_cqe &cqe = cqes_[head & cq_mask_];
+                    auto *request = reinterpret_cast<AsyncIORequest *>(cqe.user_data);
+                    request->result_ = cqe.res;
+                    finished.push_back(request);
+                }
+                __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+                if (finished.size() >= min_complete) {
+                    break;
+                }
+                i32 ret = syscall(__NR_io_uring_enter, ring_fd_, 0, min_complete - finished.size(), IORING_ENTER_GETEVENTS, nullptr, 0);
+                if (ret < 0 && errno != EINTR) {
+                    UnrecoverableError(fmt::format("io_uring_enter failed: {}", strerror(errno)));
+                }
+            }
+            in_flight_ -= finished.size();
+        }
+        RunCallbacks(finished);
+        return finished.size();
+    }
+
+    SizeT InFlight() const override { return in_flight_; }
+
+    const char *Name() const override { return "io_uring"; }
+
+private:
+    bool SupportOps() {
+        constexpr u32 probe_op_count = 256;
+        SizeT probe_size = sizeof(io_uring_probe) + probe_op_count * sizeof(io_uring_probe_op);
+        auto probe_buffer = MakeUnique<u8[]>(probe_size);
+        auto *probe = reinterpret_cast<io_uring_probe *>(probe_buffer.get());
+        if (syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_PROBE, probe, probe_op_count) < 0) {
+            LOG_WARN(fmt::format("io_uring probe failed: {}", strerror(errno)));
+            return false;
+        }
+        for (u32 op : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_FSYNC, IORING_OP_FADVISE}) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                LOG_WARN(fmt::format("io_uring doesn't support operation {}", op));
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void *MapRing(SizeT size, u64 offset) {
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, offset);
+        if (ptr == MAP_FAILED) {
+            LOG_WARN(fmt::format("Map io_uring ring failed: {}", strerror(errno)));
+            return nullptr;
+        }
+        return ptr;
+    }
+
+    static void PrepareSqe(io_uring_sqe *sqe, AsyncIORequest *request) {
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->fd = request->fd_;
+        sqe->off = request->offset_;
+        sqe->user_data = reinterpret_cast<u64>(request);
+        // a larger transfer is cut short, which the caller sees in result_ as with pread
+        const u32 len = std::min<u64>(request->nbytes_, std::numeric_limits<u32>::max());
+        switch (request->type_) {
+            case AsyncIOType::kRead: {
+                sqe->opcode = IORING_OP_READ;
+                sqe->addr = reinterpret_cast<u64>(request->data_);
+                sqe->len = len;
+                break;
+            }
+            case AsyncIOType::kWrite: {
+                sqe->opcode = IORING_OP_WRITE;
+                sqe->addr = reinterpret_cast<u64>(request->data_);
+                sqe->len = len;
+                break;
+            }
+            case AsyncIOType::kSync: {
+                sqe->opcode = IORING_OP_FSYNC;
+                break;
+            }
+            case AsyncIOType::kReadahead: {
+                sqe->opcode = IORING_OP_FADVISE;
+                sqe->len = len;
+                sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+                break;
+            }
+        }
+    }
+
+    bool valid_{false};
+    i32 ring_fd_{-1};
+
+    void *sq_ring_{};
+    SizeT sq_ring_size_{};
+    void *cq_ring_{};
+    SizeT cq_ring_size_{};
+    io_uring_sqe *sqes_{};
+    SizeT sqes_size_{};
+
+    u32 *sq_head_{};
+    u32 *sq_tail_{};
+    u32 sq_mask_{};
+    u32 *sq_array_{};
+    u32 sq_entries_{};
+
+    u32 *cq_head_{};
+    u32 *cq_tail_{};
+    u32 cq_mask_{};
+    io_uring_cqe *cqes_{};
+    u32 cq_entries_{};
+
+    std::mutex sq_mutex_{};
+    std::mutex cq_mutex_{};
+    Atomic<SizeT> in_flight_{0};
+};
+
+#endif
+
+UniquePtr<AsyncIO> AsyncIO::Make(u32 queue_depth) {
+#ifdef INFINITY_IO_URING
+    auto io_uring = MakeUnique<IoUringAsyncIO>(queue_depth);
+    if (io_uring->Valid()) {
+        return io_uring;
+    }
+    LOG_WARN("io_uring is unavailable, asynchronous I/O falls back to a thread pool");
+#endif
+    return MakeUnique<ThreadPoolAsyncIO>(queue_depth, kFallbackThreadCount);
+}
+
+} // namespace infinity
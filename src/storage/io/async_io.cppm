@@ -0,0 +1,64 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+
+export module async_io;
+
+namespace infinity {
+
+export enum class AsyncIOType : u8 {
+    kRead,
+    kWrite,
+    kSync,
+    // Load the range into the page cache without copying it out
+    kReadahead,
+};
+
+export struct AsyncIORequest {
+    AsyncIOType type_{AsyncIOType::kRead};
+    i32 fd_{-1};
+    i64 offset_{};
+    void *data_{};
+    u64 nbytes_{};
+
+    // Bytes transferred, or -errno on failure. Set before callback_ runs.
+    i64 result_{};
+    std::function<void(AsyncIORequest *)> callback_{};
+};
+
+// Submit/complete interface over the asynchronous I/O of the platform.
+// The caller keeps a request alive until its callback has run. Both methods are thread safe.
+export class AsyncIO {
+public:
+    virtual ~AsyncIO() = default;
+
+    // Queue the requests. It blocks only when the queue is full, to complete earlier requests.
+    virtual void Submit(const Vector<AsyncIORequest *> &requests) = 0;
+
+    // Run the callbacks of finished requests, waiting until at least min_complete are finished.
+    // Return the number of callbacks run.
+    virtual SizeT Complete(SizeT min_complete) = 0;
+
+    virtual SizeT InFlight() const = 0;
+
+    virtual const char *Name() const = 0;
+
+    // io_uring when the kernel allows it, a thread pool otherwise
+    static UniquePtr<AsyncIO> Make(u32 queue_depth);
+};
+
+} // namespace infinity
@@ -16,6 +16,7 @@ module;
 
 import stl;
 import file_system_type;
+import crc;
 
 export module file_system;
 
@@ -41,9 +42,34 @@ public:
 
     void Close();
 
+    // Keep a running CRC32C of the bytes read or written sequentially (Read/Write, not ReadAt/WriteAt) from now on.
+    void StartChecksum() {
+        checksum_enabled_ = true;
+        checksum_ = 0;
+        checksum_size_ = 0;
+    }
+
+    void StopChecksum() { checksum_enabled_ = false; }
+
+    void UpdateChecksum(const void *data, u64 nbytes) {
+        if (checksum_enabled_) {
+            checksum_ = CRC32C(data, nbytes, checksum_);
+            checksum_size_ += nbytes;
+        }
+    }
+
+    u32 checksum() const { return checksum_; }
+
+    u64 checksum_size() const { return checksum_size_; }
+
 public:
     FileSystem &file_system_;
     Path path_;
+
+private:
+    bool checksum_enabled_{false};
+    u32 checksum_{};
+    u64 checksum_size_{};
 };
 
 class FileSystem {
@@ -25,6 +25,7 @@ module;
 import stl;
 import file_system;
 import file_system_type;
+import async_io;
 
 import infinity_exception;
 import third_party;
@@ -131,6 +132,7 @@ i64 LocalFileSystem::Read(FileHandler &file_handler, void *data, u64 nbytes) {
     if (read_count == -1) {
         UnrecoverableError(fmt::format("Can't read file: {}: {}", file_handler.path_.string(), strerror(errno)));
     }
+    file_handler.UpdateChecksum(data, read_count);
     return read_count;
 }
 
@@ -144,6 +146,7 @@ i64 LocalFileSystem::Write(FileHandler &file_handler, const void *data, u64 nbyt
         }
         written += write_count;
     }
+    file_handler.UpdateChecksum(data, written);
     return written;
 }
 
@@ -169,6 +172,43 @@ i64 LocalFileSystem::WriteAt(FileHandler &file_handler, i64 file_offset, const v
     return written;
 }
 
+void LocalFileSystem::SubmitReadAt(AsyncIO &async_io, FileHandler &file_handler, i64 file_offset, void *data, u64 nbytes, AsyncIORequest *request) {
+    request->type_ = AsyncIOType::kRead;
+    request->fd_ = ((LocalFileHandler &)file_handler).fd_;
+    request->offset_ = file_offset;
+    request->data_ = data;
+    request->nbytes_ = nbytes;
+    async_io.Submit({request});
+}
+
+void LocalFileSystem::SubmitWriteAt(AsyncIO &async_io,
+                                    FileHandler &file_handler,
+                                    i64 file_offset,
+                                    const void *data,
+                                    u64 nbytes,
+                                    AsyncIORequest *request) {
+    request->type_ = AsyncIOType::kWrite;
+    request->fd_ = ((LocalFileHandler &)file_handler).fd_;
+    request->offset_ = file_offset;
+    request->data_ = const_cast<void *>(data);
+    request->nbytes_ = nbytes;
+    async_io.Submit({request});
+}
+
+void LocalFileSystem::SubmitSync(AsyncIO &async_io, FileHandler &file_handler, AsyncIORequest *request) {
+    request->type_ = AsyncIOType::kSync;
+    request->fd_ = ((LocalFileHandler &)file_handler).fd_;
+    async_io.Submit({request});
+}
+
+void LocalFileSystem::SubmitReadahead(AsyncIO &async_io, FileHandler &file_handler, AsyncIORequest *request) {
+    request->type_ = AsyncIOType::kReadahead;
+    request->fd_ = ((LocalFileHandler &)file_handler).fd_;
+    request->offset_ = 0;
+    request->nbytes_ = GetFileSize(file_handler);
+    async_io.Submit({request});
+}
+
 void LocalFileSystem::Seek(FileHandler &file_handler, i64 pos) {
     i32 fd = ((LocalFileHandler &)file_handler).fd_;
     if ((off_t)-1 == lseek(fd, pos, SEEK_SET)) {
@@ -205,6 +245,33 @@ void LocalFileSystem::SyncFile(FileHandler &file_handler) {
     }
 }
 
+void LocalFileSystem::DataSyncFile(FileHandler &file_handler) {
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    if (fdatasync(fd) != 0) {
+        UnrecoverableError(fmt::format("fdatasync failed: {}, {}", file_handler.path_.string(), strerror(errno)));
+    }
+}
+
+bool LocalFileSystem::Preallocate(FileHandler &file_handler, i64 file_offset, i64 nbytes) {
+#if defined(__linux__)
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    if (fallocate(fd, FALLOC_FL_KEEP_SIZE, file_offset, nbytes) == 0) {
+        return true;
+    }
+    if (errno != EOPNOTSUPP) {
+        LOG_WARN(fmt::format("fallocate failed: {}, {}", file_handler.path_.string(), strerror(errno)));
+    }
+#endif
+    return false;
+}
+
+void LocalFileSystem::Truncate(FileHandler &file_handler, i64 length) {
+    i32 fd = ((LocalFileHandler &)file_handler).fd_;
+    if (ftruncate(fd, length) != 0) {
+        UnrecoverableError(fmt::format("ftruncate failed: {}, {}", file_handler.path_.string(), strerror(errno)));
+    }
+}
+
 void LocalFileSystem::AppendFile(const String &dst_path, const String &src_path) {
     Path dst{dst_path};
     Path src{src_path};
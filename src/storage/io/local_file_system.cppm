@@ -17,6 +17,7 @@ module;
 import stl;
 import file_system;
 import file_system_type;
+import async_io;
 
 export module local_file_system;
 
@@ -64,6 +65,26 @@ public:
 
     void SyncFile(FileHandler &file_handler) final;
 
+    // fdatasync, skips the metadata that is not needed to read the data back
+    void DataSyncFile(FileHandler &file_handler);
+
+    // Reserve the blocks of [file_offset, file_offset + nbytes) without changing the file size, so that the appends in the
+    // range needn't allocate. Return false if the file system doesn't support it.
+    bool Preallocate(FileHandler &file_handler, i64 file_offset, i64 nbytes);
+
+    void Truncate(FileHandler &file_handler, i64 length);
+
+    // Asynchronous counterparts of ReadAt, WriteAt and SyncFile. The request is queued to async_io and its callback
+    // runs in AsyncIO::Complete, so file_handler, data and request must outlive it.
+    void SubmitReadAt(AsyncIO &async_io, FileHandler &file_handler, i64 file_offset, void *data, u64 nbytes, AsyncIORequest *request);
+
+    void SubmitWriteAt(AsyncIO &async_io, FileHandler &file_handler, i64 file_offset, const void *data, u64 nbytes, AsyncIORequest *request);
+
+    void SubmitSync(AsyncIO &async_io, FileHandler &file_handler, AsyncIORequest *request);
+
+    // Start loading the whole file into the page cache, for a read that will come soon.
+    void SubmitReadahead(AsyncIO &async_io, FileHandler &file_handler, AsyncIORequest *request);
+
     void Close(FileHandler &file_handler) final;
 
     void AppendFile(const String &dst_path, const String &src_path) final;
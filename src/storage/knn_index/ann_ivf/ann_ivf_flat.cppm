@@ -32,11 +32,13 @@ import internal_types;
 
 namespace infinity {
 
-template <typename Compare, MetricType metric, KnnDistanceAlgoType algo>
+// ElemType is the element type of queries and indexed vectors, centroids and distances are DistType.
+template <typename Compare, MetricType metric, KnnDistanceAlgoType algo, typename ElemType = typename Compare::DistanceType>
 class AnnIVFFlat final : public KnnDistance<typename Compare::DistanceType> {
     using DistType = typename Compare::DistanceType;
+    using IndexData = AnnIVFFlatIndexData<DistType, ElemType>;
     using ResultHandler = ReservoirResultHandler<Compare>;
-    static inline DistType Distance(const DistType *x, const DistType *y, u32 dimension) {
+    static inline DistType Distance(const ElemType *x, const ElemType *y, u32 dimension) {
         if constexpr (metric == MetricType::kMetricL2) {
             return L2Distance<DistType>(x, y, dimension);
         } else if constexpr (metric == MetricType::kMetricInnerProduct) {
@@ -47,20 +49,20 @@ class AnnIVFFlat final : public KnnDistance<typename Compare::DistanceType> {
     }
 
 public:
-    explicit AnnIVFFlat(const DistType *queries, u64 query_count, u32 top_k, u32 dimension, EmbeddingDataType elem_data_type)
+    explicit AnnIVFFlat(const ElemType *queries, u64 query_count, u32 top_k, u32 dimension, EmbeddingDataType elem_data_type)
         : KnnDistance<DistType>(algo, elem_data_type, query_count, dimension, top_k), queries_(queries) {
         id_array_ = MakeUniqueForOverwrite<RowID[]>(top_k * query_count);
         distance_array_ = MakeUniqueForOverwrite<DistType[]>(top_k * query_count);
         result_handler_ = MakeUnique<ResultHandler>(query_count, top_k, distance_array_.get(), id_array_.get());
     }
 
-    static UniquePtr<AnnIVFFlatIndexData<DistType>> CreateIndex(u32 dimension, u32 vector_count, const DistType *vectors_ptr, u32 partition_num) {
-        return AnnIVFFlat<Compare, metric, algo>::CreateIndex(dimension, vector_count, vectors_ptr, vector_count, vectors_ptr, partition_num);
+    static UniquePtr<IndexData> CreateIndex(u32 dimension, u32 vector_count, const ElemType *vectors_ptr, u32 partition_num) {
+        return AnnIVFFlat<Compare, metric, algo, ElemType>::CreateIndex(dimension, vector_count, vectors_ptr, vector_count, vectors_ptr, partition_num);
     }
 
-    static UniquePtr<AnnIVFFlatIndexData<DistType>>
-    CreateIndex(u32 dimension, u32 train_count, const DistType *train_ptr, u32 vector_count, const DistType *vectors_ptr, u32 partition_num) {
-        auto index_data = MakeUnique<AnnIVFFlatIndexData<DistType>>(metric, dimension, partition_num);
+    static UniquePtr<IndexData>
+    CreateIndex(u32 dimension, u32 train_count, const ElemType *train_ptr, u32 vector_count, const ElemType *vectors_ptr, u32 partition_num) {
+        auto index_data = MakeUnique<IndexData>(metric, dimension, partition_num);
         index_data->BuildIndex(dimension, train_count, train_ptr, vector_count, vectors_ptr);
         return index_data;
     }
@@ -85,7 +87,7 @@ public:
 
     void Search(const DistType *, u16, u32, u16, Bitmask &) final { UnrecoverableError("Unsupported search function"); }
 
-    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes) {
+    void Search(const IndexData *base_ivf, u32 segment_id, u32 n_probes) {
         // check metric type
         if (base_ivf->metric_ != metric) {
             UnrecoverableError("Metric type is invalid");
@@ -109,8 +111,8 @@ public:
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
                 u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                const ElemType *x_i = this->queries_ + i * this->dimension_;
+                const ElemType *y_j = base_ivf->vectors_[selected_centroid].data();
                 for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                     DistType distance = Distance(x_i, y_j, this->dimension_);
                     result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
@@ -129,11 +131,11 @@ public:
                                   centroid_dists.get(),
                                   false);
             for (u64 i = 0; i < this->query_count_; i++) {
-                const DistType *x_i = queries_ + i * this->dimension_;
+                const ElemType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
                     const u32 selected_centroid = centroid_ids[k + i * n_probes];
                     const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                    const ElemType *y_j = base_ivf->vectors_[selected_centroid].data();
                     for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                         DistType distance = Distance(x_i, y_j, this->dimension_);
                         result_handler_->AddResult(i, distance, RowID(segment_id, base_ivf->ids_[selected_centroid][j]));
@@ -144,7 +146,7 @@ public:
     }
 
     template <typename Filter>
-    void Search(const AnnIVFFlatIndexData<DistType> *base_ivf, u32 segment_id, u32 n_probes, Filter &filter) {
+    void Search(const IndexData *base_ivf, u32 segment_id, u32 n_probes, Filter &filter) {
         // check metric type
         if (base_ivf->metric_ != metric) {
             UnrecoverableError("Metric type is invalid");
@@ -168,8 +170,8 @@ public:
             for (u64 i = 0; i < this->query_count_; i++) {
                 u32 selected_centroid = assign_centroid_ids[i];
                 u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                const DistType *x_i = this->queries_ + i * this->dimension_;
-                const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                const ElemType *x_i = this->queries_ + i * this->dimension_;
+                const ElemType *y_j = base_ivf->vectors_[selected_centroid].data();
                 for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                     auto segment_offset = base_ivf->ids_[selected_centroid][j];
                     if (filter(segment_offset)) {
@@ -191,11 +193,11 @@ public:
                                   centroid_dists.get(),
                                   false);
             for (u64 i = 0; i < this->query_count_; i++) {
-                const DistType *x_i = queries_ + i * this->dimension_;
+                const ElemType *x_i = queries_ + i * this->dimension_;
                 for (u32 k = 0; k < n_probes && centroid_dists[k + i * n_probes] != InvalidValue(); ++k) {
                     const u32 selected_centroid = centroid_ids[k + i * n_probes];
                     const u32 contain_nums = base_ivf->ids_[selected_centroid].size();
-                    const DistType *y_j = base_ivf->vectors_[selected_centroid].data();
+                    const ElemType *y_j = base_ivf->vectors_[selected_centroid].data();
                     for (u32 j = 0; j < contain_nums; j++, y_j += this->dimension_) {
                         auto segment_offset = base_ivf->ids_[selected_centroid][j];
                         if (filter(segment_offset)) {
@@ -252,14 +254,14 @@ private:
 
     UniquePtr<ResultHandler> result_handler_{};
 
-    const DistType *queries_{};
+    const ElemType *queries_{};
     bool begin_{false};
 };
 
-export template <typename DistType>
-using AnnIVFFlatL2 = AnnIVFFlat<CompareMax<DistType, RowID>, MetricType::kMetricL2, KnnDistanceAlgoType::kKnnFlatL2>;
+export template <typename DistType, typename ElemType = DistType>
+using AnnIVFFlatL2 = AnnIVFFlat<CompareMax<DistType, RowID>, MetricType::kMetricL2, KnnDistanceAlgoType::kKnnFlatL2, ElemType>;
 
-export template <typename DistType>
-using AnnIVFFlatIP = AnnIVFFlat<CompareMin<DistType, RowID>, MetricType::kMetricInnerProduct, KnnDistanceAlgoType::kKnnFlatIp>;
+export template <typename DistType, typename ElemType = DistType>
+using AnnIVFFlatIP = AnnIVFFlat<CompareMin<DistType, RowID>, MetricType::kMetricInnerProduct, KnnDistanceAlgoType::kKnnFlatIp, ElemType>;
 
 }; // namespace infinity
\ No newline at end of file
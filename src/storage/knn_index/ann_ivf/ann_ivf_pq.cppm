@@ -0,0 +1,173 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module ann_ivf_pq;
+
+import stl;
+import knn_distance;
+
+import infinity_exception;
+import index_base;
+import annivfpq_index_data;
+import vector_distance;
+import search_top_k;
+import knn_result_handler;
+import bitmask;
+import knn_expr;
+import internal_types;
+
+namespace infinity {
+
+template <typename Compare, MetricType metric, KnnDistanceAlgoType algo>
+class AnnIVFPQ final : public KnnDistance<f32> {
+    using IndexData = AnnIVFPQIndexData;
+    using ResultHandler = ReservoirResultHandler<Compare>;
+
+public:
+    explicit AnnIVFPQ(const f32 *queries, u64 query_count, u32 top_k, u32 dimension, EmbeddingDataType elem_data_type)
+        : KnnDistance<f32>(algo, elem_data_type, query_count, dimension, top_k), queries_(queries) {
+        id_array_ = MakeUniqueForOverwrite<RowID[]>(top_k * query_count);
+        distance_array_ = MakeUniqueForOverwrite<f32[]>(top_k * query_count);
+        result_handler_ = MakeUnique<ResultHandler>(query_count, top_k, distance_array_.get(), id_array_.get());
+    }
+
+    void Begin() final {
+        if (begin_ || this->query_count_ == 0) {
+            return;
+        }
+        result_handler_->Begin();
+        begin_ = true;
+    }
+
+    void Search(const f32 *, u16, u32, u16) final { UnrecoverableError("Unsupported search function"); }
+
+    void Search(const f32 *, u16, u32, u16, Bitmask &) final { UnrecoverableError("Unsupported search function"); }
+
+    // Scan the n_probes partitions nearest to each query. The filter is optional.
+    template <typename... Filter>
+    void Search(const IndexData *base_ivf, u32 segment_id, u32 n_probes, Filter &...filter) {
+        static_assert(sizeof...(Filter) <= 1);
+        if (base_ivf->metric_ != metric) {
+            UnrecoverableError("Metric type is invalid");
+        }
+        if (!begin_) {
+            UnrecoverableError("IVFPQ isn't begin");
+        }
+        n_probes = std::min(n_probes, base_ivf->partition_num_);
+        if ((n_probes == 0) || (base_ivf->data_num_ == 0)) {
+            return;
+        }
+        this->total_base_count_ += base_ivf->data_num_;
+
+        auto centroid_dists = MakeUniqueForOverwrite<f32[]>(n_probes * this->query_count_);
+        auto centroid_ids = MakeUniqueForOverwrite<u32[]>(n_probes * this->query_count_);
+        search_top_k_with_dis(n_probes,
+                              this->dimension_,
+                              this->query_count_,
+                              queries_,
+                              base_ivf->partition_num_,
+                              base_ivf->centroids_.data(),
+                              centroid_ids.get(),
+                              centroid_dists.get(),
+                              false);
+
+        const u32 table_size = base_ivf->subspace_num_ * AnnIVFPQIndexData::pq_centroid_num_;
+        auto table = MakeUniqueForOverwrite<f32[]>(table_size);
+        Vector<f32> distances;
+        for (u64 i = 0; i < this->query_count_; ++i) {
+            const f32 *x_i = queries_ + i * this->dimension_;
+            if constexpr (metric == MetricType::kMetricInnerProduct) {
+                // the ip table is the same for all partitions
+                base_ivf->MakeADCTable(x_i, nullptr, table.get());
+            }
+            for (u32 k = 0; k < n_probes; ++k) {
+                const u32 selected_centroid = centroid_ids[k + i * n_probes];
+                const f32 *centroid = base_ivf->centroids_.data() + (SizeT)selected_centroid * this->dimension_;
+                f32 bias = 0;
+                if constexpr (metric == MetricType::kMetricL2) {
+                    base_ivf->MakeADCTable(x_i, centroid, table.get());
+                } else {
+                    bias = IPDistance<f32>(x_i, centroid, this->dimension_);
+                }
+                const auto &ids = base_ivf->ids_[selected_centroid];
+                const u32 contain_nums = ids.size();
+                distances.resize(contain_nums);
+                base_ivf->ADCScan(table.get(), base_ivf->codes_[selected_centroid].data(), contain_nums, bias, distances.data());
+                for (u32 j = 0; j < contain_nums; ++j) {
+                    if constexpr (sizeof...(Filter) == 1) {
+                        if (!(filter(ids[j]) && ...)) {
+                            continue;
+                        }
+                    }
+                    result_handler_->AddResult(i, distances[j], RowID(segment_id, ids[j]));
+                }
+            }
+        }
+    }
+
+    void End() final {
+        if (!begin_) {
+            return;
+        }
+        result_handler_->End();
+        begin_ = false;
+    }
+
+    void EndWithoutSort() {
+        if (!begin_) {
+            return;
+        }
+        result_handler_->EndWithoutSort();
+        begin_ = false;
+    }
+
+    [[nodiscard]] inline f32 *GetDistances() const final { return distance_array_.get(); }
+
+    [[nodiscard]] inline RowID *GetIDs() const final { return id_array_.get(); }
+
+    [[nodiscard]] inline f32 *GetDistanceByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            UnrecoverableError("Query index exceeds the limit");
+        }
+        return distance_array_.get() + idx * this->top_k_;
+    }
+
+    [[nodiscard]] inline RowID *GetIDByIdx(u64 idx) const final {
+        if (idx >= this->query_count_) {
+            UnrecoverableError("Query index exceeds the limit");
+        }
+        return id_array_.get() + idx * this->top_k_;
+    }
+
+    [[nodiscard]] static constexpr f32 InvalidValue() { return Compare::InitialValue(); }
+
+    [[nodiscard]] static bool CompareDist(const f32 &a, const f32 &b) { return Compare::Compare(b, a); }
+
+private:
+    UniquePtr<RowID[]> id_array_{};
+    UniquePtr<f32[]> distance_array_{};
+
+    UniquePtr<ResultHandler> result_handler_{};
+
+    const f32 *queries_{};
+    bool begin_{false};
+};
+
+export using AnnIVFPQL2 = AnnIVFPQ<CompareMax<f32, RowID>, MetricType::kMetricL2, KnnDistanceAlgoType::kKnnFlatL2>;
+
+export using AnnIVFPQIP = AnnIVFPQ<CompareMin<f32, RowID>, MetricType::kMetricInnerProduct, KnnDistanceAlgoType::kKnnFlatIp>;
+
+} // namespace infinity
@@ -31,7 +31,8 @@ namespace infinity {
 
 export template <typename CentroidsDataType, typename VectorDataType = CentroidsDataType>
 struct AnnIVFFlatIndexData {
-    using CommonType = std::common_type_t<VectorDataType, CentroidsDataType>;
+    // the centroids are trained and compared in CentroidsDataType, also for the int8, uint8 and float16 vectors
+    using CommonType = CentroidsDataType;
     bool loaded_{false};
     MetricType metric_{MetricType::kInvalid};
     u32 dimension_{};
@@ -0,0 +1,266 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module annivfpq_index_data;
+
+import stl;
+import index_base;
+import file_system;
+import file_system_type;
+import search_top_k;
+import kmeans_partition;
+import infinity_exception;
+import logger;
+import third_party;
+import status;
+import simd_dispatch;
+
+namespace infinity {
+
+// IVF with product quantized residuals. A vector x in partition c is stored as the pq codes of the residual x - centroid(c):
+// the residual is split into subspace_num_ subvectors of subspace_dim_ dimensions (the last one may be shorter), and each
+// subvector is the one byte id of the nearest of 256 centroids in the codebook of its subspace.
+export struct AnnIVFPQIndexData {
+    using CodeType = u8;
+    static constexpr u32 pq_centroid_num_ = 256;
+
+    bool loaded_{false};
+    MetricType metric_{MetricType::kInvalid};
+    u32 dimension_{};
+    u32 partition_num_{};
+    u32 subspace_num_{};
+    u32 subspace_dim_{};
+    u32 data_num_{};
+    Vector<f32> centroids_;
+    // subspace_num_ * pq_centroid_num_ * subspace_dim_
+    Vector<f32> codebook_;
+    Vector<Vector<u32>> ids_;
+    // subspace_num_ codes per vector
+    Vector<Vector<CodeType>> codes_;
+
+    AnnIVFPQIndexData() = default;
+    AnnIVFPQIndexData(MetricType metric, u32 dimension, u32 partition_num, u32 subspace_num)
+        : metric_(metric), dimension_(dimension), partition_num_(partition_num), subspace_num_(subspace_num) {
+        if (subspace_num_ == 0 || subspace_num_ > dimension_) {
+            UnrecoverableError(fmt::format("AnnIVFPQIndexData: invalid subspace_num {} for dimension {}", subspace_num_, dimension_));
+        }
+        subspace_dim_ = (dimension_ + subspace_num_ - 1) / subspace_num_;
+        // recompute, e.g. dimension 10 with 4 subspaces is 3 + 3 + 3 + 1, 10 with 6 subspaces is 2 * 5
+        subspace_num_ = (dimension_ + subspace_dim_ - 1) / subspace_dim_;
+    }
+
+    u32 SubspaceDim(u32 s) const { return std::min(subspace_dim_, dimension_ - s * subspace_dim_); }
+
+    const f32 *PQCentroid(u32 s, u32 c) const { return codebook_.data() + (s * pq_centroid_num_ + c) * subspace_dim_; }
+
+    // use iter for both training and insert
+    // used when create index for a segment
+    void BuildIndex(auto &&iter, const u32 dimension, const u32 full_row_count) {
+        if (loaded_) {
+            UnrecoverableError("AnnIVFPQIndexData::BuildIndex(): Index data already exists.");
+        }
+        if (dimension != dimension_) {
+            UnrecoverableError("Dimension not match");
+        }
+        if (metric_ != MetricType::kMetricL2 && metric_ != MetricType::kMetricInnerProduct) {
+            Status status = Status::NotSupport("Metric type not supported");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+            return;
+        }
+
+        // step 1. load input data
+        Vector<f32> segment_column_data;
+        segment_column_data.reserve(full_row_count * dimension);
+        Vector<SegmentOffset> segment_offset;
+        segment_offset.reserve(full_row_count);
+        u32 cnt = 0;
+        while (true) {
+            auto pair_opt = iter.Next();
+            if (!pair_opt) {
+                break;
+            }
+            if (cnt >= full_row_count) {
+                UnrecoverableError("AnnIVFPQIndexData::BuildIndex(): segment row count more than expected");
+            }
+            auto &[val_ptr, offset] = pair_opt.value();
+            segment_column_data.insert(segment_column_data.end(), val_ptr, val_ptr + dimension);
+            segment_offset.push_back(offset);
+            ++cnt;
+        }
+        if (cnt == 0) {
+            loaded_ = true;
+            return;
+        }
+
+        // step 2. train the coarse centroids
+        partition_num_ = std::min(partition_num_, cnt);
+        partition_num_ = GetKMeansCentroids<f32>(metric_, dimension_, cnt, segment_column_data.data(), centroids_, partition_num_);
+
+        // step 3. assign vectors to partitions, and replace them by their residuals in place
+        auto assigned_partition_id = MakeUniqueForOverwrite<u32[]>(cnt);
+        search_top_1_without_dis<f32>(dimension_, cnt, segment_column_data.data(), partition_num_, centroids_.data(), assigned_partition_id.get());
+        for (u32 i = 0; i < cnt; ++i) {
+            f32 *v = segment_column_data.data() + (SizeT)i * dimension_;
+            const f32 *centroid = centroids_.data() + (SizeT)assigned_partition_id[i] * dimension_;
+            for (u32 j = 0; j < dimension_; ++j) {
+                v[j] -= centroid[j];
+            }
+        }
+
+        // step 4. train the residual codebooks, then encode
+        TrainCodebook(cnt, segment_column_data.data());
+        ids_.resize(partition_num_);
+        codes_.resize(partition_num_);
+        for (u32 i = 0; i < cnt; ++i) {
+            u32 partition_id = assigned_partition_id[i];
+            auto &codes = codes_[partition_id];
+            SizeT code_offset = codes.size();
+            codes.resize(code_offset + subspace_num_);
+            Encode(segment_column_data.data() + (SizeT)i * dimension_, codes.data() + code_offset);
+            ids_[partition_id].push_back(segment_offset[i]);
+        }
+        data_num_ += cnt;
+        loaded_ = true;
+    }
+
+    void TrainCodebook(u32 vector_count, const f32 *residuals) {
+        codebook_.assign((SizeT)subspace_num_ * pq_centroid_num_ * subspace_dim_, 0.0f);
+        auto sub_vecs = MakeUniqueForOverwrite<f32[]>((SizeT)vector_count * subspace_dim_);
+        Vector<f32> sub_centroids;
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            u32 sub_dim = SubspaceDim(s);
+            for (u32 i = 0; i < vector_count; ++i) {
+                const f32 *src = residuals + (SizeT)i * dimension_ + s * subspace_dim_;
+                std::copy(src, src + sub_dim, sub_vecs.get() + (SizeT)i * sub_dim);
+            }
+            u32 sub_partition_num = std::min(pq_centroid_num_, vector_count);
+            u32 real_num = GetKMeansCentroids<f32>(MetricType::kMetricL2, sub_dim, vector_count, sub_vecs.get(), sub_centroids, sub_partition_num);
+            for (u32 c = 0; c < pq_centroid_num_; ++c) {
+                // unused ids repeat the first centroid, Encode never chooses them
+                const f32 *src = sub_centroids.data() + (c < real_num ? c : 0) * sub_dim;
+                std::copy(src, src + sub_dim, codebook_.data() + (s * pq_centroid_num_ + c) * subspace_dim_);
+            }
+        }
+    }
+
+    void Encode(const f32 *residual, CodeType *codes) const {
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            const f32 *sub_vec = residual + s * subspace_dim_;
+            u32 sub_dim = SubspaceDim(s);
+            u32 best_c = 0;
+            f32 best_dist = std::numeric_limits<f32>::max();
+            for (u32 c = 0; c < pq_centroid_num_; ++c) {
+                const f32 *pq_centroid = PQCentroid(s, c);
+                f32 dist = 0;
+                for (u32 j = 0; j < sub_dim; ++j) {
+                    f32 t = sub_vec[j] - pq_centroid[j];
+                    dist += t * t;
+                }
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best_c = c;
+                }
+            }
+            codes[s] = static_cast<CodeType>(best_c);
+        }
+    }
+
+    // Distance table of query for a partition, subspace_num_ * pq_centroid_num_.
+    // l2: table[s][c] = |q_s - centroid_s - codebook[s][c]|^2, and the distance is the sum of the looked up entries.
+    // ip: table[s][c] = q_s * codebook[s][c], and the distance is q * centroid plus the sum. The table does not depend
+    // on the partition, only `bias` of ADCScan does, and `centroid` is not used.
+    void MakeADCTable(const f32 *query, const f32 *centroid, f32 *table) const {
+        for (u32 s = 0; s < subspace_num_; ++s) {
+            u32 sub_dim = SubspaceDim(s);
+            const f32 *q = query + s * subspace_dim_;
+            f32 *sub_table = table + s * pq_centroid_num_;
+            for (u32 k = 0; k < pq_centroid_num_; ++k) {
+                const f32 *pq_centroid = PQCentroid(s, k);
+                f32 res = 0;
+                if (metric_ == MetricType::kMetricL2) {
+                    const f32 *c = centroid + s * subspace_dim_;
+                    for (u32 j = 0; j < sub_dim; ++j) {
+                        f32 t = q[j] - c[j] - pq_centroid[j];
+                        res += t * t;
+                    }
+                } else {
+                    for (u32 j = 0; j < sub_dim; ++j) {
+                        res += q[j] * pq_centroid[j];
+                    }
+                }
+                sub_table[k] = res;
+            }
+        }
+    }
+
+    // Distances of the n encoded vectors in `codes`, by the gather kernel of the supported simd level or the plain loop.
+    void ADCScan(const f32 *table, const CodeType *codes, u32 n, f32 bias, f32 *distances) const {
+        static_assert(pq_centroid_num_ == 256, "the adc scan kernels look up 256 table entries per subspace");
+        GetSIMDFunctions().adc_scan_(table, codes, subspace_num_, n, bias, distances);
+    }
+
+    void SaveIndexInner(FileHandler &file_handler) {
+        if (!loaded_) {
+            UnrecoverableError("AnnIVFPQIndexData::SaveIndexInner(): Index data not loaded.");
+        }
+        file_handler.Write(&metric_, sizeof(metric_));
+        file_handler.Write(&dimension_, sizeof(dimension_));
+        file_handler.Write(&partition_num_, sizeof(partition_num_));
+        file_handler.Write(&subspace_num_, sizeof(subspace_num_));
+        file_handler.Write(&subspace_dim_, sizeof(subspace_dim_));
+        file_handler.Write(&data_num_, sizeof(data_num_));
+        if (!centroids_.empty()) {
+            file_handler.Write(centroids_.data(), sizeof(f32) * dimension_ * partition_num_);
+            file_handler.Write(codebook_.data(), sizeof(f32) * codebook_.size());
+            u32 vector_element_num;
+            for (u32 i = 0; i < partition_num_; ++i) {
+                vector_element_num = ids_[i].size();
+                file_handler.Write(&vector_element_num, sizeof(vector_element_num));
+                file_handler.Write(ids_[i].data(), sizeof(u32) * vector_element_num);
+                file_handler.Write(codes_[i].data(), sizeof(CodeType) * subspace_num_ * vector_element_num);
+            }
+        }
+    }
+
+    void ReadIndexInner(FileHandler &file_handler) {
+        file_handler.Read(&metric_, sizeof(metric_));
+        file_handler.Read(&dimension_, sizeof(dimension_));
+        file_handler.Read(&partition_num_, sizeof(partition_num_));
+        file_handler.Read(&subspace_num_, sizeof(subspace_num_));
+        file_handler.Read(&subspace_dim_, sizeof(subspace_dim_));
+        file_handler.Read(&data_num_, sizeof(data_num_));
+        if (data_num_ > 0) {
+            centroids_.resize(dimension_ * partition_num_);
+            codebook_.resize((SizeT)subspace_num_ * pq_centroid_num_ * subspace_dim_);
+            ids_.resize(partition_num_);
+            codes_.resize(partition_num_);
+            file_handler.Read(centroids_.data(), sizeof(f32) * dimension_ * partition_num_);
+            file_handler.Read(codebook_.data(), sizeof(f32) * codebook_.size());
+            u32 vector_element_num;
+            for (u32 i = 0; i < partition_num_; ++i) {
+                file_handler.Read(&vector_element_num, sizeof(vector_element_num));
+                ids_[i].resize(vector_element_num);
+                file_handler.Read(ids_[i].data(), sizeof(u32) * vector_element_num);
+                codes_[i].resize(subspace_num_ * vector_element_num);
+                file_handler.Read(codes_[i].data(), sizeof(CodeType) * subspace_num_ * vector_element_num);
+            }
+        }
+        loaded_ = true;
+    }
+};
+
+} // namespace infinity
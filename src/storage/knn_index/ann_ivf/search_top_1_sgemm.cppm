@@ -14,33 +14,33 @@
 
 module;
 
-#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
-#include <immintrin.h>
-#elif defined(__GNUC__) && defined(__aarch64__)
-#include <simde/x86/avx512.h>
+#include "storage/knn_index/knn_hnsw/header.h"
+#if defined(__GNUC__) && defined(__aarch64__)
 #define __SSE2__
 #endif
 
 import stl;
 import mlas_matrix_multiply;
 import vector_distance;
+import simd_dispatch;
 
 export module search_top_1_sgemm;
 
 namespace infinity {
 
-#if defined(__AVX2__)
-
-export template <typename ID>
-void search_top_1_with_sgemm(u32 dimension,
-                             u32 nx,
-                             const f32 *x,
-                             u32 ny,
-                             const f32 *y,
-                             ID *labels,
-                             f32 *distances = nullptr,
-                             u32 block_size_x = 4096,
-                             u32 block_size_y = 1024) {
+// The avx2 version is compiled with its own target attribute, and only called if the cpu supports avx2.
+#if defined(USE_AVX)
+
+template <typename ID>
+SIMD_TARGET_AVX2 void search_top_1_with_sgemm_avx2(u32 dimension,
+                                                   u32 nx,
+                                                   const f32 *x,
+                                                   u32 ny,
+                                                   const f32 *y,
+                                                   ID *labels,
+                                                   f32 *distances,
+                                                   u32 block_size_x,
+                                                   u32 block_size_y) {
     if (nx == 0 || ny == 0)
         return;
     UniquePtr<f32[]> distances_holder;
@@ -155,18 +155,20 @@ void search_top_1_with_sgemm(u32 dimension,
     }
 }
 
-#elif defined(__SSE2__)
+#endif
 
-export template <typename ID>
-void search_top_1_with_sgemm(u32 dimension,
-                             u32 nx,
-                             const f32 *x,
-                             u32 ny,
-                             const f32 *y,
-                             ID *labels,
-                             f32 *distances = nullptr,
-                             u32 block_size_x = 4096,
-                             u32 block_size_y = 1024) {
+#if defined(__SSE2__)
+
+template <typename ID>
+void search_top_1_with_sgemm_sse2(u32 dimension,
+                                  u32 nx,
+                                  const f32 *x,
+                                  u32 ny,
+                                  const f32 *y,
+                                  ID *labels,
+                                  f32 *distances,
+                                  u32 block_size_x,
+                                  u32 block_size_y) {
     if (nx == 0 || ny == 0)
         return;
     UniquePtr<f32[]> distances_holder;
@@ -283,4 +285,22 @@ void search_top_1_with_sgemm(u32 dimension,
 
 #endif
 
+export template <typename ID>
+void search_top_1_with_sgemm(u32 dimension,
+                             u32 nx,
+                             const f32 *x,
+                             u32 ny,
+                             const f32 *y,
+                             ID *labels,
+                             f32 *distances = nullptr,
+                             u32 block_size_x = 4096,
+                             u32 block_size_y = 1024) {
+#if defined(USE_AVX)
+    if (GetSupportedSIMDLevel() >= SIMDLevel::kAVX2) {
+        return search_top_1_with_sgemm_avx2(dimension, nx, x, ny, y, labels, distances, block_size_x, block_size_y);
+    }
+#endif
+    search_top_1_with_sgemm_sse2(dimension, nx, x, ny, y, labels, distances, block_size_x, block_size_y);
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -85,9 +85,9 @@ void search_top_k_simple_with_dis(u32 k, u32 dimension, u32 nx, const TypeX *x,
     heap_twin_multiple<CompareMax<DistType, ID>> heap(nx, k, distances, labels);
     heap.initialize();
     for (u32 i = 0; i < nx; ++i) {
-        const DistType *x_i = x + i * dimension;
+        const TypeX *x_i = x + i * dimension;
         for (u32 j = 0; j < ny; j++) {
-            const DistType *y_j = y + j * dimension;
+            const TypeY *y_j = y + j * dimension;
             DistType distance = L2Distance<DistType>(x_i, y_j, dimension);
             heap.add(i, distance, j);
         }
@@ -14,24 +14,23 @@
 
 module;
 
-#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
-#include <immintrin.h>
-#elif defined(__GNUC__) && defined(__aarch64__)
-#include <simde/x86/avx512.h>
+#include "storage/knn_index/knn_hnsw/header.h"
+#if defined(__GNUC__) && defined(__aarch64__)
 #define __SSE__
 #endif
 
 export module some_simd_functions;
 
 import stl;
-import hnsw_simd_func;
+import simd_dispatch;
 
 namespace infinity {
 
-#if defined(__AVX2__)
+// The avx2 kernels are compiled with their own target attribute, and only called if the cpu supports avx2.
+#if defined(USE_AVX)
 
 // x = ( x7, x6, x5, x4, x3, x2, x1, x0 )
-float calc_256_sum_8(__m256 x) {
+SIMD_TARGET_AVX2 float calc_256_sum_8(__m256 x) {
    // high_quad = ( x7, x6, x5, x4 )
    const __m128 high_quad = _mm256_extractf128_ps(x, 1);
    // low_quad = ( x3, x2, x1, x0 )
@@ -55,9 +54,9 @@ float calc_256_sum_8(__m256 x) {
 
 #endif
 
-#if defined(__AVX2__)
+#if defined(USE_AVX)
 
-export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+SIMD_TARGET_AVX2 f32 L2DistanceAVX2(const f32 *vector1, const f32 *vector2, u32 dimension) {
    u32 i = 0;
    __m256 sum_1 = _mm256_setzero_ps();
    __m256 sum_2 = _mm256_setzero_ps();
@@ -88,17 +87,25 @@ export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
    return distance;
 }
 
-#elif defined(__SSE__) 
+#endif
 
-export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-    return F32L2SSEResidual(vector1, vector2, dimension);
-}
+using IVFDistanceFuncType = f32 (*)(const f32 *, const f32 *, u32);
 
+export f32 L2Distance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+    static const IVFDistanceFuncType func = []() -> IVFDistanceFuncType {
+#if defined(USE_AVX)
+        if (GetSupportedSIMDLevel() >= SIMDLevel::kAVX2) {
+            return L2DistanceAVX2;
+        }
 #endif
+        return [](const f32 *v1, const f32 *v2, u32 dim) { return GetSIMDFunctions().f32_l2_residual_(v1, v2, dim); };
+    }();
+    return func(vector1, vector2, dimension);
+}
 
-#if defined(__AVX2__)
+#if defined(USE_AVX)
 
-export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
+SIMD_TARGET_AVX2 f32 IPDistanceAVX2(const f32 *vector1, const f32 *vector2, u32 dimension) {
    u32 i = 0;
    __m256 sum_1 = _mm256_setzero_ps();
    __m256 sum_2 = _mm256_setzero_ps();
@@ -125,12 +132,18 @@ export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension
    return distance;
 }
 
-#elif defined(__SSE__) 
+#endif
 
 export f32 IPDistance_simd(const f32 *vector1, const f32 *vector2, u32 dimension) {
-    return F32IPSSEResidual(vector1, vector2, dimension);
-}
-
+    static const IVFDistanceFuncType func = []() -> IVFDistanceFuncType {
+#if defined(USE_AVX)
+        if (GetSupportedSIMDLevel() >= SIMDLevel::kAVX2) {
+            return IPDistanceAVX2;
+        }
 #endif
+        return [](const f32 *v1, const f32 *v2, u32 dim) { return GetSIMDFunctions().f32_ip_residual_(v1, v2, dim); };
+    }();
+    return func(vector1, vector2, dimension);
+}
 
 } // namespace infinity
\ No newline at end of file
@@ -16,6 +16,7 @@ module;
 #include <type_traits>
 import stl;
 import some_simd_functions;
+import simd_dispatch;
 
 export module vector_distance;
 
@@ -24,10 +25,20 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType L2Distance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return L2Distance_simd(vector1, vector2, dimension);
+    } else if constexpr ((std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) ||
+                         (std::is_same_v<ElemType1, u8> && std::is_same_v<ElemType2, u8>)) {
+        // Accumulate in i32, exact for dimension < 2^15
+        i32 distance = 0;
+        for (u32 i = 0; i < dimension; ++i) {
+            i32 diff = i32(vector1[i]) - i32(vector2[i]);
+            distance += diff * diff;
+        }
+        return (DiffType)distance;
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
-            auto diff = (DiffType)(vector1[i] - vector2[i]);
+            // widen before the subtraction, float16 elements are computed in DiffType
+            auto diff = (DiffType)vector1[i] - (DiffType)vector2[i];
             distance += diff * diff;
         }
         return distance;
@@ -38,6 +49,15 @@ export template <typename DiffType, typename ElemType1, typename ElemType2, type
 DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const DimType dimension) {
     if constexpr (std::is_same_v<ElemType1, f32> && std::is_same_v<ElemType2, f32>) {
         return IPDistance_simd(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, i8> && std::is_same_v<ElemType2, i8>) {
+        // the int8 kernel of the supported simd level, accumulated in i32
+        return (DiffType)GetSIMDFunctions().I8IP(dimension)(vector1, vector2, dimension);
+    } else if constexpr (std::is_same_v<ElemType1, u8> && std::is_same_v<ElemType2, u8>) {
+        i32 distance = 0;
+        for (u32 i = 0; i < dimension; ++i) {
+            distance += i32(vector1[i]) * i32(vector2[i]);
+        }
+        return (DiffType)distance;
     } else {
         DiffType distance{};
         for (u32 i = 0; i < dimension; ++i) {
@@ -47,6 +67,12 @@ DiffType IPDistance(const ElemType1 *vector1, const ElemType2 *vector2, const Di
     }
 }
 
+// Bit vectors are packed in bytes, the dimension is the number of bytes
+export template <typename DiffType, typename DimType = u32>
+DiffType HammingDistance(const u8 *vector1, const u8 *vector2, const DimType dimension) {
+    return static_cast<DiffType>(GetSIMDFunctions().hamming_(vector1, vector2, dimension));
+}
+
 export template <typename DiffType, typename ElemType, typename DimType = u32>
 DiffType L2NormSquare(const ElemType *vector, const DimType dimension) {
     return IPDistance<DiffType>(vector, vector, dimension);
@@ -39,8 +39,23 @@ class AbstractHnsw {
     using Hnsw2 = KnnHnsw<PlainL2VecStoreType<DataType>, LabelType>;
     using Hnsw3 = KnnHnsw<LVQIPVecStoreType<DataType, i8>, LabelType>;
     using Hnsw4 = KnnHnsw<LVQL2VecStoreType<DataType, i8>, LabelType>;
+    using Hnsw5 = KnnHnsw<PQIPVecStoreType<DataType>, LabelType>;
+    using Hnsw6 = KnnHnsw<PQL2VecStoreType<DataType>, LabelType>;
+    using Hnsw7 = KnnHnsw<BinaryHammingVecStoreType, LabelType>;
+
+    // LVQ and PQ only encode float vectors
+    constexpr static bool kSupportEncode = std::is_same_v<DataType, f32>;
+    // u8 is a uint8 column, or the packed bytes of a bit column, which is only compared by hamming distance
+    constexpr static bool kSupportBinary = std::is_same_v<DataType, u8>;
+    using HnswPtr = std::conditional_t<kSupportBinary,
+                                       std::variant<Hnsw1 *, Hnsw2 *, Hnsw7 *>,
+                                       std::conditional_t<kSupportEncode,
+                                                          std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *, Hnsw5 *, Hnsw6 *>,
+                                                          std::variant<Hnsw1 *, Hnsw2 *>>>;
 
 public:
+    using DistanceType = typename std::remove_pointer_t<std::variant_alternative_t<0, HnswPtr>>::DistanceType;
+
     AbstractHnsw(void *ptr, const IndexHnsw *index_hnsw) {
         switch (index_hnsw->encode_type_) {
             case HnswEncodeType::kPlain: {
@@ -53,25 +68,57 @@ public:
                         knn_hnsw_ptr_ = reinterpret_cast<Hnsw2 *>(ptr);
                         break;
                     }
+                    case MetricType::kMetricHamming: {
+                        if constexpr (kSupportBinary) {
+                            knn_hnsw_ptr_ = reinterpret_cast<Hnsw7 *>(ptr);
+                        } else {
+                            UnrecoverableError("HNSW hamming distance only supports bit embedding.");
+                        }
+                        break;
+                    }
                     default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        UnrecoverableError("HNSW supports inner product, L2 and hamming distance.");
                     }
                 }
                 break;
             }
             case HnswEncodeType::kLVQ: {
-                switch (index_hnsw->metric_type_) {
-                    case MetricType::kMetricInnerProduct: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw3 *>(ptr);
-                        break;
-                    }
-                    case MetricType::kMetricL2: {
-                        knn_hnsw_ptr_ = reinterpret_cast<Hnsw4 *>(ptr);
-                        break;
+                if constexpr (kSupportEncode) {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricInnerProduct: {
+                            knn_hnsw_ptr_ = reinterpret_cast<Hnsw3 *>(ptr);
+                            break;
+                        }
+                        case MetricType::kMetricL2: {
+                            knn_hnsw_ptr_ = reinterpret_cast<Hnsw4 *>(ptr);
+                            break;
+                        }
+                        default: {
+                            UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        }
                     }
-                    default: {
-                        UnrecoverableError("HNSW supports inner product and L2 distance.");
+                } else {
+                    UnrecoverableError("LVQ encoding only supports float embedding.");
+                }
+                break;
+            }
+            case HnswEncodeType::kPQ: {
+                if constexpr (kSupportEncode) {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricInnerProduct: {
+                            knn_hnsw_ptr_ = reinterpret_cast<Hnsw5 *>(ptr);
+                            break;
+                        }
+                        case MetricType::kMetricL2: {
+                            knn_hnsw_ptr_ = reinterpret_cast<Hnsw6 *>(ptr);
+                            break;
+                        }
+                        default: {
+                            UnrecoverableError("HNSW supports inner product and L2 distance.");
+                        }
                     }
+                } else {
+                    UnrecoverableError("PQ encoding only supports float embedding.");
                 }
                 break;
             }
@@ -116,6 +163,10 @@ public:
         std::visit([idx](auto &&arg) { arg->Build(idx); }, knn_hnsw_ptr_);
     }
 
+    void Optimize() {
+        std::visit([](auto &&arg) { arg->Optimize(); }, knn_hnsw_ptr_);
+    }
+
     void *RawPtr() const {
         return std::visit([](auto &&arg) { return reinterpret_cast<void *>(arg); }, knn_hnsw_ptr_);
     }
@@ -139,7 +190,7 @@ public:
     }
 
     template <FilterConcept<LabelType> Filter>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>>
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>>
     KnnSearch(const DataType *q, SizeT k, const Filter &filter, bool with_lock = true) const {
         return std::visit(
             [q, k, &filter, with_lock](auto &&arg) {
@@ -152,7 +203,7 @@ public:
             knn_hnsw_ptr_);
     }
 
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, bool with_lock = true) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, bool with_lock = true) const {
         return std::visit(
             [q, k, with_lock](auto &&arg) {
                 if (with_lock) {
@@ -165,7 +216,7 @@ public:
     }
 
 private:
-    std::variant<Hnsw1 *, Hnsw2 *, Hnsw3 *, Hnsw4 *> knn_hnsw_ptr_;
+    HnswPtr knn_hnsw_ptr_;
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -0,0 +1,124 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <ostream>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <xmmintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/sse.h>
+#endif
+
+export module binary_vec_store;
+
+import stl;
+import file_system;
+import hnsw_common;
+
+namespace infinity {
+
+// Bit vectors packed in bytes, one bit a dimension, lowest bit first. A vector of dim bits takes (dim + 7) / 8 bytes, which is the
+// dim() of the store, the number of u8 elements of a vector.
+export class BinaryVecStoreMeta {
+public:
+    using This = BinaryVecStoreMeta;
+    using StoreType = const u8 *;
+    using QueryType = const u8 *;
+
+private:
+    BinaryVecStoreMeta(SizeT byte_n) : byte_n_(byte_n) {}
+
+public:
+    BinaryVecStoreMeta() : byte_n_(0) {}
+    BinaryVecStoreMeta(This &&other) : byte_n_(std::exchange(other.byte_n_, 0)) {}
+    This &operator=(This &&other) {
+        if (this != &other) {
+            byte_n_ = std::exchange(other.byte_n_, 0);
+        }
+        return *this;
+    }
+    ~BinaryVecStoreMeta() = default;
+
+    // dim is the number of bits
+    static This Make(SizeT dim) { return This((dim + 7) / 8); }
+
+    void Save(FileHandler &file_handler) const { file_handler.Write(&byte_n_, sizeof(byte_n_)); }
+
+    static This Load(FileHandler &file_handler) {
+        SizeT byte_n;
+        file_handler.Read(&byte_n, sizeof(byte_n));
+        return This(byte_n);
+    }
+
+    QueryType MakeQuery(const u8 *vec) const { return vec; }
+
+    SizeT dim() const { return byte_n_; }
+
+private:
+    SizeT byte_n_;
+
+public:
+    void Dump(std::ostream &os) const { os << "[CONST] bytes: " << byte_n_ << std::endl; }
+};
+
+export class BinaryVecStoreInner {
+public:
+    using This = BinaryVecStoreInner;
+    using Meta = BinaryVecStoreMeta;
+
+private:
+    BinaryVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<u8[]>(max_vec_num * meta.dim())) {}
+
+public:
+    BinaryVecStoreInner() = default;
+
+    static This Make(SizeT max_vec_num, const Meta &meta) { return This(max_vec_num, meta); }
+
+    void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const { file_handler.Write(ptr_.get(), cur_vec_num * meta.dim()); }
+
+    static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta) {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        file_handler.Read(ret.ptr_.get(), cur_vec_num * meta.dim());
+        return ret;
+    }
+
+    void SetVec(SizeT idx, const u8 *vec, const Meta &meta) { Copy(vec, vec + meta.dim(), GetVecMut(idx, meta)); }
+
+    const u8 *GetVec(SizeT idx, const Meta &meta) const { return ptr_.get() + idx * meta.dim(); }
+
+    void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
+
+private:
+    u8 *GetVecMut(SizeT idx, const Meta &meta) { return ptr_.get() + idx * meta.dim(); }
+
+private:
+    UniquePtr<u8[]> ptr_;
+
+public:
+    void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
+        for (int i = 0; i < (int)chunk_size; i++) {
+            os << "vec " << i << "(" << offset + i << "): ";
+            const u8 *v = GetVec(i, meta);
+            for (SizeT j = 0; j < meta.dim() * 8; j++) {
+                os << ((v[j / 8] >> (j % 8)) & 1);
+            }
+            os << std::endl;
+        }
+    }
+};
+
+} // namespace infinity
@@ -139,6 +139,11 @@ public:
 
     template <DataIteratorConcept<const DataType *, LabelType> Iterator>
     Pair<SizeT, SizeT> AddVec(Iterator &&query_iter) {
+        if constexpr (This::IsPQ()) {
+            // The codebooks are trained by the first vectors, OptAddVec trains them on all vectors and the dump of a memory index again
+            Iterator query_iter_copy = query_iter;
+            vec_store_meta_.template Collect<LabelType, Iterator>(std::move(query_iter_copy), VecInners());
+        }
         SizeT cur_vec_num = this->cur_vec_num();
         SizeT start_idx = cur_vec_num;
         auto [chunk_num, last_chunk_size] = ChunkInfo(cur_vec_num);
@@ -167,16 +172,9 @@ public:
     template <DataIteratorConcept<const DataType *, LabelType> Iterator>
     Pair<SizeT, SizeT> OptAddVec(Iterator &&query_iter) {
         if constexpr (!This::IsPlain()) {
-            SizeT cur_vec_num = this->cur_vec_num();
-            auto [chunk_num, last_chunk_size] = ChunkInfo(cur_vec_num);
-            if (chunk_num > 0) {
-                Vector<Pair<VecStoreInner *, SizeT>> vec_inners;
-                for (SizeT i = 0; i < chunk_num; ++i) {
-                    SizeT chunk_size = (i < chunk_num - 1) ? chunk_size_ : last_chunk_size;
-                    vec_inners.emplace_back(inners_[i].vec_store_inner(), chunk_size);
-                }
+            if (this->cur_vec_num() > 0) {
                 Iterator query_iter_copy = query_iter;
-                vec_store_meta_.template Optimize<LabelType, Iterator>(std::move(query_iter_copy), vec_inners);
+                vec_store_meta_.template Optimize<LabelType, Iterator>(std::move(query_iter_copy), VecInners());
             }
         }
         return AddVec(std::move(query_iter));
@@ -186,6 +184,11 @@ public:
         if constexpr (This::IsPlain()) {
             return;
         }
+        if constexpr (This::IsPQ()) {
+            // the codebooks of an index with fewer than PQVecStoreMeta::retrain_num_ vectors are trained on all of them
+            vec_store_meta_.Retrain(VecInners());
+            return;
+        }
         DenseVectorIter<DataType, LabelType> empty_iter(nullptr, dim(), 0);
         AddVec(std::move(empty_iter));
     }
@@ -248,7 +251,23 @@ public:
 
 private:
     constexpr static bool IsPlain() {
-        return std::is_same_v<VecStoreT, PlainL2VecStoreType<DataType>> || std::is_same_v<VecStoreT, PlainIPVecStoreType<DataType>>;
+        return std::is_same_v<VecStoreT, PlainL2VecStoreType<DataType>> || std::is_same_v<VecStoreT, PlainIPVecStoreType<DataType>> ||
+               std::is_same_v<VecStoreT, BinaryHammingVecStoreType>;
+    }
+
+    constexpr static bool IsPQ() {
+        return std::is_same_v<VecStoreT, PQL2VecStoreType<DataType>> || std::is_same_v<VecStoreT, PQIPVecStoreType<DataType>>;
+    }
+
+    // the vector store of each chunk with its vector count
+    Vector<Pair<VecStoreInner *, SizeT>> VecInners() {
+        Vector<Pair<VecStoreInner *, SizeT>> vec_inners;
+        auto [chunk_num, last_chunk_size] = ChunkInfo(this->cur_vec_num());
+        for (SizeT i = 0; i < chunk_num; ++i) {
+            SizeT chunk_size = (i < chunk_num - 1) ? chunk_size_ : last_chunk_size;
+            vec_inners.emplace_back(inners_[i].vec_store_inner(), chunk_size);
+        }
+        return vec_inners;
     }
 
     Pair<Inner &, SizeT> GetInner(SizeT vec_i) { return {inners_[vec_i >> chunk_shift_], vec_i & (chunk_size_ - 1)}; }
@@ -0,0 +1,396 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <ostream>
+#include <random>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <xmmintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/sse.h>
+#endif
+
+export module pq_vec_store;
+
+import stl;
+import file_system;
+import hnsw_common;
+import index_base;
+import kmeans_partition;
+
+namespace infinity {
+
+// A stored vector is its codes. A query carries its distance table instead, see PQVecStoreMeta::MakeQuery.
+export template <typename DataType>
+struct PQVec {
+    const u8 *codes_{};
+    const DataType *table_{};
+};
+
+export template <typename DataType, typename PQMetric>
+class PQVecStoreInner;
+
+// Product quantization: a vector is split into subspaces of subspace_dim_ dimensions, and every subvector is encoded as
+// the id of the nearest centroid in the codebook of its subspace. The last subspace is shorter if dim is not a multiple
+// of subspace_dim_. PQMetric::Distance(a, b, dim) is the distance of two subvectors, the distance of two vectors is the
+// sum over all subspaces.
+export template <typename DataType, typename PQMetric>
+class PQVecStoreMeta {
+public:
+    using CodeType = u8;
+    constexpr static SizeT subspace_dim_ = 8;
+    constexpr static SizeT centroid_num_ = 256;
+    // at most so many vectors are sampled to train the codebooks
+    constexpr static SizeT max_train_num_ = 65536;
+    // the codebooks trained by the first insert are trained again on the first so many vectors when the memory index is dumped
+    constexpr static SizeT retrain_num_ = 16384;
+
+    using This = PQVecStoreMeta<DataType, PQMetric>;
+    using Inner = PQVecStoreInner<DataType, PQMetric>;
+    using StoreType = PQVec<DataType>;
+    struct PQQuery {
+        // distance from each query subvector to each centroid of its subspace, subspace_num * centroid_num
+        UniquePtr<DataType[]> table_;
+        operator StoreType() const { return {nullptr, table_.get()}; }
+    };
+    using QueryType = PQQuery;
+
+private:
+    PQVecStoreMeta(SizeT dim) : dim_(dim), subspace_num_((dim + subspace_dim_ - 1) / subspace_dim_), trained_(false) {
+        codebook_ = MakeUnique<DataType[]>(codebook_size());
+    }
+
+public:
+    PQVecStoreMeta() : dim_(0), subspace_num_(0), trained_(false) {}
+    PQVecStoreMeta(This &&other)
+        : dim_(std::exchange(other.dim_, 0)), subspace_num_(std::exchange(other.subspace_num_, 0)), trained_(std::exchange(other.trained_, false)),
+          final_trained_(std::exchange(other.final_trained_, false)), codebook_(std::move(other.codebook_)),
+          collected_vecs_(std::move(other.collected_vecs_)) {}
+    This &operator=(This &&other) {
+        if (this != &other) {
+            dim_ = std::exchange(other.dim_, 0);
+            subspace_num_ = std::exchange(other.subspace_num_, 0);
+            trained_ = std::exchange(other.trained_, false);
+            final_trained_ = std::exchange(other.final_trained_, false);
+            codebook_ = std::move(other.codebook_);
+            collected_vecs_ = std::move(other.collected_vecs_);
+        }
+        return *this;
+    }
+    ~PQVecStoreMeta() = default;
+
+    static This Make(SizeT dim) { return This(dim); }
+
+    void Save(FileHandler &file_handler) const {
+        file_handler.Write(&dim_, sizeof(dim_));
+        file_handler.Write(&trained_, sizeof(trained_));
+        file_handler.Write(codebook_.get(), sizeof(DataType) * codebook_size());
+    }
+
+    static This Load(FileHandler &file_handler) {
+        SizeT dim;
+        file_handler.Read(&dim, sizeof(dim));
+        This meta(dim);
+        file_handler.Read(&meta.trained_, sizeof(meta.trained_));
+        file_handler.Read(meta.codebook_.get(), sizeof(DataType) * meta.codebook_size());
+        // a saved index is not trained again
+        meta.final_trained_ = meta.trained_;
+        return meta;
+    }
+
+    // The table is computed once per query, every distance to a stored vector is then subspace_num_ lookups.
+    PQQuery MakeQuery(const DataType *vec) const {
+        PQQuery query{MakeUniqueForOverwrite<DataType[]>(subspace_num_ * centroid_num_)};
+        for (SizeT s = 0; s < subspace_num_; ++s) {
+            const DataType *sub_vec = vec + s * subspace_dim_;
+            DataType *sub_table = query.table_.get() + s * centroid_num_;
+            for (SizeT c = 0; c < centroid_num_; ++c) {
+                sub_table[c] = PQMetric::Distance(sub_vec, Centroid(s, c), SubspaceDim(s));
+            }
+        }
+        return query;
+    }
+
+    void CompressTo(const DataType *src, CodeType *dest) const {
+        for (SizeT s = 0; s < subspace_num_; ++s) {
+            const DataType *sub_vec = src + s * subspace_dim_;
+            SizeT sub_dim = SubspaceDim(s);
+            SizeT best_c = 0;
+            DataType best_dist = std::numeric_limits<DataType>::max();
+            for (SizeT c = 0; c < centroid_num_; ++c) {
+                // encode by l2 for both metrics, the codebook is trained by l2 kmeans
+                DataType dist = SubL2(sub_vec, Centroid(s, c), sub_dim);
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best_c = c;
+                }
+            }
+            dest[s] = static_cast<CodeType>(best_c);
+        }
+    }
+
+    // v1 is the query if it carries a table (asymmetric distance), otherwise both are stored vectors (symmetric distance)
+    DataType Distance(const StoreType &v1, const StoreType &v2) const {
+        DataType res = 0;
+        if (v1.table_ != nullptr) {
+            const DataType *table = v1.table_;
+            for (SizeT s = 0; s < subspace_num_; ++s) {
+                res += table[s * centroid_num_ + v2.codes_[s]];
+            }
+        } else {
+            for (SizeT s = 0; s < subspace_num_; ++s) {
+                res += PQMetric::Distance(Centroid(s, v1.codes_[s]), Centroid(s, v2.codes_[s]), SubspaceDim(s));
+            }
+        }
+        return res;
+    }
+
+    // Retrain the codebooks on a sample of the stored and the new vectors, then encode the stored vectors again.
+    template <typename LabelType, DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Optimize(Iterator &&query_iter, const Vector<Pair<Inner *, SizeT>> &inners) {
+        // reservoir sampling, the seed is fixed so that a build is reproducible
+        std::mt19937 gen(0);
+        Vector<DataType> sample;
+        SizeT seen_num = 0;
+        auto add_sample = [&](const DataType *vec) {
+            if (seen_num < max_train_num_) {
+                sample.insert(sample.end(), vec, vec + dim_);
+            } else if (SizeT pos = std::uniform_int_distribution<SizeT>(0, seen_num)(gen); pos < max_train_num_) {
+                std::copy(vec, vec + dim_, sample.begin() + pos * dim_);
+            }
+            ++seen_num;
+        };
+
+        auto temp_decompress = MakeUnique<DataType[]>(dim_);
+        if (trained_) {
+            for (const auto [inner, size] : inners) {
+                for (SizeT i = 0; i < size; ++i) {
+                    DecompressTo(inner->GetVec(i, *this).codes_, temp_decompress.get());
+                    add_sample(temp_decompress.get());
+                }
+            }
+        }
+        while (true) {
+            if (auto ret = query_iter.Next(); ret) {
+                auto &[vec, _] = *ret;
+                add_sample(vec);
+            } else {
+                break;
+            }
+        }
+        SizeT sample_num = std::min(seen_num, max_train_num_);
+        if (sample_num == 0) {
+            return;
+        }
+
+        auto old_codebook = std::exchange(codebook_, MakeUnique<DataType[]>(codebook_size()));
+        bool old_trained = std::exchange(trained_, true);
+        Train(sample.data(), sample_num);
+        final_trained_ = true;
+        collected_vecs_ = Vector<DataType>();
+
+        if (old_trained) {
+            for (auto [inner, size] : inners) {
+                for (SizeT i = 0; i < size; ++i) {
+                    DecompressByCodebookTo(inner->GetVec(i, *this).codes_, old_codebook.get(), temp_decompress.get());
+                    inner->SetVec(i, temp_decompress.get(), *this);
+                }
+            }
+        }
+    }
+
+    // Called before the vectors of an insert are stored, `inners` hold the vectors stored so far. The raw vectors are collected until
+    // retrain_num_ of them are inserted. Only the first insert trains the codebooks, nothing is stored then so no search reads them.
+    // Searches of a memory index read the codebooks and the codes without an index-wide lock, so later inserts don't train again,
+    // Retrain does it when the index is dumped.
+    template <typename LabelType, DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Collect(Iterator &&query_iter, const Vector<Pair<Inner *, SizeT>> &inners) {
+        if (final_trained_) {
+            return;
+        }
+        while (collected_vecs_.size() < retrain_num_ * dim_) {
+            if (auto ret = query_iter.Next(); ret) {
+                auto &[vec, _] = *ret;
+                collected_vecs_.insert(collected_vecs_.end(), vec, vec + dim_);
+            } else {
+                break;
+            }
+        }
+        if (!trained_) {
+            TrainCollected(inners);
+        }
+    }
+
+    // Train the codebooks on the vectors collected so far, once, when no search runs on the index any more.
+    void Retrain(const Vector<Pair<Inner *, SizeT>> &inners) {
+        if (!final_trained_ && !collected_vecs_.empty()) {
+            final_trained_ = true;
+            TrainCollected(inners);
+        }
+    }
+
+    SizeT dim() const { return dim_; }
+    SizeT subspace_num() const { return subspace_num_; }
+    SizeT code_size() const { return sizeof(CodeType) * subspace_num_; }
+    bool trained() const { return trained_; }
+
+    // for unit test
+    const DataType *codebook() const { return codebook_.get(); }
+
+private:
+    SizeT codebook_size() const { return subspace_num_ * centroid_num_ * subspace_dim_; }
+
+    SizeT SubspaceDim(SizeT s) const { return std::min(subspace_dim_, dim_ - s * subspace_dim_); }
+
+    const DataType *Centroid(SizeT s, SizeT c) const { return codebook_.get() + (s * centroid_num_ + c) * subspace_dim_; }
+
+    static DataType SubL2(const DataType *v1, const DataType *v2, SizeT dim) {
+        DataType res = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            DataType t = v1[i] - v2[i];
+            res += t * t;
+        }
+        return res;
+    }
+
+    void Train(const DataType *sample, SizeT sample_num) {
+        auto sub_vecs = MakeUniqueForOverwrite<DataType[]>(sample_num * subspace_dim_);
+        Vector<DataType> centroids;
+        for (SizeT s = 0; s < subspace_num_; ++s) {
+            SizeT sub_dim = SubspaceDim(s);
+            for (SizeT i = 0; i < sample_num; ++i) {
+                const DataType *src = sample + i * dim_ + s * subspace_dim_;
+                std::copy(src, src + sub_dim, sub_vecs.get() + i * sub_dim);
+            }
+            u32 partition_num = std::min(centroid_num_, sample_num);
+            u32 real_num = GetKMeansCentroids<DataType>(MetricType::kMetricL2, sub_dim, sample_num, sub_vecs.get(), centroids, partition_num);
+            assert(real_num > 0);
+            for (SizeT c = 0; c < centroid_num_; ++c) {
+                // pad unused ids with the first centroid, CompressTo never chooses them
+                const DataType *centroid = centroids.data() + (c < real_num ? c : 0) * sub_dim;
+                std::copy(centroid, centroid + sub_dim, codebook_.get() + (s * centroid_num_ + c) * subspace_dim_);
+            }
+        }
+    }
+
+    void DecompressByCodebookTo(const CodeType *codes, const DataType *codebook, DataType *dest) const {
+        for (SizeT s = 0; s < subspace_num_; ++s) {
+            const DataType *centroid = codebook + (s * centroid_num_ + codes[s]) * subspace_dim_;
+            std::copy(centroid, centroid + SubspaceDim(s), dest + s * subspace_dim_);
+        }
+    }
+
+    void DecompressTo(const CodeType *codes, DataType *dest) const { DecompressByCodebookTo(codes, codebook_.get(), dest); }
+
+    // Train the codebooks on the collected vectors. The stored vectors that were collected are encoded again from their raw values,
+    // the later ones from their old codes.
+    void TrainCollected(const Vector<Pair<Inner *, SizeT>> &inners) {
+        SizeT collected_num = collected_vecs_.size() / dim_;
+        if (collected_num == 0) {
+            return;
+        }
+        auto old_codebook = std::exchange(codebook_, MakeUnique<DataType[]>(codebook_size()));
+        trained_ = true;
+        Train(collected_vecs_.data(), collected_num);
+        auto temp_decompress = MakeUnique<DataType[]>(dim_);
+        SizeT vec_i = 0;
+        for (auto [inner, size] : inners) {
+            for (SizeT i = 0; i < size; ++i, ++vec_i) {
+                if (vec_i < collected_num) {
+                    inner->SetVec(i, collected_vecs_.data() + vec_i * dim_, *this);
+                } else {
+                    DecompressByCodebookTo(inner->GetVec(i, *this).codes_, old_codebook.get(), temp_decompress.get());
+                    inner->SetVec(i, temp_decompress.get(), *this);
+                }
+            }
+        }
+        if (final_trained_) {
+            collected_vecs_ = Vector<DataType>();
+        }
+    }
+
+private:
+    SizeT dim_;
+    SizeT subspace_num_;
+    bool trained_;
+    // the codebooks are not trained again
+    bool final_trained_{false};
+
+    // subspace_num_ * centroid_num_ * subspace_dim_
+    UniquePtr<DataType[]> codebook_;
+
+    // the first retrain_num_ raw vectors inserted, until Retrain trains the codebooks on them
+    Vector<DataType> collected_vecs_;
+
+public:
+    void Dump(std::ostream &os) const {
+        os << "[CONST] dim: " << dim_ << ", subspace_num: " << subspace_num_ << ", trained: " << trained_ << std::endl;
+    }
+};
+
+export template <typename DataType, typename PQMetric>
+class PQVecStoreInner {
+public:
+    using This = PQVecStoreInner<DataType, PQMetric>;
+    using Meta = PQVecStoreMeta<DataType, PQMetric>;
+    using CodeType = typename Meta::CodeType;
+    using StoreType = typename Meta::StoreType;
+
+private:
+    PQVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<CodeType[]>(max_vec_num * meta.subspace_num())) {}
+
+public:
+    PQVecStoreInner() = default;
+
+    static This Make(SizeT max_vec_num, const Meta &meta) { return This(max_vec_num, meta); }
+
+    void Save(FileHandler &file_handler, SizeT cur_vec_num, const Meta &meta) const {
+        file_handler.Write(ptr_.get(), cur_vec_num * meta.code_size());
+    }
+
+    static This Load(FileHandler &file_handler, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta) {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        file_handler.Read(ret.ptr_.get(), cur_vec_num * meta.code_size());
+        return ret;
+    }
+
+    void SetVec(SizeT idx, const DataType *vec, const Meta &meta) { meta.CompressTo(vec, ptr_.get() + idx * meta.subspace_num()); }
+
+    StoreType GetVec(SizeT idx, const Meta &meta) const { return {ptr_.get() + idx * meta.subspace_num(), nullptr}; }
+
+    void Prefetch(VertexType vec_i, const Meta &meta) const {
+        _mm_prefetch(reinterpret_cast<const char *>(ptr_.get() + vec_i * meta.subspace_num()), _MM_HINT_T0);
+    }
+
+private:
+    UniquePtr<CodeType[]> ptr_;
+
+public:
+    void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
+        for (int i = 0; i < (int)chunk_size; ++i) {
+            os << "vec " << i << "(" << offset + i << "): ";
+            const CodeType *codes = GetVec(i, meta).codes_;
+            for (SizeT s = 0; s < meta.subspace_num(); ++s) {
+                os << static_cast<int>(codes[s]) << " ";
+            }
+            os << std::endl;
+        }
+    }
+};
+
+} // namespace infinity
@@ -19,8 +19,11 @@ export module vec_store_type;
 import stl;
 import plain_vec_store;
 import lvq_vec_store;
+import pq_vec_store;
+import binary_vec_store;
 import dist_func_l2;
 import dist_func_ip;
+import dist_func_hamming;
 
 namespace infinity {
 
@@ -33,6 +36,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = PlainL2Dist<DataType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 export template <typename DataT>
@@ -44,6 +48,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = PlainIPDist<DataType>;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 export template <typename DataT, typename CompressT>
@@ -56,6 +61,7 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = LVQL2Dist<DataType, CompressType>;
+    using DistanceType = DataType;
 };
 
 export template <typename DataT, typename CompressT>
@@ -68,6 +74,43 @@ public:
     using StoreType = typename Meta::StoreType;
     using QueryType = typename Meta::QueryType;
     using Distance = LVQIPDist<DataType, CompressType>;
+    using DistanceType = DataType;
+};
+
+export template <typename DataT>
+class PQL2VecStoreType {
+public:
+    using DataType = DataT;
+    using Meta = PQVecStoreMeta<DataType, PQL2Metric<DataType>>;
+    using Inner = PQVecStoreInner<DataType, PQL2Metric<DataType>>;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = PQL2Dist<DataType>;
+    using DistanceType = DataType;
+};
+
+export template <typename DataT>
+class PQIPVecStoreType {
+public:
+    using DataType = DataT;
+    using Meta = PQVecStoreMeta<DataType, PQIPMetric<DataType>>;
+    using Inner = PQVecStoreInner<DataType, PQIPMetric<DataType>>;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = PQIPDist<DataType>;
+    using DistanceType = DataType;
+};
+
+// Bit vectors compared by hamming distance, the data is the packed bytes of the vectors
+export class BinaryHammingVecStoreType {
+public:
+    using DataType = u8;
+    using Meta = BinaryVecStoreMeta;
+    using Inner = BinaryVecStoreInner;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = BinaryHammingDist;
+    using DistanceType = typename Distance::DistanceType;
 };
 
 } // namespace infinity
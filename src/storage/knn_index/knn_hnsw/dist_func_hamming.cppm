@@ -0,0 +1,53 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+import stl;
+import simd_dispatch;
+import binary_vec_store;
+
+export module dist_func_hamming;
+
+namespace infinity {
+
+export class BinaryHammingDist {
+public:
+    using VecStoreMeta = BinaryVecStoreMeta;
+    using StoreType = typename VecStoreMeta::StoreType;
+    // the number of different bits, reported as f32 like the other distances
+    using DistanceType = f32;
+
+private:
+    HammingFuncType SIMDFunc;
+
+public:
+    BinaryHammingDist() : SIMDFunc(nullptr) {}
+    BinaryHammingDist(BinaryHammingDist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    BinaryHammingDist &operator=(BinaryHammingDist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~BinaryHammingDist() = default;
+
+    BinaryHammingDist(SizeT) : SIMDFunc(GetSIMDFunctions().hamming_) {}
+
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        return static_cast<DistanceType>(SIMDFunc(v1, v2, vec_store_meta.dim()));
+    }
+};
+
+} // namespace infinity
@@ -18,10 +18,13 @@ module;
 #include <ostream>
 
 import stl;
+import internal_types;
 import hnsw_common;
 import hnsw_simd_func;
+import simd_dispatch;
 import plain_vec_store;
 import lvq_vec_store;
+import pq_vec_store;
 
 export module dist_func_ip;
 
@@ -32,9 +35,12 @@ class PlainIPDist {
 public:
     using VecStoreMeta = PlainVecStoreMeta<DataType>;
     using StoreType = typename VecStoreMeta::StoreType;
+    // int8 and uint8 vectors are compared in i32, float16 vectors in f32, the distance is reported as f32
+    using DistanceType = f32;
 
 private:
-    using SIMDFuncType = DataType (*)(const DataType *, const DataType *, SizeT);
+    using SIMDResultType = std::conditional_t<std::is_integral_v<DataType>, i32, f32>;
+    using SIMDFuncType = SIMDResultType (*)(const DataType *, const DataType *, SizeT);
 
     SIMDFuncType SIMDFunc;
 
@@ -50,32 +56,18 @@ public:
     ~PlainIPDist() = default;
     PlainIPDist(SizeT dim) {
         if constexpr (std::is_same<DataType, float>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32IPAVX512;
-            } else {
-                SIMDFunc = F32IPAVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32IPAVX;
-            } else {
-                SIMDFunc = F32IPAVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32IPSSE;
-            } else {
-                SIMDFunc = F32IPSSEResidual;
-            }
-#else
-            SIMDFunc = F32IPBF;
-#endif
+            SIMDFunc = GetSIMDFunctions().F32IP(dim);
+        } else if constexpr (std::is_same<DataType, i8>()) {
+            SIMDFunc = GetSIMDFunctions().I8IP(dim);
+        } else if constexpr (std::is_same<DataType, u8>()) {
+            SIMDFunc = U8IPBF;
+        } else if constexpr (std::is_same<DataType, Float16T>()) {
+            SIMDFunc = F16IPBF;
         }
     }
 
-    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
-        return -SIMDFunc(v1, v2, vec_store_meta.dim());
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        return -static_cast<DistanceType>(SIMDFunc(v1, v2, vec_store_meta.dim()));
     }
 };
 
@@ -140,27 +132,7 @@ public:
     ~LVQIPDist() = default;
     LVQIPDist(SizeT dim) {
         if constexpr (std::is_same<CompressType, i8>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPAVX512;
-            } else {
-                SIMDFunc = I8IPAVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPAVX;
-            } else {
-                SIMDFunc = I8IPAVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPSSE;
-            } else {
-                SIMDFunc = I8IPSSEResidual;
-            }
-#else
-            SIMDFunc = I8IPBF;
-#endif
+            SIMDFunc = GetSIMDFunctions().I8IP(dim);
         }
     }
 
@@ -180,4 +152,29 @@ public:
     }
 };
 
+// Distance of two subvectors in a pq codebook, the inner products of the subspaces sum up to the inner product
+export template <typename DataType>
+class PQIPMetric {
+public:
+    static DataType Distance(const DataType *v1, const DataType *v2, SizeT dim) {
+        DataType res = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            res += v1[i] * v2[i];
+        }
+        return -res;
+    }
+};
+
+export template <typename DataType>
+class PQIPDist {
+public:
+    using VecStoreMeta = PQVecStoreMeta<DataType, PQIPMetric<DataType>>;
+    using StoreType = typename VecStoreMeta::StoreType;
+
+    PQIPDist() = default;
+    PQIPDist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const { return vec_store_meta.Distance(v1, v2); }
+};
+
 } // namespace infinity
\ No newline at end of file
@@ -18,10 +18,13 @@ module;
 #include <ostream>
 
 import stl;
+import internal_types;
 import hnsw_common;
 import hnsw_simd_func;
+import simd_dispatch;
 import plain_vec_store;
 import lvq_vec_store;
+import pq_vec_store;
 
 export module dist_func_l2;
 
@@ -32,9 +35,12 @@ class PlainL2Dist {
 public:
     using VecStoreMeta = PlainVecStoreMeta<DataType>;
     using StoreType = typename VecStoreMeta::StoreType;
+    // int8 and uint8 vectors are compared in i32, float16 vectors in f32, the distance is reported as f32
+    using DistanceType = f32;
 
 private:
-    using SIMDFuncType = DataType (*)(const DataType *, const DataType *, SizeT);
+    using SIMDResultType = std::conditional_t<std::is_integral_v<DataType>, i32, f32>;
+    using SIMDFuncType = SIMDResultType (*)(const DataType *, const DataType *, SizeT);
 
     SIMDFuncType SIMDFunc;
 
@@ -51,32 +57,18 @@ public:
 
     PlainL2Dist(SizeT dim) {
         if constexpr (std::is_same<DataType, float>()) {
-#if defined(USE_AVX512)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX512;
-            } else {
-                SIMDFunc = F32L2AVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2AVX;
-            } else {
-                SIMDFunc = F32L2AVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = F32L2SSE;
-            } else {
-                SIMDFunc = F32L2SSEResidual;
-            }
-#else
-            SIMDFunc = F32IPBF;
-#endif
+            SIMDFunc = GetSIMDFunctions().F32L2(dim);
+        } else if constexpr (std::is_same<DataType, i8>()) {
+            SIMDFunc = I8L2BF;
+        } else if constexpr (std::is_same<DataType, u8>()) {
+            SIMDFunc = U8L2BF;
+        } else if constexpr (std::is_same<DataType, Float16T>()) {
+            SIMDFunc = F16L2BF;
         }
     }
 
-    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
-        return SIMDFunc(v1, v2, vec_store_meta.dim());
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        return static_cast<DistanceType>(SIMDFunc(v1, v2, vec_store_meta.dim()));
     }
 };
 
@@ -131,27 +123,7 @@ public:
     ~LVQL2Dist() = default;
     LVQL2Dist(SizeT dim) {
         if constexpr (std::is_same<CompressType, i8>()) {
-#if defined(USE_AVX512)
-            if (dim % 64 == 0) {
-                SIMDFunc = I8IPAVX512;
-            } else {
-                SIMDFunc = I8IPAVX512Residual;
-            }
-#elif defined(USE_AVX)
-            if (dim % 32 == 0) {
-                SIMDFunc = I8IPAVX;
-            } else {
-                SIMDFunc = I8IPAVXResidual;
-            }
-#elif defined(USE_SSE)
-            if (dim % 16 == 0) {
-                SIMDFunc = I8IPSSE;
-            } else {
-                SIMDFunc = I8IPSSEResidual;
-            }
-#else
-            SIMDFunc = I8IPBF;
-#endif
+            SIMDFunc = GetSIMDFunctions().I8IP(dim);
         }
     }
 
@@ -169,4 +141,30 @@ public:
     }
 };
 
+// Distance of two subvectors in a pq codebook
+export template <typename DataType>
+class PQL2Metric {
+public:
+    static DataType Distance(const DataType *v1, const DataType *v2, SizeT dim) {
+        DataType res = 0;
+        for (SizeT i = 0; i < dim; ++i) {
+            DataType t = v1[i] - v2[i];
+            res += t * t;
+        }
+        return res;
+    }
+};
+
+export template <typename DataType>
+class PQL2Dist {
+public:
+    using VecStoreMeta = PQVecStoreMeta<DataType, PQL2Metric<DataType>>;
+    using StoreType = typename VecStoreMeta::StoreType;
+
+    PQL2Dist() = default;
+    PQL2Dist(SizeT) {}
+
+    DataType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const { return vec_store_meta.Distance(v1, v2); }
+};
+
 } // namespace infinity
\ No newline at end of file
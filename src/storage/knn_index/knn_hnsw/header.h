@@ -1,6 +1,19 @@
 #pragma once
 #ifndef NO_MANUAL_VECTORIZATION
-#if (defined(__SSE2__) || _M_IX86_FP > 0 || defined(_M_AMD64) || defined(_M_X64))
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+// The kernels of every level are compiled with their own target attribute, whatever the -m flags of the build, and chosen at runtime
+// by the cpu features, see simd_dispatch.
+#define USE_SSE
+#define USE_AVX
+#define USE_AVX512
+#define USE_AVX512VNNI
+#define USE_AVX512VPOPCNTDQ
+#define SIMD_TARGET_SSE __attribute__((target("sse4.2")))
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define SIMD_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+#define SIMD_TARGET_AVX512VNNI __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx512vnni")))
+#define SIMD_TARGET_AVX512VPOPCNTDQ __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl,avx512vpopcntdq")))
+#elif (defined(__SSE2__) || _M_IX86_FP > 0 || defined(_M_AMD64) || defined(_M_X64))
 #define USE_SSE
 #ifdef __AVX2__
 #define USE_AVX
@@ -14,6 +27,14 @@
 #endif
 #endif
 
+#ifndef SIMD_TARGET_SSE
+#define SIMD_TARGET_SSE
+#define SIMD_TARGET_AVX2
+#define SIMD_TARGET_AVX512
+#define SIMD_TARGET_AVX512VNNI
+#define SIMD_TARGET_AVX512VPOPCNTDQ
+#endif
+
 #if defined(USE_AVX) || defined(USE_SSE)
 
 #if defined(_MSC_VER)
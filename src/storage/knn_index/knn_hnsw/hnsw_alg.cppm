@@ -28,6 +28,7 @@ import bitmask;
 
 import hnsw_common;
 import data_store;
+import visited_table;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -46,15 +47,19 @@ public:
     using StoreType = typename VecStoreType::StoreType;
     using DataStore = DataStore<VecStoreType, LabelType>;
     using Distance = typename VecStoreType::Distance;
+    using DistanceType = typename VecStoreType::DistanceType;
 
-    using PDV = Pair<DataType, VertexType>;
-    using CMP = CompareByFirst<DataType, VertexType>;
-    using CMPReverse = CompareByFirstReverse<DataType, VertexType>;
+    using PDV = Pair<DistanceType, VertexType>;
+    using CMP = CompareByFirst<DistanceType, VertexType>;
+    using CMPReverse = CompareByFirstReverse<DistanceType, VertexType>;
     using DistHeap = Heap<PDV, CMP>;
 
     constexpr static int prefetch_offset_ = 0;
     constexpr static int prefetch_step_ = 2;
 
+    // Vertices a build thread takes from the shared counter at a time
+    constexpr static SizeT build_batch_n_ = 64;
+
 private:
     KnnHnsw(SizeT M, SizeT ef_construction, DataStore data_store, Distance distance, SizeT ef, SizeT random_seed)
         : M_(M), ef_construction_(std::max(M_, ef_construction)), mult_(1 / std::log(1.0 * M_)), data_store_(std::move(data_store)),
@@ -117,18 +122,23 @@ private:
     // >= 0
     i32 GenerateRandomLayer() {
         std::uniform_real_distribution<double> distribution(0.0, 1.0);
-        auto r1 = distribution(level_rng_);
+        double r1 = 0;
+        {
+            // Build() is called concurrently in a parallel build
+            std::lock_guard<std::mutex> lock(level_rng_mtx_);
+            r1 = distribution(level_rng_);
+        }
         double r = -std::log(r1) * mult_;
         return static_cast<i32>(r);
     }
 
     // return the nearest `ef_construction_` neighbors of `query` in layer `layer_idx`
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>>
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>>
     SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
-        auto d_ptr = MakeUniqueForOverwrite<DataType[]>(result_n);
+        auto d_ptr = MakeUniqueForOverwrite<DistanceType[]>(result_n);
         auto i_ptr = MakeUniqueForOverwrite<VertexType[]>(result_n);
-        HeapResultHandler<CompareMax<DataType, VertexType>> result_handler(1, result_n, d_ptr.get(), i_ptr.get());
+        HeapResultHandler<CompareMax<DistanceType, VertexType>> result_handler(1, result_n, d_ptr.get(), i_ptr.get());
         result_handler.Begin();
         DistHeap candidate;
 
@@ -145,8 +155,8 @@ private:
         }
 
         SizeT cur_vec_num = data_store_.cur_vec_num();
-        Vector<bool> visited(cur_vec_num, false);
-        visited[enter_point] = true;
+        auto visited = VisitedTablePool::ThreadLocal().Acquire(cur_vec_num);
+        visited->Set(enter_point);
 
         while (!candidate.empty()) {
             const auto [minus_c_dist, c_idx] = candidate.top();
@@ -164,10 +174,9 @@ private:
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (n_idx >= (VertexType)cur_vec_num || visited[n_idx]) {
+                if (n_idx >= (VertexType)cur_vec_num || visited->TestAndSet(n_idx)) {
                     continue;
                 }
-                visited[n_idx] = true;
                 if (prefetch_start >= 0) {
                     int lower = std::max(0, prefetch_start - prefetch_step_);
                     for (int i = prefetch_start; i >= lower; --i) {
@@ -196,7 +205,7 @@ private:
     template <bool WithLock>
     VertexType SearchLayerNearest(VertexType enter_point, const StoreType &query, i32 layer_idx) const {
         VertexType cur_p = enter_point;
-        DataType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_.vec_store_meta());
+        DistanceType cur_dist = distance_(query, data_store_.GetVec(cur_p), data_store_.vec_store_meta());
         bool check = true;
         while (check) {
             check = false;
@@ -209,7 +218,7 @@ private:
             const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(cur_p, layer_idx);
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                DataType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
+                DistanceType n_dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
                 if (n_dist < cur_dist) {
                     cur_p = n_idx;
                     cur_dist = n_dist;
@@ -237,7 +246,7 @@ private:
                 bool check = true;
                 for (SizeT i = 0; i < SizeT(result_size); ++i) {
                     VertexType r_idx = result_p[i];
-                    DataType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_.vec_store_meta());
+                    DistanceType cr_dist = distance_(c_data, data_store_.GetVec(r_idx), data_store_.vec_store_meta());
                     if (cr_dist < c_dist) {
                         check = false;
                         break;
@@ -268,7 +277,7 @@ private:
                 continue;
             }
             StoreType n_data = data_store_.GetVec(n_idx);
-            DataType n_dist = distance_(n_data, data_store_.GetVec(vertex_i), data_store_.vec_store_meta());
+            DistanceType n_dist = distance_(n_data, data_store_.GetVec(vertex_i), data_store_.vec_store_meta());
 
             Vector<PDV> candidates;
             candidates.reserve(n_neighbor_size + 1);
@@ -284,7 +293,7 @@ private:
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
     template <bool WithLock, FilterConcept<LabelType> Filter = NoneType>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, const Filter &filter) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<VertexType[]>> KnnSearchInner(const DataType *q, SizeT k, const Filter &filter) const {
         auto query = data_store_.MakeQuery(q);
         auto [max_layer, ep] = data_store_.GetEnterPoint();
         if (ep == -1) {
@@ -300,9 +309,7 @@ public:
     template <DataIteratorConcept<const DataType *, LabelType> Iterator>
     Pair<SizeT, SizeT> InsertVecs(Iterator &&iter, const HnswInsertConfig &config) {
         auto [start_i, end_i] = StoreData(std::move(iter), config);
-        for (VertexType vertex_i = start_i; vertex_i < end_i; ++vertex_i) {
-            Build(vertex_i);
-        }
+        BuildRange(start_i, end_i, config.build_pool_);
         return {start_i, end_i};
     }
 
@@ -327,6 +334,44 @@ public:
         return StoreData(DenseVectorIter<DataType, LabelType>(query, data_store_.dim(), insert_n, offset), config);
     }
 
+    // Build vertices in [start_i, end_i) on the calling thread, helped by the threads of `build_pool` if any.
+    // Concurrent Build() is safe, the graph is only accessed under the per vertex locks of data_store_.
+    // The pool is shared by the concurrent builds, a helper that starts after the vertices are taken just returns.
+    void BuildRange(VertexType start_i, VertexType end_i, ThreadPool *build_pool) {
+        SizeT batch_n = (SizeT(end_i - start_i) + build_batch_n_ - 1) / build_batch_n_;
+        SizeT helper_n = build_pool == nullptr || batch_n <= 1 ? 0 : std::min(SizeT(build_pool->size()), batch_n - 1);
+        if (helper_n == 0) {
+            for (VertexType vertex_i = start_i; vertex_i < end_i; ++vertex_i) {
+                Build(vertex_i);
+            }
+            return;
+        }
+
+        Atomic<VertexType> next_i = start_i;
+        auto build_func = [&] {
+            while (true) {
+                VertexType batch_start = next_i.fetch_add(build_batch_n_);
+                if (batch_start >= end_i) {
+                    break;
+                }
+                VertexType batch_end = std::min(batch_start + VertexType(build_batch_n_), end_i);
+                for (VertexType vertex_i = batch_start; vertex_i < batch_end; ++vertex_i) {
+                    Build(vertex_i);
+                }
+            }
+        };
+        auto build_task = [&](int) { build_func(); };
+        Vector<decltype(build_pool->push(build_task))> helpers;
+        helpers.reserve(helper_n);
+        for (SizeT i = 0; i < helper_n; ++i) {
+            helpers.push_back(build_pool->push(build_task));
+        }
+        build_func();
+        for (auto &helper : helpers) {
+            helper.get();
+        }
+    }
+
     void Build(VertexType vertex_i) {
         i32 q_layer = GenerateRandomLayer();
 
@@ -355,7 +400,7 @@ public:
     }
 
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k, const Filter &filter) const {
         auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
         auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
@@ -365,15 +410,15 @@ public:
     }
 
     template <bool WithLock = true>
-    Tuple<SizeT, UniquePtr<DataType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k) const {
+    Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>> KnnSearch(const DataType *q, SizeT k) const {
         return KnnSearch<NoneType, WithLock>(q, k, None);
     }
 
     // function for test, add sort for convenience
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
-    Vector<Pair<DataType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k, const Filter &filter) const {
+    Vector<Pair<DistanceType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k, const Filter &filter) const {
         auto [result_n, d_ptr, v_ptr] = KnnSearchInner<WithLock, Filter>(q, k, filter);
-        Vector<Pair<DataType, LabelType>> result(result_n);
+        Vector<Pair<DistanceType, LabelType>> result(result_n);
         for (SizeT i = 0; i < result_n; ++i) {
             result[i] = {d_ptr[i], GetLabel(v_ptr[i])};
         }
@@ -382,12 +427,15 @@ public:
     }
 
     // function for test
-    Vector<Pair<DataType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k) const { return KnnSearchSorted<NoneType>(q, k, None); }
+    Vector<Pair<DistanceType, LabelType>> KnnSearchSorted(const DataType *q, SizeT k) const { return KnnSearchSorted<NoneType>(q, k, None); }
 
     void SetEf(SizeT ef) { ef_ = ef; }
 
     SizeT GetVertexNum() const { return data_store_.cur_vec_num(); }
 
+    // function for test
+    const DataStore &data_store() const { return data_store_; }
+
 private:
     SizeT M_;
     SizeT ef_construction_;
@@ -396,6 +444,7 @@ private:
     // 1 / log(1.0 * M_)
     double mult_;
     std::default_random_engine level_rng_{};
+    std::mutex level_rng_mtx_{};
 
     DataStore data_store_;
     Distance distance_;
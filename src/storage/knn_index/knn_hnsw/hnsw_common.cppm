@@ -72,11 +72,14 @@ export template <typename Filter, typename LabelType>
 concept FilterConcept = requires(LabelType label) { std::is_same_v<Filter, NoneType> || std::is_base_of_v<FilterBase<LabelType>, Filter>; };
 
 export struct HnswInsertConfig {
-    bool optimize_;
+    bool optimize_{false};
+    // The threads that help the inserting thread to build the graph, none if null.
+    ThreadPool *build_pool_{nullptr};
 };
 
 export constexpr HnswInsertConfig kDefaultHnswInsertConfig = {
     .optimize_ = false,
+    .build_pool_ = nullptr,
 };
 
 } // namespace infinity
\ No newline at end of file
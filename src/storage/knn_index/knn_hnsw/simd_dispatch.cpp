@@ -0,0 +1,210 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "header.h"
+
+module simd_dispatch;
+
+import stl;
+import hnsw_simd_func;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+const char *SIMDLevelToString(SIMDLevel level) {
+    switch (level) {
+        case SIMDLevel::kNone:
+            return "none";
+        case SIMDLevel::kSSE:
+            return "SSE4.2";
+        case SIMDLevel::kAVX2:
+            return "AVX2";
+        case SIMDLevel::kAVX512:
+            return "AVX-512";
+        case SIMDLevel::kAVX512VNNI:
+            return "AVX-512-VNNI";
+    }
+    return "invalid";
+}
+
+namespace {
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+u64 ReadXCR0() {
+    u32 eax = 0;
+    u32 edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<u64>(edx) << 32) | eax;
+}
+
+SIMDLevel DetectSIMDLevel() {
+    u32 eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return SIMDLevel::kNone;
+    }
+    const bool sse42 = ecx & bit_SSE4_2;
+    const bool fma = ecx & bit_FMA;
+    const bool osxsave = ecx & bit_OSXSAVE;
+    if (!sse42) {
+        return SIMDLevel::kNone;
+    }
+    // the os saves the ymm registers, and for avx-512 also the opmask and zmm registers, on context switches
+    const u64 xcr0 = osxsave ? ReadXCR0() : 0;
+    const bool os_avx = (xcr0 & 0x6) == 0x6;
+    const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return SIMDLevel::kSSE;
+    }
+    const bool avx2 = ebx & bit_AVX2;
+    const bool avx512 = (ebx & bit_AVX512F) and (ebx & bit_AVX512BW) and (ebx & bit_AVX512DQ) and (ebx & bit_AVX512VL);
+    const bool avx512vnni = ecx & bit_AVX512VNNI;
+    if (avx512 and os_avx512) {
+        return avx512vnni ? SIMDLevel::kAVX512VNNI : SIMDLevel::kAVX512;
+    }
+    if (avx2 and fma and os_avx) {
+        return SIMDLevel::kAVX2;
+    }
+    return SIMDLevel::kSSE;
+}
+
+// vpopcntq is not implied by any level, icelake and later have it, cascadelake has vnni without it
+bool DetectAVX512VPOPCNTDQ() {
+    u32 eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (GetSupportedSIMDLevel() < SIMDLevel::kAVX512 or !__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        return false;
+    }
+    return ecx & bit_AVX512VPOPCNTDQ;
+}
+
+#else
+
+// the x86 kernels are emulated by simde
+SIMDLevel DetectSIMDLevel() {
+#if defined(USE_AVX)
+    return SIMDLevel::kAVX2;
+#elif defined(USE_SSE)
+    return SIMDLevel::kSSE;
+#else
+    return SIMDLevel::kNone;
+#endif
+}
+
+bool DetectAVX512VPOPCNTDQ() { return false; }
+
+#endif
+
+Array<SIMDFunctions, 5> MakeSIMDFunctionTable() {
+    Array<SIMDFunctions, 5> table;
+    // a level without kernels of its own uses the plain loops
+    for (SizeT i = 0; i < table.size(); ++i) {
+        auto &functions = table[i];
+        functions.level_ = static_cast<SIMDLevel>(i);
+        functions.f32_l2_ = F32L2BF;
+        functions.f32_l2_residual_ = F32L2BF;
+        functions.f32_ip_ = F32IPBF;
+        functions.f32_ip_residual_ = F32IPBF;
+        functions.i8_ip_ = I8IPBF;
+        functions.i8_ip_residual_ = I8IPBF;
+        functions.hamming_ = HammingBF;
+        functions.adc_scan_ = ADCScanBF;
+    }
+#if defined(USE_SSE)
+    {
+        auto &functions = table[static_cast<SizeT>(SIMDLevel::kSSE)];
+        functions.f32_l2_ = F32L2SSE;
+        functions.f32_l2_residual_ = F32L2SSEResidual;
+        functions.f32_ip_ = F32IPSSE;
+        functions.f32_ip_residual_ = F32IPSSEResidual;
+        functions.f32_block_size_ = 16;
+        functions.i8_ip_ = I8IPSSE;
+        functions.i8_ip_residual_ = I8IPSSEResidual;
+        functions.i8_block_size_ = 16;
+        functions.hamming_ = HammingSSE;
+    }
+#endif
+#if defined(USE_AVX)
+    {
+        auto &functions = table[static_cast<SizeT>(SIMDLevel::kAVX2)];
+        functions.f32_l2_ = F32L2AVX;
+        functions.f32_l2_residual_ = F32L2AVXResidual;
+        functions.f32_ip_ = F32IPAVX;
+        functions.f32_ip_residual_ = F32IPAVXResidual;
+        functions.f32_block_size_ = 16;
+        functions.i8_ip_ = I8IPAVX;
+        functions.i8_ip_residual_ = I8IPAVXResidual;
+        functions.i8_block_size_ = 32;
+        functions.hamming_ = HammingAVX;
+        functions.adc_scan_ = ADCScanAVX;
+    }
+#endif
+#if defined(USE_AVX512)
+    {
+        auto &functions = table[static_cast<SizeT>(SIMDLevel::kAVX512)];
+        functions.f32_l2_ = F32L2AVX512;
+        functions.f32_l2_residual_ = F32L2AVX512Residual;
+        functions.f32_ip_ = F32IPAVX512;
+        functions.f32_ip_residual_ = F32IPAVX512Residual;
+        functions.f32_block_size_ = 16;
+        functions.i8_ip_ = I8IPAVX512;
+        functions.i8_ip_residual_ = I8IPAVX512Residual;
+        functions.i8_block_size_ = 64;
+        // without vpopcntq the avx2 kernel is the fastest
+        functions.hamming_ = HammingAVX;
+        functions.adc_scan_ = ADCScanAVX;
+#if defined(USE_AVX512VPOPCNTDQ)
+        if (DetectAVX512VPOPCNTDQ()) {
+            functions.hamming_ = HammingAVX512VPOPCNTDQ;
+        }
+#endif
+    }
+#endif
+#if defined(USE_AVX512VNNI)
+    {
+        // the f32 kernels are the avx-512 ones
+        auto &functions = table[static_cast<SizeT>(SIMDLevel::kAVX512VNNI)];
+        functions = table[static_cast<SizeT>(SIMDLevel::kAVX512)];
+        functions.level_ = SIMDLevel::kAVX512VNNI;
+        functions.i8_ip_ = I8IPAVX512VNNI;
+        functions.i8_ip_residual_ = I8IPAVX512VNNIResidual;
+        functions.i8_block_size_ = 64;
+    }
+#endif
+    return table;
+}
+
+} // namespace
+
+SIMDLevel GetSupportedSIMDLevel() {
+    static const SIMDLevel level = DetectSIMDLevel();
+    return level;
+}
+
+const SIMDFunctions &GetSIMDFunctions(SIMDLevel level) {
+    static const Array<SIMDFunctions, 5> table = MakeSIMDFunctionTable();
+    if (level > GetSupportedSIMDLevel()) {
+        UnrecoverableError(fmt::format("SIMD level {} is not supported by the cpu", SIMDLevelToString(level)));
+    }
+    return table[static_cast<SizeT>(level)];
+}
+
+const SIMDFunctions &GetSIMDFunctions() {
+    static const SIMDFunctions &functions = GetSIMDFunctions(GetSupportedSIMDLevel());
+    return functions;
+}
+
+} // namespace infinity
@@ -0,0 +1,78 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module simd_dispatch;
+
+import stl;
+
+namespace infinity {
+
+// The instruction sets of the distance kernels, each level includes the previous ones.
+export enum class SIMDLevel : u8 {
+    kNone,
+    kSSE,        // sse4.2
+    kAVX2,       // avx2 and fma
+    kAVX512,     // avx512 f, bw, dq and vl
+    kAVX512VNNI, // avx512 and avx512 vnni
+};
+
+export const char *SIMDLevelToString(SIMDLevel level);
+
+// The highest level supported by both the cpu and the os, detected by cpuid once.
+export SIMDLevel GetSupportedSIMDLevel();
+
+export using F32DistanceFuncType = f32 (*)(const f32 *, const f32 *, SizeT);
+export using I8IPFuncType = i32 (*)(const i8 *, const i8 *, SizeT);
+export using HammingFuncType = i32 (*)(const u8 *, const u8 *, SizeT);
+export using ADCScanFuncType = void (*)(const f32 *table, const u8 *codes, u32 subspace_num, u32 n, f32 bias, f32 *distances);
+
+// The distance kernels of a level. A kernel without the residual suffix only handles a dim which is a multiple of its block size, the
+// residual one handles any dim.
+export struct SIMDFunctions {
+    SIMDLevel level_{SIMDLevel::kNone};
+
+    F32DistanceFuncType f32_l2_{};
+    F32DistanceFuncType f32_l2_residual_{};
+    F32DistanceFuncType f32_ip_{};
+    F32DistanceFuncType f32_ip_residual_{};
+    SizeT f32_block_size_{1};
+
+    I8IPFuncType i8_ip_{};
+    I8IPFuncType i8_ip_residual_{};
+    SizeT i8_block_size_{1};
+
+    // The bit vectors are packed in bytes and the size is in bytes, any size is handled. On avx-512 it is the vpopcntq kernel if the cpu
+    // has the extension.
+    HammingFuncType hamming_{};
+
+    // The distances of n vectors of ivfpq codes, the sum of bias and the entries of the adc table of 256 per subspace, see
+    // AnnIVFPQIndexData::ADCScan.
+    ADCScanFuncType adc_scan_{};
+
+    inline F32DistanceFuncType F32L2(SizeT dim) const { return dim % f32_block_size_ == 0 ? f32_l2_ : f32_l2_residual_; }
+
+    inline F32DistanceFuncType F32IP(SizeT dim) const { return dim % f32_block_size_ == 0 ? f32_ip_ : f32_ip_residual_; }
+
+    inline I8IPFuncType I8IP(SizeT dim) const { return dim % i8_block_size_ == 0 ? i8_ip_ : i8_ip_residual_; }
+};
+
+// The kernels of a level, which must not be above the supported level.
+export const SIMDFunctions &GetSIMDFunctions(SIMDLevel level);
+
+// The kernels of the supported level.
+export const SIMDFunctions &GetSIMDFunctions();
+
+} // namespace infinity
@@ -17,6 +17,7 @@ module;
 #include "header.h"
 
 import stl;
+import internal_types;
 
 export module hnsw_simd_func;
 
@@ -24,7 +25,7 @@ namespace infinity {
 
 // for debug
 template <typename T>
-void log_m256(const __m256i &value) {
+SIMD_TARGET_AVX2 void log_m256(const __m256i &value) {
     const size_t n = sizeof(__m256i) / sizeof(T);
     T buffer[n];
     _mm256_storeu_si256((__m256i *)buffer, value);
@@ -47,7 +48,7 @@ export int32_t I8IPBF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
 }
 
 #if defined(USE_AVX512)
-export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_AVX512 int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim64 = dim >> 6;
     const int8_t *pend1 = pv1 + (dim64 << 6);
 
@@ -73,13 +74,43 @@ export int32_t I8IPAVX512(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm512_reduce_add_epi32(sum);
 }
 
-export int32_t I8IPAVX512Residual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_AVX512 int32_t I8IPAVX512Residual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPAVX512(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
 }
 #endif
 
+#if defined(USE_AVX512VNNI)
+// vpdpbusd multiplies unsigned by signed bytes, so v1 is biased into u8 by flipping its sign bit: v1 * v2 = (v1 + 128) * v2 - 128 * v2.
+export SIMD_TARGET_AVX512VNNI int32_t I8IPAVX512VNNI(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    size_t dim64 = dim >> 6;
+    const int8_t *pend1 = pv1 + (dim64 << 6);
+
+    __m512i v1, v2;
+    __m512i sum = _mm512_setzero_si512();
+    __m512i sum2 = _mm512_setzero_si512();
+    const __m512i highest_bit = _mm512_set1_epi8(0x80);
+    const __m512i ones = _mm512_set1_epi8(1);
+    while (pv1 < pend1) {
+        v1 = _mm512_loadu_si512((__m512i_u *)pv1);
+        pv1 += 64;
+        v2 = _mm512_loadu_si512((__m512i_u *)pv2);
+        pv2 += 64;
+
+        sum = _mm512_dpbusd_epi32(sum, _mm512_xor_si512(v1, highest_bit), v2);
+        sum2 = _mm512_dpbusd_epi32(sum2, ones, v2);
+    }
+
+    // Reduce add
+    return _mm512_reduce_add_epi32(sum) - 128 * _mm512_reduce_add_epi32(sum2);
+}
+
+export SIMD_TARGET_AVX512VNNI int32_t I8IPAVX512VNNIResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    return I8IPAVX512VNNI(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~63), pv2 + (dim & ~63), dim & 63);
+}
+#endif
+
 #if defined(USE_AVX)
-export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_AVX2 int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim32 = dim >> 5;
     const int8_t *pend1 = pv1 + (dim32 << 5);
 
@@ -109,14 +140,14 @@ export int32_t I8IPAVX(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm256_extract_epi32(sum, 0) + _mm256_extract_epi32(sum, 4);
 }
 
-export int32_t I8IPAVXResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_AVX2 int32_t I8IPAVXResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPAVX(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~31), pv2 + (dim & ~31), dim & 31);
 }
 
 #endif
 
 #if defined(USE_SSE)
-export int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_SSE int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     size_t dim16 = dim >> 4;
     const int8_t *pend1 = pv1 + (dim16 << 4);
 
@@ -146,7 +177,7 @@ export int32_t I8IPSSE(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return _mm_extract_epi32(sum, 0);
 }
 
-export int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+export SIMD_TARGET_SSE int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim) {
     return I8IPSSE(pv1, pv2, dim) + I8IPBF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
@@ -154,6 +185,56 @@ export int32_t I8IPSSEResidual(const int8_t *pv1, const int8_t *pv2, size_t dim)
 
 //------------------------------//------------------------------//------------------------------
 
+// Plain loop, vectorized by the compiler. Exact for dim < 2^15.
+export int32_t I8L2BF(const int8_t *pv1, const int8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        int32_t t = int32_t(pv1[i]) - int32_t(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+// Plain loops, vectorized by the compiler. Exact for dim < 2^15.
+export int32_t U8L2BF(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        int32_t t = int32_t(pv1[i]) - int32_t(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export int32_t U8IPBF(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += int32_t(pv1[i]) * int32_t(pv2[i]);
+    }
+    return res;
+}
+
+//------------------------------//------------------------------//------------------------------
+
+// float16 elements are widened to f32, the sums are f32
+export float F16L2BF(const Float16T *pv1, const Float16T *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        float t = float(pv1[i]) - float(pv2[i]);
+        res += t * t;
+    }
+    return res;
+}
+
+export float F16IPBF(const Float16T *pv1, const Float16T *pv2, size_t dim) {
+    float res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += float(pv1[i]) * float(pv2[i]);
+    }
+    return res;
+}
+
+//------------------------------//------------------------------//------------------------------
+
 export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
     float res = 0;
     for (size_t i = 0; i < dim; i++) {
@@ -165,7 +246,7 @@ export float F32L2BF(const float *pv1, const float *pv2, size_t dim) {
 
 #if defined(USE_AVX512)
 
-export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_AVX512 float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN64 TmpRes[16];
     size_t dim16 = dim >> 4;
 
@@ -191,7 +272,7 @@ export float F32L2AVX512(const float *pv1, const float *pv2, size_t dim) {
     return (res);
 }
 
-export float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_AVX512 float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim) {
     return F32L2AVX512(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
@@ -199,7 +280,7 @@ export float F32L2AVX512Residual(const float *pv1, const float *pv2, size_t dim)
 
 #if defined(USE_AVX)
 
-export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_AVX2 float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     float PORTABLE_ALIGN32 TmpRes[8];
     size_t dim16 = dim >> 4;
 
@@ -228,14 +309,14 @@ export float F32L2AVX(const float *pv1, const float *pv2, size_t dim) {
     return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3] + TmpRes[4] + TmpRes[5] + TmpRes[6] + TmpRes[7];
 }
 
-export float F32L2AVXResidual(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_AVX2 float F32L2AVXResidual(const float *pv1, const float *pv2, size_t dim) {
     return F32L2AVX(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
 #endif
 
 #if defined(USE_SSE)
-export float F32L2SSE(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_SSE float F32L2SSE(const float *pv1, const float *pv2, size_t dim) {
     alignas(16) float TmpRes[4];
     size_t dim16 = dim >> 4;
 
@@ -277,7 +358,7 @@ export float F32L2SSE(const float *pv1, const float *pv2, size_t dim) {
     return TmpRes[0] + TmpRes[1] + TmpRes[2] + TmpRes[3];
 }
 
-export float F32L2SSEResidual(const float *pv1, const float *pv2, size_t dim) {
+export SIMD_TARGET_SSE float F32L2SSEResidual(const float *pv1, const float *pv2, size_t dim) {
     return F32L2SSE(pv1, pv2, dim) + F32L2BF(pv1 + (dim & ~15), pv2 + (dim & ~15), dim & 15);
 }
 
@@ -295,7 +376,7 @@ export float F32IPBF(const float *pv1, const float *pv2, size_t dim) {
 
 #if defined(USE_AVX512)
 
-export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_AVX512 float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN64 TmpRes[16];
 
     size_t qty16 = qty / 16;
@@ -321,7 +402,7 @@ export float F32IPAVX512(const float *pVect1, const float *pVect2, SizeT qty) {
     return sum;
 }
 
-export float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_AVX512 float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT qty) {
     return F32IPAVX512(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
 }
 
@@ -329,7 +410,7 @@ export float F32IPAVX512Residual(const float *pVect1, const float *pVect2, SizeT
 
 #if defined(USE_AVX)
 
-export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_AVX2 float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     float PORTABLE_ALIGN32 TmpRes[8];
 
     size_t qty16 = qty / 16;
@@ -360,14 +441,14 @@ export float F32IPAVX(const float *pVect1, const float *pVect2, SizeT qty) {
     return sum;
 }
 
-export float F32IPAVXResidual(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_AVX2 float F32IPAVXResidual(const float *pVect1, const float *pVect2, SizeT qty) {
     return F32IPAVX(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
 }
 
 #endif
 
 #if defined(USE_SSE)
-export float F32IPSSE(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_SSE float F32IPSSE(const float *pVect1, const float *pVect2, SizeT qty) {
     alignas(16) float TmpRes[4];
 
     size_t qty16 = qty / 16;
@@ -410,10 +491,142 @@ export float F32IPSSE(const float *pVect1, const float *pVect2, SizeT qty) {
     return sum;
 }
 
-export float F32IPSSEResidual(const float *pVect1, const float *pVect2, SizeT qty) {
+export SIMD_TARGET_SSE float F32IPSSEResidual(const float *pVect1, const float *pVect2, SizeT qty) {
     return F32IPSSE(pVect1, pVect2, qty) + F32IPBF(pVect1 + (qty & ~15), pVect2 + (qty & ~15), qty & 15);
 }
 
 #endif
 
+//------------------------------//------------------------------//------------------------------
+
+// Hamming distance of bit vectors, which are packed in bytes, dim is the number of bytes.
+export int32_t HammingBF(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    for (size_t i = 0; i < dim; i++) {
+        res += __builtin_popcount(pv1[i] ^ pv2[i]);
+    }
+    return res;
+}
+
+#if defined(USE_AVX512VPOPCNTDQ)
+// The tail of less than 64 bytes is loaded with a mask, so any dim is handled.
+export SIMD_TARGET_AVX512VPOPCNTDQ int32_t HammingAVX512VPOPCNTDQ(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= dim; i += 64) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512(pv1 + i), _mm512_loadu_si512(pv2 + i));
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+    }
+    if (i < dim) {
+        const __mmask64 mask = ~0ULL >> (64 - (dim - i));
+        __m512i x = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, pv1 + i), _mm512_maskz_loadu_epi8(mask, pv2 + i));
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(x));
+    }
+    return _mm512_reduce_add_epi64(sum);
+}
+#endif
+
+#if defined(USE_SSE)
+// popcnt on 8 bytes at a time, sse4.2 implies popcnt.
+export SIMD_TARGET_SSE int32_t HammingSSE(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    int32_t res = 0;
+    size_t i = 0;
+    for (; i + 8 <= dim; i += 8) {
+        uint64_t v1, v2;
+        std::memcpy(&v1, pv1 + i, 8);
+        std::memcpy(&v2, pv2 + i, 8);
+        res += __builtin_popcountll(v1 ^ v2);
+    }
+    for (; i < dim; ++i) {
+        res += __builtin_popcount(pv1[i] ^ pv2[i]);
+    }
+    return res;
+}
+#endif
+
+#if defined(USE_AVX)
+// Counts the bits of each nibble by a table lookup with vpshufb and sums the bytes with vpsadbw, the tail of less than 32 bytes is
+// counted by popcnt.
+export SIMD_TARGET_AVX2 int32_t HammingAVX(const uint8_t *pv1, const uint8_t *pv2, size_t dim) {
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i sum = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= dim; i += 32) {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(pv1 + i)), _mm256_loadu_si256((const __m256i *)(pv2 + i)));
+        __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(x, low_mask)),
+                                      _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(x, 4), low_mask)));
+        sum = _mm256_add_epi64(sum, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+    }
+    int32_t res = _mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) + _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3);
+    return res + HammingSSE(pv1 + i, pv2 + i, dim - i);
+}
+#endif
+
+//------------------------------//------------------------------//------------------------------
+
+// Distances of n vectors of pq codes, one byte per subspace, looked up in a table of 256 entries per subspace. Four vectors are summed
+// together to hide the latency of the dependent table loads.
+export void ADCScanBF(const float *table, const uint8_t *codes, uint32_t subspace_num, uint32_t n, float bias, float *distances) {
+    const size_t m = subspace_num;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const uint8_t *c0 = codes + i * m;
+        const uint8_t *c1 = c0 + m;
+        const uint8_t *c2 = c1 + m;
+        const uint8_t *c3 = c2 + m;
+        float d0 = bias, d1 = bias, d2 = bias, d3 = bias;
+        for (size_t s = 0; s < m; ++s) {
+            const float *sub_table = table + s * 256;
+            d0 += sub_table[c0[s]];
+            d1 += sub_table[c1[s]];
+            d2 += sub_table[c2[s]];
+            d3 += sub_table[c3[s]];
+        }
+        distances[i] = d0;
+        distances[i + 1] = d1;
+        distances[i + 2] = d2;
+        distances[i + 3] = d3;
+    }
+    for (; i < n; ++i) {
+        const uint8_t *c = codes + i * m;
+        float d = bias;
+        for (size_t s = 0; s < m; ++s) {
+            d += table[s * 256 + c[s]];
+        }
+        distances[i] = d;
+    }
+}
+
+#if defined(USE_AVX)
+// Eight vectors are summed together. Four codes of each vector are gathered as one int32, and the table entries are gathered by the bytes
+// of it. The gather of the codes reads up to 3 bytes past the codes of the eighth vector, so the last vectors are left to the plain loop.
+export SIMD_TARGET_AVX2 void ADCScanAVX(const float *table, const uint8_t *codes, uint32_t subspace_num, uint32_t n, float bias, float *distances) {
+    const size_t m = subspace_num;
+    const int32_t stride = subspace_num;
+    const __m256i code_offsets = _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+    const __m256i byte_mask = _mm256_set1_epi32(0xff);
+    size_t i = 0;
+    for (; (i + 8) * m + 3 <= (size_t)n * m; i += 8) {
+        const uint8_t *block_codes = codes + i * m;
+        __m256 sum = _mm256_set1_ps(bias);
+        size_t s = 0;
+        for (; s + 4 <= m; s += 4) {
+            const __m256i code4 = _mm256_i32gather_epi32((const int *)(block_codes + s), code_offsets, 1);
+            const float *sub_table = table + s * 256;
+            sum = _mm256_add_ps(sum, _mm256_i32gather_ps(sub_table, _mm256_and_si256(code4, byte_mask), 4));
+            sum = _mm256_add_ps(sum, _mm256_i32gather_ps(sub_table + 256, _mm256_and_si256(_mm256_srli_epi32(code4, 8), byte_mask), 4));
+            sum = _mm256_add_ps(sum, _mm256_i32gather_ps(sub_table + 512, _mm256_and_si256(_mm256_srli_epi32(code4, 16), byte_mask), 4));
+            sum = _mm256_add_ps(sum, _mm256_i32gather_ps(sub_table + 768, _mm256_srli_epi32(code4, 24), 4));
+        }
+        for (; s < m; ++s) {
+            const __m256i code = _mm256_and_si256(_mm256_i32gather_epi32((const int *)(block_codes + s), code_offsets, 1), byte_mask);
+            sum = _mm256_add_ps(sum, _mm256_i32gather_ps(table + s * 256, code, 4));
+        }
+        _mm256_storeu_ps(distances + i, sum);
+    }
+    ADCScanBF(table, codes + i * m, subspace_num, n - i, bias, distances + i);
+}
+#endif
+
 } // namespace infinity
\ No newline at end of file
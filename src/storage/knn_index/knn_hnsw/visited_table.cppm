@@ -0,0 +1,113 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module visited_table;
+
+import stl;
+import hnsw_common;
+
+namespace infinity {
+
+// Visited set of one graph search. A vertex is visited iff its tag equals the current epoch,
+// so clearing the set is a single increment instead of a memset over all vertices.
+export class VisitedTable {
+public:
+    using TagType = u16;
+
+    VisitedTable() = default;
+
+    // Prepare for a new search over `vertex_n` vertices
+    void Reset(SizeT vertex_n) {
+        if (vertex_n > capacity_) {
+            SizeT new_capacity = std::max(vertex_n, capacity_ * 2);
+            auto new_tags = MakeUnique<TagType[]>(new_capacity); // zero filled
+            // Tags beyond the old capacity are 0 and never equal to a valid epoch, old tags are dropped with the new epoch anyway.
+            tags_ = std::move(new_tags);
+            capacity_ = new_capacity;
+            epoch_ = 0;
+        }
+        ++epoch_;
+        if (epoch_ == 0) {
+            // Wrapped around, stale tags may equal the new epoch
+            std::fill(tags_.get(), tags_.get() + capacity_, 0);
+            epoch_ = 1;
+        }
+    }
+
+    inline bool Visited(VertexType vertex_i) const { return tags_[vertex_i] == epoch_; }
+
+    inline void Set(VertexType vertex_i) { tags_[vertex_i] = epoch_; }
+
+    // Return whether `vertex_i` was visited before and mark it
+    inline bool TestAndSet(VertexType vertex_i) {
+        if (tags_[vertex_i] == epoch_) {
+            return true;
+        }
+        tags_[vertex_i] = epoch_;
+        return false;
+    }
+
+    SizeT capacity() const { return capacity_; }
+
+private:
+    UniquePtr<TagType[]> tags_{};
+    SizeT capacity_{0};
+    TagType epoch_{0};
+};
+
+// Per thread free list of visited tables, shared by all hnsw indexes searched or built on the thread.
+// More than one table is needed only when searches nest on the same thread.
+export class VisitedTablePool {
+public:
+    class Handle {
+    public:
+        Handle(VisitedTablePool *pool, UniquePtr<VisitedTable> table) : pool_(pool), table_(std::move(table)) {}
+        Handle(const Handle &) = delete;
+        Handle &operator=(const Handle &) = delete;
+        ~Handle() { pool_->Release(std::move(table_)); }
+
+        VisitedTable *operator->() { return table_.get(); }
+        VisitedTable &operator*() { return *table_; }
+
+    private:
+        VisitedTablePool *pool_;
+        UniquePtr<VisitedTable> table_;
+    };
+
+    static VisitedTablePool &ThreadLocal() {
+        thread_local VisitedTablePool pool;
+        return pool;
+    }
+
+    Handle Acquire(SizeT vertex_n) {
+        UniquePtr<VisitedTable> table;
+        if (free_tables_.empty()) {
+            table = MakeUnique<VisitedTable>();
+        } else {
+            table = std::move(free_tables_.back());
+            free_tables_.pop_back();
+        }
+        table->Reset(vertex_n);
+        return Handle(this, std::move(table));
+    }
+
+private:
+    void Release(UniquePtr<VisitedTable> table) { free_tables_.emplace_back(std::move(table)); }
+
+    Vector<UniquePtr<VisitedTable>> free_tables_{};
+};
+
+} // namespace infinity
@@ -24,6 +24,9 @@ import infinity_exception;
 import bitmask;
 import default_values;
 import internal_types;
+import mlas_matrix_multiply;
+import vector_distance;
+import knn_expr;
 
 namespace infinity {
 
@@ -35,7 +38,8 @@ public:
 export template <typename DataType, template <typename, typename> typename C>
 class MergeKnn final : public MergeKnnBase {
     using ResultHandler = ReservoirResultHandler<C<DataType, RowID>>;
-    using DistFunc = DataType (*)(const DataType *, const DataType *, SizeT);
+    template <typename ElemType>
+    using DistFunc = DataType (*)(const ElemType *, const ElemType *, SizeT);
 
 public:
     explicit MergeKnn(u64 query_count, u64 topk)
@@ -47,9 +51,30 @@ public:
     ~MergeKnn() final = default;
 
 public:
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
-
-    void Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id, Bitmask &bitmask);
+    // Brute force search over one block, elements of query and data may be narrower than the distance type
+    template <typename ElemType>
+    void Search(const ElemType *query, const ElemType *data, u32 dim, DistFunc<ElemType> dist_f, u16 row_cnt, u32 segment_id, u16 block_id);
+
+    template <typename ElemType>
+    void Search(const ElemType *query,
+                const ElemType *data,
+                u32 dim,
+                DistFunc<ElemType> dist_f,
+                u16 row_cnt,
+                u32 segment_id,
+                u16 block_id,
+                Bitmask &bitmask);
+
+    // Brute force search of all queries over one block. The distances of a query batch against the block are computed by
+    // blocked matrix multiplications instead of one vector pair at a time.
+    void SearchBatch(const f32 *queries,
+                     const f32 *data,
+                     u32 dim,
+                     KnnDistanceType distance_type,
+                     u16 row_cnt,
+                     u32 segment_id,
+                     u16 block_id,
+                     Bitmask &bitmask);
 
     void Search(const DataType *dist, const RowID *row_ids, u16 count);
 
@@ -69,6 +94,9 @@ public:
 
     RowID *GetIDsByIdx(u64 idx) const;
 
+    // Number of valid results of the query after End()
+    SizeT GetResultCountByIdx(u64 idx) const { return result_handler_->GetSize(idx); }
+
     i64 total_count() const { return total_count_; }
 
 private:
@@ -84,12 +112,19 @@ private:
 };
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data, u32 dim, DistFunc dist_f, u16 row_cnt, u32 segment_id, u16 block_id) {
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
+                                   u32 dim,
+                                   DistFunc<ElemType> dist_f,
+                                   u16 row_cnt,
+                                   u32 segment_id,
+                                   u16 block_id) {
     this->total_count_ += row_cnt;
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             auto dist = dist_f(x_i, y_j, dim);
             result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
@@ -98,10 +133,11 @@ void MergeKnn<DataType, C>::Search(const DataType *query, const DataType *data,
 }
 
 template <typename DataType, template <typename, typename> typename C>
-void MergeKnn<DataType, C>::Search(const DataType *query,
-                                   const DataType *data,
+template <typename ElemType>
+void MergeKnn<DataType, C>::Search(const ElemType *query,
+                                   const ElemType *data,
                                    u32 dim,
-                                   DistFunc dist_f,
+                                   DistFunc<ElemType> dist_f,
                                    u16 row_cnt,
                                    u32 segment_id,
                                    u16 block_id,
@@ -112,8 +148,8 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
     u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
     for (u64 i = 0; i < this->query_count_; ++i) {
-        const DataType *x_i = query + i * dim;
-        const DataType *y_j = data;
+        const ElemType *x_i = query + i * dim;
+        const ElemType *y_j = data;
         for (u16 j = 0; j < row_cnt; ++j, y_j += dim) {
             if (bitmask.IsTrue(j)) {
                 if (i == 0) {
@@ -126,6 +162,61 @@ void MergeKnn<DataType, C>::Search(const DataType *query,
     }
 }
 
+template <typename DataType, template <typename, typename> typename C>
+void MergeKnn<DataType, C>::SearchBatch(const f32 *queries,
+                                        const f32 *data,
+                                        u32 dim,
+                                        KnnDistanceType distance_type,
+                                        u16 row_cnt,
+                                        u32 segment_id,
+                                        u16 block_id,
+                                        Bitmask &bitmask) {
+    if (row_cnt == 0) {
+        return;
+    }
+    const bool use_bitmask = !bitmask.IsAllTrue();
+    if (use_bitmask) {
+        for (u16 j = 0; j < row_cnt; ++j) {
+            this->total_count_ += bitmask.IsTrue(j);
+        }
+    } else {
+        this->total_count_ += row_cnt;
+    }
+    const bool is_l2 = distance_type == KnnDistanceType::kL2;
+    const SizeT bs_x = std::min<SizeT>(DISTANCE_COMPUTE_BLAS_QUERY_BS, this->query_count_);
+    const SizeT bs_y = std::min<SizeT>(DISTANCE_COMPUTE_BLAS_DATABASE_BS, row_cnt);
+    auto ip_block = MakeUniqueForOverwrite<f32[]>(bs_x * bs_y);
+    UniquePtr<f32[]> x_norms, y_norms;
+    if (is_l2) {
+        x_norms = MakeUniqueForOverwrite<f32[]>(this->query_count_);
+        y_norms = MakeUniqueForOverwrite<f32[]>(row_cnt);
+        L2NormsSquares(x_norms.get(), queries, dim, this->query_count_);
+        L2NormsSquares(y_norms.get(), data, dim, row_cnt);
+    }
+    const u32 segment_offset_start = block_id * DEFAULT_BLOCK_CAPACITY;
+    for (SizeT i0 = 0; i0 < this->query_count_; i0 += bs_x) {
+        const SizeT i1 = std::min<SizeT>(i0 + bs_x, this->query_count_);
+        for (SizeT j0 = 0; j0 < row_cnt; j0 += bs_y) {
+            const SizeT j1 = std::min<SizeT>(j0 + bs_y, row_cnt);
+            matrixA_multiply_transpose_matrixB_output_to_C(queries + i0 * dim, data + j0 * dim, i1 - i0, j1 - j0, dim, ip_block.get());
+            for (SizeT i = i0; i < i1; ++i) {
+                const f32 *ip_line = ip_block.get() + (i - i0) * (j1 - j0);
+                for (SizeT j = j0; j < j1; ++j) {
+                    if (use_bitmask && !bitmask.IsTrue(j)) {
+                        continue;
+                    }
+                    f32 dist = ip_line[j - j0];
+                    if (is_l2) {
+                        // negative values can occur for identical vectors due to roundoff errors
+                        dist = std::max(0.0f, x_norms[i] + y_norms[j] - 2 * dist);
+                    }
+                    result_handler_->AddResult(i, dist, RowID(segment_id, segment_offset_start + j));
+                }
+            }
+        }
+    }
+}
+
 template <typename DataType, template <typename, typename> typename C>
 void MergeKnn<DataType, C>::Search(const DataType *dist, const RowID *row_ids, u16 count) {
     this->total_count_ += count;
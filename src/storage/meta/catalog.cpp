@@ -54,6 +54,7 @@ import block_column_entry;
 import segment_index_entry;
 import chunk_index_entry;
 import log_file;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -446,7 +447,7 @@ Tuple<SpecialFunction *, Status> Catalog::GetSpecialFunctionByNameNoExcept(Catal
     return {catalog->special_functions_[function_name].get(), Status::OK()};
 }
 
-nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer) {
     nlohmann::json json_res;
     Vector<DBMeta *> databases;
     {
@@ -462,7 +463,7 @@ nlohmann::json Catalog::Serialize(TxnTimeStamp max_commit_ts) {
     }
 
     for (auto &db_meta : databases) {
-        json_res["databases"].emplace_back(db_meta->Serialize(max_commit_ts));
+        json_res["databases"].emplace_back(db_meta->Serialize(max_commit_ts, snapshot_writer));
     }
     return json_res;
 }
@@ -485,9 +486,9 @@ UniquePtr<Catalog> Catalog::NewCatalog(SharedPtr<String> data_dir, bool create_d
 UniquePtr<Catalog>
 Catalog::LoadFromFiles(const FullCatalogFileInfo &full_ckp_info, const Vector<DeltaCatalogFileInfo> &delta_ckp_infos, BufferManager *buffer_mgr) {
 
-    // 1. load json
+    // 1. load the full checkpoint
     // 2. load entries
-    LOG_INFO(fmt::format("Load base FULL catalog json from: {}", full_ckp_info.path_));
+    LOG_INFO(fmt::format("Load base FULL catalog from: {}", full_ckp_info.path_));
     auto catalog = Catalog::LoadFromFile(full_ckp_info, buffer_mgr);
 
     // Load catalogs delta checkpoints and merge.
@@ -874,6 +875,12 @@ void Catalog::LoadFromEntryDelta(TxnTimeStamp max_commit_ts, BufferManager *buff
 UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_info, BufferManager *buffer_mgr) {
     const auto &catalog_path = full_ckp_info.path_;
 
+    SharedPtr<CatalogSnapshot> snapshot = CatalogSnapshot::Open(catalog_path);
+    if (snapshot.get() != nullptr) {
+        return Deserialize(snapshot->ReadDirectory(), buffer_mgr, snapshot);
+    }
+
+    // json full checkpoint of an older version
     LocalFileSystem fs;
     UniquePtr<FileHandler> catalog_file_handler = fs.OpenFile(catalog_path, FileFlags::READ_FLAG, FileLockType::kReadLock);
     SizeT file_size = fs.GetFileSize(*catalog_file_handler);
@@ -889,7 +896,7 @@ UniquePtr<Catalog> Catalog::LoadFromFile(const FullCatalogFileInfo &full_ckp_inf
     return Deserialize(catalog_json, buffer_mgr);
 }
 
-UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr) {
+UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, const SharedPtr<CatalogSnapshot> &snapshot) {
     SharedPtr<String> data_dir = MakeShared<String>(catalog_json["data_dir"]);
 
     // FIXME: new catalog need a scheduler, current we use nullptr to represent it.
@@ -898,7 +905,7 @@ UniquePtr<Catalog> Catalog::Deserialize(const nlohmann::json &catalog_json, Buff
     catalog->full_ckp_commit_ts_ = catalog_json["full_ckp_commit_ts"];
     if (catalog_json.contains("databases")) {
         for (const auto &db_json : catalog_json["databases"]) {
-            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr);
+            UniquePtr<DBMeta> db_meta = DBMeta::Deserialize(db_json, buffer_mgr, snapshot);
             catalog->db_meta_map().emplace(*db_meta->db_name(), std::move(db_meta));
         }
     }
@@ -909,34 +916,25 @@ void Catalog::SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_catalog_p
     full_catalog_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::FullCheckpoingFilename(max_commit_ts));
     String catalog_tmp_path = fmt::format("{}/{}", *catalog_dir_, CatalogFile::TempFullCheckpointFilename(max_commit_ts));
 
-    // Serialize catalog to string
+    // Save catalog to tmp file. Only the tables changed since the last full checkpoint are serialized, the others are
+    // copied from it.
     full_ckp_commit_ts_ = max_commit_ts;
-    nlohmann::json catalog_json = Serialize(max_commit_ts);
-    String catalog_str = catalog_json.dump();
+    CatalogSnapshotWriter snapshot_writer(catalog_tmp_path, global_catalog_delta_entry_->ChangedTables());
+    nlohmann::json catalog_json = Serialize(max_commit_ts, &snapshot_writer);
+    snapshot_writer.Finish(catalog_json);
 
-    // Save catalog to tmp file.
-    // FIXME: Temp implementation, will be replaced by async task.
+    // Rename temp file to regular catalog file
     LocalFileSystem fs;
+    fs.Rename(catalog_tmp_path, full_catalog_path);
 
-    u8 fileflags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
-
-    UniquePtr<FileHandler> catalog_file_handler = fs.OpenFile(catalog_tmp_path, fileflags, FileLockType::kWriteLock);
-
-    SizeT n_bytes = catalog_file_handler->Write(catalog_str.data(), catalog_str.size());
-    if (n_bytes != catalog_str.size()) {
-        Status status = Status::DataCorrupted(catalog_tmp_path);
-        LOG_ERROR(status.message());
-        RecoverableError(status);
-    }
-    catalog_file_handler->Sync();
-    catalog_file_handler->Close();
-
-    // Rename temp file to regular catalog file
-    catalog_file_handler->Rename(catalog_tmp_path, full_catalog_path);
+    snapshot_writer.Bind(CatalogSnapshot::Open(full_catalog_path));
 
     global_catalog_delta_entry_->InitFullCheckpointTs(max_commit_ts);
 
-    LOG_DEBUG(fmt::format("Saved catalog to: {}", full_catalog_path));
+    LOG_DEBUG(fmt::format("Saved catalog to: {}, written tables: {}, copied tables: {}",
+                          full_catalog_path,
+                          snapshot_writer.written_table_count(),
+                          snapshot_writer.copied_table_count()));
 }
 
 // called by bg_task
@@ -43,6 +43,7 @@ import base_entry;
 import meta_entry_interface;
 import cleanup_scanner;
 import log_file;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -216,7 +217,7 @@ public:
 
 public:
     // Serialization and Deserialization
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer = nullptr);
 
     void SaveFullCatalog(TxnTimeStamp max_commit_ts, String &full_path);
 
@@ -234,7 +235,8 @@ public:
     SizeT GetDeltaLogCount() const;
 
 private:
-    static UniquePtr<Catalog> Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr);
+    static UniquePtr<Catalog>
+    Deserialize(const nlohmann::json &catalog_json, BufferManager *buffer_mgr, const SharedPtr<CatalogSnapshot> &snapshot = nullptr);
 
     static UniquePtr<CatalogDeltaEntry> LoadFromFileDelta(const DeltaCatalogFileInfo &delta_ckp_info);
 
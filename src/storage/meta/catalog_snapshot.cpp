@@ -0,0 +1,204 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module catalog_snapshot;
+
+import stl;
+import third_party;
+import file_system;
+import file_system_type;
+import local_file_system;
+import mmap;
+import crc;
+import status;
+import logger;
+import infinity_exception;
+
+namespace infinity {
+
+namespace {
+
+struct SnapshotHeader {
+    u32 magic_;
+    u32 version_;
+};
+
+struct SnapshotTrailer {
+    u64 directory_offset_;
+    u64 directory_size_;
+    u32 directory_checksum_;
+    u32 magic_;
+};
+
+static_assert(sizeof(SnapshotHeader) == 8);
+static_assert(sizeof(SnapshotTrailer) == 24);
+
+} // namespace
+
+void CatalogSnapshotRef::ToJson(nlohmann::json &json) const {
+    json["offset"] = offset_;
+    json["size"] = size_;
+    json["checksum"] = checksum_;
+    json["has_index"] = has_index_;
+    json["has_garbage"] = has_garbage_;
+}
+
+CatalogSnapshotRef CatalogSnapshotRef::FromJson(const nlohmann::json &json) {
+    CatalogSnapshotRef ref;
+    ref.offset_ = json["offset"];
+    ref.size_ = json["size"];
+    ref.checksum_ = json["checksum"];
+    ref.has_index_ = json["has_index"];
+    ref.has_garbage_ = json.value("has_garbage", true);
+    return ref;
+}
+
+CatalogSnapshot::CatalogSnapshot(String path, u8 *data, SizeT size) : path_(std::move(path)), data_(data), size_(size) {}
+
+CatalogSnapshot::~CatalogSnapshot() { MunmapFile(data_, size_); }
+
+SharedPtr<CatalogSnapshot> CatalogSnapshot::Open(const String &path) {
+    u8 *data = nullptr;
+    SizeT size = 0;
+    if (MmapFile(path, data, size) != 0) {
+        Status status = Status::CatalogCorrupted(path);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    auto snapshot = MakeShared<CatalogSnapshot>(path, data, size);
+
+    SnapshotHeader header;
+    if (size < sizeof(SnapshotHeader)) {
+        return nullptr;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic_ != MAGIC) {
+        return nullptr;
+    }
+
+    SnapshotTrailer trailer;
+    if (header.version_ > VERSION || size < sizeof(SnapshotHeader) + sizeof(SnapshotTrailer)) {
+        Status status = Status::CatalogCorrupted(path);
+        LOG_ERROR(fmt::format("{}, version: {}, size: {}", status.message(), header.version_, size));
+        RecoverableError(status);
+    }
+    std::memcpy(&trailer, data + size - sizeof(trailer), sizeof(trailer));
+    if (trailer.magic_ != MAGIC || trailer.directory_offset_ > size - sizeof(trailer) ||
+        trailer.directory_size_ > size - sizeof(trailer) - trailer.directory_offset_) {
+        Status status = Status::CatalogCorrupted(path);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    snapshot->directory_offset_ = trailer.directory_offset_;
+    snapshot->directory_size_ = trailer.directory_size_;
+    snapshot->directory_checksum_ = trailer.directory_checksum_;
+    return snapshot;
+}
+
+const u8 *CatalogSnapshot::CheckedData(u64 offset, u64 size, u32 checksum) const {
+    if (offset > size_ || size > size_ - offset || CRC32C(data_ + offset, size) != checksum) {
+        Status status = Status::CatalogCorrupted(path_);
+        LOG_ERROR(fmt::format("{}, blob offset: {}, size: {}", status.message(), offset, size));
+        RecoverableError(status);
+    }
+    return data_ + offset;
+}
+
+nlohmann::json CatalogSnapshot::ReadDirectory() const {
+    const u8 *data = CheckedData(directory_offset_, directory_size_, directory_checksum_);
+    return nlohmann::json::from_msgpack(data, data + directory_size_);
+}
+
+nlohmann::json CatalogSnapshot::ReadTable(const CatalogSnapshotRef &ref) const {
+    const u8 *data = TableData(ref);
+    return nlohmann::json::from_msgpack(data, data + ref.size_);
+}
+
+const u8 *CatalogSnapshot::TableData(const CatalogSnapshotRef &ref) const { return CheckedData(ref.offset_, ref.size_, ref.checksum_); }
+
+CatalogSnapshotWriter::CatalogSnapshotWriter(const String &path, HashSet<String> changed_tables)
+    : path_(path), changed_tables_(std::move(changed_tables)) {
+    LocalFileSystem fs;
+    u8 fileflags = FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE;
+    file_handler_ = fs.OpenFile(path_, fileflags, FileLockType::kWriteLock);
+
+    SnapshotHeader header{CatalogSnapshot::MAGIC, CatalogSnapshot::VERSION};
+    u32 checksum = 0;
+    Append(&header, sizeof(header), checksum);
+}
+
+CatalogSnapshotWriter::~CatalogSnapshotWriter() {
+    if (file_handler_.get() != nullptr) {
+        file_handler_->Close();
+    }
+}
+
+u64 CatalogSnapshotWriter::Append(const void *data, SizeT size, u32 &checksum) {
+    u64 offset = offset_;
+    file_handler_->StartChecksum();
+    i64 n_bytes = file_handler_->Write(data, size);
+    file_handler_->StopChecksum();
+    if (n_bytes < 0 || (SizeT)n_bytes != size) {
+        Status status = Status::DataCorrupted(path_);
+        LOG_ERROR(status.message());
+        RecoverableError(status);
+    }
+    checksum = file_handler_->checksum();
+    offset_ += size;
+    return offset;
+}
+
+CatalogSnapshotRef CatalogSnapshotWriter::WriteTable(const nlohmann::json &table_meta_json) {
+    Vector<u8> blob = nlohmann::json::to_msgpack(table_meta_json);
+    CatalogSnapshotRef ref;
+    ref.size_ = blob.size();
+    ref.offset_ = Append(blob.data(), blob.size(), ref.checksum_);
+    ++written_table_count_;
+    return ref;
+}
+
+CatalogSnapshotRef CatalogSnapshotWriter::CopyTable(const CatalogSnapshot &snapshot, const CatalogSnapshotRef &ref) {
+    const u8 *data = snapshot.TableData(ref);
+    CatalogSnapshotRef new_ref = ref;
+    new_ref.offset_ = Append(data, ref.size_, new_ref.checksum_);
+    ++copied_table_count_;
+    return new_ref;
+}
+
+void CatalogSnapshotWriter::Finish(const nlohmann::json &directory_json) {
+    Vector<u8> blob = nlohmann::json::to_msgpack(directory_json);
+    SnapshotTrailer trailer{};
+    trailer.directory_size_ = blob.size();
+    trailer.directory_offset_ = Append(blob.data(), blob.size(), trailer.directory_checksum_);
+    trailer.magic_ = CatalogSnapshot::MAGIC;
+    u32 checksum = 0;
+    Append(&trailer, sizeof(trailer), checksum);
+
+    file_handler_->Sync();
+    file_handler_->Close();
+    file_handler_.reset();
+}
+
+void CatalogSnapshotWriter::Bind(const SharedPtr<CatalogSnapshot> &snapshot) {
+    for (auto &bind : binds_) {
+        bind(snapshot);
+    }
+    binds_.clear();
+}
+
+} // namespace infinity
@@ -0,0 +1,118 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module catalog_snapshot;
+
+import stl;
+import third_party;
+import file_system;
+
+namespace infinity {
+
+// Full checkpoint of the catalog in a binary file:
+//   header:    magic: u32, version: u32
+//   tables:    MessagePack blob of each table meta
+//   directory: MessagePack blob of the catalog with its databases and db entries, in which each table meta is
+//              replaced by the reference to its blob
+//   trailer:   directory offset: u64, directory size: u64, directory checksum: u32, magic: u32
+// The file is mapped on load and a table meta is decoded from its blob when the table is first accessed.
+
+export struct CatalogSnapshotRef {
+    u64 offset_{};
+    u64 size_{};
+    u32 checksum_{};
+    // Tables without index need no memory index recovery, so they can stay unloaded at startup.
+    bool has_index_{};
+    // Tables without dropped entries or deprecated segments have nothing to clean up, so the cleanup does not load them.
+    bool has_garbage_{true};
+
+    void ToJson(nlohmann::json &json) const;
+
+    static CatalogSnapshotRef FromJson(const nlohmann::json &json);
+};
+
+export class CatalogSnapshot {
+public:
+    static constexpr u32 MAGIC = 0x504B4349; // "ICKP"
+    static constexpr u32 VERSION = 1;
+
+    CatalogSnapshot(String path, u8 *data, SizeT size);
+
+    ~CatalogSnapshot();
+
+    // Map the file. Return nullptr if it is not a binary checkpoint, i.e. it is a json checkpoint of an older version.
+    static SharedPtr<CatalogSnapshot> Open(const String &path);
+
+    nlohmann::json ReadDirectory() const;
+
+    nlohmann::json ReadTable(const CatalogSnapshotRef &ref) const;
+
+    const u8 *TableData(const CatalogSnapshotRef &ref) const;
+
+    const String &path() const { return path_; }
+
+private:
+    const u8 *CheckedData(u64 offset, u64 size, u32 checksum) const;
+
+    const String path_;
+    u8 *data_{};
+    SizeT size_{};
+
+    u64 directory_offset_{};
+    u64 directory_size_{};
+    u32 directory_checksum_{};
+};
+
+export class CatalogSnapshotWriter {
+public:
+    // `changed_tables` are the encodes of the tables with delta operations since the last full checkpoint.
+    CatalogSnapshotWriter(const String &path, HashSet<String> changed_tables);
+
+    ~CatalogSnapshotWriter();
+
+    bool TableChanged(const String &table_encode) const { return changed_tables_.contains(table_encode); }
+
+    CatalogSnapshotRef WriteTable(const nlohmann::json &table_meta_json);
+
+    // Copy the blob of an unchanged table from the previous checkpoint without decoding it.
+    CatalogSnapshotRef CopyTable(const CatalogSnapshot &snapshot, const CatalogSnapshotRef &ref);
+
+    void Finish(const nlohmann::json &directory_json);
+
+    // Called with the new checkpoint once it is in place, so that the table metas refer to their blobs in it.
+    void OnOpen(std::function<void(const SharedPtr<CatalogSnapshot> &)> bind) { binds_.push_back(std::move(bind)); }
+
+    void Bind(const SharedPtr<CatalogSnapshot> &snapshot);
+
+    SizeT written_table_count() const { return written_table_count_; }
+
+    SizeT copied_table_count() const { return copied_table_count_; }
+
+private:
+    u64 Append(const void *data, SizeT size, u32 &checksum);
+
+    const String path_;
+    UniquePtr<FileHandler> file_handler_{};
+    u64 offset_{};
+
+    HashSet<String> changed_tables_{};
+    Vector<std::function<void(const SharedPtr<CatalogSnapshot> &)>> binds_{};
+
+    SizeT written_table_count_{};
+    SizeT copied_table_count_{};
+};
+
+} // namespace infinity
@@ -35,6 +35,8 @@ public:
 
     void AddEntry(SharedPtr<EntryInterface> entry);
 
+    SizeT entry_count() const { return entries_.size(); }
+
     TxnTimeStamp visible_ts() const { return visible_ts_; }
 
     static void CleanupDir(const String &dir);
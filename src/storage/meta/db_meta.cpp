@@ -111,7 +111,7 @@ SharedPtr<String> DBMeta::ToString() {
     return res;
 }
 
-nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer) {
     nlohmann::json json_res;
     Vector<DBEntry *> db_candidates;
     {
@@ -128,19 +128,19 @@ nlohmann::json DBMeta::Serialize(TxnTimeStamp max_commit_ts) {
         }
     }
     for (DBEntry *db_entry : db_candidates) {
-        json_res["db_entries"].emplace_back(db_entry->Serialize(max_commit_ts));
+        json_res["db_entries"].emplace_back(db_entry->Serialize(max_commit_ts, snapshot_writer));
     }
     return json_res;
 }
 
-UniquePtr<DBMeta> DBMeta::Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr) {
+UniquePtr<DBMeta> DBMeta::Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr, const SharedPtr<CatalogSnapshot> &snapshot) {
     SharedPtr<String> data_dir = MakeShared<String>(db_meta_json["data_dir"]);
     SharedPtr<String> db_name = MakeShared<String>(db_meta_json["db_name"]);
     UniquePtr<DBMeta> res = MakeUnique<DBMeta>(data_dir, db_name);
 
     if (db_meta_json.contains("db_entries")) {
         for (const auto &db_entry_json : db_meta_json["db_entries"]) {
-            res->db_entry_list().emplace_back(DBEntry::Deserialize(db_entry_json, res.get(), buffer_mgr));
+            res->db_entry_list().emplace_back(DBEntry::Deserialize(db_entry_json, res.get(), buffer_mgr, snapshot));
         }
     }
     res->db_entry_list().sort([](const SharedPtr<BaseEntry> &ent1, const SharedPtr<BaseEntry> &ent2) { return ent1->commit_ts_ > ent2->commit_ts_; });
@@ -30,6 +30,7 @@ import entry_list;
 
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -47,9 +48,10 @@ public:
 
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer = nullptr);
 
-    static UniquePtr<DBMeta> Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr);
+    static UniquePtr<DBMeta>
+    Deserialize(const nlohmann::json &db_meta_json, BufferManager *buffer_mgr, const SharedPtr<CatalogSnapshot> &snapshot = nullptr);
 
     SharedPtr<String> db_name() const { return db_name_; }
 
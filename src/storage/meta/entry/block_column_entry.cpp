@@ -36,6 +36,8 @@ import catalog_delta_entry;
 import internal_types;
 import data_type;
 import logical_type;
+import column_encoding;
+import bitmask;
 
 namespace infinity {
 
@@ -53,6 +55,13 @@ String BlockColumnEntry::EncodeIndex(const ColumnID column_id, const BlockEntry
     return fmt::format("{}#{}", block_entry->encode(), column_id);
 }
 
+namespace {
+
+// Width of the values in the column file, 0 to keep the file unencoded. Boolean columns are bit-packed.
+SizeT EncodingElemSize(const DataType *column_type) { return column_type->type() == kBoolean ? 0 : column_type->Size(); }
+
+} // namespace
+
 BlockColumnEntry::BlockColumnEntry(const BlockEntry *block_entry, ColumnID column_id, const SharedPtr<String> &base_dir_ref)
     : BaseEntry(EntryType::kBlockColumn, false, BlockColumnEntry::EncodeIndex(column_id, block_entry)), block_entry_(block_entry),
       column_id_(column_id), base_dir_(base_dir_ref) {}
@@ -73,7 +82,8 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewBlockColumnEntry(const BlockEnt
         // TODO
         total_data_size = (row_capacity + 7) / 8;
     }
-    auto file_worker = MakeUnique<DataFileWorker>(block_column_entry->base_dir_, block_column_entry->file_name_, total_data_size);
+    auto file_worker =
+        MakeUnique<DataFileWorker>(block_column_entry->base_dir_, block_column_entry->file_name_, total_data_size, EncodingElemSize(column_type));
 
     auto *buffer_mgr = txn->buffer_mgr();
     block_column_entry->buffer_ = buffer_mgr->AllocateBufferObject(std::move(file_worker));
@@ -97,7 +107,7 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
     DataType *column_type = column_entry->column_type_.get();
     SizeT row_capacity = block_entry->row_capacity();
     SizeT total_data_size = (column_type->type() == kBoolean) ? ((row_capacity + 7) / 8) : (row_capacity * column_type->Size());
-    auto file_worker = MakeUnique<DataFileWorker>(column_entry->base_dir_, column_entry->file_name_, total_data_size);
+    auto file_worker = MakeUnique<DataFileWorker>(column_entry->base_dir_, column_entry->file_name_, total_data_size, EncodingElemSize(column_type));
 
     column_entry->buffer_ = buffer_manager->GetBufferObject(std::move(file_worker));
 
@@ -138,7 +148,7 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
 ColumnVector BlockColumnEntry::GetColumnVector(BufferManager *buffer_mgr) {
     if (this->buffer_ == nullptr) {
         // Get buffer handle from buffer manager
-        auto file_worker = MakeUnique<DataFileWorker>(this->base_dir_, this->file_name_, 0);
+        auto file_worker = MakeUnique<DataFileWorker>(this->base_dir_, this->file_name_, 0, EncodingElemSize(column_type_.get()));
         this->buffer_ = buffer_mgr->GetBufferObject(std::move(file_worker));
     }
 
@@ -147,6 +157,20 @@ ColumnVector BlockColumnEntry::GetColumnVector(BufferManager *buffer_mgr) {
     return column_vector;
 }
 
+bool BlockColumnEntry::FilterEncoded(BufferManager *buffer_mgr, const EncodedColumnFilter &filter, Bitmask &selected) {
+    if (this->buffer_ == nullptr) {
+        auto file_worker = MakeUnique<DataFileWorker>(this->base_dir_, this->file_name_, 0, EncodingElemSize(column_type_.get()));
+        this->buffer_ = buffer_mgr->GetBufferObject(std::move(file_worker));
+    }
+
+    BufferHandle buffer_handle = buffer_->Load();
+    const auto *file_worker = static_cast<const DataFileWorker *>(buffer_->file_worker());
+    if (!file_worker->Encoded()) {
+        return false;
+    }
+    return file_worker->Filter(filter, block_entry_->row_capacity(), selected);
+}
+
 SharedPtr<String> BlockColumnEntry::OutlineFilename(const u32 buffer_group_id, const SizeT file_idx) const {
     if (buffer_group_id == 0) {
         return MakeShared<String>(fmt::format("col_{}_out_{}", column_id_, file_idx));
@@ -224,6 +248,10 @@ void BlockColumnEntry::Append(const ColumnVector *input_column_vector, u16 input
 
 void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count) {
     // TODO: Opt, Flush certain row_count content
+    if (checkpoint_row_count == block_column_entry->block_entry_->row_capacity()) {
+        // nothing is appended to a full block, so its column can be encoded
+        static_cast<DataFileWorker *>(block_column_entry->buffer_->file_worker())->Seal();
+    }
     DataType *column_type = block_column_entry->column_type_.get();
     switch (column_type->type()) {
         case kBoolean:
@@ -27,6 +27,8 @@ import vector_buffer;
 import txn;
 import internal_types;
 import base_entry;
+import column_encoding;
+import bitmask;
 
 namespace infinity {
 
@@ -78,6 +80,10 @@ public:
 
     ColumnVector GetColumnVector(BufferManager *buffer_mgr);
 
+    // Evaluate `filter` on the column of a sealed block without decoding it, clearing the bits in `selected` of the rows
+    // that don't match. Return false if the column isn't encoded with frame of reference or dictionary in memory.
+    bool FilterEncoded(BufferManager *buffer_mgr, const EncodedColumnFilter &filter, Bitmask &selected);
+
     void AppendOutlineBuffer(u32 buffer_group_id, BufferObj *buffer);
 
     BufferObj *GetOutlineBuffer(u32 buffer_group_id, SizeT idx) const;
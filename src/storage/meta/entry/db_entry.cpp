@@ -231,7 +231,7 @@ SharedPtr<String> DBEntry::ToString() {
     return res;
 }
 
-nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
+nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer) {
     nlohmann::json json_res;
 
     Vector<TableMeta *> table_metas;
@@ -252,12 +252,19 @@ nlohmann::json DBEntry::Serialize(TxnTimeStamp max_commit_ts) {
         }
     }
     for (TableMeta *table_meta : table_metas) {
-        json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts));
+        if (snapshot_writer != nullptr) {
+            json_res["tables"].emplace_back(table_meta->WriteSnapshot(max_commit_ts, *snapshot_writer));
+        } else {
+            json_res["tables"].emplace_back(table_meta->Serialize(max_commit_ts));
+        }
     }
     return json_res;
 }
 
-UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr) {
+UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json,
+                                        DBMeta *db_meta,
+                                        BufferManager *buffer_mgr,
+                                        const SharedPtr<CatalogSnapshot> &snapshot) {
     nlohmann::json json_res;
 
     bool deleted = db_entry_json["deleted"];
@@ -276,7 +283,12 @@ UniquePtr<DBEntry> DBEntry::Deserialize(const nlohmann::json &db_entry_json, DBM
 
     if (db_entry_json.contains("tables")) {
         for (const auto &table_meta_json : db_entry_json["tables"]) {
-            UniquePtr<TableMeta> table_meta = TableMeta::Deserialize(table_meta_json, res.get(), buffer_mgr);
+            UniquePtr<TableMeta> table_meta;
+            if (snapshot.get() != nullptr) {
+                table_meta = TableMeta::LoadFromSnapshot(table_meta_json, snapshot, res.get(), buffer_mgr);
+            } else {
+                table_meta = TableMeta::Deserialize(table_meta_json, res.get(), buffer_mgr);
+            }
             res->table_meta_map().emplace(*table_meta->table_name_, std::move(table_meta));
         }
     }
@@ -308,6 +320,9 @@ void DBEntry::Cleanup() {
 void DBEntry::MemIndexCommit() {
     auto table_meta_map_guard = table_meta_map_.GetMetaMap();
     for (auto &[_, table_meta] : *table_meta_map_guard) {
+        if (!table_meta->MayHaveIndex()) {
+            continue;
+        }
         auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
             table_entry->MemIndexCommit();
@@ -318,6 +333,10 @@ void DBEntry::MemIndexCommit() {
 void DBEntry::MemIndexRecover(BufferManager *buffer_manager) {
     auto table_meta_map_guard = table_meta_map_.GetMetaMap();
     for (auto &[_, table_meta] : *table_meta_map_guard) {
+        // a table without index stays unloaded
+        if (!table_meta->MayHaveIndex()) {
+            continue;
+        }
         auto [table_entry, status] = table_meta->GetEntryNolock(0UL, MAX_TIMESTAMP);
         if (status.ok()) {
             table_entry->MemIndexRecover(buffer_manager);
@@ -31,6 +31,7 @@ import meta_map;
 import random;
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -72,9 +73,13 @@ public:
 public:
     SharedPtr<String> ToString();
 
-    nlohmann::json Serialize(TxnTimeStamp max_commit_ts);
+    // With a snapshot writer, the table metas are written to the binary checkpoint and only their references are in the json.
+    nlohmann::json Serialize(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter *snapshot_writer = nullptr);
 
-    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json, DBMeta *db_meta, BufferManager *buffer_mgr);
+    static UniquePtr<DBEntry> Deserialize(const nlohmann::json &db_entry_json,
+                                          DBMeta *db_meta,
+                                          BufferManager *buffer_mgr,
+                                          const SharedPtr<CatalogSnapshot> &snapshot = nullptr);
 
     [[nodiscard]] const SharedPtr<String> &db_name_ptr() const { return db_name_; }
 
@@ -37,6 +37,7 @@ import hnsw_alg;
 import catalog_delta_entry;
 import column_vector;
 import annivfflat_index_data;
+import annivfpq_index_data;
 import secondary_index_data;
 import type_info;
 import embedding_info;
@@ -46,6 +47,7 @@ import block_column_entry;
 import default_values;
 import segment_iter;
 import annivfflat_index_file_worker;
+import annivfpq_index_file_worker;
 import hnsw_file_worker;
 import secondary_index_file_worker;
 import index_full_text;
@@ -58,9 +60,22 @@ import abstract_hnsw;
 import block_column_iter;
 import txn_store;
 import secondary_index_in_mem;
+import infinity_context;
+import config;
 
 namespace infinity {
 
+namespace {
+
+// Shared by the HNSW builds of all the indexes, so that concurrent builds don't multiply the build threads. The building
+// thread takes part as well, so the pool has one thread less than hnsw_build_thread_num.
+ThreadPool *HnswBuildThreadPool() {
+    static ThreadPool build_pool(std::max(InfinityContext::instance().config()->HnswBuildThreadNum() - 1, 0l));
+    return build_pool.size() == 0 ? nullptr : &build_pool;
+}
+
+} // namespace
+
 Vector<std::string_view> SegmentIndexEntry::DecodeIndex(std::string_view encode) {
     SizeT delimiter_i = encode.rfind('#');
     if (delimiter_i == String::npos) {
@@ -182,7 +197,11 @@ Vector<UniquePtr<IndexFileWorker>> SegmentIndexEntry::CreateFileWorkers(SharedPt
             auto create_annivfflat_param = static_cast<CreateAnnIVFFlatParam *>(param);
             auto elem_type = ((EmbeddingInfo *)(column_def->type()->type_info().get()))->Type();
             switch (elem_type) {
-                case kElemFloat: {
+                case kElemFloat:
+                case kElemFloat16:
+                case kElemInt8:
+                case kElemUInt8: {
+                    // Centroids are f32, the worker handles the element type of the column
                     file_worker =
                         MakeUnique<AnnIVFFlatIndexFileWorker<f32>>(index_dir, file_name, index_base, column_def, create_annivfflat_param->row_count_);
                     break;
@@ -193,6 +212,11 @@ Vector<UniquePtr<IndexFileWorker>> SegmentIndexEntry::CreateFileWorkers(SharedPt
             }
             break;
         }
+        case IndexType::kIVFPQ: {
+            auto create_annivfpq_param = static_cast<CreateAnnIVFPQParam *>(param);
+            file_worker = MakeUnique<AnnIVFPQIndexFileWorker>(index_dir, file_name, index_base, column_def, create_annivfpq_param->row_count_);
+            break;
+        }
         default: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("File worker isn't implemented: {}", IndexInfo::IndexTypeToString(index_base->index_type_)));
@@ -297,6 +321,28 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
                     row_cnt = end_i;
                     break;
                 }
+                case kElemInt8: {
+                    AbstractHnsw<i8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    MemIndexInserterIter<i8> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
+                    row_cnt = end_i;
+                    break;
+                }
+                case kElemFloat16: {
+                    AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    MemIndexInserterIter<Float16T> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
+                    row_cnt = end_i;
+                    break;
+                }
+                case kElemUInt8:
+                case kElemBit: {
+                    AbstractHnsw<u8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    MemIndexInserterIter<u8> iter(block_offset, block_column_entry, buffer_manager, row_offset, row_count);
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter));
+                    row_cnt = end_i;
+                    break;
+                }
                 default: {
                     Status status = Status::NotSupport("Not support data type for index hnsw.");
                     LOG_ERROR(status.message());
@@ -316,7 +362,8 @@ void SegmentIndexEntry::MemIndexInsert(SharedPtr<BlockEntry> block_entry,
             memory_secondary_index_->Insert(block_id, block_column_entry, buffer_manager, row_offset, row_count);
             break;
         }
-        case IndexType::kIVFFlat: {
+        case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ: {
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} realtime index is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
             LOG_WARN(*err_msg);
@@ -340,6 +387,34 @@ void SegmentIndexEntry::MemIndexCommit() {
     memory_indexer_->Commit();
 }
 
+namespace {
+
+// The codebooks of a product quantized index are trained on all its vectors before it is saved, if they are fewer than the retrain size.
+void OptimizeMemoryHnsw(ChunkIndexEntry *chunk_index_entry, const IndexHnsw *index_hnsw, const ColumnDef *column_def) {
+    if (index_hnsw->encode_type_ != HnswEncodeType::kPQ) {
+        return;
+    }
+    BufferHandle buffer_handle = chunk_index_entry->GetIndex();
+    auto *embedding_info = static_cast<EmbeddingInfo *>(column_def->type()->type_info().get());
+    switch (embedding_info->Type()) {
+        case kElemFloat: {
+            AbstractHnsw<f32, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+            abstract_hnsw.Optimize();
+            break;
+        }
+        case kElemInt8: {
+            AbstractHnsw<i8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+            abstract_hnsw.Optimize();
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+} // namespace
+
 SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill) {
     SharedPtr<ChunkIndexEntry> chunk_index_entry = nullptr;
     const IndexBase *index_base = table_index_entry_->index_base();
@@ -349,6 +424,7 @@ SharedPtr<ChunkIndexEntry> SegmentIndexEntry::MemIndexDump(bool spill) {
                 return nullptr;
             }
             auto dump_indexer = std::exchange(memory_hnsw_indexer_, nullptr);
+            OptimizeMemoryHnsw(dump_indexer.get(), static_cast<const IndexHnsw *>(index_base), table_index_entry_->column_def().get());
             this->AddChunkIndexEntry(dump_indexer);
             return dump_indexer;
         }
@@ -485,7 +561,8 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
                         insert_config.optimize_ = true;
                         SegmentOffset start_i, end_i;
                         if (!config.prepare_) {
-                            // Single thread insert
+                            // Build with the hnsw build threads
+                            insert_config.build_pool_ = HnswBuildThreadPool();
                             std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
                         } else {
                             // Multi thread insert data, write file in the physical create index finish stage.
@@ -506,6 +583,94 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
                     chunk_index_entry->SetRowCount(row_count);
                     break;
                 }
+                case kElemInt8: {
+                    AbstractHnsw<i8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    auto InsertHnswInner = [&](auto &iter) {
+                        HnswInsertConfig insert_config;
+                        insert_config.optimize_ = true;
+                        SegmentOffset start_i, end_i;
+                        if (!config.prepare_) {
+                            // Build with the hnsw build threads
+                            insert_config.build_pool_ = HnswBuildThreadPool();
+                            std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                        } else {
+                            // Multi thread insert data, write file in the physical create index finish stage.
+                            std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
+                        }
+                        LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
+                        return end_i - start_i;
+                    };
+                    SegmentOffset row_count = 0;
+                    if (config.check_ts_) {
+                        OneColumnIterator<i8> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<i8, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    }
+                    chunk_index_entry->SetRowCount(row_count);
+                    break;
+                }
+                case kElemFloat16: {
+                    AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    auto InsertHnswInner = [&](auto &iter) {
+                        HnswInsertConfig insert_config;
+                        insert_config.optimize_ = true;
+                        SegmentOffset start_i, end_i;
+                        if (!config.prepare_) {
+                            // Build with the hnsw build threads
+                            insert_config.build_pool_ = HnswBuildThreadPool();
+                            std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                        } else {
+                            // Multi thread insert data, write file in the physical create index finish stage.
+                            std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
+                        }
+                        LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
+                        return end_i - start_i;
+                    };
+                    SegmentOffset row_count = 0;
+                    if (config.check_ts_) {
+                        OneColumnIterator<Float16T> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<Float16T, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    }
+                    chunk_index_entry->SetRowCount(row_count);
+                    break;
+                }
+                case kElemUInt8:
+                case kElemBit: {
+                    AbstractHnsw<u8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    auto InsertHnswInner = [&](auto &iter) {
+                        HnswInsertConfig insert_config;
+                        insert_config.optimize_ = true;
+                        SegmentOffset start_i, end_i;
+                        if (!config.prepare_) {
+                            // Build with the hnsw build threads
+                            insert_config.build_pool_ = HnswBuildThreadPool();
+                            std::tie(start_i, end_i) = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                        } else {
+                            // Multi thread insert data, write file in the physical create index finish stage.
+                            std::tie(start_i, end_i) = abstract_hnsw.StoreData(std::move(iter), insert_config);
+                        }
+                        LOG_TRACE(fmt::format("Insert index: {} - {}", start_i, end_i));
+                        return end_i - start_i;
+                    };
+                    SegmentOffset row_count = 0;
+                    if (config.check_ts_) {
+                        OneColumnIterator<u8> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<u8, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        row_count = InsertHnswInner(iter);
+                    }
+                    chunk_index_entry->SetRowCount(row_count);
+                    break;
+                }
                 default: {
                     Status status = Status::NotSupport("Not support data type for index hnsw.");
                     LOG_ERROR(status.message());
@@ -528,7 +693,8 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             MemIndexDump();
             break;
         }
-        case IndexType::kIVFFlat: { // TODO
+        case IndexType::kIVFFlat:
+        case IndexType::kIVFPQ: { // TODO
             UniquePtr<String> err_msg =
                 MakeUnique<String>(fmt::format("{} PopulateEntirely is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
             LOG_WARN(*err_msg);
@@ -578,6 +744,45 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
                     }
                     break;
                 }
+                case kElemInt8: {
+                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32, i8> *>(buffer_handle.GetDataMut());
+                    // TODO: How to select training data?
+                    if (check_ts) {
+                        OneColumnIterator<i8> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<i8, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    }
+                    break;
+                }
+                case kElemUInt8: {
+                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32, u8> *>(buffer_handle.GetDataMut());
+                    // TODO: How to select training data?
+                    if (check_ts) {
+                        OneColumnIterator<u8> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<u8, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    }
+                    break;
+                }
+                case kElemFloat16: {
+                    auto annivfflat_index = reinterpret_cast<AnnIVFFlatIndexData<f32, Float16T> *>(buffer_handle.GetDataMut());
+                    // TODO: How to select training data?
+                    if (check_ts) {
+                        OneColumnIterator<Float16T> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    } else {
+                        // Not check ts in uncommitted segment when compact segment
+                        OneColumnIterator<Float16T, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                        annivfflat_index->BuildIndex(iter, dimension, full_row_count);
+                    }
+                    break;
+                }
                 default: {
                     Status status = Status::NotSupport("Not support data type for index ivf.");
                     LOG_ERROR(status.message());
@@ -586,6 +791,31 @@ Status SegmentIndexEntry::CreateIndexPrepare(const SegmentEntry *segment_entry,
             }
             break;
         }
+        case IndexType::kIVFPQ: {
+            if (column_def->type()->type() != LogicalType::kEmbedding) {
+                UnrecoverableError("AnnIVFPQ only supports embedding type.");
+            }
+            TypeInfo *type_info = column_def->type()->type_info().get();
+            auto embedding_info = static_cast<EmbeddingInfo *>(type_info);
+            if (embedding_info->Type() != kElemFloat) {
+                Status status = Status::NotSupport("Not support data type for index ivfpq.");
+                LOG_ERROR(status.message());
+                RecoverableError(status);
+            }
+            u32 dimension = embedding_info->Dimension();
+            u32 full_row_count = segment_entry->row_count();
+            BufferHandle buffer_handle = GetIndex();
+            auto annivfpq_index = reinterpret_cast<AnnIVFPQIndexData *>(buffer_handle.GetDataMut());
+            if (check_ts) {
+                OneColumnIterator<float> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                annivfpq_index->BuildIndex(iter, dimension, full_row_count);
+            } else {
+                // Not check ts in uncommitted segment when compact segment
+                OneColumnIterator<float, false> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                annivfpq_index->BuildIndex(iter, dimension, full_row_count);
+            }
+            break;
+        }
         case IndexType::kHnsw: {
             PopulateEntirely(segment_entry, txn, populate_entire_config);
             break;
@@ -640,6 +870,40 @@ Status SegmentIndexEntry::CreateIndexDo(atomic_u64 &create_index_idx) {
                         }
                         break;
                     }
+                    case kElemInt8: {
+                        AbstractHnsw<i8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                        while (true) {
+                            SizeT idx = create_index_idx.fetch_add(1);
+                            if (idx >= row_count) {
+                                break;
+                            }
+                            abstract_hnsw.Build(offset + idx);
+                        }
+                        break;
+                    }
+                    case kElemFloat16: {
+                        AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                        while (true) {
+                            SizeT idx = create_index_idx.fetch_add(1);
+                            if (idx >= row_count) {
+                                break;
+                            }
+                            abstract_hnsw.Build(offset + idx);
+                        }
+                        break;
+                    }
+                    case kElemUInt8:
+                    case kElemBit: {
+                        AbstractHnsw<u8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                        while (true) {
+                            SizeT idx = create_index_idx.fetch_add(1);
+                            if (idx >= row_count) {
+                                break;
+                            }
+                            abstract_hnsw.Build(offset + idx);
+                        }
+                        break;
+                    }
                     default: {
                         Status status = Status::NotSupport("Not implemented");
                         LOG_ERROR(status.message());
@@ -744,6 +1008,9 @@ SegmentIndexEntry::GetCreateIndexParam(SharedPtr<IndexBase> index_base, SizeT se
         case IndexType::kIVFFlat: {
             return MakeUnique<CreateAnnIVFFlatParam>(index_base, column_def, seg_row_count);
         }
+        case IndexType::kIVFPQ: {
+            return MakeUnique<CreateAnnIVFPQParam>(index_base, column_def, seg_row_count);
+        }
         case IndexType::kHnsw: {
             SizeT chunk_size = 8192; // TODO
             SizeT max_chunk_num = 1024;
@@ -814,6 +1081,44 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
                     OneColumnIterator<float, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
                     HnswInsertConfig insert_config;
                     insert_config.optimize_ = true;
+                    insert_config.build_pool_ = HnswBuildThreadPool();
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                    if (end_i - start_i != row_count) {
+                        UnrecoverableError("Rebuild HNSW index failed.");
+                    }
+                    break;
+                }
+                case kElemInt8: {
+                    AbstractHnsw<i8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    OneColumnIterator<i8, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                    HnswInsertConfig insert_config;
+                    insert_config.optimize_ = true;
+                    insert_config.build_pool_ = HnswBuildThreadPool();
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                    if (end_i - start_i != row_count) {
+                        UnrecoverableError("Rebuild HNSW index failed.");
+                    }
+                    break;
+                }
+                case kElemFloat16: {
+                    AbstractHnsw<Float16T, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    OneColumnIterator<Float16T, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                    HnswInsertConfig insert_config;
+                    insert_config.optimize_ = true;
+                    insert_config.build_pool_ = HnswBuildThreadPool();
+                    auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
+                    if (end_i - start_i != row_count) {
+                        UnrecoverableError("Rebuild HNSW index failed.");
+                    }
+                    break;
+                }
+                case kElemUInt8:
+                case kElemBit: {
+                    AbstractHnsw<u8, SegmentOffset> abstract_hnsw(buffer_handle.GetDataMut(), index_hnsw);
+                    OneColumnIterator<u8, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts);
+                    HnswInsertConfig insert_config;
+                    insert_config.optimize_ = true;
+                    insert_config.build_pool_ = HnswBuildThreadPool();
                     auto [start_i, end_i] = abstract_hnsw.InsertVecs(std::move(iter), insert_config);
                     if (end_i - start_i != row_count) {
                         UnrecoverableError("Rebuild HNSW index failed.");
@@ -14,6 +14,7 @@
 
 module;
 
+#include <type_traits>
 #include <vector>
 
 module table_meta;
@@ -34,9 +35,35 @@ import status;
 import infinity_exception;
 import column_def;
 import block_index;
+import segment_entry;
 
 namespace infinity {
 
+namespace {
+
+// Whether the cleanup may pick something from the table: a dropped or older table entry or a deprecated segment. A table with index is
+// loaded at startup for the memory index recovery, so the entries of its indexes are not checked here.
+bool HasGarbage(const nlohmann::json &table_meta_json) {
+    if (!table_meta_json.contains("table_entries") || table_meta_json["table_entries"].size() != 1) {
+        return true;
+    }
+    const auto &table_entry_json = table_meta_json["table_entries"][0];
+    if (table_entry_json["deleted"].get<bool>() || table_entry_json.contains("table_indexes")) {
+        return true;
+    }
+    if (table_entry_json.contains("segments")) {
+        for (const auto &segment_json : table_entry_json["segments"]) {
+            std::underlying_type_t<SegmentStatus> status = segment_json["status"];
+            if (status == static_cast<std::underlying_type_t<SegmentStatus>>(SegmentStatus::kDeprecated)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 UniquePtr<TableMeta> TableMeta::NewTableMeta(const SharedPtr<String> &db_entry_dir, const SharedPtr<String> &table_name, DBEntry *db_entry) {
     auto table_meta = MakeUnique<TableMeta>(db_entry_dir, table_name, db_entry);
 
@@ -62,6 +89,7 @@ Tuple<TableEntry *, Status> TableMeta::CreateEntry(std::shared_lock<std::shared_
                                                    TxnTimeStamp begin_ts,
                                                    TxnManager *txn_mgr,
                                                    ConflictType conflict_type) {
+    LoadEntries();
     auto init_table_entry = [&](TransactionID txn_id, TxnTimeStamp begin_ts) {
         return TableEntry::NewTableEntry(false, this->db_entry_dir_, table_name, columns, table_entry_type, this, txn_id, begin_ts);
     };
@@ -74,6 +102,7 @@ Tuple<SharedPtr<TableEntry>, Status> TableMeta::DropEntry(std::shared_lock<std::
                                                           TxnManager *txn_mgr,
                                                           const String &table_name,
                                                           ConflictType conflict_type) {
+    LoadEntries();
     auto init_drop_entry = [&](TransactionID txn_id, TxnTimeStamp begin_ts) {
         Vector<SharedPtr<ColumnDef>> dummy_columns;
         return TableEntry::NewTableEntry(true,
@@ -90,6 +119,7 @@ Tuple<SharedPtr<TableEntry>, Status> TableMeta::DropEntry(std::shared_lock<std::
 
 Tuple<SharedPtr<TableInfo>, Status>
 TableMeta::GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn) {
+    LoadEntries();
     TransactionID txn_id = txn->TxnID();
     TxnTimeStamp begin_ts = txn->BeginTS();
     auto [table_entry, status] = table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
@@ -109,11 +139,16 @@ TableMeta::GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn)
     return {table_info, status};
 }
 
-void TableMeta::DeleteEntry(TransactionID txn_id) { auto erase_list = table_entry_list_.DeleteEntry(txn_id); }
+void TableMeta::DeleteEntry(TransactionID txn_id) {
+    LoadEntries();
+    auto erase_list = table_entry_list_.DeleteEntry(txn_id);
+}
 
 void TableMeta::CreateEntryReplay(std::function<SharedPtr<TableEntry>(TransactionID, TxnTimeStamp)> &&init_entry,
                                   TransactionID txn_id,
                                   TxnTimeStamp begin_ts) {
+    LoadEntries();
+    MarkReplayed();
     auto [entry, status] = table_entry_list_.AddEntryReplay(std::move(init_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -123,6 +158,8 @@ void TableMeta::CreateEntryReplay(std::function<SharedPtr<TableEntry>(Transactio
 void TableMeta::UpdateEntryReplay(std::function<void(SharedPtr<TableEntry>, TransactionID, TxnTimeStamp)> &&update_entry,
                                   TransactionID txn_id,
                                   TxnTimeStamp begin_ts) {
+    LoadEntries();
+    MarkReplayed();
     auto status = table_entry_list_.UpdateEntryReplay(std::move(update_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -132,6 +169,8 @@ void TableMeta::UpdateEntryReplay(std::function<void(SharedPtr<TableEntry>, Tran
 void TableMeta::DropEntryReplay(std::function<SharedPtr<TableEntry>(TransactionID, TxnTimeStamp)> &&init_entry,
                                 TransactionID txn_id,
                                 TxnTimeStamp begin_ts) {
+    LoadEntries();
+    MarkReplayed();
     auto [dropped_entry, status] = table_entry_list_.DropEntryReplay(std::move(init_entry), txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -139,6 +178,8 @@ void TableMeta::DropEntryReplay(std::function<SharedPtr<TableEntry>(TransactionI
 }
 
 TableEntry *TableMeta::GetEntryReplay(TransactionID txn_id, TxnTimeStamp begin_ts) {
+    LoadEntries();
+    MarkReplayed();
     auto [entry, status] = table_entry_list_.GetEntryReplay(txn_id, begin_ts);
     if (!status.ok()) {
         UnrecoverableError(status.message());
@@ -149,6 +190,7 @@ TableEntry *TableMeta::GetEntryReplay(TransactionID txn_id, TxnTimeStamp begin_t
 const SharedPtr<String> &TableMeta::db_name_ptr() const { return db_entry_->db_name_ptr(); }
 
 SharedPtr<String> TableMeta::ToString() {
+    LoadEntries();
     std::shared_lock<std::shared_mutex> r_locker(this->rw_locker());
     SharedPtr<String> res = MakeShared<String>(
         fmt::format("TableMeta, db_entry_dir: {}, table name: {}, entry count: ", *db_entry_dir_, *table_name_, table_entry_list().size()));
@@ -156,6 +198,7 @@ SharedPtr<String> TableMeta::ToString() {
 }
 
 nlohmann::json TableMeta::Serialize(TxnTimeStamp max_commit_ts) {
+    LoadEntries();
     nlohmann::json json_res;
     Vector<TableEntry *> table_candidates;
     {
@@ -194,20 +237,114 @@ UniquePtr<TableMeta> TableMeta::Deserialize(const nlohmann::json &table_meta_jso
     SharedPtr<String> table_name = MakeShared<String>(table_meta_json["table_name"]);
     LOG_TRACE(fmt::format("load table {}", *table_name));
     UniquePtr<TableMeta> res = MakeUnique<TableMeta>(db_entry_dir, table_name, db_entry);
+    res->DeserializeEntries(table_meta_json, buffer_mgr);
+    return res;
+}
+
+void TableMeta::DeserializeEntries(const nlohmann::json &table_meta_json, BufferManager *buffer_mgr) {
     if (table_meta_json.contains("table_entries")) {
         for (const auto &table_entry_json : table_meta_json["table_entries"]) {
-            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, res.get(), buffer_mgr);
-            res->table_entry_list().emplace_back(std::move(table_entry));
+            UniquePtr<TableEntry> table_entry = TableEntry::Deserialize(table_entry_json, this, buffer_mgr);
+            this->table_entry_list().emplace_back(std::move(table_entry));
         }
     }
-    res->table_entry_list().sort(
+    this->table_entry_list().sort(
         [](const SharedPtr<BaseEntry> &ent1, const SharedPtr<BaseEntry> &ent2) { return ent1->commit_ts_ > ent2->commit_ts_; });
+}
+
+nlohmann::json TableMeta::WriteSnapshot(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter &writer) {
+    nlohmann::json json_res;
+    json_res["db_entry_dir"] = *this->db_entry_dir_;
+    json_res["table_name"] = *this->table_name_;
 
+    CatalogSnapshotRef ref;
+    bool unchanged = false;
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        unchanged = snapshot_.get() != nullptr &&
+                    (!loaded_ || (!changed_since_snapshot_ && !writer.TableChanged(TableEntry::EncodeIndex(*table_name_, this))));
+        if (unchanged) {
+            ref = writer.CopyTable(*snapshot_, snapshot_ref_);
+        }
+    }
+    if (!unchanged) {
+        nlohmann::json table_meta_json = this->Serialize(max_commit_ts);
+        ref = writer.WriteTable(table_meta_json);
+        if (table_meta_json.contains("table_entries")) {
+            for (const auto &table_entry_json : table_meta_json["table_entries"]) {
+                ref.has_index_ |= table_entry_json.contains("table_indexes");
+            }
+        }
+        ref.has_garbage_ = HasGarbage(table_meta_json);
+    }
+    ref.ToJson(json_res);
+
+    // The full checkpoint runs on the background thread, as does the cleanup which may drop this table meta.
+    writer.OnOpen([this, ref, unchanged](const SharedPtr<CatalogSnapshot> &snapshot) {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        snapshot_ = snapshot;
+        snapshot_ref_ = ref;
+        if (!unchanged) {
+            changed_since_snapshot_ = false;
+        }
+    });
+    return json_res;
+}
+
+UniquePtr<TableMeta> TableMeta::LoadFromSnapshot(const nlohmann::json &table_ref_json,
+                                                 SharedPtr<CatalogSnapshot> snapshot,
+                                                 DBEntry *db_entry,
+                                                 BufferManager *buffer_mgr) {
+    SharedPtr<String> db_entry_dir = MakeShared<String>(table_ref_json["db_entry_dir"]);
+    SharedPtr<String> table_name = MakeShared<String>(table_ref_json["table_name"]);
+    UniquePtr<TableMeta> res = MakeUnique<TableMeta>(db_entry_dir, table_name, db_entry);
+    res->snapshot_ = std::move(snapshot);
+    res->snapshot_ref_ = CatalogSnapshotRef::FromJson(table_ref_json);
+    res->buffer_mgr_ = buffer_mgr;
+    res->loaded_ = false;
     return res;
 }
 
-void TableMeta::Cleanup() { table_entry_list_.Cleanup(); }
+void TableMeta::LoadEntries() {
+    if (loaded_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(load_mutex_);
+    if (loaded_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    LOG_TRACE(fmt::format("load table {} from {}", *table_name_, snapshot_->path()));
+    nlohmann::json table_meta_json = snapshot_->ReadTable(snapshot_ref_);
+    DeserializeEntries(table_meta_json, buffer_mgr_);
+    loaded_.store(true, std::memory_order_release);
+}
+
+void TableMeta::MarkReplayed() {
+    std::lock_guard<std::mutex> lock(load_mutex_);
+    changed_since_snapshot_ = true;
+}
 
-bool TableMeta::PickCleanup(CleanupScanner *scanner) { return table_entry_list_.PickCleanup(scanner); }
+void TableMeta::Cleanup() {
+    // The table meta is cleaned up with its dropped database, which removes the directory of the database with the files of the table.
+    // An unloaded table has no buffer object to release.
+    if (!loaded_.load(std::memory_order_acquire)) {
+        return;
+    }
+    table_entry_list_.Cleanup();
+}
+
+bool TableMeta::PickCleanup(CleanupScanner *scanner) {
+    if (!loaded_.load(std::memory_order_acquire) && !snapshot_ref_.has_garbage_) {
+        return false;
+    }
+    LoadEntries();
+    SizeT entry_count = scanner->entry_count();
+    bool may_empty = table_entry_list_.PickCleanup(scanner);
+    if (scanner->entry_count() != entry_count) {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        changed_since_snapshot_ = true;
+    }
+    return may_empty;
+}
 
 } // namespace infinity
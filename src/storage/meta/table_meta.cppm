@@ -31,6 +31,7 @@ import entry_list;
 import meta_info;
 import meta_entry_interface;
 import cleanup_scanner;
+import catalog_snapshot;
 
 namespace infinity {
 
@@ -56,6 +57,17 @@ public:
 
     static UniquePtr<TableMeta> Deserialize(const nlohmann::json &table_meta_json, DBEntry *db_entry, BufferManager *buffer_mgr);
 
+    // Write the table meta to a binary full checkpoint and return its reference there. The blob in the previous
+    // checkpoint is copied as is if the table has not changed since.
+    nlohmann::json WriteSnapshot(TxnTimeStamp max_commit_ts, CatalogSnapshotWriter &writer);
+
+    // The table entries are decoded from the blob in the checkpoint when the table is first accessed.
+    static UniquePtr<TableMeta>
+    LoadFromSnapshot(const nlohmann::json &table_ref_json, SharedPtr<CatalogSnapshot> snapshot, DBEntry *db_entry, BufferManager *buffer_mgr);
+
+    // False only if the table is not loaded yet and had no index in the checkpoint.
+    bool MayHaveIndex() const { return loaded_.load() || snapshot_ref_.has_index_; }
+
     [[nodiscard]] const SharedPtr<String> &table_name_ptr() const { return table_name_; }
     [[nodiscard]] const String &table_name() const { return *table_name_; }
     [[nodiscard]] const SharedPtr<String> &db_name_ptr() const;
@@ -84,10 +96,12 @@ private:
     Tuple<SharedPtr<TableInfo>, Status> GetTableInfo(std::shared_lock<std::shared_mutex> &&r_lock, Txn *txn);
 
     Tuple<TableEntry *, Status> GetEntry(std::shared_lock<std::shared_mutex> &&r_lock, TransactionID txn_id, TxnTimeStamp begin_ts) {
+        LoadEntries();
         return table_entry_list_.GetEntry(std::move(r_lock), txn_id, begin_ts);
     }
 
     Tuple<TableEntry *, Status> GetEntryNolock(TransactionID txn_id, TxnTimeStamp begin_ts) {
+        LoadEntries();
         return table_entry_list_.GetEntryNolock(txn_id, begin_ts);
     }
 
@@ -107,12 +121,30 @@ private:
     TableEntry *GetEntryReplay(TransactionID txn_id, TxnTimeStamp begin_ts);
     //
 
+    void DeserializeEntries(const nlohmann::json &table_meta_json, BufferManager *buffer_mgr);
+
+    // Decode the table entries from the checkpoint if they are not loaded yet.
+    void LoadEntries();
+
+private:
+    void MarkReplayed();
+
 private:
     SharedPtr<String> db_entry_dir_{};
     SharedPtr<String> table_name_{};
 
     DBEntry *db_entry_{};
 
+    // The blob of the table meta in the last full checkpoint. Replay changes a table without delta operations, so a
+    // table that is replayed or cleaned up is written again by the next full checkpoint.
+    SharedPtr<CatalogSnapshot> snapshot_{};
+    CatalogSnapshotRef snapshot_ref_{};
+    bool changed_since_snapshot_{true};
+
+    BufferManager *buffer_mgr_{};
+    std::mutex load_mutex_{};
+    Atomic<bool> loaded_{true};
+
 private:
     EntryList<TableEntry> table_entry_list_{};
 
@@ -127,7 +159,14 @@ public:
 
     bool PickCleanup(CleanupScanner *scanner) override;
 
-    bool Empty() override { return table_entry_list_.Empty(); }
+    bool Empty() override {
+        // a table without garbage in the checkpoint has a live entry
+        if (!loaded_.load() && !snapshot_ref_.has_garbage_) {
+            return false;
+        }
+        LoadEntries();
+        return table_entry_list_.Empty();
+    }
 };
 
 } // namespace infinity
@@ -14,6 +14,7 @@
 
 module;
 
+#include <algorithm>
 #include <concepts>
 #include <vector>
 
@@ -31,6 +32,7 @@ import secondary_index_pgm;
 import logger;
 import chunk_index_entry;
 import buffer_handle;
+import secondary_index_sorted_run;
 
 namespace infinity {
 
@@ -135,26 +137,19 @@ public:
 
     void ReadIndexInner(FileHandler &file_handler) override { pgm_index_->LoadIndex(file_handler); }
 
-    void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) override {
+    void InsertData(const void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) override {
         if (!need_save_) {
             UnrecoverableError("InsertData(): error: SecondaryIndexDataT is not allocated.");
         }
-        auto map_ptr = static_cast<MultiMap<OrderedKeyType, u32> *>(ptr);
-        if (!map_ptr) {
-            UnrecoverableError("InsertData(): error: map_ptr type error.");
+        auto run_ptr = static_cast<const SecondaryIndexSortedRun<OrderedKeyType> *>(ptr);
+        if (!run_ptr) {
+            UnrecoverableError("InsertData(): error: run_ptr type error.");
         }
-        if (map_ptr->size() != chunk_row_count_) {
-            UnrecoverableError(fmt::format("InsertData(): error: map size: {} != chunk_row_count_: {}", map_ptr->size(), chunk_row_count_));
-        }
-        u32 i = 0;
-        for (const auto &[key, offset] : *map_ptr) {
-            key_[i] = key;
-            offset_[i] = offset;
-            ++i;
-        }
-        if (i != chunk_row_count_) {
-            UnrecoverableError(fmt::format("InsertData(): error: i: {} != chunk_row_count_: {}", i, chunk_row_count_));
+        if (run_ptr->size() != chunk_row_count_) {
+            UnrecoverableError(fmt::format("InsertData(): error: run size: {} != chunk_row_count_: {}", run_ptr->size(), chunk_row_count_));
         }
+        std::copy(run_ptr->keys_.begin(), run_ptr->keys_.end(), key_.get());
+        std::copy(run_ptr->offsets_.begin(), run_ptr->offsets_.end(), offset_.get());
         OutputAndBuild(chunk_index);
     }
 
@@ -134,7 +134,8 @@ public:
 
     virtual void ReadIndexInner(FileHandler &file_handler) = 0;
 
-    virtual void InsertData(void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) = 0;
+    // ptr: the SecondaryIndexSortedRun of all rows of the chunk
+    virtual void InsertData(const void *ptr, SharedPtr<ChunkIndexEntry> &chunk_index) = 0;
 
     virtual void InsertMergeData(Vector<ChunkIndexEntry *> &old_chunks, SharedPtr<ChunkIndexEntry> &merged_chunk_index_entry) = 0;
 };
@@ -14,7 +14,7 @@
 
 module;
 
-#include <bit>
+#include <variant>
 #include <vector>
 module secondary_index_in_mem;
 
@@ -32,76 +32,82 @@ import secondary_index_data;
 import chunk_index_entry;
 import segment_index_entry;
 import buffer_handle;
+import secondary_index_sorted_run;
+import filter_value_type_classification;
 
 namespace infinity {
 
+void SecondaryIndexInMemRange::Output(std::variant<Vector<u32>, Bitmask> &selected_rows) const {
+    std::visit(Overload{[&](Vector<u32> &rows) {
+                            for (const auto &[begin, end] : offset_spans_) {
+                                rows.insert(rows.end(), begin, end);
+                            }
+                        },
+                        [&](Bitmask &bitmask) {
+                            // set the bits of the words directly, no bit is cleared
+                            u64 *data = bitmask.GetData();
+                            if (data == nullptr) {
+                                return;
+                            }
+                            for (const auto &[begin, end] : offset_spans_) {
+                                for (const u32 *offset = begin; offset != end; ++offset) {
+                                    data[*offset / 64] |= u64(1) << (*offset % 64);
+                                }
+                            }
+                        }},
+               selected_rows);
+}
+
 template <typename RawValueType>
 class SecondaryIndexInMemT final : public SecondaryIndexInMem {
     using KeyType = ConvertToOrderedType<RawValueType>;
     const RowID begin_row_id_;
     const u32 max_size_;
-    std::shared_mutex map_mutex_;
-    MultiMap<KeyType, u32> in_mem_secondary_index_;
+    SecondaryIndexSortedRuns<KeyType> sorted_runs_;
 
 public:
     explicit SecondaryIndexInMemT(const RowID begin_row_id, const u32 max_size) : begin_row_id_(begin_row_id), max_size_(max_size) {}
-    u32 GetRowCount() const override { return in_mem_secondary_index_.size(); }
+    u32 GetRowCount() const override { return sorted_runs_.RowCount(); }
     void Insert(const u16 block_id, BlockColumnEntry *block_column_entry, BufferManager *buffer_manager, u32 row_offset, u32 row_count) override {
         MemIndexInserterIter<RawValueType> iter(block_id * DEFAULT_BLOCK_CAPACITY, block_column_entry, buffer_manager, row_offset, row_count);
         InsertInner(iter);
     }
     SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr) override {
-        std::shared_lock lock(map_mutex_);
-        u32 row_count = GetRowCount();
+        const auto run = SecondaryIndexSortedRuns<KeyType>::MergeAll(*sorted_runs_.Snapshot());
+        const u32 row_count = run->size();
         auto new_chunk_index_entry = segment_index_entry->CreateSecondaryIndexChunkIndexEntry(begin_row_id_, row_count, buffer_mgr);
         BufferHandle handle = new_chunk_index_entry->GetIndex();
         auto data_ptr = static_cast<SecondaryIndexData *>(handle.GetDataMut());
-        data_ptr->InsertData(&in_mem_secondary_index_, new_chunk_index_entry);
+        data_ptr->InsertData(run.get(), new_chunk_index_entry);
         return new_chunk_index_entry;
     }
-    Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQuery(const void *input) override {
-        const auto &[segment_row_count, b, e] = *static_cast<const std::tuple<u32, KeyType, KeyType> *>(input);
-        return RangeQueryInner(segment_row_count, b, e);
+    SecondaryIndexInMemRange RangeQuery(const void *input) const override {
+        const auto &[b, e] = *static_cast<const Pair<KeyType, KeyType> *>(input);
+        SecondaryIndexInMemRange result;
+        auto runs = sorted_runs_.Snapshot();
+        for (const auto &run : *runs) {
+            const auto [begin, end] = run->Range(b, e);
+            if (begin < end) {
+                result.offset_spans_.emplace_back(run->offsets_.data() + begin, run->offsets_.data() + end);
+                result.count_ += end - begin;
+            }
+        }
+        result.snapshot_ = std::move(runs);
+        return result;
     }
 
 private:
     void InsertInner(auto &iter) {
-        std::unique_lock lock(map_mutex_);
+        Vector<Pair<KeyType, u32>> pairs;
         while (true) {
             auto opt = iter.Next();
             if (!opt.has_value()) {
                 break;
             }
             const auto &[v_ptr, offset] = opt.value();
-            const KeyType key = ConvertToOrderedKeyValue(*v_ptr);
-            in_mem_secondary_index_.emplace(key, offset);
-        }
-    }
-
-    Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQueryInner(const u32 segment_row_count, const KeyType b, const KeyType e) {
-        std::shared_lock lock(map_mutex_);
-        const auto begin = in_mem_secondary_index_.lower_bound(b);
-        const auto end = in_mem_secondary_index_.upper_bound(e);
-        const u32 result_size = std::distance(begin, end);
-        Pair<u32, std::variant<Vector<u32>, Bitmask>> result_var;
-        result_var.first = result_size;
-        // use array or bitmask for result
-        // use array when result_size <= 1024 or size of array (u32 type) <= size of bitmask
-        if (result_size <= 1024 or result_size <= std::bit_ceil(segment_row_count) / 32) {
-            auto &result = result_var.second.emplace<Vector<u32>>();
-            result.reserve(result_size);
-            for (auto it = begin; it != end; ++it) {
-                result.push_back(it->second);
-            }
-        } else {
-            auto &result = result_var.second.emplace<Bitmask>();
-            result.Initialize(segment_row_count);
-            result.SetAllFalse();
-            for (auto it = begin; it != end; ++it) {
-                result.SetTrue(it->second);
-            }
+            pairs.emplace_back(ConvertToOrderedKeyValue(*v_ptr), offset);
         }
-        return result_var;
+        sorted_runs_.Insert(pairs);
     }
 };
 
@@ -28,13 +28,25 @@ class ColumnDef;
 class ChunkIndexEntry;
 class SegmentIndexEntry;
 
+// The segment offsets of the rows in a key range of a snapshot of the in-memory index, later inserts do not change them.
+export struct SecondaryIndexInMemRange {
+    SharedPtr<const void> snapshot_;
+    // [begin, end) of the offsets in every run
+    Vector<Pair<const u32 *, const u32 *>> offset_spans_;
+    u32 count_ = 0;
+
+    // appends the offsets to the array, or sets them in the bitmask
+    void Output(std::variant<Vector<u32>, Bitmask> &selected_rows) const;
+};
+
 export class SecondaryIndexInMem {
 public:
     virtual ~SecondaryIndexInMem() = default;
     virtual u32 GetRowCount() const = 0;
     virtual void Insert(u16 block_id, BlockColumnEntry *block_column_entry, BufferManager *buffer_manager, u32 row_offset, u32 row_count) = 0;
     virtual SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr) = 0;
-    virtual Pair<u32, std::variant<Vector<u32>, Bitmask>> RangeQuery(const void *input) = 0;
+    // input: Pair<KeyType, KeyType> of the closed key range
+    virtual SecondaryIndexInMemRange RangeQuery(const void *input) const = 0;
 
     static SharedPtr<SecondaryIndexInMem> NewSecondaryIndexInMem(const SharedPtr<ColumnDef> &column_def, RowID begin_row_id, u32 max_size = 5 << 20);
 };
@@ -0,0 +1,129 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+
+export module secondary_index_sorted_run;
+
+import stl;
+
+namespace infinity {
+
+// (key, segment offset) pairs sorted by key and then by offset. Keys and offsets are in separate arrays, so that a key search only reads
+// the keys. A run is never modified after it is published.
+export template <typename KeyType>
+struct SecondaryIndexSortedRun {
+    Vector<KeyType> keys_;
+    Vector<u32> offsets_;
+
+    SizeT size() const { return keys_.size(); }
+
+    // [begin, end) positions of the keys in [b, e]
+    Pair<SizeT, SizeT> Range(const KeyType b, const KeyType e) const {
+        const auto begin = std::lower_bound(keys_.begin(), keys_.end(), b);
+        const auto end = std::upper_bound(begin, keys_.end(), e);
+        return {begin - keys_.begin(), end - keys_.begin()};
+    }
+
+    // the rows of newer have larger offsets than the rows of older, so the rows of equal keys stay ordered by offset
+    static SharedPtr<SecondaryIndexSortedRun> Merge(const SecondaryIndexSortedRun &older, const SecondaryIndexSortedRun &newer) {
+        auto merged = MakeShared<SecondaryIndexSortedRun>();
+        const SizeT older_n = older.size();
+        const SizeT newer_n = newer.size();
+        merged->keys_.resize(older_n + newer_n);
+        merged->offsets_.resize(older_n + newer_n);
+        SizeT i = 0, j = 0, k = 0;
+        while (i < older_n and j < newer_n) {
+            if (newer.keys_[j] < older.keys_[i]) {
+                merged->keys_[k] = newer.keys_[j];
+                merged->offsets_[k++] = newer.offsets_[j++];
+            } else {
+                merged->keys_[k] = older.keys_[i];
+                merged->offsets_[k++] = older.offsets_[i++];
+            }
+        }
+        std::copy(older.keys_.begin() + i, older.keys_.end(), merged->keys_.begin() + k);
+        std::copy(older.offsets_.begin() + i, older.offsets_.end(), merged->offsets_.begin() + k);
+        k += older_n - i;
+        std::copy(newer.keys_.begin() + j, newer.keys_.end(), merged->keys_.begin() + k);
+        std::copy(newer.offsets_.begin() + j, newer.offsets_.end(), merged->offsets_.begin() + k);
+        return merged;
+    }
+};
+
+// The in-memory part of a secondary index, a list of sorted runs from the oldest to the newest.
+// An insert sorts its rows into a new run, then merges the newest runs while the previous run is at most twice as large. So every run is
+// more than twice as large as the next one: there are O(log n) runs, and a row is merged O(log n) times.
+// Every insert publishes a new list. Readers take the current list without waiting for the writers, and it is not changed by later inserts.
+export template <typename KeyType>
+class SecondaryIndexSortedRuns {
+public:
+    using Run = SecondaryIndexSortedRun<KeyType>;
+    using RunList = Vector<SharedPtr<const Run>>;
+
+    SecondaryIndexSortedRuns() : runs_(MakeShared<const RunList>()) {}
+
+    // pairs of (key, segment offset), the offsets are larger than the offsets of the previous inserts
+    void Insert(Vector<Pair<KeyType, u32>> &pairs) {
+        if (pairs.empty()) {
+            return;
+        }
+        std::sort(pairs.begin(), pairs.end());
+        auto run = MakeShared<Run>();
+        run->keys_.reserve(pairs.size());
+        run->offsets_.reserve(pairs.size());
+        for (const auto &[key, offset] : pairs) {
+            run->keys_.push_back(key);
+            run->offsets_.push_back(offset);
+        }
+
+        std::unique_lock lock(insert_mutex_);
+        RunList runs = *Snapshot();
+        SharedPtr<const Run> newest = std::move(run);
+        while (!runs.empty() and runs.back()->size() <= 2 * newest->size()) {
+            newest = Run::Merge(*runs.back(), *newest);
+            runs.pop_back();
+        }
+        runs.push_back(std::move(newest));
+        std::atomic_store(&runs_, SharedPtr<const RunList>(MakeShared<const RunList>(std::move(runs))));
+        row_count_.fetch_add(pairs.size(), std::memory_order_relaxed);
+    }
+
+    SharedPtr<const RunList> Snapshot() const { return std::atomic_load(&runs_); }
+
+    u32 RowCount() const { return row_count_.load(std::memory_order_relaxed); }
+
+    // all rows of a snapshot in one run
+    static SharedPtr<const Run> MergeAll(const RunList &runs) {
+        if (runs.empty()) {
+            return MakeShared<const Run>();
+        }
+        SharedPtr<const Run> merged = runs.front();
+        for (SizeT i = 1; i < runs.size(); ++i) {
+            merged = Run::Merge(*merged, *runs[i]);
+        }
+        return merged;
+    }
+
+private:
+    std::mutex insert_mutex_;
+    SharedPtr<const RunList> runs_;
+    Atomic<u32> row_count_{0};
+};
+
+} // namespace infinity
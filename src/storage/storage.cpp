@@ -42,6 +42,7 @@ import status;
 import bg_task;
 import periodic_trigger_thread;
 import periodic_trigger;
+import file_scrubber;
 import log_file;
 
 import query_context;
@@ -62,7 +63,9 @@ void Storage::Init() {
                                       config_ptr_->WALDir(),
                                       config_ptr_->WALCompactThreshold(),
                                       config_ptr_->DeltaCheckpointThreshold(),
-                                      config_ptr_->FlushMethodAtCommit());
+                                      config_ptr_->FlushMethodAtCommit(),
+                                      config_ptr_->WALGroupCommitMaxWait(),
+                                      config_ptr_->ReplayWALThreadNum());
 
     // Must init catalog before txn manager.
     // Replay wal file wrap init catalog
@@ -132,6 +135,15 @@ void Storage::Init() {
             LOG_WARN("Cleanup interval is not set, auto cleanup task will not be triggered");
         }
 
+        std::chrono::seconds scrub_interval = static_cast<std::chrono::seconds>(config_ptr_->ScrubInterval());
+        if (scrub_interval.count() > 0) {
+            auto scrubber = MakeShared<FileScrubber>(buffer_mgr_.get(), scrub_interval);
+            periodic_trigger_thread_->AddTrigger(
+                MakeUnique<ScrubPeriodicTrigger>(bg_processor_.get(), std::move(scrubber), config_ptr_->ScrubIORateLimit()));
+        } else {
+            LOG_WARN("Scrub interval is not set, file checksums will only be verified on load");
+        }
+
         i64 full_checkpoint_interval_sec = config_ptr_->FullCheckpointInterval();
         if (full_checkpoint_interval_sec > 0) {
             periodic_trigger_thread_->AddTrigger(
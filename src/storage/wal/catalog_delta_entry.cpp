@@ -1008,7 +1008,26 @@ String CatalogDeltaEntry::ToString() const {
 
 void CatalogDeltaEntry::AddOperation(UniquePtr<CatalogDeltaOperation> operation) { operations_.emplace_back(std::move(operation)); }
 
-void GlobalCatalogDeltaEntry::InitFullCheckpointTs(TxnTimeStamp last_full_ckp_ts) { last_full_ckp_ts_ = last_full_ckp_ts; }
+void GlobalCatalogDeltaEntry::InitFullCheckpointTs(TxnTimeStamp last_full_ckp_ts) {
+    std::lock_guard<std::mutex> lock(catalog_delta_locker_);
+    last_full_ckp_ts_ = last_full_ckp_ts;
+    for (auto iter = table_update_ts_.begin(); iter != table_update_ts_.end();) {
+        if (iter->second <= last_full_ckp_ts) {
+            iter = table_update_ts_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+HashSet<String> GlobalCatalogDeltaEntry::ChangedTables() const {
+    std::lock_guard<std::mutex> lock(catalog_delta_locker_);
+    HashSet<String> changed_tables;
+    for (const auto &[table_encode, update_ts] : table_update_ts_) {
+        changed_tables.insert(table_encode);
+    }
+    return changed_tables;
+}
 
 void GlobalCatalogDeltaEntry::AddDeltaEntry(UniquePtr<CatalogDeltaEntry> delta_entry, i64 wal_size) {
     // {
@@ -1109,6 +1128,12 @@ void GlobalCatalogDeltaEntry::AddDeltaEntryInner(CatalogDeltaEntry *delta_entry)
         if (encode.empty()) {
             UnrecoverableError("encode is empty");
         }
+        if (new_op->type_ != CatalogDeltaOpType::ADD_DATABASE_ENTRY) {
+            // "#db#table" is the prefix of the encodes of all entries under a table
+            SizeT table_end = encode.find('#', encode.find('#', 1) + 1);
+            TxnTimeStamp &update_ts = table_update_ts_[encode.substr(0, table_end)];
+            update_ts = std::max(update_ts, new_op->commit_ts_);
+        }
         auto iter = delta_ops_.find(encode);
         bool found = iter != delta_ops_.end();
         if (found) {
@@ -380,6 +380,9 @@ public:
 
     SizeT OpSize() const;
 
+    // Encodes of the tables changed by the operations since the last full checkpoint.
+    HashSet<String> ChangedTables() const;
+
 private:
     void AddDeltaEntryInner(CatalogDeltaEntry *delta_entry);
 
@@ -397,6 +400,9 @@ private:
     TxnTimeStamp last_full_ckp_ts_{0};
     i64 wal_size_{};
 
+    // max commit ts of the operations on each table, the tables are kept until a full checkpoint covers them
+    HashMap<String, TxnTimeStamp> table_update_ts_;
+
     mutable std::mutex catalog_delta_locker_{};
 };
 
@@ -14,6 +14,7 @@
 
 module;
 
+#include <exception>
 #include <fstream>
 #include <vector>
 
@@ -855,6 +856,61 @@ SharedPtr<WalEntry> WalEntryIterator::Next() {
     }
 }
 
+Vector<SharedPtr<WalEntry>> WalEntryIterator::NextBatch(SizeT max_count, SizeT thread_num) {
+    // Walking the size trailers is cheap, so only the decoding is parallel.
+    Vector<Pair<char *, i32>> frames;
+    while (frames.size() < max_count && end_ > buf_.data()) {
+        i32 entry_size;
+        std::memcpy(&entry_size, end_ - sizeof(i32), sizeof(entry_size));
+        if (entry_size <= 0 || entry_size > end_ - buf_.data()) {
+            end_ = buf_.data();
+            break;
+        }
+        end_ = end_ - entry_size;
+        frames.emplace_back(end_, entry_size);
+    }
+
+    Vector<SharedPtr<WalEntry>> entries(frames.size());
+    Atomic<SizeT> next_idx = 0;
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto Decode = [&]() {
+        try {
+            for (SizeT idx = next_idx.fetch_add(1); idx < frames.size(); idx = next_idx.fetch_add(1)) {
+                char *ptr = frames[idx].first;
+                entries[idx] = WalEntry::ReadAdv(ptr, frames[idx].second);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            exception = std::current_exception();
+        }
+    };
+    thread_num = std::min(thread_num, frames.size());
+    if (thread_num <= 1) {
+        Decode();
+    } else {
+        Vector<Thread> threads;
+        for (SizeT i = 0; i < thread_num; ++i) {
+            threads.emplace_back(Decode);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    for (SizeT idx = 0; idx < entries.size(); ++idx) {
+        if (entries[idx].get() == nullptr) {
+            entries.resize(idx);
+            end_ = buf_.data();
+            break;
+        }
+    }
+    return entries;
+}
+
 SharedPtr<WalEntry> WalListIterator::Next() {
     if (iter_.get() != nullptr) {
         SharedPtr<WalEntry> entry = iter_->Next();
@@ -873,4 +929,20 @@ SharedPtr<WalEntry> WalListIterator::Next() {
     }
 }
 
+Vector<SharedPtr<WalEntry>> WalListIterator::NextBatch(SizeT max_count, SizeT thread_num) {
+    while (true) {
+        if (iter_.get() != nullptr) {
+            Vector<SharedPtr<WalEntry>> entries = iter_->NextBatch(max_count, thread_num);
+            if (!entries.empty()) {
+                return entries;
+            }
+        }
+        if (wal_deque_.empty()) {
+            return {};
+        }
+        iter_ = MakeUnique<WalEntryIterator>(WalEntryIterator::Make(wal_deque_.front()));
+        wal_deque_.pop_front();
+    }
+}
+
 } // namespace infinity
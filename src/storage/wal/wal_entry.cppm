@@ -394,6 +394,10 @@ public:
 
     [[nodiscard]] SharedPtr<WalEntry> Next();
 
+    // Same order as Next, but at most `max_count` entries are located by their size trailers and decoded by `thread_num`
+    // threads. Stop before the first entry that fails to decode, and the iterator ends there as Next would.
+    [[nodiscard]] Vector<SharedPtr<WalEntry>> NextBatch(SizeT max_count, SizeT thread_num);
+
 private:
     WalEntryIterator(Vector<char> &&buf, std::streamsize wal_size) : buf_(std::move(buf)), wal_size_(wal_size) { end_ = buf_.data() + wal_size_; }
 
@@ -412,6 +416,9 @@ public:
 
     [[nodiscard]] SharedPtr<WalEntry> Next();
 
+    // The entries of a batch are from the same file. Return empty when all files are consumed.
+    [[nodiscard]] Vector<SharedPtr<WalEntry>> NextBatch(SizeT max_count, SizeT thread_num);
+
 private:
     Deque<String> wal_deque_{};
     UniquePtr<WalEntryIterator> iter_{};
@@ -14,8 +14,8 @@
 
 module;
 
+#include <exception>
 #include <filesystem>
-#include <fstream>
 #include <thread>
 
 import stl;
@@ -54,17 +54,58 @@ import default_values;
 import defer_op;
 import index_base;
 import base_table_ref;
+import file_system;
+import file_system_type;
 
 module wal_manager;
 
 namespace infinity {
 
+namespace {
+
+constexpr SizeT REPLAY_DECODE_BATCH_SIZE = 1024;
+
+// Data commands only touch the table they name, so the commands on different tables can be replayed at the same time.
+// Return false for the commands that change the catalog, they are replayed alone.
+bool ReplayTableKey(const WalCmd &cmd, String &table_key) {
+    switch (cmd.GetType()) {
+        case WalCommandType::APPEND: {
+            const auto &append_cmd = static_cast<const WalCmdAppend &>(cmd);
+            table_key = fmt::format("#{}#{}", append_cmd.db_name_, append_cmd.table_name_);
+            return true;
+        }
+        case WalCommandType::DELETE: {
+            const auto &delete_cmd = static_cast<const WalCmdDelete &>(cmd);
+            table_key = fmt::format("#{}#{}", delete_cmd.db_name_, delete_cmd.table_name_);
+            return true;
+        }
+        case WalCommandType::IMPORT: {
+            const auto &import_cmd = static_cast<const WalCmdImport &>(cmd);
+            table_key = fmt::format("#{}#{}", import_cmd.db_name_, import_cmd.table_name_);
+            return true;
+        }
+        case WalCommandType::COMPACT: {
+            const auto &compact_cmd = static_cast<const WalCmdCompact &>(cmd);
+            table_key = fmt::format("#{}#{}", compact_cmd.db_name_, compact_cmd.table_name_);
+            return true;
+        }
+        default: {
+            return false;
+        }
+    }
+}
+
+} // namespace
+
 WalManager::WalManager(Storage *storage,
                        String wal_dir,
                        u64 wal_size_threshold,
                        u64 delta_checkpoint_interval_wal_bytes,
-                       FlushOptionType flush_option)
-    : cfg_wal_size_threshold_(wal_size_threshold), cfg_delta_checkpoint_interval_wal_bytes_(delta_checkpoint_interval_wal_bytes), wal_dir_(wal_dir),
+                       FlushOptionType flush_option,
+                       i64 group_commit_max_wait,
+                       SizeT replay_thread_num)
+    : cfg_wal_size_threshold_(wal_size_threshold), cfg_delta_checkpoint_interval_wal_bytes_(delta_checkpoint_interval_wal_bytes),
+      cfg_replay_thread_num_(std::max(replay_thread_num, SizeT(1))), cfg_group_commit_max_wait_(group_commit_max_wait), wal_dir_(wal_dir),
       wal_path_(wal_dir + "/" + WalFile::TempWalFilename()), storage_(storage), running_(false), flush_option_(flush_option), last_ckp_wal_size_(0),
       checkpoint_in_progress_(false), last_ckp_ts_(UNCOMMIT_TS), last_full_ckp_ts_(UNCOMMIT_TS) {}
 
@@ -85,13 +126,10 @@ void WalManager::Start() {
         fs.CreateDirectory(wal_dir_);
     }
     // TODO: recovery from wal checkpoint
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        UnrecoverableError(fmt::format("Failed to open wal file: {}", wal_path_));
-    }
-    LOG_INFO(fmt::format("Open wal file: {}", wal_path_));
+    OpenWalFile();
 
     wal_size_ = 0;
+    last_sync_time_ = Clock::now();
     flush_thread_ = Thread([this] { Flush(); });
     // checkpoint_thread_ = Thread([this] { CheckpointTimer(); });
     LOG_INFO("WAL manager is started.");
@@ -119,7 +157,7 @@ void WalManager::Stop() {
     LOG_TRACE("WalManager::Stop flush thread join");
     flush_thread_.join();
 
-    ofs_.close();
+    CloseWalFile();
     LOG_INFO("WAL manager is stopped.");
 }
 
@@ -153,19 +191,43 @@ TxnTimeStamp WalManager::GetCheckpointedTS() { return last_ckp_ts_ == UNCOMMIT_T
 // wal and do parallel committing. Each sync cost ~1s. Each checkpoint cost
 // ~10s. So it's necessary to sync for a batch of transactions, and to
 // checkpoint for a batch of sync.
+// With flush_at_once, a batch shares one fdatasync (group commit): the commits that arrive during a sync form the next
+// batch, and the flush may wait up to wal_group_commit_max_wait for more commits to join before it syncs.
 void WalManager::Flush() {
     LOG_TRACE("WalManager::Flush log mainloop begin");
 
     Deque<WalEntry *> log_batch{};
     TxnManager *txn_mgr = storage_->txn_manager();
     while (running_.load()) {
-        wait_flush_.DequeueBulk(log_batch);
+        if (flush_option_ == FlushOptionType::kFlushPerSecond && wal_file_synced_size_ < wal_file_size_) {
+            // the written entries are synced within a second even if no more commits come
+            auto now = Clock::now();
+            auto next_sync_time = last_sync_time_ + Seconds(1);
+            if (now >= next_sync_time ||
+                !wait_flush_.DequeueBulkFor(log_batch, std::chrono::duration_cast<MicroSeconds>(next_sync_time - now))) {
+                SyncWalFile();
+                continue;
+            }
+        } else {
+            wait_flush_.DequeueBulk(log_batch);
+        }
         if (log_batch.empty()) {
             LOG_WARN("WalManager::Dequeue empty batch logs");
             continue;
         }
+        if (flush_option_ == FlushOptionType::kFlushAtOnce && cfg_group_commit_max_wait_.count() > 0) {
+            auto deadline = Clock::now() + cfg_group_commit_max_wait_;
+            while (log_batch.back() != nullptr) {
+                auto now = Clock::now();
+                if (now >= deadline ||
+                    !wait_flush_.DequeueBulkFor(log_batch, std::chrono::duration_cast<MicroSeconds>(deadline - now))) {
+                    break;
+                }
+            }
+        }
         // auto [max_commit_ts, wal_size] = GetWalState();
 
+        batch_buf_.clear();
         for (const auto &entry : log_batch) {
             // Empty WalEntry (read-only transactions) shouldn't go into WalManager.
             if (entry == nullptr) {
@@ -180,14 +242,15 @@ void WalManager::Flush() {
             }
 
             i32 exp_size = entry->GetSizeInBytes();
-            Vector<char> buf(exp_size);
-            char *ptr = buf.data();
+            SizeT offset = batch_buf_.size();
+            batch_buf_.resize(offset + exp_size);
+            char *ptr = batch_buf_.data() + offset;
             entry->WriteAdv(ptr);
-            i32 act_size = ptr - buf.data();
+            i32 act_size = ptr - (batch_buf_.data() + offset);
             if (exp_size != act_size) {
                 UnrecoverableError(fmt::format("WalManager::Flush WalEntry estimated size {} differ with the actual one {}", exp_size, act_size));
             }
-            ofs_.write(buf.data(), ptr - buf.data());
+            batch_buf_.resize(offset + act_size);
             LOG_TRACE(fmt::format("WalManager::Flush done writing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
 
             // update
@@ -195,21 +258,23 @@ void WalManager::Flush() {
             wal_size_ += act_size;
         }
 
+        WriteWalFile(batch_buf_.data(), batch_buf_.size());
         if (!running_.load()) {
             break;
         }
 
         switch (flush_option_) {
             case FlushOptionType::kFlushAtOnce: {
-                ofs_.flush();
+                SyncWalFile();
                 break;
             }
             case FlushOptionType::kOnlyWrite: {
-                ofs_.flush(); // FIXME: not flush, only write
                 break;
             }
             case FlushOptionType::kFlushPerSecond: {
-                ofs_.flush(); // FIXME: not flush, flush per second
+                if (Clock::now() - last_sync_time_ >= Seconds(1)) {
+                    SyncWalFile();
+                }
                 break;
             }
         }
@@ -224,9 +289,7 @@ void WalManager::Flush() {
 
         // Check if the wal file is too large, swap to a new one.
         try {
-            LocalFileSystem fs;
-            auto file_size = fs.GetFileSizeByPath(wal_path_);
-            if (file_size > cfg_wal_size_threshold_) {
+            if (wal_file_size_ > i64(cfg_wal_size_threshold_)) {
                 this->SwapWalFile(max_commit_ts_);
             }
         } catch (RecoverableException &e) {
@@ -250,6 +313,57 @@ void WalManager::Flush() {
     LOG_TRACE("WalManager::Flush mainloop end");
 }
 
+void WalManager::OpenWalFile() {
+    LocalFileSystem fs;
+    wal_file_handler_ = fs.OpenFile(wal_path_, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kNoLock);
+    wal_file_size_ = i64(fs.GetFileSize(*wal_file_handler_));
+    wal_file_synced_size_ = wal_file_size_;
+    wal_file_preallocated_ = wal_file_size_;
+    LOG_INFO(fmt::format("Open wal file: {}", wal_path_));
+}
+
+void WalManager::CloseWalFile() {
+    if (wal_file_handler_.get() == nullptr) {
+        return;
+    }
+    LocalFileSystem fs;
+    if (wal_file_preallocated_ > wal_file_size_) {
+        // release the reserved blocks beyond the end
+        fs.Truncate(*wal_file_handler_, wal_file_size_);
+    }
+    // whatever the flush option, the entries of a closed wal file are on disk
+    fs.DataSyncFile(*wal_file_handler_);
+    fs.Close(*wal_file_handler_);
+    wal_file_handler_.reset();
+}
+
+// The blocks are reserved ahead without changing the file size, since replay reads the entries backward from the end of
+// the file. So an append only changes the size of the file instead of allocating blocks.
+void WalManager::WriteWalFile(const char *data, SizeT size) {
+    if (size == 0) {
+        return;
+    }
+    LocalFileSystem fs;
+    if (preallocate_supported_ && wal_file_size_ + i64(size) > wal_file_preallocated_) {
+        i64 preallocate_size = std::max(std::min(i64(cfg_wal_size_threshold_), WAL_PREALLOCATE_SIZE), i64(size));
+        if (fs.Preallocate(*wal_file_handler_, wal_file_size_, preallocate_size)) {
+            wal_file_preallocated_ = wal_file_size_ + preallocate_size;
+        } else {
+            preallocate_supported_ = false;
+        }
+    }
+    fs.WriteAt(*wal_file_handler_, wal_file_size_, data, size);
+    wal_file_size_ += size;
+}
+
+void WalManager::SyncWalFile() {
+    LocalFileSystem fs;
+    fs.DataSyncFile(*wal_file_handler_);
+    wal_file_synced_size_ = wal_file_size_;
+    last_sync_time_ = Clock::now();
+    sync_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
 bool WalManager::TrySubmitCheckpointTask(SharedPtr<CheckpointTaskBase> ckp_task) {
     bool expect = false;
     if (checkpoint_in_progress_.compare_exchange_strong(expect, true)) {
@@ -342,9 +456,7 @@ void WalManager::CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp
  * current wal file.
  */
 void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts) {
-    if (ofs_.is_open()) {
-        ofs_.close();
-    }
+    CloseWalFile();
 
     String new_file_path = fmt::format("{}/{}", wal_dir_, WalFile::WalFilename(max_commit_ts));
     LOG_INFO(fmt::format("Wal {} swap to new path: {}", wal_path_, new_file_path));
@@ -354,11 +466,7 @@ void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts) {
     fs.Rename(wal_path_, new_file_path);
 
     // Create a new wal file with the original name.
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        UnrecoverableError(fmt::format("Failed to open wal file: {}", wal_path_));
-    }
-    LOG_INFO(fmt::format("Open new wal file {}", wal_path_));
+    OpenWalFile();
 }
 
 String WalManager::GetWalFilename() const {
@@ -441,41 +549,38 @@ i64 WalManager::ReplayWalFile() {
 
     { // if no checkpoint, max_commit_ts is 0
         WalListIterator iterator(wal_list);
+        // The entries are decoded in batches in parallel, each batch is scanned in the order of the wal, newest first.
         // phase 1: find the max commit ts and catalog path
-        LOG_INFO("Replay phase 1: find the max commit ts and catalog path");
-        while (true) {
-            auto wal_entry = iterator.Next();
-            if (wal_entry.get() == nullptr) {
-                break;
-            }
-
-            LOG_TRACE(wal_entry->ToString());
-
-            WalCmdCheckpoint *checkpoint_cmd = nullptr;
-            if (wal_entry->IsCheckPoint(replay_entries, checkpoint_cmd)) {
-                max_commit_ts = checkpoint_cmd->max_commit_ts_;
-                catalog_dir = Path(checkpoint_cmd->catalog_path_).parent_path().string();
-                system_start_ts = wal_entry->commit_ts_;
-                break;
-            }
-            replay_entries.push_back(wal_entry);
-        }
-        LOG_INFO(fmt::format("Find checkpoint max commit ts: {}", max_commit_ts));
-
         // phase 2: by the max commit ts, find the entries to replay
-        LOG_INFO("Replay phase 2: by the max commit ts, find the entries to replay");
-        while (true) {
-            auto wal_entry = iterator.Next();
-            if (wal_entry.get() == nullptr) {
+        LOG_INFO("Replay phase 1: find the max commit ts and catalog path");
+        bool checkpoint_found = false;
+        bool scan_end = false;
+        while (!scan_end) {
+            Vector<SharedPtr<WalEntry>> wal_entries = iterator.NextBatch(REPLAY_DECODE_BATCH_SIZE, cfg_replay_thread_num_);
+            if (wal_entries.empty()) {
                 break;
             }
-
-            LOG_TRACE(wal_entry->ToString());
-
-            if (wal_entry->commit_ts_ > max_commit_ts) {
-                replay_entries.push_back(wal_entry);
-            } else {
-                break;
+            for (auto &wal_entry : wal_entries) {
+                LOG_TRACE(wal_entry->ToString());
+
+                if (!checkpoint_found) {
+                    WalCmdCheckpoint *checkpoint_cmd = nullptr;
+                    if (wal_entry->IsCheckPoint(replay_entries, checkpoint_cmd)) {
+                        max_commit_ts = checkpoint_cmd->max_commit_ts_;
+                        catalog_dir = Path(checkpoint_cmd->catalog_path_).parent_path().string();
+                        system_start_ts = wal_entry->commit_ts_;
+                        checkpoint_found = true;
+                        LOG_INFO(fmt::format("Find checkpoint max commit ts: {}", max_commit_ts));
+                        LOG_INFO("Replay phase 2: by the max commit ts, find the entries to replay");
+                        continue;
+                    }
+                    replay_entries.push_back(std::move(wal_entry));
+                } else if (wal_entry->commit_ts_ > max_commit_ts) {
+                    replay_entries.push_back(std::move(wal_entry));
+                } else {
+                    scan_end = true;
+                    break;
+                }
             }
         }
     }
@@ -503,10 +608,8 @@ i64 WalManager::ReplayWalFile() {
         }
         system_start_ts = replay_entries[replay_count]->commit_ts_;
         last_txn_id = replay_entries[replay_count]->txn_id_;
-
-        LOG_TRACE(replay_entries[replay_count]->ToString());
-        ReplayWalEntry(*replay_entries[replay_count]);
     }
+    ReplayWalEntries(replay_entries);
 
     LOG_INFO(fmt::format("System start ts: {}, lastest txn id: {}", system_start_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -519,69 +622,148 @@ i64 WalManager::ReplayWalFile() {
 
 void WalManager::ReplayWalEntry(const WalEntry &entry) {
     for (const auto &cmd : entry.cmds_) {
-        LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd->GetType()).c_str(), entry.commit_ts_));
-        switch (cmd->GetType()) {
-            case WalCommandType::CREATE_DATABASE: {
-                WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_DATABASE: {
-                WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::CREATE_TABLE: {
-                WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_TABLE: {
-                WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::ALTER_INFO: {
-                Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
-                LOG_ERROR(status.message());
-                RecoverableError(status);
-                break;
-            }
-            case WalCommandType::CREATE_INDEX: {
-                WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DROP_INDEX: {
-                WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::IMPORT: {
-                WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::APPEND: {
-                WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            case WalCommandType::DELETE: {
-                WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
-            }
-            // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
-            //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(cmd.get()), entry.txn_id_,
-            //     entry.commit_ts_); break;
-            // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
-            //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(cmd.get()),
-            //                                              entry.txn_id_,
-            //                                              entry.commit_ts_);
-            //     break;
-            case WalCommandType::CHECKPOINT: {
-                break;
+        ReplayWalCmd(*cmd, entry.txn_id_, entry.commit_ts_);
+    }
+}
+
+void WalManager::ReplayWalCmd(const WalCmd &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
+    LOG_TRACE(fmt::format("Replay wal cmd: {}, commit ts: {}", WalCmd::WalCommandTypeToString(cmd.GetType()).c_str(), commit_ts));
+    switch (cmd.GetType()) {
+        case WalCommandType::CREATE_DATABASE: {
+            WalCmdCreateDatabaseReplay(*dynamic_cast<const WalCmdCreateDatabase *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_DATABASE: {
+            WalCmdDropDatabaseReplay(*dynamic_cast<const WalCmdDropDatabase *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::CREATE_TABLE: {
+            WalCmdCreateTableReplay(*dynamic_cast<const WalCmdCreateTable *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_TABLE: {
+            WalCmdDropTableReplay(*dynamic_cast<const WalCmdDropTable *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::ALTER_INFO: {
+            Status status = Status::NotSupport("WalCmdAlterInfo Replay Not implemented");
+            LOG_ERROR(status.message());
+            RecoverableError(status);
+            break;
+        }
+        case WalCommandType::CREATE_INDEX: {
+            WalCmdCreateIndexReplay(*dynamic_cast<const WalCmdCreateIndex *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DROP_INDEX: {
+            WalCmdDropIndexReplay(*dynamic_cast<const WalCmdDropIndex *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::IMPORT: {
+            WalCmdImportReplay(*dynamic_cast<const WalCmdImport *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::APPEND: {
+            WalCmdAppendReplay(*dynamic_cast<const WalCmdAppend *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        case WalCommandType::DELETE: {
+            WalCmdDeleteReplay(*dynamic_cast<const WalCmdDelete *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        // case WalCommandType::SET_SEGMENT_STATUS_SEALED:
+        //     WalCmdSetSegmentStatusSealedReplay(*dynamic_cast<const WalCmdSetSegmentStatusSealed *>(&cmd), txn_id,
+        //     commit_ts); break;
+        // case WalCommandType::UPDATE_SEGMENT_BLOOM_FILTER_DATA:
+        //     WalCmdUpdateSegmentBloomFilterDataReplay(*dynamic_cast<const WalCmdUpdateSegmentBloomFilterData *>(&cmd),
+        //                                              txn_id,
+        //                                              commit_ts);
+        //     break;
+        case WalCommandType::CHECKPOINT: {
+            break;
+        }
+        case WalCommandType::COMPACT: {
+            WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(&cmd), txn_id, commit_ts);
+            break;
+        }
+        default: {
+            UnrecoverableError("WalManager::ReplayWalCmd unknown wal command type");
+        }
+    }
+}
+
+// Between two catalog commands, the data commands are grouped by table. The tables are replayed by the replay threads,
+// and the commands of a table are replayed by one thread in the order of the wal.
+void WalManager::ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries) {
+    Vector<Vector<Tuple<const WalCmd *, TransactionID, TxnTimeStamp>>> table_cmds;
+    HashMap<String, SizeT> table_idx;
+    SizeT catalog_cmd_count = 0;
+    SizeT table_group_count = 0;
+    auto FlushTableCmds = [&]() {
+        if (table_cmds.empty()) {
+            return;
+        }
+        ReplayTableCmds(table_cmds);
+        table_group_count += table_cmds.size();
+        table_cmds.clear();
+        table_idx.clear();
+    };
+
+    for (const auto &entry : replay_entries) {
+        LOG_TRACE(entry->ToString());
+        for (const auto &cmd : entry->cmds_) {
+            String table_key;
+            if (!ReplayTableKey(*cmd, table_key)) {
+                FlushTableCmds();
+                ReplayWalCmd(*cmd, entry->txn_id_, entry->commit_ts_);
+                ++catalog_cmd_count;
+                continue;
             }
-            case WalCommandType::COMPACT: {
-                WalCmdCompactReplay(*static_cast<const WalCmdCompact *>(cmd.get()), entry.txn_id_, entry.commit_ts_);
-                break;
+            auto [iter, inserted] = table_idx.emplace(std::move(table_key), table_cmds.size());
+            if (inserted) {
+                table_cmds.emplace_back();
             }
-            default: {
-                UnrecoverableError("WalManager::ReplayWalEntry unknown wal command type");
+            table_cmds[iter->second].emplace_back(cmd.get(), entry->txn_id_, entry->commit_ts_);
+        }
+    }
+    FlushTableCmds();
+    LOG_INFO(fmt::format("Replayed {} catalog commands, {} groups of table commands with {} threads",
+                         catalog_cmd_count,
+                         table_group_count,
+                         cfg_replay_thread_num_));
+}
+
+void WalManager::ReplayTableCmds(const Vector<Vector<Tuple<const WalCmd *, TransactionID, TxnTimeStamp>>> &table_cmds) {
+    Atomic<SizeT> next_idx = 0;
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto ReplayTables = [&]() {
+        try {
+            for (SizeT idx = next_idx.fetch_add(1); idx < table_cmds.size(); idx = next_idx.fetch_add(1)) {
+                for (const auto &[cmd, txn_id, commit_ts] : table_cmds[idx]) {
+                    ReplayWalCmd(*cmd, txn_id, commit_ts);
+                }
             }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            exception = std::current_exception();
         }
+    };
+
+    SizeT thread_num = std::min(cfg_replay_thread_num_, table_cmds.size());
+    if (thread_num <= 1) {
+        ReplayTables();
+    } else {
+        Vector<Thread> threads;
+        for (SizeT i = 0; i < thread_num; ++i) {
+            threads.emplace_back(ReplayTables);
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
     }
 }
 
@@ -22,6 +22,7 @@ import wal_entry;
 import options;
 import catalog_delta_entry;
 import blocking_queue;
+import file_system;
 
 namespace infinity {
 
@@ -33,7 +34,13 @@ class SegmentEntry;
 
 export class WalManager {
 public:
-    WalManager(Storage *storage, String wal_dir, u64 wal_size_threshold, u64 delta_checkpoint_interval_wal_bytes, FlushOptionType flush_option);
+    WalManager(Storage *storage,
+               String wal_dir,
+               u64 wal_size_threshold,
+               u64 delta_checkpoint_interval_wal_bytes,
+               FlushOptionType flush_option,
+               i64 group_commit_max_wait = 0,
+               SizeT replay_thread_num = 1);
 
     ~WalManager();
 
@@ -65,6 +72,8 @@ public:
 
     void ReplayWalEntry(const WalEntry &entry);
 
+    void ReplayWalCmd(const WalCmd &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
+
     void RecycleWalFile(TxnTimeStamp full_ckp_ts);
 
     // Should only call in `Flush` thread
@@ -74,12 +83,29 @@ public:
 
     TxnTimeStamp GetCheckpointedTS();
 
+    // The number of fdatasync of the flush thread, a sync is shared by a batch of commits
+    u64 SyncCount() const { return sync_count_.load(std::memory_order_relaxed); }
+
 private:
     // Checkpoint Helper
     void CheckpointInner(bool is_full_checkpoint, Txn *txn, TxnTimeStamp max_commit_ts, i64 wal_size);
 
     void SetLastCkpWalSize(i64 wal_size);
 
+    // Wal file helper, only called in `Flush` thread after `Start`
+    void OpenWalFile();
+
+    void CloseWalFile();
+
+    void WriteWalFile(const char *data, SizeT size);
+
+    void SyncWalFile();
+
+    // Replay helper
+    void ReplayWalEntries(const Vector<SharedPtr<WalEntry>> &replay_entries);
+
+    void ReplayTableCmds(const Vector<Vector<Tuple<const WalCmd *, TransactionID, TxnTimeStamp>>> &table_cmds);
+
     void WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdDropDatabaseReplay(const WalCmdDropDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
     void WalCmdCreateTableReplay(const WalCmdCreateTable &cmd, TransactionID txn_id, TxnTimeStamp commit_ts);
@@ -100,6 +126,8 @@ private:
 public:
     u64 cfg_wal_size_threshold_{};
     u64 cfg_delta_checkpoint_interval_wal_bytes_{};
+    SizeT cfg_replay_thread_num_{};
+    MicroSeconds cfg_group_commit_max_wait_{};
 
 private:
     // Concurrent writing WAL is disallowed. So put all WAL writing into a queue
@@ -117,10 +145,20 @@ private:
     BlockingQueue<WalEntry *> wait_flush_{};
 
     // Only Flush thread access following members
-    std::ofstream ofs_{};
+    UniquePtr<FileHandler> wal_file_handler_{};
+    i64 wal_file_size_{};
+    // the wal file is synced up to here
+    i64 wal_file_synced_size_{};
+    // blocks of the wal file are reserved up to here
+    i64 wal_file_preallocated_{};
+    bool preallocate_supported_{true};
+    // the serialized entries of a batch, written with one write
+    Vector<char> batch_buf_{};
+    TimePoint<Clock> last_sync_time_{};
     TxnTimeStamp max_commit_ts_{};
     i64 wal_size_{};
     FlushOptionType flush_option_{FlushOptionType::kOnlyWrite};
+    Atomic<u64> sync_count_{0};
 
     // Flush and Checkpoint threads access following members
     mutable std::mutex mutex2_{};
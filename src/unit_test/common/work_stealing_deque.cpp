@@ -0,0 +1,91 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import work_stealing_deque;
+
+class WorkStealingDequeTest : public BaseTest {};
+
+TEST_F(WorkStealingDequeTest, test1) {
+    using namespace infinity;
+    WorkStealingDeque<u64> deque(4);
+    EXPECT_TRUE(deque.Empty());
+
+    // Grow beyond initial capacity
+    for (u64 i = 0; i < 10; ++i) {
+        deque.Push(i);
+    }
+    EXPECT_EQ(deque.Size(), 10u);
+
+    u64 item = 0;
+    // Steal from the top is FIFO
+    EXPECT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, 0u);
+    // Pop from the bottom is LIFO
+    EXPECT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, 9u);
+    EXPECT_EQ(deque.Size(), 8u);
+
+    while (deque.Pop(item)) {
+    }
+    EXPECT_TRUE(deque.Empty());
+    EXPECT_FALSE(deque.Steal(item));
+}
+
+TEST_F(WorkStealingDequeTest, test2) {
+    using namespace infinity;
+    constexpr u64 item_count = 100000;
+    constexpr SizeT thief_count = 4;
+    WorkStealingDeque<u64> deque(64);
+    Atomic<bool> owner_done{false};
+    Vector<Vector<u64>> thief_items(thief_count);
+
+    Vector<Thread> thieves;
+    for (SizeT thief_id = 0; thief_id < thief_count; ++thief_id) {
+        thieves.emplace_back([&, thief_id] {
+            u64 item = 0;
+            while (!owner_done || !deque.Empty()) {
+                if (deque.Steal(item)) {
+                    thief_items[thief_id].push_back(item);
+                }
+            }
+        });
+    }
+
+    Vector<u64> owner_items;
+    for (u64 i = 0; i < item_count; ++i) {
+        deque.Push(i);
+        u64 item = 0;
+        if (i % 3 == 0 && deque.Pop(item)) {
+            owner_items.push_back(item);
+        }
+    }
+    owner_done = true;
+    for (auto &thief : thieves) {
+        thief.join();
+    }
+
+    // Every item is taken exactly once
+    Vector<u64> all_items = owner_items;
+    for (const auto &items : thief_items) {
+        all_items.insert(all_items.end(), items.begin(), items.end());
+    }
+    std::sort(all_items.begin(), all_items.end());
+    ASSERT_EQ(all_items.size(), item_count);
+    for (u64 i = 0; i < item_count; ++i) {
+        EXPECT_EQ(all_items[i], i);
+    }
+}
@@ -0,0 +1,177 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import external_sort;
+import column_vector;
+import data_block;
+import data_type;
+import logical_type;
+import internal_types;
+import select_statement;
+import value;
+import default_values;
+
+using namespace infinity;
+
+class SortKeysTest : public BaseTest {
+protected:
+    static SharedPtr<ColumnVector> MakeColumn(LogicalType type, const Vector<Value> &values) {
+        auto column = MakeShared<ColumnVector>(MakeShared<DataType>(type));
+        column->Initialize();
+        for (const auto &value : values) {
+            column->AppendValue(value);
+        }
+        return column;
+    }
+
+    // The rows in the order of their keys, rows with equal keys in their order.
+    static Vector<SizeT> SortedRows(const SortKeys &keys) {
+        Vector<SizeT> rows;
+        for (SizeT row = 0; row < keys.row_count(); ++row) {
+            rows.push_back(row);
+        }
+        std::sort(rows.begin(), rows.end(), [&](SizeT a, SizeT b) {
+            int cmp = keys.Key(a).compare(keys.Key(b));
+            return cmp != 0 ? cmp < 0 : a < b;
+        });
+        return rows;
+    }
+};
+
+TEST_F(SortKeysTest, integer_with_nulls) {
+    auto column = MakeColumn(LogicalType::kInteger,
+                             {Value::MakeInt(5), Value::MakeInt(-3), Value::MakeInt(0), Value::MakeInt(0), Value::MakeInt(-100), Value::MakeInt(7)});
+    column->nulls_ptr_->SetFalse(3);
+
+    SortKeys keys;
+    keys.Build({column}, {OrderType::kAsc}, 6);
+    EXPECT_EQ(SortedRows(keys), (Vector<SizeT>{3, 4, 1, 2, 0, 5}));
+
+    // a null is the smallest value, so it comes last in descending order
+    keys.Build({column}, {OrderType::kDesc}, 6);
+    EXPECT_EQ(SortedRows(keys), (Vector<SizeT>{5, 0, 2, 1, 4, 3}));
+}
+
+TEST_F(SortKeysTest, double_desc) {
+    auto column = MakeColumn(
+        LogicalType::kDouble,
+        {Value::MakeDouble(1.5), Value::MakeDouble(-2.0), Value::MakeDouble(-0.0), Value::MakeDouble(0.0), Value::MakeDouble(1e300), Value::MakeDouble(-1e-300)});
+
+    SortKeys keys;
+    keys.Build({column}, {OrderType::kDesc}, 6);
+    EXPECT_EQ(keys.Key(2), keys.Key(3));
+    EXPECT_EQ(SortedRows(keys), (Vector<SizeT>{4, 0, 2, 3, 5, 1}));
+}
+
+TEST_F(SortKeysTest, varchar_then_integer) {
+    auto varchars = MakeColumn(LogicalType::kVarchar,
+                               {Value::MakeVarchar("ab"),
+                                Value::MakeVarchar("a"),
+                                Value::MakeVarchar("abcdefghijklmnopqrstuvwxyz"),
+                                Value::MakeVarchar(std::string_view("a\0b", 3)),
+                                Value::MakeVarchar(""),
+                                Value::MakeVarchar("ab")});
+    auto integers = MakeColumn(LogicalType::kInteger,
+                               {Value::MakeInt(2), Value::MakeInt(0), Value::MakeInt(0), Value::MakeInt(0), Value::MakeInt(0), Value::MakeInt(1)});
+
+    SortKeys keys;
+    keys.Build({varchars, integers}, {OrderType::kAsc, OrderType::kAsc}, 6);
+    EXPECT_EQ(SortedRows(keys), (Vector<SizeT>{4, 1, 3, 5, 0, 2}));
+}
+
+TEST_F(SortKeysTest, merge_runs) {
+    auto MakeRun = [&](const Vector<i32> &values) {
+        auto block = DataBlock::MakeUniquePtr();
+        block->Init({MakeShared<DataType>(LogicalType::kInteger)});
+        for (i32 value : values) {
+            block->column_vectors[0]->AppendValue(Value::MakeInt(value));
+        }
+        block->Finalize();
+        auto keys = MakeShared<SortKeys>();
+        keys->Build(block->column_vectors, {OrderType::kAsc}, values.size());
+        auto run = MakeShared<SortRun>(nullptr);
+        run->Append(std::move(block), std::move(keys));
+        return run;
+    };
+
+    SortRunMerger merger({MakeRun({1, 4, 9}), MakeRun({2, 3, 10, 11}), MakeShared<SortRun>(nullptr)});
+    EXPECT_FALSE(merger.Done());
+    auto block = merger.Next();
+    ASSERT_NE(block.get(), nullptr);
+    Vector<i32> expected{1, 2, 3, 4, 9, 10, 11};
+    ASSERT_EQ(block->row_count(), expected.size());
+    for (SizeT i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(block->GetValue(0, i), Value::MakeInt(expected[i]));
+    }
+    EXPECT_TRUE(merger.Done());
+    EXPECT_EQ(merger.Next().get(), nullptr);
+}
+
+// The merged blocks are emitted a bounded number at a time.
+TEST_F(SortKeysTest, merge_runs_bounded) {
+    constexpr SizeT block_capacity = DEFAULT_BLOCK_CAPACITY;
+    auto MakeRun = [&](i32 begin, i32 step, SizeT block_count) {
+        auto run = MakeShared<SortRun>(nullptr);
+        i32 value = begin;
+        for (SizeT i = 0; i < block_count; ++i) {
+            auto block = DataBlock::MakeUniquePtr();
+            block->Init({MakeShared<DataType>(LogicalType::kInteger)});
+            for (SizeT row = 0; row < block_capacity; ++row, value += step) {
+                block->column_vectors[0]->AppendValue(Value::MakeInt(value));
+            }
+            block->Finalize();
+            auto keys = MakeShared<SortKeys>();
+            keys->Build(block->column_vectors, {OrderType::kAsc}, block_capacity);
+            run->Append(std::move(block), std::move(keys));
+        }
+        return run;
+    };
+
+    SortRunMerger merger({MakeRun(0, 2, 3), MakeRun(1, 2, 2)});
+    Vector<UniquePtr<DataBlock>> blocks;
+    EXPECT_FALSE(MergeSortRuns(merger, blocks, 2));
+    EXPECT_EQ(blocks.size(), 2u);
+    EXPECT_FALSE(MergeSortRuns(merger, blocks, 2));
+    EXPECT_EQ(blocks.size(), 4u);
+    EXPECT_TRUE(MergeSortRuns(merger, blocks, 2));
+    ASSERT_EQ(blocks.size(), 5u);
+
+    i32 expected = 0;
+    for (const auto &block : blocks) {
+        ASSERT_EQ(block->row_count(), block_capacity);
+        for (SizeT row = 0; row < block->row_count(); ++row) {
+            // the odd values end with the shorter run
+            EXPECT_EQ(block->GetValue(0, row), Value::MakeInt(expected));
+            expected += expected < static_cast<i32>(4 * block_capacity) ? 1 : 2;
+        }
+    }
+}
+
+// The budget is shared by the tasks of a sort, a run kept in memory holds its part until it is released.
+TEST_F(SortKeysTest, memory_budget) {
+    auto memory_budget = MakeShared<SortMemoryBudget>(100);
+    EXPECT_FALSE(memory_budget->Reserve(60));
+    EXPECT_TRUE(memory_budget->Reserve(60));
+    memory_budget->Release(60);
+    {
+        auto run = MakeShared<SortRun>(nullptr);
+        run->HoldBudget(memory_budget, 60);
+        EXPECT_TRUE(memory_budget->Reserve(1));
+        memory_budget->Release(1);
+    }
+    EXPECT_FALSE(memory_budget->Reserve(90));
+}
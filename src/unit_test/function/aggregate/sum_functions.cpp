@@ -263,3 +263,46 @@ TEST_F(SumFunctionTest, avg_func) {
         EXPECT_THROW(aggregate_function_set->GetMostMatchFunction(col_expr_ptr), RecoverableException);
     }
 }
+
+TEST_F(SumFunctionTest, sum_scatter_update_and_combine) {
+    using namespace infinity;
+
+    UniquePtr<Catalog> catalog_ptr = MakeUnique<Catalog>(MakeShared<String>(GetDataDir()));
+
+    RegisterSumFunction(catalog_ptr);
+
+    SharedPtr<FunctionSet> function_set = Catalog::GetFunctionSetByName(catalog_ptr.get(), "sum");
+    SharedPtr<AggregateFunctionSet> aggregate_function_set = std::static_pointer_cast<AggregateFunctionSet>(function_set);
+
+    SharedPtr<DataType> data_type = MakeShared<DataType>(LogicalType::kBigInt);
+    SharedPtr<ColumnExpression> col_expr_ptr = MakeShared<ColumnExpression>(*data_type, "t1", 1, "c1", 0, 0);
+    AggregateFunction func = aggregate_function_set->GetMostMatchFunction(col_expr_ptr);
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(data_type);
+    DataBlock data_block;
+    data_block.Init(column_types);
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block.AppendValue(0, Value::MakeBigInt(i));
+    }
+    data_block.Finalize();
+
+    // Even rows go to the first state, odd rows to the second one.
+    auto even_state = func.InitState();
+    auto odd_state = func.InitState();
+    func.init_func_(even_state.get());
+    func.init_func_(odd_state.get());
+    Vector<ptr_t> row_states(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        row_states[i] = i % 2 == 0 ? even_state.get() : odd_state.get();
+    }
+    func.scatter_update_func_(row_states.data(), 0, row_count, data_block.column_vectors[0]);
+
+    BigIntT half = row_count / 2;
+    EXPECT_EQ(*(BigIntT *)func.finalize_func_(even_state.get()), half * (half - 1));
+    EXPECT_EQ(*(BigIntT *)func.finalize_func_(odd_state.get()), half * half);
+
+    func.combine_func_(even_state.get(), odd_state.get());
+    EXPECT_EQ(*(BigIntT *)func.finalize_func_(even_state.get()), (BigIntT)(row_count * (row_count - 1) / 2));
+}
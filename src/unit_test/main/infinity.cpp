@@ -350,6 +350,27 @@ TEST_F(InfinityTest, test2) {
         EXPECT_EQ(result.IsOk(), true);
     }
 
+    {
+        QueryResult result = infinity->ShowVariable("interactive_task_queue", SetScope::kGlobal);
+        EXPECT_EQ(result.IsOk(), true);
+    }
+
+    {
+        QueryResult result = infinity->ShowVariable("background_task_queue", SetScope::kGlobal);
+        EXPECT_EQ(result.IsOk(), true);
+    }
+
+    {
+        QueryResult result = infinity->SetVariableOrConfig("query_priority", String("background"), SetScope::kSession);
+        EXPECT_EQ(result.IsOk(), true);
+        result = infinity->ShowVariable("query_priority", SetScope::kSession);
+        EXPECT_EQ(result.IsOk(), true);
+        result = infinity->SetVariableOrConfig("query_priority", String("urgent"), SetScope::kSession);
+        EXPECT_EQ(result.IsOk(), false);
+        result = infinity->SetVariableOrConfig("query_priority", String("auto"), SetScope::kSession);
+        EXPECT_EQ(result.IsOk(), true);
+    }
+
     {
         QueryResult result = infinity->ShowVariable("query_count", SetScope::kSession);
         EXPECT_EQ(result.IsOk(), true);
@@ -0,0 +1,238 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import sql_parser;
+import parser_result;
+import statement_cache;
+import infinity;
+import infinity_context;
+import query_context;
+import query_result;
+import session;
+import data_block;
+import value;
+import constant_expr;
+
+using namespace infinity;
+
+class StatementCacheTest : public BaseTest {
+protected:
+    static SharedPtr<ParserResult> Parse(const String &query) {
+        SQLParser parser;
+        SharedPtr<ParserResult> parsed_result = MakeShared<ParserResult>();
+        parser.Parse(query, parsed_result.get());
+        return parsed_result;
+    }
+};
+
+TEST_F(StatementCacheTest, normalize_query) {
+    EXPECT_EQ(NormalizeQuery("SELECT a, b\n\tFROM t1   WHERE c = d;").text_, "SELECT a, b FROM t1 WHERE c = d");
+    EXPECT_EQ(NormalizeQuery("  SELECT * FROM t1 ; ; ").text_, "SELECT * FROM t1");
+    // the whitespace of a quoted string is kept
+    EXPECT_EQ(NormalizeQuery("SELECT *  FROM t1 WHERE c IN ('a  b;')").text_, "SELECT * FROM t1 WHERE c IN ('a  b;')");
+    EXPECT_EQ(NormalizeQuery("SELECT \"a  b\"  FROM t1").text_, "SELECT \"a  b\" FROM t1");
+}
+
+TEST_F(StatementCacheTest, normalize_literals) {
+    // the constants compared with in the filter are taken out, the others are part of the shape
+    NormalizedQuery normalized = NormalizeQuery("SELECT c1 > 5 FROM t1 WHERE c1 > -5 AND c2 = 'it''s' OR c3 BETWEEN 1.5 AND 10 LIMIT 3");
+    EXPECT_TRUE(normalized.select_);
+    EXPECT_EQ(normalized.text_, "SELECT c1 > 5 FROM t1 WHERE c1 > ? AND c2 = ? OR c3 BETWEEN ? AND ? LIMIT 3");
+    ASSERT_EQ(normalized.slots_.size(), 4u);
+    EXPECT_EQ(normalized.slots_[0].literal_->integer_value_, -5);
+    EXPECT_STREQ(normalized.slots_[1].literal_->str_value_, "it's");
+    EXPECT_DOUBLE_EQ(normalized.slots_[2].literal_->double_value_, 1.5);
+    EXPECT_EQ(normalized.slots_[3].literal_->integer_value_, 10);
+    EXPECT_EQ(normalized.parameter_count_, 0u);
+
+    // an interval isn't an operand the parser takes `?` for
+    EXPECT_EQ(NormalizeQuery("SELECT * FROM t1 WHERE c1 > 1 DAY").text_, "SELECT * FROM t1 WHERE c1 > 1 DAY");
+
+    normalized = NormalizeQuery("SELECT * FROM t1 SEARCH MATCH VECTOR (c2, [0.1, 0.2], 'float', 'l2', 10)");
+    EXPECT_EQ(normalized.text_, "SELECT * FROM t1 SEARCH MATCH VECTOR (c2, ?, 'float', 'l2', 10)");
+    ASSERT_EQ(normalized.slots_.size(), 1u);
+    EXPECT_EQ(normalized.slots_[0].literal_->double_array_, (Vector<double>{0.1, 0.2}));
+
+    // only the placeholders are taken out of other statements
+    normalized = NormalizeQuery("INSERT INTO t1 VALUES ($2, 1, $1)");
+    EXPECT_FALSE(normalized.select_);
+    EXPECT_EQ(normalized.text_, "INSERT INTO t1 VALUES (?, 1, ?)");
+    ASSERT_EQ(normalized.slots_.size(), 2u);
+    EXPECT_EQ(normalized.slots_[0].literal_, nullptr);
+    EXPECT_EQ(normalized.slots_[0].parameter_index_, 1u);
+    EXPECT_EQ(normalized.slots_[1].parameter_index_, 0u);
+    EXPECT_EQ(normalized.parameter_count_, 2u);
+
+    // the parser takes the normalized queries
+    EXPECT_FALSE(Parse("SELECT a FROM t1 WHERE b > ? AND c BETWEEN ? AND ?")->IsError());
+    EXPECT_FALSE(Parse("SELECT * FROM t1 SEARCH MATCH VECTOR (c2, ?, 'float', 'l2', 10)")->IsError());
+}
+
+TEST_F(StatementCacheTest, parameter_value) {
+    EXPECT_EQ(ParseParameterValue("12")->integer_value_, 12);
+    EXPECT_DOUBLE_EQ(ParseParameterValue("-3.5")->double_value_, -3.5);
+    EXPECT_EQ(ParseParameterValue(" [1, 2] ")->long_array_, (Vector<i64>{1, 2}));
+    EXPECT_STREQ(ParseParameterValue("1 2")->str_value_, "1 2");
+}
+
+TEST_F(StatementCacheTest, cacheable_statement) {
+    EXPECT_TRUE(IsCacheableStatement(*Parse("SELECT a FROM t1 WHERE b > 1;")));
+    EXPECT_FALSE(IsCacheableStatement(*Parse("INSERT INTO t1 VALUES (1);")));
+    EXPECT_FALSE(IsCacheableStatement(*Parse("SELECT a FROM t1; SELECT b FROM t1;")));
+    EXPECT_FALSE(IsCacheableStatement(*Parse("SELECT FROM WHERE")));
+}
+
+TEST_F(StatementCacheTest, lru) {
+    StatementCache cache(2, 1);
+    auto result1 = Parse("SELECT a FROM t1");
+    auto result2 = Parse("SELECT b FROM t1");
+    auto result3 = Parse("SELECT c FROM t1");
+
+    cache.Put("SELECT a FROM t1", result1);
+    cache.Put("SELECT b FROM t1", result2);
+    EXPECT_EQ(cache.Get("SELECT a FROM t1"), result1);
+
+    // "SELECT b FROM t1" is the least recently used
+    cache.Put("SELECT c FROM t1", result3);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.Get("SELECT b FROM t1"), nullptr);
+    EXPECT_EQ(cache.Get("SELECT a FROM t1"), result1);
+    EXPECT_EQ(cache.Get("SELECT c FROM t1"), result3);
+    EXPECT_EQ(cache.hit_count(), 3u);
+    EXPECT_EQ(cache.miss_count(), 1u);
+}
+
+class StatementCacheQueryTest : public BaseTest {
+protected:
+    void SetUp() override {
+        BaseTest::SetUp();
+        RemoveDbDirs();
+        Infinity::LocalInit(GetHomeDir());
+        infinity_ = Infinity::LocalConnect();
+        EXPECT_TRUE(infinity_->Query("CREATE TABLE t_cache(c1 INT);").IsOk());
+        EXPECT_TRUE(infinity_->Query("INSERT INTO t_cache VALUES (1), (2), (6);").IsOk());
+    }
+
+    void TearDown() override {
+        infinity_->Query("DROP TABLE t_cache;");
+        infinity_->LocalDisconnect();
+        infinity_.reset();
+        Infinity::LocalUnInit();
+        BaseTest::TearDown();
+    }
+
+    static void CheckAvg(const QueryResult &result, const String &column_name) {
+        ASSERT_TRUE(result.IsOk());
+        ASSERT_EQ(result.result_table_->ColumnCount(), 1u);
+        EXPECT_EQ(result.result_table_->GetColumnNameById(0), column_name);
+        ASSERT_EQ(result.result_table_->DataBlockCount(), 1u);
+        SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
+        ASSERT_EQ(data_block->row_count(), 1u);
+        Value value = data_block->GetValue(0, 0);
+        EXPECT_DOUBLE_EQ(value.value_.float64, 3.0);
+    }
+
+    SharedPtr<Infinity> infinity_{};
+};
+
+// The binder rewrites avg to sum / count. The cached statement is bound again by every execution, so it must not be changed by the
+// rewrite.
+TEST_F(StatementCacheQueryTest, cached_avg) {
+    const String query = "SELECT AVG(c1) FROM t_cache;";
+    StatementCache *statement_cache = InfinityContext::instance().session_manager()->statement_cache();
+
+    QueryResult first = infinity_->Query(query);
+    CheckAvg(first, first.result_table_->GetColumnNameById(0));
+    const String column_name = first.result_table_->GetColumnNameById(0);
+
+    const u64 hit_count = statement_cache->hit_count();
+    CheckAvg(infinity_->Query(query), column_name);
+    EXPECT_EQ(statement_cache->hit_count(), hit_count + 1);
+
+    // the cache is shared by the sessions
+    SharedPtr<Infinity> other = Infinity::LocalConnect();
+    CheckAvg(other->Query(query), column_name);
+    EXPECT_EQ(statement_cache->hit_count(), hit_count + 2);
+    CheckAvg(infinity_->Query(query), column_name);
+    other->LocalDisconnect();
+}
+
+// Parse, Bind, Describe and Execute of the PG extended query protocol: Describe gives the result columns without executing the
+// statement, and the statement can be executed more than once.
+TEST_F(StatementCacheQueryTest, prepared_statement) {
+    SharedPtr<RemoteSession> session_ptr = InfinityContext::instance().session_manager()->CreateRemoteSession();
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_ptr.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    query_context_ptr->set_current_schema(session_ptr->current_database());
+
+    EXPECT_TRUE(query_context_ptr->Prepare("avg", "SELECT AVG(c1) FROM t_cache").ok());
+
+    QueryResult description = query_context_ptr->DescribePrepared("avg");
+    ASSERT_TRUE(description.IsOk());
+    ASSERT_EQ(description.result_table_->ColumnCount(), 1u);
+    EXPECT_EQ(description.result_table_->row_count(), 0u);
+    const String column_name = description.result_table_->GetColumnNameById(0);
+
+    CheckAvg(query_context_ptr->ExecutePrepared("avg"), column_name);
+    CheckAvg(query_context_ptr->ExecutePrepared("avg"), column_name);
+
+    // describing the statement does not insert twice
+    EXPECT_TRUE(query_context_ptr->Prepare("insert", "INSERT INTO t_cache VALUES (3)").ok());
+    query_context_ptr->DescribePrepared("insert");
+    QueryResult count = infinity_->Query("SELECT COUNT(*) FROM t_cache;");
+    ASSERT_TRUE(count.IsOk());
+    EXPECT_EQ(count.result_table_->GetDataBlockById(0)->GetValue(0, 0).value_.big_int, 3);
+
+    EXPECT_FALSE(query_context_ptr->DescribePrepared("missing").IsOk());
+}
+
+// Queries which only differ in the constants of their filters share a statement, and a prepared statement is executed with the values of
+// its parameters.
+TEST_F(StatementCacheQueryTest, parameters) {
+    StatementCache *statement_cache = InfinityContext::instance().session_manager()->statement_cache();
+    QueryResult result = infinity_->Query("SELECT c1 FROM t_cache WHERE c1 > 1;");
+    ASSERT_TRUE(result.IsOk());
+    EXPECT_EQ(result.result_table_->row_count(), 2u);
+    const u64 hit_count = statement_cache->hit_count();
+    result = infinity_->Query("SELECT c1 FROM t_cache WHERE c1 > 5;");
+    ASSERT_TRUE(result.IsOk());
+    EXPECT_EQ(result.result_table_->row_count(), 1u);
+    EXPECT_EQ(statement_cache->hit_count(), hit_count + 1);
+
+    SharedPtr<RemoteSession> session_ptr = InfinityContext::instance().session_manager()->CreateRemoteSession();
+    UniquePtr<QueryContext> query_context_ptr = MakeUnique<QueryContext>(session_ptr.get());
+    query_context_ptr->Init(InfinityContext::instance().config(),
+                            InfinityContext::instance().task_scheduler(),
+                            InfinityContext::instance().storage(),
+                            InfinityContext::instance().resource_manager(),
+                            InfinityContext::instance().session_manager());
+    query_context_ptr->set_current_schema(session_ptr->current_database());
+
+    EXPECT_TRUE(query_context_ptr->Prepare("filter", "SELECT c1 FROM t_cache WHERE c1 > $1").ok());
+    result = query_context_ptr->ExecutePrepared("filter", {ParseParameterValue("1")});
+    ASSERT_TRUE(result.IsOk());
+    EXPECT_EQ(result.result_table_->row_count(), 2u);
+    result = query_context_ptr->ExecutePrepared("filter", {ParseParameterValue("5")});
+    ASSERT_TRUE(result.IsOk());
+    EXPECT_EQ(result.result_table_->row_count(), 1u);
+    // a parameter without value
+    EXPECT_FALSE(query_context_ptr->ExecutePrepared("filter").IsOk());
+}
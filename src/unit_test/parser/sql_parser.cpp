@@ -66,6 +66,7 @@ TEST_F(SQLParserTest, good_test1) {
     inputs.emplace_back("flush data;");
     inputs.emplace_back("flush log;");
     inputs.emplace_back("flush buffer;");
+    inputs.emplace_back("show buffer;");
     inputs.emplace_back("optimize t1;");
 
     inputs.emplace_back("SELECT KNN(c1, [1, 2], 2, 'integer', 'l2') AS distance1 FROM t1 WHERE a > 0 ORDER BY distance1 LIMIT 3;");
@@ -702,6 +703,33 @@ TEST_F(SQLParserTest, good_create_index_1) {
 
         result->Reset();
     }
+
+    {
+        String input_sql = "CREATE INDEX idx4 ON t1 (a) USING IVFPQ WITH (metric = l2, subspace_num = 4);";
+        parser->Parse(input_sql, result.get());
+
+        EXPECT_TRUE(result->error_message_.empty());
+        BaseStatement *statement = (*result->statements_ptr_)[0];
+
+        EXPECT_EQ(statement->type_, StatementType::kCreate);
+        auto create_statement = static_cast<CreateStatement *>(statement);
+        auto create_index_info = static_cast<CreateIndexInfo *>(create_statement->create_info_.get());
+        EXPECT_EQ(create_index_info->index_name_, "idx4");
+
+        Vector<IndexInfo *>& index_info_list = *(create_index_info->index_info_list_);
+        EXPECT_EQ(index_info_list.size(), 1u);
+        IndexInfo * index_info = index_info_list[0];
+        EXPECT_EQ(index_info->index_type_, IndexType::kIVFPQ);
+        EXPECT_EQ(index_info->column_name_, "a");
+        EXPECT_EQ(index_info->index_param_list_->size(), 2u);
+        EXPECT_EQ((*index_info->index_param_list_)[1]->param_name_, "subspace_num");
+        EXPECT_EQ((*index_info->index_param_list_)[1]->param_value_, "4");
+
+        EXPECT_EQ(IndexInfo::IndexTypeToString(index_info->index_type_), "IVFPQ");
+        EXPECT_EQ(IndexInfo::StringToIndexType("IVFPQ"), IndexType::kIVFPQ);
+
+        result->Reset();
+    }
 }
 
 TEST_F(SQLParserTest, bad_create_index_1) {
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <cstring>
 
 import stl;
 import buffer_manager;
@@ -25,6 +26,14 @@ import infinity_context;
 import local_file_system;
 import logger;
 import config;
+import file_worker;
+import file_scrubber;
+import file_system;
+import file_system_type;
+import infinity_exception;
+import column_encoding;
+import bitmask;
+import filter_expression_push_down_helper;
 
 using namespace infinity;
 
@@ -180,6 +189,187 @@ TEST_F(BufferManagerTest, cleanup_test) {
     }
 }
 
+TEST_F(BufferManagerTest, temp_cleanup_test) {
+    const SizeT file_size = 100;
+
+    BufferManager buffer_mgr(file_size, data_dir_, temp_dir_);
+    Vector<BufferObj *> buffer_objs;
+    for (SizeT i = 0; i < 2; ++i) {
+        auto file_worker = MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>(fmt::format("temp_{}", i)), file_size);
+        auto *buffer_obj = buffer_mgr.AllocateBufferObject(std::move(file_worker));
+        auto buffer_handle = buffer_obj->Load();
+        std::memset(buffer_handle.GetDataMut(), 'a' + i, file_size);
+        buffer_objs.push_back(buffer_obj);
+    }
+    // the first one is spilled to make room for the second one
+    EXPECT_EQ(buffer_objs[0]->type(), BufferType::kTemp);
+    EXPECT_EQ(ListAllTemp().size(), 1ull);
+
+    // an object cleaned up never gets back, so its temp file goes with it
+    for (auto *buffer_obj : buffer_objs) {
+        buffer_obj->PickForCleanup();
+    }
+    buffer_mgr.RemoveClean();
+    EXPECT_EQ(ListAllTemp().size(), 0ull);
+    EXPECT_EQ(ListAllData().size(), 0ull);
+}
+
+TEST_F(BufferManagerTest, scan_resistance_test) {
+    const SizeT file_size = 100;
+    const SizeT scan_num = 10;
+
+    BufferManager buffer_mgr(3 * file_size, data_dir_, temp_dir_);
+    auto MakeBufferObj = [&](const String &name) {
+        auto file_worker = MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>(name), file_size);
+        return buffer_mgr.AllocateBufferObject(std::move(file_worker));
+    };
+
+    // loaded again after being unloaded, so it is protected
+    auto *hot_obj = MakeBufferObj("hot");
+    { auto buffer_handle = hot_obj->Load(); }
+    { auto buffer_handle = hot_obj->Load(); }
+
+    // a scan loads every object once
+    for (SizeT i = 0; i < scan_num; ++i) {
+        auto *buffer_obj = MakeBufferObj(fmt::format("scan_{}", i));
+        auto buffer_handle = buffer_obj->Load();
+    }
+    EXPECT_EQ(hot_obj->status(), BufferStatus::kUnloaded);
+
+    for (const auto &statistics : buffer_mgr.GetBufferStatistics()) {
+        if (statistics.type_ == FileWorkerType::kDataFile) {
+            EXPECT_EQ(statistics.hit_count_, 1ull);
+            EXPECT_EQ(statistics.miss_count_, 0ull);
+            EXPECT_EQ(statistics.evict_count_, scan_num - 2);
+        } else {
+            EXPECT_EQ(statistics.hit_count_ + statistics.miss_count_ + statistics.evict_count_, 0ull);
+        }
+    }
+}
+
+TEST_F(BufferManagerTest, checksum_test) {
+    const SizeT file_size = 1000;
+
+    BufferManager buffer_mgr(file_size, data_dir_, temp_dir_);
+    auto file_name = MakeShared<String>("checksum");
+    auto *buffer_obj = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, file_name, file_size));
+    {
+        auto buffer_handle = buffer_obj->Load();
+        auto *data = static_cast<char *>(buffer_handle.GetDataMut());
+        for (SizeT i = 0; i < file_size; ++i) {
+            data[i] = i % 128;
+        }
+    }
+    buffer_obj->Save();
+    // evict it to make it cold
+    { auto buffer_handle = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("other"), file_size))->Load(); }
+    EXPECT_TRUE(buffer_obj->OnDisk());
+    EXPECT_EQ(buffer_mgr.GetColdFiles(), Vector<String>{buffer_obj->GetFilename()});
+
+    {
+        // a budget smaller than the file, so that the scrub resumes across calls
+        FileScrubber scrubber(&buffer_mgr, std::chrono::seconds(0));
+        for (SizeT i = 0; i < 10 && scrubber.scrubbed_file_count() == 0; ++i) {
+            scrubber.Scrub(file_size / 4);
+        }
+        EXPECT_EQ(scrubber.scrubbed_file_count(), 1ull);
+        EXPECT_EQ(scrubber.corrupted_file_count(), 0ull);
+    }
+    {
+        DataFileWorker file_worker(data_dir_, file_name, file_size);
+        file_worker.ReadFromFile(false);
+        EXPECT_EQ(static_cast<char *>(file_worker.GetData())[file_size - 1], char((file_size - 1) % 128));
+    }
+
+    {
+        LocalFileSystem fs;
+        auto file_handler = fs.OpenFile(buffer_obj->GetFilename(), FileFlags::WRITE_FLAG, FileLockType::kNoLock);
+        char flipped = 127;
+        fs.WriteAt(*file_handler, 100, &flipped, 1);
+        file_handler->Close();
+    }
+    {
+        FileScrubber scrubber(&buffer_mgr, std::chrono::seconds(0));
+        scrubber.Scrub(2 * file_size);
+        EXPECT_EQ(scrubber.scrubbed_file_count(), 1ull);
+        EXPECT_EQ(scrubber.corrupted_file_count(), 1ull);
+    }
+    {
+        DataFileWorker file_worker(data_dir_, file_name, file_size);
+        EXPECT_THROW(file_worker.ReadFromFile(false), RecoverableException);
+        EXPECT_EQ(file_worker.GetData(), nullptr);
+    }
+}
+
+TEST_F(BufferManagerTest, scrub_pass_test) {
+    const SizeT file_size = 1000;
+
+    BufferManager buffer_mgr(file_size, data_dir_, temp_dir_);
+    auto *buffer_obj = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("scrub_pass"), file_size));
+    { auto buffer_handle = buffer_obj->Load(); }
+    buffer_obj->Save();
+    { auto buffer_handle = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("other"), file_size))->Load(); }
+    EXPECT_TRUE(buffer_obj->OnDisk());
+
+    // the next pass doesn't start before the pass interval, however large the budget
+    FileScrubber scrubber(&buffer_mgr, std::chrono::seconds(3600));
+    EXPECT_TRUE(scrubber.TrySchedule());
+    EXPECT_FALSE(scrubber.TrySchedule());
+    scrubber.Scrub(2 * file_size);
+    EXPECT_EQ(scrubber.scrubbed_file_count(), 1ull);
+    EXPECT_TRUE(scrubber.TrySchedule());
+    scrubber.Scrub(2 * file_size);
+    EXPECT_EQ(scrubber.scrubbed_file_count(), 1ull);
+
+    FileScrubber eager_scrubber(&buffer_mgr, std::chrono::seconds(0));
+    eager_scrubber.Scrub(2 * file_size);
+    eager_scrubber.Scrub(2 * file_size);
+    EXPECT_EQ(eager_scrubber.scrubbed_file_count(), 2ull);
+}
+
+TEST_F(BufferManagerTest, encoded_load_test) {
+    const SizeT row_count = 8192;
+    const SizeT file_size = row_count * sizeof(i32);
+
+    BufferManager buffer_mgr(file_size, data_dir_, temp_dir_);
+    auto *buffer_obj = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("encoded"), file_size, sizeof(i32)));
+    auto *file_worker = static_cast<DataFileWorker *>(buffer_obj->file_worker());
+    Vector<i32> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = 1000 + i % 100;
+    }
+    {
+        auto buffer_handle = buffer_obj->Load();
+        std::memcpy(buffer_handle.GetDataMut(), values.data(), file_size);
+    }
+    file_worker->Seal();
+    buffer_obj->Save();
+    { auto buffer_handle = buffer_mgr.AllocateBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("other"), file_size))->Load(); }
+    EXPECT_TRUE(buffer_obj->OnDisk());
+
+    {
+        // the file is kept encoded in memory, and only its encoded size is accounted
+        auto buffer_handle = buffer_obj->Load();
+        EXPECT_TRUE(file_worker->Encoded());
+        EXPECT_LT(buffer_obj->GetBufferSize(), file_size);
+        EXPECT_EQ(buffer_mgr.memory_usage(), buffer_obj->GetBufferSize());
+
+        Vector<i32> decoded(row_count);
+        file_worker->Decode(decoded.data(), file_size);
+        EXPECT_EQ(decoded, values);
+
+        Bitmask selected;
+        selected.Initialize(row_count);
+        EXPECT_TRUE(file_worker->Filter({0, FilterCompareType::kLessEqual, 1009}, row_count, selected));
+        for (SizeT i = 0; i < row_count; ++i) {
+            EXPECT_EQ(selected.IsTrue(i), values[i] <= 1009);
+        }
+    }
+    { auto buffer_handle = buffer_mgr.GetBufferObject(MakeUnique<DataFileWorker>(data_dir_, MakeShared<String>("other"), file_size))->Load(); }
+    EXPECT_TRUE(buffer_obj->OnDisk());
+    EXPECT_EQ(buffer_mgr.memory_usage(), file_size);
+}
+
 TEST_F(BufferManagerTest, parallel_test) {
     LocalFileSystem fs;
 
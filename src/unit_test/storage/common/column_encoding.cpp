@@ -0,0 +1,139 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <random>
+
+import stl;
+import column_encoding;
+import bitmask;
+import filter_expression_push_down_helper;
+
+using namespace infinity;
+
+class ColumnEncodingTest : public BaseTest {
+public:
+    template <typename T>
+    void TestRoundTrip(const Vector<T> &values, ColumnEncodingType expect_type) {
+        SizeT size = values.size() * sizeof(T);
+        Vector<u8> encoded;
+        ColumnEncodingType type = ColumnEncoding::Encode(values.data(), size, sizeof(T), encoded);
+        EXPECT_EQ(type, expect_type) << ColumnEncodingTypeToString(type);
+        if (type == ColumnEncodingType::kPlain) {
+            EXPECT_TRUE(encoded.empty());
+            return;
+        }
+        EXPECT_LT(encoded.size(), size);
+
+        Vector<T> decoded(values.size());
+        EXPECT_TRUE(ColumnEncoding::Decode(type, encoded.data(), encoded.size(), sizeof(T), decoded.data(), size));
+        EXPECT_EQ(decoded, values);
+
+        // a truncated buffer is rejected instead of being read past its end
+        encoded.pop_back();
+        EXPECT_FALSE(ColumnEncoding::Decode(type, encoded.data(), encoded.size(), sizeof(T), decoded.data(), size));
+    }
+
+    // Filter the encoded values against every constant and compare type, and check the result on the values.
+    template <typename T>
+    void TestFilter(const Vector<T> &values, ColumnEncodingType expect_type, const Vector<i64> &constants) {
+        Vector<u8> encoded;
+        ColumnEncodingType type = ColumnEncoding::Encode(values.data(), values.size() * sizeof(T), sizeof(T), encoded);
+        ASSERT_EQ(type, expect_type) << ColumnEncodingTypeToString(type);
+        for (i64 constant : constants) {
+            for (FilterCompareType compare_type : {FilterCompareType::kEqual, FilterCompareType::kLessEqual, FilterCompareType::kGreaterEqual}) {
+                Bitmask selected;
+                selected.Initialize(values.size());
+                EXPECT_TRUE(ColumnEncoding::Filter(type, encoded.data(), encoded.size(), sizeof(T), values.size(), compare_type, constant, selected));
+                for (SizeT i = 0; i < values.size(); ++i) {
+                    bool expect = compare_type == FilterCompareType::kEqual       ? values[i] == constant
+                                  : compare_type == FilterCompareType::kLessEqual ? values[i] <= constant
+                                                                                  : values[i] >= constant;
+                    ASSERT_EQ(selected.IsTrue(i), expect) << "constant: " << constant << ", row: " << i;
+                }
+            }
+        }
+    }
+};
+
+TEST_F(ColumnEncodingTest, run_length) {
+    constexpr SizeT row_count = 8192;
+    Vector<i32> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = i / 1000;
+    }
+    TestRoundTrip(values, ColumnEncodingType::kRunLength);
+}
+
+TEST_F(ColumnEncodingTest, frame_of_reference) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937 gen(42);
+    Vector<i64> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = -5'000'000'000LL + gen() % 100'000;
+    }
+    TestRoundTrip(values, ColumnEncodingType::kFrameOfReference);
+
+    Vector<i16> small_values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        small_values[i] = -100 + gen() % 50;
+    }
+    TestRoundTrip(small_values, ColumnEncodingType::kFrameOfReference);
+}
+
+TEST_F(ColumnEncodingTest, dictionary) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937 gen(42);
+    Vector<f64> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = (gen() % 10) * 1.5;
+    }
+    TestRoundTrip(values, ColumnEncodingType::kDictionary);
+}
+
+TEST_F(ColumnEncodingTest, plain) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937_64 gen(42);
+    Vector<u64> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = gen();
+    }
+    TestRoundTrip(values, ColumnEncodingType::kPlain);
+}
+
+TEST_F(ColumnEncodingTest, filter) {
+    constexpr SizeT row_count = 8192;
+    std::mt19937 gen(42);
+    Vector<i64> values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        values[i] = -5'000'000'000LL + gen() % 100'000;
+    }
+    TestFilter(values, ColumnEncodingType::kFrameOfReference, {-6'000'000'000LL, -5'000'000'000LL, -4'999'950'000LL, -4'999'900'001LL, 0});
+
+    // too wide for frame of reference
+    Vector<i64> dictionary_values(row_count);
+    for (SizeT i = 0; i < row_count; ++i) {
+        dictionary_values[i] = (gen() % 10) * 1'000'000'000LL - 4'000'000'000LL;
+    }
+    TestFilter(dictionary_values, ColumnEncodingType::kDictionary, {-5'000'000'000LL, -4'000'000'000LL, 0, 999'999'999, 6'000'000'000LL});
+
+    // other encodings are left to the filter
+    Vector<i32> run_length_values(row_count, 7);
+    Vector<u8> encoded;
+    ColumnEncodingType type = ColumnEncoding::Encode(run_length_values.data(), row_count * sizeof(i32), sizeof(i32), encoded);
+    EXPECT_EQ(type, ColumnEncodingType::kRunLength);
+    Bitmask selected;
+    selected.Initialize(row_count);
+    EXPECT_FALSE(ColumnEncoding::Filter(type, encoded.data(), encoded.size(), sizeof(i32), row_count, FilterCompareType::kEqual, 7, selected));
+}
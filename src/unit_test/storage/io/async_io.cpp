@@ -0,0 +1,81 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import file_system;
+import local_file_system;
+import file_system_type;
+import async_io;
+
+class AsyncIOTest : public BaseTest {};
+
+TEST_F(AsyncIOTest, write_sync_read) {
+    using namespace infinity;
+    LocalFileSystem local_file_system;
+    String path = String(GetTmpDir()) + "/test_async_io.abc";
+
+    // a queue shallower than the request count makes Submit wait for completions
+    constexpr u32 queue_depth = 4;
+    constexpr SizeT page_count = 32;
+    constexpr SizeT page_size = 4096;
+    UniquePtr<AsyncIO> async_io = AsyncIO::Make(queue_depth);
+
+    UniquePtr<FileHandler> file_handler =
+        local_file_system.OpenFile(path, FileFlags::READ_FLAG | FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kNoLock);
+
+    Vector<char> data(page_count * page_size);
+    for (SizeT i = 0; i < data.size(); ++i) {
+        data[i] = i % 127;
+    }
+    SizeT written_count = 0;
+    Vector<AsyncIORequest> requests(page_count);
+    for (SizeT i = 0; i < page_count; ++i) {
+        requests[i].callback_ = [&](AsyncIORequest *request) {
+            EXPECT_EQ(request->result_, (i64)page_size);
+            ++written_count;
+        };
+        local_file_system.SubmitWriteAt(*async_io, *file_handler, i * page_size, data.data() + i * page_size, page_size, &requests[i]);
+    }
+    async_io->Complete(async_io->InFlight());
+    EXPECT_EQ(written_count, page_count);
+
+    AsyncIORequest sync_request;
+    local_file_system.SubmitSync(*async_io, *file_handler, &sync_request);
+    AsyncIORequest readahead_request;
+    local_file_system.SubmitReadahead(*async_io, *file_handler, &readahead_request);
+    EXPECT_EQ(async_io->Complete(2), 2u);
+    EXPECT_EQ(sync_request.result_, 0);
+    EXPECT_EQ(readahead_request.result_, 0);
+
+    Vector<char> read_data(data.size());
+    SizeT read_count = 0;
+    for (SizeT i = 0; i < page_count; ++i) {
+        requests[i].callback_ = [&](AsyncIORequest *request) {
+            EXPECT_EQ(request->result_, (i64)page_size);
+            ++read_count;
+        };
+        local_file_system.SubmitReadAt(*async_io, *file_handler, i * page_size, read_data.data() + i * page_size, page_size, &requests[i]);
+    }
+    while (async_io->InFlight() > 0) {
+        async_io->Complete(1);
+    }
+    EXPECT_EQ(read_count, page_count);
+    EXPECT_EQ(read_data, data);
+
+    file_handler->Close();
+    local_file_system.DeleteFile(path);
+}
@@ -74,3 +74,31 @@ TEST_F(LocalFileSystemTest, dir_ops) {
     EXPECT_FALSE(local_file_system.Exists(path));
     EXPECT_FALSE(local_file_system.Exists(dir));
 }
+
+TEST_F(LocalFileSystemTest, preallocate_and_truncate) {
+    using namespace infinity;
+    LocalFileSystem local_file_system;
+    String path = String(GetTmpDir()) + "/test_file_preallocate.test";
+
+    UniquePtr<FileHandler> file_handler =
+        local_file_system.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::TRUNCATE_CREATE, FileLockType::kWriteLock);
+
+    // the reserved blocks don't change the file size
+    local_file_system.Preallocate(*file_handler, 0, 1024 * 1024);
+    EXPECT_EQ(local_file_system.GetFileSize(*file_handler), 0u);
+
+    SizeT len = 10;
+    UniquePtr<char[]> data_array = MakeUnique<char[]>(len);
+    for (SizeT i = 0; i < len; ++i) {
+        data_array[i] = i + 1;
+    }
+    local_file_system.WriteAt(*file_handler, 0, data_array.get(), len);
+    local_file_system.DataSyncFile(*file_handler);
+    EXPECT_EQ(local_file_system.GetFileSize(*file_handler), len);
+
+    local_file_system.Truncate(*file_handler, 4);
+    EXPECT_EQ(local_file_system.GetFileSize(*file_handler), 4u);
+    file_handler->Close();
+    local_file_system.DeleteFile(path);
+    EXPECT_FALSE(local_file_system.Exists(path));
+}
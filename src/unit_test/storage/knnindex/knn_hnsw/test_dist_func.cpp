@@ -21,6 +21,7 @@ import dist_func_l2;
 import data_store;
 import vec_store_type;
 import hnsw_simd_func;
+import simd_dispatch;
 import hnsw_common;
 import stl;
 
@@ -141,3 +142,74 @@ TEST_F(DistFuncTest, test2) {
         // EXPECT_NEAR(dist1, dist2, 1e-5);
     }
 }
+
+// The kernels of every level supported by the cpu agree with the plain loops, for a dim of whole blocks and one with a residual.
+TEST_F(DistFuncTest, simd_dispatch) {
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> idist(-128, 127);
+    std::uniform_real_distribution<float> rdist(-1, 1);
+    const SIMDLevel supported_level = GetSupportedSIMDLevel();
+    EXPECT_EQ(GetSIMDFunctions().level_, supported_level);
+    for (size_t dim : {128, 200}) {
+        Vector<int8_t> i8_v1(dim), i8_v2(dim);
+        Vector<float> f32_v1(dim), f32_v2(dim);
+        Vector<uint8_t> u8_v1(dim), u8_v2(dim);
+        for (size_t j = 0; j < dim; ++j) {
+            i8_v1[j] = idist(rng);
+            i8_v2[j] = idist(rng);
+            f32_v1[j] = rdist(rng);
+            f32_v2[j] = rdist(rng);
+            u8_v1[j] = idist(rng) + 128;
+            u8_v2[j] = idist(rng) + 128;
+        }
+        const int32_t i8_ip = I8IPTest(i8_v1.data(), i8_v2.data(), dim);
+        const float f32_l2 = F32L2BF(f32_v1.data(), f32_v2.data(), dim);
+        const float f32_ip = F32IPBF(f32_v1.data(), f32_v2.data(), dim);
+        const int32_t hamming = HammingBF(u8_v1.data(), u8_v2.data(), dim);
+        for (u8 level = 0; level <= static_cast<u8>(supported_level); ++level) {
+            const SIMDFunctions &functions = GetSIMDFunctions(static_cast<SIMDLevel>(level));
+            EXPECT_EQ(functions.I8IP(dim)(i8_v1.data(), i8_v2.data(), dim), i8_ip) << SIMDLevelToString(functions.level_);
+            EXPECT_NEAR(functions.F32L2(dim)(f32_v1.data(), f32_v2.data(), dim), f32_l2, 1e-3) << SIMDLevelToString(functions.level_);
+            EXPECT_NEAR(functions.F32IP(dim)(f32_v1.data(), f32_v2.data(), dim), f32_ip, 1e-3) << SIMDLevelToString(functions.level_);
+            EXPECT_EQ(functions.hamming_(u8_v1.data(), u8_v2.data(), dim), hamming) << SIMDLevelToString(functions.level_);
+        }
+    }
+}
+
+// The adc scan kernels agree with the plain loop, for a number of subspaces of whole groups of four and one with a residual, and a number
+// of vectors which leaves some to the plain loop.
+TEST_F(DistFuncTest, adc_scan) {
+    std::default_random_engine rng;
+    std::uniform_int_distribution<int> code_dist(0, 255);
+    std::uniform_real_distribution<float> rdist(0, 1);
+    const SIMDLevel supported_level = GetSupportedSIMDLevel();
+    const uint32_t n = 37;
+    const float bias = 0.5;
+    for (uint32_t subspace_num : {1, 8, 13}) {
+        Vector<float> table(subspace_num * 256);
+        Vector<uint8_t> codes(n * subspace_num);
+        for (auto &entry : table) {
+            entry = rdist(rng);
+        }
+        for (auto &code : codes) {
+            code = code_dist(rng);
+        }
+        Vector<float> expected(n);
+        ADCScanBF(table.data(), codes.data(), subspace_num, n, bias, expected.data());
+        for (uint32_t i = 0; i < n; ++i) {
+            float dist = bias;
+            for (uint32_t s = 0; s < subspace_num; ++s) {
+                dist += table[s * 256 + codes[i * subspace_num + s]];
+            }
+            EXPECT_FLOAT_EQ(expected[i], dist);
+        }
+        for (u8 level = 0; level <= static_cast<u8>(supported_level); ++level) {
+            const SIMDFunctions &functions = GetSIMDFunctions(static_cast<SIMDLevel>(level));
+            Vector<float> distances(n);
+            functions.adc_scan_(table.data(), codes.data(), subspace_num, n, bias, distances.data());
+            for (uint32_t i = 0; i < n; ++i) {
+                EXPECT_FLOAT_EQ(distances[i], expected[i]) << SIMDLevelToString(functions.level_);
+            }
+        }
+    }
+}
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "unit_test/base_test.h"
+#include <algorithm>
 #include <fstream>
 #include <thread>
 
@@ -32,6 +33,7 @@ import dist_func_l2;
 import dist_func_ip;
 import vec_store_type;
 import hnsw_common;
+import internal_types;
 
 using namespace infinity;
 
@@ -224,6 +226,47 @@ public:
             t.join();
         }
     }
+
+    template <typename Hnsw>
+    void TestParallelBuild() {
+        int dim = 16;
+        int M = 8;
+        int ef_construction = 200;
+        int chunk_size = 128;
+        int max_chunk_n = 10;
+        int element_size = max_chunk_n * chunk_size;
+
+        std::mt19937 rng;
+        rng.seed(0);
+        std::uniform_real_distribution<float> distrib_real;
+
+        auto data = MakeUnique<float[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_real(rng);
+        }
+
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        ThreadPool build_pool(3);
+        HnswInsertConfig config;
+        config.optimize_ = true;
+        config.build_pool_ = &build_pool;
+        auto [start_i, end_i] = hnsw_index.InsertVecsRaw(data.get(), element_size, 0 /*offset*/, config);
+        EXPECT_EQ(start_i, 0u);
+        EXPECT_EQ(end_i, SizeT(element_size));
+        hnsw_index.Check();
+
+        hnsw_index.SetEf(10);
+        int correct = 0;
+        for (int i = 0; i < element_size; ++i) {
+            const float *query = data.get() + i * dim;
+            auto result = hnsw_index.KnnSearchSorted(query, 1);
+            if (result[0].second == (LabelT)i) {
+                ++correct;
+            }
+        }
+        float correct_rate = float(correct) / element_size;
+        EXPECT_GE(correct_rate, 0.95);
+    }
 };
 
 TEST_F(HnswAlgTest, test1) {
@@ -246,3 +289,256 @@ TEST_F(HnswAlgTest, test4) {
     using Hnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
     TestParallel<Hnsw>();
 }
+
+TEST_F(HnswAlgTest, test5) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
+    TestParallelBuild<Hnsw>();
+}
+
+TEST_F(HnswAlgTest, test6) {
+    using Hnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
+    TestParallelBuild<Hnsw>();
+}
+
+TEST_F(HnswAlgTest, test7) {
+    using Hnsw = KnnHnsw<PlainL2VecStoreType<i8>, LabelT>;
+    static_assert(std::is_same_v<Hnsw::DistanceType, f32>);
+
+    int dim = 16;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_int_distribution<i32> distrib_int(-128, 127);
+
+    auto data = MakeUnique<i8[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_int(rng);
+    }
+
+    auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    hnsw_index.InsertVecsRaw(data.get(), element_size);
+    hnsw_index.Check();
+
+    hnsw_index.SetEf(10);
+    int correct = 0;
+    for (int i = 0; i < element_size; ++i) {
+        const i8 *query = data.get() + i * dim;
+        auto result = hnsw_index.KnnSearchSorted(query, 1);
+        if (result[0].second == (LabelT)i) {
+            ++correct;
+            EXPECT_EQ(result[0].first, 0.0f);
+        }
+    }
+    float correct_rate = float(correct) / element_size;
+    EXPECT_GE(correct_rate, 0.95);
+}
+
+TEST_F(HnswAlgTest, test8) {
+    using Hnsw = KnnHnsw<PQL2VecStoreType<float>, LabelT>;
+
+    int dim = 16;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+    int topk = 10;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    // pq distances are approximate, a vector is only expected among the topk results of itself
+    auto recall = [&](const Hnsw &hnsw_index) {
+        int correct = 0;
+        for (int i = 0; i < element_size; ++i) {
+            const float *query = data.get() + i * dim;
+            auto result = hnsw_index.KnnSearchSorted(query, topk);
+            for (const auto &[dist, label] : result) {
+                if (label == (LabelT)i) {
+                    ++correct;
+                    break;
+                }
+            }
+        }
+        return float(correct) / element_size;
+    };
+
+    LocalFileSystem fs;
+    {
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        // the codebooks are trained by the first insertion
+        hnsw_index.InsertVecsRaw(data.get(), element_size);
+        hnsw_index.Check();
+
+        hnsw_index.SetEf(50);
+        EXPECT_GE(recall(hnsw_index), 0.95);
+
+        u8 file_flags = FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG;
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(save_dir_ + "/test_hnsw_pq.bin", file_flags, FileLockType::kNoLock);
+        hnsw_index.Save(*file_handler);
+        file_handler->Close();
+    }
+    {
+        u8 file_flags = FileFlags::READ_FLAG;
+        UniquePtr<FileHandler> file_handler = fs.OpenFile(save_dir_ + "/test_hnsw_pq.bin", file_flags, FileLockType::kNoLock);
+        auto hnsw_index = Hnsw::Load(*file_handler);
+        hnsw_index.Check();
+
+        hnsw_index.SetEf(50);
+        EXPECT_GE(recall(hnsw_index), 0.95);
+        file_handler->Close();
+    }
+}
+
+TEST_F(HnswAlgTest, test9) {
+    using Hnsw = KnnHnsw<BinaryHammingVecStoreType, LabelT>;
+    static_assert(std::is_same_v<Hnsw::DistanceType, f32>);
+
+    // the dimension is in bits, the vectors are packed in bytes
+    int dim = 128;
+    int byte_n = dim / 8;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_int_distribution<i32> distrib_int(0, 255);
+
+    auto data = MakeUnique<u8[]>(byte_n * element_size);
+    for (int i = 0; i < byte_n * element_size; ++i) {
+        data[i] = distrib_int(rng);
+    }
+
+    auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    hnsw_index.InsertVecsRaw(data.get(), element_size);
+    hnsw_index.Check();
+
+    hnsw_index.SetEf(10);
+    int correct = 0;
+    for (int i = 0; i < element_size; ++i) {
+        const u8 *query = data.get() + i * byte_n;
+        auto result = hnsw_index.KnnSearchSorted(query, 1);
+        if (result[0].second == (LabelT)i) {
+            ++correct;
+            EXPECT_EQ(result[0].first, 0.0f);
+        }
+    }
+    float correct_rate = float(correct) / element_size;
+    EXPECT_GE(correct_rate, 0.95);
+}
+
+TEST_F(HnswAlgTest, test10) {
+    using Hnsw = KnnHnsw<PQL2VecStoreType<float>, LabelT>;
+
+    int dim = 16;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+    int batch_size = 32;
+    int topk = 10;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    // the index is created before the rows are inserted, the first batch trains the codebooks on a few vectors
+    auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    hnsw_index.InsertVecsRaw(data.get(), batch_size);
+    const auto &meta = hnsw_index.data_store().vec_store_meta();
+    Vector<float> first_codebook(meta.codebook(), meta.codebook() + dim * 256);
+    for (int i = batch_size; i < element_size; i += batch_size) {
+        hnsw_index.InsertVecsRaw(data.get() + i * dim, batch_size, i);
+    }
+    // the inserts don't train the codebooks again, searches may be reading them
+    EXPECT_TRUE(std::equal(first_codebook.begin(), first_codebook.end(), meta.codebook()));
+    // fewer than retrain_num_ vectors are inserted, the codebooks are trained on all of them when the memory index is dumped
+    hnsw_index.Optimize();
+    hnsw_index.Check();
+    EXPECT_FALSE(std::equal(first_codebook.begin(), first_codebook.end(), meta.codebook()));
+
+    hnsw_index.SetEf(50);
+    int correct = 0;
+    for (int i = 0; i < element_size; ++i) {
+        const float *query = data.get() + i * dim;
+        auto result = hnsw_index.KnnSearchSorted(query, topk);
+        for (const auto &[dist, label] : result) {
+            if (label == (LabelT)i) {
+                ++correct;
+                break;
+            }
+        }
+    }
+    // the graph is built with the distances of the first codebooks
+    float correct_rate = float(correct) / element_size;
+    EXPECT_GE(correct_rate, 0.9);
+}
+
+// uint8 vectors are compared in i32, float16 vectors are widened to f32
+TEST_F(HnswAlgTest, test11) {
+    int dim = 16;
+    int M = 8;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+
+    auto TestSelfSearch = [&]<typename Hnsw, typename DataType>(const DataType *data) {
+        static_assert(std::is_same_v<typename Hnsw::DistanceType, f32>);
+        auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+        hnsw_index.InsertVecsRaw(data, element_size);
+        hnsw_index.Check();
+
+        hnsw_index.SetEf(10);
+        int correct = 0;
+        for (int i = 0; i < element_size; ++i) {
+            const DataType *query = data + i * dim;
+            auto result = hnsw_index.KnnSearchSorted(query, 1);
+            if (result[0].second == (LabelT)i) {
+                ++correct;
+                EXPECT_EQ(result[0].first, 0.0f);
+            }
+        }
+        float correct_rate = float(correct) / element_size;
+        EXPECT_GE(correct_rate, 0.95);
+    };
+
+    std::mt19937 rng;
+    rng.seed(0);
+    {
+        std::uniform_int_distribution<i32> distrib_int(0, 255);
+        auto data = MakeUnique<u8[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = distrib_int(rng);
+        }
+        TestSelfSearch.template operator()<KnnHnsw<PlainL2VecStoreType<u8>, LabelT>>(data.get());
+    }
+    {
+        std::uniform_real_distribution<float> distrib_real(-1.0f, 1.0f);
+        auto data = MakeUnique<Float16T[]>(dim * element_size);
+        for (int i = 0; i < dim * element_size; ++i) {
+            data[i] = Float16T(distrib_real(rng));
+        }
+        TestSelfSearch.template operator()<KnnHnsw<PlainL2VecStoreType<Float16T>, LabelT>>(data.get());
+    }
+}
@@ -0,0 +1,75 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import hnsw_common;
+import visited_table;
+
+using namespace infinity;
+
+class VisitedTableTest : public BaseTest {};
+
+TEST_F(VisitedTableTest, test_reset) {
+    VisitedTable table;
+    table.Reset(100);
+    EXPECT_FALSE(table.TestAndSet(3));
+    EXPECT_TRUE(table.TestAndSet(3));
+    EXPECT_TRUE(table.Visited(3));
+    EXPECT_FALSE(table.Visited(4));
+
+    // A new search sees nothing visited
+    table.Reset(100);
+    EXPECT_FALSE(table.Visited(3));
+
+    // Grow keeps working
+    table.Reset(1000);
+    EXPECT_GE(table.capacity(), 1000u);
+    EXPECT_FALSE(table.Visited(999));
+    table.Set(999);
+    EXPECT_TRUE(table.Visited(999));
+}
+
+TEST_F(VisitedTableTest, test_epoch_wrap) {
+    VisitedTable table;
+    table.Reset(16);
+    table.Set(5);
+    // Run through a whole epoch cycle, vertex 5 must not look visited when the epoch value comes back
+    for (SizeT i = 0; i < std::numeric_limits<VisitedTable::TagType>::max() + 1; ++i) {
+        table.Reset(16);
+        EXPECT_FALSE(table.Visited(5));
+    }
+}
+
+TEST_F(VisitedTableTest, test_pool) {
+    auto &pool = VisitedTablePool::ThreadLocal();
+    VisitedTable *first = nullptr;
+    {
+        auto visited = pool.Acquire(64);
+        first = &*visited;
+        visited->Set(1);
+        {
+            // Nested search gets another table
+            auto nested = pool.Acquire(64);
+            EXPECT_NE(&*nested, first);
+            EXPECT_FALSE(nested->Visited(1));
+        }
+    }
+    {
+        // Released tables are reused and come back cleared
+        auto visited = pool.Acquire(64);
+        EXPECT_FALSE(visited->Visited(1));
+    }
+}
@@ -0,0 +1,156 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+
+import stl;
+import third_party;
+import catalog_snapshot;
+import file_system;
+import local_file_system;
+import file_system_type;
+import infinity_exception;
+import table_meta;
+import cleanup_scanner;
+
+using namespace infinity;
+
+class CatalogSnapshotTest : public BaseTest {
+protected:
+    static nlohmann::json MakeTable(const String &table_name, SizeT segment_count) {
+        nlohmann::json table_json;
+        table_json["table_name"] = table_name;
+        for (SizeT i = 0; i < segment_count; ++i) {
+            nlohmann::json segment_json;
+            segment_json["segment_id"] = i;
+            segment_json["row_count"] = i * 8192;
+            table_json["segments"].emplace_back(segment_json);
+        }
+        return table_json;
+    }
+
+    static nlohmann::json MakeDirectory(const Vector<Pair<String, CatalogSnapshotRef>> &refs) {
+        nlohmann::json directory_json;
+        directory_json["next_txn_id"] = 42;
+        for (const auto &[table_name, ref] : refs) {
+            nlohmann::json ref_json;
+            ref_json["table_name"] = table_name;
+            ref.ToJson(ref_json);
+            directory_json["tables"].emplace_back(ref_json);
+        }
+        return directory_json;
+    }
+};
+
+TEST_F(CatalogSnapshotTest, write_copy_and_read) {
+    String path1 = String(GetTmpDir()) + "/FULL.1.ckp";
+    String path2 = String(GetTmpDir()) + "/FULL.2.ckp";
+    nlohmann::json table1 = MakeTable("t1", 10);
+    nlohmann::json table2 = MakeTable("t2", 1000);
+
+    Vector<Pair<String, CatalogSnapshotRef>> refs1;
+    {
+        CatalogSnapshotWriter writer(path1, {});
+        refs1.emplace_back("t1", writer.WriteTable(table1));
+        refs1.emplace_back("t2", writer.WriteTable(table2));
+        writer.Finish(MakeDirectory(refs1));
+    }
+    SharedPtr<CatalogSnapshot> snapshot1 = CatalogSnapshot::Open(path1);
+    ASSERT_NE(snapshot1, nullptr);
+    EXPECT_EQ(snapshot1->ReadDirectory(), MakeDirectory(refs1));
+    EXPECT_EQ(snapshot1->ReadTable(refs1[0].second), table1);
+    EXPECT_EQ(snapshot1->ReadTable(refs1[1].second), table2);
+
+    // t1 changes, t2 is copied without being decoded
+    table1 = MakeTable("t1", 20);
+    Vector<Pair<String, CatalogSnapshotRef>> refs2;
+    SharedPtr<CatalogSnapshot> bound_snapshot;
+    {
+        CatalogSnapshotWriter writer(path2, {"#default_db#t1"});
+        EXPECT_TRUE(writer.TableChanged("#default_db#t1"));
+        EXPECT_FALSE(writer.TableChanged("#default_db#t2"));
+        refs2.emplace_back("t1", writer.WriteTable(table1));
+        refs2.emplace_back("t2", writer.CopyTable(*snapshot1, refs1[1].second));
+        EXPECT_EQ(writer.written_table_count(), 1u);
+        EXPECT_EQ(writer.copied_table_count(), 1u);
+        writer.OnOpen([&](const SharedPtr<CatalogSnapshot> &snapshot) { bound_snapshot = snapshot; });
+        writer.Finish(MakeDirectory(refs2));
+        writer.Bind(CatalogSnapshot::Open(path2));
+    }
+    ASSERT_NE(bound_snapshot, nullptr);
+    EXPECT_EQ(refs2[1].second.size_, refs1[1].second.size_);
+    EXPECT_EQ(refs2[1].second.checksum_, refs1[1].second.checksum_);
+    EXPECT_EQ(bound_snapshot->ReadTable(refs2[0].second), table1);
+    EXPECT_EQ(bound_snapshot->ReadTable(refs2[1].second), table2);
+}
+
+TEST_F(CatalogSnapshotTest, corrupted) {
+    String path = String(GetTmpDir()) + "/FULL.3.ckp";
+    CatalogSnapshotRef ref;
+    {
+        CatalogSnapshotWriter writer(path, {});
+        ref = writer.WriteTable(MakeTable("t1", 100));
+        writer.Finish(MakeDirectory({{"t1", ref}}));
+    }
+    LocalFileSystem fs;
+    {
+        auto file_handler = fs.OpenFile(path, FileFlags::READ_FLAG | FileFlags::WRITE_FLAG, FileLockType::kNoLock);
+        char byte = 0;
+        fs.ReadAt(*file_handler, ref.offset_ + ref.size_ / 2, &byte, 1);
+        byte = ~byte;
+        fs.WriteAt(*file_handler, ref.offset_ + ref.size_ / 2, &byte, 1);
+        file_handler->Close();
+    }
+    SharedPtr<CatalogSnapshot> snapshot = CatalogSnapshot::Open(path);
+    ASSERT_NE(snapshot, nullptr);
+    snapshot->ReadDirectory();
+    EXPECT_THROW(snapshot->ReadTable(ref), RecoverableException);
+}
+
+TEST_F(CatalogSnapshotTest, json_checkpoint) {
+    String path = String(GetTmpDir()) + "/FULL.4.json";
+    String json_str = MakeDirectory({}).dump();
+    LocalFileSystem fs;
+    {
+        auto file_handler = fs.OpenFile(path, FileFlags::WRITE_FLAG | FileFlags::CREATE_FLAG, FileLockType::kNoLock);
+        file_handler->Write(json_str.data(), json_str.size());
+        file_handler->Close();
+    }
+    EXPECT_EQ(CatalogSnapshot::Open(path), nullptr);
+}
+
+// A table without garbage in the checkpoint is skipped by the cleanup without being loaded.
+TEST_F(CatalogSnapshotTest, cleanup_unloaded_table) {
+    String path = String(GetTmpDir()) + "/FULL.5.ckp";
+    CatalogSnapshotRef ref;
+    {
+        CatalogSnapshotWriter writer(path, {});
+        ref = writer.WriteTable(MakeTable("t1", 10));
+        ref.has_garbage_ = false;
+        writer.Finish(MakeDirectory({{"t1", ref}}));
+    }
+    SharedPtr<CatalogSnapshot> snapshot = CatalogSnapshot::Open(path);
+    ASSERT_NE(snapshot, nullptr);
+    nlohmann::json ref_json = snapshot->ReadDirectory()["tables"][0];
+    EXPECT_FALSE(CatalogSnapshotRef::FromJson(ref_json).has_garbage_);
+    ref_json["db_entry_dir"] = String(GetTmpDir());
+
+    UniquePtr<TableMeta> table_meta = TableMeta::LoadFromSnapshot(ref_json, snapshot, nullptr, nullptr);
+    CleanupScanner scanner(nullptr, 100, nullptr);
+    EXPECT_FALSE(table_meta->PickCleanup(&scanner));
+    EXPECT_FALSE(table_meta->Empty());
+    table_meta->Cleanup();
+    // still not loaded
+    EXPECT_FALSE(table_meta->MayHaveIndex());
+}
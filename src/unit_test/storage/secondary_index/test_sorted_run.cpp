@@ -0,0 +1,94 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <algorithm>
+#include <random>
+import stl;
+import secondary_index_sorted_run;
+
+using namespace infinity;
+
+class SortedRunTest : public BaseTest {};
+
+// Inserts batches of random keys and compares the runs with a sort of all rows.
+TEST_F(SortedRunTest, insert_and_range) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<i32> key_dist(-1000, 1000);
+    std::uniform_int_distribution<u32> batch_dist(1, 300);
+
+    SecondaryIndexSortedRuns<i32> sorted_runs;
+    Vector<Pair<i32, u32>> expect;
+    u32 offset = 0;
+    for (int batch = 0; batch < 200; ++batch) {
+        Vector<Pair<i32, u32>> pairs;
+        for (u32 i = batch_dist(rng); i > 0; --i) {
+            pairs.emplace_back(key_dist(rng), offset++);
+        }
+        expect.insert(expect.end(), pairs.begin(), pairs.end());
+        sorted_runs.Insert(pairs);
+    }
+    std::sort(expect.begin(), expect.end());
+    EXPECT_EQ(sorted_runs.RowCount(), expect.size());
+
+    auto runs = sorted_runs.Snapshot();
+    // every run is more than twice as large as the next one
+    for (SizeT i = 1; i < runs->size(); ++i) {
+        EXPECT_GT((*runs)[i - 1]->size(), 2 * (*runs)[i]->size());
+    }
+
+    auto merged = SecondaryIndexSortedRuns<i32>::MergeAll(*runs);
+    ASSERT_EQ(merged->size(), expect.size());
+    for (SizeT i = 0; i < expect.size(); ++i) {
+        EXPECT_EQ(merged->keys_[i], expect[i].first);
+        EXPECT_EQ(merged->offsets_[i], expect[i].second);
+    }
+
+    for (auto [b, e] : Vector<Pair<i32, i32>>{{-2000, 2000}, {-10, 10}, {5, 5}, {10, -10}, {1001, 2000}}) {
+        Vector<u32> result;
+        for (const auto &run : *runs) {
+            const auto [begin, end] = run->Range(b, e);
+            result.insert(result.end(), run->offsets_.begin() + begin, run->offsets_.begin() + end);
+        }
+        std::sort(result.begin(), result.end());
+        Vector<u32> expect_result;
+        for (const auto &[key, row] : expect) {
+            if (b <= key and key <= e) {
+                expect_result.push_back(row);
+            }
+        }
+        std::sort(expect_result.begin(), expect_result.end());
+        EXPECT_EQ(result, expect_result);
+    }
+}
+
+// A snapshot is not changed by later inserts.
+TEST_F(SortedRunTest, snapshot) {
+    SecondaryIndexSortedRuns<i32> sorted_runs;
+    Vector<Pair<i32, u32>> pairs = {{3, 0}, {1, 1}, {2, 2}};
+    sorted_runs.Insert(pairs);
+    auto snapshot = sorted_runs.Snapshot();
+
+    pairs = {{1, 3}, {0, 4}, {5, 5}, {2, 6}};
+    sorted_runs.Insert(pairs);
+    EXPECT_EQ(sorted_runs.RowCount(), 7u);
+
+    auto old_run = SecondaryIndexSortedRuns<i32>::MergeAll(*snapshot);
+    EXPECT_EQ(old_run->keys_, (Vector<i32>{1, 2, 3}));
+    EXPECT_EQ(old_run->offsets_, (Vector<u32>{1, 2, 0}));
+
+    auto new_run = SecondaryIndexSortedRuns<i32>::MergeAll(*sorted_runs.Snapshot());
+    EXPECT_EQ(new_run->keys_, (Vector<i32>{0, 1, 1, 2, 2, 3, 5}));
+    EXPECT_EQ(new_run->offsets_, (Vector<u32>{4, 1, 3, 2, 6, 0, 5}));
+}
@@ -401,3 +401,46 @@ TEST_F(WalEntryTest, WalListIterator) {
     EXPECT_EQ(catalog_path, ckp_file_path);
     EXPECT_EQ(replay_entries.size(), 1u);
 }
+
+TEST_F(WalEntryTest, WalListIteratorBatch) {
+    using namespace infinity;
+    RemoveDbDirs();
+    std::filesystem::create_directories(GetWalDir());
+    String wal_file_path1 = String(GetWalDir()) + "/wal.log";
+    String wal_file_path2 = String(GetWalDir()) + "/wal2.log";
+    String ckp_file_path = String(GetDataDir()) + "/catalog/META_123.full.json";
+    MockWalFile(wal_file_path1, ckp_file_path);
+    MockWalFile(wal_file_path2, ckp_file_path);
+
+    Vector<SharedPtr<WalEntry>> expect_entries;
+    {
+        WalListIterator iterator({wal_file_path1, wal_file_path2});
+        while (true) {
+            auto wal_entry = iterator.Next();
+            if (wal_entry.get() == nullptr) {
+                break;
+            }
+            expect_entries.push_back(wal_entry);
+        }
+    }
+    EXPECT_FALSE(expect_entries.empty());
+
+    for (SizeT batch_size : {1, 2, 1024}) {
+        for (SizeT thread_num : {1, 4}) {
+            Vector<SharedPtr<WalEntry>> entries;
+            WalListIterator iterator({wal_file_path1, wal_file_path2});
+            while (true) {
+                auto batch = iterator.NextBatch(batch_size, thread_num);
+                if (batch.empty()) {
+                    break;
+                }
+                EXPECT_LE(batch.size(), batch_size);
+                entries.insert(entries.end(), batch.begin(), batch.end());
+            }
+            ASSERT_EQ(entries.size(), expect_entries.size());
+            for (SizeT i = 0; i < entries.size(); ++i) {
+                EXPECT_EQ(*entries[i], *expect_entries[i]);
+            }
+        }
+    }
+}
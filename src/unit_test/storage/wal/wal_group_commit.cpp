@@ -0,0 +1,136 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "unit_test/base_test.h"
+#include <filesystem>
+#include <thread>
+
+import stl;
+import third_party;
+import global_resource_usage;
+import storage;
+import infinity_context;
+import txn_manager;
+import txn;
+import wal_manager;
+import extra_ddl_info;
+import status;
+import default_values;
+
+using namespace infinity;
+
+class WalGroupCommitTest : public BaseTest {
+protected:
+    static std::shared_ptr<std::string> config_path() {
+        return std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_wal_group_commit.toml");
+    }
+
+    void SetUp() override { RemoveDbDirs(); }
+
+    void TearDown() override { RemoveDbDirs(); }
+
+    static constexpr SizeT kThreadNum = 8;
+    static constexpr SizeT kCommitPerThread = 4;
+
+    // every thread commits kCommitPerThread databases, a thread waits for its commit to be flushed before the next one
+    static void CreateDatabases(TxnManager *txn_mgr) {
+        Vector<std::thread> threads;
+        for (SizeT t = 0; t < kThreadNum; ++t) {
+            threads.emplace_back([txn_mgr, t] {
+                for (SizeT i = 0; i < kCommitPerThread; ++i) {
+                    auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create db"));
+                    Status status = txn->CreateDatabase(fmt::format("db_{}_{}", t, i), ConflictType::kError);
+                    EXPECT_TRUE(status.ok());
+                    txn_mgr->CommitTxn(txn);
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    }
+};
+
+// The concurrent commits arriving within wal_group_commit_max_wait share an fdatasync.
+TEST_F(WalGroupCommitTest, batch_commits) {
+#ifdef INFINITY_DEBUG
+    infinity::GlobalResourceUsage::Init();
+#endif
+    infinity::InfinityContext::instance().Init(WalGroupCommitTest::config_path());
+    Storage *storage = infinity::InfinityContext::instance().storage();
+    TxnManager *txn_mgr = storage->txn_manager();
+    WalManager *wal_mgr = storage->wal_manager();
+
+    u64 sync_count = wal_mgr->SyncCount();
+    CreateDatabases(txn_mgr);
+    sync_count = wal_mgr->SyncCount() - sync_count;
+    EXPECT_GT(sync_count, 0u);
+    EXPECT_LT(sync_count, kThreadNum * kCommitPerThread);
+
+    infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+    EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+    infinity::GlobalResourceUsage::UnInit();
+#endif
+}
+
+// The blocks of the wal file are reserved without changing its size, so the entries are replayed from the end of the file.
+TEST_F(WalGroupCommitTest, replay_preallocated_wal) {
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        infinity::InfinityContext::instance().Init(WalGroupCommitTest::config_path());
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        WalManager *wal_mgr = storage->wal_manager();
+
+        CreateDatabases(txn_mgr);
+        const auto wal_file_size = std::filesystem::file_size(wal_mgr->GetWalFilename());
+        EXPECT_GT(wal_file_size, 0u);
+        EXPECT_LT(wal_file_size, u64(WAL_PREALLOCATE_SIZE));
+
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        infinity::InfinityContext::instance().Init(WalGroupCommitTest::config_path());
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get db"));
+        for (SizeT t = 0; t < kThreadNum; ++t) {
+            for (SizeT i = 0; i < kCommitPerThread; ++i) {
+                auto [db_entry, status] = txn->GetDatabase(fmt::format("db_{}_{}", t, i));
+                EXPECT_TRUE(status.ok());
+            }
+        }
+        txn_mgr->CommitTxn(txn);
+
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}
@@ -17,6 +17,7 @@
 #include <memory>
 
 import stl;
+import third_party;
 import global_resource_usage;
 import storage;
 import infinity_context;
@@ -1000,3 +1001,129 @@ TEST_F(WalReplayTest, wal_replay_create_index_hnsw) {
 #endif
     }
 }
+
+TEST_F(WalReplayTest, wal_replay_multi_tables) {
+    constexpr SizeT table_count = 4;
+    constexpr SizeT round_count = 8;
+    Vector<SharedPtr<ColumnDef>> columns;
+    {
+        std::set<ConstraintType> constraints;
+        auto column_def_ptr = MakeShared<ColumnDef>(0, MakeShared<DataType>(DataType(LogicalType::kBigInt)), "big_int_col", constraints);
+        columns.emplace_back(column_def_ptr);
+    }
+    auto MakeInputBlock = [](SizeT row_count) {
+        SharedPtr<DataBlock> input_block = MakeShared<DataBlock>();
+        Vector<SharedPtr<DataType>> column_types;
+        column_types.emplace_back(MakeShared<DataType>(LogicalType::kBigInt));
+        input_block->Init(column_types, row_count);
+        for (SizeT i = 0; i < row_count; ++i) {
+            input_block->AppendValue(0, Value::MakeBigInt(static_cast<i64>(i)));
+        }
+        input_block->Finalize();
+        return input_block;
+    };
+    auto TableName = [](SizeT table_id) { return fmt::format("tbl{}", table_id); };
+
+    Vector<SizeT> expect_row_counts(table_count + 1);
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        BGTaskProcessor *bg_processor = storage->bg_processor();
+
+        for (SizeT table_id = 0; table_id < table_count; ++table_id) {
+            auto table_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(TableName(table_id)), columns);
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+            Status status = txn->CreateTable("default_db", std::move(table_def), ConflictType::kIgnore);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+        }
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("full ckp"));
+            SharedPtr<ForceCheckpointTask> force_ckp_task = MakeShared<ForceCheckpointTask>(txn, false);
+            bg_processor->Submit(force_ckp_task);
+            force_ckp_task->Wait();
+            txn_mgr->CommitTxn(txn);
+        }
+
+        for (SizeT round = 0; round < round_count; ++round) {
+            if (round == round_count / 2) {
+                // a catalog command in the middle of the data commands
+                auto table_def = MakeUnique<TableDef>(MakeShared<String>("default_db"), MakeShared<String>(TableName(table_count)), columns);
+                auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+                Status status = txn->CreateTable("default_db", std::move(table_def), ConflictType::kIgnore);
+                EXPECT_TRUE(status.ok());
+                txn_mgr->CommitTxn(txn);
+            }
+            SizeT table_end = round < round_count / 2 ? table_count : table_count + 1;
+            for (SizeT table_id = 0; table_id < table_end; ++table_id) {
+                auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+                auto [table_entry, status] = txn->GetTableByName("default_db", TableName(table_id));
+                EXPECT_TRUE(status.ok());
+                txn->Append(table_entry, MakeInputBlock(round + 1));
+                txn_mgr->CommitTxn(txn);
+                expect_row_counts[table_id] += round + 1;
+            }
+        }
+        {
+            // one wal entry with the commands on two tables
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert tables"));
+            for (SizeT table_id = 0; table_id < 2; ++table_id) {
+                auto [table_entry, status] = txn->GetTableByName("default_db", TableName(table_id));
+                EXPECT_TRUE(status.ok());
+                txn->Append(table_entry, MakeInputBlock(3));
+                expect_row_counts[table_id] += 3;
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("delete"));
+            auto [table_entry, status] = txn->GetTableByName("default_db", TableName(0));
+            EXPECT_TRUE(status.ok());
+            Vector<RowID> row_ids{RowID(0, 0), RowID(0, 1)};
+            status = txn->Delete(table_entry, row_ids);
+            EXPECT_TRUE(status.ok());
+            txn_mgr->CommitTxn(txn);
+            expect_row_counts[0] -= row_ids.size();
+        }
+
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+    // Restart the db instance
+    {
+#ifdef INFINITY_DEBUG
+        infinity::GlobalResourceUsage::Init();
+#endif
+        std::shared_ptr<std::string> config_path = WalReplayTest::config_path();
+        infinity::InfinityContext::instance().Init(config_path);
+
+        Storage *storage = infinity::InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        {
+            auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("check table"));
+            for (SizeT table_id = 0; table_id <= table_count; ++table_id) {
+                auto [table_entry, status] = txn->GetTableByName("default_db", TableName(table_id));
+                EXPECT_TRUE(status.ok());
+                EXPECT_EQ(table_entry->row_count(), expect_row_counts[table_id]);
+            }
+            txn_mgr->CommitTxn(txn);
+        }
+
+        infinity::InfinityContext::instance().UnInit();
+#ifdef INFINITY_DEBUG
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetObjectCount(), 0);
+        EXPECT_EQ(infinity::GlobalResourceUsage::GetRawMemoryCount(), 0);
+        infinity::GlobalResourceUsage::UnInit();
+#endif
+    }
+}